@@ -105,6 +105,13 @@ namespace EmEn::Audio
 		/* Sets the music chunk size in bytes. */
 		m_musicChunkSize = m_primaryServices.settings().get< uint32_t >(AudioMusicChunkSizeKey, DefaultAudioMusicChunkSize);
 
+		/* NOTE: The sounds converted to the playback format are kept between runs. A zero size disables the cache. */
+		if ( const auto cacheMaximumSize = m_primaryServices.settings().get< uint32_t >(AudioCacheMaximumSizeKey, DefaultAudioCacheMaximumSize); cacheMaximumSize > 0 )
+		{
+			m_waveCache.setDirectory(m_primaryServices.fileSystem().cacheDirectory(WaveCacheDirectory));
+			m_waveCache.setMaximumBytes(static_cast< uint64_t >(cacheMaximumSize) * 1048576);
+		}
+
 		this->queryDevices();
 
 		/* Take the default device. */
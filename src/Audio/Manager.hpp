@@ -41,6 +41,7 @@
 
 /* Local inclusions for usages. */
 #include "Libs/WaveFactory/Types.hpp"
+#include "Libs/WaveFactory/WaveCache.hpp"
 #include "SettingKeys.hpp"
 #include "Source.hpp" // FIXME
 #include "SoundEnvironmentProperties.hpp"
@@ -78,6 +79,9 @@ namespace EmEn::Audio
 			/** @brief Class identifier. */
 			static constexpr auto ClassId{"AudioManagerService"};
 
+			/** @brief The sub-directory of the cache directory holding the converted sounds. */
+			static constexpr auto WaveCacheDirectory{"audio"};
+
 			/** @brief Observable class unique identifier. */
 			static const size_t ClassUID;
 
@@ -207,6 +211,17 @@ namespace EmEn::Audio
 			[[nodiscard]]
 			size_t musicChunkSize () const noexcept;
 
+			/**
+			 * @brief Returns the reference to the converted sound cache.
+			 * @return Libs::WaveFactory::WaveCache &
+			 */
+			[[nodiscard]]
+			Libs::WaveFactory::WaveCache &
+			waveCache () noexcept
+			{
+				return m_waveCache;
+			}
+
 			/**
 			 * @brief Sets the master volume.
 			 * @param gain The gain from 0.0 to 1.0.
@@ -393,6 +408,7 @@ namespace EmEn::Audio
 			std::vector< std::shared_ptr< Source > > m_sources;
 			Libs::WaveFactory::Frequency m_playbackFrequency{Libs::WaveFactory::Frequency::PCM22050Hz};
 			size_t m_musicChunkSize{DefaultAudioMusicChunkSize};
+			Libs::WaveFactory::WaveCache m_waveCache;
 			std::array< bool, 8 > m_flags{
 				false/*ServiceInitialized*/,
 				false/*ShowInformation*/,
@@ -36,7 +36,6 @@
 #endif
 
 /* Local inclusions. */
-#include "Libs/WaveFactory/Processor.hpp"
 #include "Resources/Manager.hpp"
 #include "Buffer.hpp"
 #include "Manager.hpp"
@@ -65,6 +64,12 @@ namespace EmEn::Audio
 	bool
 	MusicResource::onDependenciesLoaded () noexcept
 	{
+		/* NOTE: A streamed music gets its buffers from the music stream playing it. */
+		if ( this->isStreamed() )
+		{
+			return true;
+		}
+
 		const auto chunkSize = Manager::instance()->musicChunkSize();
 		const auto chunkCount = m_localData.chunkCount(chunkSize);
 
@@ -160,62 +165,44 @@ namespace EmEn::Audio
 			return false;
 		}
 
-		if ( !m_localData.readFile(filepath) )
+		/* NOTE: Only the file header is read here, the decoding and the resampling
+		 * to the playback frequency are done chunk by chunk while playing. */
+		WaveFactory::StreamReader reader;
+
+		if ( !reader.open(filepath, Manager::instance()->frequencyPlayback()) )
 		{
 			TraceError{ClassId} << "Unable to load the music file '" << filepath << "' !";
 
 			return this->setLoadSuccess(false);
 		}
 
-		const auto frequencyPlayback = Manager::instance()->frequencyPlayback();
-
-		/* Checks frequency for playback within audio engine. */
-		if ( m_localData.frequency() != frequencyPlayback )
+		if ( reader.sourceFrequency() != reader.frequency() )
 		{
-			TraceWarning{ClassId} <<
-				"Music '" << this->name() << "' frequency mismatch the system ! "
-				"Resampling the wave from " << static_cast< int >(m_localData.frequency()) << "Hz to " << static_cast< int >(frequencyPlayback) << "Hz ...";
-
-			/* Copy the buffer in float (single precision) format. */
-			WaveFactory::Processor processor(m_localData);
-
-			/* Launch a mix down process ... */
-			/* FIXME: If music is not stereo, so mono or 5.1 for instance set it to a stereo wave format. */
-			/*if ( m_localData.channels() != WaveFactory::Channels::Stereo )
-			{
-				Tracer::info(ClassId, Blob() << "The sound '" << this->name() << "' is multichannel ! Performing a mix down ...");
-
-				if ( !processor.mixDown() )
-				{
-					Tracer::error(ClassId, "Mix down failed !");
-
-					return this->setLoadSuccess(false);
-				}
-			}*/
-
-			/* Launch a resampling process ... */
-			if ( !processor.resample(frequencyPlayback) )
-			{
-				TraceError{ClassId} << "Unable to resample the wave to " << static_cast< int >(frequencyPlayback) << "Hz !";
-
-				return this->setLoadSuccess(false);
-			}
-
-			/* Gets back the buffer in 16bits integer format. */
-			if ( !processor.toWave(m_localData) )
-			{
-				Tracer::error(ClassId, "Unable to copy the fixed wave format !");
-
-				return this->setLoadSuccess(false);
-			}
+			TraceInfo{ClassId} <<
+				"Music '" << this->name() << "' will be resampled from " << static_cast< int >(reader.sourceFrequency()) << "Hz "
+				"to " << static_cast< int >(reader.frequency()) << "Hz during the playback.";
 		}
 
+		m_filepath = filepath;
+		m_duration = reader.duration();
+
 		/* Read optional metadata from soundtrack if available. */
 		this->readMetaData(filepath);
 
 		return this->setLoadSuccess(true);
 	}
 
+	bool
+	MusicResource::openStream (WaveFactory::StreamReader & reader) const noexcept
+	{
+		if ( !this->isStreamed() )
+		{
+			return false;
+		}
+
+		return reader.open(m_filepath, Manager::instance()->frequencyPlayback());
+	}
+
 	bool
 	MusicResource::load (const Json::Value & /*data*/) noexcept
 	{
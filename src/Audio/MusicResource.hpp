@@ -29,6 +29,7 @@
 /* STL inclusions. */
 #include <cstddef>
 #include <cstdint>
+#include <filesystem>
 #include <memory>
 #include <string>
 #include <vector>
@@ -38,12 +39,15 @@
 #include "Resources/ResourceTrait.hpp"
 
 /* Local inclusions. */
+#include "Libs/WaveFactory/StreamReader.hpp"
 #include "Resources/Container.hpp"
 
 namespace EmEn::Audio
 {
 	/**
 	 * @brief The music resource class.
+	 * @note A music loaded from a file is not decoded in memory. Only its header is checked at loading,
+	 * then it is decoded and resampled progressively during the playback, see MusicStream.
 	 * @extends EmEn::Audio::PlayableInterface
 	 * @extends EmEn::Resources::ResourceTrait This is a loadable resource.
 	 */
@@ -95,7 +99,12 @@ namespace EmEn::Audio
 			std::shared_ptr< const Buffer >
 			buffer (size_t bufferIndex = 0) const noexcept override
 			{
-				return m_buffers.at(bufferIndex);
+				if ( bufferIndex >= m_buffers.size() )
+				{
+					return nullptr;
+				}
+
+				return m_buffers[bufferIndex];
 			}
 
 			/** @copydoc EmEn::Resources::ResourceTrait::classLabel() const */
@@ -136,6 +145,47 @@ namespace EmEn::Audio
 				return m_localData;
 			}
 
+			/**
+			 * @brief Returns whether the music is streamed from its file instead of being held in buffers.
+			 * @return bool
+			 */
+			[[nodiscard]]
+			bool
+			isStreamed () const noexcept
+			{
+				return !m_filepath.empty();
+			}
+
+			/**
+			 * @brief Returns the music file path, empty when the music is not streamed.
+			 * @return const std::filesystem::path &
+			 */
+			[[nodiscard]]
+			const std::filesystem::path &
+			filepath () const noexcept
+			{
+				return m_filepath;
+			}
+
+			/**
+			 * @brief Returns the duration of a streamed music in seconds.
+			 * @return float
+			 */
+			[[nodiscard]]
+			float
+			duration () const noexcept
+			{
+				return m_duration;
+			}
+
+			/**
+			 * @brief Opens a reader on the music file, converting to the playback frequency.
+			 * @param reader A reference to a stream reader.
+			 * @return bool
+			 */
+			[[nodiscard]]
+			bool openStream (Libs::WaveFactory::StreamReader & reader) const noexcept;
+
 			/**
 			 * @brief Returns the title of the music.
 			 * @return const std::string &
@@ -190,6 +240,8 @@ namespace EmEn::Audio
 
 			std::vector< std::shared_ptr< Buffer > > m_buffers;
 			Libs::WaveFactory::Wave< int16_t > m_localData;
+			std::filesystem::path m_filepath;
+			float m_duration{0.0F};
 			std::string m_title{DefaultInfo};
 			std::string m_artist{DefaultInfo};
 	};
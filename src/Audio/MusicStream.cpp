@@ -0,0 +1,198 @@
+/*
+ * src/Audio/MusicStream.cpp
+ * This file is part of Emeraude-Engine
+ *
+ * Copyright (C) 2010-2025 - Sébastien Léon Claude Christian Bémelmans "LondNoir" <londnoir@gmail.com>
+ *
+ * Emeraude-Engine is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * Emeraude-Engine is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with Emeraude-Engine; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * Complete project and additional information can be found at :
+ * https://github.com/londnoir/emeraude-engine
+ *
+ * --- THIS IS AUTOMATICALLY GENERATED, DO NOT CHANGE ---
+ */
+
+#include "MusicStream.hpp"
+
+/* STL inclusions. */
+#include <algorithm>
+
+/* Local inclusions. */
+#include "Manager.hpp"
+#include "MusicResource.hpp"
+#include "Source.hpp"
+#include "Tracer.hpp"
+
+namespace EmEn::Audio
+{
+	using namespace EmEn::Libs;
+
+	bool
+	MusicStream::start (const MusicResource & track, Source & source, bool loop) noexcept
+	{
+		const std::lock_guard< std::mutex > lock{m_access};
+
+		this->release(source);
+
+		if ( !track.openStream(m_reader) )
+		{
+			TraceError{ClassId} << "Unable to open the stream of music '" << track.name() << "' !";
+
+			return false;
+		}
+
+		/* NOTE: The music chunk size setting counts 16 bits values, all channels included. */
+		m_chunkFrames = std::max< size_t >(1, Manager::instance()->musicChunkSize() / static_cast< size_t >(m_reader.channels()));
+		m_loop = loop;
+
+		for ( auto & buffer : m_buffers )
+		{
+			if ( buffer == nullptr )
+			{
+				buffer = std::make_shared< Buffer >();
+
+				if ( !buffer->isCreated() )
+				{
+					Tracer::error(ClassId, "Unable to create a streaming buffer !");
+
+					buffer.reset();
+
+					return false;
+				}
+			}
+
+			if ( !this->fillBuffer(*buffer) )
+			{
+				break;
+			}
+
+			if ( !source.queueBuffer(*buffer) )
+			{
+				Tracer::error(ClassId, "Unable to queue a streaming buffer !");
+
+				this->release(source);
+
+				return false;
+			}
+
+			m_queuedCount++;
+		}
+
+		if ( m_queuedCount == 0 )
+		{
+			TraceError{ClassId} << "The music '" << track.name() << "' has no data to play !";
+
+			return false;
+		}
+
+		m_active = source.playQueue();
+
+		return m_active;
+	}
+
+	bool
+	MusicStream::update (Source & source) noexcept
+	{
+		const std::lock_guard< std::mutex > lock{m_access};
+
+		if ( !m_active )
+		{
+			return false;
+		}
+
+		for ( auto identifier = source.unqueueProcessedBuffer(); identifier > 0; identifier = source.unqueueProcessedBuffer() )
+		{
+			m_queuedCount--;
+
+			const auto bufferIt = std::ranges::find_if(m_buffers, [identifier] (const auto & buffer) {
+				return buffer != nullptr && buffer->identifier() == identifier;
+			});
+
+			/* NOTE: Once the track is over, the played buffers are left out of the queue. */
+			if ( bufferIt == m_buffers.end() || !this->fillBuffer(**bufferIt) )
+			{
+				continue;
+			}
+
+			if ( source.queueBuffer(**bufferIt) )
+			{
+				m_queuedCount++;
+			}
+		}
+
+		/* NOTE: The source stops by itself when its queue runs dry,
+		 * either at the end of the track or because the refill came too late. */
+		if ( source.isStopped() )
+		{
+			if ( m_queuedCount > 0 )
+			{
+				TraceDebug{ClassId} << "The music stream ran out of data, restarting the source.";
+
+				source.playQueue();
+			}
+			else
+			{
+				this->release(source);
+			}
+		}
+
+		return m_active;
+	}
+
+	void
+	MusicStream::stop (Source & source) noexcept
+	{
+		const std::lock_guard< std::mutex > lock{m_access};
+
+		this->release(source);
+	}
+
+	void
+	MusicStream::release (Source & source) noexcept
+	{
+		if ( m_active || m_queuedCount > 0 )
+		{
+			source.clearQueue();
+		}
+
+		m_reader.close();
+		m_chunk.clear();
+		m_queuedCount = 0;
+		m_active = false;
+	}
+
+	bool
+	MusicStream::fillBuffer (Buffer & buffer) noexcept
+	{
+		auto frames = m_reader.read(m_chunkFrames, m_chunk);
+
+		if ( frames == 0 && m_loop && m_reader.isFinished() )
+		{
+			if ( !m_reader.rewind() )
+			{
+				return false;
+			}
+
+			frames = m_reader.read(m_chunkFrames, m_chunk);
+		}
+
+		if ( frames == 0 )
+		{
+			return false;
+		}
+
+		return buffer.feedData(m_chunk);
+	}
+}
@@ -0,0 +1,166 @@
+/*
+ * src/Audio/MusicStream.hpp
+ * This file is part of Emeraude-Engine
+ *
+ * Copyright (C) 2010-2025 - Sébastien Léon Claude Christian Bémelmans "LondNoir" <londnoir@gmail.com>
+ *
+ * Emeraude-Engine is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * Emeraude-Engine is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with Emeraude-Engine; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * Complete project and additional information can be found at :
+ * https://github.com/londnoir/emeraude-engine
+ *
+ * --- THIS IS AUTOMATICALLY GENERATED, DO NOT CHANGE ---
+ */
+
+#pragma once
+
+/* STL inclusions. */
+#include <cstddef>
+#include <cstdint>
+#include <array>
+#include <memory>
+#include <mutex>
+
+/* Local inclusions for usages. */
+#include "Libs/WaveFactory/StreamReader.hpp"
+#include "Libs/WaveFactory/Wave.hpp"
+#include "Buffer.hpp"
+
+/* Forward declarations. */
+namespace EmEn::Audio
+{
+	class MusicResource;
+	class Source;
+}
+
+namespace EmEn::Audio
+{
+	/**
+	 * @brief Plays a music file on a source through a small ring of buffers, refilled as they are played.
+	 * @note The memory used does not depend on the track length, and the playback starts after decoding
+	 * the first chunk only. The stream must be updated often enough to refill the played buffers.
+	 * The methods can be called from different threads.
+	 */
+	class MusicStream final
+	{
+		public:
+
+			/** @brief Class identifier. */
+			static constexpr auto ClassId{"MusicStream"};
+
+			/** @brief The number of buffers in the ring. */
+			static constexpr size_t BufferCount{4};
+
+			/**
+			 * @brief Constructs a music stream.
+			 */
+			MusicStream () noexcept = default;
+
+			/**
+			 * @brief Copy constructor.
+			 * @param copy A reference to the copied instance.
+			 */
+			MusicStream (const MusicStream & copy) noexcept = delete;
+
+			/**
+			 * @brief Move constructor.
+			 * @param copy A reference to the copied instance.
+			 */
+			MusicStream (MusicStream && copy) noexcept = delete;
+
+			/**
+			 * @brief Copy assignment.
+			 * @param copy A reference to the copied instance.
+			 * @return MusicStream &
+			 */
+			MusicStream & operator= (const MusicStream & copy) noexcept = delete;
+
+			/**
+			 * @brief Move assignment.
+			 * @param copy A reference to the copied instance.
+			 * @return MusicStream &
+			 */
+			MusicStream & operator= (MusicStream && copy) noexcept = delete;
+
+			/**
+			 * @brief Destructs the music stream.
+			 * @warning The stream must be stopped before, the buffers cannot be released while queued on a source.
+			 */
+			~MusicStream () = default;
+
+			/**
+			 * @brief Returns whether the stream is playing or paused.
+			 * @return bool
+			 */
+			[[nodiscard]]
+			bool
+			isActive () noexcept
+			{
+				const std::lock_guard< std::mutex > lock{m_access};
+
+				return m_active;
+			}
+
+			/**
+			 * @brief Starts streaming a music on a source.
+			 * @note Any previous stream or sound on the source is stopped.
+			 * @param track A reference to a streamed music resource.
+			 * @param source A reference to the source.
+			 * @param loop Restarts the track when it ends.
+			 * @return bool
+			 */
+			bool start (const MusicResource & track, Source & source, bool loop) noexcept;
+
+			/**
+			 * @brief Refills the buffers played by the source since the last update.
+			 * @note A source which ran out of queued buffers before the track end is restarted.
+			 * @param source A reference to the source given to start().
+			 * @return bool False when the stream has finished.
+			 */
+			bool update (Source & source) noexcept;
+
+			/**
+			 * @brief Stops the stream and releases the source queue.
+			 * @param source A reference to the source given to start().
+			 * @return void
+			 */
+			void stop (Source & source) noexcept;
+
+		private:
+
+			/**
+			 * @brief Releases the source queue and closes the file.
+			 * @param source A reference to the source.
+			 * @return void
+			 */
+			void release (Source & source) noexcept;
+
+			/**
+			 * @brief Decodes the next chunk of the track into a buffer.
+			 * @param buffer A reference to a buffer.
+			 * @return bool False when there is no more data.
+			 */
+			bool fillBuffer (Buffer & buffer) noexcept;
+
+			Libs::WaveFactory::StreamReader m_reader;
+			Libs::WaveFactory::Wave< int16_t > m_chunk;
+			std::array< std::shared_ptr< Buffer >, BufferCount > m_buffers;
+			size_t m_chunkFrames{0};
+			size_t m_queuedCount{0};
+			bool m_loop{false};
+			bool m_active{false};
+			std::mutex m_access;
+	};
+}
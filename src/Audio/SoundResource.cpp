@@ -27,7 +27,6 @@
 #include "SoundResource.hpp"
 
 /* Local inclusions. */
-#include "Libs/WaveFactory/Processor.hpp"
 #include "Resources/Manager.hpp"
 #include "Manager.hpp"
 #include "Tracer.hpp"
@@ -94,65 +93,15 @@ namespace EmEn::Audio
 			return false;
 		}
 
-		if ( !m_localData.readFile(filepath) )
+		/* NOTE: The sound must be mono and meet the audio engine frequency. The conversion is done once and
+		 * kept in the cache directory for the next runs. */
+		if ( !Manager::instance()->waveCache().get(filepath, WaveFactory::Channels::Mono, Manager::instance()->frequencyPlayback(), m_localData) )
 		{
 			TraceError{ClassId} << "Unable to load the sound file '" << filepath << "' !";
 
 			return this->setLoadSuccess(false);
 		}
 
-		const auto frequencyPlayback = Manager::instance()->frequencyPlayback();
-
-		/* Checks if the sound is valid for the engine.
-		 * It must be mono and meet the audio engine frequency. */
-		if ( m_localData.channels() != WaveFactory::Channels::Mono || m_localData.frequency() != frequencyPlayback )
-		{
-			/* Copy the buffer in float (single precision) format. */
-			WaveFactory::Processor processor{m_localData};
-
-			/* Launch a mix down process... */
-			if ( m_localData.channels() != WaveFactory::Channels::Mono )
-			{
-				if ( !s_quietConversion )
-				{
-					TraceWarning{ClassId} << "The sound '" << this->name() << "' is multichannel ! Performing a mix down ...";
-				}
-
-				if ( !processor.mixDown() )
-				{
-					Tracer::error(ClassId, "Mix down failed !");
-
-					return this->setLoadSuccess(false);
-				}
-			}
-
-			/* Launch a resampling process ... */
-			if ( m_localData.frequency() != frequencyPlayback )
-			{
-				if ( !s_quietConversion )
-				{
-					TraceWarning{ClassId} <<
-					   "Sound '" << this->name() << "' frequency mismatch the system ! "
-					   "Resampling the wave from " << static_cast< int >(m_localData.frequency()) << "Hz to " << static_cast< int >(frequencyPlayback) << "Hz ...";
-				}
-
-				if ( !processor.resample(frequencyPlayback) )
-				{
-					TraceError{ClassId} << "Unable to resample the wave to " << static_cast< int >(frequencyPlayback) << "Hz !";
-
-					return this->setLoadSuccess(false);
-				}
-			}
-
-			/* Gets back the buffer in 16bits integer format. */
-			if ( !processor.toWave(m_localData) )
-			{
-				Tracer::error(ClassId, "Unable to copy the fixed wave format !");
-
-				return this->setLoadSuccess(false);
-			}
-		}
-
 		return this->setLoadSuccess(true);
 	}
 
@@ -689,7 +689,16 @@ namespace EmEn::Audio
 			}
 			else
 			{
-				alSourcei(this->identifier(), AL_BUFFER, static_cast< ALint >(m_currentPlayableInterface->buffer()->identifier()));
+				const auto buffer = m_currentPlayableInterface->buffer();
+
+				if ( buffer == nullptr )
+				{
+					Tracer::error(ClassId, "The playable has no buffer to play !");
+
+					return false;
+				}
+
+				alSourcei(this->identifier(), AL_BUFFER, static_cast< ALint >(buffer->identifier()));
 			}
 
 			/* Let's play the source. */
@@ -794,6 +803,70 @@ namespace EmEn::Audio
 		m_currentPlayableInterface.reset();
 	}
 
+	bool
+	Source::queueBuffer (const Buffer & buffer) noexcept
+	{
+		if ( !Manager::instance()->usable() )
+		{
+			return false;
+		}
+
+		alFlushErrors();
+
+		const auto identifier = buffer.identifier();
+
+		alSourceQueueBuffers(this->identifier(), 1, &identifier);
+
+		return !alGetErrors(__PRETTY_FUNCTION__, __FILE__, __LINE__);
+	}
+
+	ALuint
+	Source::unqueueProcessedBuffer () noexcept
+	{
+		if ( !Manager::instance()->usable() || this->getBuffersProcessedCount() <= 0 )
+		{
+			return 0;
+		}
+
+		ALuint identifier = 0;
+
+		alSourceUnqueueBuffers(this->identifier(), 1, &identifier);
+
+		return identifier;
+	}
+
+	bool
+	Source::playQueue () noexcept
+	{
+		if ( !Manager::instance()->isAudioEnabled() )
+		{
+			return false;
+		}
+
+		alFlushErrors();
+
+		alSourcei(this->identifier(), AL_LOOPING, AL_FALSE);
+		alSourcePlay(this->identifier());
+
+		return !alGetErrors(__PRETTY_FUNCTION__, __FILE__, __LINE__);
+	}
+
+	void
+	Source::clearQueue () noexcept
+	{
+		if ( !Manager::instance()->usable() )
+		{
+			return;
+		}
+
+		this->stop();
+
+		/* NOTE: Setting no buffer on a stopped source releases the whole queue at once. */
+		alSourcei(this->identifier(), AL_BUFFER, 0);
+
+		m_currentPlayableInterface.reset();
+	}
+
 	void
 	Source::clearStream () const noexcept
 	{
@@ -624,6 +624,34 @@ namespace EmEn::Audio
 			 */
 			void removeSound () noexcept;
 
+			/**
+			 * @brief Appends a buffer to the queue of the source, for streaming.
+			 * @note The source must not hold a static buffer, see clearQueue().
+			 * @param buffer A reference to a buffer.
+			 * @return bool
+			 */
+			bool queueBuffer (const Buffer & buffer) noexcept;
+
+			/**
+			 * @brief Removes the oldest played buffer from the queue of the source.
+			 * @return ALuint The buffer identifier, or 0 when no queued buffer has been played yet.
+			 */
+			[[nodiscard]]
+			ALuint unqueueProcessedBuffer () noexcept;
+
+			/**
+			 * @brief Plays the buffers queued with queueBuffer().
+			 * @note The source looping state is disabled, a stream loops by queuing its beginning again.
+			 * @return bool
+			 */
+			bool playQueue () noexcept;
+
+			/**
+			 * @brief Stops the source and detaches every buffer, queued or static.
+			 * @return void
+			 */
+			void clearQueue () noexcept;
+
 			/**
 			 * @brief STL streams printable object.
 			 * @param out A reference to the stream output.
@@ -26,6 +26,9 @@
 
 #include "TrackMixer.hpp"
 
+/* STL inclusions. */
+#include <algorithm>
+
 /* Emeraude-Engine configuration. */
 #include "emeraude_config.hpp"
 
@@ -92,6 +95,9 @@ namespace EmEn::Audio
 		{
 			m_flags[ServiceInitialized] = false;
 
+			m_streamA.stop(*m_trackA);
+			m_streamB.stop(*m_trackB);
+
 			m_trackA->stop();
 			m_trackB->stop();
 		}
@@ -122,6 +128,19 @@ namespace EmEn::Audio
 		}
 	}
 
+	bool
+	TrackMixer::playTrack (Source & source, MusicStream & stream, const std::shared_ptr< MusicResource > & track) noexcept
+	{
+		stream.stop(source);
+
+		if ( track->isStreamed() )
+		{
+			return stream.start(*track, source, true);
+		}
+
+		return source.play(track, Source::PlayMode::Loop);
+	}
+
 	bool
 	TrackMixer::checkTrackLoading (const std::shared_ptr< MusicResource > & track) noexcept
 	{
@@ -174,7 +193,7 @@ namespace EmEn::Audio
 				case PlayingTrack::TrackA :
 					m_flags[IsTrackingFading] = true;
 
-					m_trackB->play(track, Source::PlayMode::Loop);
+					playTrack(*m_trackB, m_streamB, track);
 
 					m_playingTrack = PlayingTrack::TrackB;
 					break;
@@ -183,7 +202,7 @@ namespace EmEn::Audio
 				case PlayingTrack::TrackB :
 					m_flags[IsTrackingFading] = true;
 
-					m_trackA->play(track, Source::PlayMode::Loop);
+					playTrack(*m_trackA, m_streamA, track);
 
 					m_playingTrack = PlayingTrack::TrackA;
 					break;
@@ -205,14 +224,14 @@ namespace EmEn::Audio
 					m_flags[IsTrackingFading] = false;
 
 					m_trackA->setGain(m_gain);
-					m_trackA->play(track, Source::PlayMode::Loop);
+					playTrack(*m_trackA, m_streamA, track);
 					break;
 
 				case PlayingTrack::TrackB :
 					m_flags[IsTrackingFading] = false;
 
 					m_trackB->setGain(m_gain);
-					m_trackB->play(track, Source::PlayMode::Loop);
+					playTrack(*m_trackB, m_streamB, track);
 					break;
 			}
 		}
@@ -307,6 +326,7 @@ namespace EmEn::Audio
 				break;
 
 			case PlayingTrack::TrackA :
+				m_streamA.stop(*m_trackA);
 				m_trackA->stop();
 				m_playingTrack = PlayingTrack::None;
 
@@ -314,6 +334,7 @@ namespace EmEn::Audio
 				break;
 
 			case PlayingTrack::TrackB :
+				m_streamB.stop(*m_trackB);
 				m_trackB->stop();
 				m_playingTrack = PlayingTrack::None;
 
@@ -480,6 +501,7 @@ namespace EmEn::Audio
 					break;
 
 				case PlayingTrack::TrackA :
+					m_streamA.stop(*m_trackA);
 					m_trackA->stop();
 					m_playingTrack = PlayingTrack::None;
 
@@ -487,6 +509,7 @@ namespace EmEn::Audio
 					break;
 
 				case PlayingTrack::TrackB :
+					m_streamB.stop(*m_trackB);
 					m_trackB->stop();
 					m_playingTrack = PlayingTrack::None;
 
@@ -508,12 +531,12 @@ namespace EmEn::Audio
 		/* Stepping */
 		currentVolume += step;
 
-		if ( currentVolume > m_gain )
+		if ( currentVolume >= m_gain )
 		{
 			currentVolume = m_gain;
 			bound = true;
 		}
-		else if ( currentVolume < 0.0F )
+		else if ( currentVolume <= 0.0F )
 		{
 			currentVolume = 0.0F;
 			bound = true;
@@ -532,9 +555,20 @@ namespace EmEn::Audio
 			return;
 		}
 
+		/* NOTE: Refills the buffers played since the last update. */
+		m_streamA.update(*m_trackA);
+		m_streamB.update(*m_trackB);
+
+		/* NOTE: The update rate follows the main loop, the fade follows the real time.
+		 * A long gap is capped to avoid a volume jump. */
+		const auto now = std::chrono::steady_clock::now();
+		const auto elapsedTime = std::min(std::chrono::duration< float >(now - m_lastUpdateTime).count(), MaxFadeInterval);
+
+		m_lastUpdateTime = now;
+
 		if ( m_flags[IsTrackingFading] )
 		{
-			constexpr auto stepValue = 0.01F;
+			const auto stepValue = m_gain * elapsedTime / CrossFadeDuration;
 
 			switch ( m_playingTrack )
 			{
@@ -550,6 +584,9 @@ namespace EmEn::Audio
 					{
 						m_trackB->setGain(0.0F);
 
+						/* NOTE: No need to keep decoding a silent track. */
+						m_streamB.stop(*m_trackB);
+
 						m_flags[IsTrackingFading] = false;
 					}
 					break;
@@ -566,6 +603,9 @@ namespace EmEn::Audio
 					{
 						m_trackA->setGain(0.0F);
 
+						/* NOTE: No need to keep decoding a silent track. */
+						m_streamA.stop(*m_trackA);
+
 						m_flags[IsTrackingFading] = false;
 					}
 					break;
@@ -28,6 +28,7 @@
 
 /* STL inclusions. */
 #include <array>
+#include <chrono>
 #include <memory>
 
 /* Local inclusions for inheritances. */
@@ -37,6 +38,7 @@
 
 /* Local inclusions for usages. */
 #include "MusicResource.hpp"
+#include "MusicStream.hpp"
 #include "Source.hpp"
 
 /* Forward declarations. */
@@ -203,6 +205,15 @@ namespace EmEn::Audio
 			 */
 			bool fadeTrack (Source & track, float step) const noexcept;
 
+			/**
+			 * @brief Starts a music on a track, streamed when the music comes from a file.
+			 * @param source A reference to the track source.
+			 * @param stream A reference to the track stream.
+			 * @param track A reference to a music resource smart pointer.
+			 * @return bool
+			 */
+			static bool playTrack (Source & source, MusicStream & stream, const std::shared_ptr< MusicResource > & track) noexcept;
+
 			/**
 			 * @brief Check the music resource loading.
 			 * @param track A reference to a music resource smart pointer.
@@ -211,6 +222,11 @@ namespace EmEn::Audio
 			[[nodiscard]]
 			bool checkTrackLoading (const std::shared_ptr< MusicResource > & track) noexcept;
 
+			/* NOTE: Time in seconds to raise a track from silence to the mixer gain. */
+			static constexpr auto CrossFadeDuration{1.5F};
+			/* NOTE: Longest time in seconds taken into account between two updates. */
+			static constexpr auto MaxFadeInterval{0.25F};
+
 			/* Flag names. */
 			static constexpr auto ServiceInitialized{0UL};
 			static constexpr auto IsFadingWasDemanded{1UL};
@@ -221,9 +237,12 @@ namespace EmEn::Audio
 			Manager & m_audioManager;
 			std::shared_ptr< Source > m_trackA;
 			std::shared_ptr< Source > m_trackB;
+			MusicStream m_streamA;
+			MusicStream m_streamB;
 			float m_gain{0.0F};
 			PlayingTrack m_playingTrack{PlayingTrack::None};
 			std::shared_ptr< MusicResource > m_loadingTrack;
+			std::chrono::steady_clock::time_point m_lastUpdateTime;
 			std::array< bool, 8 > m_flags{
 				false/*ServiceInitialized*/,
 				false/*IsFadingWasDemanded*/,
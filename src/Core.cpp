@@ -44,7 +44,9 @@
 #include "PlatformSpecific/Desktop/Dialog/Message.hpp"
 #include "PlatformSpecific/Desktop/Dialog/OpenFile.hpp"
 #include "PlatformSpecific/Desktop/Commands.hpp"
+#include "Tool/GeometryConverter.hpp"
 #include "Tool/GeometryDataPrinter.hpp"
+#include "Tool/ShaderPrecompiler.hpp"
 #include "Tool/ShowVulkanInformation.hpp"
 
 namespace EmEn
@@ -141,10 +143,24 @@ namespace EmEn
 	{
 		const std::chrono::duration< uint64_t, std::micro > logicsUpdateFrequency{EngineUpdateCycleDurationUS< uint64_t >};
 
+		m_frameProfiler.setThreadName("Logics");
+
 		while ( m_flags[IsLogicsLoopRunning] )
 		{
 			if ( m_flags[Paused] )
 			{
+				/* NOTE: Nodes can still be moved while paused, their components (camera, sound, light) must follow. */
+				{
+					const std::shared_lock< std::shared_mutex > activeSceneLock{m_sceneManager.activeSceneAccess()};
+
+					const auto activeScene = m_sceneManager.activeScene();
+
+					if ( activeScene != nullptr )
+					{
+						activeScene->updateWorldCoordinates();
+					}
+				}
+
 				std::this_thread::sleep_for(std::chrono::milliseconds{100});
 
 				continue;
@@ -157,6 +173,7 @@ namespace EmEn
 				const std::shared_lock< std::shared_mutex > activeSceneLock{m_sceneManager.activeSceneAccess()};
 
 				const Time::Elapsed::PrintScopeRealTimeThreshold stat{"logicsTask", 1000.0 / 60.0};
+				const ProfileScope profileScope{"Core::logicsTask"};
 
 				m_lifetime += EngineUpdateCycleDurationUS< uint64_t >;
 
@@ -190,6 +207,8 @@ namespace EmEn
 	{
 		uint64_t frames = 0;
 
+		m_frameProfiler.setThreadName("Rendering");
+
 		while ( m_flags[IsRenderingLoopRunning] )
 		{
 			if ( m_flags[Paused] )
@@ -204,6 +223,7 @@ namespace EmEn
 				const std::shared_lock< std::shared_mutex > activeSceneLock{m_sceneManager.activeSceneAccess()};
 
 				const Time::Elapsed::PrintScopeRealTimeThreshold stat{"renderingTask", 1000.0 / 30.0};
+				const ProfileScope profileScope{"Core::renderingTask"};
 
 				const auto & activeScene = m_sceneManager.activeScene();
 
@@ -219,6 +239,8 @@ namespace EmEn
 				frames++;
 			}
 
+			m_frameProfiler.endFrame();
+
 			std::this_thread::sleep_for(std::chrono::milliseconds(1));
 		}
 
@@ -298,6 +320,9 @@ namespace EmEn
 			/* Let the child class get the call event from the main loop. */
 			this->onMainLoopCycle();
 
+			/* NOTE: Refills the music stream buffers. */
+			m_trackMixer.update();
+
 			/* NOTE: Checks whether the engine is running or paused.
 			 * If not, we wait for a wake-up event with a blocking function. */
 			if ( m_flags[Paused] )
@@ -314,6 +339,8 @@ namespace EmEn
 					/* Let the child class get the call event from the main loop. */
 					this->onMainLoopCycle();
 
+					m_trackMixer.update();
+
 					m_inputManager.waitSystemEvents(0.16);
 				}
 
@@ -455,6 +482,16 @@ namespace EmEn
 			return false;
 		}
 
+		/* Initialize the frame profiler. */
+		if ( m_frameProfiler.initialize(m_primaryServicesEnabled) )
+		{
+			TraceSuccess{ClassId} << m_frameProfiler.name() << " service up !";
+		}
+		else
+		{
+			TraceWarning{ClassId} << m_frameProfiler.name() << " service failed to execute !";
+		}
+
 		/* Initialize download manager. */
 		if ( m_networkManager.initialize(m_primaryServicesEnabled) )
 		{
@@ -1368,9 +1405,16 @@ namespace EmEn
 
 		if ( tools == ConvertGeometryToolName )
 		{
-			TraceDebug{ClassId} << "FIXME: ...";
+			Tool::GeometryConverter tool{m_primaryServices.arguments()};
 
-			return true;
+			return tool.execute();
+		}
+
+		if ( tools == PrecompileShadersToolName )
+		{
+			Tool::ShaderPrecompiler tool{m_primaryServices.arguments(), m_graphicsRenderer.shaderManager()};
+
+			return tool.execute();
 		}
 
 		TraceWarning{ClassId} << "Unrecognized tools '" << tools << "' !";
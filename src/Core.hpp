@@ -49,6 +49,7 @@
 #include "Audio/TrackMixer.hpp"
 #include "Console/Controller.hpp"
 #include "CursorAtlas.hpp"
+#include "FrameProfiler.hpp"
 #include "Graphics/ExternalInput.hpp"
 #include "Graphics/Renderer.hpp"
 #include "Help.hpp"
@@ -89,6 +90,7 @@ namespace EmEn
 			static constexpr auto VulkanInformationToolName{"vulkanInfo"};
 			static constexpr auto PrintGeometryToolName{"printGeometry"};
 			static constexpr auto ConvertGeometryToolName{"convertGeometry"};
+			static constexpr auto PrecompileShadersToolName{"precompileShaders"};
 
 			/** @brief Observable notification codes. */
 			enum NotificationCode
@@ -287,6 +289,28 @@ namespace EmEn
 				return m_consoleController;
 			}
 
+			/**
+			 * @brief Returns the reference to the frame profiler service.
+			 * @return FrameProfiler &
+			 */
+			[[nodiscard]]
+			FrameProfiler &
+			frameProfiler () noexcept
+			{
+				return m_frameProfiler;
+			}
+
+			/**
+			 * @brief Returns the reference to the frame profiler service.
+			 * @return const FrameProfiler &
+			 */
+			[[nodiscard]]
+			const FrameProfiler &
+			frameProfiler () const noexcept
+			{
+				return m_frameProfiler;
+			}
+
 			/**
 			 * @brief Returns the reference to the download manager service.
 			 * @return NetworkManager &
@@ -1027,6 +1051,7 @@ namespace EmEn
 			Help m_coreHelp{"Core engine"};
 			PrimaryServices m_primaryServices;
 			Console::Controller m_consoleController{m_primaryServices};
+			FrameProfiler m_frameProfiler{m_primaryServices};
 			NetworkManager m_networkManager{m_primaryServices};
 			Resources::Manager m_resourceManager{m_primaryServices, m_networkManager};
 			User m_user{m_primaryServices};
@@ -0,0 +1,547 @@
+/*
+ * src/FrameProfiler.cpp
+ * This file is part of Emeraude-Engine
+ *
+ * Copyright (C) 2010-2025 - Sébastien Léon Claude Christian Bémelmans "LondNoir" <londnoir@gmail.com>
+ *
+ * Emeraude-Engine is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * Emeraude-Engine is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with Emeraude-Engine; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * Complete project and additional information can be found at :
+ * https://github.com/londnoir/emeraude-engine
+ *
+ * --- THIS IS AUTOMATICALLY GENERATED, DO NOT CHANGE ---
+ */
+
+#include "FrameProfiler.hpp"
+
+/* STL inclusions. */
+#include <algorithm>
+#include <exception>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <ranges>
+#include <sstream>
+
+/* Local inclusions. */
+#include "FileSystem.hpp"
+#include "PrimaryServices.hpp"
+#include "SettingKeys.hpp"
+#include "Settings.hpp"
+#include "Tracer.hpp"
+
+namespace EmEn
+{
+	using namespace EmEn::Libs;
+	using namespace EmEn::Libs::Time::Statistics;
+
+	const size_t FrameProfiler::ClassUID{getClassUID(ClassId)};
+
+	FrameProfiler * FrameProfiler::s_instance{nullptr};
+	std::atomic< size_t > FrameProfiler::s_nextInstanceId{0};
+
+	FrameProfiler::FrameProfiler (PrimaryServices & primaryServices) noexcept
+		: ServiceInterface(ClassId),
+		Controllable(ClassId),
+		m_primaryServices(primaryServices)
+	{
+		if ( s_instance != nullptr )
+		{
+			std::cerr << __PRETTY_FUNCTION__ << ", constructor called twice !" "\n";
+
+			std::terminate();
+		}
+
+		s_instance = this;
+	}
+
+	FrameProfiler::~FrameProfiler ()
+	{
+		s_instance = nullptr;
+	}
+
+	bool
+	FrameProfiler::onInitialize () noexcept
+	{
+		auto & settings = m_primaryServices.settings();
+
+		m_flags[ShowInformation] = settings.get< bool >(FrameProfilerShowInformationKey, DefaultFrameProfilerShowInformation);
+		m_histogramRange = std::max< size_t >(settings.get< uint32_t >(FrameProfilerHistogramRangeKey, DefaultFrameProfilerHistogramRange), 1);
+
+		this->enable(settings.get< bool >(FrameProfilerEnabledKey, DefaultFrameProfilerEnabled));
+
+		m_flags[ServiceInitialized] = true;
+
+		this->registerToConsole();
+
+		return true;
+	}
+
+	bool
+	FrameProfiler::onTerminate () noexcept
+	{
+		m_flags[ServiceInitialized] = false;
+
+		this->enable(false);
+
+		{
+			const std::lock_guard< std::mutex > lock{m_access};
+
+			/* NOTE: Save what has been captured so far. */
+			if ( m_captureFramesLeft > 0 )
+			{
+				this->finishCapture();
+			}
+		}
+
+		m_primaryServices.jobSystem().wait(m_exportJobs);
+
+		if ( m_flags[ShowInformation] )
+		{
+			TraceInfo{ClassId} << this->getReport();
+		}
+
+		return true;
+	}
+
+	void
+	FrameProfiler::onRegisterToConsole () noexcept
+	{
+		this->bindCommand("enable", [this] (const Console::Arguments & /*arguments*/, Console::Outputs & outputs) {
+			this->enable(true);
+
+			outputs.emplace_back(Severity::Info, "Frame profiler enabled.");
+
+			return 0;
+		}, "Enable the scopes recording.");
+
+		this->bindCommand("disable", [this] (const Console::Arguments & /*arguments*/, Console::Outputs & outputs) {
+			this->enable(false);
+
+			outputs.emplace_back(Severity::Info, "Frame profiler disabled.");
+
+			return 0;
+		}, "Disable the scopes recording.");
+
+		this->bindCommand("capture", [this] (const Console::Arguments & arguments, Console::Outputs & outputs) {
+			size_t frameCount = m_primaryServices.settings().get< uint32_t >(FrameProfilerCaptureFrameCountKey, DefaultFrameProfilerCaptureFrameCount);
+			std::filesystem::path filepath;
+
+			if ( !arguments.empty() )
+			{
+				frameCount = static_cast< size_t >(std::max(arguments[0].asInteger(), 0));
+			}
+
+			if ( arguments.size() > 1 )
+			{
+				filepath = arguments[1].asString();
+			}
+
+			if ( !this->startCapture(frameCount, filepath) )
+			{
+				outputs.emplace_back(Severity::Error, "Unable to start the capture.");
+
+				return 1;
+			}
+
+			outputs.emplace_back(Severity::Info, (std::stringstream{} << "Capturing the next " << frameCount << " frames ..."));
+
+			return 0;
+		}, "Capture the next frames (first parameter, optional) to a Chrome trace JSON file (second parameter, optional).");
+
+		this->bindCommand("report", [this] (const Console::Arguments & /*arguments*/, Console::Outputs & outputs) {
+			outputs.emplace_back(Severity::Info, this->getReport());
+
+			return 0;
+		}, "Print the per-frame statistics of every scope.");
+
+		this->bindCommand("reset", [this] (const Console::Arguments & /*arguments*/, Console::Outputs & outputs) {
+			this->resetStatistics();
+
+			outputs.emplace_back(Severity::Info, "Frame profiler statistics cleared.");
+
+			return 0;
+		}, "Clear the statistics.");
+	}
+
+	FrameProfiler::ThreadBuffer &
+	FrameProfiler::threadBuffer () noexcept
+	{
+		/* NOTE: The registry shares the buffer ownership, so events survive the thread until they are collected. */
+		thread_local size_t ownerId{0};
+		thread_local std::shared_ptr< ThreadBuffer > buffer;
+
+		if ( ownerId != m_instanceId || buffer == nullptr )
+		{
+			buffer = std::make_shared< ThreadBuffer >();
+
+			ownerId = m_instanceId;
+
+			const std::lock_guard< std::mutex > lock{m_access};
+
+			buffer->index = ++m_threadCount;
+
+			m_threadBuffers.emplace_back(buffer);
+		}
+
+		return *buffer;
+	}
+
+	void
+	FrameProfiler::record (const char * name, uint64_t start) noexcept
+	{
+		const auto end = this->now();
+
+		if ( !this->threadBuffer().events.push({name, start, end - start}) )
+		{
+			m_droppedEvents.fetch_add(1, std::memory_order_relaxed);
+		}
+	}
+
+	void
+	FrameProfiler::setThreadName (const char * name) noexcept
+	{
+		this->threadBuffer().name.store(name, std::memory_order_relaxed);
+	}
+
+	void
+	FrameProfiler::accumulate (std::string_view name, double milliseconds) noexcept
+	{
+		auto [scopeIt, inserted] = m_scopes.try_emplace(name);
+
+		if ( inserted )
+		{
+			scopeIt->second.perFrame = Histogram{m_histogramRange};
+		}
+
+		scopeIt->second.frameTotal += milliseconds;
+		scopeIt->second.frameCalls++;
+	}
+
+	void
+	FrameProfiler::endFrame () noexcept
+	{
+		const auto frameTime = this->now();
+
+		const std::lock_guard< std::mutex > lock{m_access};
+
+		const auto capturing = m_captureFramesLeft > 0;
+
+		for ( auto bufferIt = m_threadBuffers.begin(); bufferIt != m_threadBuffers.end(); )
+		{
+			const auto & buffer = *bufferIt;
+
+			ThreadCapture * capture = nullptr;
+
+			if ( capturing )
+			{
+				auto [captureIt, inserted] = m_capture.try_emplace(buffer.get());
+
+				if ( inserted )
+				{
+					const auto * threadName = buffer->name.load(std::memory_order_relaxed);
+
+					captureIt->second.name = threadName != nullptr ? std::string{threadName} : "Thread #" + std::to_string(buffer->index);
+					captureIt->second.threadIndex = buffer->index;
+				}
+
+				capture = &captureIt->second;
+			}
+
+			buffer->events.consume([this, capture] (const Event & event) {
+				this->accumulate(event.name, static_cast< double >(event.duration) / 1000000.0);
+
+				if ( capture != nullptr )
+				{
+					capture->events.emplace_back(event);
+				}
+			});
+
+			/* NOTE: The thread is gone and every event it recorded has been collected. */
+			if ( bufferIt->use_count() == 1 && buffer->events.empty() )
+			{
+				bufferIt = m_threadBuffers.erase(bufferIt);
+			}
+			else
+			{
+				++bufferIt;
+			}
+		}
+
+		if ( this->isEnabled() )
+		{
+			if ( m_lastFrameTime > 0 )
+			{
+				this->accumulate(FrameScopeName, static_cast< double >(frameTime - m_lastFrameTime) / 1000000.0);
+			}
+
+			m_lastFrameTime = frameTime;
+		}
+		else
+		{
+			m_lastFrameTime = 0;
+		}
+
+		/* NOTE: Statistics are per frame where the scope has been executed at least once. */
+		for ( auto & scope : m_scopes | std::views::values )
+		{
+			if ( scope.frameCalls > 0 )
+			{
+				scope.perFrame.insert(scope.frameTotal);
+				scope.frameTotal = 0.0;
+				scope.frameCalls = 0;
+			}
+		}
+
+		m_frameCount++;
+
+		if ( capturing )
+		{
+			m_captureFrameTimes.emplace_back(frameTime);
+
+			if ( --m_captureFramesLeft == 0 )
+			{
+				this->finishCapture();
+			}
+		}
+	}
+
+	bool
+	FrameProfiler::startCapture (size_t frameCount, const std::filesystem::path & filepath) noexcept
+	{
+		if ( frameCount == 0 )
+		{
+			return false;
+		}
+
+		const std::lock_guard< std::mutex > lock{m_access};
+
+		if ( m_captureFramesLeft > 0 )
+		{
+			TraceWarning{ClassId} << "A capture is already in progress !";
+
+			return false;
+		}
+
+		if ( filepath.empty() )
+		{
+			m_captureFilepath = m_primaryServices.fileSystem().cacheDirectory((std::stringstream{} << "frame-profile-" << m_frameCount << ".json").str());
+		}
+		else
+		{
+			m_captureFilepath = filepath;
+		}
+
+		m_capture.clear();
+		m_captureFrameTimes.clear();
+		m_captureFramesLeft = frameCount;
+
+		this->enable(true);
+
+		return true;
+	}
+
+	bool
+	FrameProfiler::isCapturing () const noexcept
+	{
+		const std::lock_guard< std::mutex > lock{m_access};
+
+		return m_captureFramesLeft > 0;
+	}
+
+	void
+	FrameProfiler::finishCapture () noexcept
+	{
+		std::vector< ThreadCapture > threads;
+		threads.reserve(m_capture.size());
+
+		for ( auto & capture : m_capture | std::views::values )
+		{
+			threads.emplace_back(std::move(capture));
+		}
+
+		std::ranges::sort(threads, [] (const auto & a, const auto & b) {
+			return a.threadIndex < b.threadIndex;
+		});
+
+		m_capture.clear();
+		m_captureFramesLeft = 0;
+
+		/* NOTE: Writing a capture may take a while, keep it out of the rendering thread. */
+		m_primaryServices.jobSystem().submit([threads = std::move(threads), frameTimes = std::move(m_captureFrameTimes), filepath = m_captureFilepath] () {
+			if ( FrameProfiler::writeChromeTrace(filepath, threads, frameTimes) )
+			{
+				TraceSuccess{ClassId} << "Frame profile capture written to " << filepath << " !";
+			}
+			else
+			{
+				TraceError{ClassId} << "Unable to write the frame profile capture to " << filepath << " !";
+			}
+		}, m_exportJobs, ThreadPool::Priority::Low);
+
+		m_captureFrameTimes.clear();
+	}
+
+	/**
+	 * @brief Writes a string as a JSON string literal.
+	 * @param stream A reference to the output stream.
+	 * @param string A string view.
+	 * @return void
+	 */
+	static
+	void
+	writeJSONString (std::ostream & stream, std::string_view string) noexcept
+	{
+		stream << '"';
+
+		for ( const auto character : string )
+		{
+			switch ( character )
+			{
+				case '"' :
+				case '\\' :
+					stream << '\\' << character;
+					break;
+
+				default :
+					if ( static_cast< unsigned char >(character) < 0x20 )
+					{
+						stream << ' ';
+					}
+					else
+					{
+						stream << character;
+					}
+					break;
+			}
+		}
+
+		stream << '"';
+	}
+
+	bool
+	FrameProfiler::writeChromeTrace (const std::filesystem::path & filepath, const std::vector< ThreadCapture > & threads, const std::vector< uint64_t > & frameTimes) noexcept
+	{
+		std::ofstream file{filepath, std::ios::out | std::ios::trunc};
+
+		if ( !file.is_open() )
+		{
+			return false;
+		}
+
+		/* NOTE: Trace event timestamps are in microseconds. */
+		file << std::fixed << std::setprecision(3) << R"({"displayTimeUnit":"ms","traceEvents":[)";
+
+		const char * separator = "\n";
+
+		for ( const auto & thread : threads )
+		{
+			file << separator << R"({"name":"thread_name","ph":"M","pid":1,"tid":)" << thread.threadIndex << R"(,"args":{"name":)";
+			writeJSONString(file, thread.name);
+			file << "}}";
+
+			separator = ",\n";
+
+			for ( const auto & event : thread.events )
+			{
+				file << separator << R"({"name":)";
+				writeJSONString(file, event.name);
+				file << R"(,"cat":"cpu","ph":"X","pid":1,"tid":)" << thread.threadIndex <<
+					R"(,"ts":)" << static_cast< double >(event.start) / 1000.0 <<
+					R"(,"dur":)" << static_cast< double >(event.duration) / 1000.0 << '}';
+			}
+		}
+
+		for ( size_t frameIndex = 0; frameIndex < frameTimes.size(); frameIndex++ )
+		{
+			file << separator << R"({"name":"Frame )" << frameIndex << R"(","ph":"i","s":"g","pid":1,"tid":0,"ts":)" << static_cast< double >(frameTimes[frameIndex]) / 1000.0 << '}';
+
+			separator = ",\n";
+		}
+
+		file << "\n]}\n";
+
+		return file.good();
+	}
+
+	Histogram
+	FrameProfiler::statistics (std::string_view name) const noexcept
+	{
+		const std::lock_guard< std::mutex > lock{m_access};
+
+		const auto scopeIt = m_scopes.find(name);
+
+		if ( scopeIt == m_scopes.cend() )
+		{
+			return Histogram{};
+		}
+
+		return scopeIt->second.perFrame;
+	}
+
+	std::string
+	FrameProfiler::getReport () const noexcept
+	{
+		const std::lock_guard< std::mutex > lock{m_access};
+
+		std::vector< std::pair< std::string_view, const Histogram * > > scopes;
+		scopes.reserve(m_scopes.size());
+
+		for ( const auto & [name, scope] : m_scopes )
+		{
+			scopes.emplace_back(name, &scope.perFrame);
+		}
+
+		/* NOTE: The most expensive scopes first. */
+		std::ranges::sort(scopes, [] (const auto & a, const auto & b) {
+			return a.second->average() > b.second->average();
+		});
+
+		std::stringstream report;
+		report << std::fixed << std::setprecision(3) << "Frame profiler statistics over " << m_frameCount << " frames (per frame, in ms) :" "\n";
+
+		for ( const auto & [name, histogram] : scopes )
+		{
+			report <<
+				" - " << name << " : "
+				"min " << histogram->minimum() << ", "
+				"avg " << histogram->average() << ", "
+				"p99 " << histogram->percentile(99.0) << ", "
+				"max " << histogram->maximum() << " (" << histogram->count() << " samples)" "\n";
+		}
+
+		if ( const auto dropped = this->droppedEvents(); dropped > 0 )
+		{
+			report << dropped << " events dropped, the thread ring buffers were full !" "\n";
+		}
+
+		return report.str();
+	}
+
+	void
+	FrameProfiler::resetStatistics () noexcept
+	{
+		const std::lock_guard< std::mutex > lock{m_access};
+
+		for ( auto & scope : m_scopes | std::views::values )
+		{
+			scope.perFrame.reset();
+			scope.frameTotal = 0.0;
+			scope.frameCalls = 0;
+		}
+
+		m_lastFrameTime = 0;
+	}
+}
@@ -0,0 +1,452 @@
+/*
+ * src/FrameProfiler.hpp
+ * This file is part of Emeraude-Engine
+ *
+ * Copyright (C) 2010-2025 - Sébastien Léon Claude Christian Bémelmans "LondNoir" <londnoir@gmail.com>
+ *
+ * Emeraude-Engine is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * Emeraude-Engine is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with Emeraude-Engine; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * Complete project and additional information can be found at :
+ * https://github.com/londnoir/emeraude-engine
+ *
+ * --- THIS IS AUTOMATICALLY GENERATED, DO NOT CHANGE ---
+ */
+
+#pragma once
+
+/* STL inclusions. */
+#include <cstddef>
+#include <cstdint>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+/* Local inclusions for inheritances. */
+#include "ServiceInterface.hpp"
+#include "Console/Controllable.hpp"
+
+/* Local inclusions for usages. */
+#include "Libs/SPSCRingBuffer.hpp"
+#include "Libs/ThreadPool.hpp"
+#include "Libs/Time/Statistics/Histogram.hpp"
+
+/* Forward declarations. */
+namespace EmEn
+{
+	class PrimaryServices;
+}
+
+namespace EmEn
+{
+	/**
+	 * @brief The frame profiler service. This collects named CPU scopes from every thread,
+	 * aggregates them per frame and exports captures to the Chrome trace event format (chrome://tracing, Perfetto).
+	 * @note When disabled, a profile scope costs a pointer test and an atomic load. When enabled, a scope end
+	 * only copies an event into a lock-free ring buffer owned by the calling thread. Scope names must be static strings.
+	 * @extends EmEn::ServiceInterface This is a service.
+	 * @extends EmEn::Console::Controllable The profiler can be controlled by the console.
+	 */
+	class FrameProfiler final : public ServiceInterface, public Console::Controllable
+	{
+		public:
+
+			/** @brief Class identifier. */
+			static constexpr auto ClassId{"FrameProfilerService"};
+
+			/** @brief Observable class unique identifier. */
+			static const size_t ClassUID;
+
+			/** @brief The name of the scope measuring the time between two frames. */
+			static constexpr auto FrameScopeName{"Frame"};
+
+			/** @brief The number of events in the ring buffer of each profiled thread. */
+			static constexpr size_t ThreadBufferCapacity{4096};
+
+			/**
+			 * @brief A completed scope.
+			 */
+			struct Event
+			{
+				/** @brief The static name of the scope. */
+				const char * name{nullptr};
+				/** @brief The start time in nanoseconds since the profiler creation. */
+				uint64_t start{0};
+				/** @brief The duration in nanoseconds. */
+				uint64_t duration{0};
+			};
+
+			/**
+			 * @brief The captured events of a thread.
+			 */
+			struct ThreadCapture
+			{
+				/** @brief The thread name. */
+				std::string name;
+				/** @brief The thread index in registration order. */
+				uint32_t threadIndex{0};
+				/** @brief The completed scopes. */
+				std::vector< Event > events;
+			};
+
+			/**
+			 * @brief Constructs the frame profiler.
+			 * @param primaryServices A reference to primary services.
+			 */
+			explicit FrameProfiler (PrimaryServices & primaryServices) noexcept;
+
+			/**
+			 * @brief Copy constructor.
+			 * @param copy A reference to the copied instance.
+			 */
+			FrameProfiler (const FrameProfiler & copy) noexcept = delete;
+
+			/**
+			 * @brief Move constructor.
+			 * @param copy A reference to the copied instance.
+			 */
+			FrameProfiler (FrameProfiler && copy) noexcept = delete;
+
+			/**
+			 * @brief Copy assignment.
+			 * @param copy A reference to the copied instance.
+			 * @return FrameProfiler &
+			 */
+			FrameProfiler & operator= (const FrameProfiler & copy) noexcept = delete;
+
+			/**
+			 * @brief Move assignment.
+			 * @param copy A reference to the copied instance.
+			 * @return FrameProfiler &
+			 */
+			FrameProfiler & operator= (FrameProfiler && copy) noexcept = delete;
+
+			/**
+			 * @brief Destructs the frame profiler.
+			 */
+			~FrameProfiler () override;
+
+			/** @copydoc EmEn::Libs::ObservableTrait::classUID() const */
+			[[nodiscard]]
+			size_t
+			classUID () const noexcept override
+			{
+				return ClassUID;
+			}
+
+			/** @copydoc EmEn::Libs::ObservableTrait::is() const */
+			[[nodiscard]]
+			bool
+			is (size_t classUID) const noexcept override
+			{
+				return classUID == ClassUID;
+			}
+
+			/** @copydoc EmEn::ServiceInterface::usable() */
+			[[nodiscard]]
+			bool
+			usable () const noexcept override
+			{
+				return m_flags[ServiceInitialized];
+			}
+
+			/**
+			 * @brief Returns the instance of the frame profiler.
+			 * @return FrameProfiler *
+			 */
+			[[nodiscard]]
+			static
+			FrameProfiler *
+			instance () noexcept
+			{
+				return s_instance;
+			}
+
+			/**
+			 * @brief Enables or disables the scopes recording.
+			 * @param state The state.
+			 * @return void
+			 */
+			void
+			enable (bool state) noexcept
+			{
+				m_isEnabled.store(state, std::memory_order_relaxed);
+			}
+
+			/**
+			 * @brief Returns whether the scopes are recorded.
+			 * @return bool
+			 */
+			[[nodiscard]]
+			bool
+			isEnabled () const noexcept
+			{
+				return m_isEnabled.load(std::memory_order_relaxed);
+			}
+
+			/**
+			 * @brief Returns the current time in nanoseconds since the profiler creation.
+			 * @return uint64_t
+			 */
+			[[nodiscard]]
+			uint64_t
+			now () const noexcept
+			{
+				return static_cast< uint64_t >(std::chrono::duration_cast< std::chrono::nanoseconds >(std::chrono::steady_clock::now() - m_epoch).count());
+			}
+
+			/**
+			 * @brief Records a completed scope from the calling thread.
+			 * @param name A pointer to a static C-string.
+			 * @param start The start time from now().
+			 * @return void
+			 */
+			void record (const char * name, uint64_t start) noexcept;
+
+			/**
+			 * @brief Names the calling thread in captures.
+			 * @param name A pointer to a static C-string.
+			 * @return void
+			 */
+			void setThreadName (const char * name) noexcept;
+
+			/**
+			 * @brief Closes the current frame. Collects every thread events, updates statistics and the capture.
+			 * @note This must be called once per rendered frame.
+			 * @return void
+			 */
+			void endFrame () noexcept;
+
+			/**
+			 * @brief Starts to capture the next frames to a Chrome trace event JSON file. This enables the recording.
+			 * @param frameCount The number of frames to capture.
+			 * @param filepath A reference to the output file path. If empty, a file is created in the cache directory.
+			 * @return bool
+			 */
+			bool startCapture (size_t frameCount, const std::filesystem::path & filepath = {}) noexcept;
+
+			/**
+			 * @brief Returns whether a capture is in progress.
+			 * @return bool
+			 */
+			[[nodiscard]]
+			bool isCapturing () const noexcept;
+
+			/**
+			 * @brief Returns the number of events dropped because a thread ring buffer was full.
+			 * @return uint64_t
+			 */
+			[[nodiscard]]
+			uint64_t
+			droppedEvents () const noexcept
+			{
+				return m_droppedEvents.load(std::memory_order_relaxed);
+			}
+
+			/**
+			 * @brief Returns a copy of the per-frame statistics of a scope, in milliseconds.
+			 * @param name A string view of the scope name.
+			 * @return Libs::Time::Statistics::Histogram
+			 */
+			[[nodiscard]]
+			Libs::Time::Statistics::Histogram statistics (std::string_view name) const noexcept;
+
+			/**
+			 * @brief Returns a text report of every scope statistics.
+			 * @return std::string
+			 */
+			[[nodiscard]]
+			std::string getReport () const noexcept;
+
+			/**
+			 * @brief Clears every statistics.
+			 * @return void
+			 */
+			void resetStatistics () noexcept;
+
+			/**
+			 * @brief Writes events to a Chrome trace event JSON file.
+			 * @param filepath A reference to a path.
+			 * @param threads A reference to the captured threads.
+			 * @param frameTimes A reference to the frame end times, written as markers.
+			 * @return bool
+			 */
+			static bool writeChromeTrace (const std::filesystem::path & filepath, const std::vector< ThreadCapture > & threads, const std::vector< uint64_t > & frameTimes) noexcept;
+
+		private:
+
+			/**
+			 * @brief The ring buffer of a profiled thread.
+			 */
+			struct ThreadBuffer
+			{
+				Libs::SPSCRingBuffer< Event, ThreadBufferCapacity > events;
+				std::atomic< const char * > name{nullptr};
+				uint32_t index{0};
+			};
+
+			/**
+			 * @brief The accumulated time of a scope.
+			 */
+			struct ScopeStatistics
+			{
+				Libs::Time::Statistics::Histogram perFrame;
+				double frameTotal{0.0};
+				uint32_t frameCalls{0};
+			};
+
+			/** @copydoc EmEn::ServiceInterface::onInitialize() */
+			bool onInitialize () noexcept override;
+
+			/** @copydoc EmEn::ServiceInterface::onTerminate() */
+			bool onTerminate () noexcept override;
+
+			/** @copydoc EmEn::Console::Controllable::onRegisterToConsole. */
+			void onRegisterToConsole () noexcept override;
+
+			/**
+			 * @brief Returns the ring buffer of the calling thread, registers it on the first call.
+			 * @return ThreadBuffer &
+			 */
+			[[nodiscard]]
+			ThreadBuffer & threadBuffer () noexcept;
+
+			/**
+			 * @brief Adds a duration to a scope for the current frame.
+			 * @note Must be called with the access lock.
+			 * @param name The scope name.
+			 * @param milliseconds The duration.
+			 * @return void
+			 */
+			void accumulate (std::string_view name, double milliseconds) noexcept;
+
+			/**
+			 * @brief Hands the finished capture to a job writing the file.
+			 * @note Must be called with the access lock.
+			 * @return void
+			 */
+			void finishCapture () noexcept;
+
+			/* Flag names. */
+			static constexpr auto ServiceInitialized{0UL};
+			static constexpr auto ShowInformation{1UL};
+
+			static FrameProfiler * s_instance;
+			static std::atomic< size_t > s_nextInstanceId;
+
+			PrimaryServices & m_primaryServices;
+			const std::chrono::steady_clock::time_point m_epoch{std::chrono::steady_clock::now()};
+			size_t m_instanceId{s_nextInstanceId.fetch_add(1) + 1};
+			std::atomic_bool m_isEnabled{false};
+			std::atomic< uint64_t > m_droppedEvents{0};
+			mutable std::mutex m_access;
+			std::vector< std::shared_ptr< ThreadBuffer > > m_threadBuffers;
+			std::unordered_map< std::string_view, ScopeStatistics > m_scopes;
+			std::unordered_map< const ThreadBuffer *, ThreadCapture > m_capture;
+			std::vector< uint64_t > m_captureFrameTimes;
+			std::filesystem::path m_captureFilepath;
+			size_t m_captureFramesLeft{0};
+			size_t m_histogramRange{1};
+			uint64_t m_lastFrameTime{0};
+			uint64_t m_frameCount{0};
+			uint32_t m_threadCount{0};
+			Libs::JobGroup m_exportJobs;
+			std::array< bool, 8 > m_flags{
+				false/*ServiceInitialized*/,
+				false/*ShowInformation*/,
+				false/*UNUSED*/,
+				false/*UNUSED*/,
+				false/*UNUSED*/,
+				false/*UNUSED*/,
+				false/*UNUSED*/,
+				false/*UNUSED*/
+			};
+	};
+
+	/**
+	 * @brief Measures the lifetime of a scope for the frame profiler.
+	 * @note The name must be a static string. Usage: const ProfileScope profileScope{"Scene::processLogics"};
+	 */
+	class ProfileScope final
+	{
+		public:
+
+			/**
+			 * @brief Opens a profile scope.
+			 * @param name A pointer to a static C-string.
+			 */
+			explicit
+			ProfileScope (const char * name) noexcept
+				: m_name(name)
+			{
+				auto * profiler = FrameProfiler::instance();
+
+				if ( profiler != nullptr && profiler->isEnabled() )
+				{
+					m_profiler = profiler;
+					m_start = profiler->now();
+				}
+			}
+
+			/**
+			 * @brief Copy constructor.
+			 * @param copy A reference to the copied instance.
+			 */
+			ProfileScope (const ProfileScope & copy) noexcept = delete;
+
+			/**
+			 * @brief Move constructor.
+			 * @param copy A reference to the copied instance.
+			 */
+			ProfileScope (ProfileScope && copy) noexcept = delete;
+
+			/**
+			 * @brief Copy assignment.
+			 * @param copy A reference to the copied instance.
+			 * @return ProfileScope &
+			 */
+			ProfileScope & operator= (const ProfileScope & copy) noexcept = delete;
+
+			/**
+			 * @brief Move assignment.
+			 * @param copy A reference to the copied instance.
+			 * @return ProfileScope &
+			 */
+			ProfileScope & operator= (ProfileScope && copy) noexcept = delete;
+
+			/**
+			 * @brief Closes the profile scope.
+			 */
+			~ProfileScope ()
+			{
+				if ( m_profiler != nullptr )
+				{
+					m_profiler->record(m_name, m_start);
+				}
+			}
+
+		private:
+
+			const char * m_name;
+			FrameProfiler * m_profiler{nullptr};
+			uint64_t m_start{0};
+	};
+}
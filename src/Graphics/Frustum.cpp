@@ -127,6 +127,8 @@ namespace EmEn::Graphics
 
 		const auto radius = sphere.radius();
 
+		auto result = Result::Inside;
+
 		for ( const auto & plane : m_planes )
 		{
 			const auto & normal = plane.normal();
@@ -143,13 +145,14 @@ namespace EmEn::Graphics
 				return Result::Outside;
 			}
 
+			/* NOTE: Keep testing the remaining planes, the sphere can still be completely outside another one. */
 			if ( distance < radius )
 			{
-				return Result::Intersect;
+				result = Result::Intersect;
 			}
 		}
 
-		return Result::Inside;
+		return result;
 	}
 
 	Frustum::Result
@@ -163,57 +166,39 @@ namespace EmEn::Graphics
 		const auto & max = box.maximum();
 		const auto & min = box.minimum();
 
-		/* centroid */
-		{
-			const auto midpoint = Vector< 3, float >::midPoint(max, min);
-
-			if ( this->isCollidingWith(Vector< 3, float >(midpoint[X], midpoint[Y], midpoint[Z])) == Result::Inside )
-			{
-				return Result::Intersect;
-			}
-		}
-
-		if ( this->isCollidingWith(Vector< 3, float >(max[X], max[Y], max[Z])) == Result::Inside )
-		{
-			return Result::Intersect;
-		}
-
-		if ( this->isCollidingWith(Vector< 3, float >(max[X], max[Y], min[Z])) == Result::Inside )
-		{
-			return Result::Intersect;
-		}
-
-		if ( this->isCollidingWith(Vector< 3, float >(max[X], min[Y], max[Z])) == Result::Inside )
-		{
-			return Result::Intersect;
-		}
+		auto result = Result::Inside;
 
-		if ( this->isCollidingWith(Vector< 3, float >(max[X], min[Y], min[Z])) == Result::Inside )
+		for ( const auto & plane : m_planes )
 		{
-			return Result::Intersect;
-		}
+			const auto & normal = plane.normal();
 
-		if ( this->isCollidingWith(Vector< 3, float >(min[X], max[Y], max[Z])) == Result::Inside )
-		{
-			return Result::Intersect;
-		}
+			/* NOTE: The positive vertex is the box corner the farthest along the plane normal,
+			 * the negative vertex is the opposite one. If the positive vertex is behind the plane,
+			 * the whole box is outside. If only the negative vertex is behind, the box is crossing the plane. */
+			const auto positiveDistance =
+				normal[X] * (normal[X] >= 0.0F ? max[X] : min[X]) +
+				normal[Y] * (normal[Y] >= 0.0F ? max[Y] : min[Y]) +
+				normal[Z] * (normal[Z] >= 0.0F ? max[Z] : min[Z]) +
+				plane.distance();
 
-		if ( this->isCollidingWith(Vector< 3, float >(min[X], max[Y], min[Z])) == Result::Inside )
-		{
-			return Result::Intersect;
-		}
+			if ( positiveDistance < 0.0F )
+			{
+				return Result::Outside;
+			}
 
-		if ( this->isCollidingWith(Vector< 3, float >(min[X], min[Y], max[Z])) == Result::Inside )
-		{
-			return Result::Intersect;
-		}
+			const auto negativeDistance =
+				normal[X] * (normal[X] >= 0.0F ? min[X] : max[X]) +
+				normal[Y] * (normal[Y] >= 0.0F ? min[Y] : max[Y]) +
+				normal[Z] * (normal[Z] >= 0.0F ? min[Z] : max[Z]) +
+				plane.distance();
 
-		if ( this->isCollidingWith(Vector< 3, float >(min[X], min[Y], min[Z])) == Result::Inside )
-		{
-			return Result::Intersect;
+			if ( negativeDistance < 0.0F )
+			{
+				result = Result::Intersect;
+			}
 		}
 
-		return Result::Outside;
+		return result;
 	}
 
 	Frustum::Result
@@ -108,7 +108,7 @@ namespace EmEn::Graphics
 
 			/**
 			 * @brief Checks an axis aligned bounding box against the Frustum.
-			 * @FIXME May be it could be useful to separate Intersect and Inside case ! ² Not perfect...
+			 * @note This uses the positive/negative vertex test, boxes bigger than the frustum are correctly reported as intersecting.
 			 * @param box A reference to an axis aligned bounding box.
 			 * @return Result
 			 */
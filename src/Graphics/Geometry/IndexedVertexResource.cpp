@@ -30,13 +30,17 @@
 #include <cstddef>
 #include <cstdint>
 #include <memory>
+#include <span>
 #include <string>
 #include <vector>
 
 /* Local inclusions. */
 #include "Libs/VertexFactory/ShapeGenerator.hpp"
 #include "Libs/VertexFactory/FileIO.hpp"
+#include "Libs/FastJSON.hpp"
+#include "Libs/IO/IO.hpp"
 #include "Resources/Manager.hpp"
+#include "FileSystem.hpp"
 #include "Vulkan/TransferManager.hpp"
 #include "Tracer.hpp"
 
@@ -97,6 +101,26 @@ namespace EmEn::Graphics::Geometry
 			return false;
 		}
 
+		/* NOTE: The streams of a native file are uploaded straight from the mapping when they have the layout of this geometry. */
+		if ( m_nativeFile != nullptr )
+		{
+			const NativeVertexLayout layout{
+				this->getNormalsFormat(),
+				this->getPrimaryTextureCoordinatesFormat(),
+				this->vertexColorEnabled() ? VertexColorType::RGBA : VertexColorType::None,
+				SkeletalAnimationType::None
+			};
+
+			const auto nativeFile = std::move(m_nativeFile);
+
+			if ( nativeFile->layout() == layout )
+			{
+				return this->createVideoMemoryBuffers(nativeFile->vertexStream(0), nativeFile->vertexCount(0), nativeFile->vertexElementCount(), nativeFile->indexStream(0));
+			}
+
+			TraceInfo{ClassId} << "The native file layout of geometry '" << this->name() << "' differs from the requested one, the vertex buffer is rebuilt.";
+		}
+
 		/* Create the vertex buffer and the index buffer the local data. */
 		std::vector< float > vertexAttributes{};
 		std::vector< uint32_t > indices{};
@@ -121,7 +145,7 @@ namespace EmEn::Graphics::Geometry
 	}
 
 	bool
-	IndexedVertexResource::createVideoMemoryBuffers (const std::vector< float > & vertexAttributes, uint32_t vertexCount, uint32_t vertexElementCount, const std::vector< uint32_t > & indices) noexcept
+	IndexedVertexResource::createVideoMemoryBuffers (std::span< const float > vertexAttributes, uint32_t vertexCount, uint32_t vertexElementCount, std::span< const uint32_t > indices) noexcept
 	{
 		auto * transferManager = TransferManager::instance(GPUWorkType::Graphics);
 
@@ -187,6 +211,9 @@ namespace EmEn::Graphics::Geometry
 			this->resetFlags();
 			m_localData.clear();
 			m_subGeometries.clear();
+			m_nativeFile.reset();
+			m_storedLevelsOfDetail.clear();
+			m_storedLevelOfDetailScreenSizes.clear();
 		}
 	}
 
@@ -214,38 +241,48 @@ namespace EmEn::Graphics::Geometry
 			return false;
 		}
 
-		/* FIXME: Find a way to declare those flags outside de the loading function. */
-		this->enableFlag(EnableTangentSpace);
-		this->enableFlag(EnablePrimaryTextureCoordinates);
+		return this->setLoadSuccess(this->readLocalData(filepath));
+	}
 
-		ReadOptions options{};
-		options.flipYAxis = true;
-		options.requestNormal = this->isFlagEnabled(EnableNormal);
-		options.requestTangentSpace = this->isFlagEnabled(EnableTangentSpace);
-		options.requestTextureCoordinates = this->isFlagEnabled(EnablePrimaryTextureCoordinates) || this->isFlagEnabled(EnableSecondaryTextureCoordinates);
-		options.requestVertexColor = this->isFlagEnabled(EnableVertexColor);
+	bool
+	IndexedVertexResource::load (const Json::Value & data) noexcept
+	{
+		if ( !this->beginLoading() )
+		{
+			return false;
+		}
 
-		if ( !VertexFactory::FileIO::read(filepath, m_localData, options) )
+		const auto filename = FastJSON::getString(data, JKFilepath);
+
+		if ( filename.empty() )
 		{
-			TraceError{ClassId} << "Unable to load geometry from '" << filepath << "' !";
+			TraceError{ClassId} << "The key '" << JKFilepath << "' is missing for geometry '" << this->name() << "' !";
 
 			return this->setLoadSuccess(false);
 		}
 
-		return this->setLoadSuccess(true);
-	}
+		const auto filepath = FileSystem::instance()->getFilepathFromDataDirectories(Resources::DataStores, filename);
 
-	bool
-	IndexedVertexResource::load (const Json::Value & /*data*/) noexcept
-	{
-		if ( !this->beginLoading() )
+		if ( filepath.empty() )
 		{
-			return false;
+			TraceError{ClassId} << "The geometry file '" << filename << "' is not in the data stores !";
+
+			return this->setLoadSuccess(false);
 		}
 
-		Tracer::warning(ClassId, "FIXME: This function is not yet available !");
+		if ( !this->readLocalData(filepath) )
+		{
+			return this->setLoadSuccess(false);
+		}
+
+		const auto reduceOverdraw = FastJSON::getBoolean(data, JKOptimizeOverdraw, false);
+
+		if ( FastJSON::getBoolean(data, JKOptimizeVertexCache, false) || reduceOverdraw )
+		{
+			this->optimizeLocalData(reduceOverdraw, FastJSON::getNumber< uint32_t >(data, JKVertexCacheSize, DefaultVertexCacheSize));
+		}
 
-		return this->setLoadSuccess(false);
+		return this->setLoadSuccess(true);
 	}
 
 	bool
@@ -268,6 +305,82 @@ namespace EmEn::Graphics::Geometry
 		return this->setLoadSuccess(true);
 	}
 
+	bool
+	IndexedVertexResource::readLocalData (const std::filesystem::path & filepath) noexcept
+	{
+		/* FIXME: Find a way to declare those flags outside de the loading function. */
+		this->enableFlag(EnableTangentSpace);
+		this->enableFlag(EnablePrimaryTextureCoordinates);
+
+		if ( IO::getFileExtension(filepath, true) == "emgeo" )
+		{
+			return this->readNativeFile(filepath);
+		}
+
+		ReadOptions options{};
+		options.flipYAxis = true;
+		options.requestNormal = this->isFlagEnabled(EnableNormal);
+		options.requestTangentSpace = this->isFlagEnabled(EnableTangentSpace);
+		options.requestTextureCoordinates = this->isFlagEnabled(EnablePrimaryTextureCoordinates) || this->isFlagEnabled(EnableSecondaryTextureCoordinates);
+		options.requestVertexColor = this->isFlagEnabled(EnableVertexColor);
+
+		if ( !VertexFactory::FileIO::read(filepath, m_localData, options) )
+		{
+			TraceError{ClassId} << "Unable to load geometry from '" << filepath << "' !";
+
+			return false;
+		}
+
+		return true;
+	}
+
+	bool
+	IndexedVertexResource::readNativeFile (const std::filesystem::path & filepath) noexcept
+	{
+		auto nativeFile = std::make_unique< FileFormatNative< float, uint32_t > >();
+
+		if ( !nativeFile->open(filepath) || !nativeFile->extractLevel(0, m_localData) )
+		{
+			TraceError{ClassId} << "Unable to load geometry from native file '" << filepath << "' !";
+
+			return false;
+		}
+
+		m_storedLevelsOfDetail.clear();
+		m_storedLevelOfDetailScreenSizes.clear();
+
+		for ( uint32_t level = 1; level < nativeFile->levelCount(); ++level )
+		{
+			if ( !nativeFile->extractLevel(level, m_storedLevelsOfDetail.emplace_back()) )
+			{
+				TraceWarning{ClassId} << "Unable to read the level of detail #" << level << " from native file '" << filepath << "' !";
+
+				m_storedLevelsOfDetail.pop_back();
+
+				break;
+			}
+
+			m_storedLevelOfDetailScreenSizes.emplace_back(nativeFile->screenSize(level));
+		}
+
+		m_nativeFile = std::move(nativeFile);
+
+		return true;
+	}
+
+	void
+	IndexedVertexResource::optimizeLocalData (bool reduceOverdraw, uint32_t vertexCacheSize) noexcept
+	{
+		/* NOTE: The native file streams no longer match the local data. */
+		m_nativeFile.reset();
+
+		const auto [before, after] = m_localData.optimizeForRendering(reduceOverdraw, vertexCacheSize);
+
+		TraceInfo{ClassId} <<
+			"Geometry '" << this->name() << "' optimized for a " << vertexCacheSize << " vertices cache" << ( reduceOverdraw ? " and the overdraw" : "" ) << " : "
+			"ACMR " << before.ACMR << " -> " << after.ACMR << ", ATVR " << before.ATVR << " -> " << after.ATVR << ".";
+	}
+
 	std::shared_ptr< IndexedVertexResource >
 	IndexedVertexResource::get (const std::string & resourceName, bool directLoad) noexcept
 	{
@@ -32,11 +32,13 @@
 #include <string>
 #include <vector>
 #include <memory>
+#include <span>
 
 /* Local inclusions for inheritances. */
 #include "Interface.hpp"
 
 /* Local inclusions for usages. */
+#include "Libs/VertexFactory/FileFormatNative.hpp"
 #include "Resources/Container.hpp"
 
 namespace EmEn::Graphics::Geometry
@@ -271,6 +273,28 @@ namespace EmEn::Graphics::Geometry
 				return m_localData;
 			}
 
+			/**
+			 * @brief Returns the levels of detail stored with the geometry in a native file, from the most detailed one.
+			 * @return const std::vector< Libs::VertexFactory::Shape< float, uint32_t > > &
+			 */
+			[[nodiscard]]
+			const std::vector< Libs::VertexFactory::Shape< float, uint32_t > > &
+			storedLevelsOfDetail () const noexcept
+			{
+				return m_storedLevelsOfDetail;
+			}
+
+			/**
+			 * @brief Returns the screen sizes of the levels of detail stored in a native file.
+			 * @return const std::vector< float > &
+			 */
+			[[nodiscard]]
+			const std::vector< float > &
+			storedLevelOfDetailScreenSizes () const noexcept
+			{
+				return m_storedLevelOfDetailScreenSizes;
+			}
+
 			/**
 			 * @brief Returns an indexed vertex resource by its name.
 			 * @param resourceName A reference to a string.
@@ -289,21 +313,55 @@ namespace EmEn::Graphics::Geometry
 
 		private:
 
+			/**
+			 * @brief Reads a geometry file into the local data.
+			 * @param filepath A reference to a filesystem path.
+			 * @return bool
+			 */
+			[[nodiscard]]
+			bool readLocalData (const std::filesystem::path & filepath) noexcept;
+
+			/**
+			 * @brief Reads a native geometry file into the local data and keeps it mapped until the creation of the buffers.
+			 * @param filepath A reference to a filesystem path.
+			 * @return bool
+			 */
+			[[nodiscard]]
+			bool readNativeFile (const std::filesystem::path & filepath) noexcept;
+
+			/**
+			 * @brief Reorders the local data triangles and vertices for the GPU and reports the vertex cache efficiency gain.
+			 * @param reduceOverdraw Sort the triangle clusters against the overdraw too.
+			 * @param vertexCacheSize The number of vertices kept by the targeted cache.
+			 * @return void
+			 */
+			void optimizeLocalData (bool reduceOverdraw, uint32_t vertexCacheSize) noexcept;
+
 			/**
 			 * @brief Creates a hardware buffer on the device.
-			 * @param vertexAttributes A reference to a vertex attribute vector.
+			 * @param vertexAttributes A view on the vertex attributes.
 			 * @param vertexCount The number of vertices.
 			 * @param vertexElementCount The number of elements composing a vertex.
-			 * @param indices A reference to an index vector.
+			 * @param indices A view on the indices.
 			 * @return bool
 			 */
 			[[nodiscard]]
-			bool createVideoMemoryBuffers (const std::vector< float > & vertexAttributes, uint32_t vertexCount, uint32_t vertexElementCount, const std::vector< uint32_t > & indices) noexcept;
+			bool createVideoMemoryBuffers (std::span< const float > vertexAttributes, uint32_t vertexCount, uint32_t vertexElementCount, std::span< const uint32_t > indices) noexcept;
+
+			/* JSON key. */
+			static constexpr auto JKFilepath{"Filepath"};
+			static constexpr auto JKOptimizeVertexCache{"OptimizeVertexCache"};
+			static constexpr auto JKOptimizeOverdraw{"OptimizeOverdraw"};
+			static constexpr auto JKVertexCacheSize{"VertexCacheSize"};
 
 			std::unique_ptr< Vulkan::VertexBufferObject > m_vertexBufferObject;
 			std::unique_ptr< Vulkan::IndexBufferObject > m_indexBufferObject;
 			Libs::VertexFactory::Shape< float, uint32_t > m_localData;
 			std::vector< SubGeometry > m_subGeometries;
+			/* NOTE: The native file stays mapped between the loading and the creation to upload its streams without copy. */
+			std::unique_ptr< Libs::VertexFactory::FileFormatNative< float, uint32_t > > m_nativeFile;
+			std::vector< Libs::VertexFactory::Shape< float, uint32_t > > m_storedLevelsOfDetail;
+			std::vector< float > m_storedLevelOfDetailScreenSizes;
 	};
 }
 
@@ -154,6 +154,46 @@ namespace EmEn::Graphics::Renderable
 			[[nodiscard]]
 			virtual const Geometry::Interface * geometry () const noexcept = 0;
 
+			/**
+			 * @brief Returns the number of levels of detail of the geometry.
+			 * @note The level 0 is always the full detail geometry returned by geometry().
+			 * @return uint32_t
+			 */
+			[[nodiscard]]
+			virtual
+			uint32_t
+			levelOfDetailCount () const noexcept
+			{
+				return 1;
+			}
+
+			/**
+			 * @brief Returns the geometry of a level of detail.
+			 * @note Every level shares the vertex layout and the sub-geometries of the full detail geometry.
+			 * @param levelOfDetail The level of detail, 0 is the full detail geometry.
+			 * @return const Geometry::Interface *
+			 */
+			[[nodiscard]]
+			virtual
+			const Geometry::Interface *
+			levelOfDetailGeometry (uint32_t /*levelOfDetail*/) const noexcept
+			{
+				return this->geometry();
+			}
+
+			/**
+			 * @brief Selects the level of detail to draw the renderable seen from a distance.
+			 * @param distance The distance between the point of view and the renderable.
+			 * @return uint32_t
+			 */
+			[[nodiscard]]
+			virtual
+			uint32_t
+			selectLevelOfDetail (float /*distance*/) const noexcept
+			{
+				return 0;
+			}
+
 			/**
 			 * @brief Returns the material of the renderable.
 			 * @note This can be nullptr.
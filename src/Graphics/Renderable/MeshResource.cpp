@@ -26,11 +26,19 @@
 
 #include "MeshResource.hpp"
 
+/* STL inclusions. */
+#include <algorithm>
+#include <limits>
+#include <sstream>
+#include <vector>
+
 /* Local inclusions. */
 #include "Graphics/Geometry/IndexedVertexResource.hpp"
 #include "Graphics/Geometry/VertexResource.hpp"
 #include "Graphics/Material/BasicResource.hpp"
 #include "Graphics/Material/StandardResource.hpp"
+#include "Libs/VertexFactory/ShapeSimplifier.hpp"
+#include "Libs/FastJSON.hpp"
 #include "Resources/Manager.hpp"
 
 /* Defining the resource manager class id. */
@@ -162,7 +170,8 @@ namespace EmEn::Graphics::Renderable
 		{
 			const auto geometryName = data[GeometryNameKey].asString();
 
-			auto geometryResource = IndexedVertexResource::get(geometryName);
+			/* NOTE: The levels of detail are generated from the local data, so the geometry must be available now. */
+			auto geometryResource = IndexedVertexResource::get(geometryName, data.isMember(LevelsOfDetailKey));
 
 			if ( geometryResource == nullptr )
 			{
@@ -179,6 +188,100 @@ namespace EmEn::Graphics::Renderable
 		return nullptr;
 	}
 
+	bool
+	MeshResource::parseLevelsOfDetail (const Json::Value & data, const std::shared_ptr< IndexedVertexResource > & geometry) noexcept
+	{
+		Json::Value levelsOfDetail;
+
+		if ( !FastJSON::getObject(data, LevelsOfDetailKey, levelsOfDetail) )
+		{
+			TraceError{ClassId} << "The key '" << LevelsOfDetailKey << "' must be a JSON object !";
+
+			return false;
+		}
+
+		if ( geometry == nullptr || !geometry->isLoaded() )
+		{
+			TraceError{ClassId} << "The levels of detail of mesh '" << this->name() << "' need an indexed geometry loaded beforehand !";
+
+			return false;
+		}
+
+		const auto levelCount = FastJSON::getNumber< uint32_t >(levelsOfDetail, LevelCountKey, 3);
+		const auto reductionRatio = FastJSON::getNumber< float >(levelsOfDetail, ReductionRatioKey, 0.5F);
+		const auto maxError = FastJSON::getNumber< float >(levelsOfDetail, MaxErrorKey, std::numeric_limits< float >::max());
+
+		/* NOTE: The levels stored in a native geometry file are used as is, the others are simplified now. */
+		std::vector< VertexFactory::Shape< float, uint32_t > > shapes;
+		std::vector< float > storedScreenSizes;
+
+		if ( geometry->storedLevelsOfDetail().empty() )
+		{
+			const VertexFactory::ShapeSimplifier< float, uint32_t > simplifier{geometry->localData()};
+
+			shapes = simplifier.generateLODChain(levelCount, reductionRatio, maxError);
+		}
+		else
+		{
+			const auto storedLevelCount = std::min< size_t >(levelCount, geometry->storedLevelsOfDetail().size());
+
+			shapes.assign(geometry->storedLevelsOfDetail().begin(), geometry->storedLevelsOfDetail().begin() + storedLevelCount);
+			storedScreenSizes.assign(geometry->storedLevelOfDetailScreenSizes().begin(), geometry->storedLevelOfDetailScreenSizes().begin() + storedLevelCount);
+		}
+
+		std::vector< std::shared_ptr< Geometry::Interface > > geometries;
+		geometries.reserve(shapes.size());
+
+		for ( size_t level = 0; level < shapes.size(); ++level )
+		{
+			const auto & shape = shapes[level];
+			const auto resourceName = (std::stringstream{} << geometry->name() << "+LOD" << (level + 1)).str();
+
+			auto levelGeometry = Resources::Manager::instance()->indexedVertexGeometries().getOrCreateResource(resourceName, [&shape] (IndexedVertexResource & newGeometry) {
+				return newGeometry.load(shape);
+			}, geometry->flags());
+
+			if ( levelGeometry == nullptr )
+			{
+				TraceError{ClassId} << "Unable to create the geometry '" << resourceName << "' for mesh '" << this->name() << "' !";
+
+				return false;
+			}
+
+			geometries.emplace_back(levelGeometry);
+		}
+
+		std::vector< float > screenSizes;
+		Json::Value screenSizeRules;
+
+		if ( !FastJSON::getArray(levelsOfDetail, ScreenSizesKey, screenSizeRules) )
+		{
+			screenSizes = storedScreenSizes;
+		}
+		else
+		{
+			for ( const auto & screenSizeRule : screenSizeRules )
+			{
+				if ( screenSizeRule.isNumeric() )
+				{
+					screenSizes.emplace_back(screenSizeRule.asFloat());
+				}
+			}
+		}
+
+		/* NOTE: Completes the missing screen sizes by halving the last one. */
+		while ( screenSizes.size() < geometries.size() )
+		{
+			screenSizes.emplace_back(screenSizes.empty() ? DefaultLevelOfDetailScreenSize : screenSizes.back() * 0.5F);
+		}
+
+		screenSizes.resize(geometries.size());
+
+		TraceInfo{ClassId} << "Mesh '" << this->name() << "' uses " << geometries.size() << ( storedScreenSizes.empty() ? " simplified" : " stored" ) << " levels of detail from " << geometry->localData().triangles().size() << " triangles.";
+
+		return this->setLevelsOfDetail(geometries, screenSizes);
+	}
+
 	RasterizationOptions
 	MeshResource::parseLayerOptions (const Json::Value & data) noexcept
 	{
@@ -279,6 +382,12 @@ namespace EmEn::Graphics::Renderable
 
 		this->setGeometry(geometryResource);
 
+		/* NOTE: A failure to build the levels of detail is not fatal, the mesh is always drawn at full detail. */
+		if ( data.isMember(LevelsOfDetailKey) && !this->parseLevelsOfDetail(data, std::dynamic_pointer_cast< IndexedVertexResource >(geometryResource)) )
+		{
+			TraceWarning{ClassId} << "Unable to generate the levels of detail of mesh '" << this->name() << "' !";
+		}
+
 		/* Checks layers array presence and content. */
 		if ( !data.isMember(LayersKey) )
 		{
@@ -416,6 +525,62 @@ namespace EmEn::Graphics::Renderable
 		return this->addDependency(m_geometry);
 	}
 
+	bool
+	MeshResource::setLevelsOfDetail (const std::vector< std::shared_ptr< Geometry::Interface > > & geometries, const std::vector< float > & screenSizes) noexcept
+	{
+		if ( geometries.size() != screenSizes.size() )
+		{
+			TraceError{ClassId} << "The levels of detail of mesh '" << this->name() << "' need one screen size per geometry !";
+
+			return false;
+		}
+
+		for ( const auto & geometry : geometries )
+		{
+			if ( geometry == nullptr )
+			{
+				TraceError{ClassId} << "A level of detail geometry of mesh '" << this->name() << "' is null !";
+
+				return false;
+			}
+		}
+
+		this->setReadyForInstantiation(false);
+
+		m_levelOfDetailGeometries = geometries;
+		m_levelOfDetailScreenSizes = screenSizes;
+
+		for ( const auto & geometry : m_levelOfDetailGeometries )
+		{
+			if ( !this->addDependency(geometry) )
+			{
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+	uint32_t
+	MeshResource::selectLevelOfDetail (float distance) const noexcept
+	{
+		if ( m_levelOfDetailGeometries.empty() || distance <= 0.0F )
+		{
+			return 0;
+		}
+
+		const auto screenSize = this->boundingSphere().radius() / distance;
+
+		uint32_t levelOfDetail = 0;
+
+		while ( levelOfDetail < m_levelOfDetailScreenSizes.size() && screenSize < m_levelOfDetailScreenSizes[levelOfDetail] )
+		{
+			levelOfDetail++;
+		}
+
+		return levelOfDetail;
+	}
+
 	bool
 	MeshResource::addMaterial (const std::shared_ptr< Material::Interface > & material, const RasterizationOptions & options, int flags) noexcept
 	{
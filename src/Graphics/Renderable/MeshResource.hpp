@@ -40,6 +40,12 @@
 #include "Resources/Container.hpp"
 #include "MeshLayer.hpp"
 
+/* Forward declarations. */
+namespace EmEn::Graphics::Geometry
+{
+	class IndexedVertexResource;
+}
+
 namespace EmEn::Graphics::Renderable
 {
 	/**
@@ -103,6 +109,31 @@ namespace EmEn::Graphics::Renderable
 				return m_geometry.get();
 			}
 
+			/** @copydoc EmEn::Graphics::Renderable::Interface::levelOfDetailCount() const */
+			[[nodiscard]]
+			uint32_t
+			levelOfDetailCount () const noexcept override
+			{
+				return static_cast< uint32_t >(m_levelOfDetailGeometries.size()) + 1;
+			}
+
+			/** @copydoc EmEn::Graphics::Renderable::Interface::levelOfDetailGeometry() const */
+			[[nodiscard]]
+			const Geometry::Interface *
+			levelOfDetailGeometry (uint32_t levelOfDetail) const noexcept override
+			{
+				if ( levelOfDetail == 0 || levelOfDetail > m_levelOfDetailGeometries.size() )
+				{
+					return m_geometry.get();
+				}
+
+				return m_levelOfDetailGeometries[levelOfDetail - 1].get();
+			}
+
+			/** @copydoc EmEn::Graphics::Renderable::Interface::selectLevelOfDetail() const */
+			[[nodiscard]]
+			uint32_t selectLevelOfDetail (float distance) const noexcept override;
+
 			/** @copydoc EmEn::Graphics::Renderable::Interface::material() const */
 			[[nodiscard]]
 			const Material::Interface * material (uint32_t layerIndex) const noexcept override;
@@ -169,6 +200,15 @@ namespace EmEn::Graphics::Renderable
 			 */
 			bool load (const std::shared_ptr< Geometry::Interface > & geometry, const std::vector< std::shared_ptr< Material::Interface > > & materialList, const std::vector< RasterizationOptions > & rasterizationOptions = {}) noexcept;
 
+			/**
+			 * @brief Sets the simplified geometries drawn when the mesh gets smaller on screen.
+			 * @note Each screen size is the bounding sphere radius over the viewing distance under which the level is used.
+			 * @param geometries A reference to a list of geometry resource smart pointers, from the most to the least detailed.
+			 * @param screenSizes A reference to a list of decreasing screen sizes, one per geometry.
+			 * @return bool
+			 */
+			bool setLevelsOfDetail (const std::vector< std::shared_ptr< Geometry::Interface > > & geometries, const std::vector< float > & screenSizes) noexcept;
+
 			/**
 			 * @brief Gives a hint for the mesh size. This is not effective by itself, you can use it for scale a scene node.
 			 * @return float
@@ -254,6 +294,14 @@ namespace EmEn::Graphics::Renderable
 			 */
 			std::shared_ptr< Geometry::Interface > parseGeometry (const Json::Value & data) noexcept;
 
+			/**
+			 * @brief Parses a JSON stream to generate the levels of detail from an indexed geometry.
+			 * @param data A reference to a JSON node.
+			 * @param geometry A reference to the full detail geometry resource smart pointer.
+			 * @return bool
+			 */
+			bool parseLevelsOfDetail (const Json::Value & data, const std::shared_ptr< Geometry::IndexedVertexResource > & geometry) noexcept;
+
 			/**
 			 * @brief Parses a JSON stream to get the material information.
 			 * @param data A reference to a JSON node.
@@ -281,8 +329,18 @@ namespace EmEn::Graphics::Renderable
 			static constexpr auto BaseSizeKey{"BaseSize"};
 			static constexpr auto EnableDoubleSidedFaceKey{"EnableDoubleSidedFace"};
 			static constexpr auto DrawingModeKey{"DrawingMode"};
+			static constexpr auto LevelsOfDetailKey{"LevelsOfDetail"};
+			static constexpr auto LevelCountKey{"LevelCount"};
+			static constexpr auto ReductionRatioKey{"ReductionRatio"};
+			static constexpr auto MaxErrorKey{"MaxError"};
+			static constexpr auto ScreenSizesKey{"ScreenSizes"};
+
+			/* NOTE: The default screen size under which the first simplified level is used, halved for each next level. */
+			static constexpr auto DefaultLevelOfDetailScreenSize{0.25F};
 
 			std::shared_ptr< Geometry::Interface > m_geometry;
+			std::vector< std::shared_ptr< Geometry::Interface > > m_levelOfDetailGeometries;
+			std::vector< float > m_levelOfDetailScreenSizes;
 			std::vector< MeshLayer > m_layers;
 			float m_baseSize{1.0F};
 	};
@@ -331,8 +331,52 @@ namespace EmEn::Graphics::RenderableInstance
 		m_renderTargetPrograms.erase(renderTarget);
 	}
 
+	const GraphicsPipeline *
+	Abstract::getGraphicsPipeline (const std::shared_ptr< RenderTarget::Abstract > & renderTarget, RenderPassType renderPassType, uint32_t layerIndex) const noexcept
+	{
+		const std::lock_guard< std::mutex > lock{m_GPUMemoryAccess};
+
+		const auto renderTargetProgramsIt = m_renderTargetPrograms.find(renderTarget);
+
+		if ( renderTargetProgramsIt == m_renderTargetPrograms.end() )
+		{
+			return nullptr;
+		}
+
+		const auto program = renderTargetProgramsIt->second->renderProgram(renderPassType, layerIndex);
+
+		if ( program == nullptr )
+		{
+			return nullptr;
+		}
+
+		return program->graphicsPipeline().get();
+	}
+
+	const GraphicsPipeline *
+	Abstract::getShadowCastingGraphicsPipeline (const std::shared_ptr< RenderTarget::Abstract > & renderTarget, uint32_t layerIndex) const noexcept
+	{
+		const std::lock_guard< std::mutex > lock{m_GPUMemoryAccess};
+
+		const auto renderTargetProgramsIt = m_renderTargetPrograms.find(renderTarget);
+
+		if ( renderTargetProgramsIt == m_renderTargetPrograms.end() )
+		{
+			return nullptr;
+		}
+
+		const auto program = renderTargetProgramsIt->second->shadowCastingProgram(layerIndex);
+
+		if ( program == nullptr )
+		{
+			return nullptr;
+		}
+
+		return program->graphicsPipeline().get();
+	}
+
 	void
-	Abstract::castShadows (const std::shared_ptr< RenderTarget::Abstract > & renderTarget, uint32_t layerIndex, const CommandBuffer & commandBuffer) const noexcept
+	Abstract::castShadows (const std::shared_ptr< RenderTarget::Abstract > & renderTarget, uint32_t layerIndex, uint32_t levelOfDetail, const CommandBuffer & commandBuffer) const noexcept
 	{
 		const std::lock_guard< std::mutex > lock{m_GPUMemoryAccess};
 
@@ -354,6 +398,13 @@ namespace EmEn::Graphics::RenderableInstance
 			return;
 		}
 
+		/* NOTE: A pipeline whose pre-warm creation failed is never drawn. */
+		if ( !program->graphicsPipeline()->isCreated() )
+		{
+			return;
+		}
+
+		const auto * geometry = m_renderable->levelOfDetailGeometry(levelOfDetail);
 		const auto pipelineLayout = program->pipelineLayout();
 
 		commandBuffer.bind(*program->graphicsPipeline());
@@ -369,15 +420,15 @@ namespace EmEn::Graphics::RenderableInstance
 			);
 		}
 
-		this->bindInstanceModelLayer(commandBuffer, layerIndex);
+		this->bindInstanceModelLayer(commandBuffer, *geometry, layerIndex);
 
 		this->pushMatrices(commandBuffer, *pipelineLayout, renderTarget->viewMatrices(), *program);
 
-		commandBuffer.draw(*m_renderable->geometry(), layerIndex, this->instanceCount());
+		commandBuffer.draw(*geometry, layerIndex, this->instanceCount());
 	}
 
 	void
-	Abstract::render (const std::shared_ptr< RenderTarget::Abstract > & renderTarget, const Scenes::Component::AbstractLightEmitter * lightEmitter, RenderPassType renderPassType, uint32_t layerIndex, const CommandBuffer & commandBuffer) const noexcept
+	Abstract::render (const std::shared_ptr< RenderTarget::Abstract > & renderTarget, const Scenes::Component::AbstractLightEmitter * lightEmitter, RenderPassType renderPassType, uint32_t layerIndex, uint32_t levelOfDetail, const CommandBuffer & commandBuffer) const noexcept
 	{
 		const std::lock_guard< std::mutex > lock{m_GPUMemoryAccess};
 
@@ -399,14 +450,19 @@ namespace EmEn::Graphics::RenderableInstance
 			return;
 		}
 
-		const auto * geometry = m_renderable->geometry();
+		if ( !program->graphicsPipeline()->isCreated() )
+		{
+			return;
+		}
+
+		const auto * geometry = m_renderable->levelOfDetailGeometry(levelOfDetail);
 		const auto pipelineLayout = program->pipelineLayout();
 
 		/* Bind the graphics pipeline. */
 		commandBuffer.bind(*program->graphicsPipeline());
 
 		/* Bind renderable instance VBO/IBO. */
-		this->bindInstanceModelLayer(commandBuffer, layerIndex);
+		this->bindInstanceModelLayer(commandBuffer, *geometry, layerIndex);
 
 		/* Configure the push constants. */
 		this->pushMatrices(commandBuffer, *pipelineLayout, renderTarget->viewMatrices(), *program);
@@ -476,6 +532,12 @@ namespace EmEn::Graphics::RenderableInstance
 			return;
 		}
 
+		if ( !program->graphicsPipeline()->isCreated() )
+		{
+			return;
+		}
+
+		const auto * geometry = m_renderable->geometry();
 		const auto pipelineLayout = program->pipelineLayout();
 
 		commandBuffer.bind(*program->graphicsPipeline());
@@ -491,11 +553,11 @@ namespace EmEn::Graphics::RenderableInstance
 			);
 		}
 
-		this->bindInstanceModelLayer(commandBuffer, layerIndex);
+		this->bindInstanceModelLayer(commandBuffer, *geometry, layerIndex);
 
 		this->pushMatrices(commandBuffer, *pipelineLayout, renderTarget->viewMatrices(), *program);
 
-		commandBuffer.draw(*m_renderable->geometry(), layerIndex, this->instanceCount());
+		commandBuffer.draw(*geometry, layerIndex, this->instanceCount());
 	}
 
 	bool
@@ -44,6 +44,7 @@
 /* Local inclusions for usages. */
 #include "Graphics/Renderable/Interface.hpp"
 #include "Graphics/Types.hpp"
+#include "Libs/Math/CartesianFrame.hpp"
 #include "RenderTargetProgramsInterface.hpp"
 
 /* Forward declarations. */
@@ -464,6 +465,38 @@ namespace EmEn::Graphics::RenderableInstance
 				return m_renderable.get();
 			}
 
+			/**
+			 * @brief Returns the renderable interface smart pointer.
+			 * @return std::shared_ptr< Renderable::Interface >
+			 */
+			[[nodiscard]]
+			std::shared_ptr< Renderable::Interface >
+			renderablePointer () const noexcept
+			{
+				return m_renderable;
+			}
+
+			/**
+			 * @brief Returns the graphics pipeline used to render a layer with a render pass.
+			 * @note This is used to order the render queue by pipeline state.
+			 * @param renderTarget A reference to the render target smart pointer.
+			 * @param renderPassType The render pass type.
+			 * @param layerIndex The renderable layer index.
+			 * @return const Vulkan::GraphicsPipeline *
+			 */
+			[[nodiscard]]
+			const Vulkan::GraphicsPipeline * getGraphicsPipeline (const std::shared_ptr< RenderTarget::Abstract > & renderTarget, RenderPassType renderPassType, uint32_t layerIndex) const noexcept;
+
+			/**
+			 * @brief Returns the graphics pipeline used to cast shadows of a layer.
+			 * @note This is used to order the render queue by pipeline state.
+			 * @param renderTarget A reference to the render target smart pointer.
+			 * @param layerIndex The renderable layer index.
+			 * @return const Vulkan::GraphicsPipeline *
+			 */
+			[[nodiscard]]
+			const Vulkan::GraphicsPipeline * getShadowCastingGraphicsPipeline (const std::shared_ptr< RenderTarget::Abstract > & renderTarget, uint32_t layerIndex) const noexcept;
+
 			/**
 			 * @brief Gets the renderable instance ready to render in a scene.
 			 * @param renderTarget A reference to the render target smart pointer.
@@ -546,10 +579,11 @@ namespace EmEn::Graphics::RenderableInstance
 			 * @brief Draws the instance in a shadow map.
 			 * @param renderTarget A reference to the render target smart pointer.
 			 * @param layerIndex The renderable layer index.
+			 * @param levelOfDetail The renderable level of detail.
 			 * @param commandBuffer A reference to a command buffer.
 			 * @return void
 			 */
-			void castShadows (const std::shared_ptr< RenderTarget::Abstract > & renderTarget, uint32_t layerIndex, const Vulkan::CommandBuffer & commandBuffer) const noexcept;
+			void castShadows (const std::shared_ptr< RenderTarget::Abstract > & renderTarget, uint32_t layerIndex, uint32_t levelOfDetail, const Vulkan::CommandBuffer & commandBuffer) const noexcept;
 
 			/**
 			 * @brief Draws the instance in a render target.
@@ -557,10 +591,11 @@ namespace EmEn::Graphics::RenderableInstance
 			 * @param lightEmitter A pointer to an optional light emitter. TODO: should be a smart pointer.
 			 * @param renderPassType The render pass type into the render target.
 			 * @param layerIndex The renderable layer index.
+			 * @param levelOfDetail The renderable level of detail.
 			 * @param commandBuffer A reference to a command buffer.
 			 * @return void
 			 */
-			void render (const std::shared_ptr< RenderTarget::Abstract > & renderTarget, const Scenes::Component::AbstractLightEmitter * lightEmitter, RenderPassType renderPassType, uint32_t layerIndex, const Vulkan::CommandBuffer & commandBuffer) const noexcept;
+			void render (const std::shared_ptr< RenderTarget::Abstract > & renderTarget, const Scenes::Component::AbstractLightEmitter * lightEmitter, RenderPassType renderPassType, uint32_t layerIndex, uint32_t levelOfDetail, const Vulkan::CommandBuffer & commandBuffer) const noexcept;
 
 			/**
 			 * @brief Draws the TBN space over each vertex.
@@ -605,6 +640,54 @@ namespace EmEn::Graphics::RenderableInstance
 			[[nodiscard]]
 			virtual Libs::Math::Vector< 3, float > worldPosition () const noexcept = 0;
 
+			/**
+			 * @brief Returns the world coordinates of a single instance.
+			 * @note Instances drawn from a per-instance model matrices buffer return the origin.
+			 * @return Libs::Math::CartesianFrame< float >
+			 */
+			[[nodiscard]]
+			virtual Libs::Math::CartesianFrame< float > worldCoordinates () const noexcept = 0;
+
+			/**
+			 * @brief Returns the number of instances drawn by a single render call.
+			 * @return uint32_t
+			 */
+			[[nodiscard]]
+			uint32_t
+			drawnInstanceCount () const noexcept
+			{
+				return this->instanceCount();
+			}
+
+			/**
+			 * @brief Returns whether this renderable instance can be merged with others sharing the same renderable into an instanced draw.
+			 * @note The model matrix must be the plain world frame, and the material must not be animated per instance.
+			 * @return bool
+			 */
+			[[nodiscard]]
+			bool
+			isAutoInstancingCompatible () const noexcept
+			{
+				if ( this->isInstanced() || this->isAnimated() )
+				{
+					return false;
+				}
+
+				return this->isFlagDisabled(EnableSkeletalAnimation | UseInfinityView | FacingCamera | DisplayTBNSpaceEnabled | ApplyTransformationMatrix);
+			}
+
+			/**
+			 * @brief Returns whether this renderable instance draws several instances from a per-instance model matrices buffer.
+			 * @note Such instances are spread around the world and can't be culled with their owner bounding primitives.
+			 * @return bool
+			 */
+			[[nodiscard]]
+			bool
+			isInstanced () const noexcept
+			{
+				return this->useModelVertexBufferObject();
+			}
+
 		protected:
 
 			/**
@@ -662,10 +745,11 @@ namespace EmEn::Graphics::RenderableInstance
 			/**
 			 * @brief Binds the renderable instance resources to a command buffer.
 			 * @param commandBuffer A reference to a command buffer.
+			 * @param geometry A reference to the geometry of the drawn level of detail.
 			 * @param layerIndex The current layer to bind.
 			 * @return void
 			 */
-			virtual void bindInstanceModelLayer (const Vulkan::CommandBuffer & commandBuffer, uint32_t layerIndex) const noexcept = 0;
+			virtual void bindInstanceModelLayer (const Vulkan::CommandBuffer & commandBuffer, const Geometry::Interface & geometry, uint32_t layerIndex) const noexcept = 0;
 
 			mutable std::mutex m_GPUMemoryAccess{};
 
@@ -442,10 +442,10 @@ namespace EmEn::Graphics::RenderableInstance
 	}
 
 	void
-	Multiple::bindInstanceModelLayer (const CommandBuffer & commandBuffer, uint32_t layerIndex) const noexcept
+	Multiple::bindInstanceModelLayer (const CommandBuffer & commandBuffer, const Geometry::Interface & geometry, uint32_t layerIndex) const noexcept
 	{
 		/*  Bind the geometry VBO and the optional IBO with the model matrix VBO. */
-		commandBuffer.bind(*this->renderable()->geometry(), *m_vertexBufferObject, layerIndex);
+		commandBuffer.bind(geometry, *m_vertexBufferObject, layerIndex);
 	}
 
 	bool
@@ -117,6 +117,25 @@ namespace EmEn::Graphics::RenderableInstance
 				return {};
 			}
 
+			/** @copydoc EmEn::Graphics::RenderableInstance::Abstract::worldCoordinates() */
+			[[nodiscard]]
+			Libs::Math::CartesianFrame< float >
+			worldCoordinates () const noexcept override
+			{
+				return {};
+			}
+
+			/**
+			 * @brief Returns the maximum number of instances hold by this renderable instance.
+			 * @return uint32_t
+			 */
+			[[nodiscard]]
+			uint32_t
+			maxInstanceCount () const noexcept
+			{
+				return m_instanceCount;
+			}
+
 			/**
 			 * @brief Sets the active instance count to draw.
 			 * @param count The number of instance.
@@ -166,7 +185,7 @@ namespace EmEn::Graphics::RenderableInstance
 			}
 
 			/** @copydoc EmEn::Graphics::RenderableInstance::Abstract::bindInstanceModelLayer() */
-			void bindInstanceModelLayer (const Vulkan::CommandBuffer & commandBuffer, uint32_t layerIndex) const noexcept override;
+			void bindInstanceModelLayer (const Vulkan::CommandBuffer & commandBuffer, const Geometry::Interface & geometry, uint32_t layerIndex) const noexcept override;
 
 			/**
 			 * @brief Creates the model matrices.
@@ -134,9 +134,9 @@ namespace EmEn::Graphics::RenderableInstance
 	}
 
 	void
-	Unique::bindInstanceModelLayer (const CommandBuffer & commandBuffer, uint32_t layerIndex) const noexcept
+	Unique::bindInstanceModelLayer (const CommandBuffer & commandBuffer, const Geometry::Interface & geometry, uint32_t layerIndex) const noexcept
 	{
 		/* Bind the geometry VBO and the optional IBO. */
-		commandBuffer.bind(*this->renderable()->geometry(), layerIndex);
+		commandBuffer.bind(geometry, layerIndex);
 	}
 }
@@ -97,6 +97,14 @@ namespace EmEn::Graphics::RenderableInstance
 				return m_cartesianFrame.position();
 			}
 
+			/** @copydoc EmEn::Graphics::RenderableInstance::Abstract::worldCoordinates() */
+			[[nodiscard]]
+			Libs::Math::CartesianFrame< float >
+			worldCoordinates () const noexcept override
+			{
+				return m_cartesianFrame;
+			}
+
 			/**
 			 * @brief Updates the renderable instance cartesian frame.
 			 * @note The coordinates of the frame expected to be absolute.
@@ -123,7 +131,7 @@ namespace EmEn::Graphics::RenderableInstance
 			}
 
 			/** @copydoc EmEn::Graphics::RenderableInstance::Abstract::bindInstanceModelLayer() */
-			void bindInstanceModelLayer (const Vulkan::CommandBuffer & commandBuffer, uint32_t layerIndex) const noexcept override;
+			void bindInstanceModelLayer (const Vulkan::CommandBuffer & commandBuffer, const Geometry::Interface & geometry, uint32_t layerIndex) const noexcept override;
 
 			Libs::Math::CartesianFrame< float > m_cartesianFrame;
 	};
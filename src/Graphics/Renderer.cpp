@@ -30,9 +30,13 @@
 #include "emeraude_config.hpp"
 
 /* STL inclusions. */
+#include <algorithm>
+#include <atomic>
+#include <chrono>
 #include <exception>
 #include <iostream>
 #include <ranges>
+#include <sstream>
 
 /* Local inclusions. */
 #include "Libs/Time/Elapsed/PrintScopeRealTime.hpp"
@@ -41,6 +45,7 @@
 #include "Vulkan/Queue.hpp"
 #include "Vulkan/DescriptorPool.hpp"
 #include "Vulkan/GraphicsPipeline.hpp"
+#include "Vulkan/PipelineCache.hpp"
 #include "Vulkan/CommandPool.hpp"
 #include "Vulkan/CommandBuffer.hpp"
 #include "Vulkan/Framebuffer.hpp"
@@ -51,6 +56,7 @@
 #include "Vulkan/Types.hpp"
 #include "Scenes/Scene.hpp"
 #include "Core.hpp"
+#include "FrameProfiler.hpp"
 #include "PrimaryServices.hpp"
 #include "Window.hpp"
 
@@ -213,6 +219,30 @@ namespace EmEn::Graphics
 			return false;
 		}
 
+		/* NOTE: The block compressed textures are kept between runs. */
+		m_textureCache.setDirectory(m_primaryServices.fileSystem().cacheDirectory(TextureCacheDirectory));
+
+		/* NOTE: The driver pipeline compilations are kept between runs when the cache is enabled. */
+		{
+			auto & settings = m_primaryServices.settings();
+
+			const auto directory = settings.get< bool >(PipelineCacheEnabledKey, DefaultPipelineCacheEnabled) ?
+				m_primaryServices.fileSystem().cacheDirectory(PipelineCacheDirectory) :
+				std::filesystem::path{};
+
+			m_pipelineCache = std::make_shared< PipelineCache >(m_device, directory);
+			m_pipelineCache->setIdentifier(ClassId, "Main", "PipelineCache");
+
+			if ( !m_pipelineCache->createOnHardware() )
+			{
+				Tracer::warning(ClassId, "Unable to create the pipeline cache, the pipelines will be created without it !");
+
+				m_pipelineCache.reset();
+			}
+
+			m_flags[PipelinePrewarmEnabled] = settings.get< bool >(PipelinePrewarmEnabledKey, DefaultPipelinePrewarmEnabled);
+		}
+
 		/* NOTE: Create the swap-chain for presenting images to screen. */
 		{
 			m_swapChain = std::make_shared< SwapChain >(m_device, m_primaryServices.settings(), m_window);
@@ -343,6 +373,14 @@ namespace EmEn::Graphics
 				pipeline->destroyFromHardware();
 			}
 			m_pipelines.clear();
+			m_pendingPipelines.clear();
+
+			if ( m_pipelineCache != nullptr )
+			{
+				m_pipelineCache->save();
+				m_pipelineCache->destroyFromHardware();
+				m_pipelineCache.reset();
+			}
 		}
 
 		this->destroyCommandSystem();
@@ -385,7 +423,61 @@ namespace EmEn::Graphics
 	void
 	Renderer::onRegisterToConsole () noexcept
 	{
+		this->bindCommand("memoryStatistics", [this] (const Console::Arguments & /*arguments*/, Console::Outputs & outputs) {
+			if ( m_device == nullptr )
+			{
+				outputs.emplace_back(Severity::Error, "There is no device !");
+
+				return 1;
+			}
+
+			const auto & memoryAllocator = m_device->memoryAllocator();
+
+			std::stringstream output;
+			output << "Device memory allocations : " << memoryAllocator.deviceAllocationCount() << '\n';
+
+			for ( const auto & statistics : memoryAllocator.getStatistics() )
+			{
+				output <<
+					"Memory type #" << statistics.memoryTypeIndex << ( statistics.linear ? " (linear)" : " (optimal)" ) << " : " <<
+					statistics.allocationCount << " allocations, " <<
+					statistics.blockCount << " blocks, " <<
+					statistics.dedicatedCount << " dedicated, " <<
+					statistics.usedBytes << " / " << statistics.reservedBytes << " bytes used, "
+					"largest free block " << statistics.largestFreeBlock << " bytes, "
+					"fragmentation " << statistics.fragmentation * 100.0F << "%\n";
+			}
+
+			outputs.emplace_back(Severity::Info, output.str());
+
+			return 0;
+		}, "Print the device memory usage per memory type.");
+
+		this->bindCommand("pipelineStatistics", [this] (const Console::Arguments & /*arguments*/, Console::Outputs & outputs) {
+			const auto hits = m_rendererStatistics.pipelineCacheHits();
+			const auto misses = m_rendererStatistics.pipelineCacheMisses();
+			const auto creationCount = hits + misses;
+
+			std::stringstream output;
+			output <<
+				"Graphics pipelines created : " << creationCount << " (" << hits << " cache hits, " << misses << " cache misses)" "\n"
+				"Total creation time : " << static_cast< double >(m_rendererStatistics.pipelineCreationTime()) / 1000000.0 << " ms" "\n"
+				"Longest creation time : " << static_cast< double >(m_rendererStatistics.longestPipelineCreationTime()) / 1000000.0 << " ms";
+
+			if ( creationCount > 0 )
+			{
+				output << "\n" "Average creation time : " << static_cast< double >(m_rendererStatistics.pipelineCreationTime()) / static_cast< double >(creationCount) / 1000000.0 << " ms";
+			}
+
+			if ( m_pipelineCache != nullptr && !m_pipelineCache->filepath().empty() )
+			{
+				output << "\n" "Pipeline cache file : " << m_pipelineCache->filepath().string() << ( m_pipelineCache->isLoadedFromFile() ? " (loaded at startup)" : " (created at startup)" );
+			}
 
+			outputs.emplace_back(Severity::Info, output.str());
+
+			return 0;
+		}, "Print the graphics pipeline creation times and the pipeline cache efficiency.");
 	}
 
 	std::shared_ptr< RenderPass >
@@ -447,6 +539,8 @@ namespace EmEn::Graphics
 	bool
 	Renderer::finalizeGraphicsPipeline (const RenderTarget::Abstract & renderTarget, const Program & program, std::shared_ptr< GraphicsPipeline > & graphicsPipeline) noexcept
 	{
+		const std::lock_guard< std::mutex > lock{m_pipelinesAccess};
+
 		/* FIXME: Fake hash ! */
 		const auto hash = GraphicsPipeline::getHash();
 
@@ -459,14 +553,140 @@ namespace EmEn::Graphics
 			return true;
 		}
 
-		if ( !graphicsPipeline->finalize(renderTarget.framebuffer()->renderPass(), program.pipelineLayout(), program.useTesselation()) )
+		const auto deferCreation = m_flags[PrewarmingPipelines];
+
+		if ( !graphicsPipeline->finalize(renderTarget.framebuffer()->renderPass(), program.pipelineLayout(), program.useTesselation(), m_pipelineCache, deferCreation) )
 		{
 			return false;
 		}
 
+		if ( deferCreation )
+		{
+			m_pendingPipelines.emplace_back(graphicsPipeline);
+		}
+		else
+		{
+			m_rendererStatistics.recordPipelineCreation(graphicsPipeline->isCacheHit(), graphicsPipeline->creationDuration());
+		}
+
 		return m_pipelines.emplace(hash, graphicsPipeline).second;
 	}
 
+	void
+	Renderer::beginPipelinePrewarm () noexcept
+	{
+		const std::lock_guard< std::mutex > lock{m_pipelinesAccess};
+
+		m_flags[PrewarmingPipelines] = m_flags[PipelinePrewarmEnabled];
+
+		/* NOTE: The shaders of every program generated during the pre-warm are compiled together. */
+		if ( m_flags[PrewarmingPipelines] )
+		{
+			m_shaderManager.beginCompileQueue();
+		}
+	}
+
+	bool
+	Renderer::endPipelinePrewarm () noexcept
+	{
+		std::vector< std::shared_ptr< GraphicsPipeline > > pipelines;
+
+		{
+			const std::lock_guard< std::mutex > lock{m_pipelinesAccess};
+
+			m_flags[PrewarmingPipelines] = false;
+
+			pipelines.swap(m_pendingPipelines);
+		}
+
+		/* NOTE: The deferred pipelines need their shader modules. A pipeline with a failed shader will fail below. */
+		const auto shadersCompiled = m_shaderManager.flushCompileQueue();
+
+		if ( pipelines.empty() )
+		{
+			return shadersCompiled;
+		}
+
+		const auto start = std::chrono::steady_clock::now();
+
+		auto & jobSystem = m_primaryServices.jobSystem();
+
+		const auto taskCount = std::clamp< size_t >(jobSystem.workerCount(), 1, pipelines.size());
+
+		/* NOTE: Each task gets a private copy of the pipeline cache, so the driver does not serialize the compilations on a single cache. */
+		std::vector< std::shared_ptr< PipelineCache > > taskCaches(taskCount);
+
+		if ( m_pipelineCache != nullptr && taskCount > 1 )
+		{
+			for ( auto & taskCache : taskCaches )
+			{
+				taskCache = std::make_shared< PipelineCache >(m_device);
+				taskCache->setIdentifier(ClassId, "Prewarm", "PipelineCache");
+
+				if ( !taskCache->createOnHardware(*m_pipelineCache) )
+				{
+					taskCache.reset();
+				}
+			}
+		}
+
+		std::atomic< size_t > failureCount{0};
+
+		JobGroup jobGroup;
+
+		for ( size_t taskIndex = 0; taskIndex < taskCount; taskIndex++ )
+		{
+			jobSystem.submit([this, &pipelines, &taskCaches, &failureCount, taskIndex, taskCount] {
+				const auto * pipelineCache = taskCaches[taskIndex] != nullptr ? taskCaches[taskIndex].get() : m_pipelineCache.get();
+
+				for ( auto pipelineIndex = taskIndex; pipelineIndex < pipelines.size(); pipelineIndex += taskCount )
+				{
+					const auto & pipeline = pipelines[pipelineIndex];
+
+					if ( pipeline->createOnHardware(pipelineCache) )
+					{
+						m_rendererStatistics.recordPipelineCreation(pipeline->isCacheHit(), pipeline->creationDuration());
+					}
+					else
+					{
+						failureCount.fetch_add(1, std::memory_order_relaxed);
+					}
+				}
+			}, jobGroup, ThreadPool::Priority::High);
+		}
+
+		jobSystem.wait(jobGroup);
+
+		if ( m_pipelineCache != nullptr )
+		{
+			m_pipelineCache->merge(taskCaches);
+
+			/* NOTE: Saving right after the loading keeps the work if the application does not quit properly. */
+			m_pipelineCache->save();
+		}
+
+		for ( const auto & taskCache : taskCaches )
+		{
+			if ( taskCache != nullptr )
+			{
+				taskCache->destroyFromHardware();
+			}
+		}
+
+		const auto milliseconds = std::chrono::duration_cast< std::chrono::milliseconds >(std::chrono::steady_clock::now() - start).count();
+
+		TraceInfo{ClassId} << pipelines.size() << " graphics pipelines pre-warmed by " << taskCount << " tasks in " << milliseconds << " ms.";
+
+		if ( failureCount > 0 )
+		{
+			TraceError{ClassId} << failureCount.load() << " graphics pipelines failed to be created during the pre-warm !";
+
+			return false;
+		}
+
+		return shadersCompiled;
+	}
+
 	void
 	Renderer::renderFrame (const std::shared_ptr< Scenes::Scene > & scene, const Overlay::Manager & overlayManager) noexcept
 	{
@@ -475,6 +695,8 @@ namespace EmEn::Graphics
 			return;
 		}
 
+		const ProfileScope profileScope{"Renderer::renderFrame"};
+
 		if ( m_swapChain->status() == SwapChain::Status::Degraded )
 		{
 			TraceInfo{ClassId} << "The swap-chain is degraded !";
@@ -487,14 +709,28 @@ namespace EmEn::Graphics
 
 		m_statistics.start();
 
+		m_rendererStatistics.resetCounters();
+
 		/* First, we get an image ready to render into it. */
 		uint32_t imageIndex = 0;
 
-		if ( !m_swapChain->acquireNextImage(imageIndex) )
 		{
-			return;
+			const ProfileScope acquireProfileScope{"Renderer::acquireNextImage"};
+
+			if ( !m_swapChain->acquireNextImage(imageIndex) )
+			{
+				this->collectWithoutFrame();
+
+				return;
+			}
 		}
 
+		/* NOTE: The objects released during the frames now executed can be destroyed. */
+		m_device->destroyReleasedObjects();
+
+		/* NOTE: The uploads recorded since the last frame are submitted before any work using them. */
+		m_transferManager.submitTransfers();
+
 		/* NOTE: Clear all semaphores for the new frame. */
 		m_rendererFrameScope[imageIndex].clearSemaphores();
 
@@ -515,6 +751,8 @@ namespace EmEn::Graphics
 			this->renderViews(imageIndex, *scene);
 		}
 
+		const ProfileScope viewProfileScope{"Renderer::renderSwapChain"};
+
 		/* Then we need the command buffer linked to this image by its index. */
 		const auto commandBuffer = m_rendererFrameScope[imageIndex].commandBuffer();
 
@@ -541,6 +779,9 @@ namespace EmEn::Graphics
 			return;
 		}
 
+		/* NOTE: Resources uploaded while recording this frame may be used by it. */
+		m_transferManager.submitTransfers();
+
 		if ( !m_swapChain->submitCommandBuffer(commandBuffer, imageIndex, m_rendererFrameScope[imageIndex].secondarySemaphores()) )
 		{
 			return;
@@ -549,6 +790,31 @@ namespace EmEn::Graphics
 		m_statistics.stop();
 	}
 
+	void
+	Renderer::collectWithoutFrame () noexcept
+	{
+		/* NOTE: The uploads are still executed without frame. */
+		if ( m_device->releasedObjectCount() == 0 )
+		{
+			m_transferManager.submitTransfers();
+
+			return;
+		}
+
+		/* NOTE: Without frame, the frame timeline does not move anymore. Once the device is idle,
+		 * the frame being recorded can be closed since no work uses the released objects. */
+		m_device->waitIdle("Collecting the released objects without frame");
+
+		auto & frameTimeline = m_device->frameTimeline();
+
+		frameTimeline.complete(frameTimeline.submit());
+
+		/* NOTE: This retires the executed transfer batches, and submits the recorded uploads. */
+		m_transferManager.submitTransfers();
+
+		m_device->destroyReleasedObjects();
+	}
+
 	std::shared_ptr< CommandBuffer >
 	Renderer::getCommandBuffer (const std::shared_ptr< RenderTarget::Abstract > & renderTarget) noexcept
 	{
@@ -577,6 +843,8 @@ namespace EmEn::Graphics
 	void
 	Renderer::renderShadowMaps (uint32_t frameIndex, Scenes::Scene & scene) noexcept
 	{
+		const ProfileScope profileScope{"Renderer::renderShadowMaps"};
+
 		const auto * queue = this->device()->getQueue(QueueJob::Graphics, QueuePriority::High);
 
 		for ( const auto & shadowMap : scene.AVConsoleManager().renderToShadowMaps() )
@@ -638,6 +906,8 @@ namespace EmEn::Graphics
 	void
 	Renderer::renderRenderToTextures (uint32_t frameIndex, Scenes::Scene & scene) noexcept
 	{
+		const ProfileScope profileScope{"Renderer::renderRenderToTextures"};
+
 		const auto * queue = this->device()->getQueue(QueueJob::Graphics, QueuePriority::High);
 
 		for ( const auto & renderToTexture : scene.AVConsoleManager().renderToTextures() )
@@ -33,6 +33,7 @@
 #include <array>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <vector>
 #include <string>
 
@@ -43,6 +44,7 @@
 
 /* Local inclusions for usages. */
 #include "Libs/PixelFactory/Color.hpp"
+#include "Libs/PixelFactory/TextureCache.hpp"
 #include "Libs/Time/Statistics/RealTime.hpp"
 #include "Vulkan/LayoutManager.hpp"
 #include "Vulkan/SharedUBOManager.hpp"
@@ -50,6 +52,7 @@
 #include "RenderTarget/Abstract.hpp"
 #include "Saphir/ShaderManager.hpp"
 #include "RendererFrameScope.hpp"
+#include "RendererStatistics.hpp"
 #include "VertexBufferFormatManager.hpp"
 
 /* Forward declarations. */
@@ -64,6 +67,7 @@ namespace EmEn
 		class CommandPool;
 		class CommandBuffer;
 		class GraphicsPipeline;
+		class PipelineCache;
 		class Sampler;
 	}
 
@@ -124,6 +128,12 @@ namespace EmEn::Graphics
 			/** @brief Class identifier. */
 			static constexpr auto ClassId{"RendererService"};
 
+			/** @brief The sub-directory of the cache directory holding the block compressed textures. */
+			static constexpr auto TextureCacheDirectory{"textures"};
+
+			/** @brief The sub-directory of the cache directory holding the pipeline caches. */
+			static constexpr auto PipelineCacheDirectory{"pipelines"};
+
 			/** @brief Observable class unique identifier. */
 			static const size_t ClassUID;
 
@@ -321,6 +331,17 @@ namespace EmEn::Graphics
 				return m_transferManager;
 			}
 
+			/**
+			 * @brief Returns the reference to the block compressed texture cache.
+			 * @return Libs::PixelFactory::TextureCache &
+			 */
+			[[nodiscard]]
+			Libs::PixelFactory::TextureCache &
+			textureCache () noexcept
+			{
+				return m_textureCache;
+			}
+
 			/**
 			 * @brief Returns the reference to the layout manager.
 			 * @return Vulkan::LayoutManager &
@@ -514,6 +535,28 @@ namespace EmEn::Graphics
 				return m_statistics;
 			}
 
+			/**
+			 * @brief Returns the renderer detailed statistics (culling, draw counters, ...).
+			 * @return RendererStatistics &
+			 */
+			[[nodiscard]]
+			RendererStatistics &
+			rendererStatistics () noexcept
+			{
+				return m_rendererStatistics;
+			}
+
+			/**
+			 * @brief Returns the renderer detailed statistics (culling, draw counters, ...).
+			 * @return const RendererStatistics &
+			 */
+			[[nodiscard]]
+			const RendererStatistics &
+			rendererStatistics () const noexcept
+			{
+				return m_rendererStatistics;
+			}
+
 			/**
 			 * @brief Finalizes the graphics pipeline creation by replacing it by a similar or create and cache this new one.
 			 * @param renderTarget A reference to a render target.
@@ -524,6 +567,31 @@ namespace EmEn::Graphics
 			[[nodiscard]]
 			bool finalizeGraphicsPipeline (const RenderTarget::Abstract & renderTarget, const Saphir::Program & program, std::shared_ptr< Vulkan::GraphicsPipeline > & graphicsPipeline) noexcept;
 
+			/**
+			 * @brief Starts the pipeline pre-warm mode. The graphics pipelines finalized from now are only checked and queued.
+			 * @note This does nothing if the pre-warm is disabled by the settings.
+			 * @return void
+			 */
+			void beginPipelinePrewarm () noexcept;
+
+			/**
+			 * @brief Stops the pipeline pre-warm mode and builds the queued graphics pipelines on the job system workers.
+			 * @note Every worker uses a copy of the pipeline cache, the copies are merged back and the cache is saved.
+			 * @return bool
+			 */
+			bool endPipelinePrewarm () noexcept;
+
+			/**
+			 * @brief Returns the pipeline cache.
+			 * @return std::shared_ptr< Vulkan::PipelineCache >
+			 */
+			[[nodiscard]]
+			std::shared_ptr< Vulkan::PipelineCache >
+			pipelineCache () const noexcept
+			{
+				return m_pipelineCache;
+			}
+
 			/**
 			 * @brief Returns or creates a render pass.
 			 * @param identifier A reference to a string.
@@ -584,6 +652,12 @@ namespace EmEn::Graphics
 			[[nodiscard]]
 			bool initializeSubServices () noexcept;
 
+			/**
+			 * @brief Destroys the released device objects when no frame can be rendered (minimized window, out-of-date swap-chain).
+			 * @return void
+			 */
+			void collectWithoutFrame () noexcept;
+
 			/**
 			 * @brief @brief Returns a command buffer for a specific render target.
 			 * @param renderTarget A reference to a render target smart pointer.
@@ -639,6 +713,8 @@ namespace EmEn::Graphics
 			static constexpr auto DebugMode{1UL};
 			static constexpr auto ShadowMapsEnabled{2UL};
 			static constexpr auto RenderToTexturesEnabled{3UL};
+			static constexpr auto PipelinePrewarmEnabled{4UL};
+			static constexpr auto PrewarmingPipelines{5UL};
 
 			static Renderer * s_instance;
 
@@ -648,6 +724,7 @@ namespace EmEn::Graphics
 			std::shared_ptr< Vulkan::Device > m_device;
 			Saphir::ShaderManager m_shaderManager;
 			Vulkan::TransferManager m_transferManager;
+			Libs::PixelFactory::TextureCache m_textureCache;
 			Vulkan::LayoutManager m_layoutManager;
 			Vulkan::SharedUBOManager m_sharedUBOManager;
 			VertexBufferFormatManager m_vertexBufferFormatManager;
@@ -658,9 +735,13 @@ namespace EmEn::Graphics
 			std::shared_ptr< Vulkan::SwapChain > m_swapChain;
 			std::map< size_t, std::shared_ptr< Saphir::Program > > m_programs;
 			std::map< size_t, std::shared_ptr< Vulkan::GraphicsPipeline > > m_pipelines;
+			std::vector< std::shared_ptr< Vulkan::GraphicsPipeline > > m_pendingPipelines;
+			std::shared_ptr< Vulkan::PipelineCache > m_pipelineCache;
+			mutable std::mutex m_pipelinesAccess;
 			std::map< std::string, std::shared_ptr< Vulkan::RenderPass > > m_renderPasses;
 			std::map< size_t, std::shared_ptr< Vulkan::Sampler > > m_samplers;
 			Libs::Time::Statistics::RealTime< std::chrono::high_resolution_clock > m_statistics{30};
+			RendererStatistics m_rendererStatistics;
 			std::array< VkClearValue, 2 > m_clearColors{};
 			std::vector< ServiceInterface * > m_subServicesEnabled;
 			std::array< bool, 8 > m_flags{
@@ -668,8 +749,8 @@ namespace EmEn::Graphics
 				false/*DebugMode*/,
 				true/*ShadowMapsEnabled*/,
 				true/*RenderToTexturesEnabled*/,
-				false/*UNUSED*/,
-				false/*UNUSED*/,
+				false/*PipelinePrewarmEnabled*/,
+				false/*PrewarmingPipelines*/,
 				false/*UNUSED*/,
 				false/*UNUSED*/
 			};
@@ -129,4 +129,34 @@ namespace EmEn::Graphics
 		return std::accumulate(stat.cbegin(), stat.cend(), 0) / static_cast< double >(stat.size());*/
 		return 0;
 	}
+
+	void
+	RendererStatistics::resetCounters () noexcept
+	{
+		m_lastCounters = m_counters;
+
+		m_counters.fill(0);
+	}
+
+	void
+	RendererStatistics::recordPipelineCreation (bool cacheHit, uint64_t duration) noexcept
+	{
+		if ( cacheHit )
+		{
+			m_pipelineCacheHits.fetch_add(1, std::memory_order_relaxed);
+		}
+		else
+		{
+			m_pipelineCacheMisses.fetch_add(1, std::memory_order_relaxed);
+		}
+
+		m_pipelineCreationTime.fetch_add(duration, std::memory_order_relaxed);
+
+		auto longest = m_longestPipelineCreationTime.load(std::memory_order_relaxed);
+
+		while ( duration > longest && !m_longestPipelineCreationTime.compare_exchange_weak(longest, duration, std::memory_order_relaxed) )
+		{
+			/* NOTE: The value is reloaded by the failed exchange. */
+		}
+	}
 }
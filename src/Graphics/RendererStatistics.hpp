@@ -28,6 +28,8 @@
 
 /* STL inclusions. */
 #include <array>
+#include <atomic>
+#include <cstdint>
 #include <vector>
 
 /* Local inclusions. */
@@ -50,6 +52,22 @@ namespace EmEn::Graphics
 				Overlay = 3UL
 			};
 
+			enum class Counter : size_t
+			{
+				/* Renderable instances accepted by the culling stage for a view. */
+				VisibleObjects = 0UL,
+				/* Renderable instances rejected by the culling stage for a view. */
+				CulledObjects = 1UL,
+				/* Renderable instances accepted by the culling stage for a shadow map. */
+				VisibleShadowCasters = 2UL,
+				/* Renderable instances rejected by the culling stage for a shadow map. */
+				CulledShadowCasters = 3UL,
+				/* Draw commands recorded by the scene for every render target. */
+				DrawCalls = 4UL,
+				/* Instances drawn by these draw commands. */
+				Instances = 5UL
+			};
+
 			/** @brief Default constructor. */
 			RendererStatistics () noexcept;
 
@@ -106,12 +124,115 @@ namespace EmEn::Graphics
 			[[nodiscard]]
 			double averageGPUStatistic (Type type) const noexcept;
 
+			/**
+			 * @brief Resets every counter. This should be called at the beginning of a frame.
+			 * @return void
+			 */
+			void resetCounters () noexcept;
+
+			/**
+			 * @brief Increments a frame counter.
+			 * @param counter The counter type.
+			 * @param value The value to add. Default 1.
+			 * @return void
+			 */
+			void
+			incrementCounter (Counter counter, size_t value = 1) noexcept
+			{
+				m_counters[static_cast< size_t >(counter)] += value;
+			}
+
+			/**
+			 * @brief Returns the value of a counter for the current frame.
+			 * @param counter The counter type.
+			 * @return size_t
+			 */
+			[[nodiscard]]
+			size_t
+			counter (Counter counter) const noexcept
+			{
+				return m_counters[static_cast< size_t >(counter)];
+			}
+
+			/**
+			 * @brief Returns the value of a counter from the last completed frame.
+			 * @param counter The counter type.
+			 * @return size_t
+			 */
+			[[nodiscard]]
+			size_t
+			lastCounter (Counter counter) const noexcept
+			{
+				return m_lastCounters[static_cast< size_t >(counter)];
+			}
+
+			/**
+			 * @brief Records a graphics pipeline creation.
+			 * @note This is thread-safe, pipelines can be created by worker threads.
+			 * @param cacheHit Whether the pipeline was found in the pipeline cache.
+			 * @param duration The creation duration in nanoseconds.
+			 * @return void
+			 */
+			void recordPipelineCreation (bool cacheHit, uint64_t duration) noexcept;
+
+			/**
+			 * @brief Returns the number of pipeline creations found in the pipeline cache since the start.
+			 * @return size_t
+			 */
+			[[nodiscard]]
+			size_t
+			pipelineCacheHits () const noexcept
+			{
+				return m_pipelineCacheHits.load(std::memory_order_relaxed);
+			}
+
+			/**
+			 * @brief Returns the number of pipeline creations compiled by the driver since the start.
+			 * @return size_t
+			 */
+			[[nodiscard]]
+			size_t
+			pipelineCacheMisses () const noexcept
+			{
+				return m_pipelineCacheMisses.load(std::memory_order_relaxed);
+			}
+
+			/**
+			 * @brief Returns the cumulated pipeline creation time in nanoseconds.
+			 * @return uint64_t
+			 */
+			[[nodiscard]]
+			uint64_t
+			pipelineCreationTime () const noexcept
+			{
+				return m_pipelineCreationTime.load(std::memory_order_relaxed);
+			}
+
+			/**
+			 * @brief Returns the longest pipeline creation time in nanoseconds.
+			 * @return uint64_t
+			 */
+			[[nodiscard]]
+			uint64_t
+			longestPipelineCreationTime () const noexcept
+			{
+				return m_longestPipelineCreationTime.load(std::memory_order_relaxed);
+			}
+
 		private:
 
+			static constexpr auto CounterCount{6UL};
+
 			std::array< std::pair< Libs::Time::Elapsed::RealTime< std::chrono::high_resolution_clock >, std::vector< uint64_t > >, 4 > m_CPUStats{};
 			/* VULKAN_DEV */
 			//std::array< std::pair< QueryTimeElapsed, std::vector< unsigned long int > >, 4 > m_GPUStats{};
+			std::array< size_t, CounterCount > m_counters{};
+			std::array< size_t, CounterCount > m_lastCounters{};
 			size_t m_averageRange = 1;
 			size_t m_averageIndex = 0;
+			std::atomic< size_t > m_pipelineCacheHits{0};
+			std::atomic< size_t > m_pipelineCacheMisses{0};
+			std::atomic< uint64_t > m_pipelineCreationTime{0};
+			std::atomic< uint64_t > m_longestPipelineCreationTime{0};
 	};
 }
@@ -38,9 +38,12 @@
 #include "Graphics/ImageResource.hpp"
 #include "Graphics/Renderer.hpp"
 #include "Libs/PixelFactory/Color.hpp"
+#include "Libs/PixelFactory/CompressedTexture.hpp"
 #include "Resources/Container.hpp"
 #include "Resources/Manager.hpp"
+#include "Vulkan/Device.hpp"
 #include "Vulkan/Instance.hpp"
+#include "Vulkan/PhysicalDevice.hpp"
 #include "Vulkan/Image.hpp"
 #include "Vulkan/ImageView.hpp"
 #include "Vulkan/Sampler.hpp"
@@ -108,29 +111,33 @@ namespace EmEn::Graphics::TextureResource
 			settings.get< uint32_t >(GraphicsTextureMipMappingLevelsKey, DefaultGraphicsTextureMipMappingLevels)
 		);
 
-		/* Create a Vulkan image. */
-		m_image = std::make_shared< Image >(
-			renderer.device(),
-			VK_IMAGE_TYPE_2D,
-			Image::getFormat< uint8_t >(m_localData->data().colorCount()),
-			VkExtent3D{m_localData->width(), m_localData->height(), 1U},
-			VK_IMAGE_USAGE_SAMPLED_BIT | VK_IMAGE_USAGE_TRANSFER_SRC_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT,
-			VK_IMAGE_LAYOUT_UNDEFINED,
-			0,
-			mipLevels,
-			1,
-			VK_SAMPLE_COUNT_1_BIT,
-			VK_IMAGE_TILING_OPTIMAL
-		);
-		m_image->setIdentifier(ClassId, this->name(), "Image");
-
-		if ( !m_image->create(renderer.transferManager(), m_localData) )
+		/* NOTE: The uncompressed image gets its mip levels generated on the GPU. */
+		if ( !this->createCompressedImage(renderer, mipLevels) )
 		{
-			Tracer::error(ClassId, "Unable to create an image !");
-
-			m_image.reset();
-
-			return false;
+			/* Create a Vulkan image. */
+			m_image = std::make_shared< Image >(
+				renderer.device(),
+				VK_IMAGE_TYPE_2D,
+				Image::getFormat< uint8_t >(m_localData->data().colorCount()),
+				VkExtent3D{m_localData->width(), m_localData->height(), 1U},
+				VK_IMAGE_USAGE_SAMPLED_BIT | VK_IMAGE_USAGE_TRANSFER_SRC_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT,
+				VK_IMAGE_LAYOUT_UNDEFINED,
+				0,
+				mipLevels,
+				1,
+				VK_SAMPLE_COUNT_1_BIT,
+				VK_IMAGE_TILING_OPTIMAL
+			);
+			m_image->setIdentifier(ClassId, this->name(), "Image");
+
+			if ( !m_image->create(renderer.transferManager(), m_localData) )
+			{
+				Tracer::error(ClassId, "Unable to create an image !");
+
+				m_image.reset();
+
+				return false;
+			}
 		}
 
 		/* Create a Vulkan image view. */
@@ -168,6 +175,87 @@ namespace EmEn::Graphics::TextureResource
 		return true;
 	}
 
+	bool
+	Texture2D::createCompressedImage (Renderer & renderer, uint32_t mipLevels) noexcept
+	{
+		auto & settings = renderer.primaryServices().settings();
+
+		if ( !settings.get< bool >(GraphicsTextureCompressionEnabledKey, DefaultGraphicsTextureCompressionEnabled) )
+		{
+			return false;
+		}
+
+		if ( renderer.device()->physicalDevice()->features().textureCompressionBC == VK_FALSE )
+		{
+			return false;
+		}
+
+		const auto & pixmap = m_localData->data();
+		const auto highQuality = settings.get< bool >(GraphicsTextureCompressionHighQualityKey, DefaultGraphicsTextureCompressionHighQuality);
+
+		/* NOTE: The formats keep the channel layout of the uncompressed images.
+		 * Grayscale images are often masks or height maps, their levels are reduced linearly. */
+		PixelFactory::BlockFormat format;
+		bool gammaCorrect = true;
+
+		switch ( pixmap.channelMode() )
+		{
+			case PixelFactory::ChannelMode::Grayscale :
+				format = PixelFactory::BlockFormat::BC4;
+				gammaCorrect = false;
+				break;
+
+			case PixelFactory::ChannelMode::GrayscaleAlpha :
+				format = PixelFactory::BlockFormat::BC5;
+				gammaCorrect = false;
+				break;
+
+			case PixelFactory::ChannelMode::RGB :
+				format = highQuality ? PixelFactory::BlockFormat::BC7 : PixelFactory::BlockFormat::BC1;
+				break;
+
+			case PixelFactory::ChannelMode::RGBA :
+			default :
+				format = highQuality ? PixelFactory::BlockFormat::BC7 : PixelFactory::BlockFormat::BC3;
+				break;
+		}
+
+		PixelFactory::CompressedTexture compressedTexture;
+
+		if ( !renderer.textureCache().get(pixmap, format, mipLevels, gammaCorrect, compressedTexture) )
+		{
+			TraceWarning{ClassId} << "Unable to get the " << PixelFactory::to_cstring(format) << " version of texture '" << this->name() << "', using the uncompressed one.";
+
+			return false;
+		}
+
+		m_image = std::make_shared< Image >(
+			renderer.device(),
+			VK_IMAGE_TYPE_2D,
+			Image::getCompressedFormat(format, pixmap.hasAlphaChannel()),
+			VkExtent3D{compressedTexture.width(), compressedTexture.height(), 1U},
+			VK_IMAGE_USAGE_SAMPLED_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT,
+			VK_IMAGE_LAYOUT_UNDEFINED,
+			0,
+			compressedTexture.levelCount(),
+			1,
+			VK_SAMPLE_COUNT_1_BIT,
+			VK_IMAGE_TILING_OPTIMAL
+		);
+		m_image->setIdentifier(ClassId, this->name(), "CompressedImage");
+
+		if ( !m_image->create(renderer.transferManager(), compressedTexture) )
+		{
+			TraceWarning{ClassId} << "Unable to create the " << PixelFactory::to_cstring(format) << " image of texture '" << this->name() << "', using the uncompressed one.";
+
+			m_image.reset();
+
+			return false;
+		}
+
+		return true;
+	}
+
 	bool
 	Texture2D::destroyFromHardware () noexcept
 	{
@@ -223,6 +223,16 @@ namespace EmEn::Graphics::TextureResource
 
 		private:
 
+			/**
+			 * @brief Creates the image from the block compressed version of the local data, if the device and the settings allow it.
+			 * @note The compressed version comes from the renderer texture cache, with its mip levels computed on the CPU.
+			 * @param renderer A reference to the graphics renderer.
+			 * @param mipLevels The number of mip levels requested.
+			 * @return bool
+			 */
+			[[nodiscard]]
+			bool createCompressedImage (Renderer & renderer, uint32_t mipLevels) noexcept;
+
 			std::shared_ptr< ImageResource > m_localData;
 			std::shared_ptr< Vulkan::Image > m_image;
 			std::shared_ptr< Vulkan::ImageView > m_imageView;
@@ -69,6 +69,9 @@ namespace EmEn::Graphics
 
 		std::memcpy(&m_bufferData[ProjectionMatrixOffset], m_projection.data(), Matrix4Alignment * sizeof(float));
 
+		/* NOTE: Keep the culling volume in sync with the new projection. */
+		m_frustum.update(m_projection * m_view);
+
 		this->updateVideoMemory();
 	}
 
@@ -97,6 +100,9 @@ namespace EmEn::Graphics
 
 		std::memcpy(&m_bufferData[ProjectionMatrixOffset], m_projection.data(), Matrix4Alignment * sizeof(float));
 
+		/* NOTE: Keep the culling volume in sync with the new projection. */
+		m_frustum.update(m_projection * m_view);
+
 		this->updateVideoMemory();
 	}
 
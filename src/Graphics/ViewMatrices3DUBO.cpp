@@ -73,6 +73,14 @@ namespace EmEn::Graphics
 
 		std::memcpy(&m_bufferData[ProjectionMatrixOffset], m_projection.data(), Matrix4Alignment * sizeof(float));
 
+		/* NOTE: Keep the culling volumes in sync with the new projection. */
+		for ( auto face : CubemapFaceIndexes )
+		{
+			const auto faceIndex = static_cast< size_t >(face);
+
+			m_frustums.at(faceIndex).update(m_projection * m_views.at(faceIndex));
+		}
+
 		this->updateVideoMemory();
 	}
 
@@ -92,6 +100,14 @@ namespace EmEn::Graphics
 
 		std::memcpy(&m_bufferData[ProjectionMatrixOffset], m_projection.data(), Matrix4Alignment * sizeof(float));
 
+		/* NOTE: Keep the culling volumes in sync with the new projection. */
+		for ( auto face : CubemapFaceIndexes )
+		{
+			const auto faceIndex = static_cast< size_t >(face);
+
+			m_frustums.at(faceIndex).update(m_projection * m_views.at(faceIndex));
+		}
+
 		this->updateVideoMemory();
 	}
 
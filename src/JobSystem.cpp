@@ -0,0 +1,139 @@
+/*
+ * src/JobSystem.cpp
+ * This file is part of Emeraude-Engine
+ *
+ * Copyright (C) 2010-2025 - Sébastien Léon Claude Christian Bémelmans "LondNoir" <londnoir@gmail.com>
+ *
+ * Emeraude-Engine is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * Emeraude-Engine is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with Emeraude-Engine; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * Complete project and additional information can be found at :
+ * https://github.com/londnoir/emeraude-engine
+ *
+ * --- THIS IS AUTOMATICALLY GENERATED, DO NOT CHANGE ---
+ */
+
+#include "JobSystem.hpp"
+
+/* STL inclusions. */
+#include <algorithm>
+#include <thread>
+
+/* Local inclusions. */
+#include "PlatformSpecific/SystemInfo.hpp"
+#include "Settings.hpp"
+#include "SettingKeys.hpp"
+#include "Tracer.hpp"
+
+namespace EmEn
+{
+	using namespace EmEn::Libs;
+
+	const size_t JobSystem::ClassUID{getClassUID(ClassId)};
+
+	JobSystem::JobSystem (const PlatformSpecific::SystemInfo & systemInfo, Settings & settings) noexcept
+		: ServiceInterface(ClassId),
+		m_systemInfo(systemInfo),
+		m_settings(settings)
+	{
+
+	}
+
+	bool
+	JobSystem::onInitialize () noexcept
+	{
+		const auto workerCount = this->computeWorkerCount();
+
+		/* NOTE: The replaced pool has no worker (initial or stopped one), nothing is drained here. */
+		m_threadPool = std::make_unique< ThreadPool >(workerCount);
+
+		/* NOTE: The library code splitting its work (pixel kernels, block compression, OBJ parsing) uses the same workers. */
+		ThreadPool::setShared(m_threadPool.get());
+
+		TraceInfo{ClassId} << "Job system started with " << workerCount << " worker threads.";
+
+		m_flags[ServiceInitialized] = true;
+
+		return true;
+	}
+
+	bool
+	JobSystem::onTerminate () noexcept
+	{
+		m_flags[ServiceInitialized] = false;
+
+		ThreadPool::setShared(nullptr);
+
+		/* NOTE: The pool is kept, so the remaining jobs can still submit or wait while being drained.
+		 * Once stopped, it executes every job on the calling thread. */
+		m_threadPool->stop();
+
+		return true;
+	}
+
+	size_t
+	JobSystem::computeWorkerCount () const noexcept
+	{
+		const auto requestedCount = m_settings.get< uint32_t >(JobSystemWorkerCountKey, DefaultJobSystemWorkerCount);
+
+		if ( requestedCount > 0 )
+		{
+			return requestedCount;
+		}
+
+		size_t logicalCores = m_systemInfo.getCPUInformation().logicalCores;
+
+		if ( logicalCores == 0 )
+		{
+			logicalCores = std::thread::hardware_concurrency();
+		}
+
+		if ( logicalCores <= ReservedThreadCount )
+		{
+			return 1;
+		}
+
+		return logicalCores - ReservedThreadCount;
+	}
+
+	void
+	JobSystem::submit (ThreadPool::Job job, ThreadPool::Priority priority) noexcept
+	{
+		m_threadPool->submit(std::move(job), priority);
+	}
+
+	void
+	JobSystem::submit (ThreadPool::Job job, JobGroup & group, ThreadPool::Priority priority) noexcept
+	{
+		m_threadPool->submit(std::move(job), group, priority);
+	}
+
+	void
+	JobSystem::wait (JobGroup & group) noexcept
+	{
+		m_threadPool->wait(group);
+	}
+
+	void
+	JobSystem::parallelFor (size_t first, size_t last, const std::function< void (size_t first, size_t last) > & function, size_t grainSize, ThreadPool::Priority priority) noexcept
+	{
+		m_threadPool->parallelFor(first, last, function, grainSize, priority);
+	}
+
+	bool
+	JobSystem::execute (TaskGraph & graph) noexcept
+	{
+		return graph.execute(*m_threadPool);
+	}
+}
@@ -0,0 +1,232 @@
+/*
+ * src/JobSystem.hpp
+ * This file is part of Emeraude-Engine
+ *
+ * Copyright (C) 2010-2025 - Sébastien Léon Claude Christian Bémelmans "LondNoir" <londnoir@gmail.com>
+ *
+ * Emeraude-Engine is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * Emeraude-Engine is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with Emeraude-Engine; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * Complete project and additional information can be found at :
+ * https://github.com/londnoir/emeraude-engine
+ *
+ * --- THIS IS AUTOMATICALLY GENERATED, DO NOT CHANGE ---
+ */
+
+#pragma once
+
+/* STL inclusions. */
+#include <cstddef>
+#include <array>
+#include <memory>
+#include <functional>
+
+/* Local inclusions for inheritances. */
+#include "ServiceInterface.hpp"
+
+/* Local inclusions for usages. */
+#include "Libs/ThreadPool.hpp"
+
+/* Forward declarations. */
+namespace EmEn
+{
+	namespace PlatformSpecific
+	{
+		class SystemInfo;
+	}
+
+	class Settings;
+}
+
+namespace EmEn
+{
+	/**
+	 * @brief The job system service. This is the engine-wide work-stealing thread pool.
+	 * @note Before initialization or after termination, every job is executed inline by the calling thread.
+	 * @extends EmEn::ServiceInterface This is a service.
+	 */
+	class JobSystem final : public ServiceInterface
+	{
+		public:
+
+			/** @brief Class identifier. */
+			static constexpr auto ClassId{"JobSystemService"};
+
+			/** @brief Observable class unique identifier. */
+			static const size_t ClassUID;
+
+			/**
+			 * @brief Constructs the job system.
+			 * @param systemInfo A reference to the system info.
+			 * @param settings A reference to the settings.
+			 */
+			JobSystem (const PlatformSpecific::SystemInfo & systemInfo, Settings & settings) noexcept;
+
+			/**
+			 * @brief Copy constructor.
+			 * @param copy A reference to the copied instance.
+			 */
+			JobSystem (const JobSystem & copy) noexcept = delete;
+
+			/**
+			 * @brief Move constructor.
+			 * @param copy A reference to the copied instance.
+			 */
+			JobSystem (JobSystem && copy) noexcept = delete;
+
+			/**
+			 * @brief Copy assignment.
+			 * @param copy A reference to the copied instance.
+			 * @return JobSystem &
+			 */
+			JobSystem & operator= (const JobSystem & copy) noexcept = delete;
+
+			/**
+			 * @brief Move assignment.
+			 * @param copy A reference to the copied instance.
+			 * @return JobSystem &
+			 */
+			JobSystem & operator= (JobSystem && copy) noexcept = delete;
+
+			/**
+			 * @brief Destructs the job system.
+			 */
+			~JobSystem () override = default;
+
+			/** @copydoc EmEn::Libs::ObservableTrait::classUID() const */
+			[[nodiscard]]
+			size_t
+			classUID () const noexcept override
+			{
+				return ClassUID;
+			}
+
+			/** @copydoc EmEn::Libs::ObservableTrait::is() const */
+			[[nodiscard]]
+			bool
+			is (size_t classUID) const noexcept override
+			{
+				return classUID == ClassUID;
+			}
+
+			/** @copydoc EmEn::ServiceInterface::usable() */
+			[[nodiscard]]
+			bool
+			usable () const noexcept override
+			{
+				return m_flags[ServiceInitialized];
+			}
+
+			/**
+			 * @brief Returns the number of worker threads.
+			 * @return size_t
+			 */
+			[[nodiscard]]
+			size_t
+			workerCount () const noexcept
+			{
+				return m_threadPool->workerCount();
+			}
+
+			/**
+			 * @brief Returns whether the calling thread is one of the job system workers.
+			 * @return bool
+			 */
+			[[nodiscard]]
+			bool
+			isWorkerThread () const noexcept
+			{
+				return m_threadPool->isWorkerThread();
+			}
+
+			/**
+			 * @brief Submits a fire-and-forget job.
+			 * @param job The job [std::move].
+			 * @param priority The job priority. Default normal.
+			 * @return void
+			 */
+			void submit (Libs::ThreadPool::Job job, Libs::ThreadPool::Priority priority = Libs::ThreadPool::Priority::Normal) noexcept;
+
+			/**
+			 * @brief Submits a job attached to a group.
+			 * @param job The job [std::move].
+			 * @param group A reference to the job group.
+			 * @param priority The job priority. Default normal.
+			 * @return void
+			 */
+			void submit (Libs::ThreadPool::Job job, Libs::JobGroup & group, Libs::ThreadPool::Priority priority = Libs::ThreadPool::Priority::Normal) noexcept;
+
+			/**
+			 * @brief Waits for every job of a group, executing pending jobs meanwhile.
+			 * @param group A reference to the job group.
+			 * @return void
+			 */
+			void wait (Libs::JobGroup & group) noexcept;
+
+			/**
+			 * @brief Splits a range of indexes into chunks executed by the workers and waits for them.
+			 * @param first The first index.
+			 * @param last The index past the last one.
+			 * @param function A reference to the function receiving a sub-range [first, last[.
+			 * @param grainSize The minimum number of indexes per chunk. Default automatic.
+			 * @param priority The job priority. Default normal.
+			 * @return void
+			 */
+			void parallelFor (size_t first, size_t last, const std::function< void (size_t first, size_t last) > & function, size_t grainSize = 0, Libs::ThreadPool::Priority priority = Libs::ThreadPool::Priority::Normal) noexcept;
+
+			/**
+			 * @brief Executes a task graph on the workers and waits for its completion.
+			 * @param graph A reference to the task graph.
+			 * @return bool
+			 */
+			[[nodiscard]]
+			bool execute (Libs::TaskGraph & graph) noexcept;
+
+		private:
+
+			/** @copydoc EmEn::ServiceInterface::onInitialize() */
+			bool onInitialize () noexcept override;
+
+			/** @copydoc EmEn::ServiceInterface::onTerminate() */
+			bool onTerminate () noexcept override;
+
+			/**
+			 * @brief Returns the number of workers to create from the settings and the hardware.
+			 * @return size_t
+			 */
+			[[nodiscard]]
+			size_t computeWorkerCount () const noexcept;
+
+			/* NOTE: Threads already owned by the engine (main, logics and rendering), left to the OS scheduler. */
+			static constexpr auto ReservedThreadCount{3UL};
+
+			/* Flag names. */
+			static constexpr auto ServiceInitialized{0UL};
+
+			const PlatformSpecific::SystemInfo & m_systemInfo;
+			Settings & m_settings;
+			/* NOTE: A pool without worker, or stopped, executes jobs inline, it is used outside the service lifetime. */
+			std::unique_ptr< Libs::ThreadPool > m_threadPool{std::make_unique< Libs::ThreadPool >(0)};
+			std::array< bool, 8 > m_flags{
+				false/*ServiceInitialized*/,
+				false/*UNUSED*/,
+				false/*UNUSED*/,
+				false/*UNUSED*/,
+				false/*UNUSED*/,
+				false/*UNUSED*/,
+				false/*UNUSED*/,
+				false/*UNUSED*/
+			};
+	};
+}
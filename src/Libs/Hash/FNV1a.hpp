@@ -0,0 +1,124 @@
+/*
+ * src/Libs/Hash/FNV1a.hpp
+ * This file is part of Emeraude-Engine
+ *
+ * Copyright (C) 2010-2025 - Sébastien Léon Claude Christian Bémelmans "LondNoir" <londnoir@gmail.com>
+ *
+ * Emeraude-Engine is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * Emeraude-Engine is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with Emeraude-Engine; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * Complete project and additional information can be found at :
+ * https://github.com/londnoir/emeraude-engine
+ *
+ * --- THIS IS AUTOMATICALLY GENERATED, DO NOT CHANGE ---
+ */
+
+#pragma once
+
+/* STL inclusions. */
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+namespace EmEn::Libs::Hash
+{
+	/**
+	 * @brief The FNV-1a hash, fed with 64-bit words for speed.
+	 * @note This is a checksum for cache files, not a cryptographic hash.
+	 */
+	class FNV1a final
+	{
+		public:
+
+			static constexpr uint64_t OffsetBasis{0xCBF29CE484222325ULL};
+			static constexpr uint64_t Prime{0x100000001B3ULL};
+
+			/**
+			 * @brief Constructs a FNV-1a hash.
+			 */
+			FNV1a () noexcept = default;
+
+			/**
+			 * @brief Mixes a single value into the hash.
+			 * @param value The value.
+			 * @return void
+			 */
+			void
+			mix (uint64_t value) noexcept
+			{
+				m_hash ^= value;
+				m_hash *= Prime;
+			}
+
+			/**
+			 * @brief Mixes a memory block into the hash, by 64-bit words then the tail bytes one by one.
+			 * @param data A pointer to the data.
+			 * @param bytes The number of bytes.
+			 * @return void
+			 */
+			void
+			update (const void * data, size_t bytes) noexcept
+			{
+				const auto * bytePointer = static_cast< const uint8_t * >(data);
+				const auto wordCount = bytes / sizeof(uint64_t);
+
+				for ( size_t wordIndex = 0; wordIndex < wordCount; wordIndex++ )
+				{
+					uint64_t word = 0;
+
+					std::memcpy(&word, bytePointer + wordIndex * sizeof(uint64_t), sizeof(uint64_t));
+
+					this->mix(word);
+				}
+
+				for ( auto byteIndex = wordCount * sizeof(uint64_t); byteIndex < bytes; byteIndex++ )
+				{
+					this->mix(bytePointer[byteIndex]);
+				}
+			}
+
+			/**
+			 * @brief Returns the hash value.
+			 * @return uint64_t
+			 */
+			[[nodiscard]]
+			uint64_t
+			value () const noexcept
+			{
+				return m_hash;
+			}
+
+		private:
+
+			uint64_t m_hash{OffsetBasis};
+	};
+
+	/**
+	 * @brief Returns the FNV-1a hash of a memory block, its size included.
+	 * @param data A pointer to the data.
+	 * @param bytes The number of bytes.
+	 * @return uint64_t
+	 */
+	[[nodiscard]]
+	inline
+	uint64_t
+	fnv1a (const void * data, size_t bytes) noexcept
+	{
+		FNV1a hash;
+		hash.mix(bytes);
+		hash.update(data, bytes);
+
+		return hash.value();
+	}
+}
@@ -28,6 +28,8 @@
 
 /* STL inclusions. */
 #include <algorithm>
+#include <string>
+#include <thread>
 
 /* Platform libraries. */
 #if IS_LINUX || IS_MACOS
@@ -410,6 +412,30 @@ namespace EmEn::Libs::IO
 		return true;
 	}
 
+	bool
+	prefetchFile (const std::filesystem::path & filepath) noexcept
+	{
+		constexpr size_t ChunkSize{256UL * 1024UL};
+
+		std::ifstream file{filepath, std::ios::binary};
+
+		if ( !file.is_open() )
+		{
+			std::cerr << __PRETTY_FUNCTION__ << ", unable to read '" << filepath << "' file." "\n";
+
+			return false;
+		}
+
+		std::vector< char > chunk(ChunkSize);
+
+		while ( file.read(chunk.data(), static_cast< std::streamsize >(chunk.size())) )
+		{
+			/* NOTE: Data is dropped, only the read matters. */
+		}
+
+		return file.eof();
+	}
+
 	bool
 	filePutContents (const std::filesystem::path & filepath, const std::string & content) noexcept
 	{
@@ -428,4 +454,53 @@ namespace EmEn::Libs::IO
 
 		return true;
 	}
+
+	bool
+	writeFileAtomically (const std::filesystem::path & filepath, const std::function< bool (std::ofstream & file) > & writer, const std::function< void () > & beforeReplace) noexcept
+	{
+		auto temporaryFilepath = filepath;
+		temporaryFilepath += "." + std::to_string(std::hash< std::thread::id >{}(std::this_thread::get_id())) + ".tmp";
+
+		std::error_code errorCode;
+
+		{
+			std::ofstream file{temporaryFilepath, std::ios::binary | std::ios::trunc};
+
+			if ( !file.is_open() )
+			{
+				std::cerr << __PRETTY_FUNCTION__ << ", unable to open " << temporaryFilepath << " for writing !" "\n";
+
+				return false;
+			}
+
+			if ( !writer(file) || !file.good() )
+			{
+				std::cerr << __PRETTY_FUNCTION__ << ", unable to write the file " << temporaryFilepath << " !" "\n";
+
+				file.close();
+
+				std::filesystem::remove(temporaryFilepath, errorCode);
+
+				return false;
+			}
+		}
+
+		if ( beforeReplace )
+		{
+			beforeReplace();
+		}
+
+		std::filesystem::rename(temporaryFilepath, filepath, errorCode);
+
+		if ( errorCode )
+		{
+			std::cerr << __PRETTY_FUNCTION__ << ", unable to rename " << temporaryFilepath << " to " << filepath << " (" << errorCode.message() << ") !" "\n";
+
+			std::filesystem::remove(temporaryFilepath, errorCode);
+
+			return false;
+		}
+
+		return true;
+	}
 }
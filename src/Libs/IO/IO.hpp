@@ -30,7 +30,9 @@
 #include "emeraude_config.hpp"
 
 /* STL inclusions. */
+#include <cstdint>
 #include <filesystem>
+#include <functional>
 #include <iostream>
 #include <fstream>
 #include <vector>
@@ -43,6 +45,22 @@ namespace EmEn::Libs::IO
 	constexpr char Separator = '/';
 #endif
 
+	/** @brief Written as is in the header of the engine binary files to detect a file produced on a machine with another byte order. */
+	constexpr uint32_t ByteOrderMark{0x01020304};
+
+	/**
+	 * @brief Checks the byte order mark read from a binary file header.
+	 * @param byteOrderMark The value read from the file.
+	 * @return bool
+	 */
+	[[nodiscard]]
+	constexpr
+	bool
+	isNativeByteOrder (uint32_t byteOrderMark) noexcept
+	{
+		return byteOrderMark == ByteOrderMark;
+	}
+
 	/**
 	 * @brief Checks if the directory exists on disk.
 	 * @param filepath A reference to a filesystem path.
@@ -171,6 +189,14 @@ namespace EmEn::Libs::IO
 	 */
 	bool fileGetContents (const std::filesystem::path & filepath, std::string & content) noexcept;
 
+	/**
+	 * @brief Reads a whole file without keeping the data, to bring it into the operating system file cache.
+	 * @note This lets a later reader open the file without waiting for the storage device.
+	 * @param filepath A reference to a filesystem path.
+	 * @return bool
+	 */
+	bool prefetchFile (const std::filesystem::path & filepath) noexcept;
+
 	/**
 	 * @brief Writes a string to a file.
 	 * @param filepath A reference to a filesystem path.
@@ -179,6 +205,16 @@ namespace EmEn::Libs::IO
 	 */
 	bool filePutContents (const std::filesystem::path & filepath, const std::string & content) noexcept;
 
+	/**
+	 * @brief Writes a file through a temporary file renamed over the destination, so a reader never sees a partial file.
+	 * @note The temporary filename holds the thread identifier to keep two concurrent writers of the same file apart.
+	 * @param filepath A reference to a filesystem path.
+	 * @param writer A reference to the function writing the content into the temporary file stream.
+	 * @param beforeReplace A reference to a function called just before the destination is replaced. Default none.
+	 * @return bool
+	 */
+	bool writeFileAtomically (const std::filesystem::path & filepath, const std::function< bool (std::ofstream & file) > & writer, const std::function< void () > & beforeReplace = {}) noexcept;
+
 	/**
 	 * @brief Reads a file and returns the binary content into a std::vector.
 	 * @tparam data_t The type of data.
@@ -0,0 +1,405 @@
+/*
+ * src/Libs/IO/IndexedArchive.cpp
+ * This file is part of Emeraude-Engine
+ *
+ * Copyright (C) 2010-2025 - Sébastien Léon Claude Christian Bémelmans "LondNoir" <londnoir@gmail.com>
+ *
+ * Emeraude-Engine is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * Emeraude-Engine is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with Emeraude-Engine; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * Complete project and additional information can be found at :
+ * https://github.com/londnoir/emeraude-engine
+ *
+ * --- THIS IS AUTOMATICALLY GENERATED, DO NOT CHANGE ---
+ */
+
+#include "IndexedArchive.hpp"
+
+/* STL inclusions. */
+#include <algorithm>
+#include <fstream>
+#include <iostream>
+#include <ranges>
+#include <system_error>
+
+/* Local inclusions. */
+#include "Libs/Hash/FNV1a.hpp"
+#include "IO.hpp"
+
+namespace EmEn::Libs::IO
+{
+	bool
+	IndexedArchive::open (const std::filesystem::path & filepath) noexcept
+	{
+		const std::lock_guard< std::mutex > lock{m_access};
+
+		m_file.close();
+		m_mappedEntryCount = 0;
+		m_dataOffset = 0;
+		m_pendingEntries.clear();
+
+		m_filepath = filepath;
+
+		std::error_code errorCode;
+
+		if ( !std::filesystem::exists(m_filepath, errorCode) )
+		{
+			return false;
+		}
+
+		return this->map();
+	}
+
+	void
+	IndexedArchive::close () noexcept
+	{
+		const std::lock_guard< std::mutex > lock{m_access};
+
+		m_file.close();
+		m_mappedEntryCount = 0;
+		m_dataOffset = 0;
+		m_pendingEntries.clear();
+		m_filepath.clear();
+	}
+
+	bool
+	IndexedArchive::contains (uint64_t key) const noexcept
+	{
+		const std::lock_guard< std::mutex > lock{m_access};
+
+		if ( m_pendingEntries.contains(key) )
+		{
+			return true;
+		}
+
+		IndexEntry entry{};
+
+		return this->findMapped(key, entry);
+	}
+
+	size_t
+	IndexedArchive::entryCount () const noexcept
+	{
+		const std::lock_guard< std::mutex > lock{m_access};
+
+		auto count = m_mappedEntryCount;
+
+		for ( const auto & key : m_pendingEntries | std::views::keys )
+		{
+			IndexEntry entry{};
+
+			if ( !this->findMapped(key, entry) )
+			{
+				count++;
+			}
+		}
+
+		return count;
+	}
+
+	void
+	IndexedArchive::put (uint64_t key, const void * data, size_t bytes) noexcept
+	{
+		const auto * first = static_cast< const char * >(data);
+
+		std::vector< char > entry(first, first + bytes);
+
+		const std::lock_guard< std::mutex > lock{m_access};
+
+		m_pendingEntries.insert_or_assign(key, std::move(entry));
+	}
+
+	bool
+	IndexedArchive::write () noexcept
+	{
+		const std::lock_guard< std::mutex > lock{m_access};
+
+		if ( m_filepath.empty() )
+		{
+			std::cerr << __PRETTY_FUNCTION__ << ", the archive has no file !" "\n";
+
+			return false;
+		}
+
+		/* NOTE: Build the sorted index of the new file, the pending entries replace the mapped ones. */
+		std::vector< IndexEntry > index;
+		index.reserve(m_mappedEntryCount + m_pendingEntries.size());
+
+		for ( size_t position = 0; position < m_mappedEntryCount; position++ )
+		{
+			const auto entry = this->mappedEntry(position);
+
+			if ( !m_pendingEntries.contains(entry.key) )
+			{
+				index.emplace_back(entry);
+			}
+		}
+
+		for ( const auto & [key, data] : m_pendingEntries )
+		{
+			index.emplace_back(IndexEntry{key, 0, data.size(), computeChecksum(data.data(), data.size())});
+		}
+
+		std::ranges::sort(index, [] (const IndexEntry & entryA, const IndexEntry & entryB) {
+			return entryA.key < entryB.key;
+		});
+
+		/* NOTE: Resolve the source of each entry before the offsets are rewritten. */
+		std::vector< const char * > sources(index.size(), nullptr);
+
+		for ( size_t position = 0; position < index.size(); position++ )
+		{
+			const auto pendingIt = m_pendingEntries.find(index[position].key);
+
+			if ( pendingIt != m_pendingEntries.cend() )
+			{
+				sources[position] = pendingIt->second.data();
+			}
+			else
+			{
+				sources[position] = m_file.data() + m_dataOffset + index[position].offset;
+			}
+		}
+
+		uint64_t dataBytes = 0;
+
+		for ( auto & entry : index )
+		{
+			entry.offset = dataBytes;
+
+			dataBytes += (entry.bytes + EntryAlignment - 1) / EntryAlignment * EntryAlignment;
+		}
+
+		const FileHeader header{
+			.magic = Magic,
+			.version = Version,
+			.byteOrderMark = ByteOrderMark,
+			.entryCount = index.size(),
+			.dataBytes = dataBytes,
+			.indexChecksum = computeChecksum(index.data(), index.size() * sizeof(IndexEntry)),
+			.reserved = 0
+		};
+
+		std::error_code errorCode;
+
+		if ( m_filepath.has_parent_path() )
+		{
+			std::filesystem::create_directories(m_filepath.parent_path(), errorCode);
+		}
+
+		const auto written = writeFileAtomically(m_filepath, [&] (std::ofstream & file) {
+			static constexpr std::array< char, EntryAlignment > Zeros{};
+
+			file.write(reinterpret_cast< const char * >(&header), sizeof(FileHeader));
+			file.write(reinterpret_cast< const char * >(index.data()), static_cast< std::streamsize >(index.size() * sizeof(IndexEntry)));
+
+			for ( size_t position = 0; position < index.size(); position++ )
+			{
+				const auto bytes = index[position].bytes;
+
+				file.write(sources[position], static_cast< std::streamsize >(bytes));
+				file.write(Zeros.data(), static_cast< std::streamsize >((EntryAlignment - bytes % EntryAlignment) % EntryAlignment));
+			}
+
+			return true;
+		}, [this] () {
+			/* NOTE: The old mapping must be released before the file is replaced. */
+			m_file.close();
+			m_mappedEntryCount = 0;
+			m_dataOffset = 0;
+		});
+
+		if ( !written )
+		{
+			/* NOTE: The pending entries are kept, only the previous file is mapped again. */
+			if ( !m_file.isOpen() )
+			{
+				this->map();
+			}
+
+			return false;
+		}
+
+		m_pendingEntries.clear();
+
+		return this->map();
+	}
+
+	void
+	IndexedArchive::clear () noexcept
+	{
+		const std::lock_guard< std::mutex > lock{m_access};
+
+		m_file.close();
+		m_mappedEntryCount = 0;
+		m_dataOffset = 0;
+		m_pendingEntries.clear();
+
+		if ( !m_filepath.empty() )
+		{
+			std::error_code errorCode;
+
+			std::filesystem::remove(m_filepath, errorCode);
+		}
+	}
+
+	bool
+	IndexedArchive::map () noexcept
+	{
+		if ( !m_file.open(m_filepath) )
+		{
+			return false;
+		}
+
+		const auto reject = [this, function = __PRETTY_FUNCTION__] (const char * reason) {
+			std::cerr << function << ", the archive " << m_filepath << " " << reason << " !" "\n";
+
+			m_file.close();
+
+			return false;
+		};
+
+		if ( m_file.size() < sizeof(FileHeader) )
+		{
+			return reject("is too small");
+		}
+
+		FileHeader header{};
+		std::memcpy(&header, m_file.data(), sizeof(FileHeader));
+
+		if ( header.magic != Magic || !isNativeByteOrder(header.byteOrderMark) )
+		{
+			return reject("is not an indexed archive");
+		}
+
+		/* NOTE: An older version is not an error, the archive will be rebuilt. */
+		if ( header.version != Version )
+		{
+			m_file.close();
+
+			return false;
+		}
+
+		const auto available = m_file.size() - sizeof(FileHeader);
+
+		if ( header.entryCount > available / sizeof(IndexEntry) || header.dataBytes != available - header.entryCount * sizeof(IndexEntry) )
+		{
+			return reject("is truncated");
+		}
+
+		const auto indexBytes = header.entryCount * sizeof(IndexEntry);
+
+		if ( computeChecksum(m_file.data() + sizeof(FileHeader), indexBytes) != header.indexChecksum )
+		{
+			return reject("has a corrupted index");
+		}
+
+		m_mappedEntryCount = header.entryCount;
+		m_dataOffset = sizeof(FileHeader) + indexBytes;
+
+		for ( size_t position = 0; position < m_mappedEntryCount; position++ )
+		{
+			const auto entry = this->mappedEntry(position);
+
+			if ( entry.offset > header.dataBytes || entry.bytes > header.dataBytes - entry.offset )
+			{
+				m_mappedEntryCount = 0;
+				m_dataOffset = 0;
+
+				return reject("has an entry out of bounds");
+			}
+		}
+
+		return true;
+	}
+
+	IndexedArchive::IndexEntry
+	IndexedArchive::mappedEntry (size_t index) const noexcept
+	{
+		IndexEntry entry{};
+
+		std::memcpy(&entry, m_file.data() + sizeof(FileHeader) + index * sizeof(IndexEntry), sizeof(IndexEntry));
+
+		return entry;
+	}
+
+	bool
+	IndexedArchive::findMapped (uint64_t key, IndexEntry & entry) const noexcept
+	{
+		size_t first = 0;
+		size_t last = m_mappedEntryCount;
+
+		while ( first < last )
+		{
+			const auto middle = first + (last - first) / 2;
+
+			entry = this->mappedEntry(middle);
+
+			if ( entry.key == key )
+			{
+				return true;
+			}
+
+			if ( entry.key < key )
+			{
+				first = middle + 1;
+			}
+			else
+			{
+				last = middle;
+			}
+		}
+
+		return false;
+	}
+
+	bool
+	IndexedArchive::find (uint64_t key, const char * & data, size_t & bytes) const noexcept
+	{
+		const auto pendingIt = m_pendingEntries.find(key);
+
+		if ( pendingIt != m_pendingEntries.cend() )
+		{
+			data = pendingIt->second.data();
+			bytes = pendingIt->second.size();
+
+			return true;
+		}
+
+		IndexEntry entry{};
+
+		if ( !this->findMapped(key, entry) )
+		{
+			return false;
+		}
+
+		data = m_file.data() + m_dataOffset + entry.offset;
+		bytes = entry.bytes;
+
+		if ( computeChecksum(data, bytes) != entry.checksum )
+		{
+			std::cerr << __PRETTY_FUNCTION__ << ", the entry " << key << " of the archive " << m_filepath << " is corrupted !" "\n";
+
+			return false;
+		}
+
+		return true;
+	}
+
+	uint64_t
+	IndexedArchive::computeChecksum (const void * data, size_t bytes) noexcept
+	{
+		return Hash::fnv1a(data, bytes);
+	}
+}
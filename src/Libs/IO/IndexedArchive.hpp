@@ -0,0 +1,297 @@
+/*
+ * src/Libs/IO/IndexedArchive.hpp
+ * This file is part of Emeraude-Engine
+ *
+ * Copyright (C) 2010-2025 - Sébastien Léon Claude Christian Bémelmans "LondNoir" <londnoir@gmail.com>
+ *
+ * Emeraude-Engine is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * Emeraude-Engine is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with Emeraude-Engine; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * Complete project and additional information can be found at :
+ * https://github.com/londnoir/emeraude-engine
+ *
+ * --- THIS IS AUTOMATICALLY GENERATED, DO NOT CHANGE ---
+ */
+
+#pragma once
+
+/* STL inclusions. */
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <map>
+#include <mutex>
+#include <vector>
+
+/* Local inclusions for usages. */
+#include "MappedFile.hpp"
+
+namespace EmEn::Libs::IO
+{
+	/**
+	 * @brief A single file holding binary entries indexed by a 64-bit key.
+	 * @note The file is memory-mapped and the index is sorted, so opening an archive does not read the entries.
+	 * Every entry and the index are checksummed. New entries are kept in memory until the archive is written.
+	 * The class is thread-safe.
+	 */
+	class IndexedArchive final
+	{
+		public:
+
+			/** @brief Class identifier. */
+			static constexpr auto ClassId{"IndexedArchive"};
+
+			/**
+			 * @brief Constructs an indexed archive.
+			 */
+			IndexedArchive () noexcept = default;
+
+			/**
+			 * @brief Copy constructor.
+			 * @param copy A reference to the copied instance.
+			 */
+			IndexedArchive (const IndexedArchive & copy) noexcept = delete;
+
+			/**
+			 * @brief Move constructor.
+			 * @param copy A reference to the copied instance.
+			 */
+			IndexedArchive (IndexedArchive && copy) noexcept = delete;
+
+			/**
+			 * @brief Copy assignment.
+			 * @param copy A reference to the copied instance.
+			 * @return IndexedArchive &
+			 */
+			IndexedArchive & operator= (const IndexedArchive & copy) noexcept = delete;
+
+			/**
+			 * @brief Move assignment.
+			 * @param copy A reference to the copied instance.
+			 * @return IndexedArchive &
+			 */
+			IndexedArchive & operator= (IndexedArchive && copy) noexcept = delete;
+
+			/**
+			 * @brief Destructs the indexed archive.
+			 */
+			~IndexedArchive () = default;
+
+			/**
+			 * @brief Opens an archive file.
+			 * @note The filepath is kept for write() even if the file does not exist or is invalid, the archive is then empty.
+			 * @param filepath A reference to a filesystem path.
+			 * @return bool
+			 */
+			bool open (const std::filesystem::path & filepath) noexcept;
+
+			/**
+			 * @brief Closes the archive and drops the entries not written.
+			 * @return void
+			 */
+			void close () noexcept;
+
+			/**
+			 * @brief Returns the archive filepath.
+			 * @return std::filesystem::path
+			 */
+			[[nodiscard]]
+			std::filesystem::path
+			filepath () const noexcept
+			{
+				const std::lock_guard< std::mutex > lock{m_access};
+
+				return m_filepath;
+			}
+
+			/**
+			 * @brief Returns whether an entry exists.
+			 * @param key The entry key.
+			 * @return bool
+			 */
+			[[nodiscard]]
+			bool contains (uint64_t key) const noexcept;
+
+			/**
+			 * @brief Returns the number of entries, including those not written yet.
+			 * @return size_t
+			 */
+			[[nodiscard]]
+			size_t entryCount () const noexcept;
+
+			/**
+			 * @brief Returns whether some entries are not written yet.
+			 * @return bool
+			 */
+			[[nodiscard]]
+			bool
+			hasPendingEntries () const noexcept
+			{
+				const std::lock_guard< std::mutex > lock{m_access};
+
+				return !m_pendingEntries.empty();
+			}
+
+			/**
+			 * @brief Gets a copy of an entry.
+			 * @note A corrupted entry is reported as missing.
+			 * @tparam data_t The type of element. Default uint8_t.
+			 * @param key The entry key.
+			 * @param data A reference to a vector.
+			 * @return bool
+			 */
+			template< typename data_t = uint8_t >
+			bool
+			get (uint64_t key, std::vector< data_t > & data) const noexcept
+			{
+				const std::lock_guard< std::mutex > lock{m_access};
+
+				const char * bytes = nullptr;
+				size_t byteCount = 0;
+
+				if ( !this->find(key, bytes, byteCount) || byteCount % sizeof(data_t) != 0 )
+				{
+					return false;
+				}
+
+				data.resize(byteCount / sizeof(data_t));
+
+				std::memcpy(data.data(), bytes, byteCount);
+
+				return true;
+			}
+
+			/**
+			 * @brief Adds or replaces an entry.
+			 * @tparam data_t The type of element.
+			 * @param key The entry key.
+			 * @param data A reference to a vector.
+			 * @return void
+			 */
+			template< typename data_t >
+			void
+			put (uint64_t key, const std::vector< data_t > & data) noexcept
+			{
+				this->put(key, data.data(), data.size() * sizeof(data_t));
+			}
+
+			/**
+			 * @brief Adds or replaces an entry.
+			 * @param key The entry key.
+			 * @param data A pointer to the data.
+			 * @param bytes The data size in bytes.
+			 * @return void
+			 */
+			void put (uint64_t key, const void * data, size_t bytes) noexcept;
+
+			/**
+			 * @brief Writes every entry into the archive file and maps it again.
+			 * @note The archive is written to a temporary file first, so a reader never sees a partial archive.
+			 * @return bool
+			 */
+			bool write () noexcept;
+
+			/**
+			 * @brief Removes every entry and the archive file.
+			 * @return void
+			 */
+			void clear () noexcept;
+
+		private:
+
+			/**
+			 * @brief The archive file header.
+			 */
+			struct FileHeader
+			{
+				std::array< char, 8 > magic;
+				uint32_t version;
+				uint32_t byteOrderMark;
+				uint64_t entryCount;
+				uint64_t dataBytes;
+				uint64_t indexChecksum;
+				uint64_t reserved;
+			};
+
+			static_assert(sizeof(FileHeader) == 48);
+
+			/**
+			 * @brief An index entry, the index is sorted by key.
+			 */
+			struct IndexEntry
+			{
+				uint64_t key;
+				uint64_t offset;
+				uint64_t bytes;
+				uint64_t checksum;
+			};
+
+			static_assert(sizeof(IndexEntry) == 32);
+
+			/**
+			 * @brief Maps the archive file and checks the header and the index.
+			 * @return bool
+			 */
+			bool map () noexcept;
+
+			/**
+			 * @brief Returns an index entry of the mapped file.
+			 * @param index The position in the index.
+			 * @return IndexEntry
+			 */
+			[[nodiscard]]
+			IndexEntry mappedEntry (size_t index) const noexcept;
+
+			/**
+			 * @brief Searches the mapped index for a key.
+			 * @param key The entry key.
+			 * @param entry A reference to an index entry to complete.
+			 * @return bool
+			 */
+			[[nodiscard]]
+			bool findMapped (uint64_t key, IndexEntry & entry) const noexcept;
+
+			/**
+			 * @brief Finds an entry data, pending entries first.
+			 * @param key The entry key.
+			 * @param data A reference to a pointer to set.
+			 * @param bytes A reference to the size to set.
+			 * @return bool
+			 */
+			[[nodiscard]]
+			bool find (uint64_t key, const char * & data, size_t & bytes) const noexcept;
+
+			/**
+			 * @brief Returns the checksum of a memory block.
+			 * @param data A pointer to the data.
+			 * @param bytes The data size in bytes.
+			 * @return uint64_t
+			 */
+			[[nodiscard]]
+			static uint64_t computeChecksum (const void * data, size_t bytes) noexcept;
+
+			static constexpr std::array< char, 8 > Magic{'E', 'M', 'A', 'R', 'C', '\0', '\r', '\n'};
+			static constexpr uint32_t Version{1};
+			static constexpr uint64_t EntryAlignment{16};
+
+			std::filesystem::path m_filepath;
+			MappedFile m_file;
+			size_t m_mappedEntryCount{0};
+			size_t m_dataOffset{0};
+			std::map< uint64_t, std::vector< char > > m_pendingEntries;
+			mutable std::mutex m_access;
+	};
+}
@@ -0,0 +1,215 @@
+/*
+ * src/Libs/IO/MappedFile.cpp
+ * This file is part of Emeraude-Engine
+ *
+ * Copyright (C) 2010-2025 - Sébastien Léon Claude Christian Bémelmans "LondNoir" <londnoir@gmail.com>
+ *
+ * Emeraude-Engine is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * Emeraude-Engine is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with Emeraude-Engine; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * Complete project and additional information can be found at :
+ * https://github.com/londnoir/emeraude-engine
+ *
+ * --- THIS IS AUTOMATICALLY GENERATED, DO NOT CHANGE ---
+ */
+
+#include "MappedFile.hpp"
+
+/* STL inclusions. */
+#include <iostream>
+
+/* Platform libraries. */
+#if IS_LINUX || IS_MACOS
+	#include <fcntl.h>
+	#include <sys/mman.h>
+	#include <sys/stat.h>
+	#include <unistd.h>
+#endif
+
+#if IS_WINDOWS
+	#include <Windows.h>
+#endif
+
+namespace EmEn::Libs::IO
+{
+	MappedFile::~MappedFile ()
+	{
+		this->close();
+	}
+
+#if IS_WINDOWS
+	bool
+	MappedFile::open (const std::filesystem::path & filepath) noexcept
+	{
+		this->close();
+
+		auto * fileHandle = CreateFileW(filepath.wstring().c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+
+		if ( fileHandle == INVALID_HANDLE_VALUE )
+		{
+			std::cerr << ClassId << " : Unable to open the file " << filepath << " !" "\n";
+
+			return false;
+		}
+
+		LARGE_INTEGER fileSize{};
+
+		if ( GetFileSizeEx(fileHandle, &fileSize) == 0 )
+		{
+			std::cerr << ClassId << " : Unable to get the size of the file " << filepath << " !" "\n";
+
+			CloseHandle(fileHandle);
+
+			return false;
+		}
+
+		m_fileHandle = fileHandle;
+		m_size = static_cast< size_t >(fileSize.QuadPart);
+		m_isOpen = true;
+
+		/* NOTE: An empty file cannot be mapped. */
+		if ( m_size == 0 )
+		{
+			return true;
+		}
+
+		m_mappingHandle = CreateFileMappingW(fileHandle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+
+		if ( m_mappingHandle == nullptr )
+		{
+			std::cerr << ClassId << " : Unable to create the mapping of the file " << filepath << " !" "\n";
+
+			this->close();
+
+			return false;
+		}
+
+		m_data = static_cast< const char * >(MapViewOfFile(m_mappingHandle, FILE_MAP_READ, 0, 0, 0));
+
+		if ( m_data == nullptr )
+		{
+			std::cerr << ClassId << " : Unable to map the file " << filepath << " !" "\n";
+
+			this->close();
+
+			return false;
+		}
+
+		return true;
+	}
+
+	void
+	MappedFile::close () noexcept
+	{
+		if ( m_data != nullptr )
+		{
+			UnmapViewOfFile(m_data);
+
+			m_data = nullptr;
+		}
+
+		if ( m_mappingHandle != nullptr )
+		{
+			CloseHandle(m_mappingHandle);
+
+			m_mappingHandle = nullptr;
+		}
+
+		if ( m_fileHandle != nullptr )
+		{
+			CloseHandle(m_fileHandle);
+
+			m_fileHandle = nullptr;
+		}
+
+		m_size = 0;
+		m_isOpen = false;
+	}
+#else
+	bool
+	MappedFile::open (const std::filesystem::path & filepath) noexcept
+	{
+		this->close();
+
+		const auto fileDescriptor = ::open(filepath.c_str(), O_RDONLY);
+
+		if ( fileDescriptor < 0 )
+		{
+			std::cerr << ClassId << " : Unable to open the file " << filepath << " !" "\n";
+
+			return false;
+		}
+
+		struct stat fileStatus{};
+
+		if ( fstat(fileDescriptor, &fileStatus) != 0 )
+		{
+			std::cerr << ClassId << " : Unable to get the size of the file " << filepath << " !" "\n";
+
+			::close(fileDescriptor);
+
+			return false;
+		}
+
+		m_fileDescriptor = fileDescriptor;
+		m_size = static_cast< size_t >(fileStatus.st_size);
+		m_isOpen = true;
+
+		/* NOTE: An empty file cannot be mapped. */
+		if ( m_size == 0 )
+		{
+			return true;
+		}
+
+		auto * address = mmap(nullptr, m_size, PROT_READ, MAP_PRIVATE, fileDescriptor, 0);
+
+		if ( address == MAP_FAILED )
+		{
+			std::cerr << ClassId << " : Unable to map the file " << filepath << " !" "\n";
+
+			this->close();
+
+			return false;
+		}
+
+		/* NOTE: The file is expected to be read from the beginning to the end. */
+		madvise(address, m_size, MADV_SEQUENTIAL);
+
+		m_data = static_cast< const char * >(address);
+
+		return true;
+	}
+
+	void
+	MappedFile::close () noexcept
+	{
+		if ( m_data != nullptr )
+		{
+			munmap(const_cast< char * >(m_data), m_size);
+
+			m_data = nullptr;
+		}
+
+		if ( m_fileDescriptor >= 0 )
+		{
+			::close(m_fileDescriptor);
+
+			m_fileDescriptor = -1;
+		}
+
+		m_size = 0;
+		m_isOpen = false;
+	}
+#endif
+}
@@ -0,0 +1,155 @@
+/*
+ * src/Libs/IO/MappedFile.hpp
+ * This file is part of Emeraude-Engine
+ *
+ * Copyright (C) 2010-2025 - Sébastien Léon Claude Christian Bémelmans "LondNoir" <londnoir@gmail.com>
+ *
+ * Emeraude-Engine is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * Emeraude-Engine is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with Emeraude-Engine; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * Complete project and additional information can be found at :
+ * https://github.com/londnoir/emeraude-engine
+ *
+ * --- THIS IS AUTOMATICALLY GENERATED, DO NOT CHANGE ---
+ */
+
+#pragma once
+
+/* Project configuration. */
+#include "emeraude_config.hpp"
+
+/* STL inclusions. */
+#include <cstddef>
+#include <filesystem>
+#include <string_view>
+
+namespace EmEn::Libs::IO
+{
+	/**
+	 * @brief Read-only view of a whole file mapped in memory.
+	 * @note The content is read on demand by the system, without copy into a user buffer.
+	 */
+	class MappedFile final
+	{
+		public:
+
+			static constexpr auto ClassId{"MappedFile"};
+
+			/**
+			 * @brief Constructs an empty mapped file.
+			 */
+			MappedFile () noexcept = default;
+
+			/**
+			 * @brief Copy constructor.
+			 * @param copy A reference to the copied instance.
+			 */
+			MappedFile (const MappedFile & copy) noexcept = delete;
+
+			/**
+			 * @brief Move constructor.
+			 * @param copy A reference to the copied instance.
+			 */
+			MappedFile (MappedFile && copy) noexcept = delete;
+
+			/**
+			 * @brief Copy assignment.
+			 * @param copy A reference to the copied instance.
+			 * @return MappedFile &
+			 */
+			MappedFile & operator= (const MappedFile & copy) noexcept = delete;
+
+			/**
+			 * @brief Move assignment.
+			 * @param copy A reference to the copied instance.
+			 * @return MappedFile &
+			 */
+			MappedFile & operator= (MappedFile && copy) noexcept = delete;
+
+			/**
+			 * @brief Destructs the mapped file and releases the mapping.
+			 */
+			~MappedFile ();
+
+			/**
+			 * @brief Maps a file in memory.
+			 * @note An empty file is opened successfully with no content.
+			 * @param filepath A reference to a filesystem path.
+			 * @return bool
+			 */
+			bool open (const std::filesystem::path & filepath) noexcept;
+
+			/**
+			 * @brief Releases the mapping.
+			 * @return void
+			 */
+			void close () noexcept;
+
+			/**
+			 * @brief Returns whether a file is mapped.
+			 * @return bool
+			 */
+			[[nodiscard]]
+			bool
+			isOpen () const noexcept
+			{
+				return m_isOpen;
+			}
+
+			/**
+			 * @brief Returns the file content.
+			 * @return const char *
+			 */
+			[[nodiscard]]
+			const char *
+			data () const noexcept
+			{
+				return m_data;
+			}
+
+			/**
+			 * @brief Returns the file size in bytes.
+			 * @return size_t
+			 */
+			[[nodiscard]]
+			size_t
+			size () const noexcept
+			{
+				return m_size;
+			}
+
+			/**
+			 * @brief Returns the file content as a string view.
+			 * @return std::string_view
+			 */
+			[[nodiscard]]
+			std::string_view
+			view () const noexcept
+			{
+				return {m_data, m_size};
+			}
+
+		private:
+
+			const char * m_data{nullptr};
+			size_t m_size{0};
+#if IS_WINDOWS
+			void * m_fileHandle{nullptr};
+			void * m_mappingHandle{nullptr};
+#else
+			int m_fileDescriptor{-1};
+#endif
+			bool m_isOpen{false};
+	};
+}
@@ -34,12 +34,14 @@
 #include <iomanip>
 #include <limits>
 #include <sstream>
+#include <span>
 #include <string>
 #include <type_traits>
 
 /* Local inclusions for usages. */
 #include "Base.hpp"
 #include "Vector.hpp"
+#include "SIMD.hpp"
 
 namespace EmEn::Libs::Math
 {
@@ -628,6 +630,13 @@ namespace EmEn::Libs::Math
 			{
 				Matrix matrix;
 
+				if constexpr ( dim_t == 4 && std::is_same_v< precision_t, float > )
+				{
+					SIMD::multiply4x4(m_data.data(), operand.m_data.data(), matrix.m_data.data());
+
+					return matrix;
+				}
+
 				#pragma omp simd
 				for ( size_t columnIndex = 0; columnIndex < dim_t; columnIndex++ )
 				{
@@ -727,7 +736,15 @@ namespace EmEn::Libs::Math
 					};
 				}
 
-				if constexpr ( dim_t == 4 )
+				if constexpr ( dim_t == 4 && std::is_same_v< precision_t, float > )
+				{
+					Vector< dim_t, precision_t > vector;
+
+					SIMD::transform4x4(m_data.data(), operand.data(), vector.data());
+
+					return vector;
+				}
+				else if constexpr ( dim_t == 4 )
 				{
 					return {
 						(operand[X] * m_data[M4x4Col0Row0]) + (operand[Y] * m_data[M4x4Col1Row0]) + (operand[Z] * m_data[M4x4Col2Row0]) + (operand[W] * m_data[M4x4Col3Row0]),
@@ -740,6 +757,73 @@ namespace EmEn::Libs::Math
 				return {};
 			}
 
+			/**
+			 * @brief Transforms a list of points by the matrix.
+			 * @note The W component is considered to be 1 and no perspective division is done. The output can be the input itself.
+			 * @param input A span of points.
+			 * @param output A span of points, at least as large as the input.
+			 * @return void
+			 */
+			void
+			transformPoints (std::span< const Vector< 3, precision_t > > input, std::span< Vector< 3, precision_t > > output) const noexcept requires (dim_t == 4 && std::is_floating_point_v< precision_t >)
+			{
+				assert(output.size() >= input.size());
+
+				if ( input.empty() )
+				{
+					return;
+				}
+
+				if constexpr ( std::is_same_v< precision_t, float > )
+				{
+					constexpr auto Stride = sizeof(Vector< 3, float >) / sizeof(float);
+
+					SIMD::transformVectors< true, false >(m_data.data(), input.front().data(), Stride, output.front().data(), Stride, input.size());
+				}
+				else
+				{
+					for ( size_t index = 0; index < input.size(); index++ )
+					{
+						output[index] = Vector< 3, precision_t >{*this * Vector< 4, precision_t >{input[index], 1}};
+					}
+				}
+			}
+
+			/**
+			 * @brief Transforms a list of normals by the inverse transposed matrix and normalizes them.
+			 * @note The output can be the input itself.
+			 * @param input A span of normals.
+			 * @param output A span of normals, at least as large as the input.
+			 * @return void
+			 */
+			void
+			transformNormals (std::span< const Vector< 3, precision_t > > input, std::span< Vector< 3, precision_t > > output) const noexcept requires (dim_t == 4 && std::is_floating_point_v< precision_t >)
+			{
+				assert(output.size() >= input.size());
+
+				if ( input.empty() )
+				{
+					return;
+				}
+
+				auto normalMatrix = this->inverse();
+				normalMatrix.transpose();
+
+				if constexpr ( std::is_same_v< precision_t, float > )
+				{
+					constexpr auto Stride = sizeof(Vector< 3, float >) / sizeof(float);
+
+					SIMD::transformVectors< false, true >(normalMatrix.m_data.data(), input.front().data(), Stride, output.front().data(), Stride, input.size());
+				}
+				else
+				{
+					for ( size_t index = 0; index < input.size(); index++ )
+					{
+						output[index] = Vector< 3, precision_t >{normalMatrix * Vector< 4, precision_t >{input[index], 0}}.normalize();
+					}
+				}
+			}
+
 			/**
 			 * @brief Returns whether a matrix is equal.
 			 * @param operand A reference to another matrix.
@@ -1480,6 +1564,16 @@ namespace EmEn::Libs::Math
 					std::swap(m_data[M3x3Col1Row2], m_data[M3x3Col2Row1]);
 				}
 
+				if constexpr ( dim_t == 4 && std::is_same_v< precision_t, float > )
+				{
+					if ( !std::is_constant_evaluated() )
+					{
+						SIMD::transpose4x4(m_data.data(), m_data.data());
+
+						return *this;
+					}
+				}
+
 				if constexpr ( dim_t == 4  )
 				{
 					std::swap(m_data[M4x4Col0Row1], m_data[M4x4Col1Row0]);
@@ -1547,6 +1641,21 @@ namespace EmEn::Libs::Math
 			Matrix
 			inverse () const noexcept
 			{
+				if constexpr ( dim_t == 4 && std::is_same_v< precision_t, float > )
+				{
+					if ( !std::is_constant_evaluated() )
+					{
+						Matrix inverse;
+
+						if ( !SIMD::inverse4x4(m_data.data(), inverse.m_data.data()) )
+						{
+							return *this;
+						}
+
+						return inverse;
+					}
+				}
+
 				const auto D = this->determinant();
 
 				if ( Utility::isZero(D) )
@@ -0,0 +1,531 @@
+/*
+ * src/Libs/Math/SIMD.hpp
+ * This file is part of Emeraude-Engine
+ *
+ * Copyright (C) 2010-2025 - Sébastien Léon Claude Christian Bémelmans "LondNoir" <londnoir@gmail.com>
+ *
+ * Emeraude-Engine is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * Emeraude-Engine is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with Emeraude-Engine; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * Complete project and additional information can be found at :
+ * https://github.com/londnoir/emeraude-engine
+ *
+ * --- THIS IS AUTOMATICALLY GENERATED, DO NOT CHANGE ---
+ */
+
+#pragma once
+
+/* STL inclusions. */
+#include <cstddef>
+#include <cmath>
+
+/* Local inclusions for usages. */
+#include "Libs/Utility.hpp"
+
+/* NOTE: The instruction set is chosen at build time from the compiler target flags (-msse2, -mavx2 -mfma, /arch:AVX2, ...). */
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+	#define EMERAUDE_MATH_SIMD_SSE
+	#if defined(__FMA__) || defined(__AVX2__)
+		#define EMERAUDE_MATH_SIMD_FMA
+	#endif
+	#include <immintrin.h>
+#endif
+
+/**
+ * @brief Explicitly vectorized kernels for 4x4 column major float matrices.
+ * @note Every kernel works on raw column major storage, see Matrix< 4, float >. A scalar version is compiled
+ * when the target has no SSE2 support. The output pointer may alias an input one, except where noted.
+ */
+namespace EmEn::Libs::Math::SIMD
+{
+#if defined(EMERAUDE_MATH_SIMD_FMA)
+	constexpr auto InstructionSet{"SSE+FMA"};
+#elif defined(EMERAUDE_MATH_SIMD_SSE)
+	constexpr auto InstructionSet{"SSE"};
+#else
+	constexpr auto InstructionSet{"Scalar"};
+#endif
+
+#if defined(EMERAUDE_MATH_SIMD_SSE)
+	/**
+	 * @brief Returns (a * b) + c, fused when the target allows it.
+	 * @param a The first factor.
+	 * @param b The second factor.
+	 * @param c The addend.
+	 * @return __m128
+	 */
+	[[nodiscard]]
+	inline
+	__m128
+	multiplyAdd (__m128 a, __m128 b, __m128 c) noexcept
+	{
+#if defined(EMERAUDE_MATH_SIMD_FMA)
+		return _mm_fmadd_ps(a, b, c);
+#else
+		return _mm_add_ps(_mm_mul_ps(a, b), c);
+#endif
+	}
+
+	/**
+	 * @brief Returns the linear combination of the four matrix columns by the vector components.
+	 * @param columns The matrix columns.
+	 * @param vector A pointer to 4 floats.
+	 * @return __m128
+	 */
+	[[nodiscard]]
+	inline
+	__m128
+	combineColumns (const __m128 (& columns)[4], const float * vector) noexcept
+	{
+		__m128 result = _mm_mul_ps(columns[0], _mm_set1_ps(vector[0]));
+		result = multiplyAdd(columns[1], _mm_set1_ps(vector[1]), result);
+		result = multiplyAdd(columns[2], _mm_set1_ps(vector[2]), result);
+
+		return multiplyAdd(columns[3], _mm_set1_ps(vector[3]), result);
+	}
+
+	/**
+	 * @brief Loads the four columns of a matrix.
+	 * @param matrix A pointer to 16 floats.
+	 * @param columns A reference to the columns.
+	 * @return void
+	 */
+	inline
+	void
+	loadColumns (const float * matrix, __m128 (& columns)[4]) noexcept
+	{
+		columns[0] = _mm_loadu_ps(matrix);
+		columns[1] = _mm_loadu_ps(matrix + 4);
+		columns[2] = _mm_loadu_ps(matrix + 8);
+		columns[3] = _mm_loadu_ps(matrix + 12);
+	}
+
+	/**
+	 * @brief Stores the XYZ lanes of a register.
+	 * @param value The register.
+	 * @param output A pointer to 3 floats.
+	 * @return void
+	 */
+	inline
+	void
+	storeXYZ (__m128 value, float * output) noexcept
+	{
+		_mm_storel_pi(reinterpret_cast< __m64 * >(output), value);
+		_mm_store_ss(output + 2, _mm_movehl_ps(value, value));
+	}
+#endif
+
+	/**
+	 * @brief Multiplies two matrices (output = a * b).
+	 * @param a A pointer to 16 floats.
+	 * @param b A pointer to 16 floats.
+	 * @param output A pointer to 16 floats.
+	 * @return void
+	 */
+	inline
+	void
+	multiply4x4 (const float * a, const float * b, float * output) noexcept
+	{
+#if defined(EMERAUDE_MATH_SIMD_SSE)
+		__m128 columns[4];
+		loadColumns(a, columns);
+
+		const __m128 column0 = combineColumns(columns, b);
+		const __m128 column1 = combineColumns(columns, b + 4);
+		const __m128 column2 = combineColumns(columns, b + 8);
+		const __m128 column3 = combineColumns(columns, b + 12);
+
+		_mm_storeu_ps(output, column0);
+		_mm_storeu_ps(output + 4, column1);
+		_mm_storeu_ps(output + 8, column2);
+		_mm_storeu_ps(output + 12, column3);
+#else
+		float result[16];
+
+		for ( size_t columnIndex = 0; columnIndex < 4; columnIndex++ )
+		{
+			for ( size_t rowIndex = 0; rowIndex < 4; rowIndex++ )
+			{
+				result[(columnIndex * 4) + rowIndex] =
+					(a[rowIndex] * b[columnIndex * 4]) +
+					(a[4 + rowIndex] * b[(columnIndex * 4) + 1]) +
+					(a[8 + rowIndex] * b[(columnIndex * 4) + 2]) +
+					(a[12 + rowIndex] * b[(columnIndex * 4) + 3]);
+			}
+		}
+
+		for ( size_t index = 0; index < 16; index++ )
+		{
+			output[index] = result[index];
+		}
+#endif
+	}
+
+	/**
+	 * @brief Multiplies a matrix by a 4 components vector (output = matrix * vector).
+	 * @param matrix A pointer to 16 floats.
+	 * @param vector A pointer to 4 floats.
+	 * @param output A pointer to 4 floats.
+	 * @return void
+	 */
+	inline
+	void
+	transform4x4 (const float * matrix, const float * vector, float * output) noexcept
+	{
+#if defined(EMERAUDE_MATH_SIMD_SSE)
+		__m128 columns[4];
+		loadColumns(matrix, columns);
+
+		_mm_storeu_ps(output, combineColumns(columns, vector));
+#else
+		const float x = vector[0];
+		const float y = vector[1];
+		const float z = vector[2];
+		const float w = vector[3];
+
+		for ( size_t rowIndex = 0; rowIndex < 4; rowIndex++ )
+		{
+			output[rowIndex] = (matrix[rowIndex] * x) + (matrix[4 + rowIndex] * y) + (matrix[8 + rowIndex] * z) + (matrix[12 + rowIndex] * w);
+		}
+#endif
+	}
+
+	/**
+	 * @brief Transposes a matrix.
+	 * @param matrix A pointer to 16 floats.
+	 * @param output A pointer to 16 floats.
+	 * @return void
+	 */
+	inline
+	void
+	transpose4x4 (const float * matrix, float * output) noexcept
+	{
+#if defined(EMERAUDE_MATH_SIMD_SSE)
+		__m128 columns[4];
+		loadColumns(matrix, columns);
+
+		_MM_TRANSPOSE4_PS(columns[0], columns[1], columns[2], columns[3]);
+
+		_mm_storeu_ps(output, columns[0]);
+		_mm_storeu_ps(output + 4, columns[1]);
+		_mm_storeu_ps(output + 8, columns[2]);
+		_mm_storeu_ps(output + 12, columns[3]);
+#else
+		float result[16];
+
+		for ( size_t columnIndex = 0; columnIndex < 4; columnIndex++ )
+		{
+			for ( size_t rowIndex = 0; rowIndex < 4; rowIndex++ )
+			{
+				result[(rowIndex * 4) + columnIndex] = matrix[(columnIndex * 4) + rowIndex];
+			}
+		}
+
+		for ( size_t index = 0; index < 16; index++ )
+		{
+			output[index] = result[index];
+		}
+#endif
+	}
+
+	/**
+	 * @brief Inverts a matrix using the 2x2 sub-determinants (Laplace expansion).
+	 * @note When the matrix is singular, the output is left untouched.
+	 * @param matrix A pointer to 16 floats.
+	 * @param output A pointer to 16 floats.
+	 * @return bool
+	 */
+	inline
+	bool
+	inverse4x4 (const float * matrix, float * output) noexcept
+	{
+		/* NOTE: Each column is read as a row here. As the inverse of the transposed
+		 * matrix is the transposed inverse, the result is stored the same way. */
+#if defined(EMERAUDE_MATH_SIMD_SSE)
+		const __m128 row0 = _mm_loadu_ps(matrix);
+		const __m128 row1 = _mm_loadu_ps(matrix + 4);
+		const __m128 row2 = _mm_loadu_ps(matrix + 8);
+		const __m128 row3 = _mm_loadu_ps(matrix + 12);
+
+		/* [s0, s1, s2, s3] from rows 0-1, [c0, c1, c2, c3] from rows 2-3 for the pairs (0,1) (0,2) (0,3) (1,2). */
+		const auto subDeterminants = [] (__m128 upper, __m128 lower) {
+			const __m128 upperP = _mm_shuffle_ps(upper, upper, _MM_SHUFFLE(1, 0, 0, 0));
+			const __m128 upperQ = _mm_shuffle_ps(upper, upper, _MM_SHUFFLE(2, 3, 2, 1));
+			const __m128 lowerP = _mm_shuffle_ps(lower, lower, _MM_SHUFFLE(1, 0, 0, 0));
+			const __m128 lowerQ = _mm_shuffle_ps(lower, lower, _MM_SHUFFLE(2, 3, 2, 1));
+
+			return _mm_sub_ps(_mm_mul_ps(upperP, lowerQ), _mm_mul_ps(lowerP, upperQ));
+		};
+
+		const __m128 S = subDeterminants(row0, row1);
+		const __m128 C = subDeterminants(row2, row3);
+
+		/* [s4, s5, c4, c5] for the pairs (1,3) (2,3). */
+		const __m128 P = _mm_shuffle_ps(row0, row2, _MM_SHUFFLE(2, 1, 2, 1));
+		const __m128 Q = _mm_shuffle_ps(row1, row3, _MM_SHUFFLE(3, 3, 3, 3));
+		const __m128 PLower = _mm_shuffle_ps(row1, row3, _MM_SHUFFLE(2, 1, 2, 1));
+		const __m128 QUpper = _mm_shuffle_ps(row0, row2, _MM_SHUFFLE(3, 3, 3, 3));
+		const __m128 SC45 = _mm_sub_ps(_mm_mul_ps(P, Q), _mm_mul_ps(PLower, QUpper));
+
+		/* Factors laid out as [cK, cK, sK, sK]. */
+		const __m128 factor0 = _mm_shuffle_ps(C, S, _MM_SHUFFLE(0, 0, 0, 0));
+		const __m128 factor1 = _mm_shuffle_ps(C, S, _MM_SHUFFLE(1, 1, 1, 1));
+		const __m128 factor2 = _mm_shuffle_ps(C, S, _MM_SHUFFLE(2, 2, 2, 2));
+		const __m128 factor3 = _mm_shuffle_ps(C, S, _MM_SHUFFLE(3, 3, 3, 3));
+		const __m128 factor4 = _mm_shuffle_ps(SC45, SC45, _MM_SHUFFLE(0, 0, 2, 2));
+		const __m128 factor5 = _mm_shuffle_ps(SC45, SC45, _MM_SHUFFLE(1, 1, 3, 3));
+
+		/* Columns of the source laid out as [a1k, a0k, a3k, a2k]. */
+		__m128 column0 = row0;
+		__m128 column1 = row1;
+		__m128 column2 = row2;
+		__m128 column3 = row3;
+
+		_MM_TRANSPOSE4_PS(column0, column1, column2, column3);
+
+		const __m128 V0 = _mm_shuffle_ps(column0, column0, _MM_SHUFFLE(2, 3, 0, 1));
+		const __m128 V1 = _mm_shuffle_ps(column1, column1, _MM_SHUFFLE(2, 3, 0, 1));
+		const __m128 V2 = _mm_shuffle_ps(column2, column2, _MM_SHUFFLE(2, 3, 0, 1));
+		const __m128 V3 = _mm_shuffle_ps(column3, column3, _MM_SHUFFLE(2, 3, 0, 1));
+
+		const __m128 signPNPN = _mm_setr_ps(1.0F, -1.0F, 1.0F, -1.0F);
+		const __m128 signNPNP = _mm_setr_ps(-1.0F, 1.0F, -1.0F, 1.0F);
+
+		const __m128 result0 = _mm_mul_ps(signPNPN, _mm_add_ps(_mm_sub_ps(_mm_mul_ps(V1, factor5), _mm_mul_ps(V2, factor4)), _mm_mul_ps(V3, factor3)));
+		const __m128 result1 = _mm_mul_ps(signNPNP, _mm_add_ps(_mm_sub_ps(_mm_mul_ps(V0, factor5), _mm_mul_ps(V2, factor2)), _mm_mul_ps(V3, factor1)));
+		const __m128 result2 = _mm_mul_ps(signPNPN, _mm_add_ps(_mm_sub_ps(_mm_mul_ps(V0, factor4), _mm_mul_ps(V1, factor2)), _mm_mul_ps(V3, factor0)));
+		const __m128 result3 = _mm_mul_ps(signNPNP, _mm_add_ps(_mm_sub_ps(_mm_mul_ps(V0, factor3), _mm_mul_ps(V1, factor1)), _mm_mul_ps(V2, factor0)));
+
+		/* Determinant from the first row and the first adjugate column. */
+		const __m128 firstColumn = _mm_movelh_ps(_mm_unpacklo_ps(result0, result1), _mm_unpacklo_ps(result2, result3));
+		__m128 products = _mm_mul_ps(row0, firstColumn);
+		products = _mm_add_ps(products, _mm_movehl_ps(products, products));
+		products = _mm_add_ss(products, _mm_shuffle_ps(products, products, _MM_SHUFFLE(1, 1, 1, 1)));
+
+		const float determinant = _mm_cvtss_f32(products);
+
+		if ( Utility::isZero(determinant) )
+		{
+			return false;
+		}
+
+		const __m128 inverseDeterminant = _mm_div_ps(_mm_set1_ps(1.0F), _mm_set1_ps(determinant));
+
+		_mm_storeu_ps(output, _mm_mul_ps(result0, inverseDeterminant));
+		_mm_storeu_ps(output + 4, _mm_mul_ps(result1, inverseDeterminant));
+		_mm_storeu_ps(output + 8, _mm_mul_ps(result2, inverseDeterminant));
+		_mm_storeu_ps(output + 12, _mm_mul_ps(result3, inverseDeterminant));
+#else
+		const auto a = [matrix] (size_t row, size_t column) {
+			return matrix[(row * 4) + column];
+		};
+
+		const float s0 = a(0, 0) * a(1, 1) - a(1, 0) * a(0, 1);
+		const float s1 = a(0, 0) * a(1, 2) - a(1, 0) * a(0, 2);
+		const float s2 = a(0, 0) * a(1, 3) - a(1, 0) * a(0, 3);
+		const float s3 = a(0, 1) * a(1, 2) - a(1, 1) * a(0, 2);
+		const float s4 = a(0, 1) * a(1, 3) - a(1, 1) * a(0, 3);
+		const float s5 = a(0, 2) * a(1, 3) - a(1, 2) * a(0, 3);
+
+		const float c0 = a(2, 0) * a(3, 1) - a(3, 0) * a(2, 1);
+		const float c1 = a(2, 0) * a(3, 2) - a(3, 0) * a(2, 2);
+		const float c2 = a(2, 0) * a(3, 3) - a(3, 0) * a(2, 3);
+		const float c3 = a(2, 1) * a(3, 2) - a(3, 1) * a(2, 2);
+		const float c4 = a(2, 1) * a(3, 3) - a(3, 1) * a(2, 3);
+		const float c5 = a(2, 2) * a(3, 3) - a(3, 2) * a(2, 3);
+
+		const float determinant = s0 * c5 - s1 * c4 + s2 * c3 + s3 * c2 - s4 * c1 + s5 * c0;
+
+		if ( Utility::isZero(determinant) )
+		{
+			return false;
+		}
+
+		const float result[16]{
+			a(1, 1) * c5 - a(1, 2) * c4 + a(1, 3) * c3,
+			-a(0, 1) * c5 + a(0, 2) * c4 - a(0, 3) * c3,
+			a(3, 1) * s5 - a(3, 2) * s4 + a(3, 3) * s3,
+			-a(2, 1) * s5 + a(2, 2) * s4 - a(2, 3) * s3,
+
+			-a(1, 0) * c5 + a(1, 2) * c2 - a(1, 3) * c1,
+			a(0, 0) * c5 - a(0, 2) * c2 + a(0, 3) * c1,
+			-a(3, 0) * s5 + a(3, 2) * s2 - a(3, 3) * s1,
+			a(2, 0) * s5 - a(2, 2) * s2 + a(2, 3) * s1,
+
+			a(1, 0) * c4 - a(1, 1) * c2 + a(1, 3) * c0,
+			-a(0, 0) * c4 + a(0, 1) * c2 - a(0, 3) * c0,
+			a(3, 0) * s4 - a(3, 1) * s2 + a(3, 3) * s0,
+			-a(2, 0) * s4 + a(2, 1) * s2 - a(2, 3) * s0,
+
+			-a(1, 0) * c3 + a(1, 1) * c1 - a(1, 2) * c0,
+			a(0, 0) * c3 - a(0, 1) * c1 + a(0, 2) * c0,
+			-a(3, 0) * s3 + a(3, 1) * s1 - a(3, 2) * s0,
+			a(2, 0) * s3 - a(2, 1) * s1 + a(2, 2) * s0
+		};
+
+		const float inverseDeterminant = 1.0F / determinant;
+
+		for ( size_t index = 0; index < 16; index++ )
+		{
+			output[index] = result[index] * inverseDeterminant;
+		}
+#endif
+
+		return true;
+	}
+
+	/**
+	 * @brief Transforms a strided array of XYZ vectors by a matrix.
+	 * @tparam translate_t Applies the matrix translation (points) or not (directions).
+	 * @tparam normalize_t Normalizes the results.
+	 * @param matrix A pointer to 16 floats.
+	 * @param input A pointer to the first input vector.
+	 * @param inputStride The distance in floats between two input vectors.
+	 * @param output A pointer to the first output vector. May be the same as input with the same stride.
+	 * @param outputStride The distance in floats between two output vectors.
+	 * @param count The number of vectors.
+	 * @return void
+	 */
+	template< bool translate_t, bool normalize_t >
+	void
+	transformVectors (const float * matrix, const float * input, size_t inputStride, float * output, size_t outputStride, size_t count) noexcept
+	{
+#if defined(EMERAUDE_MATH_SIMD_SSE)
+		__m128 columns[4];
+		loadColumns(matrix, columns);
+
+		const __m128 offset = translate_t ? columns[3] : _mm_setzero_ps();
+
+		for ( size_t index = 0; index < count; index++ )
+		{
+			__m128 result = multiplyAdd(columns[0], _mm_set1_ps(input[0]), offset);
+			result = multiplyAdd(columns[1], _mm_set1_ps(input[1]), result);
+			result = multiplyAdd(columns[2], _mm_set1_ps(input[2]), result);
+
+			if constexpr ( normalize_t )
+			{
+				const __m128 squares = _mm_mul_ps(result, result);
+				const __m128 lengthSquared = _mm_add_ss(_mm_add_ss(squares, _mm_shuffle_ps(squares, squares, _MM_SHUFFLE(1, 1, 1, 1))), _mm_movehl_ps(squares, squares));
+				const float length = _mm_cvtss_f32(lengthSquared);
+
+				if ( !Utility::isZero(length) )
+				{
+					result = _mm_div_ps(result, _mm_sqrt_ps(_mm_shuffle_ps(lengthSquared, lengthSquared, _MM_SHUFFLE(0, 0, 0, 0))));
+				}
+			}
+
+			storeXYZ(result, output);
+
+			input += inputStride;
+			output += outputStride;
+		}
+#else
+		for ( size_t index = 0; index < count; index++ )
+		{
+			const float x = input[0];
+			const float y = input[1];
+			const float z = input[2];
+
+			float result[3];
+
+			for ( size_t rowIndex = 0; rowIndex < 3; rowIndex++ )
+			{
+				result[rowIndex] = (matrix[rowIndex] * x) + (matrix[4 + rowIndex] * y) + (matrix[8 + rowIndex] * z);
+
+				if constexpr ( translate_t )
+				{
+					result[rowIndex] += matrix[12 + rowIndex];
+				}
+			}
+
+			if constexpr ( normalize_t )
+			{
+				const float length = (result[0] * result[0]) + (result[1] * result[1]) + (result[2] * result[2]);
+
+				if ( !Utility::isZero(length) )
+				{
+					const float inverseLength = 1.0F / std::sqrt(length);
+
+					result[0] *= inverseLength;
+					result[1] *= inverseLength;
+					result[2] *= inverseLength;
+				}
+			}
+
+			output[0] = result[0];
+			output[1] = result[1];
+			output[2] = result[2];
+
+			input += inputStride;
+			output += outputStride;
+		}
+#endif
+	}
+
+	/**
+	 * @brief Transforms an axis-aligned box by a matrix and returns the axis-aligned box enclosing the result (Arvo's method).
+	 * @param matrix A pointer to 16 floats.
+	 * @param minimum A pointer to the 3 minimum coordinates.
+	 * @param maximum A pointer to the 3 maximum coordinates.
+	 * @param outputMinimum A pointer to 3 floats.
+	 * @param outputMaximum A pointer to 3 floats.
+	 * @return void
+	 */
+	inline
+	void
+	transformBox (const float * matrix, const float * minimum, const float * maximum, float * outputMinimum, float * outputMaximum) noexcept
+	{
+#if defined(EMERAUDE_MATH_SIMD_SSE)
+		__m128 columns[4];
+		loadColumns(matrix, columns);
+
+		const __m128 signMask = _mm_set1_ps(-0.0F);
+		const __m128 half = _mm_set1_ps(0.5F);
+
+		const __m128 lower = _mm_setr_ps(minimum[0], minimum[1], minimum[2], 0.0F);
+		const __m128 upper = _mm_setr_ps(maximum[0], maximum[1], maximum[2], 0.0F);
+		const __m128 center = _mm_mul_ps(_mm_add_ps(lower, upper), half);
+		const __m128 extent = _mm_mul_ps(_mm_sub_ps(upper, lower), half);
+
+		__m128 newCenter = multiplyAdd(columns[0], _mm_shuffle_ps(center, center, _MM_SHUFFLE(0, 0, 0, 0)), columns[3]);
+		newCenter = multiplyAdd(columns[1], _mm_shuffle_ps(center, center, _MM_SHUFFLE(1, 1, 1, 1)), newCenter);
+		newCenter = multiplyAdd(columns[2], _mm_shuffle_ps(center, center, _MM_SHUFFLE(2, 2, 2, 2)), newCenter);
+
+		__m128 newExtent = _mm_mul_ps(_mm_andnot_ps(signMask, columns[0]), _mm_shuffle_ps(extent, extent, _MM_SHUFFLE(0, 0, 0, 0)));
+		newExtent = multiplyAdd(_mm_andnot_ps(signMask, columns[1]), _mm_shuffle_ps(extent, extent, _MM_SHUFFLE(1, 1, 1, 1)), newExtent);
+		newExtent = multiplyAdd(_mm_andnot_ps(signMask, columns[2]), _mm_shuffle_ps(extent, extent, _MM_SHUFFLE(2, 2, 2, 2)), newExtent);
+
+		storeXYZ(_mm_sub_ps(newCenter, newExtent), outputMinimum);
+		storeXYZ(_mm_add_ps(newCenter, newExtent), outputMaximum);
+#else
+		float center[3];
+		float extent[3];
+
+		for ( size_t axis = 0; axis < 3; axis++ )
+		{
+			center[axis] = (minimum[axis] + maximum[axis]) * 0.5F;
+			extent[axis] = (maximum[axis] - minimum[axis]) * 0.5F;
+		}
+
+		for ( size_t rowIndex = 0; rowIndex < 3; rowIndex++ )
+		{
+			const float newCenter = (matrix[rowIndex] * center[0]) + (matrix[4 + rowIndex] * center[1]) + (matrix[8 + rowIndex] * center[2]) + matrix[12 + rowIndex];
+			const float newExtent = (std::abs(matrix[rowIndex]) * extent[0]) + (std::abs(matrix[4 + rowIndex]) * extent[1]) + (std::abs(matrix[8 + rowIndex]) * extent[2]);
+
+			outputMinimum[rowIndex] = newCenter - newExtent;
+			outputMaximum[rowIndex] = newCenter + newExtent;
+		}
+#endif
+	}
+}
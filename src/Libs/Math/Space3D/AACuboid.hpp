@@ -34,8 +34,11 @@
 #include <sstream>
 #include <string>
 #include <algorithm>
+#include <cassert>
+#include <span>
 
 /* Local inclusions for usages. */
+#include "Libs/Math/Matrix.hpp"
 #include "Point.hpp"
 
 namespace EmEn::Libs::Math::Space3D
@@ -612,6 +615,63 @@ namespace EmEn::Libs::Math::Space3D
 				return this->width() * this->height() * this->depth();
 			}
 
+			/**
+			 * @brief Transforms a list of boxes by a matrix.
+			 * @note Each output box encloses the transformed input box (Arvo's method). Invalid boxes are reset. The output can be the input itself.
+			 * @param matrix A reference to a transformation matrix.
+			 * @param input A span of boxes.
+			 * @param output A span of boxes, at least as large as the input.
+			 * @return void
+			 */
+			static
+			void
+			transform (const Matrix< 4, precision_t > & matrix, std::span< const AACuboid > input, std::span< AACuboid > output) noexcept
+			{
+				assert(output.size() >= input.size());
+
+				for ( size_t index = 0; index < input.size(); index++ )
+				{
+					const auto & box = input[index];
+
+					if ( !box.isValid() )
+					{
+						output[index].reset();
+
+						continue;
+					}
+
+					Point< precision_t > minimum;
+					Point< precision_t > maximum;
+
+					if constexpr ( std::is_same_v< precision_t, float > )
+					{
+						SIMD::transformBox(matrix.data(), box.m_minimum.data(), box.m_maximum.data(), minimum.data(), maximum.data());
+					}
+					else
+					{
+						const auto center = box.centroid();
+						const auto extent = (box.m_maximum - box.m_minimum) * static_cast< precision_t >(0.5);
+
+						for ( size_t rowIndex = 0; rowIndex < 3; rowIndex++ )
+						{
+							precision_t newCenter = matrix[12 + rowIndex];
+							precision_t newExtent = 0;
+
+							for ( size_t columnIndex = 0; columnIndex < 3; columnIndex++ )
+							{
+								newCenter += matrix[(columnIndex * 4) + rowIndex] * center[columnIndex];
+								newExtent += std::abs(matrix[(columnIndex * 4) + rowIndex]) * extent[columnIndex];
+							}
+
+							minimum[rowIndex] = newCenter - newExtent;
+							maximum[rowIndex] = newCenter + newExtent;
+						}
+					}
+
+					output[index].set(maximum, minimum);
+				}
+			}
+
 			/**
 			 * @brief STL streams printable object.
 			 * @param out A reference to the stream output.
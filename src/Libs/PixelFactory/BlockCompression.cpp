@@ -0,0 +1,1191 @@
+/*
+ * src/Libs/PixelFactory/BlockCompression.cpp
+ * This file is part of Emeraude-Engine
+ *
+ * Copyright (C) 2010-2025 - Sébastien Léon Claude Christian Bémelmans "LondNoir" <londnoir@gmail.com>
+ *
+ * Emeraude-Engine is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * Emeraude-Engine is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with Emeraude-Engine; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * Complete project and additional information can be found at :
+ * https://github.com/londnoir/emeraude-engine
+ *
+ * --- THIS IS AUTOMATICALLY GENERATED, DO NOT CHANGE ---
+ */
+
+#include "BlockCompression.hpp"
+
+/* STL inclusions. */
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstring>
+#include <iostream>
+#include <limits>
+
+/* Local inclusions. */
+#include "Libs/ThreadPool.hpp"
+
+namespace EmEn::Libs::PixelFactory
+{
+	namespace
+	{
+		/** @brief The 16 pixels of a block expanded to RGBA. */
+		using Block = std::array< std::array< uint8_t, 4 >, BlockSide * BlockSide >;
+
+		/** @brief Interpolation weights of the 4-bit indices of BC7, on a 64 scale. */
+		constexpr std::array< int32_t, 16 > BC7Weights{0, 4, 9, 13, 17, 21, 26, 30, 34, 38, 43, 47, 51, 55, 60, 64};
+
+		/**
+		 * @brief Reads a block from a pixmap, repeating the border pixels outside the image.
+		 * @param pixmap A reference to the pixmap.
+		 * @param blockX The block column.
+		 * @param blockY The block row.
+		 * @param rawChannels Copy the channels as they are instead of expanding the pixel to RGBA.
+		 * @param block A reference to the block.
+		 * @return void
+		 */
+		void
+		fetchBlock (const Pixmap< uint8_t > & pixmap, size_t blockX, size_t blockY, bool rawChannels, Block & block) noexcept
+		{
+			const auto channelCount = pixmap.colorCount();
+
+			for ( size_t row = 0; row < BlockSide; row++ )
+			{
+				const auto coordY = static_cast< uint32_t >(std::min< size_t >(blockY * BlockSide + row, pixmap.height() - 1));
+
+				for ( size_t column = 0; column < BlockSide; column++ )
+				{
+					const auto coordX = static_cast< uint32_t >(std::min< size_t >(blockX * BlockSide + column, pixmap.width() - 1));
+					const auto * pixel = pixmap.pixelPointer(coordX, coordY);
+					auto & texel = block[row * BlockSide + column];
+
+					if ( rawChannels )
+					{
+						for ( size_t channel = 0; channel < 4; channel++ )
+						{
+							texel[channel] = pixel[std::min< size_t >(channel, channelCount - 1)];
+						}
+
+						continue;
+					}
+
+					switch ( channelCount )
+					{
+						case 1 :
+							texel = {pixel[0], pixel[0], pixel[0], 255};
+							break;
+
+						case 2 :
+							texel = {pixel[0], pixel[0], pixel[0], pixel[1]};
+							break;
+
+						case 3 :
+							texel = {pixel[0], pixel[1], pixel[2], 255};
+							break;
+
+						default :
+							texel = {pixel[0], pixel[1], pixel[2], pixel[3]};
+							break;
+					}
+				}
+			}
+		}
+
+		/**
+		 * @brief Solves the two endpoints minimizing the squared error for fixed interpolation factors.
+		 * @tparam dimension The number of channels.
+		 * @param points The values of the pixels.
+		 * @param factors The interpolation factor from the first to the second endpoint of each pixel.
+		 * @param count The number of pixels.
+		 * @param first A reference to the first endpoint.
+		 * @param second A reference to the second endpoint.
+		 * @return bool
+		 */
+		template< size_t dimension >
+		bool
+		solveEndpoints (const std::array< std::array< float, dimension >, 16 > & points, const std::array< float, 16 > & factors, size_t count, std::array< float, dimension > & first, std::array< float, dimension > & second) noexcept
+		{
+			float alpha2 = 0.0F;
+			float alphaBeta = 0.0F;
+			float beta2 = 0.0F;
+			std::array< float, dimension > alphaX{};
+			std::array< float, dimension > betaX{};
+
+			for ( size_t index = 0; index < count; index++ )
+			{
+				const auto beta = factors[index];
+				const auto alpha = 1.0F - beta;
+
+				alpha2 += alpha * alpha;
+				alphaBeta += alpha * beta;
+				beta2 += beta * beta;
+
+				for ( size_t channel = 0; channel < dimension; channel++ )
+				{
+					alphaX[channel] += alpha * points[index][channel];
+					betaX[channel] += beta * points[index][channel];
+				}
+			}
+
+			const auto determinant = alpha2 * beta2 - alphaBeta * alphaBeta;
+
+			if ( std::abs(determinant) < std::numeric_limits< float >::epsilon() )
+			{
+				return false;
+			}
+
+			for ( size_t channel = 0; channel < dimension; channel++ )
+			{
+				first[channel] = std::clamp((beta2 * alphaX[channel] - alphaBeta * betaX[channel]) / determinant, 0.0F, 255.0F);
+				second[channel] = std::clamp((alpha2 * betaX[channel] - alphaBeta * alphaX[channel]) / determinant, 0.0F, 255.0F);
+			}
+
+			return true;
+		}
+
+		/**
+		 * @brief Finds the endpoints of a point cloud along its principal axis.
+		 * @tparam dimension The number of channels.
+		 * @param points The values of the pixels.
+		 * @param count The number of pixels.
+		 * @param first A reference to the first endpoint.
+		 * @param second A reference to the second endpoint.
+		 * @return void
+		 */
+		template< size_t dimension >
+		void
+		principalEndpoints (const std::array< std::array< float, dimension >, 16 > & points, size_t count, std::array< float, dimension > & first, std::array< float, dimension > & second) noexcept
+		{
+			std::array< float, dimension > mean{};
+
+			for ( size_t index = 0; index < count; index++ )
+			{
+				for ( size_t channel = 0; channel < dimension; channel++ )
+				{
+					mean[channel] += points[index][channel];
+				}
+			}
+
+			for ( auto & value : mean )
+			{
+				value /= static_cast< float >(count);
+			}
+
+			std::array< std::array< float, dimension >, dimension > covariance{};
+
+			for ( size_t index = 0; index < count; index++ )
+			{
+				for ( size_t rowIndex = 0; rowIndex < dimension; rowIndex++ )
+				{
+					for ( size_t columnIndex = 0; columnIndex < dimension; columnIndex++ )
+					{
+						covariance[rowIndex][columnIndex] += (points[index][rowIndex] - mean[rowIndex]) * (points[index][columnIndex] - mean[columnIndex]);
+					}
+				}
+			}
+
+			/* NOTE: Power iterations, starting from the diagonal direction. */
+			std::array< float, dimension > axis{};
+			axis.fill(1.0F);
+
+			for ( size_t iteration = 0; iteration < 8; iteration++ )
+			{
+				std::array< float, dimension > next{};
+				float length = 0.0F;
+
+				for ( size_t rowIndex = 0; rowIndex < dimension; rowIndex++ )
+				{
+					for ( size_t columnIndex = 0; columnIndex < dimension; columnIndex++ )
+					{
+						next[rowIndex] += covariance[rowIndex][columnIndex] * axis[columnIndex];
+					}
+
+					length = std::max(length, std::abs(next[rowIndex]));
+				}
+
+				if ( length <= std::numeric_limits< float >::epsilon() )
+				{
+					break;
+				}
+
+				for ( size_t channel = 0; channel < dimension; channel++ )
+				{
+					axis[channel] = next[channel] / length;
+				}
+			}
+
+			auto minimum = std::numeric_limits< float >::max();
+			auto maximum = std::numeric_limits< float >::lowest();
+
+			for ( size_t index = 0; index < count; index++ )
+			{
+				float projection = 0.0F;
+
+				for ( size_t channel = 0; channel < dimension; channel++ )
+				{
+					projection += (points[index][channel] - mean[channel]) * axis[channel];
+				}
+
+				minimum = std::min(minimum, projection);
+				maximum = std::max(maximum, projection);
+			}
+
+			float axisLength2 = 0.0F;
+
+			for ( const auto value : axis )
+			{
+				axisLength2 += value * value;
+			}
+
+			if ( axisLength2 <= std::numeric_limits< float >::epsilon() )
+			{
+				first = mean;
+				second = mean;
+
+				return;
+			}
+
+			for ( size_t channel = 0; channel < dimension; channel++ )
+			{
+				first[channel] = std::clamp(mean[channel] + axis[channel] * minimum / axisLength2, 0.0F, 255.0F);
+				second[channel] = std::clamp(mean[channel] + axis[channel] * maximum / axisLength2, 0.0F, 255.0F);
+			}
+		}
+
+		/**
+		 * @brief Packs a color to the 5:6:5 format.
+		 * @param color The color.
+		 * @return uint16_t
+		 */
+		[[nodiscard]]
+		uint16_t
+		packRGB565 (const std::array< float, 3 > & color) noexcept
+		{
+			const auto red = static_cast< uint16_t >(std::lround(color[0] * 31.0F / 255.0F));
+			const auto green = static_cast< uint16_t >(std::lround(color[1] * 63.0F / 255.0F));
+			const auto blue = static_cast< uint16_t >(std::lround(color[2] * 31.0F / 255.0F));
+
+			return static_cast< uint16_t >((red << 11) | (green << 5) | blue);
+		}
+
+		/**
+		 * @brief Unpacks a 5:6:5 color to 8 bits per channel.
+		 * @param value The packed color.
+		 * @return std::array< int32_t, 3 >
+		 */
+		[[nodiscard]]
+		std::array< int32_t, 3 >
+		unpackRGB565 (uint16_t value) noexcept
+		{
+			const auto red = (value >> 11) & 0x1F;
+			const auto green = (value >> 5) & 0x3F;
+			const auto blue = value & 0x1F;
+
+			return {(red << 3) | (red >> 2), (green << 2) | (green >> 4), (blue << 3) | (blue >> 2)};
+		}
+
+		/**
+		 * @brief Returns the color palette of a BC1 block.
+		 * @param color0 The first packed endpoint.
+		 * @param color1 The second packed endpoint.
+		 * @param fourColors Force the four colors mode, as in BC3.
+		 * @return std::array< std::array< int32_t, 3 >, 4 >
+		 */
+		[[nodiscard]]
+		std::array< std::array< int32_t, 3 >, 4 >
+		getBC1Palette (uint16_t color0, uint16_t color1, bool fourColors) noexcept
+		{
+			const auto first = unpackRGB565(color0);
+			const auto second = unpackRGB565(color1);
+
+			std::array< std::array< int32_t, 3 >, 4 > palette{first, second};
+
+			for ( size_t channel = 0; channel < 3; channel++ )
+			{
+				if ( fourColors || color0 > color1 )
+				{
+					palette[2][channel] = (2 * first[channel] + second[channel] + 1) / 3;
+					palette[3][channel] = (first[channel] + 2 * second[channel] + 1) / 3;
+				}
+				else
+				{
+					palette[2][channel] = (first[channel] + second[channel] + 1) / 2;
+					palette[3][channel] = 0;
+				}
+			}
+
+			return palette;
+		}
+
+		/**
+		 * @brief Assigns the nearest palette entry to each pixel of a block and returns the error.
+		 * @param block A reference to the block.
+		 * @param palette A reference to the palette.
+		 * @param paletteSize The number of usable entries.
+		 * @param transparentMask A bit set of transparent pixels, using the index 3.
+		 * @param indices A reference to the index array.
+		 * @return int32_t
+		 */
+		int32_t
+		assignBC1Indices (const Block & block, const std::array< std::array< int32_t, 3 >, 4 > & palette, size_t paletteSize, uint32_t transparentMask, std::array< uint8_t, 16 > & indices) noexcept
+		{
+			int32_t totalError = 0;
+
+			for ( size_t pixelIndex = 0; pixelIndex < block.size(); pixelIndex++ )
+			{
+				if ( (transparentMask & (1U << pixelIndex)) != 0 )
+				{
+					indices[pixelIndex] = 3;
+
+					continue;
+				}
+
+				auto bestError = std::numeric_limits< int32_t >::max();
+
+				for ( size_t entry = 0; entry < paletteSize; entry++ )
+				{
+					int32_t error = 0;
+
+					for ( size_t channel = 0; channel < 3; channel++ )
+					{
+						const auto difference = static_cast< int32_t >(block[pixelIndex][channel]) - palette[entry][channel];
+
+						error += difference * difference;
+					}
+
+					if ( error < bestError )
+					{
+						bestError = error;
+						indices[pixelIndex] = static_cast< uint8_t >(entry);
+					}
+				}
+
+				totalError += bestError;
+			}
+
+			return totalError;
+		}
+
+		/**
+		 * @brief Encodes the color part of a block to BC1.
+		 * @param block A reference to the block.
+		 * @param fourColors Force the four colors mode and ignore the alpha, as required by BC3.
+		 * @param output A pointer to the 8 bytes of the block.
+		 * @return void
+		 */
+		void
+		encodeBC1 (const Block & block, bool fourColors, uint8_t * output) noexcept
+		{
+			std::array< std::array< float, 3 >, 16 > points{};
+			size_t count = 0;
+			uint32_t transparentMask = 0;
+
+			for ( size_t pixelIndex = 0; pixelIndex < block.size(); pixelIndex++ )
+			{
+				if ( !fourColors && block[pixelIndex][3] < 128 )
+				{
+					transparentMask |= 1U << pixelIndex;
+
+					continue;
+				}
+
+				points[count++] = {static_cast< float >(block[pixelIndex][0]), static_cast< float >(block[pixelIndex][1]), static_cast< float >(block[pixelIndex][2])};
+			}
+
+			uint16_t color0 = 0;
+			uint16_t color1 = 0;
+			std::array< uint8_t, 16 > indices{};
+
+			if ( count > 0 )
+			{
+				/* NOTE: The three colors mode is the only one with a transparent entry, it requires color0 <= color1. */
+				const auto threeColors = transparentMask != 0;
+				const size_t paletteSize = threeColors ? 3 : 4;
+
+				std::array< float, 3 > first{};
+				std::array< float, 3 > second{};
+
+				principalEndpoints(points, count, first, second);
+
+				auto bestError = std::numeric_limits< int32_t >::max();
+
+				/* NOTE: The first pass uses the principal axis extremities, the second one the least squares refinement. */
+				for ( size_t pass = 0; pass < 2; pass++ )
+				{
+					auto candidate0 = packRGB565(first);
+					auto candidate1 = packRGB565(second);
+
+					if ( threeColors ? candidate0 > candidate1 : candidate0 < candidate1 )
+					{
+						std::swap(candidate0, candidate1);
+					}
+
+					std::array< uint8_t, 16 > candidateIndices{};
+					const auto error = assignBC1Indices(block, getBC1Palette(candidate0, candidate1, fourColors), candidate0 == candidate1 && !threeColors ? 1 : paletteSize, transparentMask, candidateIndices);
+
+					if ( error < bestError )
+					{
+						bestError = error;
+						color0 = candidate0;
+						color1 = candidate1;
+						indices = candidateIndices;
+					}
+
+					if ( pass > 0 || error == 0 )
+					{
+						break;
+					}
+
+					/* NOTE: Interpolation factors of the palette entries, from color0 to color1. */
+					const std::array< float, 4 > entryFactors = threeColors ?
+						std::array< float, 4 >{0.0F, 1.0F, 0.5F, 0.0F} :
+						std::array< float, 4 >{0.0F, 1.0F, 1.0F / 3.0F, 2.0F / 3.0F};
+
+					std::array< float, 16 > factors{};
+					size_t opaqueIndex = 0;
+
+					for ( size_t pixelIndex = 0; pixelIndex < block.size(); pixelIndex++ )
+					{
+						if ( (transparentMask & (1U << pixelIndex)) == 0 )
+						{
+							factors[opaqueIndex++] = entryFactors[candidateIndices[pixelIndex]];
+						}
+					}
+
+					if ( !solveEndpoints(points, factors, count, first, second) )
+					{
+						break;
+					}
+				}
+			}
+			else
+			{
+				indices.fill(3);
+			}
+
+			output[0] = static_cast< uint8_t >(color0 & 0xFF);
+			output[1] = static_cast< uint8_t >(color0 >> 8);
+			output[2] = static_cast< uint8_t >(color1 & 0xFF);
+			output[3] = static_cast< uint8_t >(color1 >> 8);
+
+			uint32_t packedIndices = 0;
+
+			for ( size_t pixelIndex = 0; pixelIndex < indices.size(); pixelIndex++ )
+			{
+				packedIndices |= static_cast< uint32_t >(indices[pixelIndex]) << (pixelIndex * 2);
+			}
+
+			for ( size_t byteIndex = 0; byteIndex < 4; byteIndex++ )
+			{
+				output[4 + byteIndex] = static_cast< uint8_t >(packedIndices >> (byteIndex * 8));
+			}
+		}
+
+		/**
+		 * @brief Returns the value palette of a BC4 block.
+		 * @param value0 The first endpoint.
+		 * @param value1 The second endpoint.
+		 * @return std::array< int32_t, 8 >
+		 */
+		[[nodiscard]]
+		std::array< int32_t, 8 >
+		getBC4Palette (int32_t value0, int32_t value1) noexcept
+		{
+			std::array< int32_t, 8 > palette{value0, value1};
+
+			if ( value0 > value1 )
+			{
+				for ( int32_t step = 1; step < 7; step++ )
+				{
+					palette[1 + step] = ((7 - step) * value0 + step * value1 + 3) / 7;
+				}
+			}
+			else
+			{
+				for ( int32_t step = 1; step < 5; step++ )
+				{
+					palette[1 + step] = ((5 - step) * value0 + step * value1 + 2) / 5;
+				}
+
+				palette[6] = 0;
+				palette[7] = 255;
+			}
+
+			return palette;
+		}
+
+		/**
+		 * @brief Encodes one channel of a block to BC4.
+		 * @param block A reference to the block.
+		 * @param channel The channel to encode.
+		 * @param output A pointer to the 8 bytes of the block.
+		 * @return void
+		 */
+		void
+		encodeBC4 (const Block & block, size_t channel, uint8_t * output) noexcept
+		{
+			int32_t minimum = 255;
+			int32_t maximum = 0;
+			int32_t innerMinimum = 255;
+			int32_t innerMaximum = 0;
+
+			for ( const auto & texel : block )
+			{
+				const int32_t value = texel[channel];
+
+				minimum = std::min(minimum, value);
+				maximum = std::max(maximum, value);
+
+				if ( value != 0 && value != 255 )
+				{
+					innerMinimum = std::min(innerMinimum, value);
+					innerMaximum = std::max(innerMaximum, value);
+				}
+			}
+
+			/* NOTE: The eight values mode spans the whole range, the six values mode keeps exact 0 and 255 aside. */
+			std::array< std::array< int32_t, 2 >, 2 > candidates{{
+				{maximum, minimum},
+				{innerMinimum <= innerMaximum ? innerMinimum : minimum, innerMinimum <= innerMaximum ? innerMaximum : minimum}
+			}};
+
+			auto bestError = std::numeric_limits< int32_t >::max();
+			std::array< int32_t, 2 > bestEndpoints{};
+			std::array< uint8_t, 16 > bestIndices{};
+
+			for ( const auto & endpoints : candidates )
+			{
+				const auto palette = getBC4Palette(endpoints[0], endpoints[1]);
+
+				int32_t error = 0;
+				std::array< uint8_t, 16 > indices{};
+
+				for ( size_t pixelIndex = 0; pixelIndex < block.size(); pixelIndex++ )
+				{
+					auto pixelError = std::numeric_limits< int32_t >::max();
+
+					for ( size_t entry = 0; entry < palette.size(); entry++ )
+					{
+						const auto difference = static_cast< int32_t >(block[pixelIndex][channel]) - palette[entry];
+
+						if ( difference * difference < pixelError )
+						{
+							pixelError = difference * difference;
+							indices[pixelIndex] = static_cast< uint8_t >(entry);
+						}
+					}
+
+					error += pixelError;
+				}
+
+				if ( error < bestError )
+				{
+					bestError = error;
+					bestEndpoints = endpoints;
+					bestIndices = indices;
+				}
+			}
+
+			output[0] = static_cast< uint8_t >(bestEndpoints[0]);
+			output[1] = static_cast< uint8_t >(bestEndpoints[1]);
+
+			uint64_t packedIndices = 0;
+
+			for ( size_t pixelIndex = 0; pixelIndex < bestIndices.size(); pixelIndex++ )
+			{
+				packedIndices |= static_cast< uint64_t >(bestIndices[pixelIndex]) << (pixelIndex * 3);
+			}
+
+			for ( size_t byteIndex = 0; byteIndex < 6; byteIndex++ )
+			{
+				output[2 + byteIndex] = static_cast< uint8_t >(packedIndices >> (byteIndex * 8));
+			}
+		}
+
+		/**
+		 * @brief Sequential bit writer and reader over a 128-bit block, least significant bit first.
+		 */
+		class BitStream final
+		{
+			public:
+
+				/**
+				 * @brief Constructs a bit stream over a block.
+				 * @param data A pointer to the 16 bytes of the block.
+				 */
+				explicit
+				BitStream (uint8_t * data) noexcept
+					: m_data(data)
+				{
+
+				}
+
+				/**
+				 * @brief Writes a value.
+				 * @param value The value.
+				 * @param bitCount The number of bits of the value.
+				 * @return void
+				 */
+				void
+				write (uint32_t value, size_t bitCount) noexcept
+				{
+					for ( size_t bit = 0; bit < bitCount; bit++, m_position++ )
+					{
+						if ( ((value >> bit) & 1U) != 0 )
+						{
+							m_data[m_position / 8] |= static_cast< uint8_t >(1U << (m_position % 8));
+						}
+					}
+				}
+
+				/**
+				 * @brief Reads a value.
+				 * @param bitCount The number of bits of the value.
+				 * @return uint32_t
+				 */
+				[[nodiscard]]
+				uint32_t
+				read (size_t bitCount) noexcept
+				{
+					uint32_t value = 0;
+
+					for ( size_t bit = 0; bit < bitCount; bit++, m_position++ )
+					{
+						value |= static_cast< uint32_t >((m_data[m_position / 8] >> (m_position % 8)) & 1U) << bit;
+					}
+
+					return value;
+				}
+
+			private:
+
+				uint8_t * m_data;
+				size_t m_position{0};
+		};
+
+		/**
+		 * @brief Returns the BC7 interpolated value between two endpoints.
+		 * @param value0 The first endpoint.
+		 * @param value1 The second endpoint.
+		 * @param index The 4-bit index.
+		 * @return int32_t
+		 */
+		[[nodiscard]]
+		int32_t
+		interpolateBC7 (int32_t value0, int32_t value1, size_t index) noexcept
+		{
+			return ((64 - BC7Weights[index]) * value0 + BC7Weights[index] * value1 + 32) >> 6;
+		}
+
+		/**
+		 * @brief Quantizes BC7 mode 6 endpoints for given parity bits, then assigns the indices.
+		 * @param block A reference to the block.
+		 * @param first The first endpoint.
+		 * @param second The second endpoint.
+		 * @param parityBits The two parity bits.
+		 * @param quantized A reference to the 7-bit quantized endpoints.
+		 * @param indices A reference to the index array.
+		 * @return int32_t The squared error.
+		 */
+		int32_t
+		quantizeBC7Mode6 (const Block & block, const std::array< float, 4 > & first, const std::array< float, 4 > & second, const std::array< uint32_t, 2 > & parityBits, std::array< std::array< int32_t, 4 >, 2 > & quantized, std::array< uint8_t, 16 > & indices) noexcept
+		{
+			std::array< std::array< int32_t, 4 >, 2 > endpoints{};
+
+			for ( size_t channel = 0; channel < 4; channel++ )
+			{
+				const std::array< float, 2 > values{first[channel], second[channel]};
+
+				for ( size_t endpoint = 0; endpoint < 2; endpoint++ )
+				{
+					quantized[endpoint][channel] = std::clamp(static_cast< int32_t >(std::lround((values[endpoint] - static_cast< float >(parityBits[endpoint])) / 2.0F)), 0, 127);
+					endpoints[endpoint][channel] = (quantized[endpoint][channel] << 1) | static_cast< int32_t >(parityBits[endpoint]);
+				}
+			}
+
+			/* NOTE: Indices are chosen by projection on the endpoint segment, then by checking the two neighbours. */
+			std::array< int32_t, 4 > direction{};
+			int32_t directionLength2 = 0;
+
+			for ( size_t channel = 0; channel < 4; channel++ )
+			{
+				direction[channel] = endpoints[1][channel] - endpoints[0][channel];
+				directionLength2 += direction[channel] * direction[channel];
+			}
+
+			int32_t totalError = 0;
+
+			for ( size_t pixelIndex = 0; pixelIndex < block.size(); pixelIndex++ )
+			{
+				size_t guess = 0;
+
+				if ( directionLength2 > 0 )
+				{
+					int32_t dot = 0;
+
+					for ( size_t channel = 0; channel < 4; channel++ )
+					{
+						dot += (static_cast< int32_t >(block[pixelIndex][channel]) - endpoints[0][channel]) * direction[channel];
+					}
+
+					guess = static_cast< size_t >(std::clamp(static_cast< int32_t >(std::lround(15.0F * static_cast< float >(dot) / static_cast< float >(directionLength2))), 0, 15));
+				}
+
+				auto bestError = std::numeric_limits< int32_t >::max();
+
+				for ( auto index = guess > 0 ? guess - 1 : guess; index <= std::min< size_t >(guess + 1, 15); index++ )
+				{
+					int32_t error = 0;
+
+					for ( size_t channel = 0; channel < 4; channel++ )
+					{
+						const auto difference = static_cast< int32_t >(block[pixelIndex][channel]) - interpolateBC7(endpoints[0][channel], endpoints[1][channel], index);
+
+						error += difference * difference;
+					}
+
+					if ( error < bestError )
+					{
+						bestError = error;
+						indices[pixelIndex] = static_cast< uint8_t >(index);
+					}
+				}
+
+				totalError += bestError;
+			}
+
+			return totalError;
+		}
+
+		/**
+		 * @brief Encodes a block to BC7 using the mode 6 (one subset, RGBA 7.7.7.7 endpoints with a parity bit, 4-bit indices).
+		 * @param block A reference to the block.
+		 * @param output A pointer to the 16 bytes of the block.
+		 * @return void
+		 */
+		void
+		encodeBC7 (const Block & block, uint8_t * output) noexcept
+		{
+			std::array< std::array< float, 4 >, 16 > points{};
+
+			for ( size_t pixelIndex = 0; pixelIndex < block.size(); pixelIndex++ )
+			{
+				for ( size_t channel = 0; channel < 4; channel++ )
+				{
+					points[pixelIndex][channel] = static_cast< float >(block[pixelIndex][channel]);
+				}
+			}
+
+			std::array< float, 4 > first{};
+			std::array< float, 4 > second{};
+
+			principalEndpoints(points, points.size(), first, second);
+
+			auto bestError = std::numeric_limits< int32_t >::max();
+			std::array< std::array< int32_t, 4 >, 2 > bestEndpoints{};
+			std::array< uint32_t, 2 > bestParityBits{};
+			std::array< uint8_t, 16 > bestIndices{};
+
+			/* NOTE: The first pass uses the principal axis extremities, the second one the least squares refinement. */
+			for ( size_t pass = 0; pass < 2; pass++ )
+			{
+				for ( uint32_t parityCombination = 0; parityCombination < 4; parityCombination++ )
+				{
+					const std::array< uint32_t, 2 > parityBits{parityCombination & 1U, parityCombination >> 1};
+					std::array< std::array< int32_t, 4 >, 2 > quantized{};
+					std::array< uint8_t, 16 > indices{};
+
+					const auto error = quantizeBC7Mode6(block, first, second, parityBits, quantized, indices);
+
+					if ( error < bestError )
+					{
+						bestError = error;
+						bestEndpoints = quantized;
+						bestParityBits = parityBits;
+						bestIndices = indices;
+					}
+				}
+
+				if ( bestError == 0 )
+				{
+					break;
+				}
+
+				std::array< float, 16 > factors{};
+
+				for ( size_t pixelIndex = 0; pixelIndex < block.size(); pixelIndex++ )
+				{
+					factors[pixelIndex] = static_cast< float >(BC7Weights[bestIndices[pixelIndex]]) / 64.0F;
+				}
+
+				if ( !solveEndpoints(points, factors, points.size(), first, second) )
+				{
+					break;
+				}
+			}
+
+			/* NOTE: The most significant bit of the first index is implicit and must be zero. */
+			if ( (bestIndices[0] & 0x08) != 0 )
+			{
+				std::swap(bestEndpoints[0], bestEndpoints[1]);
+				std::swap(bestParityBits[0], bestParityBits[1]);
+
+				for ( auto & index : bestIndices )
+				{
+					index = static_cast< uint8_t >(15 - index);
+				}
+			}
+
+			std::memset(output, 0, 16);
+
+			BitStream stream{output};
+			stream.write(1U << 6, 7);
+
+			for ( size_t channel = 0; channel < 4; channel++ )
+			{
+				stream.write(static_cast< uint32_t >(bestEndpoints[0][channel]), 7);
+				stream.write(static_cast< uint32_t >(bestEndpoints[1][channel]), 7);
+			}
+
+			stream.write(bestParityBits[0], 1);
+			stream.write(bestParityBits[1], 1);
+
+			for ( size_t pixelIndex = 0; pixelIndex < bestIndices.size(); pixelIndex++ )
+			{
+				stream.write(bestIndices[pixelIndex], pixelIndex == 0 ? 3 : 4);
+			}
+		}
+
+		/**
+		 * @brief Encodes a block to the requested format.
+		 * @param block A reference to the block.
+		 * @param format The block format.
+		 * @param output A pointer to the block bytes.
+		 * @return void
+		 */
+		void
+		encodeBlock (const Block & block, BlockFormat format, uint8_t * output) noexcept
+		{
+			switch ( format )
+			{
+				case BlockFormat::BC1 :
+					encodeBC1(block, false, output);
+					break;
+
+				case BlockFormat::BC3 :
+					encodeBC4(block, 3, output);
+					encodeBC1(block, true, output + 8);
+					break;
+
+				case BlockFormat::BC4 :
+					encodeBC4(block, 0, output);
+					break;
+
+				case BlockFormat::BC5 :
+					encodeBC4(block, 0, output);
+					encodeBC4(block, 1, output + 8);
+					break;
+
+				case BlockFormat::BC7 :
+					encodeBC7(block, output);
+					break;
+			}
+		}
+
+		/**
+		 * @brief Decodes the color part of a BC1 block.
+		 * @param input A pointer to the 8 bytes of the block.
+		 * @param fourColors Force the four colors mode, as in BC3.
+		 * @param block A reference to the block.
+		 * @return void
+		 */
+		void
+		decodeBC1 (const uint8_t * input, bool fourColors, Block & block) noexcept
+		{
+			const auto color0 = static_cast< uint16_t >(input[0] | (input[1] << 8));
+			const auto color1 = static_cast< uint16_t >(input[2] | (input[3] << 8));
+			const auto palette = getBC1Palette(color0, color1, fourColors);
+			const auto packedIndices = static_cast< uint32_t >(input[4] | (input[5] << 8) | (input[6] << 16) | (static_cast< uint32_t >(input[7]) << 24));
+
+			for ( size_t pixelIndex = 0; pixelIndex < block.size(); pixelIndex++ )
+			{
+				const auto index = (packedIndices >> (pixelIndex * 2)) & 0x03;
+
+				for ( size_t channel = 0; channel < 3; channel++ )
+				{
+					block[pixelIndex][channel] = static_cast< uint8_t >(palette[index][channel]);
+				}
+
+				block[pixelIndex][3] = !fourColors && color0 <= color1 && index == 3 ? 0 : 255;
+			}
+		}
+
+		/**
+		 * @brief Decodes a BC4 block to one channel.
+		 * @param input A pointer to the 8 bytes of the block.
+		 * @param channel The channel to write.
+		 * @param block A reference to the block.
+		 * @return void
+		 */
+		void
+		decodeBC4 (const uint8_t * input, size_t channel, Block & block) noexcept
+		{
+			const auto palette = getBC4Palette(input[0], input[1]);
+
+			uint64_t packedIndices = 0;
+
+			for ( size_t byteIndex = 0; byteIndex < 6; byteIndex++ )
+			{
+				packedIndices |= static_cast< uint64_t >(input[2 + byteIndex]) << (byteIndex * 8);
+			}
+
+			for ( size_t pixelIndex = 0; pixelIndex < block.size(); pixelIndex++ )
+			{
+				block[pixelIndex][channel] = static_cast< uint8_t >(palette[(packedIndices >> (pixelIndex * 3)) & 0x07]);
+			}
+		}
+
+		/**
+		 * @brief Decodes a BC7 mode 6 block.
+		 * @param input A pointer to the 16 bytes of the block.
+		 * @param block A reference to the block.
+		 * @return bool
+		 */
+		bool
+		decodeBC7 (const uint8_t * input, Block & block) noexcept
+		{
+			std::array< uint8_t, 16 > copy{};
+			std::memcpy(copy.data(), input, copy.size());
+
+			BitStream stream{copy.data()};
+
+			if ( stream.read(7) != (1U << 6) )
+			{
+				return false;
+			}
+
+			std::array< std::array< int32_t, 4 >, 2 > endpoints{};
+
+			for ( size_t channel = 0; channel < 4; channel++ )
+			{
+				endpoints[0][channel] = static_cast< int32_t >(stream.read(7)) << 1;
+				endpoints[1][channel] = static_cast< int32_t >(stream.read(7)) << 1;
+			}
+
+			const auto parityBit0 = static_cast< int32_t >(stream.read(1));
+			const auto parityBit1 = static_cast< int32_t >(stream.read(1));
+
+			for ( size_t channel = 0; channel < 4; channel++ )
+			{
+				endpoints[0][channel] |= parityBit0;
+				endpoints[1][channel] |= parityBit1;
+			}
+
+			for ( size_t pixelIndex = 0; pixelIndex < block.size(); pixelIndex++ )
+			{
+				const auto index = stream.read(pixelIndex == 0 ? 3 : 4);
+
+				for ( size_t channel = 0; channel < 4; channel++ )
+				{
+					block[pixelIndex][channel] = static_cast< uint8_t >(interpolateBC7(endpoints[0][channel], endpoints[1][channel], index));
+				}
+			}
+
+			return true;
+		}
+	}
+
+	const char *
+	to_cstring (BlockFormat value) noexcept
+	{
+		switch ( value )
+		{
+			case BlockFormat::BC1 :
+				return "BC1";
+
+			case BlockFormat::BC3 :
+				return "BC3";
+
+			case BlockFormat::BC4 :
+				return "BC4";
+
+			case BlockFormat::BC5 :
+				return "BC5";
+
+			case BlockFormat::BC7 :
+				return "BC7";
+		}
+
+		return "Unknown";
+	}
+
+	bool
+	compress (const Pixmap< uint8_t > & pixmap, BlockFormat format, std::span< uint8_t > output) noexcept
+	{
+		if ( !pixmap.isValid() )
+		{
+			std::cerr << __PRETTY_FUNCTION__ << ", the pixmap is invalid !" "\n";
+
+			return false;
+		}
+
+		if ( output.size() < getCompressedBytes(format, pixmap.width(), pixmap.height()) )
+		{
+			std::cerr << __PRETTY_FUNCTION__ << ", the output is too small (" << output.size() << " bytes) !" "\n";
+
+			return false;
+		}
+
+		const auto blockColumns = (static_cast< size_t >(pixmap.width()) + BlockSide - 1) / BlockSide;
+		const auto blockRows = (static_cast< size_t >(pixmap.height()) + BlockSide - 1) / BlockSide;
+		const auto blockBytes = getBlockBytes(format);
+		const auto rawChannels = format == BlockFormat::BC4 || format == BlockFormat::BC5;
+
+		const auto compressRows = [&] (size_t firstRow, size_t lastRow) {
+			Block block{};
+
+			for ( auto blockY = firstRow; blockY < lastRow; blockY++ )
+			{
+				for ( size_t blockX = 0; blockX < blockColumns; blockX++ )
+				{
+					fetchBlock(pixmap, blockX, blockY, rawChannels, block);
+					encodeBlock(block, format, output.data() + (blockY * blockColumns + blockX) * blockBytes);
+				}
+			}
+		};
+
+		auto * threadPool = ThreadPool::shared();
+
+		if ( threadPool == nullptr || threadPool->workerCount() == 0 || blockRows < 2 )
+		{
+			compressRows(0, blockRows);
+
+			return true;
+		}
+
+		/* NOTE: Each job writes its own range of block rows, the calling thread takes part in the work. */
+		const auto rangeCount = threadPool->workerCount() + 1;
+
+		threadPool->parallelFor(0, blockRows, compressRows, (blockRows + rangeCount - 1) / rangeCount);
+
+		return true;
+	}
+
+	bool
+	compress (const Pixmap< uint8_t > & pixmap, BlockFormat format, std::vector< uint8_t > & output) noexcept
+	{
+		output.resize(getCompressedBytes(format, pixmap.width(), pixmap.height()));
+
+		if ( !compress(pixmap, format, std::span< uint8_t >{output}) )
+		{
+			output.clear();
+
+			return false;
+		}
+
+		return true;
+	}
+
+	bool
+	decompress (BlockFormat format, uint32_t width, uint32_t height, std::span< const uint8_t > data, Pixmap< uint8_t > & pixmap) noexcept
+	{
+		if ( data.size() < getCompressedBytes(format, width, height) )
+		{
+			std::cerr << __PRETTY_FUNCTION__ << ", the compressed data is too small (" << data.size() << " bytes) !" "\n";
+
+			return false;
+		}
+
+		const auto channelCount = getChannelCount(format);
+		const auto channelMode = channelCount == 1 ? ChannelMode::Grayscale : (channelCount == 2 ? ChannelMode::GrayscaleAlpha : ChannelMode::RGBA);
+
+		if ( !pixmap.initialize(width, height, channelMode) )
+		{
+			std::cerr << __PRETTY_FUNCTION__ << ", unable to initialize the pixmap !" "\n";
+
+			return false;
+		}
+
+		const auto blockColumns = (static_cast< size_t >(width) + BlockSide - 1) / BlockSide;
+		const auto blockRows = (static_cast< size_t >(height) + BlockSide - 1) / BlockSide;
+		const auto blockBytes = getBlockBytes(format);
+
+		Block block{};
+
+		for ( size_t blockY = 0; blockY < blockRows; blockY++ )
+		{
+			for ( size_t blockX = 0; blockX < blockColumns; blockX++ )
+			{
+				const auto * input = data.data() + (blockY * blockColumns + blockX) * blockBytes;
+
+				switch ( format )
+				{
+					case BlockFormat::BC1 :
+						decodeBC1(input, false, block);
+						break;
+
+					case BlockFormat::BC3 :
+						decodeBC1(input + 8, true, block);
+						decodeBC4(input, 3, block);
+						break;
+
+					case BlockFormat::BC4 :
+						decodeBC4(input, 0, block);
+						break;
+
+					case BlockFormat::BC5 :
+						decodeBC4(input, 0, block);
+						decodeBC4(input + 8, 1, block);
+						break;
+
+					case BlockFormat::BC7 :
+						if ( !decodeBC7(input, block) )
+						{
+							std::cerr << __PRETTY_FUNCTION__ << ", unsupported BC7 block mode !" "\n";
+
+							return false;
+						}
+						break;
+				}
+
+				for ( size_t row = 0; row < BlockSide; row++ )
+				{
+					const auto coordY = blockY * BlockSide + row;
+
+					if ( coordY >= height )
+					{
+						break;
+					}
+
+					for ( size_t column = 0; column < BlockSide; column++ )
+					{
+						const auto coordX = blockX * BlockSide + column;
+
+						if ( coordX >= width )
+						{
+							break;
+						}
+
+						auto * pixel = pixmap.pixelPointer(static_cast< uint32_t >(coordX), static_cast< uint32_t >(coordY));
+
+						std::memcpy(pixel, block[row * BlockSide + column].data(), channelCount);
+					}
+				}
+			}
+		}
+
+		return true;
+	}
+}
@@ -0,0 +1,172 @@
+/*
+ * src/Libs/PixelFactory/BlockCompression.hpp
+ * This file is part of Emeraude-Engine
+ *
+ * Copyright (C) 2010-2025 - Sébastien Léon Claude Christian Bémelmans "LondNoir" <londnoir@gmail.com>
+ *
+ * Emeraude-Engine is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * Emeraude-Engine is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with Emeraude-Engine; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * Complete project and additional information can be found at :
+ * https://github.com/londnoir/emeraude-engine
+ *
+ * --- THIS IS AUTOMATICALLY GENERATED, DO NOT CHANGE ---
+ */
+
+#pragma once
+
+/* STL inclusions. */
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <vector>
+
+/* Local inclusions for usages. */
+#include "Pixmap.hpp"
+
+namespace EmEn::Libs::PixelFactory
+{
+	/**
+	 * @brief Enumerate the GPU block compression formats.
+	 * @note Every format encodes blocks of 4x4 pixels.
+	 *  - BC1 : RGB with an optional 1-bit alpha, 8 bytes per block.
+	 *  - BC3 : RGB with an interpolated alpha, 16 bytes per block.
+	 *  - BC4 : One channel, 8 bytes per block.
+	 *  - BC5 : Two channels, 16 bytes per block.
+	 *  - BC7 : RGBA with high quality, 16 bytes per block.
+	 */
+	enum class BlockFormat : uint8_t
+	{
+		BC1 = 1,
+		BC3 = 3,
+		BC4 = 4,
+		BC5 = 5,
+		BC7 = 7
+	};
+
+	/** @brief The side size in pixels of a compressed block. */
+	static constexpr size_t BlockSide{4};
+
+	/**
+	 * @brief Converts a block format enumeration value to the corresponding string.
+	 * @param value The enumeration value.
+	 * @return const char *
+	 */
+	[[nodiscard]]
+	const char * to_cstring (BlockFormat value) noexcept;
+
+	/**
+	 * @brief Returns a string version of the enum value.
+	 * @param value The enum value.
+	 * @return std::string
+	 */
+	[[nodiscard]]
+	inline
+	std::string
+	to_string (BlockFormat value) noexcept
+	{
+		return {to_cstring(value)};
+	}
+
+	/**
+	 * @brief Returns the size in bytes of one compressed block.
+	 * @param format The block format.
+	 * @return size_t
+	 */
+	[[nodiscard]]
+	constexpr
+	size_t
+	getBlockBytes (BlockFormat format) noexcept
+	{
+		return format == BlockFormat::BC1 || format == BlockFormat::BC4 ? 8 : 16;
+	}
+
+	/**
+	 * @brief Returns the size in bytes of a compressed image.
+	 * @note An incomplete block on the right or bottom border still occupies a whole block.
+	 * @param format The block format.
+	 * @param width The image width in pixels.
+	 * @param height The image height in pixels.
+	 * @return size_t
+	 */
+	[[nodiscard]]
+	constexpr
+	size_t
+	getCompressedBytes (BlockFormat format, size_t width, size_t height) noexcept
+	{
+		return ((width + BlockSide - 1) / BlockSide) * ((height + BlockSide - 1) / BlockSide) * getBlockBytes(format);
+	}
+
+	/**
+	 * @brief Returns the number of channels of a pixmap preserved by a block format.
+	 * @param format The block format.
+	 * @return size_t
+	 */
+	[[nodiscard]]
+	constexpr
+	size_t
+	getChannelCount (BlockFormat format) noexcept
+	{
+		switch ( format )
+		{
+			case BlockFormat::BC4 :
+				return 1;
+
+			case BlockFormat::BC5 :
+				return 2;
+
+			default :
+				return 4;
+		}
+	}
+
+	/**
+	 * @brief Compresses a pixmap to a block format.
+	 * @note The pixmap channels are read this way :
+	 *  - BC1, BC3, BC7 : The pixel is expanded to RGBA, a grayscale value fills the three color channels.
+	 *  - BC4 : The first channel.
+	 *  - BC5 : The first two channels, a grayscale pixmap repeats its only channel.
+	 * With BC1, pixels with an alpha below 128 are encoded as fully transparent.
+	 * Border blocks are completed by repeating the last row and column.
+	 * @param pixmap A reference to the source pixmap.
+	 * @param format The block format.
+	 * @param output A writable span of at least getCompressedBytes() bytes.
+	 * @note Large pixmaps are compressed by block rows on the shared thread pool when one is declared.
+	 * @return bool
+	 */
+	bool compress (const Pixmap< uint8_t > & pixmap, BlockFormat format, std::span< uint8_t > output) noexcept;
+
+	/**
+	 * @brief Compresses a pixmap to a block format.
+	 * @param pixmap A reference to the source pixmap.
+	 * @param format The block format.
+	 * @param output A reference to a byte vector, resized to getCompressedBytes().
+	 * @return bool
+	 */
+	bool compress (const Pixmap< uint8_t > & pixmap, BlockFormat format, std::vector< uint8_t > & output) noexcept;
+
+	/**
+	 * @brief Decompresses block compressed data to a pixmap.
+	 * @note The output pixmap is RGBA for BC1, BC3 and BC7, grayscale for BC4 and grayscale with alpha for BC5.
+	 * The BC7 decoder only handles the mode 6 produced by compress(), other blocks make the decoding fail.
+	 * @param format The block format.
+	 * @param width The image width in pixels.
+	 * @param height The image height in pixels.
+	 * @param data A span of compressed data of getCompressedBytes() bytes.
+	 * @param pixmap A reference to the output pixmap.
+	 * @return bool
+	 */
+	bool decompress (BlockFormat format, uint32_t width, uint32_t height, std::span< const uint8_t > data, Pixmap< uint8_t > & pixmap) noexcept;
+}
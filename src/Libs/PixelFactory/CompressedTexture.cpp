@@ -0,0 +1,262 @@
+/*
+ * src/Libs/PixelFactory/CompressedTexture.cpp
+ * This file is part of Emeraude-Engine
+ *
+ * Copyright (C) 2010-2025 - Sébastien Léon Claude Christian Bémelmans "LondNoir" <londnoir@gmail.com>
+ *
+ * Emeraude-Engine is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * Emeraude-Engine is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with Emeraude-Engine; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * Complete project and additional information can be found at :
+ * https://github.com/londnoir/emeraude-engine
+ *
+ * --- THIS IS AUTOMATICALLY GENERATED, DO NOT CHANGE ---
+ */
+
+#include "CompressedTexture.hpp"
+
+/* STL inclusions. */
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+
+/* Local inclusions. */
+#include "Libs/Hash/FNV1a.hpp"
+#include "Libs/IO/IO.hpp"
+#include "Libs/IO/MappedFile.hpp"
+#include "MipChain.hpp"
+
+namespace EmEn::Libs::PixelFactory
+{
+	namespace
+	{
+		/**
+		 * @brief Returns whether a stored value is a known block format.
+		 * @param value The stored value.
+		 * @return bool
+		 */
+		[[nodiscard]]
+		bool
+		isBlockFormat (uint8_t value) noexcept
+		{
+			switch ( static_cast< BlockFormat >(value) )
+			{
+				case BlockFormat::BC1 :
+				case BlockFormat::BC3 :
+				case BlockFormat::BC4 :
+				case BlockFormat::BC5 :
+				case BlockFormat::BC7 :
+					return true;
+			}
+
+			return false;
+		}
+	}
+
+	bool
+	CompressedTexture::build (const Pixmap< uint8_t > & base, BlockFormat format, uint32_t levelCount, bool gammaCorrect) noexcept
+	{
+		this->clear();
+
+		std::vector< Pixmap< uint8_t > > reducedLevels;
+
+		if ( !generateMipChain(base, std::max(levelCount, 1U), gammaCorrect, reducedLevels) )
+		{
+			std::cerr << __PRETTY_FUNCTION__ << ", unable to generate the mip chain !" "\n";
+
+			return false;
+		}
+
+		/* NOTE: Lay out every level before compressing them in place. */
+		m_levels.resize(1 + reducedLevels.size());
+
+		uint64_t offset = 0;
+
+		for ( size_t levelIndex = 0; levelIndex < m_levels.size(); levelIndex++ )
+		{
+			const auto & pixmap = levelIndex == 0 ? base : reducedLevels[levelIndex - 1];
+			auto & level = m_levels[levelIndex];
+
+			level.width = pixmap.width();
+			level.height = pixmap.height();
+			level.offset = offset;
+			level.bytes = getCompressedBytes(format, pixmap.width(), pixmap.height());
+
+			offset = (offset + level.bytes + LevelAlignment - 1) / LevelAlignment * LevelAlignment;
+		}
+
+		m_data.resize(offset);
+
+		for ( size_t levelIndex = 0; levelIndex < m_levels.size(); levelIndex++ )
+		{
+			const auto & pixmap = levelIndex == 0 ? base : reducedLevels[levelIndex - 1];
+			const auto & level = m_levels[levelIndex];
+
+			if ( !compress(pixmap, format, std::span< uint8_t >{m_data}.subspan(level.offset, level.bytes)) )
+			{
+				std::cerr << __PRETTY_FUNCTION__ << ", unable to compress the level #" << levelIndex << " !" "\n";
+
+				this->clear();
+
+				return false;
+			}
+		}
+
+		m_sourceHash = computeSourceHash(base);
+		m_format = format;
+		m_gammaCorrect = gammaCorrect;
+
+		return true;
+	}
+
+	bool
+	CompressedTexture::readFile (const std::filesystem::path & filepath) noexcept
+	{
+		this->clear();
+
+		IO::MappedFile file;
+
+		if ( !file.open(filepath) )
+		{
+			return false;
+		}
+
+		if ( file.size() < sizeof(FileHeader) )
+		{
+			std::cerr << __PRETTY_FUNCTION__ << ", the file " << filepath << " is too small !" "\n";
+
+			return false;
+		}
+
+		FileHeader header{};
+		std::memcpy(&header, file.data(), sizeof(FileHeader));
+
+		if ( header.magic != Magic || !IO::isNativeByteOrder(header.byteOrderMark) )
+		{
+			std::cerr << __PRETTY_FUNCTION__ << ", the file " << filepath << " is not a compressed texture !" "\n";
+
+			return false;
+		}
+
+		/* NOTE: An older version is not an error, the caller will rebuild the file. */
+		if ( header.version != Version )
+		{
+			return false;
+		}
+
+		if ( !isBlockFormat(header.format) || header.levelCount == 0 || header.levelCount > 32 )
+		{
+			std::cerr << __PRETTY_FUNCTION__ << ", the file " << filepath << " has an invalid header !" "\n";
+
+			return false;
+		}
+
+		const auto format = static_cast< BlockFormat >(header.format);
+		const auto dataOffset = getDataOffset(header.levelCount);
+
+		if ( dataOffset > file.size() || header.dataBytes > file.size() - dataOffset )
+		{
+			std::cerr << __PRETTY_FUNCTION__ << ", the file " << filepath << " is truncated !" "\n";
+
+			return false;
+		}
+
+		std::vector< CompressedLevel > levels(header.levelCount);
+		std::memcpy(levels.data(), file.data() + sizeof(FileHeader), levels.size() * sizeof(CompressedLevel));
+
+		for ( size_t levelIndex = 0; levelIndex < levels.size(); levelIndex++ )
+		{
+			const auto & level = levels[levelIndex];
+			const auto expectedWidth = levelIndex == 0 ? level.width : std::max(1U, levels[0].width >> levelIndex);
+			const auto expectedHeight = levelIndex == 0 ? level.height : std::max(1U, levels[0].height >> levelIndex);
+
+			if ( level.width == 0 || level.height == 0 || level.width != expectedWidth || level.height != expectedHeight ||
+				level.offset % LevelAlignment != 0 || level.bytes != getCompressedBytes(format, level.width, level.height) ||
+				level.offset > header.dataBytes || level.bytes > header.dataBytes - level.offset )
+			{
+				std::cerr << __PRETTY_FUNCTION__ << ", the level #" << levelIndex << " of the file " << filepath << " is invalid !" "\n";
+
+				return false;
+			}
+		}
+
+		m_levels = std::move(levels);
+		m_data.resize(header.dataBytes);
+		std::memcpy(m_data.data(), file.data() + dataOffset, m_data.size());
+		m_sourceHash = header.sourceHash;
+		m_format = format;
+		m_gammaCorrect = header.gammaCorrect != 0;
+
+		return true;
+	}
+
+	bool
+	CompressedTexture::writeFile (const std::filesystem::path & filepath) const noexcept
+	{
+		if ( !this->isValid() )
+		{
+			std::cerr << __PRETTY_FUNCTION__ << ", the compressed texture is empty !" "\n";
+
+			return false;
+		}
+
+		const FileHeader header{
+			.magic = Magic,
+			.version = Version,
+			.byteOrderMark = IO::ByteOrderMark,
+			.sourceHash = m_sourceHash,
+			.format = static_cast< uint8_t >(m_format),
+			.gammaCorrect = static_cast< uint8_t >(m_gammaCorrect ? 1 : 0),
+			.reserved = 0,
+			.levelCount = static_cast< uint32_t >(m_levels.size()),
+			.dataBytes = m_data.size()
+		};
+
+		return IO::writeFileAtomically(filepath, [&] (std::ofstream & file) {
+			static constexpr std::array< char, LevelAlignment > Zeros{};
+
+			const auto tableEnd = sizeof(FileHeader) + m_levels.size() * sizeof(CompressedLevel);
+
+			file.write(reinterpret_cast< const char * >(&header), sizeof(FileHeader));
+			file.write(reinterpret_cast< const char * >(m_levels.data()), static_cast< std::streamsize >(m_levels.size() * sizeof(CompressedLevel)));
+			file.write(Zeros.data(), static_cast< std::streamsize >(getDataOffset(m_levels.size()) - tableEnd));
+			file.write(reinterpret_cast< const char * >(m_data.data()), static_cast< std::streamsize >(m_data.size()));
+
+			return true;
+		});
+	}
+
+	void
+	CompressedTexture::clear () noexcept
+	{
+		m_levels.clear();
+		m_data.clear();
+		m_sourceHash = 0;
+		m_format = BlockFormat::BC1;
+		m_gammaCorrect = true;
+	}
+
+	uint64_t
+	CompressedTexture::computeSourceHash (const Pixmap< uint8_t > & pixmap) noexcept
+	{
+		Hash::FNV1a hash;
+		hash.mix(pixmap.width());
+		hash.mix(pixmap.height());
+		hash.mix(static_cast< uint64_t >(pixmap.channelMode()));
+		hash.update(pixmap.data().data(), pixmap.data().size());
+
+		return hash.value();
+	}
+}
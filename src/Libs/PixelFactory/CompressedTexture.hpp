@@ -0,0 +1,274 @@
+/*
+ * src/Libs/PixelFactory/CompressedTexture.hpp
+ * This file is part of Emeraude-Engine
+ *
+ * Copyright (C) 2010-2025 - Sébastien Léon Claude Christian Bémelmans "LondNoir" <londnoir@gmail.com>
+ *
+ * Emeraude-Engine is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * Emeraude-Engine is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with Emeraude-Engine; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * Complete project and additional information can be found at :
+ * https://github.com/londnoir/emeraude-engine
+ *
+ * --- THIS IS AUTOMATICALLY GENERATED, DO NOT CHANGE ---
+ */
+
+#pragma once
+
+/* STL inclusions. */
+#include <cstddef>
+#include <cstdint>
+#include <array>
+#include <filesystem>
+#include <span>
+#include <vector>
+
+/* Local inclusions for usages. */
+#include "BlockCompression.hpp"
+#include "Pixmap.hpp"
+
+namespace EmEn::Libs::PixelFactory
+{
+	/**
+	 * @brief Describes one mip level inside the compressed data.
+	 */
+	struct CompressedLevel
+	{
+		uint32_t width{0};
+		uint32_t height{0};
+		uint64_t offset{0};
+		uint64_t bytes{0};
+	};
+
+	/**
+	 * @brief A block compressed image with its complete or partial mip chain, ready to be copied to the GPU.
+	 * @note The file version is a little container with a header, the level table and the levels data, each level being
+	 * aligned on 16 bytes. The header stores a hash of the source pixels, so a cached file can be checked against its source.
+	 */
+	class CompressedTexture final
+	{
+		public:
+
+			/** @brief Class identifier. */
+			static constexpr auto ClassId{"CompressedTexture"};
+
+			/** @brief The file signature. */
+			static constexpr std::array< char, 8 > Magic{'E', 'M', 'T', 'E', 'X', '\0', '\r', '\n'};
+			/** @brief The current format version. It must be increased when the encoders output changes to invalidate caches. */
+			static constexpr uint32_t Version{1};
+			/** @brief The alignment of every level in the file. */
+			static constexpr size_t LevelAlignment{16};
+
+			/**
+			 * @brief Constructs an empty compressed texture.
+			 */
+			CompressedTexture () noexcept = default;
+
+			/**
+			 * @brief Builds the mip chain of a pixmap and compresses every level.
+			 * @param base A reference to the base level pixmap.
+			 * @param format The block format.
+			 * @param levelCount The total level count desired, the base level included. It is clamped to the complete chain.
+			 * @param gammaCorrect Treat color channels as sRGB encoded values when reducing the levels.
+			 * @return bool
+			 */
+			bool build (const Pixmap< uint8_t > & base, BlockFormat format, uint32_t levelCount, bool gammaCorrect) noexcept;
+
+			/**
+			 * @brief Reads a compressed texture file.
+			 * @param filepath A reference to a filesystem path.
+			 * @return bool
+			 */
+			bool readFile (const std::filesystem::path & filepath) noexcept;
+
+			/**
+			 * @brief Writes the compressed texture to a file.
+			 * @note The file is written beside and renamed at the end, so an interrupted write never leaves a truncated file.
+			 * @param filepath A reference to a filesystem path.
+			 * @return bool
+			 */
+			[[nodiscard]]
+			bool writeFile (const std::filesystem::path & filepath) const noexcept;
+
+			/**
+			 * @brief Clears the compressed texture.
+			 * @return void
+			 */
+			void clear () noexcept;
+
+			/**
+			 * @brief Returns whether the compressed texture holds data.
+			 * @return bool
+			 */
+			[[nodiscard]]
+			bool
+			isValid () const noexcept
+			{
+				return !m_levels.empty();
+			}
+
+			/**
+			 * @brief Returns the block format.
+			 * @return BlockFormat
+			 */
+			[[nodiscard]]
+			BlockFormat
+			format () const noexcept
+			{
+				return m_format;
+			}
+
+			/**
+			 * @brief Returns whether the levels were reduced with the gamma correction.
+			 * @return bool
+			 */
+			[[nodiscard]]
+			bool
+			isGammaCorrected () const noexcept
+			{
+				return m_gammaCorrect;
+			}
+
+			/**
+			 * @brief Returns the hash of the source pixmap.
+			 * @return uint64_t
+			 */
+			[[nodiscard]]
+			uint64_t
+			sourceHash () const noexcept
+			{
+				return m_sourceHash;
+			}
+
+			/**
+			 * @brief Returns the width of the base level.
+			 * @return uint32_t
+			 */
+			[[nodiscard]]
+			uint32_t
+			width () const noexcept
+			{
+				return m_levels.empty() ? 0 : m_levels.front().width;
+			}
+
+			/**
+			 * @brief Returns the height of the base level.
+			 * @return uint32_t
+			 */
+			[[nodiscard]]
+			uint32_t
+			height () const noexcept
+			{
+				return m_levels.empty() ? 0 : m_levels.front().height;
+			}
+
+			/**
+			 * @brief Returns the number of levels, the base level included.
+			 * @return uint32_t
+			 */
+			[[nodiscard]]
+			uint32_t
+			levelCount () const noexcept
+			{
+				return static_cast< uint32_t >(m_levels.size());
+			}
+
+			/**
+			 * @brief Returns the level descriptions.
+			 * @return const std::vector< CompressedLevel > &
+			 */
+			[[nodiscard]]
+			const std::vector< CompressedLevel > &
+			levels () const noexcept
+			{
+				return m_levels;
+			}
+
+			/**
+			 * @brief Returns the compressed data of every level, each level at its offset.
+			 * @return std::span< const uint8_t >
+			 */
+			[[nodiscard]]
+			std::span< const uint8_t >
+			data () const noexcept
+			{
+				return m_data;
+			}
+
+			/**
+			 * @brief Returns the compressed data of one level.
+			 * @param level The level index.
+			 * @return std::span< const uint8_t >
+			 */
+			[[nodiscard]]
+			std::span< const uint8_t >
+			levelData (uint32_t level) const noexcept
+			{
+				if ( level >= m_levels.size() )
+				{
+					return {};
+				}
+
+				return std::span< const uint8_t >{m_data}.subspan(m_levels[level].offset, m_levels[level].bytes);
+			}
+
+			/**
+			 * @brief Returns a hash of a pixmap, its dimensions and its channel mode included.
+			 * @param pixmap A reference to a pixmap.
+			 * @return uint64_t
+			 */
+			[[nodiscard]]
+			static uint64_t computeSourceHash (const Pixmap< uint8_t > & pixmap) noexcept;
+
+		private:
+
+			/** @brief The file header. */
+			struct FileHeader
+			{
+				std::array< char, 8 > magic;
+				uint32_t version;
+				uint32_t byteOrderMark;
+				uint64_t sourceHash;
+				uint8_t format;
+				uint8_t gammaCorrect;
+				uint16_t reserved;
+				uint32_t levelCount;
+				uint64_t dataBytes;
+			};
+
+			static_assert(sizeof(FileHeader) == 40);
+			static_assert(sizeof(CompressedLevel) == 24);
+
+			/**
+			 * @brief Returns the offset of the levels data in the file.
+			 * @param levelCount The number of levels.
+			 * @return uint64_t
+			 */
+			[[nodiscard]]
+			static
+			uint64_t
+			getDataOffset (size_t levelCount) noexcept
+			{
+				const auto tableEnd = sizeof(FileHeader) + levelCount * sizeof(CompressedLevel);
+
+				return (tableEnd + LevelAlignment - 1) / LevelAlignment * LevelAlignment;
+			}
+
+			std::vector< CompressedLevel > m_levels;
+			std::vector< uint8_t > m_data;
+			uint64_t m_sourceHash{0};
+			BlockFormat m_format{BlockFormat::BC1};
+			bool m_gammaCorrect{true};
+	};
+}
@@ -0,0 +1,282 @@
+/*
+ * src/Libs/PixelFactory/MipChain.hpp
+ * This file is part of Emeraude-Engine
+ *
+ * Copyright (C) 2010-2025 - Sébastien Léon Claude Christian Bémelmans "LondNoir" <londnoir@gmail.com>
+ *
+ * Emeraude-Engine is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * Emeraude-Engine is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with Emeraude-Engine; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * Complete project and additional information can be found at :
+ * https://github.com/londnoir/emeraude-engine
+ *
+ * --- THIS IS AUTOMATICALLY GENERATED, DO NOT CHANGE ---
+ */
+
+#pragma once
+
+/* STL inclusions. */
+#include <cstddef>
+#include <cstdint>
+#include <cmath>
+#include <algorithm>
+#include <array>
+#include <vector>
+#include <iostream>
+
+/* Local inclusions for usages. */
+#include "Pixmap.hpp"
+
+namespace EmEn::Libs::PixelFactory
+{
+	/**
+	 * @brief Returns the linear intensity of an 8-bit sRGB encoded value.
+	 * @param value The encoded value.
+	 * @return float
+	 */
+	[[nodiscard]]
+	inline
+	float
+	sRGBToLinear (uint8_t value) noexcept
+	{
+		static const auto table = [] {
+			std::array< float, 256 > values{};
+
+			for ( size_t index = 0; index < values.size(); index++ )
+			{
+				const auto encoded = static_cast< float >(index) / 255.0F;
+
+				values[index] = encoded <= 0.04045F ? encoded / 12.92F : std::pow((encoded + 0.055F) / 1.055F, 2.4F);
+			}
+
+			return values;
+		}();
+
+		return table[value];
+	}
+
+	/**
+	 * @brief Returns the 8-bit sRGB encoded value of a linear intensity.
+	 * @note The conversion goes through a 4096 entries table, which is below the 8-bit output precision.
+	 * @param value The linear intensity between 0 and 1.
+	 * @return uint8_t
+	 */
+	[[nodiscard]]
+	inline
+	uint8_t
+	linearToSRGB (float value) noexcept
+	{
+		static constexpr size_t TableSize{4096};
+
+		static const auto table = [] {
+			std::array< uint8_t, TableSize > values{};
+
+			for ( size_t index = 0; index < values.size(); index++ )
+			{
+				const auto linear = static_cast< float >(index) / static_cast< float >(TableSize - 1);
+				const auto encoded = linear <= 0.0031308F ? linear * 12.92F : 1.055F * std::pow(linear, 1.0F / 2.4F) - 0.055F;
+
+				values[index] = static_cast< uint8_t >(std::lround(std::clamp(encoded, 0.0F, 1.0F) * 255.0F));
+			}
+
+			return values;
+		}();
+
+		return table[static_cast< size_t >(std::clamp(value, 0.0F, 1.0F) * static_cast< float >(TableSize - 1) + 0.5F)];
+	}
+
+	/**
+	 * @brief Returns the number of levels of a complete mip chain, the base level included.
+	 * @param width The base level width.
+	 * @param height The base level height.
+	 * @return uint32_t
+	 */
+	[[nodiscard]]
+	inline
+	uint32_t
+	getMipLevelCount (size_t width, size_t height) noexcept
+	{
+		uint32_t levelCount = 1;
+
+		for ( auto size = std::max(width, height); size > 1; size >>= 1 )
+		{
+			levelCount++;
+		}
+
+		return levelCount;
+	}
+
+	/**
+	 * @brief Reduces a pixmap by two on each axis to produce the next mip level.
+	 * @note Each destination pixel is the box average of the 2x2 source pixels it covers. On an odd source dimension,
+	 * the last row or column of the destination also takes the remaining source pixels, so no source pixel is dropped.
+	 * When the gamma correction is enabled, color channels are averaged as linear intensities and weighted by the alpha
+	 * channel, if any, to prevent dark fringes around transparent areas. The alpha channel is always averaged linearly.
+	 * @tparam dimension_t The type of unsigned integer used for pixmap dimension. Default uint32_t.
+	 * @param source A reference to the source pixmap.
+	 * @param destination A reference to the reduced pixmap.
+	 * @param gammaCorrect Treat color channels as sRGB encoded values.
+	 * @return bool
+	 */
+	template< typename dimension_t = uint32_t >
+	bool
+	reduceMipLevel (const Pixmap< uint8_t, dimension_t > & source, Pixmap< uint8_t, dimension_t > & destination, bool gammaCorrect) noexcept
+	{
+		if ( !source.isValid() )
+		{
+			std::cerr << __PRETTY_FUNCTION__ << ", the source pixmap is invalid !" "\n";
+
+			return false;
+		}
+
+		const auto sourceWidth = source.width();
+		const auto sourceHeight = source.height();
+		const auto width = std::max< dimension_t >(1, sourceWidth / 2);
+		const auto height = std::max< dimension_t >(1, sourceHeight / 2);
+
+		if ( !destination.initialize(width, height, source.channelMode()) )
+		{
+			std::cerr << __PRETTY_FUNCTION__ << ", unable to initialize the destination pixmap !" "\n";
+
+			return false;
+		}
+
+		const auto channelCount = source.colorCount();
+		const auto hasAlpha = source.hasAlphaChannel();
+		const auto colorChannelCount = hasAlpha ? channelCount - 1 : channelCount;
+
+		for ( dimension_t coordY = 0; coordY < height; coordY++ )
+		{
+			const dimension_t firstRow = coordY * 2;
+			const dimension_t lastRow = coordY + 1 == height ? sourceHeight - 1 : firstRow + 1;
+
+			for ( dimension_t coordX = 0; coordX < width; coordX++ )
+			{
+				const dimension_t firstColumn = coordX * 2;
+				const dimension_t lastColumn = coordX + 1 == width ? sourceWidth - 1 : firstColumn + 1;
+
+				std::array< float, 4 > sums{0.0F, 0.0F, 0.0F, 0.0F};
+				float weightSum = 0.0F;
+				float sampleCount = 0.0F;
+
+				for ( auto row = firstRow; row <= lastRow; row++ )
+				{
+					for ( auto column = firstColumn; column <= lastColumn; column++ )
+					{
+						const auto * pixel = source.pixelPointer(column, row);
+						const auto alpha = hasAlpha ? static_cast< float >(pixel[colorChannelCount]) / 255.0F : 1.0F;
+						const auto weight = gammaCorrect ? alpha : 1.0F;
+
+						for ( size_t channel = 0; channel < colorChannelCount; channel++ )
+						{
+							sums[channel] += weight * (gammaCorrect ? sRGBToLinear(pixel[channel]) : static_cast< float >(pixel[channel]) / 255.0F);
+						}
+
+						if ( hasAlpha )
+						{
+							sums[colorChannelCount] += alpha;
+						}
+
+						weightSum += weight;
+						sampleCount += 1.0F;
+					}
+				}
+
+				/* NOTE: A fully transparent area has no weight, it keeps an unweighted color average. */
+				if ( weightSum <= 0.0F )
+				{
+					sums.fill(0.0F);
+
+					for ( auto row = firstRow; row <= lastRow; row++ )
+					{
+						for ( auto column = firstColumn; column <= lastColumn; column++ )
+						{
+							const auto * pixel = source.pixelPointer(column, row);
+
+							for ( size_t channel = 0; channel < colorChannelCount; channel++ )
+							{
+								sums[channel] += sRGBToLinear(pixel[channel]);
+							}
+						}
+					}
+
+					weightSum = sampleCount;
+				}
+
+				auto * output = destination.pixelPointer(coordX, coordY);
+
+				for ( size_t channel = 0; channel < colorChannelCount; channel++ )
+				{
+					const auto value = sums[channel] / weightSum;
+
+					output[channel] = gammaCorrect ? linearToSRGB(value) : static_cast< uint8_t >(std::lround(std::clamp(value, 0.0F, 1.0F) * 255.0F));
+				}
+
+				if ( hasAlpha )
+				{
+					output[colorChannelCount] = static_cast< uint8_t >(std::lround(std::clamp(sums[colorChannelCount] / sampleCount, 0.0F, 1.0F) * 255.0F));
+				}
+			}
+		}
+
+		return true;
+	}
+
+	/**
+	 * @brief Generates the mip levels below a base pixmap.
+	 * @note The base level is not copied, the first element of the output is the mip level 1.
+	 * @tparam dimension_t The type of unsigned integer used for pixmap dimension. Default uint32_t.
+	 * @param base A reference to the base level pixmap.
+	 * @param levelCount The total level count desired, the base level included. It is clamped to the complete chain.
+	 * @param gammaCorrect Treat color channels as sRGB encoded values.
+	 * @param levels A reference to a vector of pixmaps to receive the reduced levels.
+	 * @return bool
+	 */
+	template< typename dimension_t = uint32_t >
+	bool
+	generateMipChain (const Pixmap< uint8_t, dimension_t > & base, uint32_t levelCount, bool gammaCorrect, std::vector< Pixmap< uint8_t, dimension_t > > & levels) noexcept
+	{
+		levels.clear();
+
+		if ( !base.isValid() )
+		{
+			std::cerr << __PRETTY_FUNCTION__ << ", the base pixmap is invalid !" "\n";
+
+			return false;
+		}
+
+		levelCount = std::min(levelCount, getMipLevelCount(base.width(), base.height()));
+
+		if ( levelCount <= 1 )
+		{
+			return true;
+		}
+
+		levels.resize(levelCount - 1);
+
+		for ( size_t levelIndex = 0; levelIndex < levels.size(); levelIndex++ )
+		{
+			const auto & source = levelIndex == 0 ? base : levels[levelIndex - 1];
+
+			if ( !reduceMipLevel(source, levels[levelIndex], gammaCorrect) )
+			{
+				levels.clear();
+
+				return false;
+			}
+		}
+
+		return true;
+	}
+}
@@ -38,6 +38,7 @@
 #include "Libs/Math/Space2D/Segment.hpp"
 #include "Libs/Math/Space2D/Circle.hpp"
 #include "Pixmap.hpp"
+#include "ProcessorKernels.hpp"
 
 namespace EmEn::Libs::PixelFactory
 {
@@ -1032,19 +1033,76 @@ namespace EmEn::Libs::PixelFactory
 				switch ( filteringMode )
 				{
 					case FilteringMode::Cubic :
-						resizeCubic(source, width, height, destination);
-						break;
+						return resizeCubic(source, width, height, destination);
 
 					case FilteringMode::Linear :
-						resizeLinear(source, width, height, destination);
-						break;
+						return resizeLinear(source, width, height, destination);
 
 					case FilteringMode::Nearest :
-						resizeNearest(source, width, height, destination);
-						break;
+						return resizeNearest(source, width, height, destination);
 				}
 
-				return true;
+				return false;
+			}
+
+			/**
+			 * @brief Reduces a pixmap with a separable filter, each target pixel averaging all the source pixels it covers.
+			 * @note Unlike resize(), no source pixel is skipped when reducing by more than a half, which suits mipmap generation.
+			 * @param source A reference to a pixmap.
+			 * @param width The new width. It must not be greater than the source width.
+			 * @param height The new height. It must not be greater than the source height.
+			 * @param destination A writable reference to a pixmap.
+			 * @param filter The resampling filter. Default Lanczos.
+			 * @return bool
+			 */
+			[[nodiscard]]
+			static
+			bool
+			downscale (const Pixmap< pixel_data_t, dimension_t > & source, dimension_t width, dimension_t height, Pixmap< pixel_data_t, dimension_t > & destination, ResamplingFilter filter = ResamplingFilter::Lanczos) noexcept
+			{
+				if ( !source.isValid() || width == 0 || height == 0 || width > source.width() || height > source.height() )
+				{
+					return false;
+				}
+
+				if ( width == source.width() && height == source.height() )
+				{
+					destination = source;
+
+					return true;
+				}
+
+				if ( !destination.initialize(width, height, source.channelMode()) )
+				{
+					return false;
+				}
+
+				return Kernels::dispatchChannelCount(source.colorCount(), [&] (auto channelCount) {
+					Kernels::resample< pixel_data_t, channelCount >(source.data().data(), source.width(), source.height(), destination.data().data(), width, height, filter);
+				});
+			}
+
+			/**
+			 * @brief Returns a pixmap reduced with a separable filter.
+			 * @param source A reference to a pixmap.
+			 * @param width The new width. It must not be greater than the source width.
+			 * @param height The new height. It must not be greater than the source height.
+			 * @param filter The resampling filter. Default Lanczos.
+			 * @return Pixmap< pixel_data_t, dimension_t >
+			 */
+			[[nodiscard]]
+			static
+			Pixmap< pixel_data_t, dimension_t >
+			downscale (const Pixmap< pixel_data_t, dimension_t > & source, dimension_t width, dimension_t height, ResamplingFilter filter = ResamplingFilter::Lanczos) noexcept
+			{
+				Pixmap< pixel_data_t, dimension_t > output;
+
+				if ( !Processor::downscale(source, width, height, output, filter) )
+				{
+					return {};
+				}
+
+				return output;
 			}
 
 			/**
@@ -1394,70 +1452,16 @@ namespace EmEn::Libs::PixelFactory
 				{
 					return false;
 				}
-				
-				const auto & srcData = source.data();
-				const auto colorCount = source.colorCount();
-				const auto pixelCount = source.pixelCount();
 
 				if ( !destination.initialize(source.height(), source.width(), source.channelMode()) )
 				{
 					return false;
 				}
 
-				auto & dstData = destination.data();
-
-				/* NOTE: We start from the first row of the source
-				 * to copy to the last column of the target (top to bottom). */
-				size_t coordX = destination.width() - 1;
-				size_t coordY = 0;
-
-				/* NOTE: Per-pixel loop. */
-				for ( size_t pixelIndex = 0; pixelIndex < pixelCount; pixelIndex++ )
-				{
-					const auto sourceIndex = pixelIndex * colorCount;
-					const auto targetIndex = (coordY * destination.width() + coordX) * colorCount;
-
-					switch ( colorCount )
-					{
-						case 4 :
-							dstData[targetIndex] = srcData[sourceIndex];
-							dstData[targetIndex+1] = srcData[sourceIndex+1];
-							dstData[targetIndex+2] = srcData[sourceIndex+2];
-							dstData[targetIndex+3] = srcData[sourceIndex+3];
-							break;
-
-						case 3 :
-							dstData[targetIndex] = srcData[sourceIndex];
-							dstData[targetIndex+1] = srcData[sourceIndex+1];
-							dstData[targetIndex+2] = srcData[sourceIndex+2];
-							break;
-
-						case 2 :
-							dstData[targetIndex] = srcData[sourceIndex];
-							dstData[targetIndex+1] = srcData[sourceIndex+1];
-							break;
-
-						case 1 :
-							dstData[targetIndex] = srcData[sourceIndex];
-							break;
-
-						default:
-							break;
-					}
-
-					/* NOTE: Check the next target pixel coordinates. */
-					if ( coordY >= destination.height() - 1 )
-					{
-						--coordX;
-						coordY = 0;
-					}
-					else
-					{
-						++coordY;
-					}
-				}
-
-				return true;
+				/* NOTE: The first row of the source becomes the last column of the target (top to bottom). */
+				return Kernels::dispatchChannelCount(source.colorCount(), [&] (auto channelCount) {
+					Kernels::rotateQuarter< pixel_data_t, channelCount >(source.data().data(), source.width(), source.height(), destination.data().data(), true);
+				});
 			}
 
 			/**
@@ -1496,69 +1500,13 @@ namespace EmEn::Libs::PixelFactory
 					return false;
 				}
 
-				const auto & srcData = source.data();
-				const auto colorCount = source.colorCount();
-				const auto pixelCount = source.pixelCount();
-
 				if ( !destination.initialize(source.width(), source.height(), source.channelMode()) )
 				{
 					return false;
 				}
 
-				auto & dstData = destination.data();
-
-				/* NOTE: We start from the first row of the source
-				 * to copy to the last row of the target (right to left). */
-				size_t coordX = destination.width() - 1;
-				size_t coordY = destination.height() - 1;
-
-				/* NOTE: Per-pixel loop. */
-				for ( size_t pixelIndex = 0; pixelIndex < pixelCount; pixelIndex++ )
-				{
-					const auto sourceIndex = pixelIndex * colorCount;
-					const auto targetIndex = (coordY * destination.width() + coordX) * colorCount;
-
-					switch ( colorCount )
-					{
-						case 4 :
-							dstData[targetIndex] = srcData[sourceIndex];
-							dstData[targetIndex+1] = srcData[sourceIndex+1];
-							dstData[targetIndex+2] = srcData[sourceIndex+2];
-							dstData[targetIndex+3] = srcData[sourceIndex+3];
-							break;
-
-						case 3 :
-							dstData[targetIndex] = srcData[sourceIndex];
-							dstData[targetIndex+1] = srcData[sourceIndex+1];
-							dstData[targetIndex+2] = srcData[sourceIndex+2];
-							break;
-
-						case 2 :
-							dstData[targetIndex] = srcData[sourceIndex];
-							dstData[targetIndex+1] = srcData[sourceIndex+1];
-							break;
-
-						case 1 :
-							dstData[targetIndex] = srcData[sourceIndex];
-							break;
-
-						default:
-							break;
-					}
-
-					/* NOTE: Check the next target pixel coordinates. */
-					if ( coordX == 0 )
-					{
-						coordX = destination.width() - 1;
-						--coordY;
-					}
-					else
-					{
-						--coordX;
-					}
-				}
-
-				return true;
+				/* NOTE: The first row of the source becomes the last row of the target (right to left). */
+				return Processor::mirrorBoth(source, destination);
 			}
 
 			/**
@@ -1597,69 +1545,15 @@ namespace EmEn::Libs::PixelFactory
 					return false;
 				}
 
-				const auto & srcData = source.data();
-				const auto colorCount = source.colorCount();
-				const auto pixelCount = source.pixelCount();
-
 				if ( !destination.initialize(source.height(), source.width(), source.channelMode()) )
 				{
 					return false;
 				}
 
-				auto & dstData = destination.data();
-
-				/* NOTE: We start from the first row of the source
-				 * to copy to the first column of the target (bottom to top). */
-				size_t coordX = 0;
-				size_t coordY = destination.height() - 1;
-
-				/* NOTE: Per-pixel loop. */
-				for ( size_t pixelIndex = 0; pixelIndex < pixelCount; pixelIndex++ )
-				{
-					const auto sourceIndex = pixelIndex * colorCount;
-					const auto targetIndex = (coordY * destination.width() + coordX) * colorCount;
-
-					switch ( colorCount )
-					{
-						case 4 :
-							dstData[targetIndex] = srcData[sourceIndex];
-							dstData[targetIndex+1] = srcData[sourceIndex+1];
-							dstData[targetIndex+2] = srcData[sourceIndex+2];
-							dstData[targetIndex+3] = srcData[sourceIndex+3];
-							break;
-
-						case 3 :
-							dstData[targetIndex] = srcData[sourceIndex];
-							dstData[targetIndex+1] = srcData[sourceIndex+1];
-							dstData[targetIndex+2] = srcData[sourceIndex+2];
-							break;
-
-						case 2 :
-							dstData[targetIndex] = srcData[sourceIndex];
-							dstData[targetIndex+1] = srcData[sourceIndex+1];
-							break;
-
-						case 1 :
-							dstData[targetIndex] = srcData[sourceIndex];
-							break;
-
-						default:
-							break;
-					}
-
-					/* NOTE: Check the next target pixel coordinates. */
-					if ( coordY == 0 )
-					{
-						++coordX;
-						coordY = destination.height() - 1;
-					}
-					else
-					{
-						--coordY;
-					}
-				}
-
-				return true;
+				/* NOTE: The first row of the source becomes the first column of the target (bottom to top). */
+				return Kernels::dispatchChannelCount(source.colorCount(), [&] (auto channelCount) {
+					Kernels::rotateQuarter< pixel_data_t, channelCount >(source.data().data(), source.width(), source.height(), destination.data().data(), false);
+				});
 			}
 
 			/**
@@ -1823,35 +1717,25 @@ namespace EmEn::Libs::PixelFactory
 					return false;
 				}
 
-				const auto pixelCount = source.template pixelCount< size_t >();
+				const auto alpha = Pixmap< pixel_data_t, dimension_t >::one();
 
 				if ( source.channelMode() == ChannelMode::Grayscale )
 				{
-					destination.initialize(source.width(), source.height(), ChannelMode::GrayscaleAlpha);
-
-					for ( size_t index = 0; index < pixelCount; index++ )
+					if ( !destination.initialize(source.width(), source.height(), ChannelMode::GrayscaleAlpha) )
 					{
-						const auto srcData = source.pixelPointer(index);
-						auto dstData = destination.pixelPointer(index);
-
-						dstData[0] = srcData[0];
-						dstData[1] = Pixmap< pixel_data_t, dimension_t >::one();
+						return false;
 					}
+
+					Kernels::appendAlpha< pixel_data_t, 1 >(source.data().data(), destination.data().data(), source.width(), source.height(), alpha);
 				}
 				else
 				{
-					destination.initialize(source.width(), source.height(), ChannelMode::RGBA);
-
-					for ( size_t index = 0; index < pixelCount; index++ )
+					if ( !destination.initialize(source.width(), source.height(), ChannelMode::RGBA) )
 					{
-						const auto srcData = source.pixelPointer(index);
-						auto dstData = destination.pixelPointer(index);
-
-						dstData[0] = srcData[0];
-						dstData[1] = srcData[1];
-						dstData[2] = srcData[2];
-						dstData[3] = Pixmap< pixel_data_t, dimension_t >::one();
+						return false;
 					}
+
+					Kernels::appendAlpha< pixel_data_t, 3 >(source.data().data(), destination.data().data(), source.width(), source.height(), alpha);
 				}
 
 				return true;
@@ -1904,33 +1788,23 @@ namespace EmEn::Libs::PixelFactory
 					return false;
 				}
 
-				const auto pixelCount = source.template pixelCount< size_t >();
-
 				if ( source.channelMode() == ChannelMode::GrayscaleAlpha )
 				{
-					destination.initialize(source.width(), source.height(), ChannelMode::Grayscale);
-
-					for ( size_t index = 0; index < pixelCount; index++ )
+					if ( !destination.initialize(source.width(), source.height(), ChannelMode::Grayscale) )
 					{
-						const auto srcData = source.pixelPointer(index);
-						auto dstData = destination.pixelPointer(index);
-
-						dstData[0] = srcData[0];
+						return false;
 					}
+
+					Kernels::dropAlpha< pixel_data_t, 1 >(source.data().data(), destination.data().data(), source.width(), source.height());
 				}
 				else
 				{
-					destination.initialize(source.width(), source.height(), ChannelMode::RGB);
-
-					for ( size_t index = 0; index < pixelCount; index++ )
+					if ( !destination.initialize(source.width(), source.height(), ChannelMode::RGB) )
 					{
-						const auto srcData = source.pixelPointer(index);
-						auto dstData = destination.pixelPointer(index);
-
-						dstData[0] = srcData[0];
-						dstData[1] = srcData[1];
-						dstData[2] = srcData[2];
+						return false;
 					}
+
+					Kernels::dropAlpha< pixel_data_t, 3 >(source.data().data(), destination.data().data(), source.width(), source.height());
 				}
 
 				return true;
@@ -2390,333 +2264,53 @@ namespace EmEn::Libs::PixelFactory
 
 			/**
 			 * @brief Performs the nearest version of Processor::resize().
-			 * @todo Check for SIMD/parralelization
 			 * @param source A reference to a pixmap.
 			 * @param width The new width.
 			 * @param height The new height.
 			 * @param target A writable reference to a pixmap.
-			 * @return void
+			 * @return bool
 			 */
 			static
-			void
+			bool
 			resizeNearest (const Pixmap< pixel_data_t, dimension_t > & source, dimension_t width, dimension_t height, Pixmap< pixel_data_t, dimension_t > & target) noexcept
 			{
-				const auto colorCount = source.colorCount();
-				const auto xRatio = static_cast< float >(source.width() - 1) / static_cast< float >(width);
-				const auto yRatio = static_cast< float >(source.height() - 1) / static_cast< float >(height);
-
-				const auto & sourceData = source.data();
-				auto & targetData = target.data();
-
-				size_t dstIndex = 0;
-
-				/* Y (row) on the destination */
-				for ( size_t destinationY = 0; destinationY < height; destinationY++ )
-				{
-					const auto sourceY = static_cast< size_t >(std::round(yRatio * static_cast< float >(destinationY)));
-					const auto sourceRowIndex = sourceY * source.width() * colorCount;
-
-					/* X (column) on the destination */
-					for ( size_t destinationX = 0; destinationX < width; destinationX++ )
-					{
-						const auto sourceX = static_cast< size_t >(std::round(xRatio * static_cast< float >(destinationX)));
-						const auto sourceIndex = sourceRowIndex + (sourceX * colorCount);
-
-						switch ( source.channelMode() )
-						{
-							case ChannelMode::Grayscale :
-								targetData[dstIndex++] = sourceData[sourceIndex];
-								break;
-
-							case ChannelMode::GrayscaleAlpha :
-								targetData[dstIndex++] = sourceData[sourceIndex];
-								targetData[dstIndex++] = sourceData[sourceIndex+1];
-								break;
-
-							case ChannelMode::RGB :
-								targetData[dstIndex++] = sourceData[sourceIndex];
-								targetData[dstIndex++] = sourceData[sourceIndex+1];
-								targetData[dstIndex++] = sourceData[sourceIndex+2];
-								break;
-
-							case ChannelMode::RGBA :
-								targetData[dstIndex++] = sourceData[sourceIndex];
-								targetData[dstIndex++] = sourceData[sourceIndex+1];
-								targetData[dstIndex++] = sourceData[sourceIndex+2];
-								targetData[dstIndex++] = sourceData[sourceIndex+3];
-								break;
-
-							default:
-								break;
-						}
-					}
-				}
+				return Kernels::dispatchChannelCount(source.colorCount(), [&] (auto channelCount) {
+					Kernels::resizeNearest< pixel_data_t, channelCount >(source.data().data(), source.width(), source.height(), target.data().data(), width, height);
+				});
 			}
 
 			/**
 			 * @brief Performs the linear version of Processor::resize().
-			 * @todo Check for SIMD/parralelization
 			 * @param source A reference to a pixmap.
 			 * @param width The new width.
 			 * @param height The new height.
 			 * @param target A writable reference to a pixmap.
-			 * @return void
+			 * @return bool
 			 */
 			static
-			void
+			bool
 			resizeLinear (const Pixmap< pixel_data_t, dimension_t > & source, dimension_t width, dimension_t height, Pixmap< pixel_data_t, dimension_t > & target) noexcept
 			{
-				const auto colorCount = source.colorCount();
-				const auto xRatio = static_cast< float >(source.width() - 1) / static_cast< float >(width);
-				const auto yRatio = static_cast< float >(source.height() - 1) / static_cast< float >(height);
-
-				const auto & sourceData = source.data();
-				auto & targetData = target.data();
-
-				size_t dstIndex = 0;
-
-				/* Y (row) on the destination */
-				for ( size_t y = 0; y < height; y++ )
-				{
-					const auto realY = yRatio * static_cast< float >(y);
-
-					const auto yFloor = static_cast< size_t >(std::floor(realY));
-					const auto yCeil = static_cast< size_t >(std::ceil(realY));
-
-					/* Source row of pixels */
-					const auto srcRowA = yFloor * source.width();
-					const auto srcRowB = yCeil * source.width();
-
-					const auto yFactor = realY - static_cast< float >(yFloor);
-
-					/* X (column) on the destination */
-					for ( size_t x = 0; x < width; x++ )
-					{
-						const auto realX = static_cast< float >(x) * xRatio;
-
-						const auto xFloor = static_cast< size_t >(std::floor(realX));
-						const auto xCeil = static_cast< size_t >(std::ceil(realX));
-
-						/* Source pixel */
-						const auto srcIndexA = (srcRowA + xFloor) * colorCount;
-						const auto srcIndexB = (srcRowA + xCeil) * colorCount;
-						const auto srcIndexC = (srcRowB + xFloor) * colorCount;
-						const auto srcIndexD = (srcRowB + xCeil) * colorCount;
-
-						const auto xFactor = realX - static_cast< float >(xFloor);
-
-						switch ( source.channelMode() )
-						{
-							case ChannelMode::Grayscale :
-								targetData[dstIndex++] = Processor::bilinearFiltering(sourceData[srcIndexA], sourceData[srcIndexB], sourceData[srcIndexC], sourceData[srcIndexD], xFactor, yFactor);
-								break;
-
-							case ChannelMode::GrayscaleAlpha :
-								targetData[dstIndex++] = Processor::bilinearFiltering(sourceData[srcIndexA], sourceData[srcIndexB], sourceData[srcIndexC], sourceData[srcIndexD], xFactor, yFactor);
-								targetData[dstIndex++] = Processor::bilinearFiltering(sourceData[srcIndexA+1], sourceData[srcIndexB+1], sourceData[srcIndexC+1], sourceData[srcIndexD+1], xFactor, yFactor);
-								break;
-
-							case ChannelMode::RGB :
-								targetData[dstIndex++] = Processor::bilinearFiltering(sourceData[srcIndexA], sourceData[srcIndexB], sourceData[srcIndexC], sourceData[srcIndexD], xFactor, yFactor);
-								targetData[dstIndex++] = Processor::bilinearFiltering(sourceData[srcIndexA+1], sourceData[srcIndexB+1], sourceData[srcIndexC+1], sourceData[srcIndexD+1], xFactor, yFactor);
-								targetData[dstIndex++] = Processor::bilinearFiltering(sourceData[srcIndexA+2], sourceData[srcIndexB+2], sourceData[srcIndexC+2], sourceData[srcIndexD+2], xFactor, yFactor);
-								break;
-
-							case ChannelMode::RGBA :
-								targetData[dstIndex++] = Processor::bilinearFiltering(sourceData[srcIndexA], sourceData[srcIndexB], sourceData[srcIndexC], sourceData[srcIndexD], xFactor, yFactor);
-								targetData[dstIndex++] = Processor::bilinearFiltering(sourceData[srcIndexA+1], sourceData[srcIndexB+1], sourceData[srcIndexC+1], sourceData[srcIndexD+1], xFactor, yFactor);
-								targetData[dstIndex++] = Processor::bilinearFiltering(sourceData[srcIndexA+2], sourceData[srcIndexB+2], sourceData[srcIndexC+2], sourceData[srcIndexD+2], xFactor, yFactor);
-								targetData[dstIndex++] = Processor::bilinearFiltering(sourceData[srcIndexA+3], sourceData[srcIndexB+3], sourceData[srcIndexC+3], sourceData[srcIndexD+3], xFactor, yFactor);
-								break;
-
-							default:
-								break;
-						}
-					}
-				}
-			}
-
-			/**
-			 * @brief Used during cubic resize.
-			 * @param value The value to clamp
-			 * @return data_t
-			 */
-			[[nodiscard]]
-			static
-			pixel_data_t
-			clampValue (float value) noexcept
-			{
-				if constexpr ( std::is_floating_point_v< pixel_data_t > )
-				{
-					return std::max(0.0F, std::min(1.0F, value));
-				}
-				else
-				{
-					constexpr auto maxValue = std::numeric_limits< float >::max();
-
-					return static_cast< pixel_data_t >(std::max(0.0F, std::min(maxValue, (value * maxValue) + 0.5F)));
-				}
+				return Kernels::dispatchChannelCount(source.colorCount(), [&] (auto channelCount) {
+					Kernels::resizeLinear< pixel_data_t, channelCount >(source.data().data(), source.width(), source.height(), target.data().data(), width, height);
+				});
 			}
 
 			/**
 			 * @brief Performs the cubic version of Processor::resize().
-			 * @todo Check for SIMD/parralelization
 			 * @param source A reference to a pixmap.
 			 * @param width The new width.
 			 * @param height The new height.
 			 * @param target A writable reference to a pixmap.
-			 * @return void
+			 * @return bool
 			 */
 			static
-			void
+			bool
 			resizeCubic (const Pixmap< pixel_data_t, dimension_t > & source, dimension_t width, dimension_t height, Pixmap< pixel_data_t, dimension_t > & target) noexcept
 			{
-				const auto colorCount = source.colorCount();
-				const auto xRatio = static_cast< float >(source.width() - 1) / static_cast< float >(width);
-				const auto yRatio = static_cast< float >(source.height() - 1) / static_cast< float >(height);
-
-				//const auto & sourceData = source.data();
-				auto & targetData = target.data();
-
-				size_t dstIndex = 0;
-
-				for ( size_t y = 0; y < height; ++y )
-				{
-					const float realY = yRatio * static_cast< float >(y);
-					const auto yFloor = static_cast< int32_t >(std::floor(realY));
-					const float tY = realY - static_cast< float >(yFloor);
-
-					for ( size_t x = 0; x < width; ++x )
-					{
-						const float realX = xRatio * static_cast< float >(x);
-						const auto xFloor = static_cast< int32_t >(std::floor(realX));
-						const float tX = realX - static_cast< float >(xFloor);
-
-						std::array< float, 4 > interpolatedValues{0.0F, 0.0F, 0.0F, 0.0F};
-
-						const auto numChannels = static_cast< size_t >(colorCount);
-
-						for ( size_t channel = 0; channel < numChannels; ++channel )
-						{
-							std::array< float, 4 > intermediate{0.0F, 0.0F, 0.0F, 0.0F};
-
-							for ( int j = 0; j < 4; ++j )
-							{
-								const int currentY = yFloor - 1 + j;
-
-								std::array< float, 4 > pixel{0.0F, 0.0F, 0.0F, 0.0F};
-
-								for ( int i = 0; i < 4; ++i )
-								{
-									const int currentX = xFloor - 1 + i;
-									const auto color = source.safePixel(currentX, currentY);
-
-									switch ( source.channelMode() )
-									{
-										case ChannelMode::Grayscale:
-											pixel[i] = color.red();
-											break;
-
-										case ChannelMode::GrayscaleAlpha:
-											pixel[i] = channel == 0 ? color.red() : color.alpha();
-											break;
-
-										case ChannelMode::RGB:
-											if ( channel == 0 )
-											{
-												pixel[i] = color.red();
-											}
-											else if ( channel == 1 )
-											{
-												pixel[i] = color.green();
-											}
-											else
-											{
-												pixel[i] = color.blue();
-											}
-											break;
-
-										case ChannelMode::RGBA:
-											if ( channel == 0 )
-											{
-												pixel[i] = color.red();
-											}
-											else if ( channel == 1 )
-											{
-												pixel[i] = color.green();
-											}
-											else if ( channel == 2 )
-											{
-												pixel[i] = color.blue();
-											}
-											else
-											{
-												pixel[i] = color.alpha();
-											}
-											break;
-
-										default:
-											break;
-									}
-								}
-
-								intermediate[j] = Math::cubicInterpolationCatmullRom(pixel[0], pixel[1], pixel[2], pixel[3], tX);
-							}
-
-							interpolatedValues[channel] = Math::cubicInterpolationCatmullRom(intermediate[0], intermediate[1], intermediate[2], intermediate[3], tY);
-						}
-
-						switch ( source.channelMode() )
-						{
-							case ChannelMode::Grayscale :
-								targetData[dstIndex++] = Processor::clampValue(interpolatedValues[0]);
-								break;
-
-							case ChannelMode::GrayscaleAlpha :
-								targetData[dstIndex++] = Processor::clampValue(interpolatedValues[0]);
-								targetData[dstIndex++] = Processor::clampValue(interpolatedValues[1]);
-								break;
-
-							case ChannelMode::RGB :
-								targetData[dstIndex++] = Processor::clampValue(interpolatedValues[0]);
-								targetData[dstIndex++] = Processor::clampValue(interpolatedValues[1]);
-								targetData[dstIndex++] = Processor::clampValue(interpolatedValues[2]);
-								break;
-
-							case ChannelMode::RGBA :
-								targetData[dstIndex++] = Processor::clampValue(interpolatedValues[0]);
-								targetData[dstIndex++] = Processor::clampValue(interpolatedValues[1]);
-								targetData[dstIndex++] = Processor::clampValue(interpolatedValues[2]);
-								targetData[dstIndex++] = Processor::clampValue(interpolatedValues[3]);
-								break;
-
-							default:
-								break;
-						}
-					}
-				}
-			}
-
-			/**
-			 * @brief Used during linear resize.
-			 * @param bottomLeft
-			 * @param bottomRight
-			 * @param topLeft
-			 * @param topRight
-			 * @param xFactor
-			 * @param yFactor
-			 * @return precision_t
-			 */
-			[[nodiscard]]
-			static
-			pixel_data_t
-			bilinearFiltering (pixel_data_t bottomLeft, pixel_data_t bottomRight, pixel_data_t topLeft, pixel_data_t topRight, float xFactor, float yFactor) noexcept
-			{
-				return static_cast< pixel_data_t >(Math::linearInterpolation(
-					Math::linearInterpolation(static_cast< float >(bottomLeft), static_cast< float >(bottomRight), xFactor),
-					Math::linearInterpolation(static_cast< float >(topLeft), static_cast< float >(topRight), xFactor),
-					yFactor
-				));
+				return Kernels::dispatchChannelCount(source.colorCount(), [&] (auto channelCount) {
+					Kernels::resizeCubic< pixel_data_t, channelCount >(source.data().data(), source.width(), source.height(), target.data().data(), width, height);
+				});
 			}
 
 			/**
@@ -2729,21 +2323,12 @@ namespace EmEn::Libs::PixelFactory
 			void
 			mirrorX (const Pixmap< pixel_data_t, dimension_t > & source, Pixmap< pixel_data_t, dimension_t > & output) noexcept
 			{
-				const auto rowElementCount = source.pitch();
-				const auto rowCount = source.height();
-
 				/* Copy rows in reversed order to a new pixmap. */
-				for ( size_t rowIndex = 0; rowIndex < rowCount; rowIndex++ )
-				{
-					const auto invertedRow = rowCount - (rowIndex + 1);
-
-					std::memcpy(output.data().data() + (invertedRow * rowElementCount), source.data().data() + (rowIndex * rowElementCount), rowElementCount);
-				}
+				Kernels::reverseRows(source.data().data(), output.data().data(), source.template pitch< size_t >() / sizeof(pixel_data_t), source.height());
 			}
 
 			/**
 			 * @brief Mirrors the pixmap in Y-Axis.
-			 * @todo Can be optimize with bloc copy (first attempt failed).
 			 * @param source A reference to the input pixmap.
 			 * @param output A reference to the output pixmap.
 			 * @return bool
@@ -2753,86 +2338,9 @@ namespace EmEn::Libs::PixelFactory
 			bool
 			mirrorY (const Pixmap< pixel_data_t, dimension_t > & source, Pixmap< pixel_data_t, dimension_t > & output) noexcept
 			{
-				const auto rowCount = source.height();
-				const auto width = source.width();
-				const auto stride = source.colorCount();
-
-				auto & data = output.data();
-				const auto & baseData = source.data();
-
-				switch ( source.channelMode() )
-				{
-					case ChannelMode::Grayscale :
-						for ( auto row = 0U; row < rowCount; row++ )
-						{
-							const auto rowOffset = row * width;
-
-							for ( size_t rowPixel = 0; rowPixel < width; rowPixel++ )
-							{
-								const auto pixel = rowOffset + rowPixel;
-								const auto invertedPixel = rowOffset + (width - (rowPixel + 1));
-
-								data[pixel] = baseData[invertedPixel];
-							}
-						}
-						break;
-
-					case ChannelMode::GrayscaleAlpha :
-						for ( auto row = 0U; row < rowCount; row++ )
-						{
-							const auto rowOffset = row * width * stride;
-
-							for ( size_t rowPixel = 0; rowPixel < width; rowPixel++ )
-							{
-								const auto pixel = rowOffset + (rowPixel * stride);
-								const auto invertedPixel = rowOffset + ((width - (rowPixel + 1)) * stride);
-
-								data[pixel] = baseData[invertedPixel];
-								data[pixel+1] = baseData[invertedPixel+1];
-							}
-						}
-						break;
-
-					case ChannelMode::RGB :
-						for ( auto row = 0U; row < rowCount; row++ )
-						{
-							const auto rowOffset = row * width * stride;
-
-							for ( size_t rowPixel = 0; rowPixel < width; rowPixel++ )
-							{
-								const auto pixel = rowOffset + (rowPixel * stride);
-								const auto invertedPixel = rowOffset + ((width - (rowPixel + 1)) * stride);
-
-								data[pixel] = baseData[invertedPixel];
-								data[pixel+1] = baseData[invertedPixel+1];
-								data[pixel+2] = baseData[invertedPixel+2];
-							}
-						}
-						break;
-
-					case ChannelMode::RGBA :
-						for ( auto row = 0U; row < rowCount; row++ )
-						{
-							const auto rowOffset = row * width * stride;
-
-							for ( size_t rowPixel = 0; rowPixel < width; rowPixel++ )
-							{
-								const auto pixel = rowOffset + (rowPixel * stride);
-								const auto invertedPixel = rowOffset + ((width - (rowPixel + 1)) * stride);
-
-								data[pixel] = baseData[invertedPixel];
-								data[pixel+1] = baseData[invertedPixel+1];
-								data[pixel+2] = baseData[invertedPixel+2];
-								data[pixel+3] = baseData[invertedPixel+3];
-							}
-						}
-						break;
-
-					default:
-						return false;
-				}
-
-				return true;
+				return Kernels::dispatchChannelCount(source.colorCount(), [&] (auto channelCount) {
+					Kernels::reverseColumns< pixel_data_t, channelCount >(source.data().data(), output.data().data(), source.width(), source.height(), false);
+				});
 			}
 
 			/**
@@ -2846,61 +2354,9 @@ namespace EmEn::Libs::PixelFactory
 			bool
 			mirrorBoth (const Pixmap< pixel_data_t, dimension_t > & source, Pixmap< pixel_data_t, dimension_t > & output) noexcept
 			{
-				const auto componentCount = source.elementCount();
-				const auto stride = source.colorCount();
-
-				auto & data = output.data();
-				const auto & baseData = source.data();
-
-				switch ( source.channelMode() )
-				{
-					case ChannelMode::Grayscale :
-						for ( size_t component = 0; component < componentCount; component++ )
-						{
-							const auto invertedComponent = componentCount - (component + 1);
-
-							data[component] = baseData[invertedComponent];
-						}
-						break;
-
-					case ChannelMode::GrayscaleAlpha :
-						for ( size_t component = 0; component < componentCount; component += stride )
-						{
-							const auto invertedComponent = componentCount - (component + stride);
-
-							data[component] = baseData[invertedComponent];
-							data[component+1] = baseData[invertedComponent+1];
-						}
-						break;
-
-					case ChannelMode::RGB :
-						for ( size_t component = 0; component < componentCount; component += stride )
-						{
-							const auto invertedComponent = componentCount - (component + stride);
-
-							data[component] = baseData[invertedComponent];
-							data[component+1] = baseData[invertedComponent+1];
-							data[component+2] = baseData[invertedComponent+2];
-						}
-						break;
-
-					case ChannelMode::RGBA :
-						for ( size_t component = 0; component < componentCount; component += stride )
-						{
-							const auto invertedComponent = componentCount - (component + stride);
-
-							data[component] = baseData[invertedComponent];
-							data[component+1] = baseData[invertedComponent+1];
-							data[component+2] = baseData[invertedComponent+2];
-							data[component+3] = baseData[invertedComponent+3];
-						}
-						break;
-
-					default:
-						return false;
-				}
-
-				return true;
+				return Kernels::dispatchChannelCount(source.colorCount(), [&] (auto channelCount) {
+					Kernels::reverseColumns< pixel_data_t, channelCount >(source.data().data(), output.data().data(), source.width(), source.height(), true);
+				});
 			}
 
 			Pixmap< pixel_data_t, dimension_t > & m_target;
@@ -0,0 +1,950 @@
+/*
+ * src/Libs/PixelFactory/ProcessorKernels.hpp
+ * This file is part of Emeraude-Engine
+ *
+ * Copyright (C) 2010-2025 - Sébastien Léon Claude Christian Bémelmans "LondNoir" <londnoir@gmail.com>
+ *
+ * Emeraude-Engine is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * Emeraude-Engine is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with Emeraude-Engine; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * Complete project and additional information can be found at :
+ * https://github.com/londnoir/emeraude-engine
+ *
+ * --- THIS IS AUTOMATICALLY GENERATED, DO NOT CHANGE ---
+ */
+
+#pragma once
+
+/* STL inclusions. */
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <cmath>
+#include <algorithm>
+#include <array>
+#include <limits>
+#include <numbers>
+#include <type_traits>
+#include <vector>
+
+/* Local inclusions for usages. */
+#include "Libs/Math/SIMD.hpp"
+#include "Libs/ThreadPool.hpp"
+#include "Types.hpp"
+
+/**
+ * @brief Row kernels behind the Processor resampling, mirroring, rotation and channel conversion methods.
+ * @note Every kernel works on raw interleaved pixel storage and is specialized on the channel count, so the
+ * inner loops never branch on the channel mode. Four channels pixels are processed as one SSE register when
+ * the target supports it. The work is split across rows of the output and dispatched on the shared thread pool
+ * once the image is large enough.
+ */
+namespace EmEn::Libs::PixelFactory::Kernels
+{
+	/** @brief The pixel count of the output from which a kernel is split across threads. */
+	constexpr size_t ParallelPixelThreshold{512UL * 512UL};
+
+	/** @brief The minimum number of rows processed by one thread. */
+	constexpr size_t MinimumRowsPerThread{16};
+
+	/**
+	 * @brief Calls a row range function, possibly from the workers of the shared thread pool.
+	 * @note Each call receives a distinct range [firstRow, lastRow[, the function must only write in its range.
+	 * Without a shared pool, the whole range is processed by the calling thread.
+	 * @tparam function_t The type of function. Signature: void (size_t firstRow, size_t lastRow).
+	 * @param rowCount The number of rows to process.
+	 * @param pixelsPerRow The number of pixels processed by row, used to decide the split.
+	 * @param function A reference to the function.
+	 * @return void
+	 */
+	template< typename function_t >
+	void
+	forEachRowRange (size_t rowCount, size_t pixelsPerRow, const function_t & function) noexcept
+	{
+		auto * threadPool = rowCount * pixelsPerRow >= ParallelPixelThreshold ? ThreadPool::shared() : nullptr;
+
+		if ( threadPool == nullptr || threadPool->workerCount() == 0 || rowCount < MinimumRowsPerThread * 2 )
+		{
+			function(0, rowCount);
+
+			return;
+		}
+
+		/* NOTE: One range per worker plus the calling thread, which takes part in the work while waiting. */
+		const auto rangeCount = threadPool->workerCount() + 1;
+		const auto rowsPerRange = std::max(MinimumRowsPerThread, (rowCount + rangeCount - 1) / rangeCount);
+
+		threadPool->parallelFor(0, rowCount, [&function] (size_t firstRow, size_t lastRow) {
+			function(firstRow, lastRow);
+		}, rowsPerRange);
+	}
+
+	/**
+	 * @brief Calls a function with the channel count as a compile-time constant.
+	 * @tparam function_t The type of function. Signature: void (std::integral_constant< size_t, N >).
+	 * @param channelCount The channel count from 1 to 4.
+	 * @param function A reference to the function.
+	 * @return bool
+	 */
+	template< typename function_t >
+	bool
+	dispatchChannelCount (size_t channelCount, const function_t & function) noexcept
+	{
+		switch ( channelCount )
+		{
+			case 1 :
+				function(std::integral_constant< size_t, 1 >{});
+				return true;
+
+			case 2 :
+				function(std::integral_constant< size_t, 2 >{});
+				return true;
+
+			case 3 :
+				function(std::integral_constant< size_t, 3 >{});
+				return true;
+
+			case 4 :
+				function(std::integral_constant< size_t, 4 >{});
+				return true;
+
+			default:
+				return false;
+		}
+	}
+
+	/**
+	 * @brief Returns the value of a fully saturated channel.
+	 * @tparam pixel_data_t The pixel component type.
+	 * @return float
+	 */
+	template< typename pixel_data_t >
+	[[nodiscard]]
+	constexpr
+	float
+	channelMaximum () noexcept
+	{
+		if constexpr ( std::is_floating_point_v< pixel_data_t > )
+		{
+			return 1.0F;
+		}
+		else
+		{
+			return static_cast< float >(std::numeric_limits< pixel_data_t >::max());
+		}
+	}
+
+	/**
+	 * @brief Converts a filtered value back to a channel, clamped and rounded.
+	 * @tparam pixel_data_t The pixel component type.
+	 * @param value The filtered value.
+	 * @return pixel_data_t
+	 */
+	template< typename pixel_data_t >
+	[[nodiscard]]
+	pixel_data_t
+	storeChannel (float value) noexcept
+	{
+		const auto clamped = std::clamp(value, 0.0F, channelMaximum< pixel_data_t >());
+
+		if constexpr ( std::is_floating_point_v< pixel_data_t > )
+		{
+			return static_cast< pixel_data_t >(clamped);
+		}
+		else
+		{
+			return static_cast< pixel_data_t >(clamped + 0.5F);
+		}
+	}
+
+#if defined(EMERAUDE_MATH_SIMD_SSE)
+	/**
+	 * @brief Loads four channels into a register.
+	 * @tparam pixel_data_t The pixel component type.
+	 * @param pixel A pointer to the first channel.
+	 * @return __m128
+	 */
+	template< typename pixel_data_t >
+	[[nodiscard]]
+	inline
+	__m128
+	loadChannels4 (const pixel_data_t * pixel) noexcept
+	{
+		if constexpr ( std::is_same_v< pixel_data_t, uint8_t > )
+		{
+			int32_t packed;
+			std::memcpy(&packed, pixel, sizeof(packed));
+
+			const auto zero = _mm_setzero_si128();
+
+			return _mm_cvtepi32_ps(_mm_unpacklo_epi16(_mm_unpacklo_epi8(_mm_cvtsi32_si128(packed), zero), zero));
+		}
+		else if constexpr ( std::is_same_v< pixel_data_t, float > )
+		{
+			return _mm_loadu_ps(pixel);
+		}
+		else
+		{
+			return _mm_setr_ps(static_cast< float >(pixel[0]), static_cast< float >(pixel[1]), static_cast< float >(pixel[2]), static_cast< float >(pixel[3]));
+		}
+	}
+
+	/**
+	 * @brief Stores four filtered values as channels, clamped and rounded.
+	 * @tparam pixel_data_t The pixel component type.
+	 * @param value The register holding the filtered values.
+	 * @param pixel A pointer to the first channel.
+	 * @return void
+	 */
+	template< typename pixel_data_t >
+	inline
+	void
+	storeChannels4 (__m128 value, pixel_data_t * pixel) noexcept
+	{
+		value = _mm_min_ps(_mm_max_ps(value, _mm_setzero_ps()), _mm_set1_ps(channelMaximum< pixel_data_t >()));
+
+		if constexpr ( std::is_same_v< pixel_data_t, uint8_t > )
+		{
+			const auto words = _mm_packs_epi32(_mm_cvtps_epi32(value), _mm_setzero_si128());
+			const auto packed = _mm_cvtsi128_si32(_mm_packus_epi16(words, words));
+
+			std::memcpy(pixel, &packed, sizeof(packed));
+		}
+		else if constexpr ( std::is_same_v< pixel_data_t, float > )
+		{
+			_mm_storeu_ps(pixel, value);
+		}
+		else
+		{
+			std::array< float, 4 > values{};
+			_mm_storeu_ps(values.data(), value);
+
+			for ( size_t channel = 0; channel < 4; channel++ )
+			{
+				pixel[channel] = storeChannel< pixel_data_t >(values[channel]);
+			}
+		}
+	}
+#endif
+
+	/**
+	 * @brief Resizes with the nearest pixel.
+	 * @tparam pixel_data_t The pixel component type.
+	 * @tparam channelCount The number of channels per pixel.
+	 * @param source A pointer to the source pixels.
+	 * @param sourceWidth The source width.
+	 * @param sourceHeight The source height.
+	 * @param target A pointer to the target pixels.
+	 * @param width The target width.
+	 * @param height The target height.
+	 * @return void
+	 */
+	template< typename pixel_data_t, size_t channelCount >
+	void
+	resizeNearest (const pixel_data_t * source, size_t sourceWidth, size_t sourceHeight, pixel_data_t * target, size_t width, size_t height) noexcept
+	{
+		const auto xRatio = static_cast< float >(sourceWidth - 1) / static_cast< float >(width);
+		const auto yRatio = static_cast< float >(sourceHeight - 1) / static_cast< float >(height);
+
+		/* NOTE: The source column of every target column is the same on each row. */
+		std::vector< size_t > columnOffsets(width);
+
+		for ( size_t x = 0; x < width; x++ )
+		{
+			columnOffsets[x] = static_cast< size_t >(std::round(xRatio * static_cast< float >(x))) * channelCount;
+		}
+
+		forEachRowRange(height, width, [&] (size_t firstRow, size_t lastRow) {
+			for ( auto y = firstRow; y < lastRow; y++ )
+			{
+				const auto sourceY = static_cast< size_t >(std::round(yRatio * static_cast< float >(y)));
+				const auto * sourceRow = source + sourceY * sourceWidth * channelCount;
+				auto * targetPixel = target + y * width * channelCount;
+
+				for ( size_t x = 0; x < width; x++ )
+				{
+					std::memcpy(targetPixel, sourceRow + columnOffsets[x], channelCount * sizeof(pixel_data_t));
+
+					targetPixel += channelCount;
+				}
+			}
+		});
+	}
+
+	/**
+	 * @brief Resizes with a bilinear interpolation of the four nearest pixels.
+	 * @note The interpolated values are truncated, not rounded.
+	 * @tparam pixel_data_t The pixel component type.
+	 * @tparam channelCount The number of channels per pixel.
+	 * @param source A pointer to the source pixels.
+	 * @param sourceWidth The source width.
+	 * @param sourceHeight The source height.
+	 * @param target A pointer to the target pixels.
+	 * @param width The target width.
+	 * @param height The target height.
+	 * @return void
+	 */
+	template< typename pixel_data_t, size_t channelCount >
+	void
+	resizeLinear (const pixel_data_t * source, size_t sourceWidth, size_t sourceHeight, pixel_data_t * target, size_t width, size_t height) noexcept
+	{
+		const auto xRatio = static_cast< float >(sourceWidth - 1) / static_cast< float >(width);
+		const auto yRatio = static_cast< float >(sourceHeight - 1) / static_cast< float >(height);
+
+		std::vector< size_t > floorOffsets(width);
+		std::vector< size_t > ceilOffsets(width);
+		std::vector< float > xFactors(width);
+
+		for ( size_t x = 0; x < width; x++ )
+		{
+			const auto realX = static_cast< float >(x) * xRatio;
+
+			floorOffsets[x] = static_cast< size_t >(std::floor(realX)) * channelCount;
+			ceilOffsets[x] = static_cast< size_t >(std::ceil(realX)) * channelCount;
+			xFactors[x] = realX - std::floor(realX);
+		}
+
+		forEachRowRange(height, width, [&] (size_t firstRow, size_t lastRow) {
+			for ( auto y = firstRow; y < lastRow; y++ )
+			{
+				const auto realY = yRatio * static_cast< float >(y);
+				const auto yFloor = static_cast< size_t >(std::floor(realY));
+				const auto yCeil = static_cast< size_t >(std::ceil(realY));
+				const auto yFactor = realY - static_cast< float >(yFloor);
+
+				const auto * rowA = source + yFloor * sourceWidth * channelCount;
+				const auto * rowB = source + yCeil * sourceWidth * channelCount;
+				auto * targetPixel = target + y * width * channelCount;
+
+				for ( size_t x = 0; x < width; x++ )
+				{
+					const auto xFactor = xFactors[x];
+					const auto * pixelA = rowA + floorOffsets[x];
+					const auto * pixelB = rowA + ceilOffsets[x];
+					const auto * pixelC = rowB + floorOffsets[x];
+					const auto * pixelD = rowB + ceilOffsets[x];
+
+					for ( size_t channel = 0; channel < channelCount; channel++ )
+					{
+						const auto bottom = static_cast< float >(pixelA[channel]) + (static_cast< float >(pixelB[channel]) - static_cast< float >(pixelA[channel])) * xFactor;
+						const auto top = static_cast< float >(pixelC[channel]) + (static_cast< float >(pixelD[channel]) - static_cast< float >(pixelC[channel])) * xFactor;
+
+						targetPixel[channel] = static_cast< pixel_data_t >(bottom + (top - bottom) * yFactor);
+					}
+
+					targetPixel += channelCount;
+				}
+			}
+		});
+	}
+
+	/**
+	 * @brief Returns the four Catmull-Rom weights of an interpolation factor.
+	 * @param factor The position between the second and the third sample.
+	 * @return std::array< float, 4 >
+	 */
+	[[nodiscard]]
+	inline
+	std::array< float, 4 >
+	catmullRomWeights (float factor) noexcept
+	{
+		const auto factor2 = factor * factor;
+		const auto factor3 = factor2 * factor;
+
+		return {
+			0.5F * (-factor3 + 2.0F * factor2 - factor),
+			0.5F * (3.0F * factor3 - 5.0F * factor2 + 2.0F),
+			0.5F * (-3.0F * factor3 + 4.0F * factor2 + factor),
+			0.5F * (factor3 - factor2)
+		};
+	}
+
+	/**
+	 * @brief Resizes with a bicubic Catmull-Rom interpolation of the sixteen nearest pixels.
+	 * @note The samples outside the source are clamped to the edge.
+	 * @tparam pixel_data_t The pixel component type.
+	 * @tparam channelCount The number of channels per pixel.
+	 * @param source A pointer to the source pixels.
+	 * @param sourceWidth The source width.
+	 * @param sourceHeight The source height.
+	 * @param target A pointer to the target pixels.
+	 * @param width The target width.
+	 * @param height The target height.
+	 * @return void
+	 */
+	template< typename pixel_data_t, size_t channelCount >
+	void
+	resizeCubic (const pixel_data_t * source, size_t sourceWidth, size_t sourceHeight, pixel_data_t * target, size_t width, size_t height) noexcept
+	{
+		const auto xRatio = static_cast< float >(sourceWidth - 1) / static_cast< float >(width);
+		const auto yRatio = static_cast< float >(sourceHeight - 1) / static_cast< float >(height);
+
+		const auto clampedIndex = [] (int64_t index, size_t size) {
+			return static_cast< size_t >(std::clamp< int64_t >(index, 0, static_cast< int64_t >(size) - 1));
+		};
+
+		std::vector< std::array< size_t, 4 > > columnOffsets(width);
+		std::vector< std::array< float, 4 > > columnWeights(width);
+
+		for ( size_t x = 0; x < width; x++ )
+		{
+			const auto realX = xRatio * static_cast< float >(x);
+			const auto xFloor = static_cast< int64_t >(std::floor(realX));
+
+			for ( int64_t tap = 0; tap < 4; tap++ )
+			{
+				columnOffsets[x][tap] = clampedIndex(xFloor - 1 + tap, sourceWidth) * channelCount;
+			}
+
+			columnWeights[x] = catmullRomWeights(realX - static_cast< float >(xFloor));
+		}
+
+		forEachRowRange(height, width * 4, [&] (size_t firstRow, size_t lastRow) {
+			for ( auto y = firstRow; y < lastRow; y++ )
+			{
+				const auto realY = yRatio * static_cast< float >(y);
+				const auto yFloor = static_cast< int64_t >(std::floor(realY));
+				const auto rowWeights = catmullRomWeights(realY - static_cast< float >(yFloor));
+
+				std::array< const pixel_data_t *, 4 > rows{};
+
+				for ( int64_t tap = 0; tap < 4; tap++ )
+				{
+					rows[tap] = source + clampedIndex(yFloor - 1 + tap, sourceHeight) * sourceWidth * channelCount;
+				}
+
+				auto * targetPixel = target + y * width * channelCount;
+
+				for ( size_t x = 0; x < width; x++ )
+				{
+					const auto & offsets = columnOffsets[x];
+					const auto & weights = columnWeights[x];
+
+#if defined(EMERAUDE_MATH_SIMD_SSE)
+					if constexpr ( channelCount == 4 )
+					{
+						auto sum = _mm_setzero_ps();
+
+						for ( size_t row = 0; row < 4; row++ )
+						{
+							auto line = _mm_mul_ps(loadChannels4(rows[row] + offsets[0]), _mm_set1_ps(weights[0]));
+							line = _mm_add_ps(line, _mm_mul_ps(loadChannels4(rows[row] + offsets[1]), _mm_set1_ps(weights[1])));
+							line = _mm_add_ps(line, _mm_mul_ps(loadChannels4(rows[row] + offsets[2]), _mm_set1_ps(weights[2])));
+							line = _mm_add_ps(line, _mm_mul_ps(loadChannels4(rows[row] + offsets[3]), _mm_set1_ps(weights[3])));
+
+							sum = _mm_add_ps(sum, _mm_mul_ps(line, _mm_set1_ps(rowWeights[row])));
+						}
+
+						storeChannels4(sum, targetPixel);
+					}
+					else
+#endif
+					{
+						for ( size_t channel = 0; channel < channelCount; channel++ )
+						{
+							auto sum = 0.0F;
+
+							for ( size_t row = 0; row < 4; row++ )
+							{
+								const auto * line = rows[row] + channel;
+
+								sum += rowWeights[row] * (
+									weights[0] * static_cast< float >(line[offsets[0]]) +
+									weights[1] * static_cast< float >(line[offsets[1]]) +
+									weights[2] * static_cast< float >(line[offsets[2]]) +
+									weights[3] * static_cast< float >(line[offsets[3]])
+								);
+							}
+
+							targetPixel[channel] = storeChannel< pixel_data_t >(sum);
+						}
+					}
+
+					targetPixel += channelCount;
+				}
+			}
+		});
+	}
+
+	/**
+	 * @brief Returns the half width of a resampling filter, in target pixels.
+	 * @param filter The resampling filter.
+	 * @return float
+	 */
+	[[nodiscard]]
+	inline
+	float
+	filterRadius (ResamplingFilter filter) noexcept
+	{
+		switch ( filter )
+		{
+			case ResamplingFilter::Box :
+				return 0.5F;
+
+			case ResamplingFilter::Lanczos :
+				return 3.0F;
+		}
+
+		return 0.5F;
+	}
+
+	/**
+	 * @brief Evaluates a resampling filter.
+	 * @param filter The resampling filter.
+	 * @param distance The distance to the filter center, in target pixels.
+	 * @return float
+	 */
+	[[nodiscard]]
+	inline
+	float
+	filterWeight (ResamplingFilter filter, float distance) noexcept
+	{
+		switch ( filter )
+		{
+			case ResamplingFilter::Box :
+				return distance >= -0.5F && distance < 0.5F ? 1.0F : 0.0F;
+
+			case ResamplingFilter::Lanczos :
+			{
+				if ( std::abs(distance) < 1.0e-6F )
+				{
+					return 1.0F;
+				}
+
+				if ( std::abs(distance) >= 3.0F )
+				{
+					return 0.0F;
+				}
+
+				const auto angle = std::numbers::pi_v< float > * distance;
+
+				return 3.0F * std::sin(angle) * std::sin(angle / 3.0F) / (angle * angle);
+			}
+		}
+
+		return 0.0F;
+	}
+
+	/**
+	 * @brief The precomputed weights of a resampling filter along one axis.
+	 * @note The weights of the output index N are stored at [N * taps, N * taps + count[N][.
+	 */
+	struct FilterTable
+	{
+		std::vector< uint32_t > first;
+		std::vector< uint32_t > count;
+		std::vector< float > weights;
+		size_t taps{0};
+	};
+
+	/**
+	 * @brief Computes the normalized weights of a resampling filter along one axis.
+	 * @param sourceSize The source size.
+	 * @param targetSize The target size.
+	 * @param filter The resampling filter.
+	 * @return FilterTable
+	 */
+	[[nodiscard]]
+	inline
+	FilterTable
+	buildFilterTable (size_t sourceSize, size_t targetSize, ResamplingFilter filter) noexcept
+	{
+		const auto scale = static_cast< float >(sourceSize) / static_cast< float >(targetSize);
+		/* NOTE: When reducing, the filter is stretched over the source pixels covered by one target pixel. */
+		const auto filterScale = std::max(scale, 1.0F);
+		const auto support = filterRadius(filter) * filterScale;
+
+		FilterTable table;
+		table.taps = static_cast< size_t >(std::ceil(support * 2.0F)) + 1;
+		table.first.resize(targetSize);
+		table.count.resize(targetSize);
+		table.weights.assign(targetSize * table.taps, 0.0F);
+
+		for ( size_t index = 0; index < targetSize; index++ )
+		{
+			const auto center = (static_cast< float >(index) + 0.5F) * scale;
+			const auto start = static_cast< size_t >(std::max(0.0F, std::floor(center - support)));
+			const auto end = std::min({sourceSize, static_cast< size_t >(std::ceil(center + support)), start + table.taps});
+
+			auto * weights = table.weights.data() + index * table.taps;
+			auto total = 0.0F;
+
+			for ( auto sample = start; sample < end; sample++ )
+			{
+				weights[sample - start] = filterWeight(filter, (static_cast< float >(sample) + 0.5F - center) / filterScale);
+				total += weights[sample - start];
+			}
+
+			if ( std::abs(total) > std::numeric_limits< float >::epsilon() )
+			{
+				for ( auto sample = start; sample < end; sample++ )
+				{
+					weights[sample - start] /= total;
+				}
+
+				table.first[index] = static_cast< uint32_t >(start);
+				table.count[index] = static_cast< uint32_t >(end - start);
+			}
+			else
+			{
+				/* NOTE: No source sample falls under the filter, the nearest one is used. */
+				weights[0] = 1.0F;
+
+				table.first[index] = static_cast< uint32_t >(std::min(static_cast< size_t >(center), sourceSize - 1));
+				table.count[index] = 1;
+			}
+		}
+
+		return table;
+	}
+
+	/**
+	 * @brief Filters one source row horizontally into a row of floats.
+	 * @tparam pixel_data_t The pixel component type.
+	 * @tparam channelCount The number of channels per pixel.
+	 * @param sourceRow A pointer to the source row.
+	 * @param table A reference to the horizontal filter table.
+	 * @param output A pointer to the filtered row, holding the target width times the channel count.
+	 * @return void
+	 */
+	template< typename pixel_data_t, size_t channelCount >
+	void
+	filterRow (const pixel_data_t * sourceRow, const FilterTable & table, float * output) noexcept
+	{
+		const auto width = table.first.size();
+
+		for ( size_t x = 0; x < width; x++ )
+		{
+			const auto * pixel = sourceRow + static_cast< size_t >(table.first[x]) * channelCount;
+			const auto * weights = table.weights.data() + x * table.taps;
+			const auto count = table.count[x];
+
+#if defined(EMERAUDE_MATH_SIMD_SSE)
+			if constexpr ( channelCount == 4 )
+			{
+				auto sum = _mm_setzero_ps();
+
+				for ( size_t tap = 0; tap < count; tap++ )
+				{
+					sum = _mm_add_ps(sum, _mm_mul_ps(loadChannels4(pixel + tap * 4), _mm_set1_ps(weights[tap])));
+				}
+
+				_mm_storeu_ps(output + x * 4, sum);
+			}
+			else
+#endif
+			{
+				std::array< float, channelCount > sum{};
+
+				for ( size_t tap = 0; tap < count; tap++ )
+				{
+					for ( size_t channel = 0; channel < channelCount; channel++ )
+					{
+						sum[channel] += weights[tap] * static_cast< float >(pixel[tap * channelCount + channel]);
+					}
+				}
+
+				std::memcpy(output + x * channelCount, sum.data(), sizeof(sum));
+			}
+		}
+	}
+
+	/**
+	 * @brief Accumulates a weighted row of floats.
+	 * @param row A pointer to the filtered row.
+	 * @param weight The row weight.
+	 * @param accumulator A pointer to the accumulator.
+	 * @param elementCount The number of floats in the row.
+	 * @return void
+	 */
+	inline
+	void
+	accumulateRow (const float * row, float weight, float * accumulator, size_t elementCount) noexcept
+	{
+		size_t element = 0;
+
+#if defined(EMERAUDE_MATH_SIMD_SSE)
+		const auto factor = _mm_set1_ps(weight);
+
+		for ( ; element + 4 <= elementCount; element += 4 )
+		{
+			_mm_storeu_ps(accumulator + element, _mm_add_ps(_mm_loadu_ps(accumulator + element), _mm_mul_ps(_mm_loadu_ps(row + element), factor)));
+		}
+#endif
+
+		for ( ; element < elementCount; element++ )
+		{
+			accumulator[element] += row[element] * weight;
+		}
+	}
+
+	/**
+	 * @brief Stores a row of floats as channels, clamped and rounded.
+	 * @tparam pixel_data_t The pixel component type.
+	 * @param accumulator A pointer to the filtered row.
+	 * @param target A pointer to the target row.
+	 * @param elementCount The number of floats in the row.
+	 * @return void
+	 */
+	template< typename pixel_data_t >
+	void
+	storeRow (const float * accumulator, pixel_data_t * target, size_t elementCount) noexcept
+	{
+		size_t element = 0;
+
+#if defined(EMERAUDE_MATH_SIMD_SSE)
+		for ( ; element + 4 <= elementCount; element += 4 )
+		{
+			storeChannels4(_mm_loadu_ps(accumulator + element), target + element);
+		}
+#endif
+
+		for ( ; element < elementCount; element++ )
+		{
+			target[element] = storeChannel< pixel_data_t >(accumulator[element]);
+		}
+	}
+
+	/**
+	 * @brief Resamples with a separable filter, horizontally then vertically.
+	 * @note Each thread keeps a ring of horizontally filtered rows, so a source row is filtered once per thread
+	 * and the memory stays bounded to the filter height.
+	 * @tparam pixel_data_t The pixel component type.
+	 * @tparam channelCount The number of channels per pixel.
+	 * @param source A pointer to the source pixels.
+	 * @param sourceWidth The source width.
+	 * @param sourceHeight The source height.
+	 * @param target A pointer to the target pixels.
+	 * @param width The target width.
+	 * @param height The target height.
+	 * @param filter The resampling filter.
+	 * @return void
+	 */
+	template< typename pixel_data_t, size_t channelCount >
+	void
+	resample (const pixel_data_t * source, size_t sourceWidth, size_t sourceHeight, pixel_data_t * target, size_t width, size_t height, ResamplingFilter filter) noexcept
+	{
+		const auto horizontal = buildFilterTable(sourceWidth, width, filter);
+		const auto vertical = buildFilterTable(sourceHeight, height, filter);
+		const auto rowElements = width * channelCount;
+
+		forEachRowRange(height, width * vertical.taps, [&] (size_t firstRow, size_t lastRow) {
+			std::vector< float > ring(vertical.taps * rowElements);
+			std::vector< size_t > ringRows(vertical.taps, std::numeric_limits< size_t >::max());
+			std::vector< float > accumulator(rowElements);
+
+			for ( auto y = firstRow; y < lastRow; y++ )
+			{
+				const auto * weights = vertical.weights.data() + y * vertical.taps;
+
+				std::fill(accumulator.begin(), accumulator.end(), 0.0F);
+
+				for ( size_t tap = 0; tap < vertical.count[y]; tap++ )
+				{
+					const auto sourceY = static_cast< size_t >(vertical.first[y]) + tap;
+					const auto slot = sourceY % vertical.taps;
+					auto * filteredRow = ring.data() + slot * rowElements;
+
+					/* NOTE: The rows needed by consecutive target rows only move forward,
+					 * so a slot is only overwritten once its previous row is out of the filter. */
+					if ( ringRows[slot] != sourceY )
+					{
+						filterRow< pixel_data_t, channelCount >(source + sourceY * sourceWidth * channelCount, horizontal, filteredRow);
+
+						ringRows[slot] = sourceY;
+					}
+
+					accumulateRow(filteredRow, weights[tap], accumulator.data(), rowElements);
+				}
+
+				storeRow(accumulator.data(), target + y * rowElements, rowElements);
+			}
+		});
+	}
+
+	/**
+	 * @brief Reverses the pixel order of every row.
+	 * @tparam pixel_data_t The pixel component type.
+	 * @tparam channelCount The number of channels per pixel.
+	 * @param source A pointer to the source pixels.
+	 * @param target A pointer to the target pixels. It must not alias the source.
+	 * @param width The width.
+	 * @param height The height.
+	 * @param reverseRows Reverses the row order too, which turns the image by 180°.
+	 * @return void
+	 */
+	template< typename pixel_data_t, size_t channelCount >
+	void
+	reverseColumns (const pixel_data_t * source, pixel_data_t * target, size_t width, size_t height, bool reverseRows) noexcept
+	{
+		forEachRowRange(height, width, [&] (size_t firstRow, size_t lastRow) {
+			for ( auto y = firstRow; y < lastRow; y++ )
+			{
+				const auto sourceY = reverseRows ? height - 1 - y : y;
+				const auto * sourcePixel = source + (sourceY * width + width - 1) * channelCount;
+				auto * targetPixel = target + y * width * channelCount;
+
+				for ( size_t x = 0; x < width; x++ )
+				{
+					std::memcpy(targetPixel, sourcePixel, channelCount * sizeof(pixel_data_t));
+
+					targetPixel += channelCount;
+					sourcePixel -= channelCount;
+				}
+			}
+		});
+	}
+
+	/**
+	 * @brief Reverses the row order.
+	 * @tparam pixel_data_t The pixel component type.
+	 * @param source A pointer to the source pixels.
+	 * @param target A pointer to the target pixels. It must not alias the source.
+	 * @param rowElements The number of components per row.
+	 * @param height The height.
+	 * @return void
+	 */
+	template< typename pixel_data_t >
+	void
+	reverseRows (const pixel_data_t * source, pixel_data_t * target, size_t rowElements, size_t height) noexcept
+	{
+		forEachRowRange(height, rowElements, [&] (size_t firstRow, size_t lastRow) {
+			for ( auto y = firstRow; y < lastRow; y++ )
+			{
+				std::memcpy(target + y * rowElements, source + (height - 1 - y) * rowElements, rowElements * sizeof(pixel_data_t));
+			}
+		});
+	}
+
+	/**
+	 * @brief Turns an image by a quarter.
+	 * @note The copy goes by square tiles, so the source column reads stay in cache.
+	 * @tparam pixel_data_t The pixel component type.
+	 * @tparam channelCount The number of channels per pixel.
+	 * @param source A pointer to the source pixels.
+	 * @param sourceWidth The source width, which is the target height.
+	 * @param sourceHeight The source height, which is the target width.
+	 * @param target A pointer to the target pixels.
+	 * @param clockwise Turns by +90° like Processor::rotateQuarterTurn(), or by +270°.
+	 * @return void
+	 */
+	template< typename pixel_data_t, size_t channelCount >
+	void
+	rotateQuarter (const pixel_data_t * source, size_t sourceWidth, size_t sourceHeight, pixel_data_t * target, bool clockwise) noexcept
+	{
+		constexpr size_t TileSize{32};
+
+		const auto width = sourceHeight;
+		const auto height = sourceWidth;
+
+		forEachRowRange((height + TileSize - 1) / TileSize, width * TileSize, [&] (size_t firstTileRow, size_t lastTileRow) {
+			for ( auto tileY = firstTileRow * TileSize; tileY < std::min(lastTileRow * TileSize, height); tileY += TileSize )
+			{
+				const auto tileBottom = std::min(tileY + TileSize, height);
+
+				for ( size_t tileX = 0; tileX < width; tileX += TileSize )
+				{
+					const auto tileRight = std::min(tileX + TileSize, width);
+
+					for ( auto y = tileY; y < tileBottom; y++ )
+					{
+						/* NOTE: A target row is a source column, read upward when turning by +90°. */
+						const auto sourceX = clockwise ? y : sourceWidth - 1 - y;
+
+						auto * targetPixel = target + (y * width + tileX) * channelCount;
+
+						for ( auto x = tileX; x < tileRight; x++ )
+						{
+							const auto sourceY = clockwise ? sourceHeight - 1 - x : x;
+
+							std::memcpy(targetPixel, source + (sourceY * sourceWidth + sourceX) * channelCount, channelCount * sizeof(pixel_data_t));
+
+							targetPixel += channelCount;
+						}
+					}
+				}
+			}
+		});
+	}
+
+	/**
+	 * @brief Copies the color channels of every pixel and sets the alpha channel to a value.
+	 * @tparam pixel_data_t The pixel component type.
+	 * @tparam colorChannels The number of channels of the source, without alpha.
+	 * @param source A pointer to the source pixels.
+	 * @param target A pointer to the target pixels, with one more channel.
+	 * @param width The width.
+	 * @param height The height.
+	 * @param alpha The alpha value.
+	 * @return void
+	 */
+	template< typename pixel_data_t, size_t colorChannels >
+	void
+	appendAlpha (const pixel_data_t * source, pixel_data_t * target, size_t width, size_t height, pixel_data_t alpha) noexcept
+	{
+		forEachRowRange(height, width, [&] (size_t firstRow, size_t lastRow) {
+			const auto * sourcePixel = source + firstRow * width * colorChannels;
+			auto * targetPixel = target + firstRow * width * (colorChannels + 1);
+
+			const auto pixelCount = (lastRow - firstRow) * width;
+
+			for ( size_t pixel = 0; pixel < pixelCount; pixel++ )
+			{
+				/* NOTE: A whole target pixel is copied at once, reading one component of the next source pixel
+				 * which is then overwritten by the alpha. The last pixel of the range has no next pixel. */
+				if ( pixel + 1 < pixelCount )
+				{
+					std::memcpy(targetPixel, sourcePixel, (colorChannels + 1) * sizeof(pixel_data_t));
+				}
+				else
+				{
+					std::memcpy(targetPixel, sourcePixel, colorChannels * sizeof(pixel_data_t));
+				}
+
+				targetPixel[colorChannels] = alpha;
+
+				sourcePixel += colorChannels;
+				targetPixel += colorChannels + 1;
+			}
+		});
+	}
+
+	/**
+	 * @brief Copies the color channels of every pixel and drops the alpha channel.
+	 * @tparam pixel_data_t The pixel component type.
+	 * @tparam colorChannels The number of channels of the target, without alpha.
+	 * @param source A pointer to the source pixels, with one more channel.
+	 * @param target A pointer to the target pixels.
+	 * @param width The width.
+	 * @param height The height.
+	 * @return void
+	 */
+	template< typename pixel_data_t, size_t colorChannels >
+	void
+	dropAlpha (const pixel_data_t * source, pixel_data_t * target, size_t width, size_t height) noexcept
+	{
+		forEachRowRange(height, width, [&] (size_t firstRow, size_t lastRow) {
+			const auto * sourcePixel = source + firstRow * width * (colorChannels + 1);
+			auto * targetPixel = target + firstRow * width * colorChannels;
+
+			for ( size_t pixel = 0; pixel < (lastRow - firstRow) * width; pixel++ )
+			{
+				std::memcpy(targetPixel, sourcePixel, colorChannels * sizeof(pixel_data_t));
+
+				sourcePixel += colorChannels + 1;
+				targetPixel += colorChannels;
+			}
+		});
+	}
+}
@@ -0,0 +1,123 @@
+/*
+ * src/Libs/PixelFactory/TextureCache.cpp
+ * This file is part of Emeraude-Engine
+ *
+ * Copyright (C) 2010-2025 - Sébastien Léon Claude Christian Bémelmans "LondNoir" <londnoir@gmail.com>
+ *
+ * Emeraude-Engine is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * Emeraude-Engine is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with Emeraude-Engine; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * Complete project and additional information can be found at :
+ * https://github.com/londnoir/emeraude-engine
+ *
+ * --- THIS IS AUTOMATICALLY GENERATED, DO NOT CHANGE ---
+ */
+
+#include "TextureCache.hpp"
+
+/* STL inclusions. */
+#include <algorithm>
+#include <array>
+#include <iostream>
+#include <string>
+#include <system_error>
+#include <utility>
+
+/* Local inclusions. */
+#include "MipChain.hpp"
+
+namespace EmEn::Libs::PixelFactory
+{
+	TextureCache::TextureCache (std::filesystem::path directory) noexcept
+		: m_directory(std::move(directory))
+	{
+
+	}
+
+	std::filesystem::path
+	TextureCache::getFilepath (uint64_t sourceHash, BlockFormat format, uint32_t levelCount, bool gammaCorrect) const noexcept
+	{
+		static constexpr std::array< char, 16 > Digits{'0', '1', '2', '3', '4', '5', '6', '7', '8', '9', 'a', 'b', 'c', 'd', 'e', 'f'};
+
+		std::string filename(16, '0');
+
+		for ( size_t digit = 0; digit < filename.size(); digit++ )
+		{
+			filename[filename.size() - 1 - digit] = Digits[(sourceHash >> (digit * 4)) & 0x0F];
+		}
+
+		filename += '-';
+		filename += to_cstring(format);
+		filename += '-';
+		filename += std::to_string(levelCount);
+		filename += gammaCorrect ? "-srgb" : "-linear";
+		filename += FileExtension;
+
+		return m_directory / filename;
+	}
+
+	bool
+	TextureCache::get (const Pixmap< uint8_t > & source, BlockFormat format, uint32_t levelCount, bool gammaCorrect, CompressedTexture & texture) noexcept
+	{
+		if ( !source.isValid() )
+		{
+			std::cerr << __PRETTY_FUNCTION__ << ", the source pixmap is invalid !" "\n";
+
+			return false;
+		}
+
+		levelCount = std::clamp(levelCount, 1U, getMipLevelCount(source.width(), source.height()));
+
+		if ( m_directory.empty() )
+		{
+			m_misses.fetch_add(1, std::memory_order_relaxed);
+
+			return texture.build(source, format, levelCount, gammaCorrect);
+		}
+
+		const auto sourceHash = CompressedTexture::computeSourceHash(source);
+		const auto filepath = this->getFilepath(sourceHash, format, levelCount, gammaCorrect);
+
+		std::error_code errorCode;
+
+		if ( std::filesystem::exists(filepath, errorCode) && texture.readFile(filepath) )
+		{
+			/* NOTE: The file name is only a hint, the header must agree with the request. */
+			if ( texture.sourceHash() == sourceHash && texture.format() == format && texture.levelCount() == levelCount &&
+				texture.isGammaCorrected() == gammaCorrect && texture.width() == source.width() && texture.height() == source.height() )
+			{
+				m_hits.fetch_add(1, std::memory_order_relaxed);
+
+				return true;
+			}
+		}
+
+		m_misses.fetch_add(1, std::memory_order_relaxed);
+
+		if ( !texture.build(source, format, levelCount, gammaCorrect) )
+		{
+			return false;
+		}
+
+		/* NOTE: A failure to store the file only costs a rebuild on the next run. */
+		std::filesystem::create_directories(m_directory, errorCode);
+
+		if ( errorCode || !texture.writeFile(filepath) )
+		{
+			std::cerr << __PRETTY_FUNCTION__ << ", unable to store the compressed texture in " << m_directory << " !" "\n";
+		}
+
+		return true;
+	}
+}
@@ -0,0 +1,141 @@
+/*
+ * src/Libs/PixelFactory/TextureCache.hpp
+ * This file is part of Emeraude-Engine
+ *
+ * Copyright (C) 2010-2025 - Sébastien Léon Claude Christian Bémelmans "LondNoir" <londnoir@gmail.com>
+ *
+ * Emeraude-Engine is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * Emeraude-Engine is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with Emeraude-Engine; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * Complete project and additional information can be found at :
+ * https://github.com/londnoir/emeraude-engine
+ *
+ * --- THIS IS AUTOMATICALLY GENERATED, DO NOT CHANGE ---
+ */
+
+#pragma once
+
+/* STL inclusions. */
+#include <cstddef>
+#include <cstdint>
+#include <atomic>
+#include <filesystem>
+
+/* Local inclusions for usages. */
+#include "BlockCompression.hpp"
+#include "CompressedTexture.hpp"
+#include "Pixmap.hpp"
+
+namespace EmEn::Libs::PixelFactory
+{
+	/**
+	 * @brief On-disk cache of block compressed textures.
+	 * @note A cached file is named after the source pixels hash and the encoding parameters. A file written by another
+	 * version of the encoders, or for other source pixels, is rebuilt and replaced. Without a directory, the textures
+	 * are built on every request.
+	 */
+	class TextureCache final
+	{
+		public:
+
+			/** @brief Class identifier. */
+			static constexpr auto ClassId{"TextureCache"};
+
+			/** @brief The cached file extension. */
+			static constexpr auto FileExtension{".emtex"};
+
+			/**
+			 * @brief Constructs a texture cache without directory.
+			 */
+			TextureCache () noexcept = default;
+
+			/**
+			 * @brief Constructs a texture cache.
+			 * @param directory The directory of the cached files. It is created on the first write.
+			 */
+			explicit TextureCache (std::filesystem::path directory) noexcept;
+
+			/**
+			 * @brief Sets the directory of the cached files.
+			 * @param directory The directory of the cached files. It is created on the first write.
+			 * @return void
+			 */
+			void
+			setDirectory (const std::filesystem::path & directory) noexcept
+			{
+				m_directory = directory;
+			}
+
+			/**
+			 * @brief Returns the directory of the cached files.
+			 * @return const std::filesystem::path &
+			 */
+			[[nodiscard]]
+			const std::filesystem::path &
+			directory () const noexcept
+			{
+				return m_directory;
+			}
+
+			/**
+			 * @brief Returns the path of the cached file for a source and its encoding parameters.
+			 * @param sourceHash The source pixels hash.
+			 * @param format The block format.
+			 * @param levelCount The number of levels.
+			 * @param gammaCorrect Whether the levels are reduced with the gamma correction.
+			 * @return std::filesystem::path
+			 */
+			[[nodiscard]]
+			std::filesystem::path getFilepath (uint64_t sourceHash, BlockFormat format, uint32_t levelCount, bool gammaCorrect) const noexcept;
+
+			/**
+			 * @brief Gets the compressed version of a pixmap, from the cache or by building and storing it.
+			 * @param source A reference to the source pixmap.
+			 * @param format The block format.
+			 * @param levelCount The total level count desired, the base level included. It is clamped to the complete chain.
+			 * @param gammaCorrect Treat color channels as sRGB encoded values when reducing the levels.
+			 * @param texture A reference to the compressed texture.
+			 * @return bool
+			 */
+			bool get (const Pixmap< uint8_t > & source, BlockFormat format, uint32_t levelCount, bool gammaCorrect, CompressedTexture & texture) noexcept;
+
+			/**
+			 * @brief Returns the number of textures read from the cache.
+			 * @return size_t
+			 */
+			[[nodiscard]]
+			size_t
+			hits () const noexcept
+			{
+				return m_hits.load(std::memory_order_relaxed);
+			}
+
+			/**
+			 * @brief Returns the number of textures built because they were not in the cache.
+			 * @return size_t
+			 */
+			[[nodiscard]]
+			size_t
+			misses () const noexcept
+			{
+				return m_misses.load(std::memory_order_relaxed);
+			}
+
+		private:
+
+			std::filesystem::path m_directory;
+			std::atomic< size_t > m_hits{0};
+			std::atomic< size_t > m_misses{0};
+	};
+}
@@ -65,6 +65,15 @@ namespace EmEn::Libs::PixelFactory
 		Cubic
 	};
 
+	/** @brief Enumerate the separable filters used to resample an image, mainly for reduction. */
+	enum class ResamplingFilter : uint8_t
+	{
+		/* Averages every source pixel covered by a target pixel. */
+		Box,
+		/* Windowed sinc over 3 lobes, sharper and with a slight ringing. */
+		Lanczos
+	};
+
 	/** @brief List drawing mode when copying an image or a color onto another. */
 	enum class DrawPixelMode : uint8_t
 	{
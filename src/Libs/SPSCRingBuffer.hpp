@@ -0,0 +1,238 @@
+/*
+ * src/Libs/SPSCRingBuffer.hpp
+ * This file is part of Emeraude-Engine
+ *
+ * Copyright (C) 2010-2025 - Sébastien Léon Claude Christian Bémelmans "LondNoir" <londnoir@gmail.com>
+ *
+ * Emeraude-Engine is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * Emeraude-Engine is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with Emeraude-Engine; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * Complete project and additional information can be found at :
+ * https://github.com/londnoir/emeraude-engine
+ *
+ * --- THIS IS AUTOMATICALLY GENERATED, DO NOT CHANGE ---
+ */
+
+#pragma once
+
+/* STL inclusions. */
+#include <cstddef>
+#include <array>
+#include <atomic>
+#include <algorithm>
+#include <type_traits>
+
+namespace EmEn::Libs
+{
+	/**
+	 * @brief Bounded lock-free ring buffer for exactly one producer thread and one consumer thread.
+	 * @note Writing never blocks nor allocates: when the buffer is full, the push is refused and the caller decides what to do with the element.
+	 * @tparam data_t The type of element. Must be trivially copyable.
+	 * @tparam capacity_t The number of slots. Must be a power of two.
+	 */
+	template< typename data_t, size_t capacity_t >
+	requires (std::is_trivially_copyable_v< data_t > && capacity_t > 1 && (capacity_t & (capacity_t - 1)) == 0)
+	class SPSCRingBuffer final
+	{
+		public:
+
+			/** @brief The size of a cache line to keep both indexes apart. */
+			static constexpr size_t CacheLineSize{64};
+
+			/**
+			 * @brief Constructs a ring buffer.
+			 */
+			SPSCRingBuffer () noexcept = default;
+
+			/**
+			 * @brief Copy constructor.
+			 * @param copy A reference to the copied instance.
+			 */
+			SPSCRingBuffer (const SPSCRingBuffer & copy) noexcept = delete;
+
+			/**
+			 * @brief Move constructor.
+			 * @param copy A reference to the copied instance.
+			 */
+			SPSCRingBuffer (SPSCRingBuffer && copy) noexcept = delete;
+
+			/**
+			 * @brief Copy assignment.
+			 * @param copy A reference to the copied instance.
+			 * @return SPSCRingBuffer &
+			 */
+			SPSCRingBuffer & operator= (const SPSCRingBuffer & copy) noexcept = delete;
+
+			/**
+			 * @brief Move assignment.
+			 * @param copy A reference to the copied instance.
+			 * @return SPSCRingBuffer &
+			 */
+			SPSCRingBuffer & operator= (SPSCRingBuffer && copy) noexcept = delete;
+
+			/**
+			 * @brief Destructs the ring buffer.
+			 */
+			~SPSCRingBuffer () = default;
+
+			/**
+			 * @brief Returns the number of slots.
+			 * @return size_t
+			 */
+			[[nodiscard]]
+			static
+			constexpr
+			size_t
+			capacity () noexcept
+			{
+				return capacity_t;
+			}
+
+			/**
+			 * @brief Returns the number of elements waiting to be consumed.
+			 * @note This is only a snapshot when called from a third thread.
+			 * @return size_t
+			 */
+			[[nodiscard]]
+			size_t
+			size () const noexcept
+			{
+				return m_head.load(std::memory_order_acquire) - m_tail.load(std::memory_order_acquire);
+			}
+
+			/**
+			 * @brief Returns whether the buffer has nothing to consume.
+			 * @return bool
+			 */
+			[[nodiscard]]
+			bool
+			empty () const noexcept
+			{
+				return this->size() == 0;
+			}
+
+			/**
+			 * @brief Pushes an element. Producer thread only.
+			 * @param element A reference to the element.
+			 * @return bool False if the buffer is full.
+			 */
+			bool
+			push (const data_t & element) noexcept
+			{
+				return this->emplace(1, [&element] (data_t & slot, size_t) {
+					slot = element;
+				});
+			}
+
+			/**
+			 * @brief Writes a batch of consecutive elements directly into the slots, then publishes them at once. Producer thread only.
+			 * @note The batch is either fully written or refused, the consumer never sees a partial batch.
+			 * @tparam function_t The type of writer, signature void (data_t & slot, size_t index).
+			 * @param count The number of slots to write.
+			 * @param writer A reference to the writer.
+			 * @return bool False if the buffer has not enough free slots.
+			 */
+			template< typename function_t >
+			bool
+			emplace (size_t count, function_t && writer) noexcept
+			{
+				const auto head = m_head.load(std::memory_order_relaxed);
+
+				if ( count == 0 || count > capacity_t )
+				{
+					return false;
+				}
+
+				/* NOTE: Only reload the consumer index when the cached one says we are full. */
+				if ( head + count - m_cachedTail > capacity_t )
+				{
+					m_cachedTail = m_tail.load(std::memory_order_acquire);
+
+					if ( head + count - m_cachedTail > capacity_t )
+					{
+						return false;
+					}
+				}
+
+				for ( size_t index = 0; index < count; index++ )
+				{
+					writer(m_slots[(head + index) & Mask], index);
+				}
+
+				m_head.store(head + count, std::memory_order_release);
+
+				return true;
+			}
+
+			/**
+			 * @brief Pops the oldest element. Consumer thread only.
+			 * @param element A reference to the element to write.
+			 * @return bool False if the buffer is empty.
+			 */
+			bool
+			pop (data_t & element) noexcept
+			{
+				return this->consume([&element] (const data_t & slot) {
+					element = slot;
+				}, 1) == 1;
+			}
+
+			/**
+			 * @brief Reads available elements in place, in order, then releases their slots at once. Consumer thread only.
+			 * @tparam function_t The type of reader, signature void (const data_t & slot).
+			 * @param reader A reference to the reader.
+			 * @param maxCount The maximum number of elements to read. Default the whole capacity.
+			 * @return size_t The number of element read.
+			 */
+			template< typename function_t >
+			size_t
+			consume (function_t && reader, size_t maxCount = capacity_t) noexcept
+			{
+				const auto tail = m_tail.load(std::memory_order_relaxed);
+
+				if ( m_cachedHead == tail )
+				{
+					m_cachedHead = m_head.load(std::memory_order_acquire);
+
+					if ( m_cachedHead == tail )
+					{
+						return 0;
+					}
+				}
+
+				const auto count = std::min(m_cachedHead - tail, maxCount);
+
+				for ( size_t index = 0; index < count; index++ )
+				{
+					reader(m_slots[(tail + index) & Mask]);
+				}
+
+				m_tail.store(tail + count, std::memory_order_release);
+
+				return count;
+			}
+
+		private:
+
+			static constexpr size_t Mask{capacity_t - 1};
+
+			/* NOTE: Producer side. */
+			alignas(CacheLineSize) std::atomic< size_t > m_head{0};
+			size_t m_cachedTail{0};
+			/* NOTE: Consumer side. */
+			alignas(CacheLineSize) std::atomic< size_t > m_tail{0};
+			size_t m_cachedHead{0};
+			alignas(CacheLineSize) std::array< data_t, capacity_t > m_slots{};
+	};
+}
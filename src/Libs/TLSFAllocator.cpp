@@ -0,0 +1,469 @@
+/*
+ * src/Libs/TLSFAllocator.cpp
+ * This file is part of Emeraude-Engine
+ *
+ * Copyright (C) 2010-2025 - Sébastien Léon Claude Christian Bémelmans "LondNoir" <londnoir@gmail.com>
+ *
+ * Emeraude-Engine is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * Emeraude-Engine is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with Emeraude-Engine; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * Complete project and additional information can be found at :
+ * https://github.com/londnoir/emeraude-engine
+ *
+ * --- THIS IS AUTOMATICALLY GENERATED, DO NOT CHANGE ---
+ */
+
+
+#include "TLSFAllocator.hpp"
+
+/* STL inclusions. */
+#include <algorithm>
+#include <bit>
+
+namespace EmEn::Libs
+{
+	TLSFAllocator::TLSFAllocator (uint64_t capacity) noexcept
+		: m_capacity(capacity - capacity % Granularity)
+	{
+		for ( auto & secondLevelLists : m_freeLists )
+		{
+			secondLevelLists.fill(InvalidNode);
+		}
+
+		if ( m_capacity == 0 )
+		{
+			return;
+		}
+
+		m_firstNode = this->createNode();
+		m_nodes[m_firstNode].size = m_capacity;
+
+		this->insertFreeNode(m_firstNode);
+	}
+
+	bool
+	TLSFAllocator::allocate (uint64_t size, uint64_t alignment, Allocation & allocation) noexcept
+	{
+		if ( size == 0 || size > m_capacity || !std::has_single_bit(alignment) )
+		{
+			return false;
+		}
+
+		alignment = std::max(alignment, Granularity);
+
+		const auto alignedSize = (size + Granularity - 1) & ~(Granularity - 1);
+		/* NOTE: Every block offset is a multiple of the granularity, so the padding never exceeds this value. */
+		const auto padding = alignment - Granularity;
+
+		if ( alignedSize > m_capacity - std::min(padding, m_capacity) )
+		{
+			return false;
+		}
+
+		const auto node = this->findFreeNode(alignedSize + padding);
+
+		if ( node == InvalidNode )
+		{
+			return false;
+		}
+
+		this->removeFreeNode(node);
+
+		const auto blockOffset = m_nodes[node].offset;
+		const auto alignedOffset = (blockOffset + alignment - 1) & ~(alignment - 1);
+
+		if ( alignedOffset > blockOffset )
+		{
+			/* NOTE: The padding in front of the aligned offset stays free. Its previous neighbor is never free. */
+			const auto front = this->createNode();
+
+			m_nodes[front].offset = blockOffset;
+			m_nodes[front].size = alignedOffset - blockOffset;
+			m_nodes[front].previousPhysical = m_nodes[node].previousPhysical;
+			m_nodes[front].nextPhysical = node;
+
+			if ( m_nodes[front].previousPhysical != InvalidNode )
+			{
+				m_nodes[m_nodes[front].previousPhysical].nextPhysical = front;
+			}
+			else
+			{
+				m_firstNode = front;
+			}
+
+			m_nodes[node].previousPhysical = front;
+			m_nodes[node].offset = alignedOffset;
+			m_nodes[node].size -= alignedOffset - blockOffset;
+
+			this->insertFreeNode(front);
+		}
+
+		this->splitTail(node, alignedSize);
+
+		m_nodes[node].alignment = alignment;
+		m_nodes[node].used = true;
+
+		m_usedBytes += m_nodes[node].size;
+		m_allocationCount++;
+
+		allocation.offset = m_nodes[node].offset;
+		allocation.size = m_nodes[node].size;
+		allocation.node = node;
+
+		return true;
+	}
+
+	void
+	TLSFAllocator::free (const Allocation & allocation) noexcept
+	{
+		auto node = allocation.node;
+
+		if ( node >= m_nodes.size() || !m_nodes[node].used )
+		{
+			return;
+		}
+
+		m_nodes[node].used = false;
+
+		m_usedBytes -= m_nodes[node].size;
+		m_allocationCount--;
+
+		if ( const auto next = m_nodes[node].nextPhysical; next != InvalidNode && !m_nodes[next].used )
+		{
+			this->removeFreeNode(next);
+			this->mergeWithNext(node);
+		}
+
+		if ( const auto previous = m_nodes[node].previousPhysical; previous != InvalidNode && !m_nodes[previous].used )
+		{
+			this->removeFreeNode(previous);
+			this->mergeWithNext(previous);
+
+			node = previous;
+		}
+
+		this->insertFreeNode(node);
+	}
+
+	size_t
+	TLSFAllocator::compact (const std::function< bool (const Allocation & allocation, uint64_t newOffset) > & mover) noexcept
+	{
+		size_t movedCount = 0;
+
+		for ( auto node = m_firstNode; node != InvalidNode; node = m_nodes[node].nextPhysical )
+		{
+			const auto previous = m_nodes[node].previousPhysical;
+
+			if ( !m_nodes[node].used || previous == InvalidNode || m_nodes[previous].used )
+			{
+				continue;
+			}
+
+			const auto alignment = m_nodes[node].alignment;
+			const auto newOffset = (m_nodes[previous].offset + alignment - 1) & ~(alignment - 1);
+
+			if ( newOffset >= m_nodes[node].offset || !mover({m_nodes[node].offset, m_nodes[node].size, node}, newOffset) )
+			{
+				continue;
+			}
+
+			const auto shift = m_nodes[node].offset - newOffset;
+
+			this->removeFreeNode(previous);
+
+			m_nodes[previous].size -= shift;
+			m_nodes[node].offset = newOffset;
+
+			if ( m_nodes[previous].size == 0 )
+			{
+				m_nodes[node].previousPhysical = m_nodes[previous].previousPhysical;
+
+				if ( m_nodes[node].previousPhysical != InvalidNode )
+				{
+					m_nodes[m_nodes[node].previousPhysical].nextPhysical = node;
+				}
+				else
+				{
+					m_firstNode = node;
+				}
+
+				this->releaseNode(previous);
+			}
+			else
+			{
+				this->insertFreeNode(previous);
+			}
+
+			/* NOTE: The space left behind joins the next free block, or becomes one. */
+			if ( const auto next = m_nodes[node].nextPhysical; next != InvalidNode && !m_nodes[next].used )
+			{
+				this->removeFreeNode(next);
+
+				m_nodes[next].offset -= shift;
+				m_nodes[next].size += shift;
+
+				this->insertFreeNode(next);
+			}
+			else
+			{
+				const auto gap = this->createNode();
+
+				m_nodes[gap].offset = m_nodes[node].offset + m_nodes[node].size;
+				m_nodes[gap].size = shift;
+				m_nodes[gap].previousPhysical = node;
+				m_nodes[gap].nextPhysical = next;
+
+				if ( next != InvalidNode )
+				{
+					m_nodes[next].previousPhysical = gap;
+				}
+
+				m_nodes[node].nextPhysical = gap;
+
+				this->insertFreeNode(gap);
+			}
+
+			movedCount++;
+		}
+
+		return movedCount;
+	}
+
+	uint64_t
+	TLSFAllocator::largestFreeBlock () const noexcept
+	{
+		if ( m_firstLevelBitmap == 0 )
+		{
+			return 0;
+		}
+
+		const auto firstLevel = static_cast< uint32_t >(std::bit_width(m_firstLevelBitmap) - 1);
+		const auto secondLevel = static_cast< uint32_t >(std::bit_width(m_secondLevelBitmaps[firstLevel]) - 1);
+
+		/* NOTE: The sizes inside the highest list differ, the list is walked to find the largest one. */
+		uint64_t largest = 0;
+
+		for ( auto node = m_freeLists[firstLevel][secondLevel]; node != InvalidNode; node = m_nodes[node].nextFree )
+		{
+			largest = std::max(largest, m_nodes[node].size);
+		}
+
+		return largest;
+	}
+
+	float
+	TLSFAllocator::fragmentation () const noexcept
+	{
+		const auto freeSpace = this->freeBytes();
+
+		if ( freeSpace == 0 )
+		{
+			return 0.0F;
+		}
+
+		return 1.0F - static_cast< float >(static_cast< double >(this->largestFreeBlock()) / static_cast< double >(freeSpace));
+	}
+
+	void
+	TLSFAllocator::mapping (uint64_t size, uint32_t & firstLevel, uint32_t & secondLevel) noexcept
+	{
+		const auto units = size / Granularity;
+
+		/* NOTE: The smallest sizes get one list per unit. */
+		if ( units < SecondLevelCount )
+		{
+			firstLevel = 0;
+			secondLevel = static_cast< uint32_t >(units);
+
+			return;
+		}
+
+		const auto highestBit = static_cast< uint32_t >(std::bit_width(units) - 1);
+
+		firstLevel = highestBit - SecondLevelBits + 1;
+		secondLevel = static_cast< uint32_t >(units >> (highestBit - SecondLevelBits)) - SecondLevelCount;
+	}
+
+	uint32_t
+	TLSFAllocator::createNode () noexcept
+	{
+		if ( !m_releasedNodes.empty() )
+		{
+			const auto node = m_releasedNodes.back();
+
+			m_releasedNodes.pop_back();
+
+			m_nodes[node] = Node{};
+
+			return node;
+		}
+
+		m_nodes.emplace_back();
+
+		return static_cast< uint32_t >(m_nodes.size() - 1);
+	}
+
+	void
+	TLSFAllocator::releaseNode (uint32_t node) noexcept
+	{
+		m_releasedNodes.push_back(node);
+	}
+
+	void
+	TLSFAllocator::insertFreeNode (uint32_t node) noexcept
+	{
+		uint32_t firstLevel = 0;
+		uint32_t secondLevel = 0;
+
+		mapping(m_nodes[node].size, firstLevel, secondLevel);
+
+		auto & head = m_freeLists[firstLevel][secondLevel];
+
+		m_nodes[node].previousFree = InvalidNode;
+		m_nodes[node].nextFree = head;
+
+		if ( head != InvalidNode )
+		{
+			m_nodes[head].previousFree = node;
+		}
+
+		head = node;
+
+		m_secondLevelBitmaps[firstLevel] |= 1U << secondLevel;
+		m_firstLevelBitmap |= 1ULL << firstLevel;
+		m_freeBlockCount++;
+	}
+
+	void
+	TLSFAllocator::removeFreeNode (uint32_t node) noexcept
+	{
+		const auto previous = m_nodes[node].previousFree;
+		const auto next = m_nodes[node].nextFree;
+
+		if ( next != InvalidNode )
+		{
+			m_nodes[next].previousFree = previous;
+		}
+
+		if ( previous != InvalidNode )
+		{
+			m_nodes[previous].nextFree = next;
+		}
+		else
+		{
+			uint32_t firstLevel = 0;
+			uint32_t secondLevel = 0;
+
+			mapping(m_nodes[node].size, firstLevel, secondLevel);
+
+			m_freeLists[firstLevel][secondLevel] = next;
+
+			if ( next == InvalidNode )
+			{
+				m_secondLevelBitmaps[firstLevel] &= ~(1U << secondLevel);
+
+				if ( m_secondLevelBitmaps[firstLevel] == 0 )
+				{
+					m_firstLevelBitmap &= ~(1ULL << firstLevel);
+				}
+			}
+		}
+
+		m_nodes[node].previousFree = InvalidNode;
+		m_nodes[node].nextFree = InvalidNode;
+		m_freeBlockCount--;
+	}
+
+	uint32_t
+	TLSFAllocator::findFreeNode (uint64_t size) const noexcept
+	{
+		/* NOTE: The size is rounded up to the next list, so any block of the list found fits. */
+		auto units = size / Granularity;
+
+		if ( units >= SecondLevelCount )
+		{
+			units += (1ULL << (std::bit_width(units) - 1 - SecondLevelBits)) - 1;
+		}
+
+		uint32_t firstLevel = 0;
+		uint32_t secondLevel = 0;
+
+		mapping(units * Granularity, firstLevel, secondLevel);
+
+		if ( firstLevel >= FirstLevelCount )
+		{
+			return InvalidNode;
+		}
+
+		auto secondLevelBitmap = m_secondLevelBitmaps[firstLevel] & (~0U << secondLevel);
+
+		if ( secondLevelBitmap == 0 )
+		{
+			const auto firstLevelBitmap = firstLevel + 1 < FirstLevelCount ? m_firstLevelBitmap & (~0ULL << (firstLevel + 1)) : 0;
+
+			if ( firstLevelBitmap == 0 )
+			{
+				return InvalidNode;
+			}
+
+			firstLevel = static_cast< uint32_t >(std::countr_zero(firstLevelBitmap));
+			secondLevelBitmap = m_secondLevelBitmaps[firstLevel];
+		}
+
+		return m_freeLists[firstLevel][static_cast< uint32_t >(std::countr_zero(secondLevelBitmap))];
+	}
+
+	void
+	TLSFAllocator::splitTail (uint32_t node, uint64_t size) noexcept
+	{
+		if ( m_nodes[node].size - size < Granularity )
+		{
+			return;
+		}
+
+		/* NOTE: The node was free, so its next neighbor is not. */
+		const auto tail = this->createNode();
+
+		m_nodes[tail].offset = m_nodes[node].offset + size;
+		m_nodes[tail].size = m_nodes[node].size - size;
+		m_nodes[tail].previousPhysical = node;
+		m_nodes[tail].nextPhysical = m_nodes[node].nextPhysical;
+
+		if ( m_nodes[tail].nextPhysical != InvalidNode )
+		{
+			m_nodes[m_nodes[tail].nextPhysical].previousPhysical = tail;
+		}
+
+		m_nodes[node].nextPhysical = tail;
+		m_nodes[node].size = size;
+
+		this->insertFreeNode(tail);
+	}
+
+	void
+	TLSFAllocator::mergeWithNext (uint32_t node) noexcept
+	{
+		const auto next = m_nodes[node].nextPhysical;
+
+		m_nodes[node].size += m_nodes[next].size;
+		m_nodes[node].nextPhysical = m_nodes[next].nextPhysical;
+
+		if ( m_nodes[node].nextPhysical != InvalidNode )
+		{
+			m_nodes[m_nodes[node].nextPhysical].previousPhysical = node;
+		}
+
+		this->releaseNode(next);
+	}
+}
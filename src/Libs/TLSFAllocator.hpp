@@ -0,0 +1,264 @@
+/*
+ * src/Libs/TLSFAllocator.hpp
+ * This file is part of Emeraude-Engine
+ *
+ * Copyright (C) 2010-2025 - Sébastien Léon Claude Christian Bémelmans "LondNoir" <londnoir@gmail.com>
+ *
+ * Emeraude-Engine is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * Emeraude-Engine is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with Emeraude-Engine; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * Complete project and additional information can be found at :
+ * https://github.com/londnoir/emeraude-engine
+ *
+ * --- THIS IS AUTOMATICALLY GENERATED, DO NOT CHANGE ---
+ */
+
+
+#pragma once
+
+/* STL inclusions. */
+#include <cstddef>
+#include <cstdint>
+#include <array>
+#include <functional>
+#include <limits>
+#include <vector>
+
+namespace EmEn::Libs
+{
+	/**
+	 * @brief Two-level segregated fit allocator of offsets inside a fixed range.
+	 * @note Only the bookkeeping is done here, the range itself lives elsewhere (a GPU memory block, a file, ...).
+	 * Allocation and release run in constant time. Offsets and sizes are multiples of the granularity.
+	 */
+	class TLSFAllocator final
+	{
+		public:
+
+			/** @brief The smallest unit of allocation in bytes. */
+			static constexpr uint64_t Granularity{16};
+			/** @brief The number of bits splitting a first level into second levels. */
+			static constexpr uint32_t SecondLevelBits{4};
+			/** @brief The number of second levels per first level. */
+			static constexpr uint32_t SecondLevelCount{1U << SecondLevelBits};
+			/** @brief The number of first levels. */
+			static constexpr uint32_t FirstLevelCount{64};
+			/** @brief The value of an invalid node. */
+			static constexpr uint32_t InvalidNode{std::numeric_limits< uint32_t >::max()};
+
+			/** @brief An allocated range. */
+			struct Allocation
+			{
+				uint64_t offset{0};
+				uint64_t size{0};
+				uint32_t node{InvalidNode};
+			};
+
+			/**
+			 * @brief Constructs an allocator.
+			 * @param capacity The range size in bytes. It is rounded down to the granularity.
+			 */
+			explicit TLSFAllocator (uint64_t capacity) noexcept;
+
+			/**
+			 * @brief Allocates a range.
+			 * @param size The size in bytes.
+			 * @param alignment The offset alignment in bytes. Must be a power of two.
+			 * @param allocation A reference to the allocated range.
+			 * @return bool
+			 */
+			bool allocate (uint64_t size, uint64_t alignment, Allocation & allocation) noexcept;
+
+			/**
+			 * @brief Releases a range and merges it with its free neighbors.
+			 * @param allocation A reference to the allocated range.
+			 * @return void
+			 */
+			void free (const Allocation & allocation) noexcept;
+
+			/**
+			 * @brief Moves allocations toward the beginning of the range to merge the free space.
+			 * @note This is the defragmentation hook. The mover copies the content and rebinds its user to the new offset,
+			 * returning false leaves the allocation in place. An allocation keeps its node through the move.
+			 * @param mover The function called for each move with the allocation and its new offset.
+			 * @return size_t The number of moved allocations.
+			 */
+			size_t compact (const std::function< bool (const Allocation & allocation, uint64_t newOffset) > & mover) noexcept;
+
+			/**
+			 * @brief Returns the range size in bytes.
+			 * @return uint64_t
+			 */
+			[[nodiscard]]
+			uint64_t
+			capacity () const noexcept
+			{
+				return m_capacity;
+			}
+
+			/**
+			 * @brief Returns the allocated bytes, alignment padding included.
+			 * @return uint64_t
+			 */
+			[[nodiscard]]
+			uint64_t
+			usedBytes () const noexcept
+			{
+				return m_usedBytes;
+			}
+
+			/**
+			 * @brief Returns the free bytes.
+			 * @return uint64_t
+			 */
+			[[nodiscard]]
+			uint64_t
+			freeBytes () const noexcept
+			{
+				return m_capacity - m_usedBytes;
+			}
+
+			/**
+			 * @brief Returns the number of allocations.
+			 * @return size_t
+			 */
+			[[nodiscard]]
+			size_t
+			allocationCount () const noexcept
+			{
+				return m_allocationCount;
+			}
+
+			/**
+			 * @brief Returns whether there is no allocation.
+			 * @return bool
+			 */
+			[[nodiscard]]
+			bool
+			isEmpty () const noexcept
+			{
+				return m_allocationCount == 0;
+			}
+
+			/**
+			 * @brief Returns the number of free blocks.
+			 * @return size_t
+			 */
+			[[nodiscard]]
+			size_t
+			freeBlockCount () const noexcept
+			{
+				return m_freeBlockCount;
+			}
+
+			/**
+			 * @brief Returns the size of the largest free block.
+			 * @return uint64_t
+			 */
+			[[nodiscard]]
+			uint64_t largestFreeBlock () const noexcept;
+
+			/**
+			 * @brief Returns the fragmentation of the free space, from 0 (one free block) to 1.
+			 * @return float
+			 */
+			[[nodiscard]]
+			float fragmentation () const noexcept;
+
+		private:
+
+			/** @brief A physical block of the range, free or allocated. */
+			struct Node
+			{
+				uint64_t offset{0};
+				uint64_t size{0};
+				uint64_t alignment{Granularity};
+				uint32_t previousPhysical{InvalidNode};
+				uint32_t nextPhysical{InvalidNode};
+				uint32_t previousFree{InvalidNode};
+				uint32_t nextFree{InvalidNode};
+				bool used{false};
+			};
+
+			/**
+			 * @brief Returns the levels of the list holding a free block size.
+			 * @param size The block size in bytes.
+			 * @param firstLevel A reference to the first level.
+			 * @param secondLevel A reference to the second level.
+			 * @return void
+			 */
+			static void mapping (uint64_t size, uint32_t & firstLevel, uint32_t & secondLevel) noexcept;
+
+			/**
+			 * @brief Creates a node, reusing a released one when possible.
+			 * @return uint32_t
+			 */
+			uint32_t createNode () noexcept;
+
+			/**
+			 * @brief Releases a node.
+			 * @param node The node index.
+			 * @return void
+			 */
+			void releaseNode (uint32_t node) noexcept;
+
+			/**
+			 * @brief Inserts a free node in its list.
+			 * @param node The node index.
+			 * @return void
+			 */
+			void insertFreeNode (uint32_t node) noexcept;
+
+			/**
+			 * @brief Removes a free node from its list.
+			 * @param node The node index.
+			 * @return void
+			 */
+			void removeFreeNode (uint32_t node) noexcept;
+
+			/**
+			 * @brief Finds a free node holding at least a size.
+			 * @param size The size in bytes.
+			 * @return uint32_t
+			 */
+			[[nodiscard]]
+			uint32_t findFreeNode (uint64_t size) const noexcept;
+
+			/**
+			 * @brief Splits the tail of a node in a new free node.
+			 * @param node The node index.
+			 * @param size The size kept by the node.
+			 * @return void
+			 */
+			void splitTail (uint32_t node, uint64_t size) noexcept;
+
+			/**
+			 * @brief Merges a node with its next physical node, which must be out of the free lists.
+			 * @param node The node index.
+			 * @return void
+			 */
+			void mergeWithNext (uint32_t node) noexcept;
+
+			std::vector< Node > m_nodes;
+			std::vector< uint32_t > m_releasedNodes;
+			std::array< std::array< uint32_t, SecondLevelCount >, FirstLevelCount > m_freeLists{};
+			std::array< uint32_t, FirstLevelCount > m_secondLevelBitmaps{};
+			uint64_t m_firstLevelBitmap{0};
+			uint64_t m_capacity;
+			uint64_t m_usedBytes{0};
+			size_t m_allocationCount{0};
+			size_t m_freeBlockCount{0};
+			uint32_t m_firstNode{InvalidNode};
+	};
+}
@@ -0,0 +1,465 @@
+/*
+ * src/Libs/ThreadPool.cpp
+ * This file is part of Emeraude-Engine
+ *
+ * Copyright (C) 2010-2025 - Sébastien Léon Claude Christian Bémelmans "LondNoir" <londnoir@gmail.com>
+ *
+ * Emeraude-Engine is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * Emeraude-Engine is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with Emeraude-Engine; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * Complete project and additional information can be found at :
+ * https://github.com/londnoir/emeraude-engine
+ *
+ * --- THIS IS AUTOMATICALLY GENERATED, DO NOT CHANGE ---
+ */
+
+#include "ThreadPool.hpp"
+
+/* STL inclusions. */
+#include <algorithm>
+#include <chrono>
+#include <utility>
+
+namespace EmEn::Libs
+{
+	/* NOTE: Identifies the pool and the worker running on the current thread. */
+	static thread_local const ThreadPool * s_currentPool{nullptr};
+	static thread_local size_t s_currentWorkerIndex{0};
+	/* NOTE: The pool shared with the library code, registered by its owner. */
+	static std::atomic< ThreadPool * > s_sharedPool{nullptr};
+
+	ThreadPool::ThreadPool (size_t workerCount) noexcept
+	{
+		m_queues.reserve(workerCount);
+		m_workers.reserve(workerCount);
+
+		for ( size_t workerIndex = 0; workerIndex < workerCount; workerIndex++ )
+		{
+			m_queues.emplace_back(std::make_unique< WorkerQueues >());
+		}
+
+		for ( size_t workerIndex = 0; workerIndex < workerCount; workerIndex++ )
+		{
+			m_workers.emplace_back(&ThreadPool::workerLoop, this, workerIndex);
+		}
+	}
+
+	ThreadPool::~ThreadPool ()
+	{
+		this->stop();
+	}
+
+	bool
+	ThreadPool::isWorkerThread () const noexcept
+	{
+		return s_currentPool == this;
+	}
+
+	void
+	ThreadPool::setShared (ThreadPool * threadPool) noexcept
+	{
+		s_sharedPool.store(threadPool, std::memory_order_release);
+	}
+
+	ThreadPool *
+	ThreadPool::shared () noexcept
+	{
+		return s_sharedPool.load(std::memory_order_acquire);
+	}
+
+	void
+	ThreadPool::stop () noexcept
+	{
+		{
+			const std::lock_guard< std::mutex > lock{m_sleepMutex};
+
+			m_running.store(false, std::memory_order_release);
+		}
+
+		m_wakeUp.notify_all();
+
+		for ( auto & worker : m_workers )
+		{
+			if ( worker.joinable() )
+			{
+				worker.join();
+			}
+		}
+	}
+
+	void
+	ThreadPool::submit (Job job, Priority priority) noexcept
+	{
+		if ( m_workers.empty() )
+		{
+			job();
+
+			return;
+		}
+
+		this->push({std::move(job), nullptr}, priority);
+	}
+
+	void
+	ThreadPool::submit (Job job, JobGroup & group, Priority priority) noexcept
+	{
+		group.jobAdded();
+
+		if ( m_workers.empty() )
+		{
+			job();
+
+			group.jobDone();
+
+			return;
+		}
+
+		this->push({std::move(job), &group}, priority);
+	}
+
+	void
+	ThreadPool::wait (JobGroup & group) noexcept
+	{
+		constexpr std::chrono::milliseconds SleepDuration{1};
+
+		const auto workerIndex = this->isWorkerThread() ? s_currentWorkerIndex : m_queues.size();
+
+		while ( !group.finished() )
+		{
+			/* NOTE: Help the pool instead of blocking a thread. */
+			QueuedJob queuedJob;
+
+			if ( this->pop(workerIndex, queuedJob) )
+			{
+				ThreadPool::execute(queuedJob);
+
+				continue;
+			}
+
+			/* NOTE: The remaining jobs of the group are running elsewhere. */
+			std::unique_lock< std::mutex > lock{group.m_mutex};
+
+			group.m_condition.wait_for(lock, SleepDuration, [&group] () {
+				return group.finished();
+			});
+		}
+
+		/* NOTE: Ensure the last JobGroup::jobDone() call released the group before the caller destroys it. */
+		const std::lock_guard< std::mutex > lock{group.m_mutex};
+	}
+
+	void
+	ThreadPool::parallelFor (size_t first, size_t last, const std::function< void (size_t first, size_t last) > & function, size_t grainSize, Priority priority) noexcept
+	{
+		if ( last <= first )
+		{
+			return;
+		}
+
+		const auto count = last - first;
+
+		if ( grainSize == 0 )
+		{
+			const auto chunkCount = std::max< size_t >(1, this->workerCount() * ChunksPerWorker);
+
+			grainSize = (count + chunkCount - 1) / chunkCount;
+		}
+
+		if ( this->workerCount() == 0 || count <= grainSize )
+		{
+			function(first, last);
+
+			return;
+		}
+
+		JobGroup group;
+
+		/* NOTE: The first chunk is kept for the calling thread. */
+		for ( auto chunkFirst = first + grainSize; chunkFirst < last; chunkFirst += grainSize )
+		{
+			const auto chunkLast = std::min(chunkFirst + grainSize, last);
+
+			this->submit([&function, chunkFirst, chunkLast] () {
+				function(chunkFirst, chunkLast);
+			}, group, priority);
+		}
+
+		function(first, first + grainSize);
+
+		this->wait(group);
+	}
+
+	void
+	ThreadPool::workerLoop (size_t workerIndex) noexcept
+	{
+		s_currentPool = this;
+		s_currentWorkerIndex = workerIndex;
+
+		while ( true )
+		{
+			QueuedJob queuedJob;
+
+			if ( this->pop(workerIndex, queuedJob) )
+			{
+				ThreadPool::execute(queuedJob);
+
+				continue;
+			}
+
+			std::unique_lock< std::mutex > lock{m_sleepMutex};
+
+			/* NOTE: Leave only when the pool is stopping and every queued job is done. */
+			if ( !m_running.load(std::memory_order_acquire) && m_queuedJobs.load(std::memory_order_acquire) == 0 )
+			{
+				break;
+			}
+
+			m_wakeUp.wait(lock, [this] () {
+				return m_queuedJobs.load(std::memory_order_acquire) > 0 || !m_running.load(std::memory_order_acquire);
+			});
+		}
+
+		s_currentPool = nullptr;
+	}
+
+	void
+	ThreadPool::push (QueuedJob queuedJob, Priority priority) noexcept
+	{
+		/* NOTE: A worker keeps its sub-jobs local, others are spread in round-robin. */
+		const auto queueIndex = this->isWorkerThread() ?
+			s_currentWorkerIndex :
+			m_nextQueue.fetch_add(1, std::memory_order_relaxed) % m_queues.size();
+
+		bool accepted = false;
+
+		{
+			/* NOTE: Taking the lock prevents a worker from missing the wake-up between its check and its wait,
+			 * or from leaving while the job is being queued. Once stopped, only a running job can still queue
+			 * sub-jobs, because its worker is still there to execute them. */
+			const std::lock_guard< std::mutex > lock{m_sleepMutex};
+
+			accepted = m_running.load(std::memory_order_acquire) || this->isWorkerThread();
+
+			if ( accepted )
+			{
+				m_queuedJobs.fetch_add(1, std::memory_order_release);
+			}
+		}
+
+		if ( !accepted )
+		{
+			ThreadPool::execute(queuedJob);
+
+			return;
+		}
+
+		auto & queues = *m_queues[queueIndex];
+
+		{
+			const std::lock_guard< std::mutex > lock{queues.mutex};
+
+			queues.jobs[static_cast< size_t >(priority)].emplace_back(std::move(queuedJob));
+		}
+
+		m_wakeUp.notify_one();
+	}
+
+	bool
+	ThreadPool::pop (size_t workerIndex, QueuedJob & queuedJob) noexcept
+	{
+		if ( m_queuedJobs.load(std::memory_order_acquire) == 0 )
+		{
+			return false;
+		}
+
+		const auto queueCount = m_queues.size();
+
+		for ( size_t priority = 0; priority < PriorityCount; priority++ )
+		{
+			/* Own queue first, newest job. */
+			if ( workerIndex < queueCount )
+			{
+				auto & queues = *m_queues[workerIndex];
+
+				const std::lock_guard< std::mutex > lock{queues.mutex};
+
+				auto & jobs = queues.jobs[priority];
+
+				if ( !jobs.empty() )
+				{
+					queuedJob = std::move(jobs.back());
+					jobs.pop_back();
+
+					m_queuedJobs.fetch_sub(1, std::memory_order_acq_rel);
+
+					return true;
+				}
+			}
+
+			/* Then steal the oldest job from the other workers. */
+			for ( size_t offset = 1; offset <= queueCount; offset++ )
+			{
+				const auto victimIndex = (workerIndex + offset) % queueCount;
+
+				if ( victimIndex == workerIndex )
+				{
+					continue;
+				}
+
+				auto & queues = *m_queues[victimIndex];
+
+				const std::lock_guard< std::mutex > lock{queues.mutex};
+
+				auto & jobs = queues.jobs[priority];
+
+				if ( !jobs.empty() )
+				{
+					queuedJob = std::move(jobs.front());
+					jobs.pop_front();
+
+					m_queuedJobs.fetch_sub(1, std::memory_order_acq_rel);
+
+					return true;
+				}
+			}
+		}
+
+		return false;
+	}
+
+	void
+	ThreadPool::execute (QueuedJob & queuedJob) noexcept
+	{
+		queuedJob.job();
+
+		if ( queuedJob.group != nullptr )
+		{
+			queuedJob.group->jobDone();
+		}
+	}
+
+	TaskGraph::TaskId
+	TaskGraph::addTask (ThreadPool::Job job, ThreadPool::Priority priority) noexcept
+	{
+		auto node = std::make_unique< Node >();
+		node->job = std::move(job);
+		node->priority = priority;
+
+		m_nodes.emplace_back(std::move(node));
+
+		return m_nodes.size() - 1;
+	}
+
+	bool
+	TaskGraph::addDependency (TaskId task, TaskId dependency) noexcept
+	{
+		if ( task >= m_nodes.size() || dependency >= m_nodes.size() || task == dependency )
+		{
+			return false;
+		}
+
+		m_nodes[dependency]->dependents.emplace_back(task);
+		m_nodes[task]->dependencyCount++;
+
+		return true;
+	}
+
+	bool
+	TaskGraph::isAcyclic () const noexcept
+	{
+		/* NOTE: Kahn's algorithm, every task must be reachable from the roots. */
+		std::vector< size_t > remaining(m_nodes.size());
+		std::vector< TaskId > ready;
+
+		for ( TaskId taskId = 0; taskId < m_nodes.size(); taskId++ )
+		{
+			remaining[taskId] = m_nodes[taskId]->dependencyCount;
+
+			if ( remaining[taskId] == 0 )
+			{
+				ready.emplace_back(taskId);
+			}
+		}
+
+		size_t visited = 0;
+
+		while ( !ready.empty() )
+		{
+			const auto taskId = ready.back();
+			ready.pop_back();
+
+			visited++;
+
+			for ( const auto dependent : m_nodes[taskId]->dependents )
+			{
+				if ( --remaining[dependent] == 0 )
+				{
+					ready.emplace_back(dependent);
+				}
+			}
+		}
+
+		return visited == m_nodes.size();
+	}
+
+	bool
+	TaskGraph::execute (ThreadPool & threadPool) noexcept
+	{
+		if ( !this->isAcyclic() )
+		{
+			return false;
+		}
+
+		for ( const auto & node : m_nodes )
+		{
+			node->remainingDependencies.store(node->dependencyCount, std::memory_order_relaxed);
+		}
+
+		JobGroup group;
+
+		for ( TaskId taskId = 0; taskId < m_nodes.size(); taskId++ )
+		{
+			if ( m_nodes[taskId]->dependencyCount == 0 )
+			{
+				this->schedule(threadPool, group, taskId);
+			}
+		}
+
+		threadPool.wait(group);
+
+		return true;
+	}
+
+	void
+	TaskGraph::schedule (ThreadPool & threadPool, JobGroup & group, TaskId taskId) noexcept
+	{
+		auto & node = *m_nodes[taskId];
+
+		threadPool.submit([this, &threadPool, &group, &node] () {
+			if ( node.job )
+			{
+				node.job();
+			}
+
+			/* NOTE: Dependents are submitted before this job is declared done, so the group never empties too early. */
+			for ( const auto dependent : node.dependents )
+			{
+				if ( m_nodes[dependent]->remainingDependencies.fetch_sub(1, std::memory_order_acq_rel) == 1 )
+				{
+					this->schedule(threadPool, group, dependent);
+				}
+			}
+		}, group, node.priority);
+	}
+}
@@ -0,0 +1,440 @@
+/*
+ * src/Libs/ThreadPool.hpp
+ * This file is part of Emeraude-Engine
+ *
+ * Copyright (C) 2010-2025 - Sébastien Léon Claude Christian Bémelmans "LondNoir" <londnoir@gmail.com>
+ *
+ * Emeraude-Engine is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * Emeraude-Engine is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with Emeraude-Engine; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * Complete project and additional information can be found at :
+ * https://github.com/londnoir/emeraude-engine
+ *
+ * --- THIS IS AUTOMATICALLY GENERATED, DO NOT CHANGE ---
+ */
+
+#pragma once
+
+/* STL inclusions. */
+#include <cstddef>
+#include <cstdint>
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace EmEn::Libs
+{
+	class ThreadPool;
+
+	/**
+	 * @brief Completion counter shared by a set of jobs submitted to a thread pool.
+	 * @note The group must outlive every job attached to it. ThreadPool::wait() guarantees it.
+	 */
+	class JobGroup final
+	{
+		friend class ThreadPool;
+
+		public:
+
+			/**
+			 * @brief Constructs a job group.
+			 */
+			JobGroup () noexcept = default;
+
+			/**
+			 * @brief Copy constructor.
+			 * @param copy A reference to the copied instance.
+			 */
+			JobGroup (const JobGroup & copy) noexcept = delete;
+
+			/**
+			 * @brief Move constructor.
+			 * @param copy A reference to the copied instance.
+			 */
+			JobGroup (JobGroup && copy) noexcept = delete;
+
+			/**
+			 * @brief Copy assignment.
+			 * @param copy A reference to the copied instance.
+			 * @return JobGroup &
+			 */
+			JobGroup & operator= (const JobGroup & copy) noexcept = delete;
+
+			/**
+			 * @brief Move assignment.
+			 * @param copy A reference to the copied instance.
+			 * @return JobGroup &
+			 */
+			JobGroup & operator= (JobGroup && copy) noexcept = delete;
+
+			/**
+			 * @brief Destructs the job group.
+			 */
+			~JobGroup () = default;
+
+			/**
+			 * @brief Returns whether every job of the group is done.
+			 * @return bool
+			 */
+			[[nodiscard]]
+			bool
+			finished () const noexcept
+			{
+				return m_pendingJobs.load(std::memory_order_acquire) == 0;
+			}
+
+			/**
+			 * @brief Returns the number of jobs not finished yet.
+			 * @return size_t
+			 */
+			[[nodiscard]]
+			size_t
+			pendingJobs () const noexcept
+			{
+				return m_pendingJobs.load(std::memory_order_acquire);
+			}
+
+		private:
+
+			/**
+			 * @brief Declares a new job in the group.
+			 * @return void
+			 */
+			void
+			jobAdded () noexcept
+			{
+				m_pendingJobs.fetch_add(1, std::memory_order_relaxed);
+			}
+
+			/**
+			 * @brief Declares a job of the group finished.
+			 * @return void
+			 */
+			void
+			jobDone () noexcept
+			{
+				const std::lock_guard< std::mutex > lock{m_mutex};
+
+				if ( m_pendingJobs.fetch_sub(1, std::memory_order_acq_rel) == 1 )
+				{
+					m_condition.notify_all();
+				}
+			}
+
+			std::atomic< size_t > m_pendingJobs{0};
+			std::mutex m_mutex;
+			std::condition_variable m_condition;
+	};
+
+	/**
+	 * @brief Persistent work-stealing thread pool.
+	 * @note Each worker owns a deque per priority level. A worker pops its own jobs from the back (the most recent, still hot in cache)
+	 * and steals the oldest jobs from the front of the other workers when it runs out of work. Higher priority levels are always emptied first.
+	 * A thread waiting on a job group executes pending jobs meanwhile, so nested parallelism never deadlocks the pool.
+	 */
+	class ThreadPool final
+	{
+		public:
+
+			/** @brief Job priority levels. */
+			enum class Priority : uint8_t
+			{
+				High = 0,
+				Normal = 1,
+				Low = 2
+			};
+
+			using Job = std::function< void () >;
+
+			/**
+			 * @brief Constructs and starts a thread pool.
+			 * @param workerCount The number of worker threads. Zero means jobs run on the submitting thread.
+			 */
+			explicit ThreadPool (size_t workerCount) noexcept;
+
+			/**
+			 * @brief Copy constructor.
+			 * @param copy A reference to the copied instance.
+			 */
+			ThreadPool (const ThreadPool & copy) noexcept = delete;
+
+			/**
+			 * @brief Move constructor.
+			 * @param copy A reference to the copied instance.
+			 */
+			ThreadPool (ThreadPool && copy) noexcept = delete;
+
+			/**
+			 * @brief Copy assignment.
+			 * @param copy A reference to the copied instance.
+			 * @return ThreadPool &
+			 */
+			ThreadPool & operator= (const ThreadPool & copy) noexcept = delete;
+
+			/**
+			 * @brief Move assignment.
+			 * @param copy A reference to the copied instance.
+			 * @return ThreadPool &
+			 */
+			ThreadPool & operator= (ThreadPool && copy) noexcept = delete;
+
+			/**
+			 * @brief Destructs the thread pool after finishing every queued job.
+			 */
+			~ThreadPool ();
+
+			/**
+			 * @brief Returns the number of worker threads, zero once the pool is stopped.
+			 * @return size_t
+			 */
+			[[nodiscard]]
+			size_t
+			workerCount () const noexcept
+			{
+				return m_running.load(std::memory_order_acquire) ? m_workers.size() : 0;
+			}
+
+			/**
+			 * @brief Returns the number of jobs waiting in the queues.
+			 * @return size_t
+			 */
+			[[nodiscard]]
+			size_t
+			queuedJobs () const noexcept
+			{
+				return m_queuedJobs.load(std::memory_order_relaxed);
+			}
+
+			/**
+			 * @brief Returns whether the current thread is a worker of this pool.
+			 * @return bool
+			 */
+			[[nodiscard]]
+			bool isWorkerThread () const noexcept;
+
+			/**
+			 * @brief Declares the pool used by the library code which splits its work, like the pixel kernels.
+			 * @note The owner must unregister the pool with a null pointer before destroying it.
+			 * @param threadPool A pointer to the pool. Null makes the library code run on the calling thread.
+			 * @return void
+			 */
+			static void setShared (ThreadPool * threadPool) noexcept;
+
+			/**
+			 * @brief Stops accepting jobs, finishes the queued ones and joins the workers.
+			 * @note Jobs still running can queue sub-jobs until the end. Afterward, every job runs on the submitting thread.
+			 * @return void
+			 */
+			void stop () noexcept;
+
+			/**
+			 * @brief Returns the pool declared for the library code, or null.
+			 * @return ThreadPool *
+			 */
+			[[nodiscard]]
+			static ThreadPool * shared () noexcept;
+
+			/**
+			 * @brief Submits a job without completion tracking.
+			 * @param job The job function [std::move].
+			 * @param priority The job priority. Default normal.
+			 * @return void
+			 */
+			void submit (Job job, Priority priority = Priority::Normal) noexcept;
+
+			/**
+			 * @brief Submits a job attached to a group.
+			 * @param job The job function [std::move].
+			 * @param group A reference to the job group.
+			 * @param priority The job priority. Default normal.
+			 * @return void
+			 */
+			void submit (Job job, JobGroup & group, Priority priority = Priority::Normal) noexcept;
+
+			/**
+			 * @brief Waits for every job of a group, executing queued jobs meanwhile.
+			 * @param group A reference to the job group.
+			 * @return void
+			 */
+			void wait (JobGroup & group) noexcept;
+
+			/**
+			 * @brief Splits a range into chunks and processes them in parallel. Returns when the whole range is processed.
+			 * @param first The first index.
+			 * @param last The index past the last one.
+			 * @param function A reference to the function processing a [first, last) chunk.
+			 * @param grainSize The chunk size. Zero lets the pool choose one. Default 0.
+			 * @param priority The job priority. Default normal.
+			 * @return void
+			 */
+			void parallelFor (size_t first, size_t last, const std::function< void (size_t first, size_t last) > & function, size_t grainSize = 0, Priority priority = Priority::Normal) noexcept;
+
+		private:
+
+			static constexpr auto PriorityCount{3UL};
+			/* NOTE: Number of chunks per worker created by parallelFor() when no grain size is given, to balance uneven chunks. */
+			static constexpr auto ChunksPerWorker{4UL};
+
+			/** @brief A queued job. */
+			struct QueuedJob
+			{
+				Job job;
+				JobGroup * group{nullptr};
+			};
+
+			/** @brief The queues of a worker, one per priority level. */
+			struct WorkerQueues
+			{
+				std::array< std::deque< QueuedJob >, PriorityCount > jobs;
+				std::mutex mutex;
+			};
+
+			/**
+			 * @brief The worker thread loop.
+			 * @param workerIndex The worker index.
+			 * @return void
+			 */
+			void workerLoop (size_t workerIndex) noexcept;
+
+			/**
+			 * @brief Queues a job to the current worker or to the next worker in round-robin.
+			 * @note The job is executed right away by the calling thread when the pool is stopped.
+			 * @param queuedJob The job [std::move].
+			 * @param priority The job priority.
+			 * @return void
+			 */
+			void push (QueuedJob queuedJob, Priority priority) noexcept;
+
+			/**
+			 * @brief Takes the next job, first from the own queues of a worker, then by stealing from the others.
+			 * @param workerIndex The index of the worker looking for a job. Out of range for an external thread.
+			 * @param queuedJob A reference to the job taken.
+			 * @return bool
+			 */
+			[[nodiscard]]
+			bool pop (size_t workerIndex, QueuedJob & queuedJob) noexcept;
+
+			/**
+			 * @brief Executes a job taken from the queues.
+			 * @param queuedJob A reference to the job.
+			 * @return void
+			 */
+			static void execute (QueuedJob & queuedJob) noexcept;
+
+			std::vector< std::unique_ptr< WorkerQueues > > m_queues;
+			std::vector< std::thread > m_workers;
+			std::atomic< size_t > m_queuedJobs{0};
+			std::atomic< size_t > m_nextQueue{0};
+			std::atomic< bool > m_running{true};
+			std::mutex m_sleepMutex;
+			std::condition_variable m_wakeUp;
+	};
+
+	/**
+	 * @brief A set of jobs with dependencies, executed on a thread pool.
+	 * @note A job starts as soon as all the jobs it depends on are finished. The graph can be executed several times.
+	 */
+	class TaskGraph final
+	{
+		public:
+
+			using TaskId = size_t;
+
+			/**
+			 * @brief Constructs an empty task graph.
+			 */
+			TaskGraph () noexcept = default;
+
+			/**
+			 * @brief Adds a task to the graph.
+			 * @param job The task function [std::move].
+			 * @param priority The task priority. Default normal.
+			 * @return TaskId
+			 */
+			TaskId addTask (ThreadPool::Job job, ThreadPool::Priority priority = ThreadPool::Priority::Normal) noexcept;
+
+			/**
+			 * @brief Declares a task must wait for another one.
+			 * @param task The dependent task.
+			 * @param dependency The task to wait for.
+			 * @return bool
+			 */
+			bool addDependency (TaskId task, TaskId dependency) noexcept;
+
+			/**
+			 * @brief Returns the number of tasks.
+			 * @return size_t
+			 */
+			[[nodiscard]]
+			size_t
+			taskCount () const noexcept
+			{
+				return m_nodes.size();
+			}
+
+			/**
+			 * @brief Executes every task respecting the dependencies. Returns when all tasks are done.
+			 * @param threadPool A reference to the thread pool.
+			 * @return bool False if the graph has a dependency cycle, nothing is executed then.
+			 */
+			[[nodiscard]]
+			bool execute (ThreadPool & threadPool) noexcept;
+
+			/**
+			 * @brief Removes every task.
+			 * @return void
+			 */
+			void
+			clear () noexcept
+			{
+				m_nodes.clear();
+			}
+
+		private:
+
+			/** @brief A task of the graph. */
+			struct Node
+			{
+				ThreadPool::Job job;
+				ThreadPool::Priority priority{ThreadPool::Priority::Normal};
+				std::vector< TaskId > dependents;
+				size_t dependencyCount{0};
+				std::atomic< size_t > remainingDependencies{0};
+			};
+
+			/**
+			 * @brief Checks the graph has no cycle.
+			 * @return bool
+			 */
+			[[nodiscard]]
+			bool isAcyclic () const noexcept;
+
+			/**
+			 * @brief Submits a task whose dependencies are done.
+			 * @param threadPool A reference to the thread pool.
+			 * @param group A reference to the job group of the execution.
+			 * @param taskId The task.
+			 * @return void
+			 */
+			void schedule (ThreadPool & threadPool, JobGroup & group, TaskId taskId) noexcept;
+
+			std::vector< std::unique_ptr< Node > > m_nodes;
+	};
+}
@@ -0,0 +1,124 @@
+/*
+ * src/Libs/Time/Statistics/Histogram.cpp
+ * This file is part of Emeraude-Engine
+ *
+ * Copyright (C) 2010-2025 - Sébastien Léon Claude Christian Bémelmans "LondNoir" <londnoir@gmail.com>
+ *
+ * Emeraude-Engine is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * Emeraude-Engine is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with Emeraude-Engine; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * Complete project and additional information can be found at :
+ * https://github.com/londnoir/emeraude-engine
+ *
+ * --- THIS IS AUTOMATICALLY GENERATED, DO NOT CHANGE ---
+ */
+
+#include "Histogram.hpp"
+
+/* STL inclusions. */
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+
+namespace EmEn::Libs::Time::Statistics
+{
+	Histogram::Histogram (size_t range) noexcept
+		: m_samples(std::max< size_t >(range, 1), 0.0)
+	{
+
+	}
+
+	void
+	Histogram::insert (double value) noexcept
+	{
+		m_samples[m_index] = value;
+
+		m_index = (m_index + 1) % m_samples.size();
+		m_count = std::min(m_count + 1, m_samples.size());
+		m_topCount++;
+	}
+
+	void
+	Histogram::reset () noexcept
+	{
+		std::ranges::fill(m_samples, 0.0);
+
+		m_index = 0;
+		m_count = 0;
+		m_topCount = 0;
+	}
+
+	double
+	Histogram::last () const noexcept
+	{
+		if ( m_count == 0 )
+		{
+			return 0.0;
+		}
+
+		return m_samples[(m_index + m_samples.size() - 1) % m_samples.size()];
+	}
+
+	double
+	Histogram::minimum () const noexcept
+	{
+		if ( m_count == 0 )
+		{
+			return 0.0;
+		}
+
+		/* NOTE: Until the range is reached, samples are stored from the beginning. */
+		return *std::min_element(m_samples.cbegin(), m_samples.cbegin() + static_cast< std::ptrdiff_t >(m_count));
+	}
+
+	double
+	Histogram::maximum () const noexcept
+	{
+		if ( m_count == 0 )
+		{
+			return 0.0;
+		}
+
+		return *std::max_element(m_samples.cbegin(), m_samples.cbegin() + static_cast< std::ptrdiff_t >(m_count));
+	}
+
+	double
+	Histogram::average () const noexcept
+	{
+		if ( m_count == 0 )
+		{
+			return 0.0;
+		}
+
+		return std::accumulate(m_samples.cbegin(), m_samples.cbegin() + static_cast< std::ptrdiff_t >(m_count), 0.0) / static_cast< double >(m_count);
+	}
+
+	double
+	Histogram::percentile (double percent) const noexcept
+	{
+		if ( m_count == 0 )
+		{
+			return 0.0;
+		}
+
+		std::vector< double > sorted{m_samples.cbegin(), m_samples.cbegin() + static_cast< std::ptrdiff_t >(m_count)};
+
+		const auto rank = static_cast< size_t >(std::ceil(std::clamp(percent, 0.0, 100.0) / 100.0 * static_cast< double >(m_count)));
+		const auto index = rank > 0 ? rank - 1 : 0;
+
+		std::ranges::nth_element(sorted, sorted.begin() + static_cast< std::ptrdiff_t >(index));
+
+		return sorted[index];
+	}
+}
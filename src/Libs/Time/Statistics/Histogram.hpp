@@ -0,0 +1,138 @@
+/*
+ * src/Libs/Time/Statistics/Histogram.hpp
+ * This file is part of Emeraude-Engine
+ *
+ * Copyright (C) 2010-2025 - Sébastien Léon Claude Christian Bémelmans "LondNoir" <londnoir@gmail.com>
+ *
+ * Emeraude-Engine is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * Emeraude-Engine is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with Emeraude-Engine; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * Complete project and additional information can be found at :
+ * https://github.com/londnoir/emeraude-engine
+ *
+ * --- THIS IS AUTOMATICALLY GENERATED, DO NOT CHANGE ---
+ */
+
+#pragma once
+
+/* STL inclusions. */
+#include <cstddef>
+#include <vector>
+
+namespace EmEn::Libs::Time::Statistics
+{
+	/**
+	 * @brief Keeps the last values of a measurement to get its distribution (minimum, average, percentiles, maximum).
+	 * @note Unlike the Abstract statistics, this does not take the time itself and keeps the sample precision.
+	 */
+	class Histogram final
+	{
+		public:
+
+			/**
+			 * @brief Constructs a histogram.
+			 * @param range The number of last samples kept.
+			 */
+			explicit Histogram (size_t range = 1) noexcept;
+
+			/**
+			 * @brief Adds a sample, replacing the oldest one if the range is reached.
+			 * @param value The sample value.
+			 * @return void
+			 */
+			void insert (double value) noexcept;
+
+			/**
+			 * @brief Removes every sample.
+			 * @return void
+			 */
+			void reset () noexcept;
+
+			/**
+			 * @brief Returns the range of samples.
+			 * @return size_t
+			 */
+			[[nodiscard]]
+			size_t
+			range () const noexcept
+			{
+				return m_samples.size();
+			}
+
+			/**
+			 * @brief Returns the number of samples currently kept.
+			 * @return size_t
+			 */
+			[[nodiscard]]
+			size_t
+			count () const noexcept
+			{
+				return m_count;
+			}
+
+			/**
+			 * @brief Returns the number of samples inserted since the last reset.
+			 * @return size_t
+			 */
+			[[nodiscard]]
+			size_t
+			topCount () const noexcept
+			{
+				return m_topCount;
+			}
+
+			/**
+			 * @brief Returns the last sample inserted.
+			 * @return double
+			 */
+			[[nodiscard]]
+			double last () const noexcept;
+
+			/**
+			 * @brief Returns the minimum value of kept samples.
+			 * @return double
+			 */
+			[[nodiscard]]
+			double minimum () const noexcept;
+
+			/**
+			 * @brief Returns the maximum value of kept samples.
+			 * @return double
+			 */
+			[[nodiscard]]
+			double maximum () const noexcept;
+
+			/**
+			 * @brief Returns the average value of kept samples.
+			 * @return double
+			 */
+			[[nodiscard]]
+			double average () const noexcept;
+
+			/**
+			 * @brief Returns the value below which a percentage of kept samples fall (nearest-rank method).
+			 * @param percent The percentage between 0 and 100.
+			 * @return double
+			 */
+			[[nodiscard]]
+			double percentile (double percent) const noexcept;
+
+		private:
+
+			std::vector< double > m_samples;
+			size_t m_index{0};
+			size_t m_count{0};
+			size_t m_topCount{0};
+	};
+}
@@ -48,6 +48,11 @@ namespace EmEn::Libs::VertexFactory
 		bool requestTangentSpace = false;
 		bool requestTextureCoordinates = false;
 		bool requestVertexColor = false;
+		/** @brief Reorders triangles and vertices for the post-transform vertex cache and the vertex fetch. */
+		bool optimizeVertexCache = false;
+		/** @brief Reorders clusters of triangles to reduce the overdraw. Implies the vertex cache optimization. */
+		bool optimizeOverdraw = false;
+		uint32_t vertexCacheSize = DefaultVertexCacheSize;
 	};
 
 	/**
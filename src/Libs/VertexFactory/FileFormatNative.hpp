@@ -26,13 +26,60 @@
 
 #pragma once
 
+/* STL inclusions. */
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <span>
+#include <utility>
+#include <vector>
+
 /* Local inclusions for inheritances. */
 #include "FileFormatInterface.hpp"
 
+/* Local inclusions for usages. */
+#include "Libs/IO/IO.hpp"
+#include "Libs/IO/MappedFile.hpp"
+#include "Libs/Math/Space3D/AACuboid.hpp"
+#include "Libs/Math/Space3D/Sphere.hpp"
+#include "Libs/Math/Vector.hpp"
+#include "ShapeTriangle.hpp"
+#include "ShapeVertex.hpp"
+#include "Shape.hpp"
+#include "Types.hpp"
+
 namespace EmEn::Libs::VertexFactory
 {
+	/**
+	 * @brief The vertex attributes interleaved in the vertex streams of a native geometry file.
+	 * @note The order of the attributes is the one of Shape::createIndexedVertexBuffer(), so a stream is usable as-is by a vertex buffer.
+	 */
+	struct NativeVertexLayout
+	{
+		NormalType normalType{NormalType::TBNSpace};
+		TextureCoordinatesType textureCoordinatesType{TextureCoordinatesType::UV};
+		VertexColorType vertexColorType{VertexColorType::None};
+		SkeletalAnimationType skeletalAnimationType{SkeletalAnimationType::None};
+
+		/**
+		 * @brief Returns whether two layouts are the same.
+		 * @param operand A reference to another layout.
+		 * @return bool
+		 */
+		[[nodiscard]]
+		bool operator== (const NativeVertexLayout & operand) const noexcept = default;
+	};
+
 	/**
 	 * @brief Emeraude engine native geometry format.
+	 * @note The file is a little container made to be mapped in memory and used without parsing :
+	 *  - A header with the vertex layout, the data precisions and the bounds of the first level.
+	 *  - A table describing every level. The level 0 is the geometry, the next ones are optional levels of detail.
+	 *  - For each level, an interleaved vertex stream, an index stream and the sub-geometry ranges, each aligned on 16 bytes.
+	 * The data are stored in the engine space, the read options are not applied when reading.
 	 * @tparam vertex_data_t The precision type of vertex data. Default float.
 	 * @tparam index_data_t The precision type of index data. Default uint32_t.
 	 * @extends EmEn::Libs::VertexFactory::FileFormatInterface
@@ -43,6 +90,13 @@ namespace EmEn::Libs::VertexFactory
 	{
 		public:
 
+			/** @brief The file signature. */
+			static constexpr std::array< char, 8 > Magic{'E', 'M', 'G', 'E', 'O', '\0', '\r', '\n'};
+			/** @brief The current format version. */
+			static constexpr uint32_t Version{1};
+			/** @brief The alignment of every stream in the file. */
+			static constexpr size_t StreamAlignment{16};
+
 			/**
 			 * @brief Constructs a native file format.
 			 */
@@ -55,9 +109,16 @@ namespace EmEn::Libs::VertexFactory
 			{
 				geometry.clear();
 
-				std::cerr << __PRETTY_FUNCTION__ << ", not yet implemented ! Cancelling the read of " << filepath << " file !" "\n";
+				if ( !this->open(filepath) )
+				{
+					return false;
+				}
+
+				const auto success = this->extractLevel(0, geometry);
+
+				this->close();
 
-				return false;
+				return success;
 			}
 
 			/** @copydoc EmEn::Libs::VertexFactory::FileFormatInterface::writeFile() */
@@ -65,16 +126,823 @@ namespace EmEn::Libs::VertexFactory
 			bool
 			writeFile (const std::filesystem::path & filepath, const Shape< vertex_data_t, index_data_t > & geometry) const noexcept override
 			{
-				if ( !geometry.isValid() )
+				return this->writeLevels(filepath, geometry, {}, {}, FileFormatNative::defaultLayout(geometry));
+			}
+
+			/**
+			 * @brief Writes a geometry and its levels of detail to a file.
+			 * @param filepath A reference to a filesystem path.
+			 * @param geometry A reference to the geometry, the level 0.
+			 * @param levelsOfDetail A reference to the simplified levels, from the most detailed one.
+			 * @param screenSizes A reference to the screen size of each level of detail. The missing ones are written as 0.
+			 * @param layout A reference to the vertex layout of the streams.
+			 * @return bool
+			 */
+			[[nodiscard]]
+			bool
+			writeLevels (const std::filesystem::path & filepath, const Shape< vertex_data_t, index_data_t > & geometry, const std::vector< Shape< vertex_data_t, index_data_t > > & levelsOfDetail, const std::vector< float > & screenSizes, const NativeVertexLayout & layout) const noexcept
+			{
+				std::vector< const Shape< vertex_data_t, index_data_t > * > shapes;
+				shapes.reserve(1 + levelsOfDetail.size());
+				shapes.emplace_back(&geometry);
+
+				for ( const auto & levelOfDetail : levelsOfDetail )
+				{
+					shapes.emplace_back(&levelOfDetail);
+				}
+
+				const auto vertexElementCount = FileFormatNative::getVertexElementCount(layout);
+
+				/* 1. Build the streams of every level and place them in the file. */
+				std::vector< LevelHeader > levelHeaders(shapes.size());
+				std::vector< std::vector< vertex_data_t > > vertexStreams(shapes.size());
+				std::vector< std::vector< index_data_t > > indexStreams(shapes.size());
+				std::vector< std::vector< index_data_t > > groupStreams(shapes.size());
+
+				uint64_t offset = FileFormatNative::align(sizeof(FileHeader) + sizeof(LevelHeader) * shapes.size());
+
+				for ( size_t level = 0; level < shapes.size(); ++level )
+				{
+					const auto & shape = *shapes[level];
+
+					if ( !shape.isValid() )
+					{
+						std::cerr << __PRETTY_FUNCTION__ << ", the geometry level #" << level << " is invalid ! File " << filepath << " is not created." "\n";
+
+						return false;
+					}
+
+					if ( layout.vertexColorType != VertexColorType::None && !shape.isVertexColorAvailable() )
+					{
+						std::cerr << __PRETTY_FUNCTION__ << ", the geometry level #" << level << " has no vertex color for the requested layout ! File " << filepath << " is not created." "\n";
+
+						return false;
+					}
+
+					if ( shape.createIndexedVertexBuffer(vertexStreams[level], indexStreams[level], layout.normalType, layout.textureCoordinatesType, layout.vertexColorType, layout.skeletalAnimationType) != vertexElementCount )
+					{
+						std::cerr << __PRETTY_FUNCTION__ << ", unable to build the vertex stream of level #" << level << " ! File " << filepath << " is not created." "\n";
+
+						return false;
+					}
+
+					for ( const auto & [groupOffset, groupLength] : shape.groups() )
+					{
+						groupStreams[level].emplace_back(groupOffset);
+						groupStreams[level].emplace_back(groupLength);
+					}
+
+					auto & levelHeader = levelHeaders[level];
+					levelHeader.vertexCount = static_cast< uint32_t >(shape.vertexCount());
+					levelHeader.indexCount = static_cast< uint32_t >(indexStreams[level].size());
+					levelHeader.groupCount = static_cast< uint32_t >(shape.groups().size());
+					levelHeader.screenSize = level > 0 && level - 1 < screenSizes.size() ? screenSizes[level - 1] : 0.0F;
+
+					levelHeader.vertexOffset = offset;
+					offset = FileFormatNative::align(offset + vertexStreams[level].size() * sizeof(vertex_data_t));
+
+					levelHeader.indexOffset = offset;
+					offset = FileFormatNative::align(offset + indexStreams[level].size() * sizeof(index_data_t));
+
+					levelHeader.groupOffset = offset;
+					offset = FileFormatNative::align(offset + groupStreams[level].size() * sizeof(index_data_t));
+				}
+
+				/* 2. Fill the header with the first level properties. */
+				FileHeader header{};
+				header.magic = Magic;
+				header.version = Version;
+				header.byteOrderMark = IO::ByteOrderMark;
+				header.vertexDataSize = sizeof(vertex_data_t);
+				header.indexDataSize = sizeof(index_data_t);
+				header.normalType = static_cast< uint8_t >(layout.normalType);
+				header.textureCoordinatesType = static_cast< uint8_t >(layout.textureCoordinatesType);
+				header.vertexColorType = static_cast< uint8_t >(layout.vertexColorType);
+				header.skeletalAnimationType = static_cast< uint8_t >(layout.skeletalAnimationType);
+				header.vertexElementCount = vertexElementCount;
+				header.levelCount = static_cast< uint32_t >(shapes.size());
+
+				for ( size_t axis = 0; axis < 3; ++axis )
+				{
+					header.boundingBoxMaximum[axis] = static_cast< float >(geometry.boundingBox().maximum()[axis]);
+					header.boundingBoxMinimum[axis] = static_cast< float >(geometry.boundingBox().minimum()[axis]);
+					header.boundingSphere[axis] = static_cast< float >(geometry.boundingSphere().position()[axis]);
+				}
+
+				header.boundingSphere[3] = static_cast< float >(geometry.boundingSphere().radius());
+				header.farthestDistance = static_cast< float >(geometry.farthestDistance());
+
+				/* 3. Write everything. */
+				return IO::writeFileAtomically(filepath, [&] (std::ofstream & file) {
+					file.write(reinterpret_cast< const char * >(&header), sizeof(FileHeader));
+					file.write(reinterpret_cast< const char * >(levelHeaders.data()), static_cast< std::streamsize >(sizeof(LevelHeader) * levelHeaders.size()));
+
+					for ( size_t level = 0; level < shapes.size(); ++level )
+					{
+						FileFormatNative::writeStream(file, levelHeaders[level].vertexOffset, vertexStreams[level]);
+						FileFormatNative::writeStream(file, levelHeaders[level].indexOffset, indexStreams[level]);
+						FileFormatNative::writeStream(file, levelHeaders[level].groupOffset, groupStreams[level]);
+					}
+
+					/* NOTE: Pads the end so the last stream can be read by block of the alignment size. */
+					FileFormatNative::pad(file, offset);
+
+					return true;
+				});
+			}
+
+			/**
+			 * @brief Maps a native geometry file in memory and checks its structure.
+			 * @note The streams stay available until FileFormatNative::close() or the destruction of the object.
+			 * @param filepath A reference to a filesystem path.
+			 * @return bool
+			 */
+			[[nodiscard]]
+			bool
+			open (const std::filesystem::path & filepath) noexcept
+			{
+				this->close();
+
+				if ( !m_file.open(filepath) )
 				{
-					std::cerr << __PRETTY_FUNCTION__ << ", geometry parameter is invalid !" "\n";
+					std::cerr << __PRETTY_FUNCTION__ << ", unable to map " << filepath << " !" "\n";
 
 					return false;
 				}
 
-				std::cerr << __PRETTY_FUNCTION__ << ", not yet implemented ! File " << filepath << " is not created." "\n";
+				if ( !this->checkStructure() )
+				{
+					std::cerr << __PRETTY_FUNCTION__ << ", the file " << filepath << " is not a valid native geometry file !" "\n";
+
+					this->close();
+
+					return false;
+				}
+
+				return true;
+			}
+
+			/**
+			 * @brief Releases the mapped file.
+			 * @return void
+			 */
+			void
+			close () noexcept
+			{
+				m_file.close();
+
+				m_header = nullptr;
+				m_levelHeaders = {};
+			}
+
+			/**
+			 * @brief Returns whether a file is mapped.
+			 * @return bool
+			 */
+			[[nodiscard]]
+			bool
+			isOpen () const noexcept
+			{
+				return m_header != nullptr;
+			}
+
+			/**
+			 * @brief Returns the vertex layout of the mapped file.
+			 * @return NativeVertexLayout
+			 */
+			[[nodiscard]]
+			NativeVertexLayout
+			layout () const noexcept
+			{
+				return {
+					static_cast< NormalType >(m_header->normalType),
+					static_cast< TextureCoordinatesType >(m_header->textureCoordinatesType),
+					static_cast< VertexColorType >(m_header->vertexColorType),
+					static_cast< SkeletalAnimationType >(m_header->skeletalAnimationType)
+				};
+			}
+
+			/**
+			 * @brief Returns the number of elements composing a vertex in the streams.
+			 * @return uint32_t
+			 */
+			[[nodiscard]]
+			uint32_t
+			vertexElementCount () const noexcept
+			{
+				return m_header->vertexElementCount;
+			}
+
+			/**
+			 * @brief Returns the number of levels in the mapped file, the geometry included.
+			 * @return uint32_t
+			 */
+			[[nodiscard]]
+			uint32_t
+			levelCount () const noexcept
+			{
+				return static_cast< uint32_t >(m_levelHeaders.size());
+			}
+
+			/**
+			 * @brief Returns the number of vertices of a level.
+			 * @param level The level index.
+			 * @return uint32_t
+			 */
+			[[nodiscard]]
+			uint32_t
+			vertexCount (uint32_t level) const noexcept
+			{
+				return m_levelHeaders[level].vertexCount;
+			}
+
+			/**
+			 * @brief Returns the interleaved vertex stream of a level, directly from the mapped file.
+			 * @param level The level index.
+			 * @return std::span< const vertex_data_t >
+			 */
+			[[nodiscard]]
+			std::span< const vertex_data_t >
+			vertexStream (uint32_t level) const noexcept
+			{
+				const auto & levelHeader = m_levelHeaders[level];
+
+				return {reinterpret_cast< const vertex_data_t * >(m_file.data() + levelHeader.vertexOffset), static_cast< size_t >(levelHeader.vertexCount) * m_header->vertexElementCount};
+			}
+
+			/**
+			 * @brief Returns the index stream of a level, directly from the mapped file.
+			 * @param level The level index.
+			 * @return std::span< const index_data_t >
+			 */
+			[[nodiscard]]
+			std::span< const index_data_t >
+			indexStream (uint32_t level) const noexcept
+			{
+				const auto & levelHeader = m_levelHeaders[level];
+
+				return {reinterpret_cast< const index_data_t * >(m_file.data() + levelHeader.indexOffset), levelHeader.indexCount};
+			}
+
+			/**
+			 * @brief Returns the sub-geometry ranges of a level, as pairs of triangle offset and triangle count.
+			 * @param level The level index.
+			 * @return std::span< const index_data_t >
+			 */
+			[[nodiscard]]
+			std::span< const index_data_t >
+			groupStream (uint32_t level) const noexcept
+			{
+				const auto & levelHeader = m_levelHeaders[level];
+
+				return {reinterpret_cast< const index_data_t * >(m_file.data() + levelHeader.groupOffset), static_cast< size_t >(levelHeader.groupCount) * 2};
+			}
+
+			/**
+			 * @brief Returns the screen size under which a level of detail is used. The level 0 returns 0.
+			 * @param level The level index.
+			 * @return float
+			 */
+			[[nodiscard]]
+			float
+			screenSize (uint32_t level) const noexcept
+			{
+				return m_levelHeaders[level].screenSize;
+			}
 
-				return false;
+			/**
+			 * @brief Returns the bounding box of the geometry without reading it.
+			 * @return Math::Space3D::AACuboid< float >
+			 */
+			[[nodiscard]]
+			Math::Space3D::AACuboid< float >
+			boundingBox () const noexcept
+			{
+				return {
+					{m_header->boundingBoxMaximum[0], m_header->boundingBoxMaximum[1], m_header->boundingBoxMaximum[2]},
+					{m_header->boundingBoxMinimum[0], m_header->boundingBoxMinimum[1], m_header->boundingBoxMinimum[2]}
+				};
 			}
+
+			/**
+			 * @brief Returns the bounding sphere of the geometry without reading it.
+			 * @return Math::Space3D::Sphere< float >
+			 */
+			[[nodiscard]]
+			Math::Space3D::Sphere< float >
+			boundingSphere () const noexcept
+			{
+				return {m_header->boundingSphere[3], {m_header->boundingSphere[0], m_header->boundingSphere[1], m_header->boundingSphere[2]}};
+			}
+
+			/**
+			 * @brief Rebuilds a shape from a level of the mapped file.
+			 * @param level The level index.
+			 * @param geometry A reference to the shape to build.
+			 * @return bool
+			 */
+			[[nodiscard]]
+			bool
+			extractLevel (uint32_t level, Shape< vertex_data_t, index_data_t > & geometry) const noexcept
+			{
+				if ( !this->isOpen() || level >= this->levelCount() )
+				{
+					std::cerr << __PRETTY_FUNCTION__ << ", the level #" << level << " is not available !" "\n";
+
+					return false;
+				}
+
+				const auto layout = this->layout();
+				const auto vertices = this->vertexStream(level);
+				const auto indices = this->indexStream(level);
+				const auto groups = this->groupStream(level);
+				const auto vertexElementCount = m_header->vertexElementCount;
+				const bool hasVertexColor = layout.vertexColorType != VertexColorType::None;
+
+				const auto built = geometry.buildWithVertexColors([&] (std::vector< std::pair< index_data_t, index_data_t > > & shapeGroups, std::vector< ShapeVertex< vertex_data_t > > & shapeVertices, std::vector< Math::Vector< 4, vertex_data_t > > & shapeVertexColors, std::vector< ShapeTriangle< vertex_data_t, index_data_t > > & shapeTriangles) {
+					shapeVertices.resize(vertices.size() / vertexElementCount);
+
+					if ( hasVertexColor )
+					{
+						shapeVertexColors.resize(shapeVertices.size());
+					}
+
+					for ( size_t vertexIndex = 0; vertexIndex < shapeVertices.size(); ++vertexIndex )
+					{
+						FileFormatNative::decodeVertex(layout, vertices.data() + vertexIndex * vertexElementCount, shapeVertices[vertexIndex], hasVertexColor ? &shapeVertexColors[vertexIndex] : nullptr);
+					}
+
+					shapeTriangles.reserve(indices.size() / 3);
+
+					for ( size_t index = 0; index < indices.size(); index += 3 )
+					{
+						auto & triangle = shapeTriangles.emplace_back(indices[index], indices[index + 1], indices[index + 2]);
+
+						if ( hasVertexColor )
+						{
+							for ( index_data_t triangleVertexIndex = 0; triangleVertexIndex < 3; ++triangleVertexIndex )
+							{
+								triangle.setVertexColorIndex(triangleVertexIndex, indices[index + triangleVertexIndex]);
+							}
+						}
+					}
+
+					shapeGroups.clear();
+
+					for ( size_t groupIndex = 0; groupIndex < groups.size(); groupIndex += 2 )
+					{
+						shapeGroups.emplace_back(groups[groupIndex], groups[groupIndex + 1]);
+					}
+
+					return true;
+				}, layout.textureCoordinatesType != TextureCoordinatesType::None);
+
+				if ( !built )
+				{
+					return false;
+				}
+
+				if ( layout.normalType != NormalType::None )
+				{
+					geometry.computeTriangleNormal();
+				}
+
+				return true;
+			}
+
+			/**
+			 * @brief Returns the layout to use for a shape by default.
+			 * @note This is the layout of an indexed geometry resource with the tangent space, the primary texture coordinates and the vertex color when available.
+			 * @param geometry A reference to the shape.
+			 * @return NativeVertexLayout
+			 */
+			[[nodiscard]]
+			static
+			NativeVertexLayout
+			defaultLayout (const Shape< vertex_data_t, index_data_t > & geometry) noexcept
+			{
+				NativeVertexLayout layout{};
+
+				if ( geometry.isVertexColorAvailable() )
+				{
+					layout.vertexColorType = VertexColorType::RGBA;
+				}
+
+				return layout;
+			}
+
+			/**
+			 * @brief Returns the number of elements composing a vertex for a layout.
+			 * @param layout A reference to a layout.
+			 * @return uint32_t
+			 */
+			[[nodiscard]]
+			static
+			uint32_t
+			getVertexElementCount (const NativeVertexLayout & layout) noexcept
+			{
+				uint32_t count = 3;
+
+				switch ( layout.normalType )
+				{
+					case NormalType::Normal :
+						count += 3;
+						break;
+
+					case NormalType::TangentNormal :
+						count += 6;
+						break;
+
+					case NormalType::TBNSpace :
+						count += 9;
+						break;
+
+					default:
+						break;
+				}
+
+				switch ( layout.textureCoordinatesType )
+				{
+					case TextureCoordinatesType::UV :
+						count += 2;
+						break;
+
+					case TextureCoordinatesType::UVW :
+						count += 3;
+						break;
+
+					default:
+						break;
+				}
+
+				switch ( layout.vertexColorType )
+				{
+					case VertexColorType::Gray :
+						count += 1;
+						break;
+
+					case VertexColorType::RGB :
+						count += 3;
+						break;
+
+					case VertexColorType::RGBA :
+						count += 4;
+						break;
+
+					default:
+						break;
+				}
+
+				switch ( layout.skeletalAnimationType )
+				{
+					case SkeletalAnimationType::Average3 :
+						count += 3;
+						break;
+
+					case SkeletalAnimationType::Average4 :
+						count += 4;
+						break;
+
+					case SkeletalAnimationType::Weighted3 :
+						count += 6;
+						break;
+
+					case SkeletalAnimationType::Weighted4 :
+						count += 8;
+						break;
+
+					default:
+						break;
+				}
+
+				return count;
+			}
+
+		private:
+
+			/** @brief The file header. */
+			struct FileHeader
+			{
+				std::array< char, 8 > magic{};
+				uint32_t version{0};
+				uint32_t byteOrderMark{0};
+				uint8_t vertexDataSize{0};
+				uint8_t indexDataSize{0};
+				uint8_t normalType{0};
+				uint8_t textureCoordinatesType{0};
+				uint8_t vertexColorType{0};
+				uint8_t skeletalAnimationType{0};
+				std::array< uint8_t, 2 > reserved{};
+				uint32_t vertexElementCount{0};
+				uint32_t levelCount{0};
+				std::array< float, 3 > boundingBoxMaximum{};
+				std::array< float, 3 > boundingBoxMinimum{};
+				/* NOTE: Center then radius. */
+				std::array< float, 4 > boundingSphere{};
+				float farthestDistance{0.0F};
+				uint32_t reservedTail{0};
+			};
+
+			/** @brief The description of one level in the file. */
+			struct LevelHeader
+			{
+				uint32_t vertexCount{0};
+				uint32_t indexCount{0};
+				uint32_t groupCount{0};
+				float screenSize{0.0F};
+				uint64_t vertexOffset{0};
+				uint64_t indexOffset{0};
+				uint64_t groupOffset{0};
+				uint64_t reserved{0};
+			};
+
+			static_assert(sizeof(FileHeader) == 80 && sizeof(LevelHeader) == 48, "The native geometry headers must not have padding !");
+
+			/**
+			 * @brief Rounds an offset up to the stream alignment.
+			 * @param offset The offset in bytes.
+			 * @return uint64_t
+			 */
+			[[nodiscard]]
+			static
+			uint64_t
+			align (uint64_t offset) noexcept
+			{
+				return (offset + StreamAlignment - 1) & ~static_cast< uint64_t >(StreamAlignment - 1);
+			}
+
+			/**
+			 * @brief Writes zeros up to an offset.
+			 * @param file A reference to the file stream.
+			 * @param offset The offset to reach.
+			 * @return void
+			 */
+			static
+			void
+			pad (std::ofstream & file, uint64_t offset) noexcept
+			{
+				static constexpr std::array< char, StreamAlignment > Zeros{};
+
+				const auto position = static_cast< uint64_t >(file.tellp());
+
+				if ( position < offset )
+				{
+					file.write(Zeros.data(), static_cast< std::streamsize >(offset - position));
+				}
+			}
+
+			/**
+			 * @brief Writes a stream at its offset.
+			 * @tparam data_t The type of data.
+			 * @param file A reference to the file stream.
+			 * @param offset The offset of the stream.
+			 * @param stream A reference to the data.
+			 * @return void
+			 */
+			template< typename data_t >
+			static
+			void
+			writeStream (std::ofstream & file, uint64_t offset, const std::vector< data_t > & stream) noexcept
+			{
+				FileFormatNative::pad(file, offset);
+
+				file.write(reinterpret_cast< const char * >(stream.data()), static_cast< std::streamsize >(stream.size() * sizeof(data_t)));
+			}
+
+			/**
+			 * @brief Checks the header, the level table and the bounds of every stream of the mapped file.
+			 * @return bool
+			 */
+			[[nodiscard]]
+			bool
+			checkStructure () noexcept
+			{
+				const auto fileSize = static_cast< uint64_t >(m_file.size());
+
+				if ( fileSize < sizeof(FileHeader) )
+				{
+					return false;
+				}
+
+				const auto * header = reinterpret_cast< const FileHeader * >(m_file.data());
+
+				if ( header->magic != Magic || !IO::isNativeByteOrder(header->byteOrderMark) )
+				{
+					return false;
+				}
+
+				if ( header->version != Version )
+				{
+					std::cerr << __PRETTY_FUNCTION__ << ", the version " << header->version << " is not handled !" "\n";
+
+					return false;
+				}
+
+				if ( header->vertexDataSize != sizeof(vertex_data_t) || header->indexDataSize != sizeof(index_data_t) )
+				{
+					std::cerr << __PRETTY_FUNCTION__ << ", the data precision does not match the reader (vertex:" << static_cast< int >(header->vertexDataSize) << ", index:" << static_cast< int >(header->indexDataSize) << ") !" "\n";
+
+					return false;
+				}
+
+				if ( header->normalType > static_cast< uint8_t >(NormalType::TBNSpace) ||
+					header->textureCoordinatesType > static_cast< uint8_t >(TextureCoordinatesType::UVW) ||
+					header->vertexColorType > static_cast< uint8_t >(VertexColorType::RGBA) ||
+					header->skeletalAnimationType > static_cast< uint8_t >(SkeletalAnimationType::Weighted4) )
+				{
+					return false;
+				}
+
+				m_header = header;
+
+				if ( header->vertexElementCount != FileFormatNative::getVertexElementCount(this->layout()) || header->levelCount == 0 )
+				{
+					return false;
+				}
+
+				if ( fileSize < sizeof(FileHeader) + static_cast< uint64_t >(sizeof(LevelHeader)) * header->levelCount )
+				{
+					return false;
+				}
+
+				m_levelHeaders = {reinterpret_cast< const LevelHeader * >(m_file.data() + sizeof(FileHeader)), header->levelCount};
+
+				const auto fits = [fileSize] (uint64_t offset, uint64_t bytes) {
+					return offset % StreamAlignment == 0 && offset <= fileSize && bytes <= fileSize - offset;
+				};
+
+				for ( const auto & levelHeader : m_levelHeaders )
+				{
+					if ( levelHeader.vertexCount == 0 || levelHeader.indexCount == 0 || levelHeader.indexCount % 3 != 0 || levelHeader.groupCount == 0 )
+					{
+						return false;
+					}
+
+					if ( !fits(levelHeader.vertexOffset, static_cast< uint64_t >(levelHeader.vertexCount) * header->vertexElementCount * sizeof(vertex_data_t)) ||
+						!fits(levelHeader.indexOffset, static_cast< uint64_t >(levelHeader.indexCount) * sizeof(index_data_t)) ||
+						!fits(levelHeader.groupOffset, static_cast< uint64_t >(levelHeader.groupCount) * 2 * sizeof(index_data_t)) )
+					{
+						return false;
+					}
+				}
+
+				/* NOTE: The indices and the ranges are checked once here, so the streams can be sent to a GPU without more verification. */
+				for ( uint32_t level = 0; level < this->levelCount(); ++level )
+				{
+					const auto vertexCount = m_levelHeaders[level].vertexCount;
+					const auto triangleCount = static_cast< uint64_t >(m_levelHeaders[level].indexCount / 3);
+
+					for ( const auto index : this->indexStream(level) )
+					{
+						if ( index >= vertexCount )
+						{
+							return false;
+						}
+					}
+
+					const auto groups = this->groupStream(level);
+
+					for ( size_t groupIndex = 0; groupIndex < groups.size(); groupIndex += 2 )
+					{
+						if ( static_cast< uint64_t >(groups[groupIndex]) + groups[groupIndex + 1] > triangleCount )
+						{
+							return false;
+						}
+					}
+				}
+
+				return true;
+			}
+
+			/**
+			 * @brief Reads the attributes of a vertex from a stream.
+			 * @param layout A reference to the layout of the stream.
+			 * @param data A pointer to the first element of the vertex in the stream.
+			 * @param vertex A reference to the vertex to fill.
+			 * @param vertexColor A pointer to the vertex color to fill. Can be null if the layout has no vertex color.
+			 * @return void
+			 */
+			static
+			void
+			decodeVertex (const NativeVertexLayout & layout, const vertex_data_t * data, ShapeVertex< vertex_data_t > & vertex, Math::Vector< 4, vertex_data_t > * vertexColor) noexcept
+			{
+				const auto readVector3 = [&data] () {
+					const Math::Vector< 3, vertex_data_t > vector{data[0], data[1], data[2]};
+
+					data += 3;
+
+					return vector;
+				};
+
+				vertex.setPosition(readVector3());
+
+				switch ( layout.normalType )
+				{
+					case NormalType::Normal :
+						vertex.setNormal(readVector3());
+						break;
+
+					case NormalType::TangentNormal :
+						vertex.setTangent(readVector3());
+						vertex.setNormal(readVector3());
+						break;
+
+					case NormalType::TBNSpace :
+						vertex.setTangent(readVector3());
+						/* NOTE: The binormal is deduced from the normal and the tangent. */
+						data += 3;
+						vertex.setNormal(readVector3());
+						break;
+
+					default:
+						break;
+				}
+
+				switch ( layout.textureCoordinatesType )
+				{
+					case TextureCoordinatesType::UV :
+						vertex.setTextureCoordinates(Math::Vector< 2, vertex_data_t >{data[0], data[1]});
+						data += 2;
+						break;
+
+					case TextureCoordinatesType::UVW :
+						vertex.setTextureCoordinates(readVector3());
+						break;
+
+					default:
+						break;
+				}
+
+				switch ( layout.vertexColorType )
+				{
+					case VertexColorType::Gray :
+						*vertexColor = {data[0], data[0], data[0], 1};
+						data += 1;
+						break;
+
+					case VertexColorType::RGB :
+						*vertexColor = {data[0], data[1], data[2], 1};
+						data += 3;
+						break;
+
+					case VertexColorType::RGBA :
+						*vertexColor = {data[0], data[1], data[2], data[3]};
+						data += 4;
+						break;
+
+					default:
+						break;
+				}
+
+				const auto readInfluences = [&data] (size_t count) {
+					std::array< int32_t, 4 > influences{-1, -1, -1, -1};
+
+					for ( size_t index = 0; index < count; ++index )
+					{
+						influences[index] = static_cast< int32_t >(data[index]);
+					}
+
+					data += count;
+
+					return influences;
+				};
+
+				switch ( layout.skeletalAnimationType )
+				{
+					case SkeletalAnimationType::Average3 :
+					case SkeletalAnimationType::Average4 :
+					{
+						const auto influences = readInfluences(layout.skeletalAnimationType == SkeletalAnimationType::Average3 ? 3 : 4);
+
+						vertex.setInfluences(influences[0], influences[1], influences[2], influences[3]);
+					}
+						break;
+
+					case SkeletalAnimationType::Weighted3 :
+					{
+						const auto influences = readInfluences(3);
+
+						vertex.setInfluences(influences[0], influences[1], influences[2]);
+						vertex.setWeights(data[0], data[1], data[2]);
+					}
+						break;
+
+					case SkeletalAnimationType::Weighted4 :
+					{
+						const auto influences = readInfluences(4);
+
+						vertex.setInfluences(influences[0], influences[1], influences[2], influences[3]);
+						vertex.setWeights(data[0], data[1], data[2], data[3]);
+					}
+						break;
+
+					default:
+						break;
+				}
+			}
+
+			IO::MappedFile m_file;
+			const FileHeader * m_header{nullptr};
+			std::span< const LevelHeader > m_levelHeaders;
 	};
 }
@@ -31,12 +31,15 @@
 
 /* STL inclusions. */
 #include <algorithm>
-#include <array>
+#include <charconv>
 #include <cstddef>
 #include <cstdint>
+#include <cstring>
 #include <fstream>
 #include <iostream>
+#include <limits>
 #include <string>
+#include <string_view>
 #include <utility>
 #include <vector>
 
@@ -44,7 +47,9 @@
 #include "FileFormatInterface.hpp"
 
 /* Local inclusions for usages. */
+#include "Libs/IO/MappedFile.hpp"
 #include "Libs/Math/Vector.hpp"
+#include "Libs/ThreadPool.hpp"
 #include "ShapeTriangle.hpp"
 #include "ShapeVertex.hpp"
 #include "Shape.hpp"
@@ -52,56 +57,22 @@
 namespace EmEn::Libs::VertexFactory
 {
 	/**
-	 * @brief An OBJ vertex structure.
-	 * @tparam index_data_t The precision type of index data.
-	 * @note OBJ format use index starting at 1.
+	 * @brief An OBJ face corner, with the zero-based indices of its attributes in the whole file.
+	 * @note A missing attribute is set to -1.
 	 */
-	template< typename index_data_t >
-	requires (std::is_unsigned_v< index_data_t > )
-	class OBJVertex final
+	struct OBJCorner
 	{
-		public:
-
-			explicit
-			OBJVertex (index_data_t vIndex) noexcept
-				: vIndex(vIndex)
-			{
-
-			}
-
-			OBJVertex (index_data_t vIndex, index_data_t vtIndex) noexcept
-				: vIndex(vIndex),
-				vtIndex(vtIndex)
-			{
-
-			}
-
-			OBJVertex (index_data_t vIndex, index_data_t vtIndex, index_data_t vnIndex) noexcept
-				: vIndex(vIndex),
-				vtIndex(vtIndex),
-				vnIndex(vnIndex)
-			{
-
-			}
-				
-			index_data_t vIndex{0};
-			index_data_t vtIndex{0};
-			index_data_t vnIndex{0};
+		int64_t vIndex{-1};
+		int64_t vtIndex{-1};
+		int64_t vnIndex{-1};
 	};
 
-	/**
-	 * @brief An OBJ triangle structure.
-	 * @tparam index_data_t The precision type of index data.
-	 */
-	template< typename index_data_t >
-	requires (std::is_unsigned_v< index_data_t > )
-	using OBJTriangle = std::array< OBJVertex< index_data_t >, 3 >;
-
 	/**
 	 * @brief The FileFormatOBJ class.
 	 * @tparam vertex_data_t The precision type of vertex data. Default float.
 	 * @tparam index_data_t The precision type of index data. Default uint32_t.
 	 * @note http://www.fileformat.info/format/wavefrontobj/egff.htm
+	 * The file is memory-mapped and split into line-aligned chunks parsed in parallel.
 	 * @extends EmEn::Libs::VertexFactory::FileFormatInterface
 	 */
 	template< typename vertex_data_t = float, typename index_data_t = uint32_t >
@@ -110,6 +81,9 @@ namespace EmEn::Libs::VertexFactory
 	{
 		public:
 
+			/** @brief The minimum amount of bytes given to a parsing thread. */
+			static constexpr size_t MinimumChunkSize{1024UL * 1024UL};
+
 			/**
 			 * @brief Constructs an OBJ file format.
 			 */
@@ -120,120 +94,89 @@ namespace EmEn::Libs::VertexFactory
 			bool
 			readFile (const std::filesystem::path & filepath, Shape< vertex_data_t, index_data_t > & geometry, const ReadOptions & readOptions) noexcept override
 			{
-				m_readOptions = readOptions;
-
-				/* Opening the file. */
-				std::ifstream file{filepath};
+				IO::MappedFile file;
 
-				if ( !file.is_open() )
+				if ( !file.open(filepath) )
 				{
 					std::cerr << __PRETTY_FUNCTION__ << ", unable to read OBJ file '" << filepath << "' !" "\n";
 
 					return false;
 				}
-				
-				/* Read a first time to calculate the space required for the structure. */
-				{
-					if ( !this->analyseFileContent(file) )
-					{
-						std::cerr << __PRETTY_FUNCTION__ << ", step 1 'Reserving space' has failed !" "\n";
 
-						return false;
-					}
+				return this->readContent(file.view(), geometry, readOptions);
+			}
 
-					file.clear();
-					file.seekg(0);
-				}
+			/**
+			 * @brief Reads an OBJ content already in memory.
+			 * @param content A view on the OBJ text.
+			 * @param geometry A reference to the geometry to build.
+			 * @param readOptions A reference to the read options.
+			 * @note The content is parsed in parallel on the shared thread pool when one is declared.
+			 * @return bool
+			 */
+			[[nodiscard]]
+			bool
+			readContent (std::string_view content, Shape< vertex_data_t, index_data_t > & geometry, const ReadOptions & readOptions) noexcept
+			{
+				m_readOptions = readOptions;
 
-				/* 3. Read a third and final time to assemble faces. */
-				return geometry.build([this, &geometry, &file] (std::vector< std::pair< index_data_t, index_data_t > > & groups, std::vector< ShapeVertex< vertex_data_t > > & vertices, std::vector< ShapeTriangle< vertex_data_t, index_data_t > > & triangles) {
-					switch ( m_faceMode )
-					{
-						case FaceMode::V :
-							if ( !this->parseFaceAssemblyV(file, groups, vertices, triangles) )
-							{
-								return false;
-							}
+				/* 1. Parse the attributes and the faces of every chunk in parallel. */
+				auto * threadPool = ThreadPool::shared();
 
-							if ( m_readOptions.requestNormal )
-							{
-								if ( !geometry.computeTriangleNormal() )
-								{
-									return false;
-								}
-
-								if ( !geometry.computeVertexNormal() )
-								{
-									return false;
-								}
-							}
-							break;
+				auto chunks = FileFormatOBJ::splitContent(content, threadPool == nullptr ? 1 : threadPool->workerCount() + 1);
 
-						case FaceMode::V_VN :
-							if ( !this->parseFaceAssemblyV_VN(file, groups, vertices, triangles) )
-							{
-								return false;
-							}
-							break;
+				if ( chunks.size() > 1 )
+				{
+					threadPool->parallelFor(0, chunks.size(), [this, &chunks] (size_t firstChunk, size_t lastChunk) {
+						for ( auto chunkIndex = firstChunk; chunkIndex < lastChunk; ++chunkIndex )
+						{
+							this->parseChunk(chunks[chunkIndex]);
+						}
+					}, 1);
+				}
+				else
+				{
+					this->parseChunk(chunks.front());
+				}
 
-						case FaceMode::V_VT :
-							if ( !this->parseFaceAssemblyV_VT(file, groups, vertices, triangles) )
-							{
-								return false;
-							}
+				/* 2. Merge the attributes and give the faces their indices in the whole file. */
+				if ( !this->mergeChunks(chunks) )
+				{
+					return false;
+				}
 
-							if ( m_readOptions.requestTangentSpace )
-							{
-								if ( !geometry.computeTriangleTBNSpace() )
-								{
-									return false;
-								}
-
-								if ( !geometry.computeVertexTBNSpace() )
-								{
-									return false;
-								}
-							}
-							else if ( m_readOptions.requestNormal )
-							{
-								if ( !geometry.computeTriangleNormal() )
-								{
-									return false;
-								}
-
-								if ( !geometry.computeVertexNormal() )
-								{
-									return false;
-								}
-							}
-							break;
+				/* 3. Assemble the faces into vertices and triangles. */
+				const auto hasTextureCoordinates = !m_vt.empty() && m_usesTextureCoordinates;
+				const auto hasNormals = !m_vn.empty() && m_usesNormals;
 
-						case FaceMode::V_VT_VN :
-							if ( !this->parseFaceAssemblyV_VT_VN(file, groups, vertices, triangles) )
-							{
-								return false;
-							}
+				return geometry.build([this, &chunks, &geometry, hasTextureCoordinates, hasNormals] (std::vector< std::pair< index_data_t, index_data_t > > & groups, std::vector< ShapeVertex< vertex_data_t > > & vertices, std::vector< ShapeTriangle< vertex_data_t, index_data_t > > & triangles) {
+					if ( !this->assembleFaces(chunks, groups, vertices, triangles) )
+					{
+						return false;
+					}
 
-							if ( m_readOptions.requestTangentSpace )
-							{
-								if ( !geometry.computeTriangleTangent() )
-								{
-									return false;
-								}
-
-								if ( !geometry.computeVertexTangent() )
-								{
-									return false;
-								}
-							}
-							break;
+					if ( hasNormals )
+					{
+						if ( hasTextureCoordinates && m_readOptions.requestTangentSpace )
+						{
+							return geometry.computeTriangleTangent() && geometry.computeVertexTangent();
+						}
+
+						return true;
+					}
+
+					if ( hasTextureCoordinates && m_readOptions.requestTangentSpace )
+					{
+						return geometry.computeTriangleTBNSpace() && geometry.computeVertexTBNSpace();
+					}
 
-						default:
-							return false;
+					if ( m_readOptions.requestNormal )
+					{
+						return geometry.computeTriangleNormal() && geometry.computeVertexNormal();
 					}
 
 					return true;
-				}, !m_vt.empty(), false);
+				}, hasTextureCoordinates, false);
 			}
 
 			/** @copydoc EmEn::Libs::VertexFactory::FileFormatInterface::writeFile() */
@@ -266,1288 +209,666 @@ namespace EmEn::Libs::VertexFactory
 
 		private:
 
-			enum class LineType : uint8_t
-			{
-				Unknown,
-				Comment,
-				VertexValues,
-				TexCoordValues,
-				NormalValues,
-				FaceAssembly,
-				ObjectName,
-				GroupName,
-				SmoothShadingState,
-				MaterialFile,
-				MaterialState
-			};
-
 			/**
-			 * @brief How the face are declared in the file.
+			 * @brief A line-aligned part of the file and what was parsed from it.
+			 * @note Relative indices are resolved against the chunk first, then against the whole file when merging.
 			 */
-			enum class FaceMode : uint8_t
+			struct Chunk
 			{
-				Undetermined,
-				/** @brief F Line format : "f v1 v2 v3" */
-				V,
-				/** @brief F Line format : "f v1//vn1 v2//vn2 v3//vn3" */
-				V_VN,
-				/** @brief F Line format : "f v1/vt1 v2/vt2 v3/vt3" */
-				V_VT,
-				/** @brief F Line format : "f v1/vt1/vn1 v2/vt2/vn2 v3/vt3/vn3" */
-				V_VT_VN
+				std::string_view text;
+				std::vector< Math::Vector< 3, vertex_data_t > > positions;
+				std::vector< Math::Vector< 3, vertex_data_t > > textureCoordinates;
+				std::vector< Math::Vector< 3, vertex_data_t > > normals;
+				std::vector< OBJCorner > corners;
+				std::vector< uint32_t > faceSizes;
+				/* NOTE: The number of faces read in the chunk when a group is declared. */
+				std::vector< size_t > groupFaces;
+				/* NOTE: The corner index and the attributes (bit 0: v, bit 1: vt, bit 2: vn) using a relative index. */
+				std::vector< std::pair< size_t, uint8_t > > relativeCorners;
+				std::string errorLine;
+				bool usesTextureCoordinates{false};
+				bool usesNormals{false};
 			};
 
 			/**
-			 * @brief Tells what kind of attributes are predominant in the OBJ file.
-			 */
-			enum PredominantAttributes
-			{
-				V,
-				VN,
-				VT
-			};
-
-			/**
-			 * @brief Determines how the OBJ format describe a face.
-			 * @param fline A reference to a string.
-			 * @return FaceMode
+			 * @brief Splits the content into line-aligned chunks.
+			 * @param content A view on the OBJ text.
+			 * @param maxChunkCount The maximum number of chunks.
+			 * @return std::vector< Chunk >
 			 */
 			[[nodiscard]]
 			static
-			FaceMode
-			determineFaceDeclarationMode (const std::string & fline) noexcept
+			std::vector< Chunk >
+			splitContent (std::string_view content, size_t maxChunkCount) noexcept
 			{
-				if ( fline.find("//") != std::string::npos )
-				{
-					return FaceMode::V_VN;
-				}
+				const auto chunkCount = std::clamp< size_t >(content.size() / MinimumChunkSize, 1, std::max< size_t >(1, maxChunkCount));
+
+				std::vector< Chunk > chunks(chunkCount);
 
-				const auto dashCount = std::ranges::count(fline, '/');
+				size_t begin = 0;
 
-				if ( dashCount == 0 )
+				for ( size_t chunkIndex = 0; chunkIndex < chunkCount; ++chunkIndex )
 				{
-					return FaceMode::V;
+					auto end = chunkIndex + 1 == chunkCount ? content.size() : std::max(begin, (content.size() / chunkCount) * (chunkIndex + 1));
+
+					/* NOTE: The chunk ends after the next line feed. */
+					if ( end < content.size() )
+					{
+						const auto lineFeed = content.find('\n', end);
+
+						end = lineFeed == std::string_view::npos ? content.size() : lineFeed + 1;
+					}
+
+					chunks[chunkIndex].text = content.substr(begin, end - begin);
+
+					begin = end;
 				}
 
-				const auto spaceCount = std::ranges::count(fline, ' ');
+				return chunks;
+			}
 
-				if ( dashCount > spaceCount )
+			/**
+			 * @brief Skips the spaces and the tabulations.
+			 * @param cursor A reference to the read position.
+			 * @param end The end of the line.
+			 * @return void
+			 */
+			static
+			void
+			skipBlanks (const char * & cursor, const char * end) noexcept
+			{
+				while ( cursor < end && (*cursor == ' ' || *cursor == '\t') )
 				{
-					return FaceMode::V_VT_VN;
+					++cursor;
 				}
-
-				return FaceMode::V_VT;
 			}
 
 			/**
-			 * @brief Reads a first time to calculate the space required for the structure.
-			 * @param file A reference to an input stream.
+			 * @brief Reads a floating point number.
+			 * @param cursor A reference to the read position.
+			 * @param end The end of the line.
+			 * @param value A reference to the read value.
 			 * @return bool
 			 */
+			static
 			bool
-			analyseFileContent (std::ifstream & file) noexcept
+			readNumber (const char * & cursor, const char * end, vertex_data_t & value) noexcept
 			{
-				std::string line{};
+				FileFormatOBJ::skipBlanks(cursor, end);
 
-				index_data_t positionCount = 0;
-				index_data_t textureCoordinatesCount = 0;
-				index_data_t normalCount = 0;
-
-				while ( std::getline(file, line) )
+				/* NOTE: std::from_chars() rejects the leading plus sign. */
+				if ( cursor < end && *cursor == '+' )
 				{
-					if ( line.starts_with("v ") )
-					{
-						++positionCount;
-					}
-					else if ( line.starts_with("vt ") )
-					{
-						++textureCoordinatesCount;
-					}
-					else if ( line.starts_with("vn ") )
-					{
-						++normalCount;
-					}
-					else if ( line.starts_with("f ") )
-					{
-						if ( m_faceCount == 0 )
-						{
-							m_faceMode = determineFaceDeclarationMode(line);
-						}
-
-						const auto spaceCount = getSpaceCount(line);
-
-						if ( spaceCount < 3 || spaceCount > 4 )
-						{
-							std::cerr << __PRETTY_FUNCTION__ << ", this OBJ loader support only triangle or quad face definition !" << '\n';
-
-							return false;
-						}
-
-						m_faceCount += spaceCount - 2;
-					}
+					++cursor;
 				}
 
-				if constexpr ( VertexFactoryDebugEnabled )
-				{
-					std::cout <<
-						"[DEBUG:VERTEX_FACTORY] File Parsing - First pass result." "\n" <<
-						"\t" "Vertices : " << positionCount << "\n"
-						"\t" "Texture Coordinates : " << textureCoordinatesCount << "\n"
-						"\t" "Normals : " << normalCount << "\n"
-						"\t" "Faces : " << m_faceCount << "\n\n";
-				}
+				const auto [pointer, errorCode] = std::from_chars(cursor, end, value);
 
-				if ( positionCount == 0 )
+				if ( errorCode != std::errc{} )
 				{
-					std::cerr << __PRETTY_FUNCTION__ << ", there is no vertex definition in the OBJ file. Aborting." "\n";
-
 					return false;
 				}
 
-				if ( m_faceCount == 0 )
-				{
-					std::cerr << __PRETTY_FUNCTION__ << ", there is no face definition in the OBJ file. Aborting." "\n";
+				cursor = pointer;
 
-					return false;
-				}
-
-				/* Resize vectors. */
-				m_v.resize(positionCount);
-				m_vt.resize(textureCoordinatesCount);
-				m_vn.resize(normalCount);
+				return true;
+			}
 
-				m_vertexCount = static_cast< index_data_t >(std::max(m_v.size(), std::max(m_vt.size(), m_vn.size())));
+			/**
+			 * @brief Reads an OBJ index.
+			 * @param cursor A reference to the read position.
+			 * @param end The end of the line.
+			 * @param value A reference to the read value.
+			 * @return bool
+			 */
+			static
+			bool
+			readIndex (const char * & cursor, const char * end, int64_t & value) noexcept
+			{
+				const auto [pointer, errorCode] = std::from_chars(cursor, end, value);
 
-				if ( m_vertexCount == static_cast< index_data_t >(m_v.size()) )
+				/* NOTE: OBJ indices start at 1, negative ones are relative to the last declared attribute. */
+				if ( errorCode != std::errc{} || value == 0 )
 				{
-					m_predominantAttribute = PredominantAttributes::V;
-				}
-				else if ( m_vertexCount == static_cast< index_data_t >(m_vn.size()) )
-				{
-					m_predominantAttribute = PredominantAttributes::VN;
-				}
-				else
-				{
-					m_predominantAttribute = PredominantAttributes::VT;
+					return false;
 				}
 
+				cursor = pointer;
+
 				return true;
 			}
 
 			/**
-			 * @brief Reads a line using OBJ F line format : "f v1 v2 v3"
-			 * @param file A reference to the OBJ file.
-			 * @param groups A reference to an index list.
-			 * @param vertices A reference to the vertex list.
-			 * @param triangles A reference to the triangle list.
+			 * @brief Reads up to three numbers of an attribute line.
+			 * @param cursor The read position after the keyword.
+			 * @param end The end of the line.
+			 * @param minimumCount The number of values required.
+			 * @param vector A reference to the read vector.
 			 * @return bool
 			 */
+			static
 			bool
-			parseFaceAssemblyV (std::ifstream & file, std::vector< std::pair< index_data_t, index_data_t > > & groups, std::vector< ShapeVertex< vertex_data_t > > & vertices, std::vector< ShapeTriangle< vertex_data_t, index_data_t > > & triangles) noexcept
+			readVector (const char * cursor, const char * end, size_t minimumCount, Math::Vector< 3, vertex_data_t > & vector) noexcept
 			{
-				/* NOTE: Resize/reserving memory space to the geometry shape. */
-				vertices.resize(m_vertexCount);
-				triangles.reserve(m_faceCount);
+				for ( size_t component = 0; component < 3; ++component )
+				{
+					if ( !FileFormatOBJ::readNumber(cursor, end, vector[component]) )
+					{
+						return component >= minimumCount;
+					}
+				}
 
-				/* Keep count on attributes and triangles. */
-				index_data_t positionCount = 0;
-				index_data_t triangleCount = 0;
+				return true;
+			}
 
-				std::string objLine{};
+			/**
+			 * @brief Parses the "v", "vt", "vn", "f" and "g" lines of a chunk.
+			 * @param chunk A reference to the chunk.
+			 * @return void
+			 */
+			void
+			parseChunk (Chunk & chunk) const noexcept
+			{
+				const auto scaled = Utility::different(m_readOptions.scaleFactor, 1.0F);
+				const auto * cursor = chunk.text.data();
+				const auto * const textEnd = cursor + chunk.text.size();
+
+				/* NOTE: Rough estimation from the average OBJ line length. */
+				chunk.positions.reserve(chunk.text.size() / 96);
+				chunk.corners.reserve(chunk.text.size() / 24);
 
-				while ( std::getline(file, objLine) )
+				while ( cursor < textEnd )
 				{
-					/* Declaring a group. */
-					if ( objLine.starts_with("g ") )
-					{
-						if ( triangleCount > 0 )
-						{
-							groups.emplace_back(triangleCount, 0);
-						}
+					const auto * lineEnd = static_cast< const char * >(std::memchr(cursor, '\n', static_cast< size_t >(textEnd - cursor)));
 
-						continue;
+					if ( lineEnd == nullptr )
+					{
+						lineEnd = textEnd;
 					}
 
-					if ( objLine.starts_with("v ") )
+					const auto * const nextLine = lineEnd < textEnd ? lineEnd + 1 : textEnd;
+
+					if ( lineEnd > cursor && *(lineEnd - 1) == '\r' )
 					{
-						this->extractPositionAttribute(objLine, positionCount++);
+						--lineEnd;
 					}
-					else if ( objLine.starts_with("f ") )
-					{
-						std::vector< OBJVertex< index_data_t > > faceIndices{};
 
-						if ( !this->extractFaceIndices(objLine, faceIndices) )
-						{
-							return false;
-						}
+					const auto * const lineBegin = cursor;
 
-						/* NOTE: f line can express a triangle or a polygon ! */
-						for ( index_data_t triangleOffset = 0; triangleOffset < faceIndices.size() - 2; ++triangleOffset )
-						{
-							/* NOTES: "f 0 1 2 3"
-							 * Must goes into
-							 * "0 1 2"
-							 * "0 2 3"
-							 */
+					FileFormatOBJ::skipBlanks(cursor, lineEnd);
 
-							ShapeTriangle< vertex_data_t, index_data_t > triangle;
-
-							for ( index_data_t faceVertexIndex = 0; faceVertexIndex < 3; ++faceVertexIndex )
-							{
-								const auto realFaceVertexIndex = faceVertexIndex == 0 ? faceVertexIndex : faceVertexIndex + triangleOffset;
+					if ( lineEnd - cursor >= 2 )
+					{
+						const auto keyword = cursor[0];
+						const auto isBlank = [] (char character) {
+							return character == ' ' || character == '\t';
+						};
 
-								/* NOTE: Convert OBJ index to vector index. */
-								const auto vIndex = faceIndices.at(realFaceVertexIndex).vIndex - 1;
+						if ( keyword == 'v' && isBlank(cursor[1]) )
+						{
+							/* v 0.123 0.234 0.345 [1.0] */
+							Math::Vector< 3, vertex_data_t > position;
 
-								/* NOTE: Copy the OBJ extracts values to the final shape vertex. */
-								vertices.at(vIndex).setPosition(m_v.at(vIndex));
+							if ( !FileFormatOBJ::readVector(cursor + 1, lineEnd, 3, position) )
+							{
+								chunk.errorLine.assign(lineBegin, lineEnd);
 
-								/* Declare the vertex index to one of the three vertices of the triangle. */
-								triangle.setVertexIndex(faceVertexIndex, vIndex);
+								return;
 							}
 
-							triangles.emplace_back(triangle);
-
-							++triangleCount;
+							position[Math::X] = m_readOptions.flipXAxis ? -position[Math::X] : position[Math::X];
+							position[Math::Y] = m_readOptions.flipYAxis ? -position[Math::Y] : position[Math::Y];
+							position[Math::Z] = m_readOptions.flipZAxis ? -position[Math::Z] : position[Math::Z];
 
-							if ( !groups.empty() )
+							if ( scaled )
 							{
-								++groups.back().second;
+								position.scale(m_readOptions.scaleFactor);
 							}
-						}
-					}
-				}
-
-				return true;
-			}
-
-			/**
-			 * @brief Reads a line using OBJ F line format : "f v1//vn1 v2//vn2 v3//vn3".
-			 * @param file A reference to the OBJ file.
-			 * @param groups A reference to an index list.
-			 * @param vertices A reference to the vertex list.
-			 * @param triangles A reference to the triangle list.
-			 * @return bool
-			 */
-			bool
-			parseFaceAssemblyV_VN (std::ifstream & file, std::vector< std::pair< index_data_t, index_data_t > > & groups, std::vector< ShapeVertex< vertex_data_t > > & vertices, std::vector< ShapeTriangle< vertex_data_t, index_data_t > > & triangles) noexcept
-			{
-				/* NOTE: Resize/reserving memory space to the geometry shape. */
-				vertices.resize(m_vertexCount);
-				triangles.reserve(m_faceCount);
-
-				/* Keep track of generated shape vertex index. */
-				std::set< index_data_t > writtenIndexes{};
-
-				/* Keep count on attributes and triangles. */
-				index_data_t positionCount = 0;
-				index_data_t normalCount = 0;
-				index_data_t triangleCount = 0;
 
-				std::string objLine{};
-
-				while ( std::getline(file, objLine) )
-				{
-					/* Declaring a group. */
-					if ( objLine.starts_with("g ") )
-					{
-						if ( triangleCount > 0 )
-						{
-							groups.emplace_back(triangleCount, 0);
+							chunk.positions.emplace_back(position);
 						}
+						else if ( keyword == 'v' && cursor[1] == 't' && lineEnd - cursor >= 3 && isBlank(cursor[2]) )
+						{
+							/* vt 0.500 -1.352 [0.234] */
+							Math::Vector< 3, vertex_data_t > textureCoordinates;
 
-						continue;
-					}
+							if ( !FileFormatOBJ::readVector(cursor + 2, lineEnd, 1, textureCoordinates) )
+							{
+								chunk.errorLine.assign(lineBegin, lineEnd);
 
-					if ( objLine.starts_with("v ") )
-					{
-						this->extractPositionAttribute(objLine, positionCount++);
-					}
-					else if ( objLine.starts_with("vn ") )
-					{
-						this->extractNormalAttribute(objLine, normalCount++);
-					}
-					else if ( objLine.starts_with("f ") )
-					{
-						std::vector< OBJVertex< index_data_t > > faceIndices;
+								return;
+							}
 
-						if ( !this->extractFaceIndices(objLine, faceIndices) )
-						{
-							return false;
-						}
+							textureCoordinates[Math::X] = m_readOptions.flipXAxis ? -textureCoordinates[Math::X] : textureCoordinates[Math::X];
+							textureCoordinates[Math::Y] = m_readOptions.flipYAxis ? -textureCoordinates[Math::Y] : textureCoordinates[Math::Y];
 
-						/* NOTE: f line can express a triangle or a polygon ! */
-						for ( index_data_t triangleOffset = 0; triangleOffset < faceIndices.size() - 2; ++triangleOffset )
+							chunk.textureCoordinates.emplace_back(textureCoordinates);
+						}
+						else if ( keyword == 'v' && cursor[1] == 'n' && lineEnd - cursor >= 3 && isBlank(cursor[2]) )
 						{
-							/* NOTES: "f 0 1 2 3"
-							 * Must goes into
-							 * "0 1 2"
-							 * "0 2 3"
-							 */
-
-							ShapeTriangle< vertex_data_t, index_data_t > triangle;
+							/* vn 0.707 0.000 0.707 */
+							Math::Vector< 3, vertex_data_t > normal;
 
-							for ( index_data_t faceVertexIndex = 0; faceVertexIndex < 3; ++faceVertexIndex )
+							if ( !FileFormatOBJ::readVector(cursor + 2, lineEnd, 3, normal) )
 							{
-								const auto realFaceVertexIndex = faceVertexIndex == 0 ? faceVertexIndex : faceVertexIndex + triangleOffset;
-								const auto & OBJVertex = faceIndices.at(realFaceVertexIndex);
-
-								/* NOTE: Convert OBJ index to vector index. */
-								const auto vIndex = OBJVertex.vIndex - 1;
-								const auto vnIndex = OBJVertex.vnIndex - 1;
-
-								/* NOTE: Get the real shape vertex index in the final shape. */
-								index_data_t geometryVertexIndex = 0;
-
-								switch ( m_predominantAttribute )
-								{
-									case PredominantAttributes::V :
-										geometryVertexIndex = vIndex;
-										break;
-
-									case PredominantAttributes::VN :
-										geometryVertexIndex = vnIndex;
-										break;
-
-									default:
-										return false;
-								}
-
-								if ( writtenIndexes.contains(geometryVertexIndex) )
-								{
-									const auto & vertex = vertices.at(geometryVertexIndex);
-
-									const auto & position = m_v.at(vIndex);
-
-									/* NOTE: If the position is different, we create a new shape vertex. */
-									if ( vertex.position() != position )
-									{
-										vertices.emplace_back(position, m_vn.at(vnIndex));
-
-										geometryVertexIndex = static_cast< index_data_t >(vertices.size() - 1);
-									}
-								}
-								else
-								{
-									/* NOTE: Copy the OBJ extracts values to the final shape vertex. */
-									auto & vertex = vertices.at(geometryVertexIndex);
-									vertex.setPosition(m_v.at(vIndex));
-									vertex.setNormal(m_vn.at(vnIndex));
-
-									writtenIndexes.emplace(geometryVertexIndex);
-								}
-
-								/* Declare the vertex index to one of the three vertices of the triangle. */
-								triangle.setVertexIndex(faceVertexIndex, geometryVertexIndex);
-							}
+								chunk.errorLine.assign(lineBegin, lineEnd);
 
-							triangles.emplace_back(triangle);
+								return;
+							}
 
-							++triangleCount;
+							normal[Math::X] = m_readOptions.flipXAxis ? -normal[Math::X] : normal[Math::X];
+							normal[Math::Y] = m_readOptions.flipYAxis ? -normal[Math::Y] : normal[Math::Y];
+							normal[Math::Z] = m_readOptions.flipZAxis ? -normal[Math::Z] : normal[Math::Z];
 
-							if ( !groups.empty() )
+							chunk.normals.emplace_back(normal);
+						}
+						else if ( keyword == 'f' && isBlank(cursor[1]) )
+						{
+							/* f v1[/vt1][/vn1] v2[/vt2][/vn2] v3[/vt3][/vn3] ... */
+							if ( !this->parseFace(chunk, cursor + 1, lineEnd) )
 							{
-								++groups.back().second;
+								chunk.errorLine.assign(lineBegin, lineEnd);
+
+								return;
 							}
 						}
+						else if ( keyword == 'g' && isBlank(cursor[1]) )
+						{
+							/* g [group name] */
+							chunk.groupFaces.emplace_back(chunk.faceSizes.size());
+						}
 					}
-				}
 
-				return true;
+					cursor = nextLine;
+				}
 			}
 
 			/**
-			 * @brief Reads a line using OBJ F line format : "f v1/vt1 v2/vt2 v3/vt3"
-			 * @param file A reference to the OBJ file.
-			 * @param groups A reference to an index list.
-			 * @param vertices A reference to the vertex list.
-			 * @param triangles A reference to the triangle list.
+			 * @brief Parses the corners of a face line.
+			 * @param chunk A reference to the chunk.
+			 * @param cursor The read position after the keyword.
+			 * @param end The end of the line.
 			 * @return bool
 			 */
+			static
 			bool
-			parseFaceAssemblyV_VT (std::ifstream & file, std::vector< std::pair< index_data_t, index_data_t > > & groups, std::vector< ShapeVertex< vertex_data_t > > & vertices, std::vector< ShapeTriangle< vertex_data_t, index_data_t > > & triangles) noexcept
+			parseFace (Chunk & chunk, const char * cursor, const char * end) noexcept
 			{
-				/* NOTE: Resize/reserving memory space to the geometry shape. */
-				vertices.resize(m_vertexCount);
-				triangles.reserve(m_faceCount);
+				const auto firstCorner = chunk.corners.size();
 
-				/* Keep track of generated shape vertex index. */
-				std::set< index_data_t > writtenIndexes{};
+				/* NOTE: Resolves an index against the attributes already read in the chunk. */
+				const auto resolve = [] (int64_t index, size_t localCount, uint8_t attributeBit, uint8_t & relativeBits) {
+					if ( index > 0 )
+					{
+						return index - 1;
+					}
 
-				/* Keep count on attributes and triangles. */
-				index_data_t positionCount = 0;
-				index_data_t textureCoordinatesCount = 0;
-				index_data_t triangleCount = 0;
+					relativeBits |= attributeBit;
 
-				std::string objLine{};
+					return static_cast< int64_t >(localCount) + index;
+				};
 
-				while ( std::getline(file, objLine) )
+				while ( true )
 				{
-					/* Declaring a group. */
-					if ( objLine.starts_with("g ") )
-					{
-						if ( triangleCount > 0 )
-						{
-							groups.emplace_back(triangleCount, 0);
-						}
-
-						continue;
-					}
+					FileFormatOBJ::skipBlanks(cursor, end);
 
-					if ( objLine.starts_with("v ") )
+					if ( cursor >= end )
 					{
-						this->extractPositionAttribute(objLine, positionCount++);
+						break;
 					}
-					else if ( objLine.starts_with("vt ") )
+
+					OBJCorner corner;
+					uint8_t relativeBits = 0;
+					int64_t index = 0;
+
+					if ( !FileFormatOBJ::readIndex(cursor, end, index) )
 					{
-						this->extractTextureCoordinatesAttribute(objLine, textureCoordinatesCount++);
+						return false;
 					}
-					else if ( objLine.starts_with("f ") )
+
+					corner.vIndex = resolve(index, chunk.positions.size(), 1, relativeBits);
+
+					if ( cursor < end && *cursor == '/' )
 					{
-						std::vector< OBJVertex< index_data_t > > faceIndices;
+						++cursor;
 
-						if ( !this->extractFaceIndices(objLine, faceIndices) )
+						/* NOTE: "v//vn" has no texture coordinates. */
+						if ( cursor < end && *cursor != '/' )
 						{
-							return false;
+							if ( !FileFormatOBJ::readIndex(cursor, end, index) )
+							{
+								return false;
+							}
+
+							corner.vtIndex = resolve(index, chunk.textureCoordinates.size(), 2, relativeBits);
+							chunk.usesTextureCoordinates = true;
 						}
 
-						/* NOTE: f line can express a triangle or a polygon ! */
-						for ( index_data_t triangleOffset = 0; triangleOffset < faceIndices.size() - 2; ++triangleOffset )
+						if ( cursor < end && *cursor == '/' )
 						{
-							/* NOTES: "f 0 1 2 3"
-							 * Must goes into
-							 * "0 1 2"
-							 * "0 2 3"
-							 */
-
-							ShapeTriangle< vertex_data_t, index_data_t > triangle;
+							++cursor;
 
-							for ( index_data_t faceVertexIndex = 0; faceVertexIndex < 3; ++faceVertexIndex )
+							if ( !FileFormatOBJ::readIndex(cursor, end, index) )
 							{
-								const auto realFaceVertexIndex = faceVertexIndex == 0 ? faceVertexIndex : faceVertexIndex + triangleOffset;
-								const auto & OBJVertex = faceIndices.at(realFaceVertexIndex);
-
-								/* NOTE: Convert OBJ index to vector index. */
-								const auto vIndex = OBJVertex.vIndex - 1;
-								const auto vtIndex = OBJVertex.vtIndex - 1;
-
-								/* NOTE: Get the real shape vertex index in the final shape. */
-								index_data_t geometryVertexIndex = 0;
-
-								switch ( m_predominantAttribute )
-								{
-									case PredominantAttributes::V :
-										geometryVertexIndex = vIndex;
-										break;
-
-									case PredominantAttributes::VT :
-										geometryVertexIndex = vtIndex;
-										break;
-
-									default:
-										return false;
-								}
-
-								if ( writtenIndexes.contains(geometryVertexIndex) )
-								{
-									const auto & vertex = vertices.at(geometryVertexIndex);
-
-									const auto & position = m_v.at(vIndex);
-
-									/* NOTE: If the position is different, we create a new shape vertex. */
-									if ( vertex.position() != position )
-									{
-										vertices.emplace_back(position, Math::Vector< 3, float >{}, m_vt.at(vtIndex));
-
-										geometryVertexIndex = static_cast< index_data_t >(vertices.size() - 1);
-									}
-								}
-								else
-								{
-									/* NOTE: Copy the OBJ extracts values to the final shape vertex. */
-									auto & vertex = vertices.at(geometryVertexIndex);
-									vertex.setPosition(m_v.at(vIndex));
-									vertex.setTextureCoordinates(m_vt.at(vtIndex));
-
-									writtenIndexes.emplace(geometryVertexIndex);
-								}
-
-								/* Declare the vertex index to one of the three vertices of the triangle. */
-								triangle.setVertexIndex(faceVertexIndex, geometryVertexIndex);
+								return false;
 							}
 
-							triangles.emplace_back(triangle);
+							corner.vnIndex = resolve(index, chunk.normals.size(), 4, relativeBits);
+							chunk.usesNormals = true;
+						}
+					}
 
-							++triangleCount;
+					/* NOTE: Anything else than a separator after a corner is malformed. */
+					if ( cursor < end && *cursor != ' ' && *cursor != '\t' )
+					{
+						return false;
+					}
 
-							if ( !groups.empty() )
-							{
-								++groups.back().second;
-							}
-						}
+					if ( relativeBits != 0 )
+					{
+						chunk.relativeCorners.emplace_back(chunk.corners.size(), relativeBits);
 					}
+
+					chunk.corners.emplace_back(corner);
+				}
+
+				const auto cornerCount = chunk.corners.size() - firstCorner;
+
+				if ( cornerCount < 3 )
+				{
+					return false;
 				}
 
+				chunk.faceSizes.emplace_back(static_cast< uint32_t >(cornerCount));
+
 				return true;
 			}
 
 			/**
-			 * @brief Reads a line using OBJ F line format : "f v1/vt1/vn1 v2/vt2/vn2 v3/vt3/vn3"
-			 * @param file A reference to the OBJ file.
-			 * @param groups A reference to an index list.
-			 * @param vertices A reference to the vertex list.
-			 * @param triangles A reference to the triangle list.
+			 * @brief Gathers the attributes of every chunk and resolves the relative indices against the whole file.
+			 * @param chunks A reference to the parsed chunks.
 			 * @return bool
 			 */
 			bool
-			parseFaceAssemblyV_VT_VN (std::ifstream & file, std::vector< std::pair< index_data_t, index_data_t > > & groups, std::vector< ShapeVertex< vertex_data_t > > & vertices, std::vector< ShapeTriangle< vertex_data_t, index_data_t > > & triangles) noexcept
+			mergeChunks (std::vector< Chunk > & chunks) noexcept
 			{
-				/* NOTE: Resize/reserving memory space to the geometry shape. */
-				vertices.resize(m_vertexCount);
-				triangles.reserve(m_faceCount);
-
-				/* Keep track of generated shape vertex index. */
-				std::set< index_data_t > writtenIndexes{};
-
-				/* Keep count on attributes and triangles. */
-				index_data_t positionCount = 0;
-				index_data_t textureCoordinatesCount = 0;
-				index_data_t normalCount = 0;
-				index_data_t triangleCount = 0;
+				size_t positionCount = 0;
+				size_t textureCoordinatesCount = 0;
+				size_t normalCount = 0;
+				size_t faceCount = 0;
 
-				std::string objLine{};
+				m_usesTextureCoordinates = false;
+				m_usesNormals = false;
 
-				while ( std::getline(file, objLine) )
+				for ( auto & chunk : chunks )
 				{
-					/* Declaring a group. */
-					if ( objLine.starts_with("g ") )
+					if ( !chunk.errorLine.empty() )
 					{
-						if ( triangleCount > 0 )
-						{
-							groups.emplace_back(triangleCount, 0);
-						}
+						std::cerr << __PRETTY_FUNCTION__ << ", malformed OBJ line !" "\n" "Faulty line: " << chunk.errorLine << '\n';
 
-						continue;
+						return false;
 					}
 
-					if ( objLine.starts_with("v ") )
-					{
-						this->extractPositionAttribute(objLine, positionCount++);
-					}
-					else if ( objLine.starts_with("vt ") )
-					{
-						this->extractTextureCoordinatesAttribute(objLine, textureCoordinatesCount++);
-					}
-					else if ( objLine.starts_with("vn ") )
+					for ( const auto & [cornerIndex, relativeBits] : chunk.relativeCorners )
 					{
-						this->extractNormalAttribute(objLine, normalCount++);
-					}
-					else if ( objLine.starts_with("f ") )
-					{
-						std::vector< OBJVertex< index_data_t > > faceIndices;
+						auto & corner = chunk.corners[cornerIndex];
 
-						if ( !this->extractFaceIndices(objLine, faceIndices) )
+						if ( (relativeBits & 1) != 0 )
 						{
-							return false;
+							corner.vIndex += static_cast< int64_t >(positionCount);
 						}
 
-						/* NOTE: f line can express a triangle or a polygon ! */
-						for ( index_data_t triangleOffset = 0; triangleOffset < faceIndices.size() - 2; ++triangleOffset )
+						if ( (relativeBits & 2) != 0 )
 						{
-							/* NOTES: "f 0 1 2 3"
-							 * Must goes into
-							 * "0 1 2"
-							 * "0 2 3"
-							 */
-
-							ShapeTriangle< vertex_data_t, index_data_t > triangle;
-
-							for ( index_data_t faceVertexIndex = 0; faceVertexIndex < 3; ++faceVertexIndex )
-							{
-								const auto realFaceVertexIndex = faceVertexIndex == 0 ? faceVertexIndex : faceVertexIndex + triangleOffset;
-								const auto & OBJVertex = faceIndices.at(realFaceVertexIndex);
-
-								/* NOTE: Convert OBJ index to vector index. */
-								const auto vIndex = OBJVertex.vIndex - 1;
-								const auto vnIndex = OBJVertex.vnIndex - 1;
-								const auto vtIndex = OBJVertex.vtIndex - 1;
-
-								/* NOTE: Get the real shape vertex index in the final shape. */
-								index_data_t geometryVertexIndex = 0;
-
-								switch ( m_predominantAttribute )
-								{
-									case PredominantAttributes::V :
-										geometryVertexIndex = vIndex;
-										break;
-
-									case PredominantAttributes::VN :
-										geometryVertexIndex = vnIndex;
-										break;
-
-									case PredominantAttributes::VT :
-										geometryVertexIndex = vtIndex;
-										break;
-								}
-
-								if ( writtenIndexes.contains(geometryVertexIndex) )
-								{
-									const auto & vertex = vertices.at(geometryVertexIndex);
-
-									const auto & position = m_v.at(vIndex);
-
-									/* NOTE: If the position is different, we create a new shape vertex. */
-									if ( vertex.position() != position )
-									{
-										vertices.emplace_back(position, m_vn.at(vnIndex), m_vt.at(vtIndex));
-
-										geometryVertexIndex = static_cast< uint32_t >(vertices.size() - 1);
-									}
-								}
-								else
-								{
-									/* NOTE: Copy the OBJ extracts values to the final shape vertex. */
-									auto & vertex = vertices.at(geometryVertexIndex);
-									vertex.setPosition(m_v.at(vIndex));
-									vertex.setNormal(m_vn.at(vnIndex));
-									vertex.setTextureCoordinates(m_vt.at(vtIndex));
-
-									writtenIndexes.emplace(geometryVertexIndex);
-								}
-
-								/* Declare the vertex index to one of the three vertices of the triangle. */
-								triangle.setVertexIndex(faceVertexIndex, geometryVertexIndex);
-							}
-
-							triangles.emplace_back(triangle);
-
-							++triangleCount;
+							corner.vtIndex += static_cast< int64_t >(textureCoordinatesCount);
+						}
 
-							if ( !groups.empty() )
-							{
-								++groups.back().second;
-							}
+						if ( (relativeBits & 4) != 0 )
+						{
+							corner.vnIndex += static_cast< int64_t >(normalCount);
 						}
 					}
-				}
-
-				return true;
-			}
 
-			/**
-			 * @brief Parses and "v" line to extract the position.
-			 * @param vLine A reference to a string.
-			 * @param offset The vertex offset.
-			 * @return void
-			 */
-			void
-			extractPositionAttribute (const std::string & vLine, index_data_t offset) noexcept
-			{
-#ifdef USE_SAFE_READ
-				Math::Vector< 3, data_t > position{vLine, ' ', 1};
+					positionCount += chunk.positions.size();
+					textureCoordinatesCount += chunk.textureCoordinates.size();
+					normalCount += chunk.normals.size();
+					faceCount += chunk.faceSizes.size();
 
-				if ( m_readOptions.flipXAxis )
-				{
-					position[Math::X] = -position[Math::X];
+					m_usesTextureCoordinates = m_usesTextureCoordinates || chunk.usesTextureCoordinates;
+					m_usesNormals = m_usesNormals || chunk.usesNormals;
 				}
 
-				if ( m_readOptions.flipYAxis )
-				{
-					position[Math::Y] = -position[Math::Y];
-				}
-
-				if ( m_readOptions.flipZAxis )
+				if constexpr ( VertexFactoryDebugEnabled )
 				{
-					position[Math::Z] = -position[Math::Z];
+					std::cout <<
+						"[DEBUG:VERTEX_FACTORY] File Parsing - " << chunks.size() << " chunk(s) result." "\n" <<
+						"\t" "Vertices : " << positionCount << "\n"
+						"\t" "Texture Coordinates : " << textureCoordinatesCount << "\n"
+						"\t" "Normals : " << normalCount << "\n"
+						"\t" "Faces : " << faceCount << "\n\n";
 				}
 
-				if ( Utility::different(m_scaleFactor, 1.0F) )
+				if ( positionCount == 0 )
 				{
-					position.scale(m_scaleFactor);
-				}
-
-				m_v.emplace_back(position);
-#else
-				float x, y, z;
-
-				sscanf(vLine.c_str(), "v %f %f %f",
-					&x,
-					&y,
-					&z
-				);
-
-				auto & vector =  m_v[offset];
-				vector[Math::X] = m_readOptions.flipXAxis ? -x : x;
-				vector[Math::Y] = m_readOptions.flipYAxis ? -y : y;
-				vector[Math::Z] = m_readOptions.flipZAxis ? -z : z;
+					std::cerr << __PRETTY_FUNCTION__ << ", there is no vertex definition in the OBJ file. Aborting." "\n";
 
-				if ( Utility::different(m_readOptions.scaleFactor, 1.0F) )
-				{
-					vector.scale(m_readOptions.scaleFactor);
+					return false;
 				}
-#endif
-			}
-
-			/**
-			 * @brief Parses and "vt" line to extract the texture coordinates.
-			 * @param vtLine A reference to a string.
-			 * @param offset The vertex offset.
-			 * @return void
-			 */
-			void
-			extractTextureCoordinatesAttribute (const std::string & vtLine, index_data_t offset) noexcept
-			{
-#ifdef USE_SAFE_READ
-				Math::Vector< 2, data_t > textureCoordinates{vtLine, ' ', 1};
 
-				if ( m_readOptions.flipXAxis )
+				if ( faceCount == 0 )
 				{
-					textureCoordinates[Math::X] = -textureCoordinates[Math::X];
-				}
+					std::cerr << __PRETTY_FUNCTION__ << ", there is no face definition in the OBJ file. Aborting." "\n";
 
-				if ( m_readOptions.flipYAxis )
-				{
-					textureCoordinates[Math::Y] = -textureCoordinates[Math::Y];
+					return false;
 				}
 
-				m_vt.emplace_back(textureCoordinates);
-#else
-				float u, v;
-
-				sscanf(vtLine.c_str(), "vt %f %f",
-					&u,
-					&v
-				);
-
-				auto & vector =  m_vt[offset];
-				vector[Math::X] = m_readOptions.flipXAxis ? -u : u;
-				vector[Math::Y] = m_readOptions.flipYAxis ? -v : v;
-#endif
-			}
-
-			/**
-			 * @brief Parses and "vn" line to extract the normal.
-			 * @param vnLine A reference to a string.
-			 * @param offset The vertex offset.
-			 * @return void
-			 */
-			void
-			extractNormalAttribute (const std::string & vnLine, index_data_t offset) noexcept
-			{
-#ifdef USE_SAFE_READ
-				Math::Vector< 3, data_t > normal{vnLine, ' ', 1};
-
-				if ( m_readOptions.flipXAxis )
-				{
-					normal[Math::X] = -normal[Math::X];
-				}
+				m_v.clear();
+				m_vt.clear();
+				m_vn.clear();
+				m_v.reserve(positionCount);
+				m_vt.reserve(textureCoordinatesCount);
+				m_vn.reserve(normalCount);
 
-				if ( m_readOptions.flipYAxis )
+				for ( auto & chunk : chunks )
 				{
-					normal[Math::Y] = -normal[Math::Y];
-				}
+					m_v.insert(m_v.end(), chunk.positions.cbegin(), chunk.positions.cend());
+					m_vt.insert(m_vt.end(), chunk.textureCoordinates.cbegin(), chunk.textureCoordinates.cend());
+					m_vn.insert(m_vn.end(), chunk.normals.cbegin(), chunk.normals.cend());
 
-				if ( m_readOptions.flipZAxis )
-				{
-					normal[Math::Z] = -normal[Math::Z];
+					chunk.positions = {};
+					chunk.textureCoordinates = {};
+					chunk.normals = {};
 				}
 
-				m_vn.emplace_back(normal);
-#else
-				float x, y, z;
-
-				sscanf(vnLine.c_str(), "vn %f %f %f",
-					&x,
-					&y,
-					&z
-				);
-
-				auto & vector =  m_vn[offset];
-				vector[Math::X] = m_readOptions.flipXAxis ? -x : x;
-				vector[Math::Y] = m_readOptions.flipYAxis ? -y : y;
-				vector[Math::Z] = m_readOptions.flipZAxis ? -z : z;
-#endif
+				return true;
 			}
 
 			/**
-			 * @brief Returns a list of usable vertices from F line.
-			 * @param fLine Vertices definition from the F line as indexes.
-			 * @param faceIndices A reference to a vector holding the face indices to position, normal or texture coordinates.
+			 * @brief Creates a shape vertex for each distinct attribute combination and triangulates the faces.
+			 * @note Faces with more than three corners are split as a fan. Without texture coordinates and normals,
+			 * the shape vertices are the OBJ positions.
+			 * @param chunks A reference to the merged chunks.
+			 * @param groups A reference to the group list.
+			 * @param vertices A reference to the vertex list.
+			 * @param triangles A reference to the triangle list.
 			 * @return bool
 			 */
 			bool
-			extractFaceIndices (const std::string & fLine, std::vector< OBJVertex< index_data_t > > & faceIndices) const noexcept
+			assembleFaces (const std::vector< Chunk > & chunks, std::vector< std::pair< index_data_t, index_data_t > > & groups, std::vector< ShapeVertex< vertex_data_t > > & vertices, std::vector< ShapeTriangle< vertex_data_t, index_data_t > > & triangles) const noexcept
 			{
-#ifdef USE_SAFE_READ
-				/* Split the face definition into points. */
-				const auto points = String::explode(fLine, ' ', false);
+				constexpr auto NoIndex = std::numeric_limits< index_data_t >::max();
 
-				/* NOTE: Including the "f" part ! */
-				if ( points.size() < 4 )
+				const auto positionCount = static_cast< int64_t >(m_v.size());
+				const auto textureCoordinatesCount = static_cast< int64_t >(m_vt.size());
+				const auto normalCount = static_cast< int64_t >(m_vn.size());
+				const auto positionsAsVertices = !m_usesTextureCoordinates && !m_usesNormals;
+
+				if ( m_v.size() >= NoIndex )
 				{
-					std::cerr << __PRETTY_FUNCTION__ << ", an OBJ face must define at least 3 vertices !" "\n" "Faulty line: " << fLine << '\n';
+					std::cerr << __PRETTY_FUNCTION__ << ", too many vertices for the index type !" "\n";
 
 					return false;
 				}
 
-				/* NOTE: Reserving the final data excluding the "f" part. */
-				faceIndices.reserve(points.size() - 1);
+				size_t triangleCount = 0;
 
-				for ( index_data_t index = 1; index < points.size(); ++index )
+				for ( const auto & chunk : chunks )
 				{
-					uint32_t vIndex = 0;
-					uint32_t vtIndex = 0;
-					uint32_t vnIndex = 0;
-
-					switch ( m_faceMode )
+					for ( const auto faceSize : chunk.faceSizes )
 					{
-						case FaceMode::V :
-							vIndex = String::toNumber< uint32_t >(points[index]);
-							break;
-
-						case FaceMode::V_VN :
-						{
-							const auto subCmp = String::explode(String::trim(points[index]), '/', false);
-
-							vIndex = String::toNumber< uint32_t >(subCmp[0]);
-							vnIndex = String::toNumber< uint32_t >(subCmp[1]);
-						}
-							break;
-
-						case FaceMode::V_VT :
-						{
-							const auto subCmp = String::explode(String::trim(points[index]), '/', false);
+						triangleCount += faceSize - 2;
+					}
+				}
 
-							vIndex = String::toNumber< uint32_t >(subCmp[0]);
-							vtIndex = String::toNumber< uint32_t >(subCmp[1]);
-						}
-							break;
+				triangles.reserve(triangleCount);
 
-						case FaceMode::V_VT_VN :
-						{
-							const auto subCmp = String::explode(String::trim(points[index]), '/', false);
+				if ( groups.empty() )
+				{
+					groups.emplace_back(0, 0);
+				}
 
-							vIndex = String::toNumber< uint32_t >(subCmp[0]);
-							vtIndex = String::toNumber< uint32_t >(subCmp[1]);
-							vnIndex = String::toNumber< uint32_t >(subCmp[2]);
-						}
-							break;
+				/* NOTE: The shape vertices sharing a position are chained to find an attribute combination in constant time. */
+				std::vector< index_data_t > firstVertices;
+				std::vector< index_data_t > nextVertices;
+				std::vector< std::pair< int64_t, int64_t > > vertexKeys;
 
-						default:
-							std::cerr << __PRETTY_FUNCTION__ << ", invalid face description mode !" "\n";
+				if ( positionsAsVertices )
+				{
+					vertices.reserve(m_v.size());
 
-							return false;
+					for ( const auto & position : m_v )
+					{
+						vertices.emplace_back(position);
 					}
+				}
+				else
+				{
+					firstVertices.resize(m_v.size(), NoIndex);
+					vertices.reserve(m_v.size());
+					nextVertices.reserve(m_v.size());
+					vertexKeys.reserve(m_v.size());
+				}
 
-					/* Checks for outbound with vertices list. */
-					if ( vIndex - 1 >= m_v.size() )
+				const auto getVertex = [&] (const OBJCorner & corner) -> index_data_t {
+					if ( corner.vIndex < 0 || corner.vIndex >= positionCount )
 					{
-						std::cerr << __PRETTY_FUNCTION__ << ", vertex #" << vIndex << " doesn't exist in OBJ file." "\n";
+						std::cerr << __PRETTY_FUNCTION__ << ", vertex #" << corner.vIndex + 1 << " doesn't exist in OBJ file." "\n";
 
-						return false;
+						return NoIndex;
 					}
 
-					/* Checks for outbound with texture coords list. */
-					if ( vtIndex > 0 && vtIndex - 1 >= m_vt.size() )
+					if ( corner.vtIndex >= textureCoordinatesCount || corner.vtIndex < -1 )
 					{
-						std::cerr << __PRETTY_FUNCTION__ << ", texture coordinates #" << vtIndex << " doesn't exist in OBJ file." "\n";
+						std::cerr << __PRETTY_FUNCTION__ << ", texture coordinates #" << corner.vtIndex + 1 << " doesn't exist in OBJ file." "\n";
 
-						return false;
+						return NoIndex;
 					}
 
-					/* Checks for outbound with normals list. */
-					if ( vnIndex > 0 && vnIndex - 1 >= m_vn.size() )
+					if ( corner.vnIndex >= normalCount || corner.vnIndex < -1 )
 					{
-						std::cerr << __PRETTY_FUNCTION__ << ", normal #" << vnIndex << " doesn't exist in OBJ file." "\n";
+						std::cerr << __PRETTY_FUNCTION__ << ", normal #" << corner.vnIndex + 1 << " doesn't exist in OBJ file." "\n";
 
-						return false;
+						return NoIndex;
 					}
 
-					faceIndices.emplace_back(vIndex, vtIndex, vnIndex);
-				}
-
-				return true;
-#else
-
-				const index_data_t pointCount = getSpaceCount(fLine);
-
-				if ( pointCount == 3 )
-				{
-					faceIndices.reserve(3);
-
-					switch ( m_faceMode )
+					if ( positionsAsVertices )
 					{
-						case FaceMode::V :
-						{
-							uint32_t vIndexA, vIndexB, vIndexC;
-
-							sscanf(fLine.c_str(), "f %u %u %u",
-								&vIndexA,
-								&vIndexB,
-								&vIndexC
-							);
-
-							faceIndices.emplace_back(vIndexA);
-							faceIndices.emplace_back(vIndexB);
-							faceIndices.emplace_back(vIndexC);
-						}
-							break;
-
-						case FaceMode::V_VN :
-						{
-							uint32_t vIndexA, vIndexB, vIndexC;
-							uint32_t vnIndexA, vnIndexB, vnIndexC;
-
-							sscanf(fLine.c_str(), "f %u//%u %u//%u %u//%u",
-								&vIndexA, &vnIndexA,
-								&vIndexB, &vnIndexB,
-								&vIndexC, &vnIndexC
-							);
-
-							faceIndices.emplace_back(vIndexA, 0, vnIndexA);
-							faceIndices.emplace_back(vIndexB, 0, vnIndexB);
-							faceIndices.emplace_back(vIndexC, 0, vnIndexC);
-						}
-							break;
-
-						case FaceMode::V_VT :
-						{
-							uint32_t vIndexA, vIndexB, vIndexC;
-							uint32_t vtIndexA, vtIndexB, vtIndexC;
-
-							sscanf(fLine.c_str(), "f %u/%u %u/%u %u/%u",
-								&vIndexA, &vtIndexA,
-								&vIndexB, &vtIndexB,
-								&vIndexC, &vtIndexC
-							);
-
-							faceIndices.emplace_back(vIndexA, vtIndexA);
-							faceIndices.emplace_back(vIndexB, vtIndexB);
-							faceIndices.emplace_back(vIndexC, vtIndexC);
-						}
-							break;
-
-						case FaceMode::V_VT_VN :
-						{
-							uint32_t vIndexA, vIndexB, vIndexC;
-							uint32_t vtIndexA, vtIndexB, vtIndexC;
-							uint32_t vnIndexA, vnIndexB, vnIndexC;
-
-							sscanf(fLine.c_str(), "f %u/%u/%u %u/%u/%u %u/%u/%u",
-								&vIndexA, &vtIndexA, &vnIndexA,
-								&vIndexB, &vtIndexB, &vnIndexB,
-								&vIndexC, &vtIndexC, &vnIndexC
-							);
-
-							faceIndices.emplace_back(vIndexA, vtIndexA, vnIndexA);
-							faceIndices.emplace_back(vIndexB, vtIndexB, vnIndexB);
-							faceIndices.emplace_back(vIndexC, vtIndexC, vnIndexC);
-						}
-							break;
-
-						default:
-							std::cerr << __PRETTY_FUNCTION__ << ", invalid face description mode !" "\n";
-
-							return false;
+						return static_cast< index_data_t >(corner.vIndex);
 					}
 
-					return true;
-				}
-
-				if ( pointCount == 4 )
-				{
-					faceIndices.reserve(4);
+					const auto key = std::make_pair(corner.vtIndex, corner.vnIndex);
+					auto & first = firstVertices[static_cast< size_t >(corner.vIndex)];
 
-					switch ( m_faceMode )
+					for ( auto vertexIndex = first; vertexIndex != NoIndex; vertexIndex = nextVertices[vertexIndex] )
 					{
-						case FaceMode::V :
-						{
-							uint32_t vIndexA, vIndexB, vIndexC, vIndexD;
-
-							sscanf(fLine.c_str(), "f %u %u %u %u",
-								&vIndexA,
-								&vIndexB,
-								&vIndexC,
-								&vIndexD
-							);
-
-							faceIndices.emplace_back(vIndexA);
-							faceIndices.emplace_back(vIndexB);
-							faceIndices.emplace_back(vIndexC);
-							faceIndices.emplace_back(vIndexD);
-						}
-							break;
-
-						case FaceMode::V_VN :
-						{
-							uint32_t vIndexA, vIndexB, vIndexC, vIndexD;
-							uint32_t vnIndexA, vnIndexB, vnIndexC, vnIndexD;
-
-							sscanf(fLine.c_str(), "f %u//%u %u//%u %u//%u %u//%u",
-								&vIndexA, &vnIndexA,
-								&vIndexB, &vnIndexB,
-								&vIndexC, &vnIndexC,
-								&vIndexD, &vnIndexD
-							);
-
-							faceIndices.emplace_back(vIndexA, 0, vnIndexA);
-							faceIndices.emplace_back(vIndexB, 0, vIndexB);
-							faceIndices.emplace_back(vIndexC, 0, vIndexC);
-							faceIndices.emplace_back(vIndexD, 0, vIndexD);
-						}
-							break;
-
-						case FaceMode::V_VT :
-						{
-							uint32_t vIndexA, vIndexB, vIndexC, vIndexD;
-							uint32_t vtIndexA, vtIndexB, vtIndexC, vtIndexD;
-
-							sscanf(fLine.c_str(), "f %u/%u %u/%u %u/%u %u/%u",
-								&vIndexA, &vtIndexA,
-								&vIndexB, &vtIndexB,
-								&vIndexC, &vtIndexC,
-								&vIndexD, &vtIndexD
-							);
-
-							faceIndices.emplace_back(vIndexA, vtIndexA);
-							faceIndices.emplace_back(vIndexB, vtIndexB);
-							faceIndices.emplace_back(vIndexC, vtIndexC);
-							faceIndices.emplace_back(vIndexD, vtIndexD);
-						}
-							break;
-
-						case FaceMode::V_VT_VN :
+						if ( vertexKeys[vertexIndex] == key )
 						{
-							uint32_t vIndexA, vIndexB, vIndexC, vIndexD;
-							uint32_t vtIndexA, vtIndexB, vtIndexC, vtIndexD;
-							uint32_t vnIndexA, vnIndexB, vnIndexC, vnIndexD;
-
-							sscanf(fLine.c_str(), "f %u/%u/%u %u/%u/%u %u/%u/%u %u/%u/%u",
-								&vIndexA, &vtIndexA, &vnIndexA,
-								&vIndexB, &vtIndexB, &vnIndexB,
-								&vIndexC, &vtIndexC, &vnIndexC,
-								&vIndexD, &vtIndexD, &vnIndexD
-							);
-
-							faceIndices.emplace_back(vIndexA, vtIndexA, vnIndexA);
-							faceIndices.emplace_back(vIndexB, vtIndexB, vnIndexB);
-							faceIndices.emplace_back(vIndexC, vtIndexC, vnIndexC);
-							faceIndices.emplace_back(vIndexD, vtIndexD, vnIndexD);
+							return vertexIndex;
 						}
-							break;
-
-						default:
-							std::cerr << __PRETTY_FUNCTION__ << ", invalid face description mode !" "\n";
-
-							return false;
 					}
 
-					return true;
-				}
-
-				std::cerr << __PRETTY_FUNCTION__ << ", this OBJ loader support only triangle and quad !" "\n";
-
-				return false;
+					if ( vertices.size() >= NoIndex )
+					{
+						std::cerr << __PRETTY_FUNCTION__ << ", too many vertices for the index type !" "\n";
 
-#endif
-			}
+						return NoIndex;
+					}
 
-			/**
-			 * @brief Returns the number of usable space in the OBJ line.
-			 * @param line A reference to a string.
-			 * @return index_data_t
-			 */
-			[[nodiscard]]
-			static
-			index_data_t
-			getSpaceCount (const std::string & line) noexcept
-			{
-				const auto lastChar = line.find_last_not_of(" \t\f\v\n\r");
+					const auto vertexIndex = static_cast< index_data_t >(vertices.size());
 
-				index_data_t count = 0;
+					auto & vertex = vertices.emplace_back(m_v[static_cast< size_t >(corner.vIndex)]);
 
-				for ( index_data_t index = 0; index < lastChar; ++index )
-				{
-					if ( line.at(index) == ' ' )
+					if ( corner.vnIndex >= 0 )
 					{
-						++count;
+						vertex.setNormal(m_vn[static_cast< size_t >(corner.vnIndex)]);
 					}
-				}
-
-				return count;
-			}
-
-#if __cplusplus < 202002L /* C++20 feature */
-			/**
-			 * @brief Determines the type of the OBJ file line.
-			 * @param line The current parsed line.
-			 * @return LineType
-			 */
-			[[nodiscard]]
-			static
-			LineType
-			getLineType (const std::string & line) noexcept
-			{
-				/* # this is a comment */
-				if ( String::startsWith(line, "#") )
-				{
-					return LineType::Comment;
-				}
-
-				/* mtllib [external .mtl file name] */
-				if ( String::startsWith(line, "mtllib") )
-				{
-					return LineType::MaterialFile;
-				}
-
-				/* usemtl [material name] */
-				if ( String::startsWith(line, "usemtl") )
-				{
-					return LineType::MaterialState;
-				}
-
-				/* vt 0.500 -1.352 [0.234] */
-				if ( String::startsWith(line, "vt ") )
-				{
-					return LineType::TexCoordValues;
-				}
-
-				/* vn 0.707 0.000 0.707 */
-				if ( String::startsWith(line, "vn ") )
-				{
-					return LineType::NormalValues;
-				}
-
-				/* v 0.123 0.234 0.345 1.0 */
-				if ( String::startsWith(line, "v ") )
-				{
-					return LineType::VertexValues;
-				}
 
-				/*
-				f v1 v2 v3 v4
-				f v1/vt1 v2/vt2 v3/vt3
-				f v1/vt1/vn1 v2/vt2/vn2 v3/vt3/vn3
-				f v1//vn1 v2//vn2 v3//vn3
-				*/
-				if ( String::startsWith(line, "f ") )
-				{
-					return LineType::FaceAssembly;
-				}
+					if ( corner.vtIndex >= 0 )
+					{
+						vertex.setTextureCoordinates(m_vt[static_cast< size_t >(corner.vtIndex)]);
+					}
 
-				/* o [object name] */
-				if ( String::startsWith(line, "o ") )
-				{
-					return LineType::ObjectName;
-				}
+					vertexKeys.emplace_back(key);
+					nextVertices.emplace_back(first);
+					first = vertexIndex;
 
-				/* g [group name] */
-				if ( String::startsWith(line, "g ") )
-				{
-					return LineType::GroupName;
-				}
+					return vertexIndex;
+				};
 
-				/* s 1 OR s off */
-				if ( String::startsWith(line, "s ") )
-				{
-					return LineType::SmoothShadingState;
-				}
+				std::vector< index_data_t > faceVertices;
 
-				/* ??? undetermined line */
-				return LineType::Unknown;
-			}
-#else
-		/**
-		 * @brief Determines the type of the OBJ file line.
-		 * @param line The current parsed line.
-		 * @return LineType
-		 */
-		[[nodiscard]]
-		static
-		LineType
-		getLineType (const std::string & line) noexcept
-			{
-				/* # this is a comment */
-				if ( line.starts_with("#") )
+				for ( const auto & chunk : chunks )
 				{
-					return LineType::Comment;
-				}
+					size_t cornerOffset = 0;
+					auto groupFaceIt = chunk.groupFaces.cbegin();
 
-				/* mtllib [external .mtl file name] */
-				if ( line.starts_with("mtllib") )
-				{
-					return LineType::MaterialFile;
-				}
+					for ( size_t faceIndex = 0; faceIndex < chunk.faceSizes.size(); ++faceIndex )
+					{
+						/* NOTE: A group declaration starts a new group, unless the current one is still empty. */
+						for ( ; groupFaceIt != chunk.groupFaces.cend() && *groupFaceIt <= faceIndex; ++groupFaceIt )
+						{
+							if ( groups.back().second > 0 )
+							{
+								groups.emplace_back(static_cast< index_data_t >(triangles.size()), 0);
+							}
+						}
 
-				/* usemtl [material name] */
-				if ( line.starts_with("usemtl") )
-				{
-					return LineType::MaterialState;
-				}
+						const auto faceSize = chunk.faceSizes[faceIndex];
 
-				/* vt 0.500 -1.352 [0.234] */
-				if ( line.starts_with("vt ") )
-				{
-					return LineType::TexCoordValues;
-				}
+						faceVertices.clear();
 
-				/* vn 0.707 0.000 0.707 */
-				if ( line.starts_with("vn ") )
-				{
-					return LineType::NormalValues;
-				}
+						for ( uint32_t cornerIndex = 0; cornerIndex < faceSize; ++cornerIndex )
+						{
+							const auto vertexIndex = getVertex(chunk.corners[cornerOffset + cornerIndex]);
 
-				/* v 0.123 0.234 0.345 1.0 */
-				if ( line.starts_with("v ") )
-				{
-					return LineType::VertexValues;
-				}
+							if ( vertexIndex == NoIndex )
+							{
+								return false;
+							}
 
-				/*
-				f v1 v2 v3 v4
-				f v1/vt1 v2/vt2 v3/vt3
-				f v1/vt1/vn1 v2/vt2/vn2 v3/vt3/vn3
-				f v1//vn1 v2//vn2 v3//vn3
-				*/
-				if ( line.starts_with("f ") )
-				{
-					return LineType::FaceAssembly;
-				}
+							faceVertices.emplace_back(vertexIndex);
+						}
 
-				/* o [object name] */
-				if ( line.starts_with("o ") )
-				{
-					return LineType::ObjectName;
-				}
+						cornerOffset += faceSize;
 
-				/* g [group name] */
-				if ( line.starts_with("g ") )
-				{
-					return LineType::GroupName;
-				}
+						/* NOTE: "f 0 1 2 3" goes into "0 1 2" and "0 2 3". */
+						for ( uint32_t triangleOffset = 1; triangleOffset + 1 < faceSize; ++triangleOffset )
+						{
+							triangles.emplace_back(faceVertices[0], faceVertices[triangleOffset], faceVertices[triangleOffset + 1]);
 
-				/* s 1 OR s off */
-				if ( line.starts_with("s ") )
-				{
-					return LineType::SmoothShadingState;
+							++groups.back().second;
+						}
+					}
 				}
 
-				/* ??? undetermined line */
-				return LineType::Unknown;
+				return true;
 			}
-#endif
-			/* Flag names */
-			static constexpr auto XAxisFlipEnabled{0UL};
-			static constexpr auto YAxisFlipEnabled{1UL};
-			static constexpr auto ZAxisFlipEnabled{2UL};
 
 			std::vector< Math::Vector< 3, vertex_data_t > > m_v;
 			std::vector< Math::Vector< 3, vertex_data_t > > m_vt;
 			std::vector< Math::Vector< 3, vertex_data_t > > m_vn;
-			index_data_t m_vertexCount{0}; /* Combined attributes vertex count. */
-			index_data_t m_faceCount{0};
-			FaceMode m_faceMode{FaceMode::Undetermined};
-			PredominantAttributes m_predominantAttribute{PredominantAttributes::V};
 			ReadOptions m_readOptions{};
+			bool m_usesTextureCoordinates{false};
+			bool m_usesNormals{false};
 	};
 }
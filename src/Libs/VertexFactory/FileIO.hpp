@@ -65,58 +65,69 @@ namespace EmEn::Libs::VertexFactory::FileIO
 
 		const auto extension = IO::getFileExtension(filepath, true);
 
+		bool success = false;
+
 		if ( extension == "emgeo" )
 		{
 			FileFormatNative< vertex_data_t, index_data_t > fileFormat{};
 
-			return fileFormat.readFile(filepath, shape, readOptions);
+			success = fileFormat.readFile(filepath, shape, readOptions);
 		}
-
-		if ( extension == "obj" )
+		else if ( extension == "obj" )
 		{
 			FileFormatOBJ< vertex_data_t, index_data_t > fileFormat{};
 
-			return fileFormat.readFile(filepath, shape, readOptions);
+			success = fileFormat.readFile(filepath, shape, readOptions);
 		}
-
-		if ( extension == "fbx" )
+		else if ( extension == "fbx" )
 		{
 			FileFormatFBX< vertex_data_t, index_data_t > fileFormat{};
 
-			return fileFormat.readFile(filepath, shape, readOptions);
+			success = fileFormat.readFile(filepath, shape, readOptions);
 		}
-
-		if ( extension == "mdl" )
+		else if ( extension == "mdl" )
 		{
 			FileFormatMDL< vertex_data_t, index_data_t > fileFormat{};
 
-			return fileFormat.readFile(filepath, shape, readOptions);
+			success = fileFormat.readFile(filepath, shape, readOptions);
 		}
-
-		if ( extension == "md2" )
+		else if ( extension == "md2" )
 		{
 			FileFormatMD2< vertex_data_t, index_data_t > fileFormat{};
 
-			return fileFormat.readFile(filepath, shape, readOptions);
+			success = fileFormat.readFile(filepath, shape, readOptions);
 		}
-
-		if ( extension == "md3" )
+		else if ( extension == "md3" )
 		{
 			FileFormatMD3< vertex_data_t, index_data_t > fileFormat{};
 
-			return fileFormat.readFile(filepath, shape, readOptions);
+			success = fileFormat.readFile(filepath, shape, readOptions);
 		}
-
-		if ( extension == "md5mesh" )
+		else if ( extension == "md5mesh" )
 		{
 			FileFormatMD5< vertex_data_t, index_data_t > fileFormat{};
 
-			return fileFormat.readFile(filepath, shape, readOptions);
+			success = fileFormat.readFile(filepath, shape, readOptions);
+		}
+		else
+		{
+			std::cerr << "VertexFactory::FileIO::read(), the file '" << filepath << "' format is not handled !" "\n";
+
+			return false;
 		}
 
-		std::cerr << "VertexFactory::FileIO::read(), the file '" << filepath << "' format is not handled !" "\n";
+		if ( success && (readOptions.optimizeVertexCache || readOptions.optimizeOverdraw) )
+		{
+			[[maybe_unused]] const auto [before, after] = shape.optimizeForRendering(readOptions.optimizeOverdraw, readOptions.vertexCacheSize);
 
-		return false;
+			if constexpr ( VertexFactoryDebugEnabled )
+			{
+				std::cout << "VertexFactory::FileIO::read(), '" << filepath << "' vertex cache optimized, "
+					"ACMR " << before.ACMR << " -> " << after.ACMR << ", ATVR " << before.ATVR << " -> " << after.ATVR << "\n";
+			}
+		}
+
+		return success;
 	}
 
 	/**
@@ -146,49 +157,49 @@ namespace EmEn::Libs::VertexFactory::FileIO
 		{
 			FileFormatNative< vertex_data_t, index_data_t > fileFormat{};
 
-			return fileFormat.readFile(filepath, shape);
+			return fileFormat.writeFile(filepath, shape);
 		}
 
 		if ( extension == "obj" )
 		{
 			FileFormatOBJ< vertex_data_t, index_data_t > fileFormat{};
 
-			return fileFormat.readFile(filepath, shape);
+			return fileFormat.writeFile(filepath, shape);
 		}
 
 		if ( extension == "fbx" )
 		{
 			FileFormatFBX< vertex_data_t, index_data_t > fileFormat{};
 
-			return fileFormat.readFile(filepath, shape);
+			return fileFormat.writeFile(filepath, shape);
 		}
 
 		if ( extension == "mdl" )
 		{
 			FileFormatMDL< vertex_data_t, index_data_t > fileFormat{};
 
-			return fileFormat.readFile(filepath, shape);
+			return fileFormat.writeFile(filepath, shape);
 		}
 
 		if ( extension == "md2" )
 		{
 			FileFormatMD2< vertex_data_t, index_data_t > fileFormat{};
 
-			return fileFormat.readFile(filepath, shape);
+			return fileFormat.writeFile(filepath, shape);
 		}
 
 		if ( extension == "md3" )
 		{
 			FileFormatMD3< vertex_data_t, index_data_t > fileFormat{};
 
-			return fileFormat.readFile(filepath, shape);
+			return fileFormat.writeFile(filepath, shape);
 		}
 
 		if ( extension == "md5mesh" )
 		{
 			FileFormatMD5< vertex_data_t, index_data_t > fileFormat{};
 
-			return fileFormat.readFile(filepath, shape);
+			return fileFormat.writeFile(filepath, shape);
 		}
 
 		std::cerr << "VertexFactory::FileIO::write(), the file '" << filepath << "' format is not handled !" "\n";
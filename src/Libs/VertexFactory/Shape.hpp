@@ -40,7 +40,7 @@
 #include <type_traits>
 #include <vector>
 #include <functional>
-#include <set>
+#include <unordered_map>
 
 /* Local inclusions for usages. */
 #include "Libs/Math/Space3D/AACuboid.hpp"
@@ -196,6 +196,8 @@ namespace EmEn::Libs::VertexFactory
 				m_boundingSphere.reset();
 				m_farthestDistance = 0;
 				m_flags[TextureCoordinatesDeclared] = false;
+
+				this->resetLookups();
 			}
 
 			/**
@@ -762,6 +764,8 @@ namespace EmEn::Libs::VertexFactory
 					vertexRef.setNormal((noTranslate * Math::Vector< 4, vertex_data_t >(vertexRef.normal(), 0)).normalize());
 				}
 
+				this->resetLookups();
+
 				/* Updates the invalided bounding box. */
 				if ( updateProperties )
 				{
@@ -770,81 +774,663 @@ namespace EmEn::Libs::VertexFactory
 			}
 
 			/**
-			 * @brief Removes vertices too close to each other under a tolerance value.
-			 * @param vertexDistanceTolerance The distance below which two vertices will be welded.
+			 * @brief Removes vertices with exactly the same attributes, including the vertex color and skinning data.
+			 * @note This runs in linear time with a hash of every vertex attribute. Triangles are remapped to the remaining vertices.
+			 * @return index_data_t The number of removed vertices.
+			 */
+			index_data_t
+			removeDuplicateVertices () noexcept
+			{
+				const auto vertexCount = m_vertices.size();
+
+				if ( vertexCount == 0 )
+				{
+					return 0;
+				}
+
+				const auto vertexColorIndexes = this->getVertexColorIndexes();
+
+				std::vector< index_data_t > remap(vertexCount);
+				std::vector< index_data_t > nextInBucket;
+				std::vector< index_data_t > keptSources;
+				std::vector< ShapeVertex< vertex_data_t > > vertices;
+				std::unordered_map< size_t, index_data_t > buckets;
+
+				nextInBucket.reserve(vertexCount);
+				keptSources.reserve(vertexCount);
+				vertices.reserve(vertexCount);
+				buckets.reserve(vertexCount);
+
+				for ( size_t vertexIndex = 0; vertexIndex < vertexCount; ++vertexIndex )
+				{
+					const auto & vertex = m_vertices[vertexIndex];
+					const auto vertexColor = this->vertexColorOf(vertexColorIndexes[vertexIndex]);
+
+					auto hash = Shape::hashVector(vertex.position());
+					Shape::hashCombine(hash, Shape::hashVector(vertex.tangent()));
+					Shape::hashCombine(hash, Shape::hashVector(vertex.normal()));
+					Shape::hashCombine(hash, Shape::hashVector(vertex.textureCoordinates()));
+					Shape::hashCombine(hash, Shape::hashVector(vertex.weights()));
+					Shape::hashCombine(hash, Shape::hashVector(vertexColor));
+
+					auto bucketIt = buckets.find(hash);
+					auto found = NoIndex;
+
+					if ( bucketIt != buckets.end() )
+					{
+						for ( auto candidate = bucketIt->second; candidate != NoIndex; candidate = nextInBucket[candidate] )
+						{
+							const auto & other = vertices[candidate];
+
+							if ( other.position() == vertex.position() &&
+								other.tangent() == vertex.tangent() &&
+								other.normal() == vertex.normal() &&
+								other.textureCoordinates() == vertex.textureCoordinates() &&
+								other.influences() == vertex.influences() &&
+								other.weights() == vertex.weights() &&
+								this->vertexColorOf(vertexColorIndexes[keptSources[candidate]]) == vertexColor )
+							{
+								found = candidate;
+
+								break;
+							}
+						}
+					}
+
+					if ( found == NoIndex )
+					{
+						found = static_cast< index_data_t >(vertices.size());
+
+						vertices.emplace_back(vertex);
+						keptSources.emplace_back(static_cast< index_data_t >(vertexIndex));
+						nextInBucket.emplace_back(bucketIt != buckets.end() ? bucketIt->second : NoIndex);
+						buckets[hash] = found;
+					}
+
+					remap[vertexIndex] = found;
+				}
+
+				return this->applyVertexRemap(std::move(vertices), remap);
+			}
+
+			/**
+			 * @brief Welds vertices closer than a distance when their other attributes are similar too.
+			 * @note This uses a spatial hash with cells of the tolerance size, so it runs in linear time for a sensible tolerance.
+			 * Each vertex is welded to the first kept vertex matching it. Triangles collapsing after the welding are removed.
+			 * @param positionTolerance The distance below which two vertices positions are considered the same. Zero or less removes exact duplicates only.
+			 * @param normalTolerance The distance below which two vertices normals are considered the same. Default 0.001.
+			 * @param attributeTolerance The distance below which texture coordinates, vertex colors and skinning weights are considered the same. Default 0.0001.
+			 * @return index_data_t The number of removed vertices.
+			 */
+			index_data_t
+			removeDoubleVertices (vertex_data_t positionTolerance, vertex_data_t normalTolerance = static_cast< vertex_data_t >(0.001), vertex_data_t attributeTolerance = static_cast< vertex_data_t >(0.0001)) noexcept
+			{
+				if ( positionTolerance <= 0 )
+				{
+					return this->removeDuplicateVertices();
+				}
+
+				const auto vertexCount = m_vertices.size();
+
+				if ( vertexCount == 0 )
+				{
+					return 0;
+				}
+
+				const auto vertexColorIndexes = this->getVertexColorIndexes();
+				const auto cellSize = positionTolerance;
+				const auto positionToleranceSquared = positionTolerance * positionTolerance;
+				const auto normalToleranceSquared = normalTolerance * normalTolerance;
+				const auto attributeToleranceSquared = attributeTolerance * attributeTolerance;
+
+				std::vector< index_data_t > remap(vertexCount);
+				std::vector< index_data_t > nextInCell;
+				std::vector< index_data_t > keptSources;
+				std::vector< ShapeVertex< vertex_data_t > > vertices;
+				std::unordered_map< uint64_t, index_data_t > cells;
+
+				nextInCell.reserve(vertexCount);
+				keptSources.reserve(vertexCount);
+				vertices.reserve(vertexCount);
+				cells.reserve(vertexCount);
+
+				const auto cellCoordinate = [cellSize] (vertex_data_t value) {
+					return static_cast< int64_t >(std::floor(value / cellSize));
+				};
+
+				for ( size_t vertexIndex = 0; vertexIndex < vertexCount; ++vertexIndex )
+				{
+					const auto & vertex = m_vertices[vertexIndex];
+					const auto & position = vertex.position();
+					const auto vertexColor = this->vertexColorOf(vertexColorIndexes[vertexIndex]);
+
+					const auto cellX = cellCoordinate(position[Math::X]);
+					const auto cellY = cellCoordinate(position[Math::Y]);
+					const auto cellZ = cellCoordinate(position[Math::Z]);
+
+					auto found = NoIndex;
+
+					/* NOTE: A vertex within the tolerance can only be in the same cell or in a direct neighbor. */
+					for ( int64_t offsetZ = -1; offsetZ <= 1 && found == NoIndex; ++offsetZ )
+					{
+						for ( int64_t offsetY = -1; offsetY <= 1 && found == NoIndex; ++offsetY )
+						{
+							for ( int64_t offsetX = -1; offsetX <= 1 && found == NoIndex; ++offsetX )
+							{
+								const auto cellIt = cells.find(Shape::cellKey(cellX + offsetX, cellY + offsetY, cellZ + offsetZ));
+
+								if ( cellIt == cells.end() )
+								{
+									continue;
+								}
+
+								for ( auto candidate = cellIt->second; candidate != NoIndex; candidate = nextInCell[candidate] )
+								{
+									const auto & other = vertices[candidate];
+
+									if ( (other.position() - position).lengthSquared() > positionToleranceSquared ||
+										(other.normal() - vertex.normal()).lengthSquared() > normalToleranceSquared ||
+										(other.textureCoordinates() - vertex.textureCoordinates()).lengthSquared() > attributeToleranceSquared ||
+										(other.weights() - vertex.weights()).lengthSquared() > attributeToleranceSquared ||
+										other.influences() != vertex.influences() )
+									{
+										continue;
+									}
+
+									if ( (this->vertexColorOf(vertexColorIndexes[keptSources[candidate]]) - vertexColor).lengthSquared() > attributeToleranceSquared )
+									{
+										continue;
+									}
+
+									found = candidate;
+
+									break;
+								}
+							}
+						}
+					}
+
+					if ( found == NoIndex )
+					{
+						found = static_cast< index_data_t >(vertices.size());
+
+						auto & head = cells.try_emplace(Shape::cellKey(cellX, cellY, cellZ), NoIndex).first->second;
+
+						vertices.emplace_back(vertex);
+						keptSources.emplace_back(static_cast< index_data_t >(vertexIndex));
+						nextInCell.emplace_back(head);
+
+						head = found;
+					}
+
+					remap[vertexIndex] = found;
+				}
+
+				return this->applyVertexRemap(std::move(vertices), remap);
+			}
+
+			/**
+			 * @brief Simulates a FIFO post-transform vertex cache over the triangle list in its current order.
+			 * @param cacheSize The number of vertices kept by the simulated cache. Default DefaultVertexCacheSize.
+			 * @return VertexCacheStatistics
+			 */
+			[[nodiscard]]
+			VertexCacheStatistics
+			vertexCacheStatistics (uint32_t cacheSize = DefaultVertexCacheSize) const noexcept
+			{
+				VertexCacheStatistics statistics{};
+
+				if ( m_triangles.empty() || cacheSize == 0 )
+				{
+					return statistics;
+				}
+
+				/* NOTE: A vertex is in the FIFO cache while less than 'cacheSize' other vertices were transformed after it. Zero means never transformed. */
+				std::vector< size_t > cacheTimestamps(m_vertices.size(), 0);
+				size_t timestamp = cacheSize + 1;
+				size_t usedVertexCount = 0;
+				size_t transformedVertexCount = 0;
+
+				for ( const auto & triangle : m_triangles )
+				{
+					for ( index_data_t triangleVertexIndex = 0; triangleVertexIndex < 3; ++triangleVertexIndex )
+					{
+						const auto vertexIndex = triangle.vertexIndex(triangleVertexIndex);
+
+						if ( timestamp - cacheTimestamps[vertexIndex] > cacheSize )
+						{
+							if ( cacheTimestamps[vertexIndex] == 0 )
+							{
+								usedVertexCount++;
+							}
+
+							cacheTimestamps[vertexIndex] = timestamp++;
+							transformedVertexCount++;
+						}
+					}
+				}
+
+				statistics.ACMR = static_cast< float >(transformedVertexCount) / static_cast< float >(m_triangles.size());
+				statistics.ATVR = static_cast< float >(transformedVertexCount) / static_cast< float >(usedVertexCount);
+
+				return statistics;
+			}
+
+			/**
+			 * @brief Reorders the triangles of each group for the post-transform vertex cache.
+			 * @note This is the Tipsify algorithm (Sander, Nehab and Barczak, 2007). It runs in linear time and leaves the groups ranges untouched.
+			 * @param cacheSize The number of vertices kept by the targeted cache. Default DefaultVertexCacheSize.
 			 * @return void
 			 */
-			[[deprecated("Not working correctly")]]
 			void
-			removeDoubleVertices (vertex_data_t vertexDistanceTolerance) noexcept
+			optimizeVertexCache (uint32_t cacheSize = DefaultVertexCacheSize) noexcept
 			{
-				/* Gets a copy of the vertices position and clean the vector for replacement. */
-				const std::vector< ShapeVertex< vertex_data_t > > baseVertices(m_vertices);
+				if ( m_triangles.empty() || cacheSize == 0 )
+				{
+					return;
+				}
 
-				m_vertices.clear();
+				/* NOTE: Triangles using each vertex, stored as a compressed list. */
+				std::vector< index_data_t > adjacencyOffsets;
+				std::vector< index_data_t > adjacency;
+
+				this->buildVertexTriangleAdjacency(adjacencyOffsets, adjacency);
+
+				std::vector< index_data_t > liveTriangleCounts(m_vertices.size(), 0);
+				std::vector< size_t > cacheTimestamps(m_vertices.size(), 0);
+				std::vector< bool > emittedTriangles(m_triangles.size(), false);
+				std::vector< index_data_t > deadEndStack;
+				std::vector< index_data_t > candidates;
+				std::vector< index_data_t > order;
+
+				order.reserve(m_triangles.size());
 
-				/* For every old vertex ... */
-				for ( index_data_t baseIndex = 0; baseIndex < baseVertices.size(); ++baseIndex )
+				for ( const auto & group : m_groups )
 				{
-					const auto & baseVertex = baseVertices[baseIndex];
+					const auto first = static_cast< size_t >(group.first);
+					const auto last = std::min(first + group.second, m_triangles.size());
+
+					if ( first >= last )
+					{
+						continue;
+					}
+
+					for ( auto triangleIndex = first; triangleIndex < last; ++triangleIndex )
+					{
+						for ( index_data_t triangleVertexIndex = 0; triangleVertexIndex < 3; ++triangleVertexIndex )
+						{
+							liveTriangleCounts[m_triangles[triangleIndex].vertexIndex(triangleVertexIndex)]++;
+						}
+					}
+
+					/* NOTE: Skips the cache content of the previous group. */
+					size_t timestamp = cacheSize + 1;
+
+					std::ranges::fill(cacheTimestamps, 0);
+
+					deadEndStack.clear();
+					order.clear();
 
-					/* ... We check if we don't found a close position in the new list. */
-					auto found = false;
-					index_data_t newIndex = 0;
+					/* NOTE: Scanning position in the group vertex references, used when the dead-end stack is exhausted. */
+					auto scanCursor = first * 3;
+					auto fanningVertex = m_triangles[first].vertexIndex(0);
 
-					for ( const auto & vertexRef : m_vertices )
+					while ( fanningVertex != NoIndex )
 					{
-						if ( Math::Vector< 3, vertex_data_t >::distance(baseVertex.position(), vertexRef.position()) < vertexDistanceTolerance )
+						candidates.clear();
+
+						/* Emits every remaining triangle of the group around the fanning vertex. */
+						for ( auto adjacencyIndex = adjacencyOffsets[fanningVertex]; adjacencyIndex < adjacencyOffsets[fanningVertex + 1]; ++adjacencyIndex )
+						{
+							const auto triangleIndex = adjacency[adjacencyIndex];
+
+							if ( triangleIndex < first || triangleIndex >= last || emittedTriangles[triangleIndex] )
+							{
+								continue;
+							}
+
+							emittedTriangles[triangleIndex] = true;
+							order.emplace_back(triangleIndex);
+
+							for ( index_data_t triangleVertexIndex = 0; triangleVertexIndex < 3; ++triangleVertexIndex )
+							{
+								const auto vertexIndex = m_triangles[triangleIndex].vertexIndex(triangleVertexIndex);
+
+								deadEndStack.emplace_back(vertexIndex);
+								candidates.emplace_back(vertexIndex);
+
+								liveTriangleCounts[vertexIndex]--;
+
+								if ( timestamp - cacheTimestamps[vertexIndex] > cacheSize )
+								{
+									cacheTimestamps[vertexIndex] = timestamp++;
+								}
+							}
+						}
+
+						/* Selects the candidate staying the longest in the cache once its remaining triangles are emitted. */
+						fanningVertex = NoIndex;
+						size_t bestPriority = 0;
+
+						for ( const auto vertexIndex : candidates )
+						{
+							if ( liveTriangleCounts[vertexIndex] == 0 )
+							{
+								continue;
+							}
+
+							size_t priority = 0;
+
+							if ( timestamp - cacheTimestamps[vertexIndex] + 2 * liveTriangleCounts[vertexIndex] <= cacheSize )
+							{
+								priority = timestamp - cacheTimestamps[vertexIndex];
+							}
+
+							if ( fanningVertex == NoIndex || priority > bestPriority )
+							{
+								bestPriority = priority;
+								fanningVertex = vertexIndex;
+							}
+						}
+
+						if ( fanningVertex != NoIndex )
 						{
-							found = true;
+							continue;
+						}
 
-							break;
+						/* Dead-end, first tries the recently used vertices, then the next vertex in input order. */
+						while ( !deadEndStack.empty() && fanningVertex == NoIndex )
+						{
+							const auto vertexIndex = deadEndStack.back();
+
+							deadEndStack.pop_back();
+
+							if ( liveTriangleCounts[vertexIndex] > 0 )
+							{
+								fanningVertex = vertexIndex;
+							}
 						}
 
-						++newIndex;
+						while ( scanCursor < last * 3 && fanningVertex == NoIndex )
+						{
+							const auto vertexIndex = m_triangles[scanCursor / 3].vertexIndex(static_cast< index_data_t >(scanCursor % 3));
+
+							scanCursor++;
+
+							if ( liveTriangleCounts[vertexIndex] > 0 )
+							{
+								fanningVertex = vertexIndex;
+							}
+						}
 					}
 
-					/* If not found, we put the new vertex position. */
-					if ( !found )
+					this->reorderTriangles(first, order);
+				}
+			}
+
+			/**
+			 * @brief Reorders clusters of triangles of each group to draw first the ones facing outward, reducing overdraw from any point of view.
+			 * @note The triangle order should be optimized for the vertex cache before. The clusters are cut where the cache restarts,
+			 * then where the cluster cache efficiency becomes close enough to the whole one, so most of the vertex cache gain is kept.
+			 * @param cacheSize The number of vertices kept by the targeted cache. Default DefaultVertexCacheSize.
+			 * @param threshold The accepted cache miss ratio degradation. Default 1.05.
+			 * @return void
+			 */
+			void
+			optimizeOverdraw (uint32_t cacheSize = DefaultVertexCacheSize, float threshold = 1.05F) noexcept
+			{
+				if ( m_triangles.empty() || cacheSize == 0 )
+				{
+					return;
+				}
+
+				std::vector< size_t > cacheTimestamps(m_vertices.size(), 0);
+				size_t timestamp = cacheSize + 1;
+
+				/* NOTE: Returns the number of vertices transformed for a triangle. */
+				const auto simulate = [&] (size_t triangleIndex) {
+					size_t misses = 0;
+
+					for ( index_data_t triangleVertexIndex = 0; triangleVertexIndex < 3; ++triangleVertexIndex )
 					{
-						m_vertices.emplace_back(baseVertex);
+						const auto vertexIndex = m_triangles[triangleIndex].vertexIndex(triangleVertexIndex);
 
-						newIndex = static_cast< index_data_t >(m_vertices.size() - 1);
+						if ( timestamp - cacheTimestamps[vertexIndex] > cacheSize )
+						{
+							cacheTimestamps[vertexIndex] = timestamp++;
+							misses++;
+						}
 					}
 
-					/* Ne replacement requested. */
-					if ( baseIndex == newIndex )
+					return misses;
+				};
+
+				const auto flushCache = [&] () {
+					timestamp += cacheSize + 1;
+				};
+
+				std::vector< size_t > hardBoundaries;
+				std::vector< size_t > clusterBoundaries;
+				std::vector< std::pair< vertex_data_t, size_t > > clusters;
+				std::vector< index_data_t > order;
+
+				for ( const auto & group : m_groups )
+				{
+					const auto first = static_cast< size_t >(group.first);
+					const auto last = std::min(first + group.second, m_triangles.size());
+
+					if ( first >= last || last - first < 2 )
 					{
 						continue;
 					}
 
-					/* We processLogics every face index for vertices position. */
-					for ( auto & triangle : m_triangles )
+					/* 1. Hard boundaries, where the three vertices of a triangle are transformed again. */
+					hardBoundaries.clear();
+					flushCache();
+
+					for ( auto triangleIndex = first; triangleIndex < last; ++triangleIndex )
 					{
-						for ( index_data_t vertexIndex = 0; vertexIndex < 3; ++vertexIndex )
+						if ( simulate(triangleIndex) == 3 )
+						{
+							hardBoundaries.emplace_back(triangleIndex);
+						}
+					}
+
+					hardBoundaries.emplace_back(last);
+
+					/* 2. Soft boundaries, where the cluster is as cache efficient as the whole hard cluster. */
+					clusterBoundaries.clear();
+
+					for ( size_t hardIndex = 0; hardIndex + 1 < hardBoundaries.size(); ++hardIndex )
+					{
+						const auto hardFirst = hardBoundaries[hardIndex];
+						const auto hardLast = hardBoundaries[hardIndex + 1];
+
+						size_t hardMisses = 0;
+
+						flushCache();
+
+						for ( auto triangleIndex = hardFirst; triangleIndex < hardLast; ++triangleIndex )
 						{
-							if ( triangle.vertexIndex(vertexIndex) == baseIndex )
+							hardMisses += simulate(triangleIndex);
+						}
+
+						const auto targetACMR = threshold * static_cast< float >(hardMisses) / static_cast< float >(hardLast - hardFirst);
+
+						auto clusterFirst = hardFirst;
+						size_t clusterMisses = 0;
+
+						clusterBoundaries.emplace_back(hardFirst);
+						flushCache();
+
+						for ( auto triangleIndex = hardFirst; triangleIndex < hardLast; ++triangleIndex )
+						{
+							clusterMisses += simulate(triangleIndex);
+
+							if ( triangleIndex + 1 < hardLast && static_cast< float >(clusterMisses) <= targetACMR * static_cast< float >(triangleIndex + 1 - clusterFirst) )
 							{
-								triangle.setVertexIndex(vertexIndex, newIndex);
+								clusterFirst = triangleIndex + 1;
+								clusterMisses = 0;
+
+								clusterBoundaries.emplace_back(clusterFirst);
+								flushCache();
 							}
 						}
 					}
+
+					clusterBoundaries.emplace_back(last);
+
+					/* 3. Sorts the clusters by how much they face outward from the group centroid. */
+					const auto groupCentroid = this->computeTrianglesCentroid(first, last);
+
+					clusters.clear();
+
+					for ( size_t clusterIndex = 0; clusterIndex + 1 < clusterBoundaries.size(); ++clusterIndex )
+					{
+						const auto clusterFirst = clusterBoundaries[clusterIndex];
+						const auto clusterLast = clusterBoundaries[clusterIndex + 1];
+
+						Math::Vector< 3, vertex_data_t > clusterNormal{};
+
+						for ( auto triangleIndex = clusterFirst; triangleIndex < clusterLast; ++triangleIndex )
+						{
+							clusterNormal += this->triangleAreaNormal(triangleIndex);
+						}
+
+						const auto direction = this->computeTrianglesCentroid(clusterFirst, clusterLast) - groupCentroid;
+
+						clusters.emplace_back(Math::Vector< 3, vertex_data_t >::dotProduct(direction, clusterNormal.normalize()), clusterIndex);
+					}
+
+					std::ranges::stable_sort(clusters, [] (const auto & clusterA, const auto & clusterB) {
+						return clusterA.first > clusterB.first;
+					});
+
+					order.clear();
+
+					for ( const auto & cluster : clusters )
+					{
+						for ( auto triangleIndex = clusterBoundaries[cluster.second]; triangleIndex < clusterBoundaries[cluster.second + 1]; ++triangleIndex )
+						{
+							order.emplace_back(static_cast< index_data_t >(triangleIndex));
+						}
+					}
+
+					this->reorderTriangles(first, order);
+				}
+			}
+
+			/**
+			 * @brief Reorders the vertices in the order of their first use by the triangles, for the vertex fetch locality. Unused vertices are removed.
+			 * @note This should be done after reordering the triangles.
+			 * @return index_data_t The number of removed vertices.
+			 */
+			index_data_t
+			optimizeVertexFetch () noexcept
+			{
+				if ( m_vertices.empty() )
+				{
+					return 0;
 				}
 
-				/* Removes invalid triangles. */
-				auto triangleIt = m_triangles.begin();
+				std::vector< index_data_t > remap(m_vertices.size(), NoIndex);
+				std::vector< ShapeVertex< vertex_data_t > > vertices;
 
-				while ( triangleIt != m_triangles.end() )
+				vertices.reserve(m_vertices.size());
+
+				for ( const auto & triangle : m_triangles )
 				{
-					if ( (*triangleIt).vertexIndex(0) == (*triangleIt).vertexIndex(1) || (*triangleIt).vertexIndex(0) == (*triangleIt).vertexIndex(2) || (*triangleIt).vertexIndex(1) == (*triangleIt).vertexIndex(2) )
+					for ( index_data_t triangleVertexIndex = 0; triangleVertexIndex < 3; ++triangleVertexIndex )
 					{
-						triangleIt = m_triangles.erase(triangleIt);
+						const auto vertexIndex = triangle.vertexIndex(triangleVertexIndex);
+
+						if ( remap[vertexIndex] == NoIndex )
+						{
+							remap[vertexIndex] = static_cast< index_data_t >(vertices.size());
+
+							vertices.emplace_back(m_vertices[vertexIndex]);
+						}
 					}
-					else
+				}
+
+				return this->applyVertexRemap(std::move(vertices), remap);
+			}
+
+			/**
+			 * @brief Merges vertices into other ones. Triangles collapsing after the merge are removed and groups are updated.
+			 * @note This is the common ending of the simplification algorithms working with vertex collapses.
+			 * @param targets A reference to the vertex index each vertex is merged into, itself to keep it. Chains of merges are followed.
+			 * @return index_data_t The number of removed vertices.
+			 */
+			index_data_t
+			mergeVertices (const std::vector< index_data_t > & targets) noexcept
+			{
+				if ( targets.size() != m_vertices.size() )
+				{
+					std::cerr << __PRETTY_FUNCTION__ << ", the merge targets count (" << targets.size() << ") differs from the vertex count (" << m_vertices.size() << ") !" "\n";
+
+					return 0;
+				}
+
+				std::vector< index_data_t > remap(m_vertices.size(), NoIndex);
+				std::vector< ShapeVertex< vertex_data_t > > vertices;
+
+				vertices.reserve(m_vertices.size());
+
+				for ( size_t vertexIndex = 0; vertexIndex < m_vertices.size(); ++vertexIndex )
+				{
+					if ( targets[vertexIndex] == vertexIndex )
+					{
+						remap[vertexIndex] = static_cast< index_data_t >(vertices.size());
+
+						vertices.emplace_back(m_vertices[vertexIndex]);
+					}
+				}
+
+				for ( size_t vertexIndex = 0; vertexIndex < m_vertices.size(); ++vertexIndex )
+				{
+					/* NOTE: Follows the chain to the kept vertex, the length is bounded to ignore a malformed cycle. */
+					auto target = static_cast< index_data_t >(vertexIndex);
+
+					for ( size_t step = 0; step < m_vertices.size() && targets[target] != target; ++step )
 					{
-						++triangleIt;
+						target = targets[target];
 					}
+
+					if ( remap[target] == NoIndex )
+					{
+						std::cerr << __PRETTY_FUNCTION__ << ", the vertex #" << vertexIndex << " is not merged into a kept vertex !" "\n";
+
+						return 0;
+					}
+
+					remap[vertexIndex] = remap[target];
+				}
+
+				return this->applyVertexRemap(std::move(vertices), remap);
+			}
+
+			/**
+			 * @brief Runs the vertex cache optimization, optionally the overdraw one, then the vertex fetch optimization.
+			 * @param reduceOverdraw Enable the triangle clusters sorting against the overdraw.
+			 * @param cacheSize The number of vertices kept by the targeted cache. Default DefaultVertexCacheSize.
+			 * @return std::pair< VertexCacheStatistics, VertexCacheStatistics > The statistics before and after the optimization.
+			 */
+			std::pair< VertexCacheStatistics, VertexCacheStatistics >
+			optimizeForRendering (bool reduceOverdraw, uint32_t cacheSize = DefaultVertexCacheSize) noexcept
+			{
+				const auto before = this->vertexCacheStatistics(cacheSize);
+
+				this->optimizeVertexCache(cacheSize);
+
+				if ( reduceOverdraw )
+				{
+					this->optimizeOverdraw(cacheSize);
 				}
+
+				this->optimizeVertexFetch();
+
+				return {before, this->vertexCacheStatistics(cacheSize)};
 			}
 
 			/**
@@ -866,6 +1452,8 @@ namespace EmEn::Libs::VertexFactory
 						triangle.setVertexColorIndex(vertexIndex, 0);
 					}
 				}
+
+				this->resetLookups();
 			}
 
 			/**
@@ -895,6 +1483,8 @@ namespace EmEn::Libs::VertexFactory
 				{
 					triangle.flip();
 				}
+
+				this->resetLookups();
 			}
 
 			/**
@@ -913,6 +1503,8 @@ namespace EmEn::Libs::VertexFactory
 				{
 					triangle.flipYAxis();
 				}
+
+				this->resetLookups();
 			}
 
 			/**
@@ -940,6 +1532,32 @@ namespace EmEn::Libs::VertexFactory
 				return true;
 			}
 
+			/**
+			 * @brief Builds a shape using a function giving access to shape data, vertex colors included.
+			 * @note The triangles must refer to the vertex color list through ShapeTriangle::setVertexColorIndex().
+			 * @param buildFunction A reference to a function.
+			 * @param textureCoordinatesDeclared Set if texture coordinates will be set during the build.
+			 * @param computeEdges Declares if edges must be calculated. Default false.
+			 * @return bool
+			 */
+			bool
+			buildWithVertexColors (const std::function< bool (std::vector< std::pair< index_data_t, index_data_t > > &, std::vector< ShapeVertex< vertex_data_t > > &, std::vector< Math::Vector< 4, vertex_data_t > > &, std::vector< ShapeTriangle< vertex_data_t, index_data_t > > &) > & buildFunction, bool textureCoordinatesDeclared, bool computeEdges = false) noexcept
+			{
+				this->clear();
+
+				m_flags[TextureCoordinatesDeclared] = textureCoordinatesDeclared;
+				m_flags[ComputeEdges] = computeEdges;
+
+				if ( !buildFunction(m_groups, m_vertices, m_vertexColors, m_triangles) )
+				{
+					return false;
+				}
+
+				this->updateProperties();
+
+				return true;
+			}
+
 			/**
 			 * @brief Creates an indexed vertex buffer.
 			 * @note Returns the element count in one vertex.
@@ -1081,7 +1699,7 @@ namespace EmEn::Libs::VertexFactory
 			createIndexedVertexBuffer (std::vector< vertex_data_t > & vertexBuffer, std::vector< index_data_t > & indexBuffer, NormalType normalType = NormalType::None, TextureCoordinatesType textureCoordinatesType = TextureCoordinatesType::None, VertexColorType vertexColorType = VertexColorType::None, SkeletalAnimationType skeletalAnimationType = SkeletalAnimationType::None) const noexcept
 			{
 				/* NOTE: Keep track of vertex already used. */
-				std::set< index_data_t > shapeVertexIndicesDone{};
+				std::vector< bool > shapeVertexIndicesDone(m_vertices.size(), false);
 
 				const auto vertexElementCount = getVertexElementCount(normalType, textureCoordinatesType, vertexColorType, skeletalAnimationType);
 
@@ -1100,12 +1718,14 @@ namespace EmEn::Libs::VertexFactory
 						indexBuffer[indexBufferOffset++] = shapeVertexIndex;
 
 						/* NOTE: Skip the vertex index already done. */
-						if ( shapeVertexIndicesDone.contains(shapeVertexIndex) )
+						if ( shapeVertexIndicesDone[shapeVertexIndex] )
 						{
 							continue;
 						}
 
-						const auto & vertex = m_vertices.at(shapeVertexIndex);
+						shapeVertexIndicesDone[shapeVertexIndex] = true;
+
+						const auto & vertex = m_vertices[shapeVertexIndex];
 
 						index_data_t vertexBufferOffset = vertexElementCount * shapeVertexIndex;
 
@@ -1198,8 +1818,6 @@ namespace EmEn::Libs::VertexFactory
 							default:
 								break;
 						}
-
-						shapeVertexIndicesDone.emplace(shapeVertexIndex);
 					}
 				}
 
@@ -1233,16 +1851,13 @@ namespace EmEn::Libs::VertexFactory
 			index_data_t
 			addVertex (const Math::Vector< 3, vertex_data_t > & position) noexcept
 			{
-				index_data_t offset = 0;
+				const auto offset = this->findVertex(position, [] (const ShapeVertex< vertex_data_t > &) {
+					return true;
+				});
 
-				for ( const auto & vertexRef : m_vertices )
+				if ( offset != NoIndex )
 				{
-					if ( vertexRef.position() == position )
-					{
-						return offset;
-					}
-
-					++offset;
+					return offset;
 				}
 
 				return this->saveVertex(position, {}, {});
@@ -1258,16 +1873,13 @@ namespace EmEn::Libs::VertexFactory
 			index_data_t
 			addVertex (const Math::Vector< 3, vertex_data_t > & position, const Math::Vector< 3, vertex_data_t > & normal) noexcept
 			{
-				index_data_t offset = 0;
+				const auto offset = this->findVertex(position, [&normal] (const ShapeVertex< vertex_data_t > & vertex) {
+					return vertex.normal() == normal;
+				});
 
-				for ( const auto & vertexRef : m_vertices )
+				if ( offset != NoIndex )
 				{
-					if ( vertexRef.position() == position && vertexRef.normal() == normal )
-					{
-						return offset;
-					}
-
-					++offset;
+					return offset;
 				}
 
 				return this->saveVertex(position, normal, {});
@@ -1284,16 +1896,13 @@ namespace EmEn::Libs::VertexFactory
 			index_data_t
 			addVertex (const Math::Vector< 3, vertex_data_t > & position, const Math::Vector< 3, vertex_data_t > & normal, const Math::Vector< 3, vertex_data_t > & textureCoordinates) noexcept
 			{
-				index_data_t offset = 0;
+				const auto offset = this->findVertex(position, [&normal, &textureCoordinates] (const ShapeVertex< vertex_data_t > & vertex) {
+					return vertex.normal() == normal && vertex.textureCoordinates() == textureCoordinates;
+				});
 
-				for ( const auto & vertexRef : m_vertices )
+				if ( offset != NoIndex )
 				{
-					if ( vertexRef.position() == position && vertexRef.normal() == normal && vertexRef.textureCoordinates() == textureCoordinates )
-					{
-						return offset;
-					}
-
-					++offset;
+					return offset;
 				}
 
 				return this->saveVertex(position, normal, textureCoordinates);
@@ -1308,16 +1917,35 @@ namespace EmEn::Libs::VertexFactory
 			index_data_t
 			addVertexColor (const Math::Vector< 4, vertex_data_t > & color) noexcept
 			{
-				index_data_t offset = 0;
+				/* Indexes the vertex colors saved since the last lookup. */
+				for ( auto colorIndex = m_vertexColorBucketChains.size(); colorIndex < m_vertexColors.size(); ++colorIndex )
+				{
+					auto & head = m_vertexColorBuckets.try_emplace(Shape::hashVector(m_vertexColors[colorIndex]), NoIndex).first->second;
+
+					m_vertexColorBucketChains.emplace_back(head);
 
-				for ( const auto & existingColor : m_vertexColors )
+					head = static_cast< index_data_t >(colorIndex);
+				}
+
+				const auto bucketIt = m_vertexColorBuckets.find(Shape::hashVector(color));
+
+				if ( bucketIt != m_vertexColorBuckets.end() )
 				{
-					if ( existingColor == color )
+					auto offset = NoIndex;
+
+					/* NOTE: The chain goes from the latest color to the oldest one, the lowest index is kept. */
+					for ( auto candidate = bucketIt->second; candidate != NoIndex; candidate = m_vertexColorBucketChains[candidate] )
 					{
-						return offset;
+						if ( m_vertexColors[candidate] == color )
+						{
+							offset = candidate;
+						}
 					}
 
-					++offset;
+					if ( offset != NoIndex )
+					{
+						return offset;
+					}
 				}
 
 				return this->saveVertexColor(color);
@@ -1521,24 +2149,25 @@ namespace EmEn::Libs::VertexFactory
 				/* Checks for shared edge. */
 				auto sharedIndex = std::numeric_limits< index_data_t >::max();
 
-				index_data_t offset = 0;
+				const auto edgeKey = vertexIndexA < vertexIndexB ?
+					(static_cast< uint64_t >(vertexIndexA) << 32) | vertexIndexB :
+					(static_cast< uint64_t >(vertexIndexB) << 32) | vertexIndexA;
 
-				for ( const auto & edge : m_edges )
-				{
-					if ( edge.same(vertexIndexA, vertexIndexB) )
-					{
-						sharedIndex = offset;
+				const auto edgeIt = m_edgeLookup.find(edgeKey);
 
-						/* Checks if the edge is alone, otherwise it's an error. */
-						if ( edge.isShared() )
-						{
-							return std::numeric_limits< index_data_t >::max();
-						}
+				if ( edgeIt != m_edgeLookup.end() )
+				{
+					sharedIndex = edgeIt->second;
 
-						break;
+					/* Checks if the edge is alone, otherwise it's an error. */
+					if ( m_edges[sharedIndex].isShared() )
+					{
+						return std::numeric_limits< index_data_t >::max();
 					}
-
-					++offset;
+				}
+				else
+				{
+					m_edgeLookup.emplace(edgeKey, static_cast< index_data_t >(m_edges.size()));
 				}
 
 				/* Insert the new edge. */
@@ -1559,6 +2188,342 @@ namespace EmEn::Libs::VertexFactory
 				return newEdgeIndex;
 			}
 
+			/**
+			 * @brief Returns the index of the first vertex at a position and accepted by a predicate.
+			 * @tparam predicate_t The type of the predicate.
+			 * @param position A reference to the position.
+			 * @param predicate A reference to a function checking the other vertex attributes.
+			 * @return index_data_t NoIndex if not found.
+			 */
+			template< typename predicate_t >
+			index_data_t
+			findVertex (const Math::Vector< 3, vertex_data_t > & position, const predicate_t & predicate) noexcept
+			{
+				/* Indexes the vertices saved since the last lookup. */
+				for ( auto vertexIndex = m_vertexBucketChains.size(); vertexIndex < m_vertices.size(); ++vertexIndex )
+				{
+					auto & head = m_vertexBuckets.try_emplace(Shape::hashVector(m_vertices[vertexIndex].position()), NoIndex).first->second;
+
+					m_vertexBucketChains.emplace_back(head);
+
+					head = static_cast< index_data_t >(vertexIndex);
+				}
+
+				const auto bucketIt = m_vertexBuckets.find(Shape::hashVector(position));
+
+				if ( bucketIt == m_vertexBuckets.end() )
+				{
+					return NoIndex;
+				}
+
+				auto offset = NoIndex;
+
+				/* NOTE: The chain goes from the latest vertex to the oldest one, the lowest index is kept. */
+				for ( auto candidate = bucketIt->second; candidate != NoIndex; candidate = m_vertexBucketChains[candidate] )
+				{
+					const auto & vertex = m_vertices[candidate];
+
+					if ( vertex.position() == position && predicate(vertex) )
+					{
+						offset = candidate;
+					}
+				}
+
+				return offset;
+			}
+
+			/**
+			 * @brief Clears the lookups used to find existing vertices, vertex colors and edges.
+			 * @note This must be called when these data are modified in place.
+			 * @return void
+			 */
+			void
+			resetLookups () noexcept
+			{
+				m_vertexBuckets.clear();
+				m_vertexBucketChains.clear();
+				m_vertexColorBuckets.clear();
+				m_vertexColorBucketChains.clear();
+				m_edgeLookup.clear();
+			}
+
+			/**
+			 * @brief Returns for every vertex the vertex color index of the first triangle using it.
+			 * @note This is the vertex color written by createIndexedVertexBuffer().
+			 * @return std::vector< index_data_t >
+			 */
+			[[nodiscard]]
+			std::vector< index_data_t >
+			getVertexColorIndexes () const noexcept
+			{
+				std::vector< index_data_t > vertexColorIndexes(m_vertices.size(), NoIndex);
+
+				if ( m_vertexColors.empty() )
+				{
+					return vertexColorIndexes;
+				}
+
+				for ( const auto & triangle : m_triangles )
+				{
+					for ( index_data_t triangleVertexIndex = 0; triangleVertexIndex < 3; ++triangleVertexIndex )
+					{
+						auto & vertexColorIndex = vertexColorIndexes[triangle.vertexIndex(triangleVertexIndex)];
+
+						if ( vertexColorIndex == NoIndex )
+						{
+							vertexColorIndex = triangle.vertexColorIndex(triangleVertexIndex);
+						}
+					}
+				}
+
+				return vertexColorIndexes;
+			}
+
+			/**
+			 * @brief Returns a vertex color or a transparent black if the index is invalid.
+			 * @param vertexColorIndex The index in the vertex colors list.
+			 * @return Math::Vector< 4, vertex_data_t >
+			 */
+			[[nodiscard]]
+			Math::Vector< 4, vertex_data_t >
+			vertexColorOf (index_data_t vertexColorIndex) const noexcept
+			{
+				if ( vertexColorIndex >= m_vertexColors.size() )
+				{
+					return {};
+				}
+
+				return m_vertexColors[vertexColorIndex];
+			}
+
+			/**
+			 * @brief Replaces the vertices list and remaps the triangles. Collapsed triangles are removed and groups are updated.
+			 * @param vertices The new vertices list.
+			 * @param remap A reference to the new vertex index for every previous vertex.
+			 * @return index_data_t The number of removed vertices.
+			 */
+			index_data_t
+			applyVertexRemap (std::vector< ShapeVertex< vertex_data_t > > && vertices, const std::vector< index_data_t > & remap) noexcept
+			{
+				const auto removedVertexCount = static_cast< index_data_t >(m_vertices.size() - vertices.size());
+				const auto triangleCount = m_triangles.size();
+
+				m_vertices = std::move(vertices);
+
+				/* NOTE: Number of kept triangles before each triangle, to move the groups. */
+				std::vector< size_t > keptTriangleCounts(triangleCount + 1, 0);
+				size_t keptTriangleCount = 0;
+
+				for ( size_t triangleIndex = 0; triangleIndex < triangleCount; ++triangleIndex )
+				{
+					keptTriangleCounts[triangleIndex] = keptTriangleCount;
+
+					auto triangle = m_triangles[triangleIndex];
+
+					for ( index_data_t triangleVertexIndex = 0; triangleVertexIndex < 3; ++triangleVertexIndex )
+					{
+						triangle.setVertexIndex(triangleVertexIndex, remap[triangle.vertexIndex(triangleVertexIndex)]);
+					}
+
+					if ( triangle.vertexIndex(0) == triangle.vertexIndex(1) || triangle.vertexIndex(0) == triangle.vertexIndex(2) || triangle.vertexIndex(1) == triangle.vertexIndex(2) )
+					{
+						continue;
+					}
+
+					m_triangles[keptTriangleCount++] = triangle;
+				}
+
+				keptTriangleCounts[triangleCount] = keptTriangleCount;
+
+				m_triangles.resize(keptTriangleCount);
+
+				for ( auto & group : m_groups )
+				{
+					const auto first = std::min< size_t >(group.first, triangleCount);
+					const auto last = std::min< size_t >(static_cast< size_t >(group.first) + group.second, triangleCount);
+
+					group.first = static_cast< index_data_t >(keptTriangleCounts[first]);
+					group.second = static_cast< index_data_t >(keptTriangleCounts[last] - keptTriangleCounts[first]);
+				}
+
+				this->resetLookups();
+
+				/* NOTE: Edges refer to vertex indexes, they are rebuilt if they were used. */
+				if ( !m_edges.empty() )
+				{
+					m_edges.clear();
+
+					for ( auto & triangle : m_triangles )
+					{
+						triangle.setEdgeIndex(0, this->addEdge(triangle.vertexIndex(0), triangle.vertexIndex(1)));
+						triangle.setEdgeIndex(1, this->addEdge(triangle.vertexIndex(1), triangle.vertexIndex(2)));
+						triangle.setEdgeIndex(2, this->addEdge(triangle.vertexIndex(2), triangle.vertexIndex(0)));
+					}
+				}
+
+				this->updateProperties();
+
+				return removedVertexCount;
+			}
+
+			/**
+			 * @brief Builds the list of triangles using each vertex.
+			 * @param offsets A reference to a vector for the first adjacency entry of each vertex, plus the end.
+			 * @param adjacency A reference to a vector for the triangle indexes.
+			 * @return void
+			 */
+			void
+			buildVertexTriangleAdjacency (std::vector< index_data_t > & offsets, std::vector< index_data_t > & adjacency) const noexcept
+			{
+				offsets.assign(m_vertices.size() + 1, 0);
+				adjacency.resize(m_triangles.size() * 3);
+
+				for ( const auto & triangle : m_triangles )
+				{
+					for ( index_data_t triangleVertexIndex = 0; triangleVertexIndex < 3; ++triangleVertexIndex )
+					{
+						offsets[triangle.vertexIndex(triangleVertexIndex) + 1]++;
+					}
+				}
+
+				for ( size_t vertexIndex = 0; vertexIndex < m_vertices.size(); ++vertexIndex )
+				{
+					offsets[vertexIndex + 1] += offsets[vertexIndex];
+				}
+
+				/* NOTE: Uses a copy of the offsets as writing cursors. */
+				auto cursors = offsets;
+
+				for ( size_t triangleIndex = 0; triangleIndex < m_triangles.size(); ++triangleIndex )
+				{
+					for ( index_data_t triangleVertexIndex = 0; triangleVertexIndex < 3; ++triangleVertexIndex )
+					{
+						adjacency[cursors[m_triangles[triangleIndex].vertexIndex(triangleVertexIndex)]++] = static_cast< index_data_t >(triangleIndex);
+					}
+				}
+			}
+
+			/**
+			 * @brief Rewrites a range of triangles in a new order.
+			 * @param first The index of the first triangle of the range.
+			 * @param order A reference to the triangle indexes in their new order, covering the whole range.
+			 * @return void
+			 */
+			void
+			reorderTriangles (size_t first, const std::vector< index_data_t > & order) noexcept
+			{
+				std::vector< ShapeTriangle< vertex_data_t, index_data_t > > triangles;
+				triangles.reserve(order.size());
+
+				for ( const auto triangleIndex : order )
+				{
+					triangles.emplace_back(m_triangles[triangleIndex]);
+				}
+
+				std::ranges::copy(triangles, m_triangles.begin() + static_cast< std::ptrdiff_t >(first));
+			}
+
+			/**
+			 * @brief Returns the triangle normal scaled by twice its area.
+			 * @param triangleIndex The index of the triangle.
+			 * @return Math::Vector< 3, vertex_data_t >
+			 */
+			[[nodiscard]]
+			Math::Vector< 3, vertex_data_t >
+			triangleAreaNormal (size_t triangleIndex) const noexcept
+			{
+				const auto & triangle = m_triangles[triangleIndex];
+				const auto & positionA = m_vertices[triangle.vertexIndex(0)].position();
+
+				return Math::Vector< 3, vertex_data_t >::crossProduct(
+					m_vertices[triangle.vertexIndex(1)].position() - positionA,
+					m_vertices[triangle.vertexIndex(2)].position() - positionA
+				);
+			}
+
+			/**
+			 * @brief Returns the area weighted centroid of a range of triangles.
+			 * @param first The index of the first triangle.
+			 * @param last The index after the last triangle.
+			 * @return Math::Vector< 3, vertex_data_t >
+			 */
+			[[nodiscard]]
+			Math::Vector< 3, vertex_data_t >
+			computeTrianglesCentroid (size_t first, size_t last) const noexcept
+			{
+				Math::Vector< 3, vertex_data_t > centroid{};
+				vertex_data_t totalArea = 0;
+
+				for ( auto triangleIndex = first; triangleIndex < last; ++triangleIndex )
+				{
+					const auto & triangle = m_triangles[triangleIndex];
+					const auto area = this->triangleAreaNormal(triangleIndex).length();
+
+					centroid += (m_vertices[triangle.vertexIndex(0)].position() + m_vertices[triangle.vertexIndex(1)].position() + m_vertices[triangle.vertexIndex(2)].position()) * (area / 3);
+					totalArea += area;
+				}
+
+				if ( totalArea <= 0 )
+				{
+					return centroid;
+				}
+
+				return centroid / totalArea;
+			}
+
+			/**
+			 * @brief Combines a hash value into a seed.
+			 * @param seed A reference to the seed.
+			 * @param value The hash value to combine.
+			 * @return void
+			 */
+			static
+			void
+			hashCombine (size_t & seed, size_t value) noexcept
+			{
+				seed ^= value + 0x9E3779B97F4A7C15ULL + (seed << 6) + (seed >> 2);
+			}
+
+			/**
+			 * @brief Returns the hash of a vector.
+			 * @tparam vec_dim_t The dimension of the vector.
+			 * @param vector A reference to a vector.
+			 * @return size_t
+			 */
+			template< size_t vec_dim_t >
+			[[nodiscard]]
+			static
+			size_t
+			hashVector (const Math::Vector< vec_dim_t, vertex_data_t > & vector) noexcept
+			{
+				size_t hash = 0;
+
+				for ( size_t index = 0; index < vec_dim_t; ++index )
+				{
+					Shape::hashCombine(hash, std::hash< vertex_data_t >{}(vector[index]));
+				}
+
+				return hash;
+			}
+
+			/**
+			 * @brief Returns the key of a spatial hash cell.
+			 * @note Coordinates are wrapped to 21 bits, a wrapped cell only brings more candidates to check.
+			 * @param x The cell X coordinate.
+			 * @param y The cell Y coordinate.
+			 * @param z The cell Z coordinate.
+			 * @return uint64_t
+			 */
+			[[nodiscard]]
+			static
+			uint64_t
+			cellKey (int64_t x, int64_t y, int64_t z) noexcept
+			{
+				constexpr uint64_t Mask{(1ULL << 21) - 1};
+
+				return (static_cast< uint64_t >(x) & Mask) | ((static_cast< uint64_t >(y) & Mask) << 21) | ((static_cast< uint64_t >(z) & Mask) << 42);
+			}
+
 			/**
 			 * @briefs Checks and computes the vertex element count and returns the size.
 			 * @param normalType Set the normal format. Default none.
@@ -1841,12 +2806,20 @@ namespace EmEn::Libs::VertexFactory
 			static constexpr auto TextureCoordinatesDeclared{0UL};
 			static constexpr auto ComputeEdges{1UL};
 
+			static constexpr auto NoIndex{std::numeric_limits< index_data_t >::max()};
+
 			/* NOTE: first = offset, second = the number of vertices for this group. */
 			std::vector< std::pair< index_data_t, index_data_t > > m_groups{1};
 			std::vector< ShapeVertex< vertex_data_t > > m_vertices;
 			std::vector< Math::Vector< 4, vertex_data_t > > m_vertexColors;
 			std::vector< ShapeTriangle< vertex_data_t, index_data_t > > m_triangles;
 			std::vector< ShapeEdge< index_data_t > > m_edges;
+			/* NOTE: Lookups for addVertex(), addVertexColor() and addEdge(). A bucket holds the latest index of a hash, the chains link to the previous one. */
+			std::unordered_map< size_t, index_data_t > m_vertexBuckets;
+			std::vector< index_data_t > m_vertexBucketChains;
+			std::unordered_map< size_t, index_data_t > m_vertexColorBuckets;
+			std::vector< index_data_t > m_vertexColorBucketChains;
+			std::unordered_map< uint64_t, index_data_t > m_edgeLookup;
 			Math::Space3D::AACuboid< vertex_data_t > m_boundingBox;
 			Math::Space3D::Sphere< vertex_data_t > m_boundingSphere;
 			/* NOTE: This is the max distance between [0,0,0] and the farthest vertex.
@@ -0,0 +1,735 @@
+/*
+ * src/Libs/VertexFactory/ShapeSimplifier.hpp
+ * This file is part of Emeraude-Engine
+ *
+ * Copyright (C) 2010-2025 - Sébastien Léon Claude Christian Bémelmans "LondNoir" <londnoir@gmail.com>
+ *
+ * Emeraude-Engine is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * Emeraude-Engine is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with Emeraude-Engine; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * Complete project and additional information can be found at :
+ * https://github.com/londnoir/emeraude-engine
+ *
+ * --- THIS IS AUTOMATICALLY GENERATED, DO NOT CHANGE ---
+ */
+
+
+#pragma once
+
+/* STL inclusions. */
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <numeric>
+#include <queue>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+/* Local inclusions for usages. */
+#include "Libs/Math/Vector.hpp"
+#include "Shape.hpp"
+
+namespace EmEn::Libs::VertexFactory
+{
+	/**
+	 * @brief The shape simplifier class reduces the number of triangles of a shape with the quadric error metric (Garland and Heckbert, 1997).
+	 * @note The simplification collapses a vertex into one of its neighbors (half-edge collapse), so the kept vertices keep their attributes.
+	 * The vertices on a border, on an attribute seam (several vertices at the same position), on a group boundary or on a non-manifold edge never move.
+	 * @tparam vertex_data_t The precision type of vertex data. Default float.
+	 * @tparam index_data_t The precision type of index data. Default uint32_t.
+	 */
+	template< typename vertex_data_t = float, typename index_data_t = uint32_t >
+	requires (std::is_floating_point_v< vertex_data_t > && std::is_unsigned_v< index_data_t > )
+	class ShapeSimplifier final
+	{
+		public:
+
+			/**
+			 * @brief Constructs the shape simplifier.
+			 * @param source A reference to the shape to simplify. It must outlive the simplifier.
+			 */
+			explicit
+			ShapeSimplifier (const Shape< vertex_data_t, index_data_t > & source) noexcept
+				: m_source(&source)
+			{
+
+			}
+
+			/**
+			 * @brief Copy constructor.
+			 * @param copy A reference to the copied instance.
+			 */
+			ShapeSimplifier (const ShapeSimplifier & copy) noexcept = delete;
+
+			/**
+			 * @brief Move constructor.
+			 * @param copy A reference to the copied instance.
+			 */
+			ShapeSimplifier (ShapeSimplifier && copy) noexcept = delete;
+
+			/**
+			 * @brief Copy assignment.
+			 * @param copy A reference to the copied instance.
+			 */
+			ShapeSimplifier & operator= (const ShapeSimplifier & copy) noexcept = delete;
+
+			/**
+			 * @brief Move assignment.
+			 * @param copy A reference to the copied instance.
+			 */
+			ShapeSimplifier & operator= (ShapeSimplifier && copy) noexcept = delete;
+
+			/**
+			 * @brief Destructs the shape simplifier.
+			 */
+			~ShapeSimplifier () = default;
+
+			/**
+			 * @brief Returns a simplified copy of the source shape.
+			 * @param targetRatio The fraction of triangles to keep, from 0 to 1.
+			 * @param maxError The maximum distance the surface may deviate, in the shape units. Default no limit.
+			 * @return Shape< vertex_data_t, index_data_t >
+			 */
+			[[nodiscard]]
+			Shape< vertex_data_t, index_data_t >
+			simplify (float targetRatio, vertex_data_t maxError = std::numeric_limits< vertex_data_t >::max()) const noexcept
+			{
+				const auto triangleCount = m_source->triangles().size();
+
+				return ShapeSimplifier::simplifyShape(*m_source, ShapeSimplifier::targetTriangleCount(triangleCount, targetRatio), maxError);
+			}
+
+			/**
+			 * @brief Generates a chain of level of details, each level being a simplification of the previous one.
+			 * @note The source shape is the level 0 and is not part of the chain. The chain stops early when a level cannot be simplified anymore.
+			 * @param levelCount The number of levels to generate.
+			 * @param reductionRatio The fraction of triangles kept from one level to the next one. Default 0.5.
+			 * @param maxError The maximum distance the surface of a level may deviate from the previous one, in the shape units. Default no limit.
+			 * @return std::vector< Shape< vertex_data_t, index_data_t > >
+			 */
+			[[nodiscard]]
+			std::vector< Shape< vertex_data_t, index_data_t > >
+			generateLODChain (uint32_t levelCount, float reductionRatio = 0.5F, vertex_data_t maxError = std::numeric_limits< vertex_data_t >::max()) const noexcept
+			{
+				std::vector< Shape< vertex_data_t, index_data_t > > levels;
+				levels.reserve(levelCount);
+
+				const auto * previous = m_source;
+
+				for ( uint32_t level = 0; level < levelCount; ++level )
+				{
+					const auto previousTriangleCount = previous->triangles().size();
+
+					auto shape = ShapeSimplifier::simplifyShape(*previous, ShapeSimplifier::targetTriangleCount(previousTriangleCount, reductionRatio), maxError);
+
+					if ( shape.triangles().size() >= previousTriangleCount )
+					{
+						break;
+					}
+
+					levels.emplace_back(std::move(shape));
+
+					previous = &levels.back();
+				}
+
+				return levels;
+			}
+
+		private:
+
+			/**
+			 * @brief Symmetric 4x4 matrix measuring the squared distance to a set of planes.
+			 */
+			struct Quadric
+			{
+				std::array< double, 10 > coefficients{};
+
+				/**
+				 * @brief Adds a weighted plane.
+				 * @param a The plane normal X.
+				 * @param b The plane normal Y.
+				 * @param c The plane normal Z.
+				 * @param d The plane distance.
+				 * @param weight The plane weight.
+				 * @return void
+				 */
+				void
+				addPlane (double a, double b, double c, double d, double weight) noexcept
+				{
+					coefficients[0] += weight * a * a;
+					coefficients[1] += weight * a * b;
+					coefficients[2] += weight * a * c;
+					coefficients[3] += weight * a * d;
+					coefficients[4] += weight * b * b;
+					coefficients[5] += weight * b * c;
+					coefficients[6] += weight * b * d;
+					coefficients[7] += weight * c * c;
+					coefficients[8] += weight * c * d;
+					coefficients[9] += weight * d * d;
+				}
+
+				/**
+				 * @brief Accumulates another quadric.
+				 * @param other A reference to a quadric.
+				 * @return Quadric &
+				 */
+				Quadric &
+				operator+= (const Quadric & other) noexcept
+				{
+					for ( size_t index = 0; index < coefficients.size(); ++index )
+					{
+						coefficients[index] += other.coefficients[index];
+					}
+
+					return *this;
+				}
+
+				/**
+				 * @brief Returns the error of a position.
+				 * @param position A reference to a position.
+				 * @return double
+				 */
+				[[nodiscard]]
+				double
+				evaluate (const Math::Vector< 3, vertex_data_t > & position) const noexcept
+				{
+					const auto x = static_cast< double >(position[Math::X]);
+					const auto y = static_cast< double >(position[Math::Y]);
+					const auto z = static_cast< double >(position[Math::Z]);
+					const auto & q = coefficients;
+
+					return std::abs(
+						q[0] * x * x + 2 * q[1] * x * y + 2 * q[2] * x * z + 2 * q[3] * x +
+						q[4] * y * y + 2 * q[5] * y * z + 2 * q[6] * y +
+						q[7] * z * z + 2 * q[8] * z +
+						q[9]
+					);
+				}
+			};
+
+			/**
+			 * @brief A pending collapse in the priority queue.
+			 */
+			struct Collapse
+			{
+				double cost;
+				index_data_t position;
+				uint32_t version;
+
+				[[nodiscard]]
+				bool
+				operator> (const Collapse & other) const noexcept
+				{
+					return cost > other.cost;
+				}
+			};
+
+			/**
+			 * @brief Returns the number of triangles to reach from a ratio.
+			 * @param triangleCount The current number of triangles.
+			 * @param ratio The fraction of triangles to keep.
+			 * @return size_t
+			 */
+			[[nodiscard]]
+			static
+			size_t
+			targetTriangleCount (size_t triangleCount, float ratio) noexcept
+			{
+				return static_cast< size_t >(std::ceil(static_cast< double >(triangleCount) * std::clamp(static_cast< double >(ratio), 0.0, 1.0)));
+			}
+
+			/**
+			 * @brief Simplifies a shape.
+			 * @param source A reference to the shape.
+			 * @param targetTriangleCount The number of triangles to reach.
+			 * @param maxError The maximum surface deviation.
+			 * @return Shape< vertex_data_t, index_data_t >
+			 */
+			[[nodiscard]]
+			static
+			Shape< vertex_data_t, index_data_t >
+			simplifyShape (const Shape< vertex_data_t, index_data_t > & source, size_t targetTriangleCount, vertex_data_t maxError) noexcept
+			{
+				using Vector3 = Math::Vector< 3, vertex_data_t >;
+
+				constexpr auto NoIndex = std::numeric_limits< index_data_t >::max();
+
+				Shape< vertex_data_t, index_data_t > result{source};
+
+				const auto & vertices = source.vertices();
+				const auto & triangles = source.triangles();
+				const auto vertexCount = vertices.size();
+				const auto triangleCount = triangles.size();
+
+				if ( vertexCount == 0 || triangleCount <= targetTriangleCount )
+				{
+					return result;
+				}
+
+				/* 1. Welds the vertices by position, an attribute seam becomes a position with several vertices. */
+				std::vector< index_data_t > positionIds(vertexCount);
+				std::vector< index_data_t > positionVertices;
+				std::vector< index_data_t > positionVertexCounts;
+
+				{
+					std::vector< index_data_t > sortedVertices(vertexCount);
+					std::iota(sortedVertices.begin(), sortedVertices.end(), 0);
+
+					std::ranges::sort(sortedVertices, [&vertices] (index_data_t vertexA, index_data_t vertexB) {
+						const auto & positionA = vertices[vertexA].position();
+						const auto & positionB = vertices[vertexB].position();
+
+						for ( size_t axis = 0; axis < 3; ++axis )
+						{
+							if ( positionA[axis] != positionB[axis] )
+							{
+								return positionA[axis] < positionB[axis];
+							}
+						}
+
+						return vertexA < vertexB;
+					});
+
+					for ( size_t sortedIndex = 0; sortedIndex < vertexCount; ++sortedIndex )
+					{
+						const auto vertexIndex = sortedVertices[sortedIndex];
+
+						if ( sortedIndex == 0 || vertices[vertexIndex].position() != vertices[sortedVertices[sortedIndex - 1]].position() )
+						{
+							positionVertices.emplace_back(vertexIndex);
+							positionVertexCounts.emplace_back(0);
+						}
+
+						positionIds[vertexIndex] = static_cast< index_data_t >(positionVertices.size() - 1);
+						positionVertexCounts.back()++;
+					}
+				}
+
+				const auto positionCount = positionVertices.size();
+
+				const auto positionOf = [&] (index_data_t positionId) -> const Vector3 & {
+					return vertices[positionVertices[positionId]].position();
+				};
+
+				/* 2. Triangles around each position, plane quadrics and group of each triangle. */
+				std::vector< index_data_t > corners(triangleCount * 3);
+				std::vector< bool > aliveTriangles(triangleCount, true);
+				std::vector< std::vector< index_data_t > > positionTriangles(positionCount);
+				std::vector< Quadric > quadrics(positionCount);
+				std::vector< bool > lockedPositions(positionCount, false);
+				std::vector< size_t > triangleGroups(triangleCount, 0);
+				std::vector< size_t > aliveGroupTriangleCounts(source.groups().size(), 0);
+
+				for ( size_t groupIndex = 0; groupIndex < source.groups().size(); ++groupIndex )
+				{
+					const auto & group = source.groups()[groupIndex];
+					const auto last = std::min(static_cast< size_t >(group.first) + group.second, triangleCount);
+
+					for ( auto triangleIndex = static_cast< size_t >(group.first); triangleIndex < last; ++triangleIndex )
+					{
+						triangleGroups[triangleIndex] = groupIndex;
+					}
+				}
+
+				for ( size_t triangleIndex = 0; triangleIndex < triangleCount; ++triangleIndex )
+				{
+					std::array< index_data_t, 3 > trianglePositions{};
+
+					for ( index_data_t cornerIndex = 0; cornerIndex < 3; ++cornerIndex )
+					{
+						corners[triangleIndex * 3 + cornerIndex] = triangles[triangleIndex].vertexIndex(cornerIndex);
+						trianglePositions[cornerIndex] = positionIds[corners[triangleIndex * 3 + cornerIndex]];
+					}
+
+					aliveGroupTriangleCounts[triangleGroups[triangleIndex]]++;
+
+					/* NOTE: A triangle already degenerated by the welding is left untouched. */
+					if ( trianglePositions[0] == trianglePositions[1] || trianglePositions[0] == trianglePositions[2] || trianglePositions[1] == trianglePositions[2] )
+					{
+						for ( const auto positionId : trianglePositions )
+						{
+							lockedPositions[positionId] = true;
+						}
+
+						continue;
+					}
+
+					const auto & positionA = positionOf(trianglePositions[0]);
+					const auto normal = Vector3::crossProduct(positionOf(trianglePositions[1]) - positionA, positionOf(trianglePositions[2]) - positionA);
+					const auto doubleArea = static_cast< double >(normal.length());
+
+					for ( const auto positionId : trianglePositions )
+					{
+						positionTriangles[positionId].emplace_back(static_cast< index_data_t >(triangleIndex));
+					}
+
+					if ( doubleArea > 0.0 )
+					{
+						const auto a = static_cast< double >(normal[Math::X]) / doubleArea;
+						const auto b = static_cast< double >(normal[Math::Y]) / doubleArea;
+						const auto c = static_cast< double >(normal[Math::Z]) / doubleArea;
+						const auto d = -(a * static_cast< double >(positionA[Math::X]) + b * static_cast< double >(positionA[Math::Y]) + c * static_cast< double >(positionA[Math::Z]));
+
+						for ( const auto positionId : trianglePositions )
+						{
+							quadrics[positionId].addPlane(a, b, c, d, doubleArea * 0.5);
+						}
+					}
+				}
+
+				/* 3. Locks the attribute seams, the borders, the non-manifold edges and the group boundaries. */
+				{
+					std::unordered_map< uint64_t, uint32_t > edgeTriangleCounts;
+					edgeTriangleCounts.reserve(triangleCount * 2);
+
+					const auto edgeKey = [] (index_data_t positionA, index_data_t positionB) {
+						return positionA < positionB ?
+							(static_cast< uint64_t >(positionA) << 32) | positionB :
+							(static_cast< uint64_t >(positionB) << 32) | positionA;
+					};
+
+					for ( size_t positionId = 0; positionId < positionCount; ++positionId )
+					{
+						if ( positionVertexCounts[positionId] > 1 )
+						{
+							lockedPositions[positionId] = true;
+						}
+
+						for ( const auto triangleIndex : positionTriangles[positionId] )
+						{
+							if ( triangleGroups[triangleIndex] != triangleGroups[positionTriangles[positionId].front()] )
+							{
+								lockedPositions[positionId] = true;
+							}
+						}
+					}
+
+					for ( size_t triangleIndex = 0; triangleIndex < triangleCount; ++triangleIndex )
+					{
+						for ( index_data_t cornerIndex = 0; cornerIndex < 3; ++cornerIndex )
+						{
+							const auto positionA = positionIds[corners[triangleIndex * 3 + cornerIndex]];
+							const auto positionB = positionIds[corners[triangleIndex * 3 + (cornerIndex + 1) % 3]];
+
+							if ( positionA != positionB )
+							{
+								edgeTriangleCounts[edgeKey(positionA, positionB)]++;
+							}
+						}
+					}
+
+					for ( const auto & [key, count] : edgeTriangleCounts )
+					{
+						if ( count != 2 )
+						{
+							lockedPositions[static_cast< size_t >(key >> 32)] = true;
+							lockedPositions[static_cast< size_t >(key & 0xFFFFFFFFULL)] = true;
+						}
+					}
+				}
+
+				/* 4. Evaluates the cheapest valid collapse of a free position into a neighbor vertex. */
+				std::vector< bool > removedPositions(positionCount, false);
+				std::vector< index_data_t > neighborsA;
+				std::vector< index_data_t > neighborsB;
+				std::vector< index_data_t > updatedPositions;
+
+				const auto gatherNeighbors = [&] (index_data_t positionId, std::vector< index_data_t > & neighbors) {
+					neighbors.clear();
+
+					for ( const auto triangleIndex : positionTriangles[positionId] )
+					{
+						if ( !aliveTriangles[triangleIndex] )
+						{
+							continue;
+						}
+
+						for ( index_data_t cornerIndex = 0; cornerIndex < 3; ++cornerIndex )
+						{
+							const auto neighbor = positionIds[corners[triangleIndex * 3 + cornerIndex]];
+
+							if ( neighbor != positionId )
+							{
+								neighbors.emplace_back(neighbor);
+							}
+						}
+					}
+
+					std::ranges::sort(neighbors);
+
+					const auto duplicates = std::ranges::unique(neighbors);
+
+					neighbors.erase(duplicates.begin(), duplicates.end());
+				};
+
+				const auto hasPosition = [&] (size_t triangleIndex, index_data_t positionId) {
+					return positionIds[corners[triangleIndex * 3]] == positionId || positionIds[corners[triangleIndex * 3 + 1]] == positionId || positionIds[corners[triangleIndex * 3 + 2]] == positionId;
+				};
+
+				/* NOTE: Returns the cost and the target vertex, or NoIndex when no collapse is valid. */
+				const auto evaluate = [&] (index_data_t positionId) -> std::pair< double, index_data_t > {
+					std::pair< double, index_data_t > best{std::numeric_limits< double >::max(), NoIndex};
+
+					if ( lockedPositions[positionId] || removedPositions[positionId] )
+					{
+						return best;
+					}
+
+					gatherNeighbors(positionId, neighborsA);
+
+					for ( const auto neighborId : neighborsA )
+					{
+						/* The two triangles sharing the edge must use the same neighbor vertex, otherwise it is a seam ending here. */
+						auto targetVertex = NoIndex;
+						size_t sharedTriangleCount = 0;
+						bool sameVertex = true;
+						std::array< size_t, 2 > sharedGroups{};
+
+						for ( const auto triangleIndex : positionTriangles[positionId] )
+						{
+							if ( !aliveTriangles[triangleIndex] || !hasPosition(triangleIndex, neighborId) )
+							{
+								continue;
+							}
+
+							for ( index_data_t cornerIndex = 0; cornerIndex < 3; ++cornerIndex )
+							{
+								const auto vertexIndex = corners[triangleIndex * 3 + cornerIndex];
+
+								if ( positionIds[vertexIndex] == neighborId )
+								{
+									sameVertex = sameVertex && (targetVertex == NoIndex || targetVertex == vertexIndex);
+									targetVertex = vertexIndex;
+								}
+							}
+
+							if ( sharedTriangleCount < sharedGroups.size() )
+							{
+								sharedGroups[sharedTriangleCount] = triangleGroups[triangleIndex];
+							}
+
+							sharedTriangleCount++;
+						}
+
+						if ( sharedTriangleCount != 2 || !sameVertex )
+						{
+							continue;
+						}
+
+						/* A group must keep at least one triangle. */
+						if ( sharedGroups[0] == sharedGroups[1] ? aliveGroupTriangleCounts[sharedGroups[0]] <= 2 : (aliveGroupTriangleCounts[sharedGroups[0]] <= 1 || aliveGroupTriangleCounts[sharedGroups[1]] <= 1) )
+						{
+							continue;
+						}
+
+						const auto & targetPosition = positionOf(neighborId);
+
+						auto quadric = quadrics[positionId];
+						quadric += quadrics[neighborId];
+
+						const auto cost = quadric.evaluate(targetPosition);
+
+						if ( cost >= best.first )
+						{
+							continue;
+						}
+
+						/* Link condition, the two positions must share exactly the two opposite vertices to keep the surface manifold. */
+						gatherNeighbors(neighborId, neighborsB);
+
+						size_t commonNeighborCount = 0;
+
+						for ( const auto otherId : neighborsA )
+						{
+							if ( std::ranges::binary_search(neighborsB, otherId) )
+							{
+								commonNeighborCount++;
+							}
+						}
+
+						if ( commonNeighborCount != 2 )
+						{
+							continue;
+						}
+
+						/* The remaining triangles must not flip. */
+						bool flipped = false;
+
+						for ( const auto triangleIndex : positionTriangles[positionId] )
+						{
+							if ( !aliveTriangles[triangleIndex] || hasPosition(triangleIndex, neighborId) )
+							{
+								continue;
+							}
+
+							std::array< Vector3, 3 > before{};
+							std::array< Vector3, 3 > after{};
+
+							for ( index_data_t cornerIndex = 0; cornerIndex < 3; ++cornerIndex )
+							{
+								const auto cornerPositionId = positionIds[corners[triangleIndex * 3 + cornerIndex]];
+
+								before[cornerIndex] = positionOf(cornerPositionId);
+								after[cornerIndex] = cornerPositionId == positionId ? targetPosition : before[cornerIndex];
+							}
+
+							const auto normalBefore = Vector3::crossProduct(before[1] - before[0], before[2] - before[0]);
+							const auto normalAfter = Vector3::crossProduct(after[1] - after[0], after[2] - after[0]);
+
+							if ( Vector3::dotProduct(normalBefore, normalAfter) <= static_cast< vertex_data_t >(0.25) * normalBefore.length() * normalAfter.length() )
+							{
+								flipped = true;
+
+								break;
+							}
+						}
+
+						if ( flipped )
+						{
+							continue;
+						}
+
+						best = {cost, targetVertex};
+					}
+
+					return best;
+				};
+
+				/* 5. Collapses the cheapest positions first. */
+				std::priority_queue< Collapse, std::vector< Collapse >, std::greater<> > queue;
+				std::vector< uint32_t > versions(positionCount, 0);
+				std::vector< index_data_t > targets(vertexCount);
+				std::iota(targets.begin(), targets.end(), 0);
+
+				for ( size_t positionId = 0; positionId < positionCount; ++positionId )
+				{
+					const auto [cost, targetVertex] = evaluate(static_cast< index_data_t >(positionId));
+
+					if ( targetVertex != NoIndex )
+					{
+						queue.push({cost, static_cast< index_data_t >(positionId), 0});
+					}
+				}
+
+				const auto maxCost = static_cast< double >(maxError) * static_cast< double >(maxError);
+				auto aliveTriangleCount = triangleCount;
+
+				while ( aliveTriangleCount > targetTriangleCount && !queue.empty() )
+				{
+					const auto collapse = queue.top();
+
+					queue.pop();
+
+					if ( removedPositions[collapse.position] || collapse.version != versions[collapse.position] )
+					{
+						continue;
+					}
+
+					if ( collapse.cost > maxCost )
+					{
+						break;
+					}
+
+					/* NOTE: The neighborhood may have changed since the evaluation. */
+					const auto [cost, targetVertex] = evaluate(collapse.position);
+
+					if ( targetVertex == NoIndex )
+					{
+						continue;
+					}
+
+					if ( cost > collapse.cost * 1.0001 + std::numeric_limits< double >::epsilon() )
+					{
+						queue.push({cost, collapse.position, collapse.version});
+
+						continue;
+					}
+
+					const auto positionId = collapse.position;
+					const auto targetId = positionIds[targetVertex];
+					const auto vertexIndex = positionVertices[positionId];
+
+					for ( const auto triangleIndex : positionTriangles[positionId] )
+					{
+						if ( !aliveTriangles[triangleIndex] )
+						{
+							continue;
+						}
+
+						if ( hasPosition(triangleIndex, targetId) )
+						{
+							aliveTriangles[triangleIndex] = false;
+							aliveTriangleCount--;
+							aliveGroupTriangleCounts[triangleGroups[triangleIndex]]--;
+
+							continue;
+						}
+
+						for ( index_data_t cornerIndex = 0; cornerIndex < 3; ++cornerIndex )
+						{
+							if ( corners[triangleIndex * 3 + cornerIndex] == vertexIndex )
+							{
+								corners[triangleIndex * 3 + cornerIndex] = targetVertex;
+							}
+						}
+
+						positionTriangles[targetId].emplace_back(triangleIndex);
+					}
+
+					/* NOTE: The collapsed vertex now reads as the target one for the neighbor lookups. */
+					positionIds[vertexIndex] = targetId;
+					positionTriangles[positionId].clear();
+					removedPositions[positionId] = true;
+					targets[vertexIndex] = targetVertex;
+					quadrics[targetId] += quadrics[positionId];
+
+					std::erase_if(positionTriangles[targetId], [&aliveTriangles] (index_data_t triangleIndex) {
+						return !aliveTriangles[triangleIndex];
+					});
+
+					/* Updates the collapses around the target. */
+					const auto update = [&] (index_data_t updatedPositionId) {
+						const auto [updatedCost, updatedTarget] = evaluate(updatedPositionId);
+
+						versions[updatedPositionId]++;
+
+						if ( updatedTarget != NoIndex )
+						{
+							queue.push({updatedCost, updatedPositionId, versions[updatedPositionId]});
+						}
+					};
+
+					gatherNeighbors(targetId, updatedPositions);
+
+					update(targetId);
+
+					for ( const auto updatedPositionId : updatedPositions )
+					{
+						update(updatedPositionId);
+					}
+				}
+
+				result.mergeVertices(targets);
+
+				return result;
+			}
+
+			const Shape< vertex_data_t, index_data_t > * m_source;
+	};
+}
@@ -31,6 +31,18 @@
 
 namespace EmEn::Libs::VertexFactory
 {
+	/** @brief The number of vertices kept by the post-transform cache assumed when optimizing. */
+	static constexpr uint32_t DefaultVertexCacheSize{16};
+
+	/** @brief The post-transform vertex cache efficiency of a triangle list. */
+	struct VertexCacheStatistics
+	{
+		/** @brief Average cache miss ratio, the number of transformed vertices per triangle. From 0.5 (best) to 3.0 (worst). */
+		float ACMR{0.0F};
+		/** @brief Average transform to vertex ratio, the number of transformed vertices per used vertex. From 1.0 (best). */
+		float ATVR{0.0F};
+	};
+
 	/** @brief The normal format. */
 	enum class NormalType : uint8_t
 	{
@@ -0,0 +1,292 @@
+/*
+ * src/Libs/WaveFactory/StreamReader.cpp
+ * This file is part of Emeraude-Engine
+ *
+ * Copyright (C) 2010-2025 - Sébastien Léon Claude Christian Bémelmans "LondNoir" <londnoir@gmail.com>
+ *
+ * Emeraude-Engine is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * Emeraude-Engine is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with Emeraude-Engine; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * Complete project and additional information can be found at :
+ * https://github.com/londnoir/emeraude-engine
+ *
+ * --- THIS IS AUTOMATICALLY GENERATED, DO NOT CHANGE ---
+ */
+
+#include "StreamReader.hpp"
+
+/* Engine configuration file. */
+#include "emeraude_config.hpp"
+
+/* STL inclusions. */
+#include <iostream>
+
+/* Third-party inclusions. */
+#ifdef SNDFILE_ENABLED
+	#include "sndfile.h"
+#endif
+#ifdef SAMPLERATE_ENABLED
+	#include <samplerate.h>
+#endif
+
+/* Local inclusions. */
+#include "Libs/IO/IO.hpp"
+
+namespace EmEn::Libs::WaveFactory
+{
+	StreamReader::~StreamReader ()
+	{
+		this->close();
+	}
+
+	bool
+	StreamReader::open (const std::filesystem::path & filepath, [[maybe_unused]] Frequency frequency) noexcept
+	{
+		this->close();
+
+#ifdef SNDFILE_ENABLED
+		if ( !IO::fileExists(filepath) )
+		{
+			std::cerr << __PRETTY_FUNCTION__ << ", file '" << filepath << "' doesn't exist !" "\n";
+
+			return false;
+		}
+
+		SF_INFO soundFileInfos{};
+
+		m_file = sf_open(filepath.string().c_str(), SFM_READ, &soundFileInfos);
+
+		if ( m_file == nullptr )
+		{
+			std::cerr << __PRETTY_FUNCTION__ << ", unable to open sound file '" << filepath << "' !" "\n";
+
+			return false;
+		}
+
+		m_channels = toChannels(soundFileInfos.channels);
+		m_sourceFrequency = toFrequency(soundFileInfos.samplerate);
+		m_sourceFrames = static_cast< size_t >(soundFileInfos.frames);
+		m_frequency = frequency;
+
+		if ( m_channels == Channels::Invalid || m_sourceFrequency == Frequency::Invalid || m_frequency == Frequency::Invalid )
+		{
+			std::cerr << __PRETTY_FUNCTION__ << ", sound file '" << filepath << "' has an unsupported format !" "\n";
+
+			this->close();
+
+			return false;
+		}
+
+		m_ratio = static_cast< double >(m_frequency) / static_cast< double >(m_sourceFrequency);
+
+		if ( m_frequency != m_sourceFrequency )
+		{
+	#ifdef SAMPLERATE_ENABLED
+			auto error = 0;
+
+			m_resampler = src_new(SRC_SINC_BEST_QUALITY, static_cast< int >(m_channels), &error);
+
+			if ( m_resampler == nullptr )
+			{
+				std::cerr << __PRETTY_FUNCTION__ << ", unable to create the resampler : " << src_strerror(error) << "\n";
+
+				this->close();
+
+				return false;
+			}
+
+			m_input.resize(ReadBlockFrames * static_cast< size_t >(m_channels));
+	#else
+			std::cerr << __PRETTY_FUNCTION__ << ", libsamplerate is not available to convert '" << filepath << "' !" "\n";
+
+			this->close();
+
+			return false;
+	#endif
+		}
+
+		return true;
+#else
+		std::cerr << __PRETTY_FUNCTION__ << ", libsndfile is not available to read '" << filepath << "' !" "\n";
+
+		return false;
+#endif
+	}
+
+	void
+	StreamReader::close () noexcept
+	{
+#ifdef SAMPLERATE_ENABLED
+		if ( m_resampler != nullptr )
+		{
+			src_delete(m_resampler);
+
+			m_resampler = nullptr;
+		}
+#endif
+
+#ifdef SNDFILE_ENABLED
+		if ( m_file != nullptr )
+		{
+			sf_close(m_file);
+
+			m_file = nullptr;
+		}
+#endif
+
+		m_input.clear();
+		m_output.clear();
+		m_inputFrames = 0;
+		m_inputOffset = 0;
+		m_sourceFrames = 0;
+		m_ratio = 1.0;
+		m_channels = Channels::Invalid;
+		m_frequency = Frequency::Invalid;
+		m_sourceFrequency = Frequency::Invalid;
+		m_endOfFile = false;
+		m_finished = false;
+	}
+
+	bool
+	StreamReader::rewind () noexcept
+	{
+		if ( !this->isOpen() )
+		{
+			return false;
+		}
+
+#ifdef SNDFILE_ENABLED
+		if ( sf_seek(m_file, 0, SEEK_SET) < 0 )
+		{
+			std::cerr << __PRETTY_FUNCTION__ << ", unable to seek at the beginning of the sound file !" "\n";
+
+			return false;
+		}
+#endif
+
+#ifdef SAMPLERATE_ENABLED
+		if ( m_resampler != nullptr )
+		{
+			src_reset(m_resampler);
+		}
+#endif
+
+		m_inputFrames = 0;
+		m_inputOffset = 0;
+		m_endOfFile = false;
+		m_finished = false;
+
+		return true;
+	}
+
+	size_t
+	StreamReader::read (size_t frameCount, [[maybe_unused]] Wave< int16_t > & chunk) noexcept
+	{
+		if ( !this->isOpen() || m_finished || frameCount == 0 )
+		{
+			return 0;
+		}
+
+		size_t producedFrames = 0;
+
+#ifdef SNDFILE_ENABLED
+		[[maybe_unused]] const auto channelCount = static_cast< size_t >(m_channels);
+
+		if ( m_resampler == nullptr )
+		{
+			/* NOTE: Same frequency, the frames are decoded directly in the chunk. */
+			if ( !chunk.initialize(frameCount, m_channels, m_frequency) )
+			{
+				return 0;
+			}
+
+			producedFrames = static_cast< size_t >(sf_readf_short(m_file, chunk.data(), static_cast< sf_count_t >(frameCount)));
+
+			if ( producedFrames < frameCount )
+			{
+				m_finished = true;
+			}
+		}
+	#ifdef SAMPLERATE_ENABLED
+		else
+		{
+			m_output.resize(frameCount * channelCount);
+
+			while ( producedFrames < frameCount )
+			{
+				/* Decodes the next block of the file once the resampler consumed the previous one. */
+				if ( m_inputOffset == m_inputFrames && !m_endOfFile )
+				{
+					m_inputFrames = static_cast< size_t >(sf_readf_float(m_file, m_input.data(), static_cast< sf_count_t >(ReadBlockFrames)));
+					m_inputOffset = 0;
+
+					if ( m_inputFrames < ReadBlockFrames )
+					{
+						m_endOfFile = true;
+					}
+				}
+
+				SRC_DATA data{};
+				data.data_in = m_input.data() + m_inputOffset * channelCount;
+				data.input_frames = static_cast< long >(m_inputFrames - m_inputOffset);
+				data.data_out = m_output.data() + producedFrames * channelCount;
+				data.output_frames = static_cast< long >(frameCount - producedFrames);
+				data.src_ratio = m_ratio;
+				/* NOTE: Once the file is fully decoded, the resampler flushes its internal delay. */
+				data.end_of_input = m_endOfFile ? 1 : 0;
+
+				const auto error = src_process(m_resampler, &data);
+
+				if ( error != 0 )
+				{
+					std::cerr << __PRETTY_FUNCTION__ << ", resampling failed : " << src_strerror(error) << "\n";
+
+					m_finished = true;
+
+					break;
+				}
+
+				m_inputOffset += static_cast< size_t >(data.input_frames_used);
+				producedFrames += static_cast< size_t >(data.output_frames_gen);
+
+				if ( m_endOfFile && m_inputOffset == m_inputFrames && data.output_frames_gen == 0 )
+				{
+					m_finished = true;
+
+					break;
+				}
+			}
+
+			if ( producedFrames > 0 )
+			{
+				if ( !chunk.initialize(producedFrames, m_channels, m_frequency) )
+				{
+					return 0;
+				}
+
+				src_float_to_short_array(m_output.data(), chunk.data(), static_cast< int >(producedFrames * channelCount));
+			}
+		}
+	#endif
+
+		/* NOTE: The chunk keeps its first frames when shrunk. */
+		if ( producedFrames > 0 && producedFrames < chunk.samplesCount() )
+		{
+			chunk.initialize(producedFrames, m_channels, m_frequency);
+		}
+#endif
+
+		return producedFrames;
+	}
+}
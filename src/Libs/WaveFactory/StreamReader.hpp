@@ -0,0 +1,219 @@
+/*
+ * src/Libs/WaveFactory/StreamReader.hpp
+ * This file is part of Emeraude-Engine
+ *
+ * Copyright (C) 2010-2025 - Sébastien Léon Claude Christian Bémelmans "LondNoir" <londnoir@gmail.com>
+ *
+ * Emeraude-Engine is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * Emeraude-Engine is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with Emeraude-Engine; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * Complete project and additional information can be found at :
+ * https://github.com/londnoir/emeraude-engine
+ *
+ * --- THIS IS AUTOMATICALLY GENERATED, DO NOT CHANGE ---
+ */
+
+#pragma once
+
+/* STL inclusions. */
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <vector>
+
+/* Local inclusions. */
+#include "Types.hpp"
+#include "Wave.hpp"
+
+/* Forward declarations (libsndfile and libsamplerate opaque handles). */
+struct sf_private_tag;
+struct SRC_STATE_tag;
+
+namespace EmEn::Libs::WaveFactory
+{
+	/**
+	 * @brief Reads a sound file progressively and converts it to a playback frequency on the fly.
+	 * @note Only one read block of the file is held in memory, whatever the file length.
+	 * The resampling is incremental, so the stream can be read chunk by chunk from the first one.
+	 */
+	class StreamReader final
+	{
+		public:
+
+			/** @brief The number of frames decoded at once from the file. */
+			static constexpr size_t ReadBlockFrames{4096};
+
+			/**
+			 * @brief Constructs a stream reader.
+			 */
+			StreamReader () noexcept = default;
+
+			/**
+			 * @brief Copy constructor.
+			 * @param copy A reference to the copied instance.
+			 */
+			StreamReader (const StreamReader & copy) noexcept = delete;
+
+			/**
+			 * @brief Move constructor.
+			 * @param copy A reference to the copied instance.
+			 */
+			StreamReader (StreamReader && copy) noexcept = delete;
+
+			/**
+			 * @brief Copy assignment.
+			 * @param copy A reference to the copied instance.
+			 * @return StreamReader &
+			 */
+			StreamReader & operator= (const StreamReader & copy) noexcept = delete;
+
+			/**
+			 * @brief Move assignment.
+			 * @param copy A reference to the copied instance.
+			 * @return StreamReader &
+			 */
+			StreamReader & operator= (StreamReader && copy) noexcept = delete;
+
+			/**
+			 * @brief Destructs the stream reader.
+			 */
+			~StreamReader ();
+
+			/**
+			 * @brief Opens a sound file, reading only its header.
+			 * @param filepath A reference to a file path.
+			 * @param frequency The frequency of the frames returned by read().
+			 * @return bool
+			 */
+			bool open (const std::filesystem::path & filepath, Frequency frequency) noexcept;
+
+			/**
+			 * @brief Closes the sound file.
+			 * @return void
+			 */
+			void close () noexcept;
+
+			/**
+			 * @brief Returns whether a sound file is opened.
+			 * @return bool
+			 */
+			[[nodiscard]]
+			bool
+			isOpen () const noexcept
+			{
+				return m_file != nullptr;
+			}
+
+			/**
+			 * @brief Returns whether every frame of the file has been returned.
+			 * @return bool
+			 */
+			[[nodiscard]]
+			bool
+			isFinished () const noexcept
+			{
+				return m_finished;
+			}
+
+			/**
+			 * @brief Returns the channels of the sound file.
+			 * @return Channels
+			 */
+			[[nodiscard]]
+			Channels
+			channels () const noexcept
+			{
+				return m_channels;
+			}
+
+			/**
+			 * @brief Returns the frequency of the frames returned by read().
+			 * @return Frequency
+			 */
+			[[nodiscard]]
+			Frequency
+			frequency () const noexcept
+			{
+				return m_frequency;
+			}
+
+			/**
+			 * @brief Returns the frequency of the sound file.
+			 * @return Frequency
+			 */
+			[[nodiscard]]
+			Frequency
+			sourceFrequency () const noexcept
+			{
+				return m_sourceFrequency;
+			}
+
+			/**
+			 * @brief Returns the number of frames in the sound file, at its own frequency.
+			 * @return size_t
+			 */
+			[[nodiscard]]
+			size_t
+			sourceFrames () const noexcept
+			{
+				return m_sourceFrames;
+			}
+
+			/**
+			 * @brief Returns the duration of the sound file in seconds.
+			 * @return float
+			 */
+			[[nodiscard]]
+			float
+			duration () const noexcept
+			{
+				if ( m_sourceFrequency == Frequency::Invalid )
+				{
+					return 0.0F;
+				}
+
+				return static_cast< float >(m_sourceFrames) / static_cast< float >(m_sourceFrequency);
+			}
+
+			/**
+			 * @brief Goes back to the beginning of the sound file.
+			 * @return bool
+			 */
+			bool rewind () noexcept;
+
+			/**
+			 * @brief Reads the next frames, converted to the output frequency in 16 bits.
+			 * @param frameCount The maximum number of frames to read.
+			 * @param chunk A reference to a wave receiving the frames. It is sized to the frames read.
+			 * @return size_t The number of frames read, 0 at the end of the file.
+			 */
+			size_t read (size_t frameCount, Wave< int16_t > & chunk) noexcept;
+
+		private:
+
+			sf_private_tag * m_file{nullptr};
+			SRC_STATE_tag * m_resampler{nullptr};
+			std::vector< float > m_input;
+			std::vector< float > m_output;
+			size_t m_inputFrames{0};
+			size_t m_inputOffset{0};
+			size_t m_sourceFrames{0};
+			double m_ratio{1.0};
+			Channels m_channels{Channels::Invalid};
+			Frequency m_frequency{Frequency::Invalid};
+			Frequency m_sourceFrequency{Frequency::Invalid};
+			bool m_endOfFile{false};
+			bool m_finished{false};
+	};
+}
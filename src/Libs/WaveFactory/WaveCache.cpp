@@ -0,0 +1,332 @@
+/*
+ * src/Libs/WaveFactory/WaveCache.cpp
+ * This file is part of Emeraude-Engine
+ *
+ * Copyright (C) 2010-2025 - Sébastien Léon Claude Christian Bémelmans "LondNoir" <londnoir@gmail.com>
+ *
+ * Emeraude-Engine is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * Emeraude-Engine is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with Emeraude-Engine; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * Complete project and additional information can be found at :
+ * https://github.com/londnoir/emeraude-engine
+ *
+ * --- THIS IS AUTOMATICALLY GENERATED, DO NOT CHANGE ---
+ */
+
+
+#include "WaveCache.hpp"
+
+/* STL inclusions. */
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+/* Local inclusions. */
+#include "Libs/Hash/FNV1a.hpp"
+#include "Libs/IO/IO.hpp"
+#include "Libs/IO/MappedFile.hpp"
+#include "Processor.hpp"
+
+namespace EmEn::Libs::WaveFactory
+{
+	WaveCache::WaveCache (std::filesystem::path directory, uint64_t maximumBytes) noexcept
+		: m_directory(std::move(directory)), m_maximumBytes(maximumBytes)
+	{
+
+	}
+
+	std::filesystem::path
+	WaveCache::getFilepath (uint64_t sourceHash, Channels channels, Frequency frequency) const noexcept
+	{
+		static constexpr std::array< char, 16 > Digits{'0', '1', '2', '3', '4', '5', '6', '7', '8', '9', 'a', 'b', 'c', 'd', 'e', 'f'};
+
+		std::string filename(16, '0');
+
+		for ( size_t digit = 0; digit < filename.size(); digit++ )
+		{
+			filename[filename.size() - 1 - digit] = Digits[(sourceHash >> (digit * 4)) & 0x0F];
+		}
+
+		filename += '-';
+		filename += std::to_string(static_cast< int >(frequency));
+		filename += '-';
+		filename += std::to_string(static_cast< size_t >(channels));
+		filename += "ch-s16";
+		filename += FileExtension;
+
+		return m_directory / filename;
+	}
+
+	bool
+	WaveCache::read (uint64_t sourceHash, Channels channels, Frequency frequency, Wave< int16_t > & wave) noexcept
+	{
+		if ( m_directory.empty() )
+		{
+			return false;
+		}
+
+		const auto filepath = this->getFilepath(sourceHash, channels, frequency);
+
+		std::error_code errorCode;
+
+		if ( !std::filesystem::exists(filepath, errorCode) )
+		{
+			return false;
+		}
+
+		IO::MappedFile file;
+
+		if ( !file.open(filepath) || file.size() < sizeof(FileHeader) )
+		{
+			return false;
+		}
+
+		FileHeader header{};
+		std::memcpy(&header, file.data(), sizeof(FileHeader));
+
+		/* NOTE: The file name is only a hint, the header must agree with the request. An older version is not an error,
+		 * the caller will convert the source again and replace the file. */
+		if ( header.magic != Magic || !IO::isNativeByteOrder(header.byteOrderMark) || header.version != Version ||
+			header.sourceHash != sourceHash || header.channels != static_cast< uint32_t >(channels) ||
+			header.frequency != static_cast< uint32_t >(frequency) || header.frameCount == 0 )
+		{
+			return false;
+		}
+
+		const auto sampleCount = header.frameCount * header.channels;
+
+		if ( file.size() - sizeof(FileHeader) != sampleCount * sizeof(int16_t) )
+		{
+			std::cerr << __PRETTY_FUNCTION__ << ", the file " << filepath << " is truncated !" "\n";
+
+			return false;
+		}
+
+		if ( !wave.initialize(header.frameCount, channels, frequency) )
+		{
+			return false;
+		}
+
+		std::memcpy(wave.data(), file.data() + sizeof(FileHeader), sampleCount * sizeof(int16_t));
+
+		/* NOTE: The modification time orders the files for the eviction, a hit makes the file the most recent one. */
+		std::filesystem::last_write_time(filepath, std::filesystem::file_time_type::clock::now(), errorCode);
+
+		return true;
+	}
+
+	bool
+	WaveCache::store (uint64_t sourceHash, const Wave< int16_t > & wave) noexcept
+	{
+		if ( m_directory.empty() )
+		{
+			return false;
+		}
+
+		if ( !wave.isValid() )
+		{
+			std::cerr << __PRETTY_FUNCTION__ << ", the wave is empty !" "\n";
+
+			return false;
+		}
+
+		std::error_code errorCode;
+
+		std::filesystem::create_directories(m_directory, errorCode);
+
+		if ( errorCode )
+		{
+			std::cerr << __PRETTY_FUNCTION__ << ", unable to create the directory " << m_directory << " (" << errorCode.message() << ") !" "\n";
+
+			return false;
+		}
+
+		const auto filepath = this->getFilepath(sourceHash, wave.channels(), wave.frequency());
+
+		const FileHeader header{
+			.magic = Magic,
+			.version = Version,
+			.byteOrderMark = IO::ByteOrderMark,
+			.sourceHash = sourceHash,
+			.channels = static_cast< uint32_t >(wave.channels()),
+			.frequency = static_cast< uint32_t >(wave.frequency()),
+			.frameCount = wave.samplesCount()
+		};
+
+		const auto written = IO::writeFileAtomically(filepath, [&] (std::ofstream & file) {
+			file.write(reinterpret_cast< const char * >(&header), sizeof(FileHeader));
+			file.write(reinterpret_cast< const char * >(wave.data()), static_cast< std::streamsize >(wave.bytesCount()));
+
+			return true;
+		});
+
+		if ( !written )
+		{
+			return false;
+		}
+
+		this->evict(filepath);
+
+		return true;
+	}
+
+	bool
+	WaveCache::get (const std::filesystem::path & filepath, Channels channels, Frequency frequency, Wave< int16_t > & wave) noexcept
+	{
+		uint64_t sourceHash = 0;
+
+		const auto cacheEnabled = !m_directory.empty() && computeFileHash(filepath, sourceHash);
+
+		if ( cacheEnabled && this->read(sourceHash, channels, frequency, wave) )
+		{
+			m_hits.fetch_add(1, std::memory_order_relaxed);
+
+			return true;
+		}
+
+		m_misses.fetch_add(1, std::memory_order_relaxed);
+
+		if ( !wave.readFile(filepath) )
+		{
+			return false;
+		}
+
+		if ( wave.channels() == channels && wave.frequency() == frequency )
+		{
+			/* NOTE: Nothing to convert, the source file is already the fastest path. */
+			return true;
+		}
+
+		if ( wave.channels() != channels && channels != Channels::Mono )
+		{
+			std::cerr << __PRETTY_FUNCTION__ << ", unable to convert " << static_cast< size_t >(wave.channels()) << " channels to " << static_cast< size_t >(channels) << " !" "\n";
+
+			return false;
+		}
+
+		Processor processor{wave};
+
+		if ( wave.channels() != channels && !processor.mixDown() )
+		{
+			return false;
+		}
+
+		if ( wave.frequency() != frequency && !processor.resample(frequency) )
+		{
+			return false;
+		}
+
+		if ( !processor.toWave(wave) )
+		{
+			return false;
+		}
+
+		/* NOTE: A failure to store the file only costs a conversion on the next run. */
+		if ( cacheEnabled )
+		{
+			this->store(sourceHash, wave);
+		}
+
+		return true;
+	}
+
+	void
+	WaveCache::evict (const std::filesystem::path & keptFilepath) noexcept
+	{
+		if ( m_directory.empty() || m_maximumBytes == 0 )
+		{
+			return;
+		}
+
+		struct Entry
+		{
+			std::filesystem::path filepath;
+			std::filesystem::file_time_type time;
+			uint64_t bytes;
+		};
+
+		const std::lock_guard< std::mutex > lock{m_evictionAccess};
+
+		std::vector< Entry > entries;
+		uint64_t totalBytes = 0;
+
+		std::error_code errorCode;
+
+		for ( const auto & directoryEntry : std::filesystem::directory_iterator{m_directory, errorCode} )
+		{
+			if ( !directoryEntry.is_regular_file(errorCode) || directoryEntry.path().extension() != FileExtension )
+			{
+				continue;
+			}
+
+			const auto bytes = directoryEntry.file_size(errorCode);
+
+			if ( errorCode )
+			{
+				continue;
+			}
+
+			totalBytes += bytes;
+
+			entries.push_back({directoryEntry.path(), directoryEntry.last_write_time(errorCode), bytes});
+		}
+
+		if ( totalBytes <= m_maximumBytes )
+		{
+			return;
+		}
+
+		std::sort(entries.begin(), entries.end(), [] (const Entry & entryA, const Entry & entryB) {
+			return entryA.time < entryB.time;
+		});
+
+		for ( const auto & entry : entries )
+		{
+			if ( totalBytes <= m_maximumBytes )
+			{
+				break;
+			}
+
+			if ( entry.filepath == keptFilepath )
+			{
+				continue;
+			}
+
+			if ( std::filesystem::remove(entry.filepath, errorCode) )
+			{
+				totalBytes -= entry.bytes;
+			}
+		}
+	}
+
+	bool
+	WaveCache::computeFileHash (const std::filesystem::path & filepath, uint64_t & hash) noexcept
+	{
+		IO::MappedFile file;
+
+		if ( !file.open(filepath) )
+		{
+			return false;
+		}
+
+		hash = Hash::fnv1a(file.data(), file.size());
+
+		return true;
+	}
+}
@@ -0,0 +1,251 @@
+/*
+ * src/Libs/WaveFactory/WaveCache.hpp
+ * This file is part of Emeraude-Engine
+ *
+ * Copyright (C) 2010-2025 - Sébastien Léon Claude Christian Bémelmans "LondNoir" <londnoir@gmail.com>
+ *
+ * Emeraude-Engine is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * Emeraude-Engine is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with Emeraude-Engine; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * Complete project and additional information can be found at :
+ * https://github.com/londnoir/emeraude-engine
+ *
+ * --- THIS IS AUTOMATICALLY GENERATED, DO NOT CHANGE ---
+ */
+
+
+#pragma once
+
+/* STL inclusions. */
+#include <cstddef>
+#include <cstdint>
+#include <array>
+#include <atomic>
+#include <filesystem>
+#include <mutex>
+
+/* Local inclusions for usages. */
+#include "Types.hpp"
+#include "Wave.hpp"
+
+namespace EmEn::Libs::WaveFactory
+{
+	/**
+	 * @brief On-disk cache of waves already converted to a playback format.
+	 * @note A cached file is named after the source file hash and the target channels and frequency. It holds raw
+	 * 16-bit samples after a small header which must agree with the request, so a hit is a single mapped read.
+	 * The least recently used files are removed when the directory grows over the size limit. Without a directory,
+	 * the waves are converted on every request.
+	 */
+	class WaveCache final
+	{
+		public:
+
+			/** @brief Class identifier. */
+			static constexpr auto ClassId{"WaveCache"};
+
+			/** @brief The cached file extension. */
+			static constexpr auto FileExtension{".emwav"};
+
+			/** @brief The file magic number. */
+			static constexpr std::array< char, 8 > Magic{'E', 'M', 'W', 'A', 'V', '\0', '\r', '\n'};
+			/** @brief The current format version. It must be increased when the conversion output changes to invalidate caches. */
+			static constexpr uint32_t Version{1};
+
+			/**
+			 * @brief Constructs a wave cache without directory.
+			 */
+			WaveCache () noexcept = default;
+
+			/**
+			 * @brief Constructs a wave cache.
+			 * @param directory The directory of the cached files. It is created on the first write.
+			 * @param maximumBytes The size limit of the directory in bytes. 0 means no limit.
+			 */
+			WaveCache (std::filesystem::path directory, uint64_t maximumBytes) noexcept;
+
+			/**
+			 * @brief Copy constructor.
+			 * @param copy A reference to the copied instance.
+			 */
+			WaveCache (const WaveCache & copy) noexcept = delete;
+
+			/**
+			 * @brief Move constructor.
+			 * @param copy A reference to the copied instance.
+			 */
+			WaveCache (WaveCache && copy) noexcept = delete;
+
+			/**
+			 * @brief Copy assignment.
+			 * @param copy A reference to the copied instance.
+			 * @return WaveCache &
+			 */
+			WaveCache & operator= (const WaveCache & copy) noexcept = delete;
+
+			/**
+			 * @brief Move assignment.
+			 * @param copy A reference to the copied instance.
+			 * @return WaveCache &
+			 */
+			WaveCache & operator= (WaveCache && copy) noexcept = delete;
+
+			/**
+			 * @brief Destructs the wave cache.
+			 */
+			~WaveCache () = default;
+
+			/**
+			 * @brief Sets the directory of the cached files.
+			 * @param directory The directory of the cached files. It is created on the first write.
+			 * @return void
+			 */
+			void
+			setDirectory (const std::filesystem::path & directory) noexcept
+			{
+				m_directory = directory;
+			}
+
+			/**
+			 * @brief Returns the directory of the cached files.
+			 * @return const std::filesystem::path &
+			 */
+			[[nodiscard]]
+			const std::filesystem::path &
+			directory () const noexcept
+			{
+				return m_directory;
+			}
+
+			/**
+			 * @brief Sets the size limit of the directory.
+			 * @param maximumBytes The size in bytes. 0 means no limit.
+			 * @return void
+			 */
+			void
+			setMaximumBytes (uint64_t maximumBytes) noexcept
+			{
+				m_maximumBytes = maximumBytes;
+			}
+
+			/**
+			 * @brief Returns the size limit of the directory in bytes.
+			 * @return uint64_t
+			 */
+			[[nodiscard]]
+			uint64_t
+			maximumBytes () const noexcept
+			{
+				return m_maximumBytes;
+			}
+
+			/**
+			 * @brief Returns the path of the cached file for a source and its target format.
+			 * @param sourceHash The source file hash.
+			 * @param channels The target channels.
+			 * @param frequency The target frequency.
+			 * @return std::filesystem::path
+			 */
+			[[nodiscard]]
+			std::filesystem::path getFilepath (uint64_t sourceHash, Channels channels, Frequency frequency) const noexcept;
+
+			/**
+			 * @brief Reads a converted wave from the cache.
+			 * @param sourceHash The source file hash.
+			 * @param channels The target channels.
+			 * @param frequency The target frequency.
+			 * @param wave A reference to the wave.
+			 * @return bool
+			 */
+			bool read (uint64_t sourceHash, Channels channels, Frequency frequency, Wave< int16_t > & wave) noexcept;
+
+			/**
+			 * @brief Stores a converted wave in the cache and removes the oldest files over the size limit.
+			 * @param sourceHash The source file hash.
+			 * @param wave A reference to the converted wave.
+			 * @return bool
+			 */
+			bool store (uint64_t sourceHash, const Wave< int16_t > & wave) noexcept;
+
+			/**
+			 * @brief Gets a sound file converted to a playback format, from the cache or by converting and storing it.
+			 * @note Multichannel sources are mixed down to mono when requested, other channel changes are refused.
+			 * @param filepath A reference to the sound file path.
+			 * @param channels The target channels.
+			 * @param frequency The target frequency.
+			 * @param wave A reference to the wave.
+			 * @return bool
+			 */
+			bool get (const std::filesystem::path & filepath, Channels channels, Frequency frequency, Wave< int16_t > & wave) noexcept;
+
+			/**
+			 * @brief Removes the least recently used files until the directory fits the size limit.
+			 * @param keptFilepath A reference to a file path never removed. Default none.
+			 * @return void
+			 */
+			void evict (const std::filesystem::path & keptFilepath = {}) noexcept;
+
+			/**
+			 * @brief Returns the number of waves read from the cache.
+			 * @return size_t
+			 */
+			[[nodiscard]]
+			size_t
+			hits () const noexcept
+			{
+				return m_hits.load(std::memory_order_relaxed);
+			}
+
+			/**
+			 * @brief Returns the number of waves converted because they were not in the cache.
+			 * @return size_t
+			 */
+			[[nodiscard]]
+			size_t
+			misses () const noexcept
+			{
+				return m_misses.load(std::memory_order_relaxed);
+			}
+
+			/**
+			 * @brief Computes the hash of a file content.
+			 * @param filepath A reference to the file path.
+			 * @param hash A reference to the hash.
+			 * @return bool
+			 */
+			static bool computeFileHash (const std::filesystem::path & filepath, uint64_t & hash) noexcept;
+
+		private:
+
+			/** @brief The file header, followed by the interleaved 16-bit samples. */
+			struct FileHeader
+			{
+				std::array< char, 8 > magic;
+				uint32_t version;
+				uint32_t byteOrderMark;
+				uint64_t sourceHash;
+				uint32_t channels;
+				uint32_t frequency;
+				uint64_t frameCount;
+			};
+
+			static_assert(sizeof(FileHeader) == 40);
+
+			std::filesystem::path m_directory;
+			uint64_t m_maximumBytes{0};
+			std::mutex m_evictionAccess;
+			std::atomic< size_t > m_hits{0};
+			std::atomic< size_t > m_misses{0};
+	};
+}
@@ -39,7 +39,6 @@
 #include "Libs/Network/Network.hpp"
 #include "Libs/Network/URL.hpp"
 #include "Libs/Network/URI.hpp"
-#include "Libs/ParallelizableTrait.hpp"
 #include "Libs/IO/IO.hpp"
 #include "PrimaryServices.hpp"
 
@@ -50,8 +49,8 @@ namespace EmEn
 	const size_t NetworkManager::ClassUID{getClassUID(ClassId)};
 
 	NetworkManager::NetworkManager (PrimaryServices & primaryServices) noexcept
-		: ServiceInterface(ClassId), ParallelizableTrait(4),
-		  m_primaryServices(primaryServices)
+		: ServiceInterface(ClassId),
+		m_primaryServices(primaryServices)
 	{
 
 	}
@@ -101,7 +100,7 @@ namespace EmEn
 	bool
 	NetworkManager::onTerminate () noexcept
 	{
-		this->waitForAllJobsDone();
+		m_primaryServices.jobSystem().wait(m_downloadJobs);
 
 		return this->updateDownloadCacheDBFile();
 	}
@@ -295,13 +294,11 @@ namespace EmEn
 	}
 
 	bool
-	NetworkManager::task (const size_t & data) noexcept
+	NetworkManager::downloadTask (size_t ticket, Network::URL url, std::filesystem::path output) const noexcept
 	{
-		TraceInfo{ClassId} << "Launching the downloading task (" << data << ") ...";
+		TraceInfo{ClassId} << "Launching the downloading task (" << ticket << ") ...";
 
-		const auto & item = m_downloadItems.at(data);
-
-		return Network::download(item.url(), item.output(), true);
+		return Network::download(url, output, true);
 	}
 
 	int
@@ -327,7 +324,12 @@ namespace EmEn
 
 		m_downloadItems.emplace_back(url, output, replaceExistingFile);
 
-		this->createTask(ticket);
+		/* NOTE: The job works on copies, the download item list can grow meanwhile. */
+		const auto & item = m_downloadItems.back();
+
+		m_primaryServices.jobSystem().submit([this, ticket, url = item.url(), output = item.output()] () {
+			this->downloadTask(static_cast< size_t >(ticket), url, output);
+		}, m_downloadJobs, ThreadPool::Priority::Low);
 
 		return ticket;
 	}
@@ -35,10 +35,10 @@
 
 /* Local inclusions for inheritances. */
 #include "ServiceInterface.hpp"
-#include "Libs/ParallelizableTrait.hpp"
 
 /* Local inclusions for usages. */
 #include "Libs/Network/URL.hpp"
+#include "Libs/ThreadPool.hpp"
 #include "CachedDownloadItem.hpp"
 #include "DownloadItem.hpp"
 
@@ -52,10 +52,10 @@ namespace EmEn
 {
 	/**
 	 * @brief The network manager service class.
+	 * @note Downloads are executed as low priority jobs on the job system.
 	 * @extends EmEn::ServiceInterface This is a service.
-	 * @extends EmEn::Libs::ParallelizableTrait This needs to parallelize download processes.
 	 */
-	class NetworkManager final : public ServiceInterface, public Libs::ParallelizableTrait< size_t >
+	class NetworkManager final : public ServiceInterface
 	{
 		public:
 
@@ -170,8 +170,14 @@ namespace EmEn
 			/** @copydoc EmEn::ServiceInterface::onTerminate() */
 			bool onTerminate () noexcept override;
 
-			/** @copydoc EmEn::Libs::ParallelizableTrait::task() */
-			bool task (const size_t & data) noexcept override;
+			/**
+			 * @brief Executes a download on a job system worker.
+			 * @param ticket The download item index.
+			 * @param url The download URL [std::move].
+			 * @param output The download output path [std::move].
+			 * @return bool
+			 */
+			bool downloadTask (size_t ticket, Libs::Network::URL url, std::filesystem::path output) const noexcept;
 
 			/**
 			 * @brief Returns the download cache db filepath.
@@ -227,6 +233,7 @@ namespace EmEn
 			std::map< std::string, CachedDownloadItem > m_downloadCache;
 			size_t m_nextCacheItemId{1};
 			std::vector< DownloadItem > m_downloadItems;
+			Libs::JobGroup m_downloadJobs;
 			std::array< bool, 8 > m_flags{
 				false/*ServiceInitialized*/,
 				false/*DownloadEnabled*/,
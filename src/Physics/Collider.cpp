@@ -41,6 +41,36 @@ namespace EmEn::Physics
 
 	bool
 	Collider::checkCollisionAgainstMovable (AbstractEntity & movableEntityA, AbstractEntity & movableEntityB) noexcept
+	{
+		Contact contact;
+
+		if ( !findContactAgainstMovable(movableEntityA, movableEntityB, contact) )
+		{
+			return false;
+		}
+
+		this->applyContact(contact);
+
+		return true;
+	}
+
+	bool
+	Collider::checkCollisionAgainstStatic (AbstractEntity & movableEntityA, AbstractEntity & staticEntityB) noexcept
+	{
+		Contact contact;
+
+		if ( !findContactAgainstStatic(movableEntityA, staticEntityB, contact) )
+		{
+			return false;
+		}
+
+		this->applyContact(contact);
+
+		return true;
+	}
+
+	bool
+	Collider::findContactAgainstMovable (AbstractEntity & movableEntityA, AbstractEntity & movableEntityB, Contact & contact) noexcept
 	{
 		if constexpr ( IsDebug )
 		{
@@ -66,9 +96,7 @@ namespace EmEn::Physics
 				return false;
 			}
 
-			TraceDebug{ClassId} << "Sphere (" << movableEntityB.name() << ") to sphere (" << movableEntityA.name() << ") collision !\nMTV : " << minimalTranslationVector;
-
-			movableEntityA.move(-minimalTranslationVector, TransformSpace::World);
+			contact.correction = -minimalTranslationVector;
 		}
 		else
 		{
@@ -77,22 +105,18 @@ namespace EmEn::Physics
 				return false;
 			}
 
-			TraceDebug{ClassId} << "Box (" << movableEntityB.name() << ") to box (" << movableEntityA.name() << ") collision !\nMTV : " << minimalTranslationVector;
+			contact.correction.reset();
 		}
 
-		/* NOTE: Collision mid-point must be done after the move back! */
-		const auto collisionPosition = Vector< 3, float >::midPoint(
-			movableEntityA.getWorldCoordinates().position(),
-			movableEntityB.getWorldCoordinates().position()
-		);
+		contact.movableEntity = &movableEntityA;
+		contact.otherEntity = &movableEntityB;
+		contact.direction = -minimalTranslationVector.normalize();
 
-		this->addCollision(CollisionType::StaticEntity, &movableEntityB, collisionPosition, -minimalTranslationVector.normalize());
-		
 		return true;
 	}
-	
+
 	bool
-	Collider::checkCollisionAgainstStatic (AbstractEntity & movableEntityA, AbstractEntity & staticEntityB) noexcept
+	Collider::findContactAgainstStatic (AbstractEntity & movableEntityA, AbstractEntity & staticEntityB, Contact & contact) noexcept
 	{
 		Vector< 3, float > collisionDirection;
 		auto collisionOverflow = 0.0F;
@@ -100,8 +124,6 @@ namespace EmEn::Physics
 		/* TODO: Add sphere <> box collision. */
 		if ( movableEntityA.sphereCollisionIsEnabled() && staticEntityB.sphereCollisionIsEnabled() )
 		{
-			//TraceDebug{ClassId} << "Sphere (" << staticEntityB.name() << ") to sphere (" << movableEntityA.name() << ") collision ...";
-
 			if ( !isSphereCollisionWith(staticEntityB, movableEntityA, collisionOverflow, collisionDirection) )
 			{
 				return false;
@@ -109,26 +131,33 @@ namespace EmEn::Physics
 		}
 		else
 		{
-			//TraceDebug{ClassId} << "Box (" << staticEntityB.name() << ") to box (" << movableEntityA.name() << ") collision ...";
-
 			if ( !isBoxCollisionWith(staticEntityB, movableEntityA, collisionOverflow, collisionDirection) )
 			{
 				return false;
 			}
 		}
 
+		contact.movableEntity = &movableEntityA;
+		contact.otherEntity = &staticEntityB;
+		contact.correction = collisionDirection.scaled(collisionOverflow);
+		contact.direction = collisionDirection;
+
+		return true;
+	}
+
+	void
+	Collider::applyContact (const Contact & contact) noexcept
+	{
 		/* NOTE: Location correction. */
-		movableEntityA.move(collisionDirection.scaled(collisionOverflow), TransformSpace::World);
+		contact.movableEntity->move(contact.correction, TransformSpace::World);
 
-		/* NOTE: Collision declaration. */
+		/* NOTE: Collision mid-point must be done after the move back! */
 		const auto collisionPosition = Vector< 3, float >::midPoint(
-			movableEntityA.getWorldCoordinates().position(),
-			staticEntityB.getWorldCoordinates().position()
+			contact.movableEntity->getWorldCoordinates().position(),
+			contact.otherEntity->getWorldCoordinates().position()
 		);
 
-		this->addCollision(CollisionType::StaticEntity, &staticEntityB, collisionPosition, collisionDirection);
-
-		return true;
+		this->addCollision(CollisionType::StaticEntity, contact.otherEntity, collisionPosition, contact.direction);
 	}
 
 	void
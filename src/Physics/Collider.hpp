@@ -46,6 +46,18 @@ namespace EmEn::Physics
 			/** @brief Class identifier. */
 			static constexpr auto ClassId{"Collider"};
 
+			/**
+			 * @brief Structure describing a collision found by the narrow phase, not yet applied to the movable entity.
+			 * @note This allows to search collisions concurrently, then to apply them in a deterministic order.
+			 */
+			struct Contact
+			{
+				Scenes::AbstractEntity * movableEntity{nullptr};
+				Scenes::AbstractEntity * otherEntity{nullptr};
+				Libs::Math::Vector< 3, float > correction;
+				Libs::Math::Vector< 3, float > direction;
+			};
+
 			/**
 			 * @brief Constructs a default collider.
 			 */
@@ -67,6 +79,35 @@ namespace EmEn::Physics
 			 */
 			bool checkCollisionAgainstStatic (Scenes::AbstractEntity & movableEntityA, Scenes::AbstractEntity & staticEntityB) noexcept;
 
+			/**
+			 * @brief Searches a collision between two movable entities without modifying them.
+			 * @note This method is thread-safe as long as the entities are not modified at the same time.
+			 * @param movableEntityA A reference to the movable entity which will receive the collision.
+			 * @param movableEntityB A reference to a movable entity.
+			 * @param contact A reference to a contact structure to complete.
+			 * @return bool
+			 */
+			[[nodiscard]]
+			static bool findContactAgainstMovable (Scenes::AbstractEntity & movableEntityA, Scenes::AbstractEntity & movableEntityB, Contact & contact) noexcept;
+
+			/**
+			 * @brief Searches a collision between a movable entity and a static one without modifying them.
+			 * @note This method is thread-safe as long as the entities are not modified at the same time.
+			 * @param movableEntityA A reference to the movable entity which will receive the collision.
+			 * @param staticEntityB A reference to a static entity.
+			 * @param contact A reference to a contact structure to complete.
+			 * @return bool
+			 */
+			[[nodiscard]]
+			static bool findContactAgainstStatic (Scenes::AbstractEntity & movableEntityA, Scenes::AbstractEntity & staticEntityB, Contact & contact) noexcept;
+
+			/**
+			 * @brief Moves the movable entity out of the contact and registers the collision.
+			 * @param contact A reference to a contact found by the narrow phase.
+			 * @return void
+			 */
+			void applyContact (const Contact & contact) noexcept;
+
 			/**
 			 * @brief Adds a collision to the collection.
 			 * @param type The collision type.
@@ -44,7 +44,8 @@ namespace EmEn
 		m_arguments(argc, argv, false),
 		m_tracer(m_arguments, m_processName, false),
 		m_fileSystem(m_arguments, m_userInfo, identification, false),
-		m_settings(m_arguments, m_fileSystem, false)
+		m_settings(m_arguments, m_fileSystem, false),
+		m_jobSystem(m_systemInfo, m_settings)
 	{
 		/* NOTE: This must be done immediately! */
 		if ( !m_arguments.initialize(m_primaryServicesEnabled) )
@@ -63,7 +64,8 @@ namespace EmEn
 		m_arguments(argc, argv, true),
 		m_tracer(m_arguments, m_processName, true),
 		m_fileSystem(m_arguments, m_userInfo, identification, true),
-		m_settings(m_arguments, m_fileSystem, true)
+		m_settings(m_arguments, m_fileSystem, true),
+		m_jobSystem(m_systemInfo, m_settings)
 	{
 		m_flags[ChildProcess] = true;
 
@@ -89,7 +91,8 @@ namespace EmEn
 		: m_arguments(argc, wargv, false),
 		m_tracer(m_arguments, "main", false),
 		m_fileSystem(m_arguments, m_userInfo, identification, false),
-		m_settings(m_arguments, m_fileSystem, false)
+		m_settings(m_arguments, m_fileSystem, false),
+		m_jobSystem(m_systemInfo, m_settings)
 	{
 		/* NOTE: This must be done immediately! */
 		if ( !m_arguments.initialize(m_primaryServicesEnabled) )
@@ -107,7 +110,8 @@ namespace EmEn
 		: m_arguments(argc, wargv, true),
 		m_tracer(m_arguments, processName, true),
 		m_fileSystem(m_arguments, m_userInfo, identification, true),
-		m_settings(m_arguments, m_fileSystem, true)
+		m_settings(m_arguments, m_fileSystem, true),
+		m_jobSystem(m_systemInfo, m_settings)
 	{
 		m_flags[ChildProcess] = true;
 
@@ -188,6 +192,16 @@ namespace EmEn
 				"The engine will use the default configuration.";
 		}
 
+		/* Initialize the job system, after the settings to read the worker count. */
+		if ( m_jobSystem.initialize(m_primaryServicesEnabled) )
+		{
+			TraceSuccess{ClassId} << m_jobSystem.name() << " primary service up [" << m_processName << "] !";
+		}
+		else
+		{
+			TraceWarning{ClassId} << m_jobSystem.name() << " primary service failed to execute [" << m_processName << "] ! Jobs will be executed inline.";
+		}
+
 		return true;
 	}
 
@@ -39,6 +39,7 @@
 #include "Tracer.hpp"
 #include "FileSystem.hpp"
 #include "Settings.hpp"
+#include "JobSystem.hpp"
 
 namespace EmEn
 {
@@ -244,6 +245,28 @@ namespace EmEn
 				return m_settings;
 			}
 
+			/**
+			 * @brief Returns the reference to the job system service.
+			 * @return JobSystem &
+			 */
+			[[nodiscard]]
+			JobSystem &
+			jobSystem () noexcept
+			{
+				return m_jobSystem;
+			}
+
+			/**
+			 * @brief Returns the reference to the job system service.
+			 * @return const JobSystem &
+			 */
+			[[nodiscard]]
+			const JobSystem &
+			jobSystem () const noexcept
+			{
+				return m_jobSystem;
+			}
+
 			/**
 			 * @brief Returns general information about the primary services.
 			 * @return std::string
@@ -265,6 +288,7 @@ namespace EmEn
 			Tracer m_tracer;
 			FileSystem m_fileSystem;
 			Settings m_settings;
+			JobSystem m_jobSystem;
 			std::vector< ServiceInterface * > m_primaryServicesEnabled;
 			std::array< bool, 8 > m_flags{
 				false/*Initialized*/,
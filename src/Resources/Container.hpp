@@ -34,7 +34,6 @@
 #include <functional>
 #include <memory>
 #include <string>
-#include <thread>
 #include <tuple>
 #include <unordered_map>
 #include <utility>
@@ -50,6 +49,7 @@
 #include "DownloadItem.hpp"
 #include "PrimaryServices.hpp"
 #include "LoadingRequest.hpp"
+#include "LoadingPipeline.hpp"
 #include "NetworkManager.hpp"
 #include "Stores.hpp"
 #include "Types.hpp"
@@ -96,14 +96,16 @@ namespace EmEn::Resources
 			 * @param primaryServices A reference to the primary services.
 			 * @param networkManager A reference to the service responsible for download.
 			 * @param resourcesStores A reference to the service responsible for local resource stores.
+			 * @param loadingPipeline A reference to the resource loading pipeline.
 			 * @param serviceName The name of the service.
 			 * @param storeName The name of the resource store.
 			 */
-			Container (PrimaryServices & primaryServices, NetworkManager & networkManager, const Stores & resourcesStores, const char * serviceName, std::string storeName = "") noexcept
+			Container (PrimaryServices & primaryServices, NetworkManager & networkManager, const Stores & resourcesStores, LoadingPipeline & loadingPipeline, const char * serviceName, std::string storeName = "") noexcept
 				: ServiceInterface(serviceName),
 				m_primaryServices(primaryServices),
 				m_networkManager(networkManager),
 				m_resourcesStores(resourcesStores),
+				m_loadingPipeline(loadingPipeline),
 				m_storeName(std::move(storeName))
 			{
 				this->observe(&m_networkManager);
@@ -306,10 +308,11 @@ namespace EmEn::Resources
 			 * @brief Preloads asynchronously a resource.
 			 * @param resourceName A string with the name of the resource.
 			 * @param asyncLoad Load the resource asynchronously. Default true.
+			 * @param loadingPriority The loading priority, the lower the sooner. Default LoadingPipeline::DefaultPriority.
 			 * @return bool
 			 */
 			bool
-			preloadResource (const std::string & resourceName, bool asyncLoad = true)
+			preloadResource (const std::string & resourceName, bool asyncLoad = true, float loadingPriority = LoadingPipeline::DefaultPriority)
 			{
 				if ( this->isResourceLoaded(resourceName) )
 				{
@@ -336,7 +339,49 @@ namespace EmEn::Resources
 					return false;
 				}
 
-				return this->pushInLoadingQueue(resourceIt->second, asyncLoad) != nullptr;
+				return this->pushInLoadingQueue(resourceIt->second, asyncLoad, loadingPriority) != nullptr;
+			}
+
+			/**
+			 * @brief Changes the loading priority of a resource still in the loading pipeline.
+			 * @param resourceName A reference to a string for the resource name.
+			 * @param loadingPriority The loading priority, the lower the sooner.
+			 * @return bool
+			 */
+			bool
+			setLoadingPriority (const std::string & resourceName, float loadingPriority) noexcept
+			{
+				const auto ticket = this->findLoadingTicket(resourceName);
+
+				if ( ticket == nullptr )
+				{
+					return false;
+				}
+
+				ticket->setPriority(loadingPriority);
+
+				return true;
+			}
+
+			/**
+			 * @brief Cancels the loading of a resource no longer needed.
+			 * @note The resource ends with the failed status if it was still in the loading pipeline.
+			 * @param resourceName A reference to a string for the resource name.
+			 * @return bool
+			 */
+			bool
+			cancelLoading (const std::string & resourceName) noexcept
+			{
+				const auto ticket = this->findLoadingTicket(resourceName);
+
+				if ( ticket == nullptr )
+				{
+					return false;
+				}
+
+				ticket->cancel();
+
+				return true;
 			}
 
 			/**
@@ -344,11 +389,12 @@ namespace EmEn::Resources
 			 * @note The default resource of the store will be returned if nothing was found. A warning trace will be generated.
 			 * @param resourceName A reference to a string for the resource name.
 			 * @param asyncLoad Load the resource asynchronously. Default true.
+			 * @param loadingPriority The loading priority, the lower the sooner. Default LoadingPipeline::DefaultPriority.
 			 * @return std::shared_ptr< resource_t >
 			 */
 			[[nodiscard]]
 			std::shared_ptr< resource_t >
-			getResource (const std::string & resourceName, bool asyncLoad = true) noexcept
+			getResource (const std::string & resourceName, bool asyncLoad = true, float loadingPriority = LoadingPipeline::DefaultPriority) noexcept
 			{
 				if ( resourceName == Default )
 				{
@@ -361,6 +407,14 @@ namespace EmEn::Resources
 
 					if ( loadedIt != m_resources.cend() )
 					{
+						/* NOTE: A more urgent request raises the priority of a resource still in the loading pipeline. */
+						const auto ticket = loadedIt->second->loadingTicket();
+
+						if ( ticket != nullptr && loadingPriority < ticket->priority() )
+						{
+							ticket->setPriority(loadingPriority);
+						}
+
 						return loadedIt->second;
 					}
 				}
@@ -399,7 +453,7 @@ namespace EmEn::Resources
 				}
 
 				/* Returns the smart pointer to the future loaded resource. */
-				return this->pushInLoadingQueue(resourceIt->second, asyncLoad);
+				return this->pushInLoadingQueue(resourceIt->second, asyncLoad, loadingPriority);
 			}
 
 			/**
@@ -498,7 +552,7 @@ namespace EmEn::Resources
 					return nullptr;
 				}
 
-				std::thread generation{[] (const std::function< bool (resource_t & resource) > & createResource, const std::shared_ptr< resource_t > & resource) {
+				m_primaryServices.jobSystem().submit([createResource = createFunction, resource = newResource] () {
 					if ( createResource(*resource) )
 					{
 						switch ( resource->status() )
@@ -519,9 +573,7 @@ namespace EmEn::Resources
 					{
 						TraceError{resource_t::ClassId} << "The manual loading function has return an error !";
 					}
-				}, createFunction, newResource};
-
-				generation.detach();
+				}, m_loadingJobs);
 
 				return newResource;
 			}
@@ -620,6 +672,9 @@ namespace EmEn::Resources
 			{
 				m_flags[ServiceInitialized] = false;
 
+				/* NOTE: Loading jobs hold a pointer to this container. */
+				m_primaryServices.jobSystem().wait(m_loadingJobs);
+
 				if ( Stores::s_operationVerboseEnabled )
 				{
 					if ( m_storeName.empty() )
@@ -673,10 +728,7 @@ namespace EmEn::Resources
 
 									requestIt->second.setDownloadProcessed(m_primaryServices.fileSystem(), true);
 
-									/* Creates a loading thread. */
-									std::thread newTask(&Container::loadingTask, this, requestIt->second);
-
-									newTask.detach();
+									this->submitLoadingRequest(requestIt->second, LoadingPipeline::DefaultPriority);
 								}
 									break;
 
@@ -748,11 +800,12 @@ namespace EmEn::Resources
 			 * @brief Adds a resource to the loading queue.
 			 * @param baseInformation A reference to the base information of the resource to be loaded.
 			 * @param asyncLoad Load the resource asynchronously.
+			 * @param loadingPriority The loading priority, the lower the sooner. Default LoadingPipeline::DefaultPriority.
 			 * @return std::shared_ptr< resource_t >
 			 */
 			[[nodiscard]]
 			std::shared_ptr< resource_t >
-			pushInLoadingQueue (const BaseInformation & baseInformation, bool asyncLoad) noexcept
+			pushInLoadingQueue (const BaseInformation & baseInformation, bool asyncLoad, float loadingPriority = LoadingPipeline::DefaultPriority) noexcept
 			{
 				using namespace EmEn::Libs;
 
@@ -818,10 +871,7 @@ namespace EmEn::Resources
 					}
 					else
 					{
-						/* Create a thread for the resource loading. */
-						std::thread newTask(&Container::loadingTask, this, request);
-
-						newTask.detach();
+						this->submitLoadingRequest(request, loadingPriority);
 					}
 				}
 				else
@@ -835,12 +885,69 @@ namespace EmEn::Resources
 				return newResource;
 			}
 
+			/**
+			 * @brief Submits a loading request to the loading pipeline.
+			 * @note The read stage brings a local file into the system cache, the decode stage loads the resource.
+			 * The video memory creation is then deferred to the upload stage by the resource itself.
+			 * @param request A reference to the loading request.
+			 * @param loadingPriority The loading priority, the lower the sooner.
+			 * @return void
+			 */
+			void
+			submitLoadingRequest (const LoadingRequest< resource_t > & request, float loadingPriority) noexcept
+			{
+				const auto & infos = request.baseInformation();
+				const auto resource = request.resource();
+				const auto ticket = std::make_shared< LoadingTicket >(loadingPriority);
+
+				resource->setLoadingTicket(ticket);
+
+				LoadingPipeline::StageFunction readStage;
+
+				if ( infos.sourceType() == SourceType::LocalData )
+				{
+					readStage = [filepath = std::filesystem::path{infos.data().asString()}] () {
+						return Libs::IO::prefetchFile(filepath);
+					};
+				}
+
+				m_loadingPipeline.submit(ticket, infos.name(), {
+					std::move(readStage),
+					[this, request] () {
+						return this->loadingTask(request);
+					},
+					nullptr
+				}, [resource] () {
+					resource->abortLoading();
+				});
+			}
+
+			/**
+			 * @brief Finds the loading pipeline ticket of a resource.
+			 * @param resourceName A reference to a string for the resource name.
+			 * @return std::shared_ptr< LoadingTicket >
+			 */
+			[[nodiscard]]
+			std::shared_ptr< LoadingTicket >
+			findLoadingTicket (const std::string & resourceName) const noexcept
+			{
+				const auto resourceIt = m_resources.find(resourceName);
+
+				if ( resourceIt == m_resources.cend() )
+				{
+					return nullptr;
+				}
+
+				return resourceIt->second->loadingTicket();
+			}
+
 			/**
 			 * @brief Task for loading a resource on a thread.
 			 * @note Value must pass the request parameter.
 			 * @param request The loading request.
+			 * @return bool
 			 */
-			void
+			bool
 			loadingTask (LoadingRequest< resource_t > request) noexcept
 			{
 				using namespace EmEn::Libs;
@@ -903,6 +1010,8 @@ namespace EmEn::Resources
 
 				/* Notify the end of the loading process. */
 				this->notify(LoadingProcessFinished);
+
+				return success;
 			}
 
 			/* Flag names. */
@@ -911,9 +1020,11 @@ namespace EmEn::Resources
 			PrimaryServices & m_primaryServices;
 			NetworkManager & m_networkManager;
 			const Stores & m_resourcesStores;
+			LoadingPipeline & m_loadingPipeline;
 			std::string m_storeName;
 			std::unordered_map< std::string, std::shared_ptr< resource_t > > m_resources;
 			std::unordered_map< int, LoadingRequest< resource_t > > m_externalResources;
+			Libs::JobGroup m_loadingJobs;
 			std::array< bool, 8 > m_flags{
 				false/*ServiceInitialized*/,
 				false/*UNUSED*/,
@@ -0,0 +1,489 @@
+/*
+ * src/Resources/LoadingPipeline.cpp
+ * This file is part of Emeraude-Engine
+ *
+ * Copyright (C) 2010-2025 - Sébastien Léon Claude Christian Bémelmans "LondNoir" <londnoir@gmail.com>
+ *
+ * Emeraude-Engine is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * Emeraude-Engine is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with Emeraude-Engine; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * Complete project and additional information can be found at :
+ * https://github.com/londnoir/emeraude-engine
+ *
+ * --- THIS IS AUTOMATICALLY GENERATED, DO NOT CHANGE ---
+ */
+
+#include "LoadingPipeline.hpp"
+
+/* STL inclusions. */
+#include <algorithm>
+#include <sstream>
+#include <utility>
+
+/* Local inclusions. */
+#include "FrameProfiler.hpp"
+#include "PrimaryServices.hpp"
+#include "SettingKeys.hpp"
+#include "Tracer.hpp"
+
+namespace EmEn::Resources
+{
+	using namespace EmEn::Libs;
+
+	const size_t LoadingPipeline::ClassUID{getClassUID(ClassId)};
+
+	/** @brief The frame profiler scope names of stages. */
+	static constexpr std::array< const char *, LoadingStageCount > StageProfileScopeNames{"Resources::Read", "Resources::Decode", "Resources::Upload"};
+
+	const char *
+	to_cstring (LoadingStage value) noexcept
+	{
+		switch ( value )
+		{
+			case LoadingStage::Read :
+				return ReadString;
+
+			case LoadingStage::Decode :
+				return DecodeString;
+
+			case LoadingStage::Upload :
+				return UploadString;
+		}
+
+		return ReadString;
+	}
+
+	LoadingPipeline::LoadingPipeline (PrimaryServices & primaryServices) noexcept
+		: ServiceInterface(ClassId),
+		m_primaryServices(primaryServices)
+	{
+
+	}
+
+	bool
+	LoadingPipeline::onInitialize () noexcept
+	{
+		auto & settings = m_primaryServices.settings();
+
+		const auto capacity = std::max< size_t >(1, settings.get< uint32_t >(ResourcesLoadingQueueCapacityKey, DefaultResourcesLoadingQueueCapacity));
+		const auto readConcurrency = settings.get< uint32_t >(ResourcesReadConcurrencyKey, DefaultResourcesReadConcurrency);
+		const auto decodeConcurrency = settings.get< uint32_t >(ResourcesDecodeConcurrencyKey, DefaultResourcesDecodeConcurrency);
+		const auto uploadConcurrency = settings.get< uint32_t >(ResourcesUploadConcurrencyKey, DefaultResourcesUploadConcurrency);
+
+		{
+			const std::lock_guard< std::mutex > lock{m_mutex};
+
+			m_stages = {};
+
+			for ( auto & stage : m_stages )
+			{
+				stage.capacity = capacity;
+			}
+
+			m_stages[static_cast< size_t >(LoadingStage::Read)].concurrency = std::max< size_t >(1, readConcurrency);
+			m_stages[static_cast< size_t >(LoadingStage::Decode)].concurrency = decodeConcurrency > 0 ? decodeConcurrency : std::max< size_t >(1, m_primaryServices.jobSystem().workerCount());
+			m_stages[static_cast< size_t >(LoadingStage::Upload)].concurrency = std::max< size_t >(1, uploadConcurrency);
+
+			m_flags[ShowInformation] = settings.get< bool >(ResourcesShowInformationKey, DefaultResourcesShowInformation);
+			m_flags[ServiceInitialized] = true;
+		}
+
+		return true;
+	}
+
+	bool
+	LoadingPipeline::onTerminate () noexcept
+	{
+		std::vector< std::shared_ptr< Request > > aborts;
+
+		{
+			const std::lock_guard< std::mutex > lock{m_mutex};
+
+			m_flags[ServiceInitialized] = false;
+
+			/* NOTE: Queued requests will never start, running ones are completed. */
+			for ( auto & stage : m_stages )
+			{
+				stage.cancelled += stage.queue.size();
+
+				aborts.insert(aborts.end(), stage.queue.begin(), stage.queue.end());
+
+				stage.queue.clear();
+			}
+		}
+
+		m_roomAvailable.notify_all();
+
+		this->launch({}, aborts);
+
+		m_primaryServices.jobSystem().wait(m_jobs);
+
+		if ( m_flags[ShowInformation] )
+		{
+			TraceInfo{ClassId} << *this;
+		}
+
+		return true;
+	}
+
+	void
+	LoadingPipeline::submit (const std::shared_ptr< LoadingTicket > & ticket, const std::string & name, std::array< StageFunction, LoadingStageCount > stages, AbortFunction abortFunction) noexcept
+	{
+		auto request = std::make_shared< Request >();
+		request->ticket = ticket;
+		request->name = name;
+		request->stages = std::move(stages);
+		request->abortFunction = std::move(abortFunction);
+
+		const auto firstStage = nextStage(*request, 0);
+
+		if ( firstStage >= LoadingStageCount )
+		{
+			return;
+		}
+
+		std::vector< std::shared_ptr< Request > > launches;
+		std::vector< std::shared_ptr< Request > > aborts;
+
+		{
+			std::unique_lock< std::mutex > lock{m_mutex};
+
+			if ( !m_flags[ServiceInitialized] )
+			{
+				lock.unlock();
+
+				executeInline(*request);
+
+				return;
+			}
+
+			auto & stage = m_stages[firstStage];
+
+			/* NOTE: Backpressure. A job submitting a dependency is never blocked, it would hold a worker the queues need to drain. */
+			if ( stage.queue.size() >= stage.capacity && !m_primaryServices.jobSystem().isWorkerThread() )
+			{
+				stage.stalls++;
+
+				m_roomAvailable.wait(lock, [this, &stage] () {
+					return stage.queue.size() < stage.capacity || !m_flags[ServiceInitialized];
+				});
+
+				if ( !m_flags[ServiceInitialized] )
+				{
+					lock.unlock();
+
+					executeInline(*request);
+
+					return;
+				}
+			}
+
+			this->enqueue(request, firstStage);
+
+			this->dispatch(launches, aborts);
+		}
+
+		this->launch(launches, aborts);
+	}
+
+	LoadingPipeline::StageMetrics
+	LoadingPipeline::metrics (LoadingStage stage) const noexcept
+	{
+		const std::lock_guard< std::mutex > lock{m_mutex};
+
+		const auto & data = m_stages[static_cast< size_t >(stage)];
+		const auto executed = data.processed + data.failed;
+
+		StageMetrics metrics;
+		metrics.queued = data.queue.size();
+		metrics.running = data.running;
+		metrics.capacity = data.capacity;
+		metrics.concurrency = data.concurrency;
+		metrics.maxQueued = data.maxQueued;
+		metrics.processed = data.processed;
+		metrics.failed = data.failed;
+		metrics.cancelled = data.cancelled;
+		metrics.stalls = data.stalls;
+		metrics.maxWaitTime = data.maxWaitTime;
+
+		if ( executed > 0 )
+		{
+			metrics.averageWaitTime = data.totalWaitTime / static_cast< double >(executed);
+			metrics.averageRunTime = data.totalRunTime / static_cast< double >(executed);
+		}
+
+		return metrics;
+	}
+
+	size_t
+	LoadingPipeline::nextStage (const Request & request, size_t fromStage) noexcept
+	{
+		for ( auto stageIndex = fromStage; stageIndex < LoadingStageCount; stageIndex++ )
+		{
+			if ( request.stages[stageIndex] )
+			{
+				return stageIndex;
+			}
+		}
+
+		return LoadingStageCount;
+	}
+
+	void
+	LoadingPipeline::enqueue (const std::shared_ptr< Request > & request, size_t stageIndex) noexcept
+	{
+		auto & stage = m_stages[stageIndex];
+
+		request->stage = stageIndex;
+		request->sequence = m_nextSequence++;
+		request->enqueueTime = Clock::now();
+
+		stage.queue.emplace_back(request);
+		stage.maxQueued = std::max(stage.maxQueued, stage.queue.size());
+	}
+
+	void
+	LoadingPipeline::dispatch (std::vector< std::shared_ptr< Request > > & launches, std::vector< std::shared_ptr< Request > > & aborts) noexcept
+	{
+		/* NOTE: The last stages first, they free the room the previous ones are waiting for. */
+		for ( auto stageIndex = LoadingStageCount; stageIndex-- > 0; )
+		{
+			auto & stage = m_stages[stageIndex];
+
+			/* NOTE: Cancelled requests leave the queue without running. */
+			const auto removed = std::ranges::remove_if(stage.queue, [&aborts] (const auto & request) {
+				if ( !request->ticket->isCancelled() )
+				{
+					return false;
+				}
+
+				aborts.emplace_back(request);
+
+				return true;
+			});
+
+			stage.cancelled += static_cast< uint64_t >(std::ranges::distance(removed));
+
+			stage.queue.erase(removed.begin(), removed.end());
+
+			while ( stage.running < stage.concurrency && !stage.queue.empty() )
+			{
+				/* NOTE: Priorities can change at any time, so the queue is scanned instead of being kept sorted.
+				 * The queue is bounded, the cost stays small. */
+				const auto best = std::ranges::min_element(stage.queue, [] (const auto & requestA, const auto & requestB) {
+					const auto priorityA = requestA->ticket->priority();
+					const auto priorityB = requestB->ticket->priority();
+
+					if ( priorityA != priorityB )
+					{
+						return priorityA < priorityB;
+					}
+
+					return requestA->sequence < requestB->sequence;
+				});
+
+				const auto followingStage = nextStage(**best, stageIndex + 1);
+
+				if ( followingStage < LoadingStageCount )
+				{
+					auto & next = m_stages[followingStage];
+
+					if ( next.queue.size() + next.incoming >= next.capacity )
+					{
+						break;
+					}
+
+					next.incoming++;
+				}
+
+				const auto waitTime = std::chrono::duration< double, std::milli >(Clock::now() - (*best)->enqueueTime).count();
+
+				stage.totalWaitTime += waitTime;
+				stage.maxWaitTime = std::max(stage.maxWaitTime, waitTime);
+				stage.running++;
+
+				launches.emplace_back(*best);
+
+				stage.queue.erase(best);
+			}
+		}
+	}
+
+	void
+	LoadingPipeline::launch (const std::vector< std::shared_ptr< Request > > & launches, const std::vector< std::shared_ptr< Request > > & aborts) noexcept
+	{
+		if ( !aborts.empty() )
+		{
+			m_roomAvailable.notify_all();
+
+			for ( const auto & request : aborts )
+			{
+				if ( request->abortFunction )
+				{
+					request->abortFunction();
+				}
+			}
+		}
+
+		if ( !launches.empty() )
+		{
+			m_roomAvailable.notify_all();
+
+			for ( const auto & request : launches )
+			{
+				/* NOTE: The last stages have a higher priority to free the memory held by the requests sooner. */
+				ThreadPool::Priority priority{ThreadPool::Priority::Normal};
+
+				switch ( static_cast< LoadingStage >(request->stage) )
+				{
+					case LoadingStage::Read :
+						priority = ThreadPool::Priority::Low;
+						break;
+
+					case LoadingStage::Decode :
+						priority = ThreadPool::Priority::Normal;
+						break;
+
+					case LoadingStage::Upload :
+						priority = ThreadPool::Priority::High;
+						break;
+				}
+
+				m_primaryServices.jobSystem().submit([this, request] () {
+					this->execute(request);
+				}, m_jobs, priority);
+			}
+		}
+	}
+
+	void
+	LoadingPipeline::execute (const std::shared_ptr< Request > & request) noexcept
+	{
+		const auto stageIndex = request->stage;
+		const auto startTime = Clock::now();
+
+		bool success = false;
+
+		{
+			const ProfileScope profileScope{StageProfileScopeNames[stageIndex]};
+
+			success = !request->ticket->isCancelled() && request->stages[stageIndex]();
+		}
+
+		const auto runTime = std::chrono::duration< double, std::milli >(Clock::now() - startTime).count();
+
+		std::vector< std::shared_ptr< Request > > launches;
+		std::vector< std::shared_ptr< Request > > aborts;
+
+		{
+			const std::lock_guard< std::mutex > lock{m_mutex};
+
+			auto & stage = m_stages[stageIndex];
+			stage.running--;
+			stage.totalRunTime += runTime;
+
+			const auto followingStage = nextStage(*request, stageIndex + 1);
+
+			if ( followingStage < LoadingStageCount )
+			{
+				m_stages[followingStage].incoming--;
+			}
+
+			if ( request->ticket->isCancelled() )
+			{
+				stage.cancelled++;
+
+				aborts.emplace_back(request);
+			}
+			else if ( !success )
+			{
+				stage.failed++;
+
+				TraceWarning{ClassId} << "The request '" << request->name << "' failed at the " << to_cstring(static_cast< LoadingStage >(stageIndex)) << " stage !";
+
+				aborts.emplace_back(request);
+			}
+			else
+			{
+				stage.processed++;
+
+				if ( followingStage < LoadingStageCount )
+				{
+					if ( m_flags[ServiceInitialized] )
+					{
+						this->enqueue(request, followingStage);
+					}
+					else
+					{
+						m_stages[followingStage].cancelled++;
+
+						aborts.emplace_back(request);
+					}
+				}
+			}
+
+			this->dispatch(launches, aborts);
+		}
+
+		this->launch(launches, aborts);
+	}
+
+	void
+	LoadingPipeline::executeInline (const Request & request) noexcept
+	{
+		for ( auto stageIndex = nextStage(request, 0); stageIndex < LoadingStageCount; stageIndex = nextStage(request, stageIndex + 1) )
+		{
+			if ( request.ticket->isCancelled() || !request.stages[stageIndex]() )
+			{
+				if ( request.abortFunction )
+				{
+					request.abortFunction();
+				}
+
+				return;
+			}
+		}
+	}
+
+	std::ostream &
+	operator<< (std::ostream & out, const LoadingPipeline & obj)
+	{
+		out << "Resource loading pipeline :" "\n";
+
+		for ( const auto stage : {LoadingStage::Read, LoadingStage::Decode, LoadingStage::Upload} )
+		{
+			const auto metrics = obj.metrics(stage);
+
+			out <<
+				" - " << to_cstring(stage) << " : " <<
+				metrics.queued << "/" << metrics.capacity << " queued (max " << metrics.maxQueued << "), " <<
+				metrics.running << "/" << metrics.concurrency << " running, " <<
+				metrics.processed << " processed, " << metrics.failed << " failed, " << metrics.cancelled << " cancelled, " << metrics.stalls << " stalls, "
+				"wait " << metrics.averageWaitTime << " ms (max " << metrics.maxWaitTime << " ms), "
+				"run " << metrics.averageRunTime << " ms" "\n";
+		}
+
+		return out;
+	}
+
+	std::string
+	to_string (const LoadingPipeline & obj) noexcept
+	{
+		std::stringstream output;
+
+		output << obj;
+
+		return output.str();
+	}
+}
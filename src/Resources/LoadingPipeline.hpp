@@ -0,0 +1,458 @@
+/*
+ * src/Resources/LoadingPipeline.hpp
+ * This file is part of Emeraude-Engine
+ *
+ * Copyright (C) 2010-2025 - Sébastien Léon Claude Christian Bémelmans "LondNoir" <londnoir@gmail.com>
+ *
+ * Emeraude-Engine is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * Emeraude-Engine is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with Emeraude-Engine; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * Complete project and additional information can be found at :
+ * https://github.com/londnoir/emeraude-engine
+ *
+ * --- THIS IS AUTOMATICALLY GENERATED, DO NOT CHANGE ---
+ */
+
+#pragma once
+
+/* STL inclusions. */
+#include <cstddef>
+#include <cstdint>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <vector>
+
+/* Local inclusions for inheritances. */
+#include "ServiceInterface.hpp"
+
+/* Local inclusions for usages. */
+#include "Libs/ThreadPool.hpp"
+
+/* Forward declarations. */
+namespace EmEn
+{
+	class PrimaryServices;
+}
+
+namespace EmEn::Resources
+{
+	/**
+	 * @brief The resource loading pipeline stages, in execution order.
+	 */
+	enum class LoadingStage : uint8_t
+	{
+		/* Brings the source file from the storage device (I/O bound). */
+		Read = 0,
+		/* Decodes the source into the resource local data (CPU bound). */
+		Decode = 1,
+		/* Creates the resource on the video memory once its dependencies are loaded. */
+		Upload = 2
+	};
+
+	/** @brief Number of loading pipeline stages. */
+	static constexpr auto LoadingStageCount{3UL};
+
+	static constexpr auto ReadString{"Read"};
+	static constexpr auto DecodeString{"Decode"};
+	static constexpr auto UploadString{"Upload"};
+
+	/**
+	 * @brief Converts a loading stage enumeration value to the corresponding string.
+	 * @param value The enumeration value.
+	 * @return const char *
+	 */
+	[[nodiscard]]
+	const char * to_cstring (LoadingStage value) noexcept;
+
+	/**
+	 * @brief Returns a string version of the enum value.
+	 * @param value The enum value.
+	 * @return std::string
+	 */
+	[[nodiscard]]
+	inline
+	std::string
+	to_string (LoadingStage value) noexcept
+	{
+		return {to_cstring(value)};
+	}
+
+	/**
+	 * @brief Handle shared between a loading request and its owner, to follow it through the pipeline stages.
+	 * @note The lower the priority value, the sooner the request is processed. A distance to the camera fits.
+	 */
+	class LoadingTicket final
+	{
+		public:
+
+			/**
+			 * @brief Constructs a loading ticket.
+			 * @param priority The initial priority.
+			 */
+			explicit
+			LoadingTicket (float priority) noexcept
+				: m_priority(priority)
+			{
+
+			}
+
+			/**
+			 * @brief Copy constructor.
+			 * @param copy A reference to the copied instance.
+			 */
+			LoadingTicket (const LoadingTicket & copy) noexcept = delete;
+
+			/**
+			 * @brief Move constructor.
+			 * @param copy A reference to the copied instance.
+			 */
+			LoadingTicket (LoadingTicket && copy) noexcept = delete;
+
+			/**
+			 * @brief Copy assignment.
+			 * @param copy A reference to the copied instance.
+			 * @return LoadingTicket &
+			 */
+			LoadingTicket & operator= (const LoadingTicket & copy) noexcept = delete;
+
+			/**
+			 * @brief Move assignment.
+			 * @param copy A reference to the copied instance.
+			 * @return LoadingTicket &
+			 */
+			LoadingTicket & operator= (LoadingTicket && copy) noexcept = delete;
+
+			/**
+			 * @brief Destructs the loading ticket.
+			 */
+			~LoadingTicket () = default;
+
+			/**
+			 * @brief Changes the request priority. It takes effect on the next stage queue selection.
+			 * @param priority The new priority.
+			 * @return void
+			 */
+			void
+			setPriority (float priority) noexcept
+			{
+				m_priority.store(priority, std::memory_order_relaxed);
+			}
+
+			/**
+			 * @brief Returns the request priority.
+			 * @return float
+			 */
+			[[nodiscard]]
+			float
+			priority () const noexcept
+			{
+				return m_priority.load(std::memory_order_relaxed);
+			}
+
+			/**
+			 * @brief Cancels the request. A stage already running is completed, the next ones are skipped.
+			 * @return void
+			 */
+			void
+			cancel () noexcept
+			{
+				m_cancelled.store(true, std::memory_order_relaxed);
+			}
+
+			/**
+			 * @brief Returns whether the request has been cancelled.
+			 * @return bool
+			 */
+			[[nodiscard]]
+			bool
+			isCancelled () const noexcept
+			{
+				return m_cancelled.load(std::memory_order_relaxed);
+			}
+
+		private:
+
+			std::atomic< float > m_priority;
+			std::atomic< bool > m_cancelled{false};
+	};
+
+	/**
+	 * @brief The resource loading pipeline service.
+	 * @note Each stage owns a bounded queue sorted by priority and runs a limited number of jobs on the job system.
+	 * A stage only starts a job when the next stage has room for it, so a slow stage holds back the previous ones.
+	 * A thread outside the job system submitting to a full queue is blocked until room is made.
+	 * @extends EmEn::ServiceInterface This is a service.
+	 */
+	class LoadingPipeline final : public ServiceInterface
+	{
+		public:
+
+			/** @brief Class identifier. */
+			static constexpr auto ClassId{"LoadingPipelineService"};
+
+			/** @brief Observable class unique identifier. */
+			static const size_t ClassUID;
+
+			/** @brief The priority of a request without distance information. */
+			static constexpr auto DefaultPriority{0.0F};
+
+			/** @brief A stage function, returning false stops the request. */
+			using StageFunction = std::function< bool () >;
+
+			/** @brief A function called when a request is cancelled or a stage failed. */
+			using AbortFunction = std::function< void () >;
+
+			/**
+			 * @brief Per-stage metrics.
+			 */
+			struct StageMetrics
+			{
+				/* Current state. */
+				size_t queued{0};
+				size_t running{0};
+				/* Configuration. */
+				size_t capacity{0};
+				size_t concurrency{0};
+				/* Counters since the service started. */
+				size_t maxQueued{0};
+				uint64_t processed{0};
+				uint64_t failed{0};
+				uint64_t cancelled{0};
+				/* NOTE: Number of submissions blocked by a full queue. */
+				uint64_t stalls{0};
+				/* Latencies in milliseconds. The wait time is spent in the queue, the run time in the stage function. */
+				double averageWaitTime{0.0};
+				double maxWaitTime{0.0};
+				double averageRunTime{0.0};
+			};
+
+			/**
+			 * @brief Constructs the loading pipeline.
+			 * @param primaryServices A reference to primary services.
+			 */
+			explicit LoadingPipeline (PrimaryServices & primaryServices) noexcept;
+
+			/**
+			 * @brief Copy constructor.
+			 * @param copy A reference to the copied instance.
+			 */
+			LoadingPipeline (const LoadingPipeline & copy) noexcept = delete;
+
+			/**
+			 * @brief Move constructor.
+			 * @param copy A reference to the copied instance.
+			 */
+			LoadingPipeline (LoadingPipeline && copy) noexcept = delete;
+
+			/**
+			 * @brief Copy assignment.
+			 * @param copy A reference to the copied instance.
+			 * @return LoadingPipeline &
+			 */
+			LoadingPipeline & operator= (const LoadingPipeline & copy) noexcept = delete;
+
+			/**
+			 * @brief Move assignment.
+			 * @param copy A reference to the copied instance.
+			 * @return LoadingPipeline &
+			 */
+			LoadingPipeline & operator= (LoadingPipeline && copy) noexcept = delete;
+
+			/**
+			 * @brief Destructs the loading pipeline.
+			 */
+			~LoadingPipeline () override = default;
+
+			/** @copydoc EmEn::Libs::ObservableTrait::classUID() const */
+			[[nodiscard]]
+			size_t
+			classUID () const noexcept override
+			{
+				return ClassUID;
+			}
+
+			/** @copydoc EmEn::Libs::ObservableTrait::is() const */
+			[[nodiscard]]
+			bool
+			is (size_t classUID) const noexcept override
+			{
+				return classUID == ClassUID;
+			}
+
+			/** @copydoc EmEn::ServiceInterface::usable() */
+			[[nodiscard]]
+			bool
+			usable () const noexcept override
+			{
+				return m_flags[ServiceInitialized];
+			}
+
+			/**
+			 * @brief Submits a loading request.
+			 * @note Empty stage functions are skipped. When the service is not running, the stages are executed inline.
+			 * @param ticket A reference to the request ticket smart pointer.
+			 * @param name A reference to a string to identify the request in logs.
+			 * @param stages The stage functions in the stage order [std::move].
+			 * @param abortFunction The function called if the request is cancelled or if a stage fails [std::move]. Default none.
+			 * @return void
+			 */
+			void submit (const std::shared_ptr< LoadingTicket > & ticket, const std::string & name, std::array< StageFunction, LoadingStageCount > stages, AbortFunction abortFunction = {}) noexcept;
+
+			/**
+			 * @brief Returns the metrics of a stage.
+			 * @param stage The stage.
+			 * @return StageMetrics
+			 */
+			[[nodiscard]]
+			StageMetrics metrics (LoadingStage stage) const noexcept;
+
+			/**
+			 * @brief STL streams printable object.
+			 * @param out A reference to the stream output.
+			 * @param obj A reference to the object to print.
+			 * @return std::ostream &
+			 */
+			friend std::ostream & operator<< (std::ostream & out, const LoadingPipeline & obj);
+
+			/**
+			 * @brief Stringifies the object.
+			 * @param obj A reference to the object to print.
+			 * @return std::string
+			 */
+			friend std::string to_string (const LoadingPipeline & obj) noexcept;
+
+		private:
+
+			using Clock = std::chrono::steady_clock;
+
+			/** @copydoc EmEn::ServiceInterface::onInitialize() */
+			bool onInitialize () noexcept override;
+
+			/** @copydoc EmEn::ServiceInterface::onTerminate() */
+			bool onTerminate () noexcept override;
+
+			/**
+			 * @brief A request going through the stages.
+			 */
+			struct Request
+			{
+				std::shared_ptr< LoadingTicket > ticket;
+				std::string name;
+				std::array< StageFunction, LoadingStageCount > stages;
+				AbortFunction abortFunction;
+				size_t stage{0};
+				uint64_t sequence{0};
+				Clock::time_point enqueueTime;
+			};
+
+			/**
+			 * @brief A stage queue and its statistics.
+			 */
+			struct Stage
+			{
+				std::vector< std::shared_ptr< Request > > queue;
+				size_t running{0};
+				/* NOTE: Running jobs of the previous stages which will enter this stage. */
+				size_t incoming{0};
+				size_t capacity{0};
+				size_t concurrency{0};
+				size_t maxQueued{0};
+				uint64_t processed{0};
+				uint64_t failed{0};
+				uint64_t cancelled{0};
+				uint64_t stalls{0};
+				double totalWaitTime{0.0};
+				double maxWaitTime{0.0};
+				double totalRunTime{0.0};
+			};
+
+			/**
+			 * @brief Returns the index of the next stage with a function, or LoadingStageCount.
+			 * @param request A reference to the request.
+			 * @param fromStage The first stage index to check.
+			 * @return size_t
+			 */
+			[[nodiscard]]
+			static size_t nextStage (const Request & request, size_t fromStage) noexcept;
+
+			/**
+			 * @brief Adds a request to a stage queue.
+			 * @warning The mutex must be locked.
+			 * @param request A reference to the request smart pointer.
+			 * @param stageIndex The stage index.
+			 * @return void
+			 */
+			void enqueue (const std::shared_ptr< Request > & request, size_t stageIndex) noexcept;
+
+			/**
+			 * @brief Selects the requests to start according to priorities, concurrency and room in the next stages.
+			 * @warning The mutex must be locked.
+			 * @param launches A reference to the list of requests to start.
+			 * @param aborts A reference to the list of requests to abort.
+			 * @return void
+			 */
+			void dispatch (std::vector< std::shared_ptr< Request > > & launches, std::vector< std::shared_ptr< Request > > & aborts) noexcept;
+
+			/**
+			 * @brief Starts jobs and calls the abort functions selected by dispatch().
+			 * @warning The mutex must not be locked.
+			 * @param launches A reference to the list of requests to start.
+			 * @param aborts A reference to the list of requests to abort.
+			 * @return void
+			 */
+			void launch (const std::vector< std::shared_ptr< Request > > & launches, const std::vector< std::shared_ptr< Request > > & aborts) noexcept;
+
+			/**
+			 * @brief Executes the current stage of a request on a job system worker.
+			 * @param request A reference to the request smart pointer.
+			 * @return void
+			 */
+			void execute (const std::shared_ptr< Request > & request) noexcept;
+
+			/**
+			 * @brief Executes every stage of a request on the calling thread.
+			 * @param request A reference to the request.
+			 * @return void
+			 */
+			static void executeInline (const Request & request) noexcept;
+
+			/* Flag names. */
+			static constexpr auto ServiceInitialized{0UL};
+			static constexpr auto ShowInformation{1UL};
+
+			PrimaryServices & m_primaryServices;
+			std::array< Stage, LoadingStageCount > m_stages{};
+			uint64_t m_nextSequence{0};
+			Libs::JobGroup m_jobs;
+			mutable std::mutex m_mutex;
+			std::condition_variable m_roomAvailable;
+			std::array< bool, 8 > m_flags{
+				false/*ServiceInitialized*/,
+				false/*ShowInformation*/,
+				false/*UNUSED*/,
+				false/*UNUSED*/,
+				false/*UNUSED*/,
+				false/*UNUSED*/,
+				false/*UNUSED*/,
+				false/*UNUSED*/
+			};
+	};
+}
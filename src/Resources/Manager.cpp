@@ -134,6 +134,16 @@ namespace EmEn::Resources
 
 		ResourceTrait::s_quietConversion = m_primaryServices.settings().get< bool >(ResourcesQuietConversionKey, DefaultResourcesQuietConversion);
 
+		/* NOTE: The loading pipeline is not registered in the service list, it must be terminated before the resource containers. */
+		if ( m_loadingPipeline.initialize() )
+		{
+			TraceSuccess{ClassId} << m_loadingPipeline.name() << " service up !";
+		}
+		else
+		{
+			TraceError{ClassId} << m_loadingPipeline.name() << " service failed to execute ! Resources will be loaded synchronously.";
+		}
+
 		/* Initialize every resource managers. */
 		{
 			const std::array< ServiceInterface *, 26 > resourceContainers{
@@ -184,6 +194,16 @@ namespace EmEn::Resources
 	bool
 	Manager::onTerminate () noexcept
 	{
+		/* NOTE: Stop the loading requests first, they use the resource containers. */
+		if ( m_loadingPipeline.terminate() )
+		{
+			TraceSuccess{ClassId} << m_loadingPipeline.name() << " service terminated gracefully !";
+		}
+		else
+		{
+			TraceError{ClassId} << m_loadingPipeline.name() << " service failed to terminate properly !";
+		}
+
 		/* Terminate primary services. */
 		for ( auto * resourceContainer : std::ranges::reverse_view(m_servicesEnabled) )
 		{
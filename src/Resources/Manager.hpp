@@ -60,6 +60,7 @@
 #include "Graphics/TextureResource/Texture3D.hpp"
 #include "Graphics/TextureResource/TextureCubemap.hpp"
 #include "Scenes/DefinitionResource.hpp"
+#include "LoadingPipeline.hpp"
 #include "Stores.hpp"
 
 /* Forward declarations. */
@@ -178,6 +179,28 @@ namespace EmEn::Resources
 				return m_stores;
 			}
 
+			/**
+			 * @brief Returns the reference to the resource loading pipeline service.
+			 * @return LoadingPipeline &
+			 */
+			[[nodiscard]]
+			LoadingPipeline &
+			loadingPipeline () noexcept
+			{
+				return m_loadingPipeline;
+			}
+
+			/**
+			 * @brief Returns the reference to the resource loading pipeline service.
+			 * @return const LoadingPipeline &
+			 */
+			[[nodiscard]]
+			const LoadingPipeline &
+			loadingPipeline () const noexcept
+			{
+				return m_loadingPipeline;
+			}
+
 			/**
 			 * @brief Returns the reference to the sound service.
 			 * @return Sounds &
@@ -775,31 +798,32 @@ namespace EmEn::Resources
 			NetworkManager & m_networkManager;
 			std::vector< ServiceInterface * > m_servicesEnabled;
 			Stores m_stores{m_primaryServices};
-			Sounds m_sounds{m_primaryServices, m_networkManager, m_stores, "Sound manager", "Sounds"};
-			Musics m_musics{m_primaryServices, m_networkManager, m_stores, "Music manager", "Musics"};
-			Fonts m_fonts{m_primaryServices, m_networkManager, m_stores, "Font manager", "Fonts"};
-			Images m_images{m_primaryServices, m_networkManager, m_stores, "Image manager", "Images"};
-			Cubemaps m_cubemaps{m_primaryServices, m_networkManager, m_stores, "Cubemap manager", "Cubemaps"};
-			Movies m_movies{m_primaryServices, m_networkManager, m_stores, "Movie manager", "Movies"};
-			Texture1Ds m_texture1Ds{m_primaryServices, m_networkManager, m_stores, "Texture 1D manager", "Images"};
-			Texture2Ds m_texture2Ds{m_primaryServices, m_networkManager, m_stores, "Texture 2D manager", "Images"};
-			Texture3Ds m_texture3Ds{m_primaryServices, m_networkManager, m_stores, "Texture 3D manager", "Images"};
-			TextureCubemaps m_textureCubemaps{m_primaryServices, m_networkManager, m_stores, "Texture cubemap manager", "Cubemaps"};
-			AnimatedTexture2Ds m_animatedTexture2Ds{m_primaryServices, m_networkManager, m_stores, "Animated texture 2D manager", "Movies"};
-			VertexGeometries m_vertexGeometries{m_primaryServices, m_networkManager, m_stores, "Geometry manager", "Geometries"};
-			IndexedVertexGeometries m_indexedVertexGeometries{m_primaryServices, m_networkManager, m_stores, "Indexed geometry manager", "Geometries"};
-			VertexGridGeometries m_vertexGridGeometries{m_primaryServices, m_networkManager, m_stores, "Grid geometry manager", "Geometries"};
-			AdaptiveVertexGridGeometries m_adaptiveVertexGridGeometries{m_primaryServices, m_networkManager, m_stores, "Adaptive grid geometry manager", "Geometries"};
-			BasicMaterials m_basicMaterials{m_primaryServices, m_networkManager, m_stores, "Basic material manager", "Materials"};
-			StandardMaterials m_standardMaterials{m_primaryServices, m_networkManager, m_stores, "Standard material manager", "Materials"};
-			SimpleMeshes m_simpleMeshes{m_primaryServices, m_networkManager, m_stores, "Simple mesh manager", "Meshes"};
-			Meshes m_meshes{m_primaryServices, m_networkManager, m_stores, "Mesh manager", "Meshes"};
-			Sprites m_sprites{m_primaryServices, m_networkManager, m_stores, "Sprite manager", "Sprites"};
-			SkyBoxes m_skyBoxes{m_primaryServices, m_networkManager, m_stores, "Skybox manager", "Backgrounds"};
-			DynamicSkies m_dynamicSkies{m_primaryServices, m_networkManager, m_stores, "Dynamic sky manager", "Backgrounds"};
-			BasicFloors m_basicFloors{m_primaryServices, m_networkManager, m_stores, "BasicFloor manager", "SceneAreas"};
-			Terrains m_terrains{m_primaryServices, m_networkManager, m_stores, "Terrain manager", "SceneAreas"};
-			WaterLevels m_waterLevels{m_primaryServices, m_networkManager, m_stores, "Water level manager", "SeaLevels"};
-			SceneDefinitions m_sceneDefinitions{m_primaryServices, m_networkManager, m_stores, "Scene definition manager", "Scenes"};
+			LoadingPipeline m_loadingPipeline{m_primaryServices};
+			Sounds m_sounds{m_primaryServices, m_networkManager, m_stores, m_loadingPipeline, "Sound manager", "Sounds"};
+			Musics m_musics{m_primaryServices, m_networkManager, m_stores, m_loadingPipeline, "Music manager", "Musics"};
+			Fonts m_fonts{m_primaryServices, m_networkManager, m_stores, m_loadingPipeline, "Font manager", "Fonts"};
+			Images m_images{m_primaryServices, m_networkManager, m_stores, m_loadingPipeline, "Image manager", "Images"};
+			Cubemaps m_cubemaps{m_primaryServices, m_networkManager, m_stores, m_loadingPipeline, "Cubemap manager", "Cubemaps"};
+			Movies m_movies{m_primaryServices, m_networkManager, m_stores, m_loadingPipeline, "Movie manager", "Movies"};
+			Texture1Ds m_texture1Ds{m_primaryServices, m_networkManager, m_stores, m_loadingPipeline, "Texture 1D manager", "Images"};
+			Texture2Ds m_texture2Ds{m_primaryServices, m_networkManager, m_stores, m_loadingPipeline, "Texture 2D manager", "Images"};
+			Texture3Ds m_texture3Ds{m_primaryServices, m_networkManager, m_stores, m_loadingPipeline, "Texture 3D manager", "Images"};
+			TextureCubemaps m_textureCubemaps{m_primaryServices, m_networkManager, m_stores, m_loadingPipeline, "Texture cubemap manager", "Cubemaps"};
+			AnimatedTexture2Ds m_animatedTexture2Ds{m_primaryServices, m_networkManager, m_stores, m_loadingPipeline, "Animated texture 2D manager", "Movies"};
+			VertexGeometries m_vertexGeometries{m_primaryServices, m_networkManager, m_stores, m_loadingPipeline, "Geometry manager", "Geometries"};
+			IndexedVertexGeometries m_indexedVertexGeometries{m_primaryServices, m_networkManager, m_stores, m_loadingPipeline, "Indexed geometry manager", "Geometries"};
+			VertexGridGeometries m_vertexGridGeometries{m_primaryServices, m_networkManager, m_stores, m_loadingPipeline, "Grid geometry manager", "Geometries"};
+			AdaptiveVertexGridGeometries m_adaptiveVertexGridGeometries{m_primaryServices, m_networkManager, m_stores, m_loadingPipeline, "Adaptive grid geometry manager", "Geometries"};
+			BasicMaterials m_basicMaterials{m_primaryServices, m_networkManager, m_stores, m_loadingPipeline, "Basic material manager", "Materials"};
+			StandardMaterials m_standardMaterials{m_primaryServices, m_networkManager, m_stores, m_loadingPipeline, "Standard material manager", "Materials"};
+			SimpleMeshes m_simpleMeshes{m_primaryServices, m_networkManager, m_stores, m_loadingPipeline, "Simple mesh manager", "Meshes"};
+			Meshes m_meshes{m_primaryServices, m_networkManager, m_stores, m_loadingPipeline, "Mesh manager", "Meshes"};
+			Sprites m_sprites{m_primaryServices, m_networkManager, m_stores, m_loadingPipeline, "Sprite manager", "Sprites"};
+			SkyBoxes m_skyBoxes{m_primaryServices, m_networkManager, m_stores, m_loadingPipeline, "Skybox manager", "Backgrounds"};
+			DynamicSkies m_dynamicSkies{m_primaryServices, m_networkManager, m_stores, m_loadingPipeline, "Dynamic sky manager", "Backgrounds"};
+			BasicFloors m_basicFloors{m_primaryServices, m_networkManager, m_stores, m_loadingPipeline, "BasicFloor manager", "SceneAreas"};
+			Terrains m_terrains{m_primaryServices, m_networkManager, m_stores, m_loadingPipeline, "Terrain manager", "SceneAreas"};
+			WaterLevels m_waterLevels{m_primaryServices, m_networkManager, m_stores, m_loadingPipeline, "Water level manager", "SeaLevels"};
+			SceneDefinitions m_sceneDefinitions{m_primaryServices, m_networkManager, m_stores, m_loadingPipeline, "Scene definition manager", "Scenes"};
 	};
 }
@@ -28,10 +28,12 @@
 
 /* STL inclusions. */
 #include <algorithm>
+#include <utility>
 
 /* Local inclusions. */
 #include "Libs/FastJSON.hpp"
 #include "Libs/String.hpp"
+#include "LoadingPipeline.hpp"
 #include "Manager.hpp"
 #include "Tracer.hpp"
 
@@ -241,7 +243,7 @@ namespace EmEn::Resources
 	void
 	ResourceTrait::checkDependencies () noexcept
 	{
-		const std::lock_guard< std::mutex > lock{m_dependenciesAccess};
+		std::unique_lock< std::mutex > lock{m_dependenciesAccess};
 
 		/* NOTE: First we check the resource current status. */
 		switch ( m_status )
@@ -270,40 +272,29 @@ namespace EmEn::Resources
 					TraceInfo{TracerTag} << "The resource '" << this->name() << "' (" << this->classLabel() << ") has no more dependency to wait for loading !";
 				}
 
-				if ( this->onDependenciesLoaded() )
+				/* NOTE: A resource loaded through the pipeline is created on the video memory by the upload stage. */
+				if ( m_loadingTicket != nullptr && !this->isDirectLoading() )
 				{
-					m_status = Status::Loaded;
-
-					this->notify(LoadFinished);
+					const auto ticket = m_loadingTicket;
+					const auto resource = this->shared_from_this();
 
-					if ( Stores::s_operationVerboseEnabled )
-					{
-						TraceSuccess{TracerTag} << "Resource '" << this->name() << "' (" << this->classLabel() << ") is successfully loaded !";
-					}
+					/* NOTE: The pipeline can execute the stage inline, which locks this mutex again. */
+					lock.unlock();
 
-					if ( !this->isTopResource() )
-					{
-						/* We want to notice parents the resource is loaded. */
-						for ( const auto & parent : m_parentsToNotify )
-						{
-							parent->dependencyLoaded(this->shared_from_this());
+					Manager::instance()->loadingPipeline().submit(ticket, this->name(), {
+						nullptr,
+						nullptr,
+						[resource] () {
+							return resource->completeDeferredLoading();
 						}
+					}, [resource] () {
+						resource->abortLoading();
+					});
 
-						/* Once notified, we don't need to keep tracks of parents. */
-						m_parentsToNotify.clear();
-					}
+					return;
 				}
-				else
-				{
-					m_status = Status::Failed;
-
-					this->notify(LoadFailed);
 
-					if ( Stores::s_operationVerboseEnabled )
-					{
-						TraceError{TracerTag} << "Resource '" << this->name() << "' (" << this->classLabel() << ") failed to load !";
-					}
-				}
+				this->completeLoading();
 			}
 				break;
 
@@ -325,6 +316,97 @@ namespace EmEn::Resources
 		}
 	}
 
+	void
+	ResourceTrait::completeLoading () noexcept
+	{
+		m_loadingTicket.reset();
+
+		if ( this->onDependenciesLoaded() )
+		{
+			m_status = Status::Loaded;
+
+			this->notify(LoadFinished);
+
+			if ( Stores::s_operationVerboseEnabled )
+			{
+				TraceSuccess{TracerTag} << "Resource '" << this->name() << "' (" << this->classLabel() << ") is successfully loaded !";
+			}
+
+			if ( !this->isTopResource() )
+			{
+				/* We want to notice parents the resource is loaded. */
+				for ( const auto & parent : m_parentsToNotify )
+				{
+					parent->dependencyLoaded(this->shared_from_this());
+				}
+
+				/* Once notified, we don't need to keep tracks of parents. */
+				m_parentsToNotify.clear();
+			}
+		}
+		else
+		{
+			m_status = Status::Failed;
+
+			this->notify(LoadFailed);
+
+			if ( Stores::s_operationVerboseEnabled )
+			{
+				TraceError{TracerTag} << "Resource '" << this->name() << "' (" << this->classLabel() << ") failed to load !";
+			}
+		}
+	}
+
+	bool
+	ResourceTrait::completeDeferredLoading () noexcept
+	{
+		const std::lock_guard< std::mutex > lock{m_dependenciesAccess};
+
+		if ( m_status != Status::Loading )
+		{
+			return m_status == Status::Loaded;
+		}
+
+		this->completeLoading();
+
+		return m_status == Status::Loaded;
+	}
+
+	void
+	ResourceTrait::setLoadingTicket (std::shared_ptr< LoadingTicket > ticket) noexcept
+	{
+		const std::lock_guard< std::mutex > lock{m_dependenciesAccess};
+
+		m_loadingTicket = std::move(ticket);
+	}
+
+	std::shared_ptr< LoadingTicket >
+	ResourceTrait::loadingTicket () const noexcept
+	{
+		const std::lock_guard< std::mutex > lock{m_dependenciesAccess};
+
+		return m_loadingTicket;
+	}
+
+	void
+	ResourceTrait::abortLoading () noexcept
+	{
+		const std::lock_guard< std::mutex > lock{m_dependenciesAccess};
+
+		m_loadingTicket.reset();
+
+		if ( m_status == Status::Loaded || m_status == Status::Failed )
+		{
+			return;
+		}
+
+		m_status = Status::Failed;
+
+		this->notify(LoadFailed);
+
+		TraceWarning{TracerTag} << "The loading of resource '" << this->name() << "' (" << this->classLabel() << ") has been aborted !";
+	}
+
 	bool
 	ResourceTrait::setLoadSuccess (bool status) noexcept
 	{
@@ -31,6 +31,7 @@
 #include <cstdint>
 #include <array>
 #include <set>
+#include <memory>
 #include <string>
 #include <mutex>
 #include <filesystem>
@@ -49,6 +50,12 @@
 /* Local inclusions for usages. */
 #include "Types.hpp"
 
+/* Forward declarations. */
+namespace EmEn::Resources
+{
+	class LoadingTicket;
+}
+
 namespace EmEn::Resources
 {
 	/**
@@ -201,6 +208,27 @@ namespace EmEn::Resources
 				m_flags[DirectLoading] = true;
 			}
 
+			/**
+			 * @brief Attaches the loading pipeline ticket. The video memory creation is then deferred to the pipeline upload stage.
+			 * @param ticket The ticket smart pointer [std::move].
+			 * @return void
+			 */
+			void setLoadingTicket (std::shared_ptr< LoadingTicket > ticket) noexcept;
+
+			/**
+			 * @brief Returns the loading pipeline ticket while the resource is in the pipeline.
+			 * @return std::shared_ptr< LoadingTicket >
+			 */
+			[[nodiscard]]
+			std::shared_ptr< LoadingTicket > loadingTicket () const noexcept;
+
+			/**
+			 * @brief Sets the resource as failed when its loading request has been cancelled or stopped.
+			 * @note Does nothing if the resource is already loaded or failed.
+			 * @return void
+			 */
+			void abortLoading () noexcept;
+
 			/**
 			 * @brief Returns the label of resource class.
 			 * @return const char *
@@ -314,6 +342,19 @@ namespace EmEn::Resources
 			 */
 			void checkDependencies () noexcept;
 
+			/**
+			 * @brief Creates the resource on the video memory and notifies the parents.
+			 * @warning The dependencies mutex must be locked.
+			 * @return void
+			 */
+			void completeLoading () noexcept;
+
+			/**
+			 * @brief Completes a loading deferred to the pipeline upload stage.
+			 * @return bool
+			 */
+			bool completeDeferredLoading () noexcept;
+
 			/**
 			 * @brief This is the real method that begin the first stage of resource loading.
 			 * @param manual Boolean that denote if the status will be Enqueuing or ManualEnqueuing.
@@ -329,6 +370,7 @@ namespace EmEn::Resources
 			std::set< std::shared_ptr< ResourceTrait > > m_parentsToNotify;
 			std::set< std::shared_ptr< ResourceTrait > > m_dependenciesToWaitFor;
 			Status m_status{Status::Unloaded};
+			std::shared_ptr< LoadingTicket > m_loadingTicket;
 			mutable std::mutex m_dependenciesAccess;
 			/* FIXME: Remove this array and reserve the first flag with FlagTrait. */
 			std::array< bool, 8 > m_flags{
@@ -29,6 +29,9 @@
 /* STL inclusions. */
 #include <string>
 #include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <unordered_set>
 
 /* Third-party inclusions. */
 #ifdef EMERAUDE_USE_SYSTEM_LIBS
@@ -103,14 +106,32 @@ namespace EmEn::Saphir
 			return false;
 		}
 
-		/* Shader binaries cache directory. */
-		m_shadersBinariesDirectory = m_primaryServices.fileSystem().cacheDirectory(ShaderBinariesDirectoryName);
+		/* NOTE: Removes the binaries stored one per file by the previous versions. */
+		{
+			const auto legacyDirectory = m_primaryServices.fileSystem().cacheDirectory(LegacyShaderBinariesDirectoryName);
+
+			if ( IO::directoryExists(legacyDirectory) )
+			{
+				std::error_code errorCode;
+
+				std::filesystem::remove_all(legacyDirectory, errorCode);
+			}
+		}
 
-		if ( !IO::createDirectory(m_shadersBinariesDirectory) )
+		/* Shader binaries cache archive. */
+		if ( m_flags[BinaryCacheEnabled] )
 		{
-			TraceError{ClassId} << "Unable to create '" << m_shadersBinariesDirectory << "' directory !";
+			auto archiveFilepath = m_primaryServices.fileSystem().cacheDirectory();
+			archiveFilepath.append(ShaderBinaryCacheFilename);
 
-			return false;
+			if ( !m_binaryCache.open(archiveFilepath) )
+			{
+				TraceWarning{ClassId} << "Unable to read the shader binary cache '" << archiveFilepath << "', it will be rebuilt.";
+			}
+			else if ( m_flags[ShowInformation] )
+			{
+				TraceInfo{ClassId} << m_binaryCache.entryCount() << " shader binaries mapped from '" << archiveFilepath << "'.";
+			}
 		}
 
 		/* Checks shader cache. */
@@ -118,10 +139,6 @@ namespace EmEn::Saphir
 		{
 			this->clearCache();
 		}
-		else
-		{
-			this->readCache();
-		}
 
 		if ( m_flags[ShowInformation] )
 		{
@@ -246,33 +263,49 @@ namespace EmEn::Saphir
 			glslang::FinalizeProcess();
 		}
 
-		m_cachedShaderBinaries.clear();
-		m_cachedShaderSourceCodes.clear();
-		m_shaderModules.clear();
+		{
+			const std::lock_guard< std::mutex > lock{m_shaderModulesAccess};
+
+			m_flags[CompileQueueOpened] = false;
+			m_compileQueue.clear();
+		}
+
+		if ( !this->saveBinaryCache() )
+		{
+			TraceWarning{ClassId} << "Unable to write the shader binary cache '" << m_binaryCache.filepath() << "' !";
+		}
+
+		m_binaryCache.close();
+
+		{
+			const std::lock_guard< std::mutex > lock{m_shaderModulesAccess};
+
+			m_shaderModules.clear();
+		}
 
 		return true;
 	}
 
 	bool
-	ShaderManager::cacheShaderSourceCode (const AbstractShader & shader) const noexcept
+	ShaderManager::cacheShaderSourceCode (const ShaderSource & source) const noexcept
 	{
 		if ( !m_flags[SourceCodeCacheEnabled] )
 		{
 			return true;
 		}
 
-		const auto cacheFilepath = this->generateShaderSourceCacheFilepath(shader);
+		const auto cacheFilepath = this->generateShaderSourceCacheFilepath(source);
 
 		if ( cacheFilepath.empty() )
 		{
-			TraceError{ClassId} << "Unable to get a proper source cache path for shader '" << shader.name() << "' !";
+			TraceError{ClassId} << "Unable to get a proper source cache path for shader '" << source.name << "' !";
 
 			return false;
 		}
 
-		if ( !shader.writeSourceCode(cacheFilepath) )
+		if ( !IO::filePutContents(cacheFilepath, source.sourceCode) )
 		{
-			TraceError{ClassId} << "Unable to write the source cache file '" << cacheFilepath << "' for shader '" << shader.name() << "' !";
+			TraceError{ClassId} << "Unable to write the source cache file '" << cacheFilepath << "' for shader '" << source.name << "' !";
 
 			return false;
 		}
@@ -281,57 +314,190 @@ namespace EmEn::Saphir
 	}
 
 	bool
-	ShaderManager::cacheShaderBinary (const AbstractShader & shader, const std::vector< uint32_t > & binaryCode) const noexcept
+	ShaderManager::compileToCache (const ShaderSource & source, std::vector< uint32_t > & binaryCode) noexcept
 	{
-		if ( !m_flags[BinaryCacheEnabled] )
+		/* Write the source code to the cache. */
+		if ( !this->cacheShaderSourceCode(source) )
 		{
-			return true;
+			TraceWarning{ClassId} << "Unable to write the source code of shader '" << source.name << "' to the cache !";
 		}
 
-		const auto cacheFilepath = this->generateShaderBinaryCacheFilepath(shader);
-
-		if ( cacheFilepath.empty() )
+		if ( !this->compile(source.name, source.type, source.sourceCode, binaryCode) )
 		{
-			TraceError{ClassId} << "Unable to get a proper binary cache path for shader '" << shader.name() << "' !";
+			TraceError{ClassId} << "Unable to compile shader '" << source.name << "' !";
 
 			return false;
 		}
 
-		if ( !IO::filePutContents(cacheFilepath, binaryCode) )
+		if ( m_flags[BinaryCacheEnabled] )
 		{
-			TraceError{ClassId} << "Unable to write the shader binary code to file '" << cacheFilepath << "' for shader '" << shader.name() << "' !";
-
-			return false;
+			m_binaryCache.put(source.hash, binaryCode);
 		}
 
 		return true;
 	}
 
 	bool
-	ShaderManager::checkBinaryFromCache (const AbstractShader & shader, std::vector< uint32_t > & binaryCode) noexcept
+	ShaderManager::compileShaders (const std::vector< ShaderSource > & sources) noexcept
 	{
-		if ( !m_flags[BinaryCacheEnabled] )
+		if ( !this->usable() )
 		{
+			Tracer::error(ClassId, "The shader manager is not initialized !");
+
 			return false;
 		}
 
-		const auto binaryIt = m_cachedShaderBinaries.find(shader.hash());
+		/* NOTE: Keeps only the shaders missing from the binary cache, once. */
+		std::vector< const ShaderSource * > pendingSources;
+		pendingSources.reserve(sources.size());
 
-		if ( binaryIt == m_cachedShaderBinaries.cend() )
 		{
-			return false;
+			std::unordered_set< size_t > hashes;
+
+			for ( const auto & source : sources )
+			{
+				if ( source.sourceCode.empty() || !hashes.emplace(source.hash).second )
+				{
+					continue;
+				}
+
+				if ( m_flags[BinaryCacheEnabled] && m_binaryCache.contains(source.hash) )
+				{
+					continue;
+				}
+
+				pendingSources.emplace_back(&source);
+			}
 		}
 
-		if ( !IO::fileGetContents(binaryIt->second, binaryCode) )
+		if ( pendingSources.empty() )
 		{
-			TraceError{ClassId} << "Unable to read the shader binary code from file '" << binaryIt->second << "' !";
+			return true;
+		}
 
-			return false;
+		std::vector< std::vector< uint32_t > > binaryCodes;
+
+		const auto failureCount = this->compileBatch(pendingSources, binaryCodes);
+
+		if ( m_flags[ShowInformation] )
+		{
+			TraceInfo{ClassId} << pendingSources.size() - failureCount << " shaders compiled, " << failureCount << " failed.";
 		}
 
-		if ( binaryCode.empty() )
+		return failureCount == 0;
+	}
+
+	size_t
+	ShaderManager::compileBatch (const std::vector< const ShaderSource * > & sources, std::vector< std::vector< uint32_t > > & binaryCodes) noexcept
+	{
+		binaryCodes.clear();
+		binaryCodes.resize(sources.size());
+
+		std::atomic< size_t > failureCount{0};
+
+		const auto compileRange = [&] (size_t first, size_t last) {
+			for ( auto index = first; index < last; ++index )
+			{
+				if ( !this->compileToCache(*sources[index], binaryCodes[index]) )
+				{
+					binaryCodes[index].clear();
+
+					failureCount.fetch_add(1, std::memory_order_relaxed);
+				}
+			}
+		};
+
+		/* NOTE: One shader per job, a glslang compilation is long enough to be worth it. */
+		if ( sources.size() > 1 && m_primaryServices.jobSystem().usable() )
 		{
-			TraceError{ClassId} << "The shader binary code from file '" << binaryIt->second << "' is empty !";
+			m_primaryServices.jobSystem().parallelFor(0, sources.size(), compileRange, 1);
+		}
+		else
+		{
+			compileRange(0, sources.size());
+		}
+
+		return failureCount.load();
+	}
+
+	void
+	ShaderManager::beginCompileQueue () noexcept
+	{
+		const std::lock_guard< std::mutex > lock{m_shaderModulesAccess};
+
+		m_flags[CompileQueueOpened] = true;
+	}
+
+	bool
+	ShaderManager::flushCompileQueue () noexcept
+	{
+		std::vector< std::pair< ShaderSource, std::shared_ptr< ShaderModule > > > queue;
+
+		{
+			const std::lock_guard< std::mutex > lock{m_shaderModulesAccess};
+
+			m_flags[CompileQueueOpened] = false;
+
+			queue.swap(m_compileQueue);
+		}
+
+		if ( queue.empty() )
+		{
+			return true;
+		}
+
+		const auto start = std::chrono::steady_clock::now();
+
+		std::vector< const ShaderSource * > sources;
+		sources.reserve(queue.size());
+
+		for ( const auto & [source, shaderModule] : queue )
+		{
+			sources.emplace_back(&source);
+		}
+
+		std::vector< std::vector< uint32_t > > binaryCodes;
+
+		auto failureCount = this->compileBatch(sources, binaryCodes);
+
+		for ( size_t index = 0; index < queue.size(); index++ )
+		{
+			const auto & [source, shaderModule] = queue[index];
+
+			/* NOTE: An empty binary is a compilation failure, already counted. */
+			auto created = false;
+
+			if ( !binaryCodes[index].empty() )
+			{
+				created = shaderModule->setBinaryCode(std::move(binaryCodes[index])) && shaderModule->createOnHardware();
+
+				if ( !created )
+				{
+					TraceError{ClassId} << "Unable to create the shader module of '" << source.name << "' !";
+
+					failureCount++;
+				}
+			}
+
+			if ( !created )
+			{
+				/* NOTE: The next request of this shader will try again. */
+				const std::lock_guard< std::mutex > lock{m_shaderModulesAccess};
+
+				if ( const auto shaderIt = m_shaderModules.find(source.hash); shaderIt != m_shaderModules.cend() && shaderIt->second == shaderModule )
+				{
+					m_shaderModules.erase(shaderIt);
+				}
+			}
+		}
+
+		const auto milliseconds = std::chrono::duration_cast< std::chrono::milliseconds >(std::chrono::steady_clock::now() - start).count();
+
+		TraceInfo{ClassId} << queue.size() - failureCount << " queued shaders compiled in " << milliseconds << " ms.";
+
+		if ( failureCount > 0 )
+		{
+			TraceError{ClassId} << failureCount << " queued shaders failed to compile !";
 
 			return false;
 		}
@@ -339,6 +505,28 @@ namespace EmEn::Saphir
 		return true;
 	}
 
+	bool
+	ShaderManager::saveBinaryCache () noexcept
+	{
+		if ( !m_flags[BinaryCacheEnabled] || !m_binaryCache.hasPendingEntries() )
+		{
+			return true;
+		}
+
+		return m_binaryCache.write();
+	}
+
+	ShaderManager::ShaderSource
+	ShaderManager::getShaderSource (const AbstractShader & shader) noexcept
+	{
+		return {
+			.name = shader.name(),
+			.type = shader.type(),
+			.sourceCode = shader.sourceCode(),
+			.hash = shader.hash()
+		};
+	}
+
 	std::shared_ptr< ShaderModule >
 	ShaderManager::getShaderModuleFromGeneratedShader (const std::shared_ptr< Device > & device, const AbstractShader & shader) noexcept
 	{
@@ -371,41 +559,57 @@ namespace EmEn::Saphir
 		const auto shaderHash = shader.hash();
 
 		/* Checks in loaded shader list with the hash. */
-		const auto shaderIt = m_shaderModules.find(shaderHash);
-
-		if ( shaderIt != m_shaderModules.cend() )
 		{
-			return shaderIt->second;
+			const std::lock_guard< std::mutex > lock{m_shaderModulesAccess};
+
+			const auto shaderIt = m_shaderModules.find(shaderHash);
+
+			if ( shaderIt != m_shaderModules.cend() )
+			{
+				return shaderIt->second;
+			}
 		}
 
 		std::vector< uint32_t > binaryCode;
 
 		/* Checks in cached binaries to prevent a compilation. */
-		if ( this->checkBinaryFromCache(shader, binaryCode) )
+		if ( m_flags[BinaryCacheEnabled] && m_binaryCache.get(shaderHash, binaryCode) && !binaryCode.empty() )
 		{
-			const auto bytes = binaryCode.size() * sizeof(uint32_t);
+			if ( m_flags[ShowInformation] )
+			{
+				const auto bytes = binaryCode.size() * sizeof(uint32_t);
 
-			TraceSuccess{ClassId} << "The shader '" << shader.name() << "' (" << bytes << " bytes) loaded from binary cache !";
+				TraceSuccess{ClassId} << "The shader '" << shader.name() << "' (" << bytes << " bytes) loaded from binary cache !";
+			}
 		}
-		/* If not, we compile it. */
 		else
 		{
-			/* Write the source code to the cache. */
-			if ( !this->cacheShaderSourceCode(shader) )
+			/* NOTE: When the compile queue is opened, the module is created once the whole queue is compiled. */
 			{
-				TraceWarning{ClassId} << "Unable to write the source code of shader '" << shader.name() << "' to the cache !";
-			}
+				const std::lock_guard< std::mutex > lock{m_shaderModulesAccess};
 
-			if ( !this->compile(shader, binaryCode) )
-			{
-				TraceError{ClassId} << "Unable to compile shader '" << shader.name() << "' !";
+				if ( m_flags[CompileQueueOpened] )
+				{
+					const auto shaderIt = m_shaderModules.find(shaderHash);
 
-				return {};
+					if ( shaderIt != m_shaderModules.cend() )
+					{
+						return shaderIt->second;
+					}
+
+					auto shaderModule = std::make_shared< ShaderModule >(device, ShaderManager::vkShaderType(shader.type()), binaryCode);
+					shaderModule->setIdentifier(ClassId, shader.name(), "ShaderModule");
+
+					m_compileQueue.emplace_back(ShaderManager::getShaderSource(shader), shaderModule);
+
+					return m_shaderModules.emplace(shaderHash, shaderModule).first->second;
+				}
 			}
 
-			if ( !this->cacheShaderBinary(shader, binaryCode) )
+			/* If not, we compile it. */
+			if ( !this->compileToCache(ShaderManager::getShaderSource(shader), binaryCode) )
 			{
-				TraceWarning{ClassId} << "Unable to write the binary code of shader '" << shader.name() << "' to the cache !";
+				return {};
 			}
 		}
 
@@ -420,6 +624,8 @@ namespace EmEn::Saphir
 		}
 
 		/* Save a copy into loaded shaders with the associated vulkan shader module. */
+		const std::lock_guard< std::mutex > lock{m_shaderModulesAccess};
+
 		const auto [newShader, success] = m_shaderModules.emplace(shaderHash, shaderModule);
 
 		return newShader->second;
@@ -482,60 +688,6 @@ namespace EmEn::Saphir
 		return shaderModules;
 	}
 
-	void
-	ShaderManager::readCache () noexcept
-	{
-		for ( const auto & filepath : IO::directoryEntries(m_shadersSourcesDirectory) )
-		{
-			const auto extension = IO::getFileExtension(filepath);
-			bool isShaderFile = false;
-
-			for ( const auto & allowedExtension : ShaderFileExtensions )
-			{
-				if ( extension == allowedExtension )
-				{
-					isShaderFile = true;
-					break;
-				}
-			}
-
-			if ( !isShaderFile )
-			{
-				continue;
-			}
-
-			auto hash = ShaderManager::extractHashFromFilepath(filepath);
-
-			if ( hash == 0 )
-			{
-				TraceError{ClassId} << "The hash from shader source file '" << filepath << "' is invalid !";
-
-				continue;
-			}
-
-			m_cachedShaderSourceCodes.emplace(hash, filepath);
-		}
-
-		for ( const auto & filepath : IO::directoryEntries(m_shadersBinariesDirectory) )
-		{
-			if ( IO::getFileExtension(filepath) != "bin" )
-			{
-				continue;
-			}
-
-			auto hash = ShaderManager::extractHashFromFilepath(filepath);
-
-			if ( hash == 0 )
-			{
-				TraceError{ClassId} << "The hash from shader binary file '" << filepath << "' is invalid !";
-
-				continue;
-			}
-
-			m_cachedShaderBinaries.emplace(hash, filepath);
-		}
-	}
-
 	void
 	ShaderManager::clearCache () noexcept
 	{
@@ -564,29 +716,14 @@ namespace EmEn::Saphir
 			}
 		}
 
-		m_cachedShaderSourceCodes.clear();
-
-		for ( const auto & filepath : IO::directoryEntries(m_shadersBinariesDirectory) )
-		{
-			if ( IO::getFileExtension(filepath) != "bin" )
-			{
-				continue;
-			}
-
-			if ( !IO::eraseFile(filepath) )
-			{
-				TraceError{ClassId} << "Unable to erase '" << filepath << "' !";
-			}
-		}
-
-		m_cachedShaderBinaries.clear();
+		m_binaryCache.clear();
 	}
 
 	std::filesystem::path
-	ShaderManager::generateShaderSourceCacheFilepath (const AbstractShader & shader) const noexcept
+	ShaderManager::generateShaderSourceCacheFilepath (const ShaderSource & source) const noexcept
 	{
 		std::stringstream filename;
-		filename << shader.name() << '_' << shader.hash() << '.' << getShaderFileExtension(shader.type());
+		filename << source.name << '_' << source.hash << '.' << getShaderFileExtension(source.type);
 
 		auto filepath = m_shadersSourcesDirectory;
 		filepath.append(filename.str());
@@ -594,38 +731,6 @@ namespace EmEn::Saphir
 		return filepath;
 	}
 
-	std::filesystem::path
-	ShaderManager::generateShaderBinaryCacheFilepath (const AbstractShader & shader) const noexcept
-	{
-		std::stringstream filename;
-		filename << shader.name() << '_' << shader.hash() << ".bin";
-
-		auto filepath = m_shadersBinariesDirectory;
-		filepath.append(filename.str());
-
-		return filepath;
-	}
-
-	size_t
-	ShaderManager::extractHashFromFilepath (const std::filesystem::path & filepath) noexcept
-	{
-		const auto tmpA = String::explode(filepath.filename().string(), '_');
-
-		if ( tmpA.size() != 2 )
-		{
-			return 0;
-		}
-
-		const auto tmpB = String::explode(tmpA[1], '.');
-
-		if ( tmpB.size() != 2 )
-		{
-			return 0;
-		}
-
-		return std::stoull(tmpB[0]);
-	}
-
 	EShLanguage
 	ShaderManager::GLSLangShaderType (ShaderType shaderType) noexcept
 	{
@@ -684,20 +789,6 @@ namespace EmEn::Saphir
 		}
 	}
 
-	bool
-	ShaderManager::compile (const AbstractShader & shader, std::vector< uint32_t > & binaryCode) noexcept
-	{
-		/* NOTE: The shader must have a source code before a compilation can occur. */
-		if ( !shader.isGenerated() )
-		{
-			TraceError{ClassId} << "The shader '" << shader.name() << "' has an empty source code !";
-
-			return false;
-		}
-
-		return this->compile(shader.name(), shader.type(), shader.sourceCode(), binaryCode);
-	}
-
 	bool
 	ShaderManager::compile (const std::string & shaderName, ShaderType type, const std::string & sourceCode, std::vector< uint32_t > & binaryCode) noexcept
 	{
@@ -715,6 +806,9 @@ namespace EmEn::Saphir
 		const auto shaderType = ShaderManager::GLSLangShaderType(type);
 		const auto * sourceCodeCString = sourceCode.c_str();
 
+		/* NOTE: The includer keeps a directory stack, each compilation uses its own to run on any thread. */
+		auto includer = m_includer;
+
 		glslang::TShader glslShader{shaderType};
 		glslShader.setStrings(&sourceCodeCString, 1);
 		glslShader.setEnvInput(glslang::EShSourceGlsl, shaderType, glslang::EShClientVulkan, m_defaultVersion);
@@ -729,7 +823,7 @@ namespace EmEn::Saphir
 		/* NOTE: Preprocess the source code. */
 		std::string preprocessedSource;
 
-		if ( !glslShader.preprocess(&m_builtInResource, m_defaultVersion, m_profile, m_flags[ForceDefaultVersionAndProfile], m_flags[ForwardCompatible], m_messageFilter, &preprocessedSource, m_includer) )
+		if ( !glslShader.preprocess(&m_builtInResource, m_defaultVersion, m_profile, m_flags[ForceDefaultVersionAndProfile], m_flags[ForwardCompatible], m_messageFilter, &preprocessedSource, includer) )
 		{
 			this->printCompilationErrors(shaderIdentifier, preprocessedSource, glslShader.getInfoLog());
 
@@ -753,7 +847,7 @@ namespace EmEn::Saphir
 
 		glslShader.setStrings(&c_string, 1);
 
-		if ( !glslShader.parse(&m_builtInResource, m_defaultVersion, m_profile, m_flags[ForceDefaultVersionAndProfile], m_flags[ForwardCompatible], m_messageFilter, m_includer) )
+		if ( !glslShader.parse(&m_builtInResource, m_defaultVersion, m_profile, m_flags[ForceDefaultVersionAndProfile], m_flags[ForwardCompatible], m_messageFilter, includer) )
 		{
 			this->printCompilationErrors(shaderIdentifier, preprocessedSource, glslShader.getInfoLog());
 
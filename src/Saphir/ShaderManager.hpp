@@ -33,8 +33,11 @@
 #include <array>
 #include <cstddef>
 #include <cstdint>
+#include <filesystem>
 #include <map>
+#include <utility>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <vector>
 
@@ -46,6 +49,7 @@
 #include "ServiceInterface.hpp"
 
 /* Local inclusions for usages. */
+#include "Libs/IO/IndexedArchive.hpp"
 #include "Vulkan/Types.hpp"
 #include "Saphir/Program.hpp"
 #include "Types.hpp"
@@ -92,6 +96,12 @@ namespace EmEn::Saphir
 			/** @brief Observable class unique identifier. */
 			static const size_t ClassUID;
 
+			/** @brief The sub-directory of the cache directory holding the shader source codes. */
+			static constexpr auto ShaderSourcesDirectoryName{"shader-sources"};
+
+			/** @brief The archive of the cache directory holding the shader binaries. */
+			static constexpr auto ShaderBinaryCacheFilename{"shader-binaries.emarc"};
+
 			/** @brief Observable notification codes. */
 			enum NotificationCode
 			{
@@ -101,6 +111,18 @@ namespace EmEn::Saphir
 				MaxEnum
 			};
 
+			/**
+			 * @brief A shader source code to compile.
+			 */
+			struct ShaderSource
+			{
+				std::string name;
+				ShaderType type{ShaderType::Undefined};
+				std::string sourceCode;
+				/* NOTE: This is the hash of the source code, it is the key of the binary cache. */
+				size_t hash{0};
+			};
+
 			/**
 			 * @brief Constructs the shader manager.
 			 * @param primaryServices A reference to the primary services.
@@ -196,6 +218,7 @@ namespace EmEn::Saphir
 
 			/**
 			 * @brief Returns shader modules corresponding to a program.
+			 * @note When the compile queue is opened, the modules of the shaders to compile are created by flushCompileQueue().
 			 * @param device A reference to a device smart pointer.
 			 * @param program A reference to a program smart pointer.
 			 * @return std::vector< std::shared_ptr< Vulkan::ShaderModule > >
@@ -203,6 +226,67 @@ namespace EmEn::Saphir
 			[[nodiscard]]
 			std::vector< std::shared_ptr< Vulkan::ShaderModule > > getShaderModules (const std::shared_ptr< Vulkan::Device > & device, const std::shared_ptr< Program > & program) noexcept;
 
+			/**
+			 * @brief Opens the compile queue. The shaders requested from now are compiled all at once by flushCompileQueue().
+			 * @note The shader modules are returned before being created, they can only be used by deferred pipeline creations.
+			 * @return void
+			 */
+			void beginCompileQueue () noexcept;
+
+			/**
+			 * @brief Compiles the queued shaders on the job system workers, then creates their shader modules.
+			 * @note This closes the compile queue.
+			 * @return bool
+			 */
+			bool flushCompileQueue () noexcept;
+
+			/**
+			 * @brief Compiles the shaders missing from the binary cache on the job system workers.
+			 * @note This does not need a device, the binaries are kept in the binary cache when it is enabled.
+			 * @param sources A reference to a list of shader sources.
+			 * @return bool
+			 */
+			bool compileShaders (const std::vector< ShaderSource > & sources) noexcept;
+
+			/**
+			 * @brief Writes the new shader binaries into the binary cache archive.
+			 * @return bool
+			 */
+			bool saveBinaryCache () noexcept;
+
+			/**
+			 * @brief Returns whether the binary cache is enabled.
+			 * @return bool
+			 */
+			[[nodiscard]]
+			bool
+			isBinaryCacheEnabled () const noexcept
+			{
+				return m_flags[BinaryCacheEnabled];
+			}
+
+			/**
+			 * @brief Returns the directory where the shader source codes are written.
+			 * @return const std::filesystem::path &
+			 */
+			[[nodiscard]]
+			const std::filesystem::path &
+			shaderSourcesDirectory () const noexcept
+			{
+				return m_shadersSourcesDirectory;
+			}
+
+			/**
+			 * @brief Returns the number of shader binaries in the binary cache.
+			 * @return size_t
+			 */
+			[[nodiscard]]
+			size_t
+			cachedShaderBinaryCount () const noexcept
+			{
+				return m_binaryCache.entryCount();
+			}
+
 			/**
 			 * @brief Returns the instance of the shader manager.
 			 * @param type The transfer work type.
@@ -242,16 +326,27 @@ namespace EmEn::Saphir
 			}
 
 			/**
-			 * @brief Compiles a shader from a saphir generated source code.
-			 * @param shader A reference to a shader smart pointer.
+			 * @brief Compiles a shader source and stores the binary in the binary cache.
+			 * @note This is thread-safe.
+			 * @param source A reference to a shader source.
 			 * @param binaryCode A reference to the binary data vector to complete.
 			 * @return bool
 			 */
 			[[nodiscard]]
-			bool compile (const AbstractShader & shader, std::vector< uint32_t > & binaryCode) noexcept;
+			bool compileToCache (const ShaderSource & source, std::vector< uint32_t > & binaryCode) noexcept;
+
+			/**
+			 * @brief Compiles a list of shader sources on the job system workers.
+			 * @param sources A reference to a list of shader sources.
+			 * @param binaryCodes A reference to the list of binaries to complete, an empty one for a failed compilation.
+			 * @return size_t The number of failed compilations.
+			 */
+			[[nodiscard]]
+			size_t compileBatch (const std::vector< const ShaderSource * > & sources, std::vector< std::vector< uint32_t > > & binaryCodes) noexcept;
 
 			/**
 			 * @brief Compiles a shader from a source code.
+			 * @note This is thread-safe.
 			 * @param shaderName A reference to a string.
 			 * @param type The shader type.
 			 * @param sourceCode A reference to a string.
@@ -263,26 +358,11 @@ namespace EmEn::Saphir
 
 			/**
 			 * @brief Writes a shader source code on disk cache.
-			 * @param shader A reference to a shader.
-			 * @return bool
-			 */
-			[[nodiscard]]
-			bool cacheShaderSourceCode (const AbstractShader & shader) const noexcept;
-
-			/**
-			 * @brief Writes a shader binary on disk cache.
-			 * @param shader A reference to a shader.
-			 * @param binaryCode A reference to the binary data vector.
+			 * @param source A reference to a shader source.
 			 * @return bool
 			 */
 			[[nodiscard]]
-			bool cacheShaderBinary (const AbstractShader & shader, const std::vector< uint32_t > & binaryCode) const noexcept;
-
-			/**
-			 * @brief Reads the cache to get shader source codes and binaries.
-			 * @return void
-			 */
-			void readCache () noexcept;
+			bool cacheShaderSourceCode (const ShaderSource & source) const noexcept;
 
 			/**
 			 * @brief Removes all sources and binary from shader cache.
@@ -292,36 +372,19 @@ namespace EmEn::Saphir
 
 			/**
 			 * @brief Generates a unique cache filepath for the shader source.
-			 * @param shader A reference to a shader.
-			 * @return std::filesystem::path
-			 */
-			[[nodiscard]]
-			std::filesystem::path generateShaderSourceCacheFilepath (const AbstractShader & shader) const noexcept;
-
-			/**
-			 * @brief Generates a unique cache filepath for the shader binary.
-			 * @param shader A reference to a shader.
+			 * @param source A reference to a shader source.
 			 * @return std::filesystem::path
 			 */
 			[[nodiscard]]
-			std::filesystem::path generateShaderBinaryCacheFilepath (const AbstractShader & shader) const noexcept;
+			std::filesystem::path generateShaderSourceCacheFilepath (const ShaderSource & source) const noexcept;
 
 			/**
-			 * @brief Returns the shader hash from the filepath.
-			 * @param filepath A reference to a filesystem path.
-			 * @return size_t
-			 */
-			[[nodiscard]]
-			static size_t extractHashFromFilepath (const std::filesystem::path & filepath) noexcept;
-
-			/**
-			 * @brief Checks whether a binary exists in the cache.
+			 * @brief Returns the compilation request of a generated shader.
 			 * @param shader A reference to a shader.
-			 * @param binaryCode A reference to the binary code to complete if exists in the cache.
-			 * @return bool
+			 * @return ShaderSource
 			 */
 			[[nodiscard]]
-			bool checkBinaryFromCache (const AbstractShader & shader, std::vector< uint32_t > & binaryCode) noexcept;
+			static ShaderSource getShaderSource (const AbstractShader & shader) noexcept;
 
 			/**
 			 * @brief Prints compilation errors.
@@ -356,23 +419,24 @@ namespace EmEn::Saphir
 			static constexpr auto BinaryCacheEnabled{4UL};
 			static constexpr auto ForceDefaultVersionAndProfile{5UL};
 			static constexpr auto ForwardCompatible{6UL};
+			static constexpr auto CompileQueueOpened{7UL};
 
-			static constexpr auto ShaderSourcesDirectoryName{"shader-sources"};
-			static constexpr auto ShaderBinariesDirectoryName{"shader-binaries"};
+			/* NOTE: The binaries were stored one per file before the archive. */
+			static constexpr auto LegacyShaderBinariesDirectoryName{"shader-binaries"};
 
 			static std::array< ShaderManager *, 2 > s_instances;
 
 			PrimaryServices & m_primaryServices;
 			std::map< size_t, std::shared_ptr< Vulkan::ShaderModule > > m_shaderModules;
-			std::map< size_t, std::filesystem::path > m_cachedShaderSourceCodes;
-			std::map< size_t, std::filesystem::path > m_cachedShaderBinaries;
+			std::vector< std::pair< ShaderSource, std::shared_ptr< Vulkan::ShaderModule > > > m_compileQueue;
 			std::filesystem::path m_shadersSourcesDirectory;
-			std::filesystem::path m_shadersBinariesDirectory;
+			Libs::IO::IndexedArchive m_binaryCache;
 			TBuiltInResource m_builtInResource{};
 			DirStackFileIncluder m_includer;
 			EProfile m_profile{ECoreProfile}; // ENoProfile
 			int m_defaultVersion{100};
 			EShMessages m_messageFilter{static_cast< EShMessages >(EShMsgDefault | EShMsgSpvRules | EShMsgVulkanRules | EShMsgDebugInfo)};
+			mutable std::mutex m_shaderModulesAccess;
 			std::array< bool, 8 > m_flags{
 				false/*ServiceInitialized*/,
 				false/*ShowInformation*/,
@@ -381,7 +445,7 @@ namespace EmEn::Saphir
 				false/*BinaryCacheEnabled*/,
 				false/*ForceDefaultVersionAndProfile*/,
 				false/*ForwardCompatible*/,
-				false/*UNUSED*/
+				false/*CompileQueueOpened*/
 			};
 	};
 }
@@ -83,4 +83,40 @@ namespace EmEn::Saphir
 				return nullptr;
 		}
 	}
+
+	ShaderType
+	getShaderTypeFromFileExtension (const std::string & extension) noexcept
+	{
+		if ( extension == VertexShaderFileExtension )
+		{
+			return ShaderType::VertexShader;
+		}
+
+		if ( extension == TesselationControlShaderFileExtension )
+		{
+			return ShaderType::TesselationControlShader;
+		}
+
+		if ( extension == TesselationEvaluationShaderFileExtension )
+		{
+			return ShaderType::TesselationEvaluationShader;
+		}
+
+		if ( extension == GeometryShaderFileExtension )
+		{
+			return ShaderType::GeometryShader;
+		}
+
+		if ( extension == FragmentShaderFileExtension )
+		{
+			return ShaderType::FragmentShader;
+		}
+
+		if ( extension == ComputeShaderFileExtension )
+		{
+			return ShaderType::ComputeShader;
+		}
+
+		return ShaderType::Undefined;
+	}
 }
@@ -86,5 +86,13 @@ namespace EmEn::Saphir
 	[[nodiscard]]
 	const char * getShaderFileExtension (ShaderType type) noexcept;
 
+	/**
+	 * @brief Returns the shader type from a file extension.
+	 * @param extension A reference to a string.
+	 * @return ShaderType
+	 */
+	[[nodiscard]]
+	ShaderType getShaderTypeFromFileExtension (const std::string & extension) noexcept;
+
 	using ShaderBinary = std::vector< uint32_t >;
 }
@@ -41,6 +41,8 @@ namespace EmEn::Scenes
 
 	constexpr auto TracerTag{"AbstractEntity"};
 
+	std::atomic< size_t > AbstractEntity::s_nextSerial{0};
+
 	AbstractEntity::AbstractEntity (const std::string & name, uint32_t sceneTimeMS) noexcept
 		: NameableTrait(name), m_birthTime(sceneTimeMS)
 	{
@@ -184,6 +186,8 @@ namespace EmEn::Scenes
 
 		/* NOTE: Update bounding primitives visual representation. */
 		this->updateVisualDebug();
+
+		this->onContentModified();
 	}
 
 	void
@@ -33,6 +33,7 @@
 #include <vector>
 #include <string>
 #include <any>
+#include <atomic>
 #include <memory>
 #include <mutex>
 
@@ -526,6 +527,18 @@ namespace EmEn::Scenes
 				return m_lastUpdatedMoveCycle >= engineCycle - 1;
 			}
 
+			/**
+			 * @brief Returns the creation serial of the entity.
+			 * @note Unlike the entity address, it gives the same order from one run to another.
+			 * @return size_t
+			 */
+			[[nodiscard]]
+			size_t
+			serial () const noexcept
+			{
+				return m_serial;
+			}
+
 			/**
 			 * @brief Returns when the entity was born in the time scene (ms).
 			 * @return uint32_t
@@ -830,11 +843,14 @@ namespace EmEn::Scenes
 			 */
 			virtual void onLocationDataUpdate () noexcept = 0;
 
+			static std::atomic< size_t > s_nextSerial;
+
 			std::map< std::string, std::shared_ptr< Component::Abstract > > m_components;
 			Libs::Math::Space3D::AACuboid< float > m_boundingBox;
 			Libs::Math::Space3D::Sphere< float > m_boundingSphere;
 			Physics::PhysicalObjectProperties m_physicalObjectProperties;
 			uint32_t m_birthTime{0};
+			const size_t m_serial{s_nextSerial.fetch_add(1) + 1};
 			size_t m_lastUpdatedMoveCycle{0};
 			mutable std::mutex m_componentsAccess;
 	};
@@ -0,0 +1,1129 @@
+/*
+ * src/Scenes/FlatOctree.hpp
+ * This file is part of Emeraude-Engine
+ *
+ * Copyright (C) 2010-2025 - Sébastien Léon Claude Christian Bémelmans "LondNoir" <londnoir@gmail.com>
+ *
+ * Emeraude-Engine is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * Emeraude-Engine is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with Emeraude-Engine; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * Complete project and additional information can be found at :
+ * https://github.com/londnoir/emeraude-engine
+ *
+ * --- THIS IS AUTOMATICALLY GENERATED, DO NOT CHANGE ---
+ */
+
+#pragma once
+
+/* STL inclusions. */
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include <unordered_map>
+#include <string>
+#include <memory>
+#include <functional>
+#include <algorithm>
+#include <limits>
+#include <type_traits>
+
+/* Local inclusions for usages. */
+#include "Libs/Math/Space3D/AACuboid.hpp"
+#include "Libs/Math/Space3D/Sphere.hpp"
+#include "Libs/Math/Space3D/Collisions/SamePrimitive.hpp"
+#include "Libs/Math/Space3D/Collisions/PointCuboid.hpp"
+#include "Libs/Math/Space3D/Collisions/SphereCuboid.hpp"
+#include "LocatableInterface.hpp"
+#include "Tracer.hpp"
+
+namespace EmEn::Scenes
+{
+	/**
+	 * @brief The flat octree class.
+	 * @note This is an alternative to EmEn::Scenes::OctreeSector with the same public API. Sectors live in a contiguous pool
+	 * and are addressed by index, children are allocated by blocks of eight consecutive sectors and elements are only
+	 * stored in leaf sectors as raw pointers. The ownership of elements is kept in a single dense array at the octree level.
+	 * @tparam element_t The type of inserted element, it must inherit from EmEn::Scenes::LocatableInterface.
+	 * @tparam enable_volume Enable the use of the element volume instead of their position. This implies multiple insertions at the same depth level.
+	 */
+	template< typename element_t, bool enable_volume >
+	requires (std::is_base_of_v< Libs::NameableTrait, element_t >, std::is_base_of_v< LocatableInterface, element_t >)
+	class FlatOctree final
+	{
+		public:
+
+			/** @brief Class identifier. */
+			static constexpr auto ClassId{"FlatOctree"};
+
+			static constexpr auto SectorDivision{8UL};
+			static constexpr auto DefaultSectorElementLimit{8UL};
+			static constexpr auto DefaultMaxDepth{16UL};
+			static constexpr auto NoSector{std::numeric_limits< uint32_t >::max()};
+
+			static constexpr auto XPositiveYPositiveZPositive{0UL};
+			static constexpr auto XPositiveYPositiveZNegative{1UL};
+			static constexpr auto XPositiveYNegativeZPositive{2UL};
+			static constexpr auto XPositiveYNegativeZNegative{3UL};
+			static constexpr auto XNegativeYPositiveZPositive{4UL};
+			static constexpr auto XNegativeYPositiveZNegative{5UL};
+			static constexpr auto XNegativeYNegativeZPositive{6UL};
+			static constexpr auto XNegativeYNegativeZNegative{7UL};
+
+			/**
+			 * @brief A sector of the flat octree.
+			 * @extends EmEn::Libs::Math::Space3D::AACuboid A sector is a cube in the 3D space and thus provides intersection detection with primitives.
+			 */
+			class Sector final : public Libs::Math::Space3D::AACuboid< float >
+			{
+				friend class FlatOctree;
+
+				public:
+
+					/**
+					 * @brief Constructs an unused sector.
+					 */
+					Sector () noexcept = default;
+
+					/**
+					 * @brief Returns true if the sector is the top of the tree.
+					 * @return bool
+					 */
+					[[nodiscard]]
+					bool
+					isRoot () const noexcept
+					{
+						return m_parent == NoSector;
+					}
+
+					/**
+					 * @brief Returns whether the sector is an endpoint in the tree.
+					 * @return bool
+					 */
+					[[nodiscard]]
+					bool
+					isLeaf () const noexcept
+					{
+						return m_firstChild == NoSector;
+					}
+
+					/**
+					 * @brief Returns whether the sector has subsectors.
+					 * @return bool
+					 */
+					[[nodiscard]]
+					bool
+					isExpanded () const noexcept
+					{
+						return m_firstChild != NoSector;
+					}
+
+					/**
+					 * @brief Returns whether this sector has no element registered in it.
+					 * @note Only leaf sectors hold elements.
+					 * @return bool
+					 */
+					[[nodiscard]]
+					bool
+					empty () const noexcept
+					{
+						return m_elements.empty();
+					}
+
+					/**
+					 * @brief Returns the number of elements present in this sector.
+					 * @return size_t
+					 */
+					[[nodiscard]]
+					size_t
+					elementCount () const noexcept
+					{
+						return m_elements.size();
+					}
+
+					/**
+					 * @brief Returns the element list of the sector.
+					 * @return const std::vector< element_t * > &
+					 */
+					[[nodiscard]]
+					const std::vector< element_t * > &
+					elements () const noexcept
+					{
+						return m_elements;
+					}
+
+					/**
+					 * @brief Returns the slot of a subsector.
+					 * @warning It this sector is root, the value will be the max for a size_t.
+					 * @return size_t
+					 */
+					[[nodiscard]]
+					size_t
+					slot () const noexcept
+					{
+						return this->isRoot() ? std::numeric_limits< size_t >::max() : m_slot;
+					}
+
+					/**
+					 * @brief Returns the sector distance from the root sector.
+					 * @return size_t
+					 */
+					[[nodiscard]]
+					size_t
+					getDistance () const noexcept
+					{
+						return m_depth;
+					}
+
+					/**
+					 * @brief Returns the index of the parent sector in the pool.
+					 * @return uint32_t
+					 */
+					[[nodiscard]]
+					uint32_t
+					parentIndex () const noexcept
+					{
+						return m_parent;
+					}
+
+					/**
+					 * @brief Returns the index of the first subsector in the pool. The seven others follow.
+					 * @return uint32_t
+					 */
+					[[nodiscard]]
+					uint32_t
+					firstChildIndex () const noexcept
+					{
+						return m_firstChild;
+					}
+
+				private:
+
+					std::vector< element_t * > m_elements;
+					uint32_t m_parent{NoSector};
+					uint32_t m_firstChild{NoSector};
+					uint16_t m_depth{0};
+					uint8_t m_slot{0};
+			};
+
+			/**
+			 * @brief Constructs a flat octree.
+			 * @param maximum The highest limit of the root sector.
+			 * @param minimum The lowest limit of the root sector.
+			 * @param maxElementPerSector The threshold number of elements to trigger a new sector subdivision. Default 8.
+			 * @param enableAutoCollapse Enable a leaf sector to be automatically removed if empty. Default false.
+			 * @param maxDepth The depth limit where a sector won't be split anymore. Default 16.
+			 */
+			FlatOctree (const Libs::Math::Vector< 3, float > & maximum, const Libs::Math::Vector< 3, float > & minimum, size_t maxElementPerSector = DefaultSectorElementLimit, bool enableAutoCollapse = false, size_t maxDepth = DefaultMaxDepth) noexcept
+				: m_maxElementPerSector(std::max< size_t >(DefaultSectorElementLimit, maxElementPerSector)),
+				m_maxDepth(std::min< size_t >(maxDepth, std::numeric_limits< uint16_t >::max())),
+				m_autoCollapseEnabled(enableAutoCollapse)
+			{
+				m_sectors.emplace_back().set(maximum, minimum);
+			}
+
+			/**
+			 * @brief Returns the root sector.
+			 * @return const Sector &
+			 */
+			[[nodiscard]]
+			const Sector &
+			rootSector () const noexcept
+			{
+				return m_sectors[Root];
+			}
+
+			/**
+			 * @brief Returns the sector pool.
+			 * @warning Unused sectors stay in the pool as empty leaves.
+			 * @return const std::vector< Sector > &
+			 */
+			[[nodiscard]]
+			const std::vector< Sector > &
+			sectors () const noexcept
+			{
+				return m_sectors;
+			}
+
+			/**
+			 * @brief Returns the number of elements hold in an octree before expanding.
+			 * @return size_t
+			 */
+			[[nodiscard]]
+			size_t
+			maxElementPerSector () const noexcept
+			{
+				return m_maxElementPerSector;
+			}
+
+			/**
+			 * @brief Returns whether the automatic empty leaf sector removal is enabled.
+			 * @return bool
+			 */
+			[[nodiscard]]
+			bool
+			autoCollapseEnabled () const noexcept
+			{
+				return m_autoCollapseEnabled;
+			}
+
+			/**
+			 * @brief Returns the depth of the whole octree.
+			 * @return size_t
+			 */
+			[[nodiscard]]
+			size_t
+			getDepth () const noexcept
+			{
+				return this->getDepth(Root);
+			}
+
+			/**
+			 * @brief Returns the number of sectors in use in the octree (root included).
+			 * @return size_t
+			 */
+			[[nodiscard]]
+			size_t
+			getSectorCount () const noexcept
+			{
+				return m_sectors.size() - m_freeBlocks.size() * SectorDivision;
+			}
+
+			/**
+			 * @brief Reserves subsectors by specifying the desired depth.
+			 * @note This won't have any effect with automatic collapse enabled.
+			 * @param depth The number of levels to create below the root sector.
+			 * @return void
+			 */
+			void
+			reserve (size_t depth) noexcept
+			{
+				if ( m_autoCollapseEnabled )
+				{
+					Tracer::warning(ClassId, "Automatic empty subsectors removal is enabled !");
+
+					return;
+				}
+
+				this->reserve(Root, std::min(depth, m_maxDepth));
+			}
+
+			/**
+			 * @brief Returns whether the entity is present in the octree.
+			 * @param element A reference to an element smart pointer.
+			 * @return bool
+			 */
+			[[nodiscard]]
+			bool
+			contains (const std::shared_ptr< element_t > & element) const noexcept
+			{
+				return m_elementIndices.contains(element.get());
+			}
+
+			/**
+			 * @brief Adds an element to the octree.
+			 * @param element A reference to an element smart pointer.
+			 * @return bool
+			 */
+			bool
+			insert (const std::shared_ptr< element_t > & element) noexcept
+			{
+				if ( m_elementIndices.contains(element.get()) )
+				{
+					return false;
+				}
+
+				return this->withPrimitive(*element, [&] (const auto & primitive) {
+					if ( !Libs::Math::Space3D::isColliding(m_sectors[Root], primitive) )
+					{
+						return false;
+					}
+
+					m_elementIndices.emplace(element.get(), static_cast< uint32_t >(m_elements.size()));
+					m_elements.emplace_back(element);
+					auto & leaves = m_elementLeaves.emplace_back();
+
+					this->collectLeaves(Root, primitive, leaves);
+
+					for ( const auto leafIndex : leaves )
+					{
+						m_sectors[leafIndex].m_elements.emplace_back(element.get());
+					}
+
+					this->splitOverflowingLeaves(std::vector< uint32_t >{leaves});
+
+					return true;
+				});
+			}
+
+			/**
+			 * @brief Relocates an element which may have moved, without removing it from the octree first.
+			 * @note The search starts from the current element sector and only climbs up to the first sector enclosing the element.
+			 * @param element A reference to an element smart pointer.
+			 * @return bool
+			 */
+			bool
+			update (const std::shared_ptr< element_t > & element) noexcept
+			{
+				const auto elementIt = m_elementIndices.find(element.get());
+
+				if ( elementIt == m_elementIndices.end() )
+				{
+					return this->insert(element);
+				}
+
+				const auto elementIndex = elementIt->second;
+
+				return this->withPrimitive(*element, [&] (const auto & primitive) {
+					auto & leaves = m_elementLeaves[elementIndex];
+
+					/* NOTE: Find the closest sector enclosing the element. */
+					auto startIndex = leaves.front();
+
+					while ( !FlatOctree::encloses(m_sectors[startIndex], primitive) && !m_sectors[startIndex].isRoot() )
+					{
+						startIndex = m_sectors[startIndex].m_parent;
+					}
+
+					/* NOTE: The element is still inside its unique leaf. */
+					if ( leaves.size() == 1 && startIndex == leaves.front() )
+					{
+						return true;
+					}
+
+					if ( startIndex == Root && !Libs::Math::Space3D::isColliding(m_sectors[Root], primitive) )
+					{
+						return false;
+					}
+
+					m_scratchLeaves.clear();
+
+					this->collectLeaves(startIndex, primitive, m_scratchLeaves);
+
+					/* NOTE: Leaves from the previous location are no longer overlapped. */
+					std::vector< uint32_t > collapseCandidates;
+
+					for ( const auto leafIndex : leaves )
+					{
+						if ( std::ranges::find(m_scratchLeaves, leafIndex) == m_scratchLeaves.end() )
+						{
+							this->removeFromLeaf(leafIndex, element.get());
+
+							collapseCandidates.emplace_back(m_sectors[leafIndex].m_parent);
+						}
+					}
+
+					/* NOTE: Leaves from the new location. */
+					std::vector< uint32_t > addedLeaves;
+
+					for ( const auto leafIndex : m_scratchLeaves )
+					{
+						if ( std::ranges::find(leaves, leafIndex) == leaves.end() )
+						{
+							m_sectors[leafIndex].m_elements.emplace_back(element.get());
+
+							addedLeaves.emplace_back(leafIndex);
+						}
+					}
+
+					leaves = m_scratchLeaves;
+
+					this->splitOverflowingLeaves(addedLeaves);
+
+					if ( m_autoCollapseEnabled )
+					{
+						for ( const auto sectorIndex : collapseCandidates )
+						{
+							this->tryCollapse(sectorIndex);
+						}
+					}
+
+					return true;
+				});
+			}
+
+			/**
+			 * @brief Removes an element from the octree.
+			 * @param element A reference to an element smart pointer.
+			 * @return bool
+			 */
+			bool
+			erase (const std::shared_ptr< element_t > & element) noexcept
+			{
+				const auto elementIt = m_elementIndices.find(element.get());
+
+				if ( elementIt == m_elementIndices.end() )
+				{
+					TraceWarning{ClassId} << "Element '" << element->name() << "' is not part of the octree !";
+
+					return false;
+				}
+
+				const auto elementIndex = elementIt->second;
+
+				std::vector< uint32_t > collapseCandidates;
+
+				for ( const auto leafIndex : m_elementLeaves[elementIndex] )
+				{
+					this->removeFromLeaf(leafIndex, element.get());
+
+					collapseCandidates.emplace_back(m_sectors[leafIndex].m_parent);
+				}
+
+				/* NOTE: Keep the registry dense by moving the last element in the hole. */
+				const auto lastIndex = static_cast< uint32_t >(m_elements.size() - 1);
+
+				if ( elementIndex != lastIndex )
+				{
+					m_elements[elementIndex] = std::move(m_elements[lastIndex]);
+					m_elementLeaves[elementIndex] = std::move(m_elementLeaves[lastIndex]);
+					m_elementIndices[m_elements[elementIndex].get()] = elementIndex;
+				}
+
+				m_elements.pop_back();
+				m_elementLeaves.pop_back();
+				m_elementIndices.erase(elementIt);
+
+				if ( m_autoCollapseEnabled )
+				{
+					for ( const auto sectorIndex : collapseCandidates )
+					{
+						this->tryCollapse(sectorIndex);
+					}
+				}
+
+				return true;
+			}
+
+			/**
+			 * @brief Returns the number of elements present in the octree.
+			 * @return size_t
+			 */
+			[[nodiscard]]
+			size_t
+			elementCount () const noexcept
+			{
+				return m_elements.size();
+			}
+
+			/**
+			 * @brief Returns the element list of the octree.
+			 * @return const std::vector< std::shared_ptr< element_t > > &
+			 */
+			[[nodiscard]]
+			const std::vector< std::shared_ptr< element_t > > &
+			elements () const noexcept
+			{
+				return m_elements;
+			}
+
+			/**
+			 * @brief Tries to find the first named element in the octree.
+			 * @param name A reference to a string
+			 * @return std::shared_ptr< element_t >
+			 */
+			[[nodiscard]]
+			std::shared_ptr< element_t >
+			getFirstElementNamed (const std::string & name) const noexcept
+			{
+				for ( const auto & element : m_elements )
+				{
+					if ( element->name() == name )
+					{
+						return element;
+					}
+				}
+
+				return nullptr;
+			}
+
+			/**
+			 * @brief Executes a function on every leaf sector inside the area.
+			 * @tparam primitive_t The type of primitive for collision detection.
+			 * @param primitive A reference to the primitive.
+			 * @param function A reference to lambda.
+			 * @return void
+			 */
+			template< typename primitive_t >
+			void
+			forTouchedSector (const primitive_t & primitive, const std::function< void (const Sector &) > & function) const noexcept
+			{
+				this->forTouchedSector(Root, primitive, function);
+			}
+
+			/**
+			 * @brief Executes a function on every leaf sector holding at least one element.
+			 * @note The pool is walked linearly, so the order follows the sector allocations and not the tree.
+			 * @param function A reference to lambda.
+			 * @return void
+			 */
+			void
+			forEachLeafSector (const std::function< void (const Sector &) > & function) const noexcept
+			{
+				for ( const auto & sector : m_sectors )
+				{
+					if ( sector.isLeaf() && !sector.empty() )
+					{
+						function(sector);
+					}
+				}
+			}
+
+		private:
+
+			/**
+			 * @brief Calls a function with the collision primitive of an element.
+			 * @note This is the main function determining the collision primitive to use.
+			 * @tparam function_t The type of the function.
+			 * @param element A reference to an element.
+			 * @param function A reference to a generic lambda.
+			 * @return bool
+			 */
+			template< typename function_t >
+			static
+			bool
+			withPrimitive (const element_t & element, function_t && function) noexcept
+			{
+				if constexpr ( enable_volume )
+				{
+					if ( element.sphereCollisionIsEnabled() )
+					{
+						return function(element.getWorldBoundingSphere());
+					}
+
+					return function(element.getWorldBoundingBox());
+				}
+				else
+				{
+					return function(element.getWorldCoordinates().position());
+				}
+			}
+
+			/**
+			 * @brief Returns the subsector slot containing a point.
+			 * @param sector A reference to the parent sector.
+			 * @param point A reference to a point.
+			 * @return size_t
+			 */
+			[[nodiscard]]
+			static
+			size_t
+			getSlot (const Sector & sector, const Libs::Math::Vector< 3, float > & point) noexcept
+			{
+				using namespace EmEn::Libs::Math;
+
+				const auto center = sector.centroid();
+
+				size_t slot = 0;
+
+				if ( point[X] < center[X] )
+				{
+					slot |= 4UL;
+				}
+
+				if ( point[Y] < center[Y] )
+				{
+					slot |= 2UL;
+				}
+
+				if ( point[Z] < center[Z] )
+				{
+					slot |= 1UL;
+				}
+
+				return slot;
+			}
+
+			/**
+			 * @brief Returns the center of a primitive.
+			 * @param point A reference to a point.
+			 * @return Libs::Math::Vector< 3, float >
+			 */
+			[[nodiscard]]
+			static
+			Libs::Math::Vector< 3, float >
+			getCenter (const Libs::Math::Vector< 3, float > & point) noexcept
+			{
+				return point;
+			}
+
+			/**
+			 * @brief Returns the center of a primitive.
+			 * @param sphere A reference to a sphere.
+			 * @return Libs::Math::Vector< 3, float >
+			 */
+			[[nodiscard]]
+			static
+			Libs::Math::Vector< 3, float >
+			getCenter (const Libs::Math::Space3D::Sphere< float > & sphere) noexcept
+			{
+				return sphere.position();
+			}
+
+			/**
+			 * @brief Returns the center of a primitive.
+			 * @param box A reference to a box.
+			 * @return Libs::Math::Vector< 3, float >
+			 */
+			[[nodiscard]]
+			static
+			Libs::Math::Vector< 3, float >
+			getCenter (const Libs::Math::Space3D::AACuboid< float > & box) noexcept
+			{
+				return box.centroid();
+			}
+
+			/**
+			 * @brief Returns whether a sector completely holds a primitive.
+			 * @param sector A reference to a sector.
+			 * @param point A reference to a point.
+			 * @return bool
+			 */
+			[[nodiscard]]
+			static
+			bool
+			encloses (const Sector & sector, const Libs::Math::Vector< 3, float > & point) noexcept
+			{
+				return Libs::Math::Space3D::isColliding(sector, point);
+			}
+
+			/**
+			 * @brief Returns whether a sector completely holds a primitive.
+			 * @param sector A reference to a sector.
+			 * @param sphere A reference to a sphere.
+			 * @return bool
+			 */
+			[[nodiscard]]
+			static
+			bool
+			encloses (const Sector & sector, const Libs::Math::Space3D::Sphere< float > & sphere) noexcept
+			{
+				const auto & position = sphere.position();
+				const auto radius = sphere.radius();
+
+				for ( size_t axis = 0; axis < 3; axis++ )
+				{
+					if ( position[axis] - radius < sector.minimum(axis) || position[axis] + radius > sector.maximum(axis) )
+					{
+						return false;
+					}
+				}
+
+				return true;
+			}
+
+			/**
+			 * @brief Returns whether a sector completely holds a primitive.
+			 * @param sector A reference to a sector.
+			 * @param box A reference to a box.
+			 * @return bool
+			 */
+			[[nodiscard]]
+			static
+			bool
+			encloses (const Sector & sector, const Libs::Math::Space3D::AACuboid< float > & box) noexcept
+			{
+				for ( size_t axis = 0; axis < 3; axis++ )
+				{
+					if ( box.minimum(axis) < sector.minimum(axis) || box.maximum(axis) > sector.maximum(axis) )
+					{
+						return false;
+					}
+				}
+
+				return true;
+			}
+
+			/**
+			 * @brief Collects the leaf sectors overlapped by a primitive below a sector.
+			 * @note A point always ends in one leaf. A volume which overlaps no leaf anymore (precision issue) is attached to the closest one.
+			 * @tparam primitive_t The type of primitive.
+			 * @param sectorIndex The sector index to start from.
+			 * @param primitive A reference to the primitive.
+			 * @param leaves A reference to the leaf index list.
+			 * @return void
+			 */
+			template< typename primitive_t >
+			void
+			collectLeaves (uint32_t sectorIndex, const primitive_t & primitive, std::vector< uint32_t > & leaves) const noexcept
+			{
+				if constexpr ( enable_volume )
+				{
+					const auto previousCount = leaves.size();
+
+					this->collectOverlappedLeaves(sectorIndex, primitive, leaves);
+
+					if ( leaves.size() > previousCount )
+					{
+						return;
+					}
+				}
+
+				const auto center = FlatOctree::getCenter(primitive);
+
+				while ( m_sectors[sectorIndex].isExpanded() )
+				{
+					sectorIndex = m_sectors[sectorIndex].m_firstChild + static_cast< uint32_t >(FlatOctree::getSlot(m_sectors[sectorIndex], center));
+				}
+
+				leaves.emplace_back(sectorIndex);
+			}
+
+			/**
+			 * @brief Collects recursively the leaf sectors colliding with a primitive.
+			 * @tparam primitive_t The type of primitive.
+			 * @param sectorIndex The sector index.
+			 * @param primitive A reference to the primitive.
+			 * @param leaves A reference to the leaf index list.
+			 * @return void
+			 */
+			template< typename primitive_t >
+			void
+			collectOverlappedLeaves (uint32_t sectorIndex, const primitive_t & primitive, std::vector< uint32_t > & leaves) const noexcept
+			{
+				const auto & sector = m_sectors[sectorIndex];
+
+				if ( !Libs::Math::Space3D::isColliding(sector, primitive) )
+				{
+					return;
+				}
+
+				if ( sector.isLeaf() )
+				{
+					leaves.emplace_back(sectorIndex);
+
+					return;
+				}
+
+				for ( uint32_t slot = 0; slot < SectorDivision; slot++ )
+				{
+					this->collectOverlappedLeaves(sector.m_firstChild + slot, primitive, leaves);
+				}
+			}
+
+			/**
+			 * @brief Executes a function on every leaf sector inside the area below a sector.
+			 * @tparam primitive_t The type of primitive for collision detection.
+			 * @param sectorIndex The sector index.
+			 * @param primitive A reference to the primitive.
+			 * @param function A reference to lambda.
+			 * @return void
+			 */
+			template< typename primitive_t >
+			void
+			forTouchedSector (uint32_t sectorIndex, const primitive_t & primitive, const std::function< void (const Sector &) > & function) const noexcept
+			{
+				const auto & sector = m_sectors[sectorIndex];
+
+				if ( !Libs::Math::Space3D::isColliding(sector, primitive) )
+				{
+					return;
+				}
+
+				if ( sector.isLeaf() )
+				{
+					if ( !sector.empty() )
+					{
+						function(sector);
+					}
+
+					return;
+				}
+
+				for ( uint32_t slot = 0; slot < SectorDivision; slot++ )
+				{
+					this->forTouchedSector(sector.m_firstChild + slot, primitive, function);
+				}
+			}
+
+			/**
+			 * @brief Returns the depth below a sector.
+			 * @param sectorIndex The sector index.
+			 * @return size_t
+			 */
+			[[nodiscard]]
+			size_t
+			getDepth (uint32_t sectorIndex) const noexcept
+			{
+				const auto & sector = m_sectors[sectorIndex];
+
+				if ( sector.isLeaf() )
+				{
+					return 0;
+				}
+
+				size_t belowDepth = 0;
+
+				for ( uint32_t slot = 0; slot < SectorDivision; slot++ )
+				{
+					belowDepth = std::max(belowDepth, this->getDepth(sector.m_firstChild + slot));
+				}
+
+				return 1 + belowDepth;
+			}
+
+			/**
+			 * @brief Splits sectors down to a depth.
+			 * @param sectorIndex The sector index.
+			 * @param depth The remaining depth.
+			 * @return void
+			 */
+			void
+			reserve (uint32_t sectorIndex, size_t depth) noexcept
+			{
+				if ( depth == 0 )
+				{
+					return;
+				}
+
+				if ( m_sectors[sectorIndex].isLeaf() )
+				{
+					this->split(sectorIndex);
+				}
+
+				const auto firstChild = m_sectors[sectorIndex].m_firstChild;
+
+				for ( uint32_t slot = 0; slot < SectorDivision; slot++ )
+				{
+					this->reserve(firstChild + slot, depth - 1);
+				}
+			}
+
+			/**
+			 * @brief Removes an element pointer from a leaf sector.
+			 * @param leafIndex The leaf sector index.
+			 * @param element A pointer to the element.
+			 * @return void
+			 */
+			void
+			removeFromLeaf (uint32_t leafIndex, const element_t * element) noexcept
+			{
+				auto & elements = m_sectors[leafIndex].m_elements;
+
+				const auto elementIt = std::ranges::find(elements, element);
+
+				if ( elementIt != elements.end() )
+				{
+					*elementIt = elements.back();
+
+					elements.pop_back();
+				}
+			}
+
+			/**
+			 * @brief Returns a block of eight consecutive sectors.
+			 * @warning This can invalidate every reference to the sector pool.
+			 * @return uint32_t
+			 */
+			[[nodiscard]]
+			uint32_t
+			allocateBlock () noexcept
+			{
+				if ( !m_freeBlocks.empty() )
+				{
+					const auto firstIndex = m_freeBlocks.back();
+
+					m_freeBlocks.pop_back();
+
+					return firstIndex;
+				}
+
+				const auto firstIndex = static_cast< uint32_t >(m_sectors.size());
+
+				m_sectors.resize(m_sectors.size() + SectorDivision);
+
+				return firstIndex;
+			}
+
+			/**
+			 * @brief Splits the leaves which exceed the element limit.
+			 * @param leaves The leaf index list.
+			 * @return void
+			 */
+			void
+			splitOverflowingLeaves (const std::vector< uint32_t > & leaves) noexcept
+			{
+				for ( const auto leafIndex : leaves )
+				{
+					const auto & sector = m_sectors[leafIndex];
+
+					if ( sector.isLeaf() && sector.m_elements.size() > m_maxElementPerSector && sector.m_depth < m_maxDepth )
+					{
+						this->split(leafIndex);
+					}
+				}
+			}
+
+			/**
+			 * @brief Expands a leaf sector to eight new ones and redistributes its elements.
+			 * @param sectorIndex The leaf sector index.
+			 * @return void
+			 */
+			void
+			split (uint32_t sectorIndex) noexcept
+			{
+				using namespace EmEn::Libs::Math;
+
+				const auto firstChild = this->allocateBlock();
+
+				auto & sector = m_sectors[sectorIndex];
+
+				const auto size = sector.width() * 0.5F;
+				const auto & max = sector.maximum();
+
+				for ( uint32_t slot = 0; slot < SectorDivision; slot++ )
+				{
+					auto childMax = max;
+
+					if ( (slot & 4U) != 0 )
+					{
+						childMax[X] -= size;
+					}
+
+					if ( (slot & 2U) != 0 )
+					{
+						childMax[Y] -= size;
+					}
+
+					if ( (slot & 1U) != 0 )
+					{
+						childMax[Z] -= size;
+					}
+
+					auto & child = m_sectors[firstChild + slot];
+					child.set(childMax, childMax - size);
+					child.m_elements.clear();
+					child.m_parent = sectorIndex;
+					child.m_firstChild = NoSector;
+					child.m_depth = static_cast< uint16_t >(sector.m_depth + 1);
+					child.m_slot = static_cast< uint8_t >(slot);
+				}
+
+				sector.m_firstChild = firstChild;
+
+				const auto elements = std::move(sector.m_elements);
+
+				sector.m_elements.clear();
+
+				/* Now, we redistribute the sector elements to the subsectors. */
+				for ( auto * element : elements )
+				{
+					auto & leaves = m_elementLeaves[m_elementIndices.find(element)->second];
+
+					std::erase(leaves, sectorIndex);
+
+					const auto previousCount = leaves.size();
+
+					FlatOctree::withPrimitive(*element, [&] (const auto & primitive) {
+						this->collectLeaves(sectorIndex, primitive, leaves);
+
+						return true;
+					});
+
+					for ( auto leafIt = leaves.begin() + static_cast< std::ptrdiff_t >(previousCount); leafIt != leaves.end(); ++leafIt )
+					{
+						m_sectors[*leafIt].m_elements.emplace_back(element);
+					}
+				}
+
+				std::vector< uint32_t > children(SectorDivision);
+
+				for ( uint32_t slot = 0; slot < SectorDivision; slot++ )
+				{
+					children[slot] = firstChild + slot;
+				}
+
+				this->splitOverflowingLeaves(children);
+			}
+
+			/**
+			 * @brief Merges the subsectors of a sector when they are all leaves under the half of the element limit, then checks the parent.
+			 * @param sectorIndex The sector index.
+			 * @return void
+			 */
+			void
+			tryCollapse (uint32_t sectorIndex) noexcept
+			{
+				while ( sectorIndex != NoSector )
+				{
+					auto & sector = m_sectors[sectorIndex];
+
+					if ( sector.isLeaf() )
+					{
+						return;
+					}
+
+					/* NOTE: With volumes, this is an upper bound of the distinct element count. */
+					size_t elementCount = 0;
+
+					for ( uint32_t slot = 0; slot < SectorDivision; slot++ )
+					{
+						const auto & child = m_sectors[sector.m_firstChild + slot];
+
+						if ( child.isExpanded() )
+						{
+							return;
+						}
+
+						elementCount += child.m_elements.size();
+					}
+
+					if ( elementCount >= m_maxElementPerSector / 2 )
+					{
+						return;
+					}
+
+					const auto firstChild = sector.m_firstChild;
+
+					for ( uint32_t slot = 0; slot < SectorDivision; slot++ )
+					{
+						auto & child = m_sectors[firstChild + slot];
+
+						for ( auto * element : child.m_elements )
+						{
+							auto & leaves = m_elementLeaves[m_elementIndices.find(element)->second];
+
+							std::erase(leaves, firstChild + slot);
+
+							if ( std::ranges::find(leaves, sectorIndex) == leaves.end() )
+							{
+								leaves.emplace_back(sectorIndex);
+
+								sector.m_elements.emplace_back(element);
+							}
+						}
+
+						child.m_elements.clear();
+					}
+
+					sector.m_firstChild = NoSector;
+
+					m_freeBlocks.emplace_back(firstChild);
+
+					sectorIndex = sector.m_parent;
+				}
+			}
+
+			static constexpr uint32_t Root{0};
+
+			std::vector< Sector > m_sectors;
+			std::vector< uint32_t > m_freeBlocks;
+			std::vector< std::shared_ptr< element_t > > m_elements;
+			std::vector< std::vector< uint32_t > > m_elementLeaves;
+			std::unordered_map< const element_t *, uint32_t > m_elementIndices;
+			std::vector< uint32_t > m_scratchLeaves;
+			size_t m_maxElementPerSector;
+			size_t m_maxDepth;
+			bool m_autoCollapseEnabled;
+	};
+}
@@ -486,8 +486,15 @@ namespace EmEn::Scenes
 			return false;
 		}
 
+		/* NOTE: Connecting the render targets requests every pipeline of the scene, they are built together on the job system workers. */
+		m_graphicsRenderer.beginPipelinePrewarm();
+
 		/* Checks whether the scene is usable and tries to complete it otherwise. */
-		if ( !scene->initialize(m_primaryServices.settings()) )
+		const auto initialized = scene->initialize(m_primaryServices.settings());
+
+		m_graphicsRenderer.endPipelinePrewarm();
+
+		if ( !initialized )
 		{
 			TraceError{ClassId} << "Unable to initialize the scene '" << scene->name() << "' !";
 
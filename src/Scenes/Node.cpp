@@ -30,7 +30,6 @@
 #include <algorithm>
 #include <memory>
 #include <ranges>
-#include <stack>
 
 /* Local inclusions. */
 #include "Libs/Math/OrientedCuboid.hpp"
@@ -643,6 +642,17 @@ namespace EmEn::Scenes
 
 	CartesianFrame< float >
 	Node::getWorldCoordinates () const noexcept
+	{
+		if ( !m_worldCacheDirty )
+		{
+			return m_worldCoordinates;
+		}
+
+		return this->computeWorldCoordinates();
+	}
+
+	CartesianFrame< float >
+	Node::computeWorldCoordinates () const noexcept
 	{
 		/* NOTE: As root, return the origin!
 		 * If the parent is the root node, return the frame. */
@@ -651,33 +661,102 @@ namespace EmEn::Scenes
 			return m_cartesianFrame;
 		}
 
-		/* Stack up a reversed tree for each cartesian frame. */
-		std::stack< CartesianFrame< float > > reversedTree;
+		Matrix< 4, float > matrix;
+		Vector< 3, float > scalingVector{1.0F, 1.0F, 1.0F};
+
+		this->computeWorldTransform(matrix, scalingVector);
 
+		return CartesianFrame< float >{matrix, scalingVector};
+	}
+
+	void
+	Node::computeWorldTransform (Matrix< 4, float > & matrix, Vector< 3, float > & scaling) const noexcept
+	{
+		/* NOTE: Stop climbing the tree at the first node with a valid cache. */
+		if ( !m_worldCacheDirty )
 		{
-			const auto * node = this;
+			matrix = m_worldMatrix;
+			scaling = m_worldScaling;
 
-			/* While parent is not root. */
-			while ( node != nullptr )
-			{
-				reversedTree.emplace(node->localCoordinates());
+			return;
+		}
 
-				node = node->m_parent.lock().get();
-			}
+		const auto parentNode = m_parent.lock();
+
+		if ( parentNode == nullptr )
+		{
+			matrix = m_cartesianFrame.getModelMatrix();
+			scaling = m_cartesianFrame.scalingFactor();
+
+			return;
 		}
 
-		Matrix< 4, float > matrix;
-		Vector< 3, float > scalingVector{1.0F, 1.0F, 1.0F};
+		parentNode->computeWorldTransform(matrix, scaling);
+
+		matrix *= m_cartesianFrame.getModelMatrix();
+		scaling *= m_cartesianFrame.scalingFactor();
+	}
 
-		while ( !reversedTree.empty() )
+	void
+	Node::updateWorldCacheTree () noexcept
+	{
+		if ( m_worldCacheDirty )
 		{
-			matrix *= reversedTree.top().getModelMatrix();
-			scalingVector *= reversedTree.top().scalingFactor();
+			const auto parentNode = m_parent.lock();
+
+			if ( parentNode == nullptr )
+			{
+				m_worldMatrix = m_cartesianFrame.getModelMatrix();
+				m_worldScaling = m_cartesianFrame.scalingFactor();
+				m_worldCoordinates = m_cartesianFrame;
+				m_worldBoundingBox = {};
+				m_worldBoundingSphere = {};
+			}
+			else
+			{
+				/* NOTE: The parent cache is always up-to-date here, this is a top-down pass. */
+				m_worldMatrix = parentNode->m_worldMatrix;
+				m_worldMatrix *= m_cartesianFrame.getModelMatrix();
+
+				m_worldScaling = parentNode->m_worldScaling;
+				m_worldScaling *= m_cartesianFrame.scalingFactor();
+
+				m_worldCoordinates = parentNode->isRoot() ? m_cartesianFrame : CartesianFrame< float >{m_worldMatrix, m_worldScaling};
 
-			reversedTree.pop();
+				m_worldBoundingBox = OrientedCuboid< float >{this->localBoundingBox(), m_worldCoordinates}.getAxisAlignedBox();
+				m_worldBoundingSphere = {
+					this->localBoundingSphere().radius(),
+					m_worldCoordinates.position() + this->localBoundingSphere().position()
+				};
+			}
+
+			m_worldCacheDirty = false;
+
+			/* Dispatch the movement to every component. */
+			if ( parentNode != nullptr )
+			{
+				this->onContainerMove(m_worldCoordinates);
+			}
 		}
 
-		return CartesianFrame< float >{matrix, scalingVector};
+		for ( const auto & subNode : m_children | std::views::values )
+		{
+			subNode->updateWorldCacheTree();
+		}
+	}
+
+	void
+	Node::invalidateWorldCache () noexcept
+	{
+		m_worldCacheDirty = true;
+
+		/* The location has been changed, so the physics simulation must be relaunched. */
+		this->pauseSimulation(false);
+
+		for ( const auto & subNode : m_children | std::views::values )
+		{
+			subNode->invalidateWorldCache();
+		}
 	}
 
 	Space3D::AACuboid< float >
@@ -689,12 +768,12 @@ namespace EmEn::Scenes
 			return {};
 		}
 
-		if ( this->parent()->isRoot() )
+		if ( !m_worldCacheDirty )
 		{
-			return OrientedCuboid< float >{this->localBoundingBox(), m_cartesianFrame}.getAxisAlignedBox();
+			return m_worldBoundingBox;
 		}
 
-		return OrientedCuboid< float >{this->localBoundingBox(), this->getWorldCoordinates()}.getAxisAlignedBox();
+		return OrientedCuboid< float >{this->localBoundingBox(), this->computeWorldCoordinates()}.getAxisAlignedBox();
 	}
 
 	Space3D::Sphere< float >
@@ -706,17 +785,14 @@ namespace EmEn::Scenes
 			return {};
 		}
 
-		if ( this->parent()->isRoot() )
+		if ( !m_worldCacheDirty )
 		{
-			return {
-				this->localBoundingSphere().radius(),
-				m_cartesianFrame.position() + this->localBoundingSphere().position()
-			};
+			return m_worldBoundingSphere;
 		}
 
 		return {
 			this->localBoundingSphere().radius(),
-			this->getWorldCoordinates().position() + this->localBoundingSphere().position()
+			this->computeWorldCoordinates().position() + this->localBoundingSphere().position()
 		};
 	}
 
@@ -758,24 +834,10 @@ namespace EmEn::Scenes
 			return;
 		}
 
-		/* Dispatch the movement to every component. */
-		if ( this->parent()->isRoot() )
-		{
-			this->onContainerMove(m_cartesianFrame);
-		}
-		else
-		{
-			this->onContainerMove(this->getWorldCoordinates());
-		}
-
-		/* Dispatch the movement to every sub node. */
-		for ( const auto & subNode : m_children | std::views::values )
-		{
-			subNode->onLocationDataUpdate();
-		}
-
-		/* The location has been changed, so the physics simulation must be relaunched. */
-		this->pauseSimulation(false);
+		/* NOTE: Only flag the sub-tree, the world coordinates are recomputed and
+		 * dispatched to components once per logic cycle by updateWorldCacheTree().
+		 * While the logics are paused, the Core keeps doing it with Scene::updateWorldCoordinates(). */
+		this->invalidateWorldCache();
 	}
 
 	bool
@@ -808,6 +870,9 @@ namespace EmEn::Scenes
 	void
 	Node::onContentModified () noexcept
 	{
+		/* NOTE: The local bounding primitives may have changed. */
+		m_worldCacheDirty = true;
+
 		this->notify(EntityContentModified, this->shared_from_this());
 	}
 
@@ -230,6 +230,8 @@ namespace EmEn::Scenes
 			setLocalCoordinates (const Libs::Math::CartesianFrame< float > & coordinates) noexcept override
 			{
 				m_cartesianFrame = coordinates;
+
+				this->onLocationDataUpdate();
 			}
 
 			/** @copydoc EmEn::Scenes::LocatableInterface::localCoordinates() const */
@@ -526,6 +528,26 @@ namespace EmEn::Scenes
 			 */
 			void trimTree () noexcept;
 
+			/**
+			 * @brief Refreshes the cached world coordinates and bounding primitives of this node and its sub-nodes.
+			 * @note This is a top-down pass, only nodes flagged dirty are recomputed from their parent cache.
+			 * The movement is dispatched to the components of every refreshed node.
+			 * This should be called once per logic cycle by the scene.
+			 * @return void
+			 */
+			void updateWorldCacheTree () noexcept;
+
+			/**
+			 * @brief Returns whether the cached world coordinates of this node must be refreshed.
+			 * @return bool
+			 */
+			[[nodiscard]]
+			bool
+			isWorldCacheDirty () const noexcept
+			{
+				return m_worldCacheDirty;
+			}
+
 			/**
 			 * @brief Checks is this node is visible to frustum.
 			 * @param frustum The frustum where the node is tested.
@@ -616,6 +638,28 @@ namespace EmEn::Scenes
 			/** @copydoc EmEn::Scenes::AbstractEntity::onContentModified() */
 			void onContentModified () noexcept override;
 
+			/**
+			 * @brief Flags the world cache of this node and every sub node as dirty.
+			 * @return void
+			 */
+			void invalidateWorldCache () noexcept;
+
+			/**
+			 * @brief Computes the world transform of this node from the nearest clean cache up in the tree.
+			 * @note The result is not stored, this is the fallback when the cache is dirty.
+			 * @param matrix A reference to the accumulated model matrix.
+			 * @param scaling A reference to the accumulated scaling vector.
+			 * @return void
+			 */
+			void computeWorldTransform (Libs::Math::Matrix< 4, float > & matrix, Libs::Math::Vector< 3, float > & scaling) const noexcept;
+
+			/**
+			 * @brief Computes the world coordinates without using the own cache.
+			 * @return Libs::Math::CartesianFrame< float >
+			 */
+			[[nodiscard]]
+			Libs::Math::CartesianFrame< float > computeWorldCoordinates () const noexcept;
+
 			/* Flag names. */
 			static constexpr auto IsDiscardable{NextFlag + 0UL};
 
@@ -623,6 +667,13 @@ namespace EmEn::Scenes
 			std::weak_ptr< Node > m_parent;
 			std::map< std::string, std::shared_ptr< Node > > m_children;
 			Libs::Math::CartesianFrame< float > m_cartesianFrame;
+			/* NOTE: World space cache, refreshed by updateWorldCacheTree(). */
+			Libs::Math::Matrix< 4, float > m_worldMatrix;
+			Libs::Math::Vector< 3, float > m_worldScaling{1.0F, 1.0F, 1.0F};
+			Libs::Math::CartesianFrame< float > m_worldCoordinates;
+			Libs::Math::Space3D::AACuboid< float > m_worldBoundingBox;
+			Libs::Math::Space3D::Sphere< float > m_worldBoundingSphere;
 			uint64_t m_lifetime{0};
+			bool m_worldCacheDirty{true};
 	};
 }
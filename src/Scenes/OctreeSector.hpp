@@ -660,6 +660,32 @@ namespace EmEn::Scenes
 				}
 			}
 
+			/**
+			 * @brief Executes a function on every leaf sector holding at least one element below this one.
+			 * @param function A reference to lambda.
+			 * @return void
+			 */
+			void
+			forEachLeafSector (const std::function< void (const OctreeSector &) > & function) const noexcept
+			{
+				if ( m_elements.empty() )
+				{
+					return;
+				}
+
+				if ( this->isLeaf() )
+				{
+					function(*this);
+
+					return;
+				}
+
+				for ( const auto & subSector : m_subSectors )
+				{
+					subSector->forEachLeafSector(function);
+				}
+			}
+
 			/**
 			 * @brief Returns a pointer to a subsector when an element appears.
 			 * @note This assumes the element is part of this sector.
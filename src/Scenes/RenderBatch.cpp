@@ -30,8 +30,8 @@ namespace EmEn::Scenes
 {
 	using namespace Graphics;
 
-	RenderBatch::RenderBatch (const std::shared_ptr< const RenderableInstance::Abstract > & renderableInstance, size_t subGeometryIndex) noexcept
-		: m_renderableInstance(renderableInstance), m_subGeometryIndex(subGeometryIndex)
+	RenderBatch::RenderBatch (const std::shared_ptr< const RenderableInstance::Abstract > & renderableInstance, size_t subGeometryIndex, uint32_t levelOfDetail) noexcept
+		: m_renderableInstance(renderableInstance), m_subGeometryIndex(subGeometryIndex), m_levelOfDetail(levelOfDetail)
 	{
 
 	}
@@ -30,7 +30,6 @@
 #include <cstdint>
 #include <cstddef>
 #include <memory>
-#include <map>
 
 /* Local inclusions for usages. */
 #include "Graphics/RenderableInstance/Abstract.hpp"
@@ -38,20 +37,19 @@
 namespace EmEn::Scenes
 {
 	/**
-	 * @brief The RenderBatch class
+	 * @brief The RenderBatch class, a renderable instance layer to draw. Ordered by the RenderQueue.
 	 */
 	class RenderBatch final
 	{
 		public :
 
-			using List = std::multimap< uint64_t, RenderBatch >;
-
 			/**
 			 * @brief Constructs a render batch.
 			 * @param renderableInstance A reference to a renderable instance smart pointer.
 			 * @param subGeometryIndex The layer index of the renderable. Default 0.
+			 * @param levelOfDetail The level of detail of the renderable geometry. Default 0.
 			 */
-			explicit RenderBatch (const std::shared_ptr< const Graphics::RenderableInstance::Abstract > & renderableInstance, size_t subGeometryIndex = 0) noexcept;
+			explicit RenderBatch (const std::shared_ptr< const Graphics::RenderableInstance::Abstract > & renderableInstance, size_t subGeometryIndex = 0, uint32_t levelOfDetail = 0) noexcept;
 
 			/**
 			 * @brief Returns the renderable instance pointer.
@@ -76,29 +74,20 @@ namespace EmEn::Scenes
 			}
 
 			/**
-			 * @brief Static method to instantiate a render batch and register it to a render list.
-			 * @param renderList A referencer to a render list.
-			 * @param distance The distance of the renderable from the camera.
-			 * @param renderableInstance A pointer to the renderable instance.
-			 * @param subGeometryIndex The layer index of the renderable.
-			 * @return void
+			 * @brief Returns the level of detail of the renderable geometry to draw.
+			 * @return uint32_t
 			 */
-			static
-			void
-			create (List & renderList, float distance, const std::shared_ptr< Graphics::RenderableInstance::Abstract > & renderableInstance, size_t subGeometryIndex = 0UL) noexcept
+			[[nodiscard]]
+			uint32_t
+			levelOfDetail () const noexcept
 			{
-				renderList.emplace(
-					std::piecewise_construct,
-					std::forward_as_tuple(static_cast< uint64_t >(distance * DistanceMultiplier)),
-					std::forward_as_tuple(renderableInstance, subGeometryIndex)
-				);
+				return m_levelOfDetail;
 			}
 
 		private :
 
-			static constexpr auto DistanceMultiplier{1000UL};
-
 			std::shared_ptr< const Graphics::RenderableInstance::Abstract > m_renderableInstance;
 			size_t m_subGeometryIndex;
+			uint32_t m_levelOfDetail;
 	};
 }
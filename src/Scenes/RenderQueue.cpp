@@ -0,0 +1,179 @@
+/*
+ * src/Scenes/RenderQueue.cpp
+ * This file is part of Emeraude-Engine
+ *
+ * Copyright (C) 2010-2025 - Sébastien Léon Claude Christian Bémelmans "LondNoir" <londnoir@gmail.com>
+ *
+ * Emeraude-Engine is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * Emeraude-Engine is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with Emeraude-Engine; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * Complete project and additional information can be found at :
+ * https://github.com/londnoir/emeraude-engine
+ *
+ * --- THIS IS AUTOMATICALLY GENERATED, DO NOT CHANGE ---
+ */
+
+#include "RenderQueue.hpp"
+
+/* STL inclusions. */
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <utility>
+
+namespace EmEn::Scenes
+{
+	using namespace Graphics;
+
+	uint64_t
+	RenderQueue::hashPointer (const void * pointer, uint32_t bits) noexcept
+	{
+		/* NOTE: 64-bit finalizer from MurmurHash3, spreading the allocator alignment over all bits. */
+		auto hash = static_cast< uint64_t >(reinterpret_cast< uintptr_t >(pointer));
+		hash ^= hash >> 33;
+		hash *= 0xFF51AFD7ED558CCDULL;
+		hash ^= hash >> 33;
+		hash *= 0xC4CEB9FE1A85EC53ULL;
+		hash ^= hash >> 33;
+
+		return hash >> (64U - bits);
+	}
+
+	uint32_t
+	RenderQueue::depthBits (float distance) noexcept
+	{
+		/* NOTE: For positive IEEE-754 values, the integer order of the bit pattern is the float order. */
+		return std::bit_cast< uint32_t >(std::max(distance, 0.0F));
+	}
+
+	uint64_t
+	RenderQueue::opaqueKey (RenderPassType renderPassType, const void * pipeline, const void * material, const void * geometry, float distance) noexcept
+	{
+		const auto pass = static_cast< uint64_t >(renderPassType) & 0xFULL;
+
+		return
+			(pass << 60) |
+			(hashPointer(pipeline, 16) << 44) |
+			(hashPointer(material, 16) << 28) |
+			(hashPointer(geometry, 12) << 16) |
+			static_cast< uint64_t >(depthBits(distance) >> 16);
+	}
+
+	uint64_t
+	RenderQueue::translucentKey (RenderPassType renderPassType, const void * pipeline, const void * material, const void * geometry, float distance) noexcept
+	{
+		const auto pass = static_cast< uint64_t >(renderPassType) & 0xFULL;
+		/* NOTE: The sign bit is always clear, the 28 next bits are inverted to draw the farthest first. */
+		const auto invertedDepth = static_cast< uint64_t >(~(depthBits(distance) >> 3) & 0x0FFFFFFFU);
+
+		return
+			(pass << 60) |
+			(invertedDepth << 32) |
+			(hashPointer(pipeline, 12) << 20) |
+			(hashPointer(material, 12) << 8) |
+			hashPointer(geometry, 8);
+	}
+
+	void
+	RenderQueue::push (uint64_t sortKey, const std::shared_ptr< const RenderableInstance::Abstract > & renderableInstance, size_t subGeometryIndex, uint32_t levelOfDetail) noexcept
+	{
+		m_entries.emplace_back(Entry{sortKey, static_cast< uint32_t >(m_batches.size())});
+		m_batches.emplace_back(renderableInstance, subGeometryIndex, levelOfDetail);
+	}
+
+	void
+	RenderQueue::sort () noexcept
+	{
+		const auto count = m_entries.size();
+
+		m_keys.clear();
+
+		if ( count == 0 )
+		{
+			return;
+		}
+
+		if ( count > 1 )
+		{
+			m_scratchEntries.resize(count);
+
+			std::array< size_t, RadixBuckets > histogram{};
+
+			/* NOTE: LSD radix sort, stable, so equal keys keep the insertion order. */
+			for ( uint32_t radixPass = 0; radixPass < RadixPasses; radixPass++ )
+			{
+				const auto shift = radixPass * RadixBits;
+
+				histogram.fill(0);
+
+				for ( const auto & entry : m_entries )
+				{
+					histogram[(entry.key >> shift) & (RadixBuckets - 1)]++;
+				}
+
+				/* NOTE: Skip the pass when every key shares this byte. */
+				if ( histogram[(m_entries.front().key >> shift) & (RadixBuckets - 1)] == count )
+				{
+					continue;
+				}
+
+				size_t offset = 0;
+
+				for ( auto & bucket : histogram )
+				{
+					const auto bucketSize = bucket;
+
+					bucket = offset;
+					offset += bucketSize;
+				}
+
+				for ( const auto & entry : m_entries )
+				{
+					m_scratchEntries[histogram[(entry.key >> shift) & (RadixBuckets - 1)]++] = entry;
+				}
+
+				std::swap(m_entries, m_scratchEntries);
+			}
+		}
+
+		/* Reorder the batches following the sorted entries. */
+		m_sortedBatches.reserve(count);
+		m_keys.reserve(count);
+
+		for ( const auto & entry : m_entries )
+		{
+			m_sortedBatches.emplace_back(std::move(m_batches[entry.index]));
+			m_keys.emplace_back(entry.key);
+		}
+
+		std::swap(m_batches, m_sortedBatches);
+
+		m_sortedBatches.clear();
+
+		/* NOTE: Entries now follow the batch order. */
+		for ( uint32_t index = 0; index < count; index++ )
+		{
+			m_entries[index].index = index;
+		}
+	}
+
+	void
+	RenderQueue::clear () noexcept
+	{
+		m_batches.clear();
+		m_sortedBatches.clear();
+		m_keys.clear();
+		m_entries.clear();
+	}
+}
@@ -0,0 +1,211 @@
+/*
+ * src/Scenes/RenderQueue.hpp
+ * This file is part of Emeraude-Engine
+ *
+ * Copyright (C) 2010-2025 - Sébastien Léon Claude Christian Bémelmans "LondNoir" <londnoir@gmail.com>
+ *
+ * Emeraude-Engine is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * Emeraude-Engine is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with Emeraude-Engine; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * Complete project and additional information can be found at :
+ * https://github.com/londnoir/emeraude-engine
+ *
+ * --- THIS IS AUTOMATICALLY GENERATED, DO NOT CHANGE ---
+ */
+
+#pragma once
+
+/* STL inclusions. */
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+#include <memory>
+
+/* Local inclusions for usages. */
+#include "Graphics/Types.hpp"
+#include "RenderBatch.hpp"
+
+namespace EmEn::Scenes
+{
+	/**
+	 * @brief The render queue is a flat list of render batches ordered by a packed 64-bit sort key.
+	 * @note The storage is kept between frames, so clearing and filling the queue does not allocate once the capacity is reached.
+	 *
+	 * Opaque key layout (front-to-back, state changes minimized) :
+	 *  [63..60] pass | [59..44] pipeline | [43..28] material | [27..16] geometry | [15..0] depth
+	 *
+	 * Translucent key layout (back-to-front) :
+	 *  [63..60] pass | [59..32] inverted depth | [31..20] pipeline | [19..8] material | [7..0] geometry
+	 */
+	class RenderQueue final
+	{
+		public:
+
+			/**
+			 * @brief Constructs a render queue.
+			 */
+			RenderQueue () noexcept = default;
+
+			/**
+			 * @brief Returns a sort key for an opaque render batch.
+			 * @param renderPassType The render pass type.
+			 * @param pipeline A pointer to the graphics pipeline. Can be null.
+			 * @param material A pointer to the material. Can be null.
+			 * @param geometry A pointer to the geometry. Can be null.
+			 * @param distance The distance from the point of view.
+			 * @return uint64_t
+			 */
+			[[nodiscard]]
+			static uint64_t opaqueKey (Graphics::RenderPassType renderPassType, const void * pipeline, const void * material, const void * geometry, float distance) noexcept;
+
+			/**
+			 * @brief Returns a sort key for a translucent render batch.
+			 * @param renderPassType The render pass type.
+			 * @param pipeline A pointer to the graphics pipeline. Can be null.
+			 * @param material A pointer to the material. Can be null.
+			 * @param geometry A pointer to the geometry. Can be null.
+			 * @param distance The distance from the point of view.
+			 * @return uint64_t
+			 */
+			[[nodiscard]]
+			static uint64_t translucentKey (Graphics::RenderPassType renderPassType, const void * pipeline, const void * material, const void * geometry, float distance) noexcept;
+
+			/**
+			 * @brief Adds a render batch to the queue.
+			 * @note The queue order is undefined until sort() is called.
+			 * @param sortKey The sort key from opaqueKey() or translucentKey().
+			 * @param renderableInstance A reference to a renderable instance smart pointer.
+			 * @param subGeometryIndex The layer index of the renderable.
+			 * @param levelOfDetail The level of detail of the renderable geometry. Default 0.
+			 * @return void
+			 */
+			void push (uint64_t sortKey, const std::shared_ptr< const Graphics::RenderableInstance::Abstract > & renderableInstance, size_t subGeometryIndex, uint32_t levelOfDetail = 0) noexcept;
+
+			/**
+			 * @brief Sorts the render batches by their key using a radix sort.
+			 * @return void
+			 */
+			void sort () noexcept;
+
+			/**
+			 * @brief Removes all render batches while keeping the memory for the next frame.
+			 * @return void
+			 */
+			void clear () noexcept;
+
+			/**
+			 * @brief Returns whether the queue is empty.
+			 * @return bool
+			 */
+			[[nodiscard]]
+			bool
+			empty () const noexcept
+			{
+				return m_batches.empty();
+			}
+
+			/**
+			 * @brief Returns the number of render batches in the queue.
+			 * @return size_t
+			 */
+			[[nodiscard]]
+			size_t
+			size () const noexcept
+			{
+				return m_batches.size();
+			}
+
+			/**
+			 * @brief Returns the render batches.
+			 * @return const std::vector< RenderBatch > &
+			 */
+			[[nodiscard]]
+			const std::vector< RenderBatch > &
+			batches () const noexcept
+			{
+				return m_batches;
+			}
+
+			/**
+			 * @brief Returns the sort keys in the same order as the render batches.
+			 * @return const std::vector< uint64_t > &
+			 */
+			[[nodiscard]]
+			const std::vector< uint64_t > &
+			keys () const noexcept
+			{
+				return m_keys;
+			}
+
+			/**
+			 * @brief Returns an iterator to the first render batch.
+			 * @return std::vector< RenderBatch >::const_iterator
+			 */
+			[[nodiscard]]
+			std::vector< RenderBatch >::const_iterator
+			begin () const noexcept
+			{
+				return m_batches.cbegin();
+			}
+
+			/**
+			 * @brief Returns an iterator past the last render batch.
+			 * @return std::vector< RenderBatch >::const_iterator
+			 */
+			[[nodiscard]]
+			std::vector< RenderBatch >::const_iterator
+			end () const noexcept
+			{
+				return m_batches.cend();
+			}
+
+		private:
+
+			/**
+			 * @brief Sort entry, the key and the position of the batch before sorting.
+			 */
+			struct Entry
+			{
+				uint64_t key;
+				uint32_t index;
+			};
+
+			/**
+			 * @brief Hashes a pointer and keeps the requested number of bits.
+			 * @param pointer The pointer.
+			 * @param bits The number of bits to keep.
+			 * @return uint64_t
+			 */
+			[[nodiscard]]
+			static uint64_t hashPointer (const void * pointer, uint32_t bits) noexcept;
+
+			/**
+			 * @brief Returns the bit pattern of a positive distance, which is ordered like the float.
+			 * @param distance The distance.
+			 * @return uint32_t
+			 */
+			[[nodiscard]]
+			static uint32_t depthBits (float distance) noexcept;
+
+			static constexpr auto RadixBits{8U};
+			static constexpr auto RadixBuckets{1UL << RadixBits};
+			static constexpr auto RadixPasses{64U / RadixBits};
+
+			std::vector< RenderBatch > m_batches;
+			std::vector< RenderBatch > m_sortedBatches;
+			std::vector< uint64_t > m_keys;
+			std::vector< Entry > m_entries;
+			std::vector< Entry > m_scratchEntries;
+	};
+}
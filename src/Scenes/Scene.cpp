@@ -32,11 +32,15 @@
 /* STL inclusions. */
 #include <cstdlib>
 #include <algorithm>
+#include <bit>
+#include <functional>
 #include <ranges>
 
 /* Local inclusions. */
 #include "Input/Manager.hpp"
+#include "FrameProfiler.hpp"
 #include "Graphics/Renderer.hpp"
+#include "PrimaryServices.hpp"
 #include "Vulkan/SwapChain.hpp" // FIXME: Should not be there
 #include "NodeCrawler.hpp"
 #include "Tracer.hpp"
@@ -232,6 +236,13 @@ namespace EmEn::Scenes
 
 		/* FIXME: When re-enabling, the swap-chain do not have the correct ambient light parameters ! */
 
+		/* NOTE: Make sure node world coordinates are ready before the first logic cycle. */
+		{
+			const std::lock_guard< std::mutex > lock{m_sceneNodesMutex};
+
+			m_rootNode->updateWorldCacheTree();
+		}
+
 		Input::Manager::instance()->addKeyboardListener(&m_nodeController);
 
 		return true;
@@ -339,7 +350,7 @@ namespace EmEn::Scenes
 
 		if ( m_renderingOctree == nullptr )
 		{
-			m_renderingOctree = std::make_shared< OctreeSector< AbstractEntity, false > >(
+			m_renderingOctree = std::make_shared< RenderingOctree >(
 				Vector< 3, float >{m_boundary, m_boundary, m_boundary},
 				Vector< 3, float >{-m_boundary, -m_boundary, -m_boundary},
 				octreeOptions.renderingOctreeAutoExpandAt,
@@ -358,7 +369,7 @@ namespace EmEn::Scenes
 
 		if ( m_physicsOctree == nullptr )
 		{
-			m_physicsOctree = std::make_shared< OctreeSector< AbstractEntity, true > >(
+			m_physicsOctree = std::make_shared< PhysicsOctree >(
 				Vector< 3, float >{m_boundary, m_boundary, m_boundary},
 				Vector< 3, float >{-m_boundary, -m_boundary, -m_boundary},
 				octreeOptions.physicsOctreeAutoExpandAt,
@@ -409,7 +420,7 @@ namespace EmEn::Scenes
 		}
 
 		/* Allocate a new octree. */
-		const auto newOctree = std::make_shared< OctreeSector< AbstractEntity, false > >(
+		const auto newOctree = std::make_shared< RenderingOctree >(
 			Vector< 3, float >{m_boundary, m_boundary, m_boundary},
 			Vector< 3, float >{-m_boundary, -m_boundary, -m_boundary},
 				m_renderingOctree->maxElementPerSector(),
@@ -444,7 +455,7 @@ namespace EmEn::Scenes
 		}
 
 		/* Allocate a new octree. */
-		const auto newOctree = std::make_shared< OctreeSector< AbstractEntity, true > >(
+		const auto newOctree = std::make_shared< PhysicsOctree >(
 			Vector< 3, float >{m_boundary, m_boundary, m_boundary},
 			Vector< 3, float >{-m_boundary, -m_boundary, -m_boundary},
 			m_physicsOctree->maxElementPerSector(),
@@ -511,6 +522,8 @@ namespace EmEn::Scenes
 	void
 	Scene::processLogics (size_t engineCycle) noexcept
 	{
+		const ProfileScope profileScope{"Scene::processLogics"};
+
 		m_lifetimeUS += EngineUpdateCycleDurationUS< uint64_t >;
 		m_lifetimeMS += EngineUpdateCycleDurationMS< uint32_t >;
 
@@ -552,7 +565,7 @@ namespace EmEn::Scenes
 		/* Launch the collision test step. */
 		if ( m_physicsOctree != nullptr )
 		{
-			this->sectorCollisionTest(*m_physicsOctree);
+			this->sectorCollisionTest();
 
 			/* Final collisions check against scene boundaries and ground,
 			 * then resolve all collisions detected on movable entities. */
@@ -599,9 +612,20 @@ namespace EmEn::Scenes
 			}
 		}
 
+		this->updateWorldCoordinates();
+
 		m_cycle++;
 	}
 
+	void
+	Scene::updateWorldCoordinates () const noexcept
+	{
+		/* Refresh every moved node world coordinates once, from the root to the leaves. */
+		const std::lock_guard< std::mutex > lock{m_sceneNodesMutex};
+
+		m_rootNode->updateWorldCacheTree();
+	}
+
 	void
 	Scene::applyModifiers (Node & node) const noexcept
 	{
@@ -621,97 +645,188 @@ namespace EmEn::Scenes
 	}
 
 	void
-	Scene::sectorCollisionTest (const OctreeSector< AbstractEntity, true > & sector) noexcept
+	Scene::sectorCollisionTest () noexcept
 	{
-		/* No element present. */
-		if ( sector.empty() )
+		const ProfileScope profileScope{"Scene::sectorCollisionTest"};
+
+		/* NOTE: Flatten the leaf sectors content to let workers read contiguous arrays. */
+		m_collisionLeafEntities.clear();
+		m_collisionLeafRanges.clear();
+
+		m_physicsOctree->forEachLeafSector([this] (const auto & sector) {
+			/* NOTE: A lonely element has nothing to collide with in this sector. */
+			if ( sector.elementCount() < 2 )
+			{
+				return;
+			}
+
+			const auto offset = m_collisionLeafEntities.size();
+
+			for ( const auto & element : sector.elements() )
+			{
+				m_collisionLeafEntities.emplace_back(&*element);
+			}
+
+			m_collisionLeafRanges.emplace_back(offset, m_collisionLeafEntities.size());
+		});
+
+		if ( m_collisionLeafRanges.empty() )
 		{
 			return;
 		}
 
-		/* If the sector is not a leaf, we test subsectors. */
-		if ( !sector.isLeaf() )
-		{
-			//#pragma omp parallel for
-			for ( const auto & subSector : sector.subSectors() )
+		auto & jobSystem = m_graphicsRenderer.primaryServices().jobSystem();
+
+		/* NOTE: The calling thread takes part in the work. */
+		const auto collisionWorkerCount = jobSystem.workerCount() + 1;
+
+		/* Broad phase: each worker collects the candidate pairs of a range of leaves. */
+		const auto leafCount = m_collisionLeafRanges.size();
+		const auto pairWorkerCount = std::min(collisionWorkerCount, leafCount);
+
+		m_collisionPairBuffers.resize(pairWorkerCount);
+
+		jobSystem.parallelFor(0, pairWorkerCount, [this, leafCount, pairWorkerCount] (size_t firstWorker, size_t lastWorker) {
+			for ( auto worker = firstWorker; worker < lastWorker; worker++ )
 			{
-				this->sectorCollisionTest(*subSector);
+				auto & pairs = m_collisionPairBuffers[worker];
+				pairs.clear();
+
+				this->collectCollisionPairs(leafCount * worker / pairWorkerCount, leafCount * (worker + 1) / pairWorkerCount, pairs);
 			}
+		}, 1);
 
-			return;
+		/* NOTE: Merge buffers and remove pairs found in several sectors.
+		 * Sorting by entity serials makes the pair order, and so the order contacts are applied,
+		 * independent of the workload distribution and of where entities were allocated. */
+		m_collisionPairs.clear();
+
+		for ( const auto & pairs : m_collisionPairBuffers )
+		{
+			m_collisionPairs.insert(m_collisionPairs.end(), pairs.begin(), pairs.end());
 		}
 
-		/* We are in a leaf, we check scene nodes present here. */
-		const auto & elements = sector.elements();
+		std::ranges::sort(m_collisionPairs, [] (const CollisionPair & pairA, const CollisionPair & pairB) {
+			if ( pairA.first->serial() != pairB.first->serial() )
+			{
+				return pairA.first->serial() < pairB.first->serial();
+			}
 
-		for ( auto elementIt = elements.begin(); elementIt != elements.end(); ++elementIt )
-		{
-			/* NOTE: The entity A can be a node or a static entity. */
-			const auto & entityA = *elementIt;
-			const bool entityAHasMovableAbility = entityA->hasMovableAbility();
+			return pairA.second->serial() < pairB.second->serial();
+		});
+
+		const auto duplicates = std::ranges::unique(m_collisionPairs, [] (const CollisionPair & pairA, const CollisionPair & pairB) {
+			return pairA.first == pairB.first && pairA.second == pairB.second;
+		});
+
+		m_collisionPairs.erase(duplicates.begin(), duplicates.end());
+
+		/* Narrow phase: entities are only read here, contacts are stored in per-worker buffers. */
+		const auto pairCount = m_collisionPairs.size();
+		const auto contactWorkerCount = std::clamp< size_t >(pairCount / CollisionPairsPerWorker, 1, collisionWorkerCount);
 
-			/* Copy the iterator to iterate through next elements with it without modify the initial one. */
-			auto elementItCopy = elementIt;
+		m_contactBuffers.resize(contactWorkerCount);
 
-			for ( ++elementItCopy; elementItCopy != elements.end(); ++elementItCopy )
+		jobSystem.parallelFor(0, contactWorkerCount, [this, pairCount, contactWorkerCount] (size_t firstWorker, size_t lastWorker) {
+			for ( auto worker = firstWorker; worker < lastWorker; worker++ )
 			{
-				/* NOTE: The entity B can also be a node or a static entity. */
-				const auto & entityB = *elementItCopy;
-				const bool entityBHasMovableAbility = entityB->hasMovableAbility();
+				auto & contacts = m_contactBuffers[worker];
+				contacts.clear();
 
-				/* Both entities are static or both entities are paused. */
-				if ( (!entityAHasMovableAbility && !entityBHasMovableAbility) || (entityA->isSimulationPaused() && entityB->isSimulationPaused()) )
+				const auto lastPair = pairCount * (worker + 1) / contactWorkerCount;
+
+				for ( auto pairIndex = pairCount * worker / contactWorkerCount; pairIndex < lastPair; pairIndex++ )
 				{
-					continue;
+					Collider::Contact contact;
+
+					if ( findCollisionContact(m_collisionPairs[pairIndex], contact) )
+					{
+						contacts.emplace_back(contact);
+					}
 				}
+			}
+		}, 1);
 
-				if ( entityAHasMovableAbility )
+		/* NOTE: Buffers cover consecutive pair ranges, so contacts are applied in the pair order whatever the worker count. */
+		for ( const auto & contacts : m_contactBuffers )
+		{
+			for ( const auto & contact : contacts )
+			{
+				contact.movableEntity->getMovableTrait()->collider().applyContact(contact);
+			}
+		}
+	}
+
+	void
+	Scene::collectCollisionPairs (size_t firstLeaf, size_t lastLeaf, std::vector< CollisionPair > & pairs) const noexcept
+	{
+		for ( auto leafIndex = firstLeaf; leafIndex < lastLeaf; leafIndex++ )
+		{
+			const auto [firstElement, lastElement] = m_collisionLeafRanges[leafIndex];
+
+			for ( auto indexA = firstElement; indexA < lastElement; indexA++ )
+			{
+				/* NOTE: The entity A can be a node or a static entity. */
+				auto * entityA = m_collisionLeafEntities[indexA];
+				const bool entityAHasMovableAbility = entityA->hasMovableAbility();
+
+				for ( auto indexB = indexA + 1; indexB < lastElement; indexB++ )
 				{
-					auto & colliderA = entityA->getMovableTrait()->collider();
+					/* NOTE: The entity B can also be a node or a static entity. */
+					auto * entityB = m_collisionLeafEntities[indexB];
+					const bool entityBHasMovableAbility = entityB->hasMovableAbility();
 
-					/* Check for cross-sector collisions duplicates. */
-					if ( colliderA.hasCollisionWith(*entityB) )
+					/* Both entities are static or both entities are paused. */
+					if ( (!entityAHasMovableAbility && !entityBHasMovableAbility) || (entityA->isSimulationPaused() && entityB->isSimulationPaused()) )
 					{
 						continue;
 					}
 
-					/* NOTE: Here the entity A is movable.
-					 * We will check the collision from entity A. */
-					if ( entityBHasMovableAbility )
+					if ( entityA->serial() < entityB->serial() )
 					{
-						colliderA.checkCollisionAgainstMovable(*entityA, *entityB);
+						pairs.emplace_back(CollisionPair{entityA, entityB});
 					}
 					else
 					{
-						if ( entityA->isSimulationPaused() )
-						{
-							continue;
-						}
-
-						colliderA.checkCollisionAgainstStatic(*entityA, *entityB);
+						pairs.emplace_back(CollisionPair{entityB, entityA});
 					}
 				}
-				else
-				{
-					if ( entityB->isSimulationPaused() )
-					{
-						continue;
-					}
+			}
+		}
+	}
 
-					auto & colliderB = entityB->getMovableTrait()->collider();
+	bool
+	Scene::findCollisionContact (const CollisionPair & pair, Collider::Contact & contact) noexcept
+	{
+		auto & entityA = *pair.first;
+		auto & entityB = *pair.second;
 
-					/* Check for cross-sector collisions duplicates. */
-					if ( colliderB.hasCollisionWith(*entityA) )
-					{
-						continue;
-					}
+		if ( entityA.hasMovableAbility() )
+		{
+			/* NOTE: Here the entity A is movable.
+			 * We will check the collision from entity A. When B is movable too,
+			 * only A receives the contact, so the entity with the lowest serial is the one pushed back. */
+			if ( entityB.hasMovableAbility() )
+			{
+				return Collider::findContactAgainstMovable(entityA, entityB, contact);
+			}
 
-					/* NOTE: Here the entity A is static, and B cannot be static.
-					 * We will check the collision from entity B. */
-					colliderB.checkCollisionAgainstStatic(*entityB, *entityA);
-				}
+			if ( entityA.isSimulationPaused() )
+			{
+				return false;
 			}
+
+			return Collider::findContactAgainstStatic(entityA, entityB, contact);
 		}
+
+		if ( entityB.isSimulationPaused() )
+		{
+			return false;
+		}
+
+		/* NOTE: Here the entity A is static, and B cannot be static.
+		 * We will check the collision from entity B. */
+		return Collider::findContactAgainstStatic(entityB, entityA, contact);
 	}
 
 	void
@@ -888,6 +1003,55 @@ namespace EmEn::Scenes
 		}
 	}
 
+	bool
+	Scene::isVisibleFrom (const RenderTarget::Abstract & renderTarget, const AbstractEntity & entity) noexcept
+	{
+		if ( !Frustum::isTestEnabled() )
+		{
+			return true;
+		}
+
+		const auto & viewMatrices = renderTarget.viewMatrices();
+		const auto frustumCount = renderTarget.isCubemap() ? CubemapFaceIndexes.size() : 1UL;
+
+		if ( entity.sphereCollisionIsEnabled() )
+		{
+			if ( !entity.localBoundingSphere().isValid() )
+			{
+				return true;
+			}
+
+			const auto worldBoundingSphere = entity.getWorldBoundingSphere();
+
+			for ( size_t frustumIndex = 0; frustumIndex < frustumCount; frustumIndex++ )
+			{
+				if ( viewMatrices.frustum(frustumIndex).isCollidingWith(worldBoundingSphere) != Frustum::Result::Outside )
+				{
+					return true;
+				}
+			}
+
+			return false;
+		}
+
+		if ( !entity.localBoundingBox().isValid() )
+		{
+			return true;
+		}
+
+		const auto worldBoundingBox = entity.getWorldBoundingBox();
+
+		for ( size_t frustumIndex = 0; frustumIndex < frustumCount; frustumIndex++ )
+		{
+			if ( viewMatrices.frustum(frustumIndex).isCollidingWith(worldBoundingBox) != Frustum::Result::Outside )
+			{
+				return true;
+			}
+		}
+
+		return false;
+	}
+
 	void
 	Scene::insertInShadowCastLists (const std::shared_ptr< RenderTarget::Abstract > & renderTarget, const std::shared_ptr< RenderableInstance::Abstract > & renderableInstance, float distance) noexcept
 	{
@@ -921,10 +1085,20 @@ namespace EmEn::Scenes
 		}
 
 		const auto layerCount = renderable->layerCount();
+		const auto levelOfDetail = renderable->selectLevelOfDetail(distance);
+		const auto * geometry = renderable->levelOfDetailGeometry(levelOfDetail);
 
-		for ( size_t layerIndex = 0; layerIndex < layerCount; layerIndex++ )
+		for ( uint32_t layerIndex = 0; layerIndex < layerCount; layerIndex++ )
 		{
-			RenderBatch::create(m_renderLists[Shadows], distance, renderableInstance, layerIndex);
+			const auto sortKey = RenderQueue::opaqueKey(
+				RenderPassType::SimplePass,
+				renderableInstance->getShadowCastingGraphicsPipeline(renderTarget, layerIndex),
+				nullptr,
+				geometry,
+				distance
+			);
+
+			m_renderLists[Shadows].push(sortKey, renderableInstance, layerIndex, levelOfDetail);
 		}
 	}
 
@@ -961,32 +1135,28 @@ namespace EmEn::Scenes
 		}
 
 		const auto layerCount = renderable->layerCount();
+		const auto levelOfDetail = renderable->selectLevelOfDetail(distance);
+		const auto * geometry = renderable->levelOfDetailGeometry(levelOfDetail);
+		const auto isLighted = m_lightSet.isEnabled() && renderableInstance->isLightingEnabled();
+		/* NOTE: Lighted objects are keyed on the ambient pass, which is the first one drawn for them. */
+		const auto renderPassType = isLighted ? RenderPassType::AmbientPass : RenderPassType::SimplePass;
 
 		for ( uint32_t layerIndex = 0; layerIndex < layerCount; layerIndex++ )
 		{
-			const auto isOpaque = renderable->isOpaque(layerIndex);
+			const auto * pipeline = renderableInstance->getGraphicsPipeline(renderTarget, renderPassType, layerIndex);
+			const auto * material = renderable->material(layerIndex);
 
-			if ( m_lightSet.isEnabled() && renderableInstance->isLightingEnabled() )
+			if ( renderable->isOpaque(layerIndex) )
 			{
-				if ( isOpaque )
-				{
-					RenderBatch::create(m_renderLists[OpaqueLighted], distance, renderableInstance, layerIndex);
-				}
-				else
-				{
-					RenderBatch::create(m_renderLists[TranslucentLighted], distance * -1.0F, renderableInstance, layerIndex);
-				}
+				const auto sortKey = RenderQueue::opaqueKey(renderPassType, pipeline, material, geometry, distance);
+
+				m_renderLists[isLighted ? OpaqueLighted : Opaque].push(sortKey, renderableInstance, layerIndex, levelOfDetail);
 			}
 			else
 			{
-				if ( isOpaque )
-				{
-					RenderBatch::create(m_renderLists[Opaque], distance, renderableInstance, layerIndex);
-				}
-				else
-				{
-					RenderBatch::create(m_renderLists[Translucent], distance * -1.0F, renderableInstance, layerIndex);
-				}
+				const auto sortKey = RenderQueue::translucentKey(renderPassType, pipeline, material, geometry, distance);
+
+				m_renderLists[isLighted ? TranslucentLighted : Translucent].push(sortKey, renderableInstance, layerIndex, levelOfDetail);
 			}
 		}
 	}
@@ -994,7 +1164,7 @@ namespace EmEn::Scenes
 	bool
 	Scene::populateRenderLists (const std::shared_ptr< RenderTarget::Abstract > & renderTarget, bool isShadowCasting) noexcept
 	{
-		/* FIXME: TODO integrate the max viewable distance and the frustum culling. */
+		const ProfileScope profileScope{"Scene::populateRenderLists"};
 
 		/* NOTE: Clean render lists before. */
 		if ( isShadowCasting )
@@ -1011,9 +1181,11 @@ namespace EmEn::Scenes
 
 		/* NOTE: The camera position doesn't move during calculation. */
 		const auto & cameraPosition = renderTarget->viewMatrices().position();
-		Vector< 3, float > entityPosition{};
 
-		/* Sorting global renderable objects from the scene. */
+		size_t visibleCount = 0;
+		size_t culledCount = 0;
+
+		/* NOTE: Scene global renderable objects (background, area, sea level) are never culled. */
 		for ( const auto & visualComponent : m_sceneVisualComponents )
 		{
 			if ( visualComponent == nullptr )
@@ -1038,6 +1210,42 @@ namespace EmEn::Scenes
 			}
 		}
 
+		/* NOTE: Culls then inserts every renderable instance of an entity.
+		 * The entity visibility is computed only once. Instanced renderables (particles, multiple visuals)
+		 * are spread outside the entity bounding primitives, so they skip the culling test. */
+		const auto processEntity = [&] (const AbstractEntity & entity) {
+			const auto isVisible = Scene::isVisibleFrom(*renderTarget, entity);
+			const auto distance = Vector< 3, float >::distance(cameraPosition, entity.getWorldCoordinates().position());
+
+			for ( const auto & component: entity.components() | std::views::values )
+			{
+				const auto renderableInstance = component->getRenderableInstance();
+
+				if ( renderableInstance == nullptr )
+				{
+					continue;
+				}
+
+				if ( !isVisible && !renderableInstance->isInstanced() )
+				{
+					culledCount++;
+
+					continue;
+				}
+
+				visibleCount++;
+
+				if ( isShadowCasting )
+				{
+					this->insertInShadowCastLists(renderTarget, renderableInstance, distance);
+				}
+				else
+				{
+					this->insertInRenderLists(renderTarget, renderableInstance, distance);
+				}
+			}
+		};
+
 		/* Sorting renderable objects from scene static entities. */
 		{
 			const std::lock_guard< std::mutex > lock{m_staticEntitiesMutex};
@@ -1050,27 +1258,7 @@ namespace EmEn::Scenes
 					continue;
 				}
 
-				/* Prepares the entity position (costly) for the lambda. */
-				entityPosition = staticEntity->getWorldCoordinates().position();
-
-				for ( const auto & component: staticEntity->components() | std::views::values )
-				{
-					const auto renderableInstance = component->getRenderableInstance();
-
-					if ( renderableInstance == nullptr )
-					{
-						continue;
-					}
-
-					if ( isShadowCasting )
-					{
-						this->insertInShadowCastLists(renderTarget, renderableInstance, Vector< 3, float >::distance(cameraPosition, entityPosition));
-					}
-					else
-					{
-						this->insertInRenderLists(renderTarget, renderableInstance, Vector< 3, float >::distance(cameraPosition, entityPosition));
-					}
-				}
+				processEntity(*staticEntity);
 			}
 		}
 
@@ -1091,30 +1279,39 @@ namespace EmEn::Scenes
 					continue;
 				}
 
-				/* Prepares the entity position (costly) for the lambda. */
-				entityPosition = node->getWorldCoordinates().position();
-
-				for ( const auto & component: node->components() | std::views::values )
-				{
-					const auto renderableInstance = component->getRenderableInstance();
+				processEntity(*node);
+			}
+		}
 
-					if ( renderableInstance == nullptr )
-					{
-						continue;
-					}
+		/* Report the culling results. */
+		{
+			auto & statistics = m_graphicsRenderer.rendererStatistics();
 
-					if ( isShadowCasting )
-					{
-						this->insertInShadowCastLists(renderTarget, renderableInstance, Vector< 3, float >::distance(cameraPosition, entityPosition));
-					}
-					else
-					{
-						this->insertInRenderLists(renderTarget, renderableInstance, Vector< 3, float >::distance(cameraPosition, entityPosition));
-					}
-				}
+			if ( isShadowCasting )
+			{
+				statistics.incrementCounter(RendererStatistics::Counter::VisibleShadowCasters, visibleCount);
+				statistics.incrementCounter(RendererStatistics::Counter::CulledShadowCasters, culledCount);
+			}
+			else
+			{
+				statistics.incrementCounter(RendererStatistics::Counter::VisibleObjects, visibleCount);
+				statistics.incrementCounter(RendererStatistics::Counter::CulledObjects, culledCount);
 			}
 		}
 
+		/* Order the render queues by their sort keys. */
+		if ( isShadowCasting )
+		{
+			m_renderLists[Shadows].sort();
+		}
+		else
+		{
+			m_renderLists[Opaque].sort();
+			m_renderLists[Translucent].sort();
+			m_renderLists[OpaqueLighted].sort();
+			m_renderLists[TranslucentLighted].sort();
+		}
+
 		/* Return true if something can be rendered. */
 		return std::ranges::any_of(m_renderLists, [] (const auto & renderList) {
 			return !renderList.empty();
@@ -1124,6 +1321,8 @@ namespace EmEn::Scenes
 	void
 	Scene::updateVideoMemory () const noexcept
 	{
+		const ProfileScope profileScope{"Scene::updateVideoMemory"};
+
 		if ( !m_lightSet.updateVideoMemory() )
 		{
 			Tracer::error(ClassId, "Unable to update the light set data to the video memory !");
@@ -1131,14 +1330,186 @@ namespace EmEn::Scenes
 	}
 
 	void
-	Scene::renderSelection (const std::shared_ptr< RenderTarget::Abstract > & renderTarget, const Vulkan::CommandBuffer & commandBuffer, const RenderBatch::List & unlightedObjects, const RenderBatch::List & lightedObjects) const noexcept
+	Scene::countDrawCall (uint32_t instanceCount) const noexcept
 	{
-		if ( !unlightedObjects.empty() )
+		auto & statistics = m_graphicsRenderer.rendererStatistics();
+
+		statistics.incrementCounter(RendererStatistics::Counter::DrawCalls);
+		statistics.incrementCounter(RendererStatistics::Counter::Instances, instanceCount);
+	}
+
+	bool
+	Scene::canShareInstancedDraw (const RenderBatch & batchA, const RenderBatch & batchB) noexcept
+	{
+		if ( batchA.subGeometryIndex() != batchB.subGeometryIndex() || batchA.levelOfDetail() != batchB.levelOfDetail() )
+		{
+			return false;
+		}
+
+		const auto & instanceA = batchA.renderableInstance();
+		const auto & instanceB = batchB.renderableInstance();
+
+		if ( instanceA->renderable() != instanceB->renderable() || instanceA->flags() != instanceB->flags() )
 		{
-			for ( const auto & renderBatch : unlightedObjects | std::views::values )
+			return false;
+		}
+
+		return instanceB->isAutoInstancingCompatible();
+	}
+
+	bool
+	Scene::renderAutoInstanced (const std::shared_ptr< RenderTarget::Abstract > & renderTarget, const Vulkan::CommandBuffer & commandBuffer, const std::vector< RenderBatch > & batches, size_t first, size_t last, bool isShadowCasting) noexcept
+	{
+		const auto & leader = batches[first].renderableInstance();
+		const auto layerIndex = static_cast< uint32_t >(batches[first].subGeometryIndex());
+		const auto levelOfDetail = batches[first].levelOfDetail();
+		const auto instanceCount = static_cast< uint32_t >(last - first);
+
+		auto & group = m_autoInstancingGroups[{renderTarget.get(), leader->renderable(), layerIndex, leader->flags(), isShadowCasting}];
+
+		/* NOTE: Select the buffer slot for this render pass. A slot is reused only after
+		 * every swap-chain image went through, so the GPU is done reading from it. */
+		{
+			const auto swapChain = m_graphicsRenderer.swapChain();
+			const size_t slotCount = swapChain != nullptr ? std::max< size_t >(1, swapChain->imageCount()) : 1;
+
+			if ( group.instances.size() != slotCount )
 			{
-				renderBatch.renderableInstance()->render(renderTarget, nullptr, RenderPassType::SimplePass, renderBatch.subGeometryIndex(), commandBuffer);
+				group.instances.resize(slotCount);
 			}
+
+			if ( group.renderPass != m_renderPassCount )
+			{
+				group.renderPass = m_renderPassCount;
+				group.slot = (group.slot + 1) % slotCount;
+				group.used = 0;
+			}
+		}
+
+		auto & slotInstances = group.instances[group.slot];
+
+		if ( group.used >= slotInstances.size() )
+		{
+			slotInstances.emplace_back();
+		}
+
+		auto & multiple = slotInstances[group.used++];
+
+		if ( multiple == nullptr || multiple->maxInstanceCount() < instanceCount )
+		{
+			/* NOTE: The capacity grows by power of two to absorb the visible count variation between frames. */
+			multiple = std::make_shared< RenderableInstance::Multiple >(leader->renderablePointer(), std::bit_ceil(instanceCount), leader->flags() & AutoInstancingInheritedFlags);
+		}
+
+		if ( multiple->isBroken() )
+		{
+			return false;
+		}
+
+		if ( isShadowCasting )
+		{
+			if ( !this->getRenderableInstanceReadyForShadowCasting(multiple, renderTarget) )
+			{
+				return false;
+			}
+		}
+		else
+		{
+			if ( !this->getRenderableInstanceReadyForRender(multiple, renderTarget) )
+			{
+				return false;
+			}
+		}
+
+		/* Pack the world frames of every merged renderable instance. */
+		m_autoInstancingLocations.clear();
+
+		for ( auto index = first; index < last; index++ )
+		{
+			m_autoInstancingLocations.emplace_back(batches[index].renderableInstance()->worldCoordinates());
+		}
+
+		if ( !multiple->updateLocalData(m_autoInstancingLocations, 0) )
+		{
+			return false;
+		}
+
+		multiple->setActiveInstanceCount(instanceCount);
+
+		if ( !multiple->updateVideoMemory() )
+		{
+			return false;
+		}
+
+		if ( isShadowCasting )
+		{
+			multiple->castShadows(renderTarget, layerIndex, levelOfDetail, commandBuffer);
+		}
+		else
+		{
+			multiple->render(renderTarget, nullptr, RenderPassType::SimplePass, layerIndex, levelOfDetail, commandBuffer);
+		}
+
+		this->countDrawCall(instanceCount);
+
+		return true;
+	}
+
+	void
+	Scene::renderBatches (const std::shared_ptr< RenderTarget::Abstract > & renderTarget, const Vulkan::CommandBuffer & commandBuffer, const RenderQueue & renderQueue, bool isShadowCasting, bool enableAutoInstancing) noexcept
+	{
+		const auto & batches = renderQueue.batches();
+
+		size_t index = 0;
+
+		while ( index < batches.size() )
+		{
+			/* NOTE: The queue is ordered by pipeline, material and geometry,
+			 * so the batches of a same renderable follow each other. */
+			auto runEnd = index + 1;
+
+			if ( enableAutoInstancing && batches[index].renderableInstance()->isAutoInstancingCompatible() )
+			{
+				while ( runEnd < batches.size() && Scene::canShareInstancedDraw(batches[index], batches[runEnd]) )
+				{
+					runEnd++;
+				}
+			}
+
+			if ( runEnd - index >= AutoInstancingMinimumBatches && this->renderAutoInstanced(renderTarget, commandBuffer, batches, index, runEnd, isShadowCasting) )
+			{
+				index = runEnd;
+
+				continue;
+			}
+
+			for ( ; index < runEnd; index++ )
+			{
+				const auto & renderBatch = batches[index];
+				const auto & instance = renderBatch.renderableInstance();
+
+				if ( isShadowCasting )
+				{
+					instance->castShadows(renderTarget, renderBatch.subGeometryIndex(), renderBatch.levelOfDetail(), commandBuffer);
+				}
+				else
+				{
+					instance->render(renderTarget, nullptr, RenderPassType::SimplePass, renderBatch.subGeometryIndex(), renderBatch.levelOfDetail(), commandBuffer);
+				}
+
+				this->countDrawCall(instance->drawnInstanceCount());
+			}
+		}
+	}
+
+	void
+	Scene::renderSelection (const std::shared_ptr< RenderTarget::Abstract > & renderTarget, const Vulkan::CommandBuffer & commandBuffer, const RenderQueue & unlightedObjects, const RenderQueue & lightedObjects, bool isTranslucent) noexcept
+	{
+		/* NOTE: Translucent queues are sorted back to front. A merged draw would blend its instances
+		 * at the depth of the first batch and break that order, so they are drawn one by one. */
+		if ( !unlightedObjects.empty() )
+		{
+			this->renderBatches(renderTarget, commandBuffer, unlightedObjects, false, !isTranslucent);
 		}
 
 		if ( !m_lightSet.isEnabled() || lightedObjects.empty() )
@@ -1148,21 +1519,23 @@ namespace EmEn::Scenes
 
 		if ( m_lightSet.isUsingStaticLighting() )
 		{
-			for ( const auto & renderBatch : lightedObjects | std::views::values )
-			{
-				renderBatch.renderableInstance()->render(renderTarget, nullptr, RenderPassType::SimplePass, renderBatch.subGeometryIndex(), commandBuffer);
-			}
+			this->renderBatches(renderTarget, commandBuffer, lightedObjects, false, !isTranslucent);
 
 			return;
 		}
 
 		/* For all objects. */
-		for ( const auto & renderBatch : lightedObjects | std::views::values )
+		for ( const auto & renderBatch : lightedObjects )
 		{
 			const std::lock_guard< std::mutex > lock{m_lightSet.mutex()};
 
+			const auto & instance = renderBatch.renderableInstance();
+			const auto instanceCount = instance->drawnInstanceCount();
+
 			/* Ambient pass. */
-			renderBatch.renderableInstance()->render(renderTarget, nullptr, RenderPassType::AmbientPass, renderBatch.subGeometryIndex(), commandBuffer);
+			instance->render(renderTarget, nullptr, RenderPassType::AmbientPass, renderBatch.subGeometryIndex(), renderBatch.levelOfDetail(), commandBuffer);
+
+			this->countDrawCall(instanceCount);
 
 			/* Loop through all directional lights. */
 			for ( const auto & light : m_lightSet.directionalLights() )
@@ -1172,7 +1545,9 @@ namespace EmEn::Scenes
 					continue;
 				}
 
-				renderBatch.renderableInstance()->render(renderTarget, light.get(), RenderPassType::DirectionalLightPassNoShadow, renderBatch.subGeometryIndex(), commandBuffer);
+				instance->render(renderTarget, light.get(), RenderPassType::DirectionalLightPassNoShadow, renderBatch.subGeometryIndex(), renderBatch.levelOfDetail(), commandBuffer);
+
+				this->countDrawCall(instanceCount);
 			}
 
 			/* Loop through all point lights. */
@@ -1183,11 +1558,11 @@ namespace EmEn::Scenes
 					continue;
 				}
 
-				const auto & instance = renderBatch.renderableInstance();
-
 				if ( instance->isLightDistanceCheckDisabled() || light->touch(instance->worldPosition()) )
 				{
-					instance->render(renderTarget, light.get(), RenderPassType::PointLightPassNoShadow, renderBatch.subGeometryIndex(), commandBuffer);
+					instance->render(renderTarget, light.get(), RenderPassType::PointLightPassNoShadow, renderBatch.subGeometryIndex(), renderBatch.levelOfDetail(), commandBuffer);
+
+					this->countDrawCall(instanceCount);
 				}
 			}
 
@@ -1199,11 +1574,11 @@ namespace EmEn::Scenes
 					continue;
 				}
 
-				const auto & instance = renderBatch.renderableInstance();
-
 				if ( instance->isLightDistanceCheckDisabled() || light->touch(instance->worldPosition()) )
 				{
-					renderBatch.renderableInstance()->render(renderTarget, light.get(), RenderPassType::SpotLightPassNoShadow, renderBatch.subGeometryIndex(), commandBuffer);
+					instance->render(renderTarget, light.get(), RenderPassType::SpotLightPassNoShadow, renderBatch.subGeometryIndex(), renderBatch.levelOfDetail(), commandBuffer);
+
+					this->countDrawCall(instanceCount);
 				}
 			}
 		}
@@ -1212,6 +1587,8 @@ namespace EmEn::Scenes
 	void
 	Scene::castShadows (const std::shared_ptr< RenderTarget::Abstract > & renderTarget, const Vulkan::CommandBuffer & commandBuffer) noexcept
 	{
+		const ProfileScope profileScope{"Scene::castShadows"};
+
 		if ( !m_lightSet.isEnabled() )
 		{
 			return;
@@ -1228,15 +1605,16 @@ namespace EmEn::Scenes
 		//	"Shadow map content :" "\n"
 		//	" - Plain objects : " << m_renderLists[Shadows].size() << "\n";
 
-		for ( const auto & renderBatch : m_renderLists[Shadows] | std::views::values )
-		{
-			renderBatch.renderableInstance()->castShadows(renderTarget, renderBatch.subGeometryIndex(), commandBuffer);
-		}
+		m_renderPassCount++;
+
+		this->renderBatches(renderTarget, commandBuffer, m_renderLists[Shadows], true, true);
 	}
 
 	void
 	Scene::render (const std::shared_ptr< RenderTarget::Abstract > & renderTarget, const Vulkan::CommandBuffer & commandBuffer) noexcept
 	{
+		const ProfileScope profileScope{"Scene::render"};
+
 		/* Sort the scene according to the point of view. */
 		if ( !this->populateRenderLists(renderTarget, false) )
 		{
@@ -1249,18 +1627,25 @@ namespace EmEn::Scenes
 		//	" - Opaque / +lighted : " << m_renderLists[Opaque].size() << " / " << m_renderLists[OpaqueLighted].size() << "\n"
 		//	" - Translucent / +lighted : " << m_renderLists[Translucent].size() << " / " << m_renderLists[TranslucentLighted].size() << "\n";
 
+		m_renderPassCount++;
+
+		/* NOTE: Release the instance buffers of renderables no longer drawn. */
+		std::erase_if(m_autoInstancingGroups, [this] (const auto & item) {
+			return m_renderPassCount - item.second.renderPass > AutoInstancingMaxIdlePasses;
+		});
+
 		/* First, we render all opaque renderable objects. */
-		this->renderSelection(renderTarget, commandBuffer, m_renderLists[Opaque], m_renderLists[OpaqueLighted]);
+		this->renderSelection(renderTarget, commandBuffer, m_renderLists[Opaque], m_renderLists[OpaqueLighted], false);
 
 		/* After, we render all translucent renderable objects. */
-		this->renderSelection(renderTarget, commandBuffer, m_renderLists[Translucent], m_renderLists[TranslucentLighted]);
+		this->renderSelection(renderTarget, commandBuffer, m_renderLists[Translucent], m_renderLists[TranslucentLighted], true);
 
 		/* Optional rendering.
 		 * FIXME: Add a master control. */
 		/*{
 			for ( const auto & renderBatch : m_renderLists[Opaque] )
 			{
-				const auto * renderableInstance = renderBatch.second.renderableInstance();
+				const auto * renderableInstance = renderBatch.renderableInstance();
 
 				if ( renderableInstance->isDisplayTBNSpaceEnabled() )
 				{
@@ -1270,7 +1655,7 @@ namespace EmEn::Scenes
 
 			for ( const auto & renderBatch : m_renderLists[Translucent] )
 			{
-				const auto * renderableInstance = renderBatch.second.renderableInstance();
+				const auto * renderableInstance = renderBatch.renderableInstance();
 
 				if ( renderableInstance->isDisplayTBNSpaceEnabled() )
 				{
@@ -1280,7 +1665,7 @@ namespace EmEn::Scenes
 
 			for ( const auto & renderBatch : m_renderLists[OpaqueLighted] )
 			{
-				const auto * renderableInstance = renderBatch.second.renderableInstance();
+				const auto * renderableInstance = renderBatch.renderableInstance();
 
 				if ( renderableInstance->isDisplayTBNSpaceEnabled() )
 				{
@@ -1290,7 +1675,7 @@ namespace EmEn::Scenes
 
 			for ( const auto & renderBatch : m_renderLists[TranslucentLighted] )
 			{
-				const auto * renderableInstance = renderBatch.second.renderableInstance();
+				const auto * renderableInstance = renderBatch.renderableInstance();
 
 				if ( renderableInstance->isDisplayTBNSpaceEnabled() )
 				{
@@ -2089,15 +2474,14 @@ namespace EmEn::Scenes
 
 			if ( showTree )
 			{
-				for ( const auto & subSector : m_physicsOctree->subSectors() )
-				{
-					output << " Sector depth:" << subSector->getDistance() << ", slot:" << subSector->slot() << "\n";
+				m_physicsOctree->forEachLeafSector([&output] (const auto & sector) {
+					output << " Sector depth:" << sector.getDistance() << ", slot:" << sector.slot() << "\n";
 
-					for ( const auto & element : subSector->elements() )
+					for ( const auto & element : sector.elements() )
 					{
 						output << "\t" "- " << element->name() << "\n";
 					}
-				}
+				});
 			}
 		}
 
@@ -26,6 +26,9 @@
 
 #pragma once
 
+/* Engine configuration file. */
+#include "emeraude_config.hpp"
+
 /* STL inclusions. */
 #include <cstddef>
 #include <cstdint>
@@ -37,6 +40,7 @@
 #include <any>
 #include <memory>
 #include <mutex>
+#include <tuple>
 
 /* Local inclusions for inheritances. */
 #include "Libs/NameableTrait.hpp"
@@ -49,13 +53,16 @@
 #include "Graphics/Renderable/AbstractBackground.hpp"
 #include "Graphics/Renderable/SceneAreaInterface.hpp"
 #include "Graphics/Renderable/SeaLevelInterface.hpp"
+#include "Graphics/RenderableInstance/Multiple.hpp"
 #include "Saphir/EffectInterface.hpp"
 #include "LightSet.hpp"
 #include "OctreeSector.hpp"
+#include "FlatOctree.hpp"
 #include "StaticEntity.hpp"
 #include "Node.hpp"
 #include "NodeController.hpp"
-#include "RenderBatch.hpp"
+#include "RenderQueue.hpp"
+#include "Physics/Collider.hpp"
 
 /* Forward Declarations */
 namespace EmEn::Graphics
@@ -100,6 +107,14 @@ namespace EmEn::Scenes
 			/** @brief Observable class unique identifier. */
 			static const size_t ClassUID;
 
+#ifdef EMERAUDE_USE_FLAT_OCTREE
+			using RenderingOctree = FlatOctree< AbstractEntity, false >;
+			using PhysicsOctree = FlatOctree< AbstractEntity, true >;
+#else
+			using RenderingOctree = OctreeSector< AbstractEntity, false >;
+			using PhysicsOctree = OctreeSector< AbstractEntity, true >;
+#endif
+
 			/**
 			 * @brief Constructs a scene.
 			 * @param graphicsRenderer A reference to the graphics renderer.
@@ -368,6 +383,13 @@ namespace EmEn::Scenes
 			 */
 			void processLogics (size_t engineCycle) noexcept;
 
+			/**
+			 * @brief Refreshes the world coordinates of moved nodes and dispatches them to their components.
+			 * @note This is done at the end of every logic cycle. The Core calls it directly while the logics are paused.
+			 * @return void
+			 */
+			void updateWorldCoordinates () const noexcept;
+
 			/**
 			 * @brief Updates the video memory just before rendering.
 			 * @note This should only update things which must be ready for rendering.
@@ -781,6 +803,32 @@ namespace EmEn::Scenes
 
 		private:
 
+			/**
+			 * @brief Candidate pair of entities for the collision narrow phase.
+			 * @note The first entity always has the lowest serial, so the same pair found in several sectors is identical.
+			 */
+			struct CollisionPair
+			{
+				AbstractEntity * first{nullptr};
+				AbstractEntity * second{nullptr};
+			};
+
+			/**
+			 * @brief Pool of instanced renderables replacing runs of identical render batches.
+			 * @note Buffers rotate over the swap-chain images, and a render pass can use several of them,
+			 * so an instance buffer is never rewritten while a recorded command buffer still reads it.
+			 */
+			struct AutoInstancingGroup
+			{
+				std::vector< std::vector< std::shared_ptr< Graphics::RenderableInstance::Multiple > > > instances;
+				size_t renderPass{0};
+				size_t slot{0};
+				size_t used{0};
+			};
+
+			/** @brief Render target, renderable, layer, renderable instance flags and shadow casting. */
+			using AutoInstancingKey = std::tuple< const Graphics::RenderTarget::Abstract *, const Graphics::Renderable::Interface *, uint32_t, uint32_t, bool >;
+
 			/** @copydoc EmEn::Libs::ObserverTrait::onNotification() */
 			[[nodiscard]]
 			bool onNotification (const ObservableTrait * observable, int notificationCode, const std::any & data) noexcept override;
@@ -793,6 +841,16 @@ namespace EmEn::Scenes
 			 */
 			bool populateRenderLists (const std::shared_ptr< Graphics::RenderTarget::Abstract > & renderTarget, bool isShadowCasting) noexcept;
 
+			/**
+			 * @brief Checks whether an entity is visible from a render target point of view.
+			 * @note Entities without valid bounding primitives are always considered visible.
+			 * @param renderTarget A reference to the render target.
+			 * @param entity A reference to an entity.
+			 * @return bool
+			 */
+			[[nodiscard]]
+			static bool isVisibleFrom (const Graphics::RenderTarget::Abstract & renderTarget, const AbstractEntity & entity) noexcept;
+
 			/**
 			 * @brief Inserts a renderable instance in render lists for shadows casting.
 			 * @param renderTarget A reference to the render target smart pointer.
@@ -815,11 +873,52 @@ namespace EmEn::Scenes
 			 * @brief Renders a specific selection of objects;
 			 * @param renderTarget A reference to the render target smart pointer.
 			 * @param commandBuffer A reference to the command buffer.
-			 * @param unlightedObjects A reference to an unlighted renderable list.
-			 * @param lightedObjects A reference to a lighted renderable list.
+			 * @param unlightedObjects A reference to an unlighted render queue.
+			 * @param lightedObjects A reference to a lighted render queue.
+			 * @param isTranslucent Keeps every batch as its own draw to preserve the back-to-front order.
+			 * @return void
+			 */
+			void renderSelection (const std::shared_ptr< Graphics::RenderTarget::Abstract > & renderTarget, const Vulkan::CommandBuffer & commandBuffer, const RenderQueue & unlightedObjects, const RenderQueue & lightedObjects, bool isTranslucent) noexcept;
+
+			/**
+			 * @brief Renders a queue with a single pass, optionally merging identical renderables into instanced draws.
+			 * @param renderTarget A reference to the render target smart pointer.
+			 * @param commandBuffer A reference to the command buffer.
+			 * @param renderQueue A reference to a sorted render queue.
+			 * @param isShadowCasting Uses the shadow casting programs instead of the simple pass.
+			 * @param enableAutoInstancing Allows merging identical renderables into instanced draws.
 			 * @return void
 			 */
-			void renderSelection (const std::shared_ptr< Graphics::RenderTarget::Abstract > & renderTarget, const Vulkan::CommandBuffer & commandBuffer, const RenderBatch::List & unlightedObjects, const RenderBatch::List & lightedObjects) const noexcept;
+			void renderBatches (const std::shared_ptr< Graphics::RenderTarget::Abstract > & renderTarget, const Vulkan::CommandBuffer & commandBuffer, const RenderQueue & renderQueue, bool isShadowCasting, bool enableAutoInstancing) noexcept;
+
+			/**
+			 * @brief Draws a run of render batches sharing the same renderable and layer with a single instanced draw.
+			 * @param renderTarget A reference to the render target smart pointer.
+			 * @param commandBuffer A reference to the command buffer.
+			 * @param batches A reference to the sorted render batches.
+			 * @param first The index of the first batch of the run.
+			 * @param last The index past the last batch of the run.
+			 * @param isShadowCasting Uses the shadow casting programs instead of the simple pass.
+			 * @return bool
+			 */
+			[[nodiscard]]
+			bool renderAutoInstanced (const std::shared_ptr< Graphics::RenderTarget::Abstract > & renderTarget, const Vulkan::CommandBuffer & commandBuffer, const std::vector< RenderBatch > & batches, size_t first, size_t last, bool isShadowCasting) noexcept;
+
+			/**
+			 * @brief Returns whether two render batches can be drawn by the same instanced draw.
+			 * @param batchA A reference to a render batch.
+			 * @param batchB A reference to a render batch.
+			 * @return bool
+			 */
+			[[nodiscard]]
+			static bool canShareInstancedDraw (const RenderBatch & batchA, const RenderBatch & batchB) noexcept;
+
+			/**
+			 * @brief Reports a draw command to the renderer statistics.
+			 * @param instanceCount The number of instances drawn.
+			 * @return void
+			 */
+			void countDrawCall (uint32_t instanceCount) const noexcept;
 
 			/**
 			 * @brief Loops over each renderable instance of the scene
@@ -888,12 +987,30 @@ namespace EmEn::Scenes
 			void checkEntityLocationInOctrees (const std::shared_ptr< AbstractEntity > & entity) const noexcept;
 
 			/**
-			 * @brief Executes a collision test between scene at a sector.
-			 * @note This is a recursive method with sub-sector.
-			 * @param sector A reference to the current sector tested.
+			 * @brief Executes the collision test between scene entities from the physics octree.
+			 * @note First, the candidate pairs are collected from the leaf sectors concurrently and deduplicated.
+			 * Then, the narrow phase is executed concurrently into per-worker contact buffers, which are applied in the pair order.
+			 * @return void
+			 */
+			void sectorCollisionTest () noexcept;
+
+			/**
+			 * @brief Collects the candidate collision pairs from a range of flattened leaf sectors.
+			 * @param firstLeaf The index of the first leaf.
+			 * @param lastLeaf The index after the last leaf.
+			 * @param pairs A reference to the pair buffer of the worker.
 			 * @return void
 			 */
-			void sectorCollisionTest (const OctreeSector< AbstractEntity, true > & sector) noexcept;
+			void collectCollisionPairs (size_t firstLeaf, size_t lastLeaf, std::vector< CollisionPair > & pairs) const noexcept;
+
+			/**
+			 * @brief Executes the narrow phase on a candidate pair without modifying the entities.
+			 * @param pair A reference to a candidate pair.
+			 * @param contact A reference to the contact to complete.
+			 * @return bool
+			 */
+			[[nodiscard]]
+			static bool findCollisionContact (const CollisionPair & pair, Physics::Collider::Contact & contact) noexcept;
 
 			/**
 			 * @brief Checks if a scene node is clipping with the scene area boundaries.
@@ -958,6 +1075,19 @@ namespace EmEn::Scenes
 			[[nodiscard]]
 			bool getRenderableInstanceReadyForRender (const std::shared_ptr< Graphics::RenderableInstance::Abstract > & renderableInstance, const std::shared_ptr< Graphics::RenderTarget::Abstract > & renderTarget) const noexcept;
 
+			static constexpr auto CollisionPairsPerWorker{64UL};
+			static constexpr auto AutoInstancingMinimumBatches{4UL};
+			static constexpr auto AutoInstancingMaxIdlePasses{600UL};
+			/* NOTE: Flags of the merged renderable instances affecting the shader generation or the pipeline states. */
+			static constexpr uint32_t AutoInstancingInheritedFlags{
+				Graphics::RenderableInstance::EnableLighting |
+				Graphics::RenderableInstance::EnableShadows |
+				Graphics::RenderableInstance::DisableDepthTest |
+				Graphics::RenderableInstance::DisableDepthWrite |
+				Graphics::RenderableInstance::DisableStencilTest |
+				Graphics::RenderableInstance::DisableStencilWrite |
+				Graphics::RenderableInstance::DisableLightDistanceCheck
+			};
 			static constexpr auto CompassDisplay{"+Compass"};
 			static constexpr auto GroundZeroPlaneDisplay{"+GroundZeroPlane"};
 			static constexpr auto BoundaryPlanesDisplay{"+BoundaryPlane"};
@@ -983,19 +1113,27 @@ namespace EmEn::Scenes
 			std::shared_ptr< Node > m_rootNode;
 			/* FIXME: This shouldn't be a persistent instance here. This is a debug thing. */
 			NodeController m_nodeController;
-			std::shared_ptr< OctreeSector< AbstractEntity, false > > m_renderingOctree;
-			std::shared_ptr< OctreeSector< AbstractEntity, true > > m_physicsOctree;
+			std::shared_ptr< RenderingOctree > m_renderingOctree;
+			std::shared_ptr< PhysicsOctree > m_physicsOctree;
 			LightSet m_lightSet{m_AVConsoleManager};
 			std::set< std::shared_ptr< Component::AbstractModifier > > m_modifiers;
 			Physics::PhysicalEnvironmentProperties m_physicalEnvironmentProperties{Physics::PhysicalEnvironmentProperties::Earth()};
 			Audio::SoundEnvironmentProperties m_soundEnvironmentProperties;
-			std::array< RenderBatch::List, 5 > m_renderLists{};
+			std::array< RenderQueue, 5 > m_renderLists{};
 			Saphir::EffectsList m_environmentEffects;
 			float m_boundary{0};
 			Libs::Randomizer< float > m_randomizer;
 			uint64_t m_lifetimeUS{0};
 			uint32_t m_lifetimeMS{0};
 			size_t m_cycle{0};
+			std::vector< AbstractEntity * > m_collisionLeafEntities;
+			std::vector< std::pair< size_t, size_t > > m_collisionLeafRanges;
+			std::vector< std::vector< CollisionPair > > m_collisionPairBuffers;
+			std::vector< CollisionPair > m_collisionPairs;
+			std::vector< std::vector< Physics::Collider::Contact > > m_contactBuffers;
+			std::map< AutoInstancingKey, AutoInstancingGroup > m_autoInstancingGroups;
+			std::vector< Libs::Math::CartesianFrame< float > > m_autoInstancingLocations;
+			size_t m_renderPassCount{0};
 			mutable std::mutex m_sceneNodesMutex;
 			mutable std::mutex m_staticEntitiesMutex;
 			mutable std::mutex m_renderingOctreeMutex;
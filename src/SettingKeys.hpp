@@ -84,9 +84,23 @@ namespace EmEn
 		constexpr auto DefaultTracerEnableThreadInfos{false};
 		constexpr auto TracerEnableLoggerKey{"Core/Tracer/EnableLogger"};
 		constexpr auto DefaultTracerEnableLogger{false};
-		constexpr auto TracerLogFormatKey{"Core/Tracer/LogFormat"};
+		constexpr auto TracerLogFormatKey{"Core/Tracer/LogFormat"}; // Text, JSON, HTML or Binary
 		constexpr auto DefaultTracerLogFormat{"Text"};
 
+		/* Job system */
+		constexpr auto JobSystemWorkerCountKey{"Core/JobSystem/WorkerCount"}; // 0 = automatic
+		constexpr auto DefaultJobSystemWorkerCount{0U};
+
+		/* Frame profiler */
+		constexpr auto FrameProfilerShowInformationKey{"Core/FrameProfiler/ShowInformation"}; // Logs
+		constexpr auto DefaultFrameProfilerShowInformation{false};
+		constexpr auto FrameProfilerEnabledKey{"Core/FrameProfiler/Enabled"};
+		constexpr auto DefaultFrameProfilerEnabled{false};
+		constexpr auto FrameProfilerHistogramRangeKey{"Core/FrameProfiler/HistogramRange"}; // Frames
+		constexpr auto DefaultFrameProfilerHistogramRange{300U};
+		constexpr auto FrameProfilerCaptureFrameCountKey{"Core/FrameProfiler/CaptureFrameCount"};
+		constexpr auto DefaultFrameProfilerCaptureFrameCount{120U};
+
 		/* Input manager */
 		constexpr auto InputShowInformationKey{"Core/Input/ShowInformation"}; // Logs
 		constexpr auto DefaultInputShowInformation{false};
@@ -98,6 +112,14 @@ namespace EmEn
 		constexpr auto DefaultResourcesDownloadEnabled{true};
 		constexpr auto ResourcesQuietConversionKey{"Core/Resources/QuietConversion"}; // Logs
 		constexpr auto DefaultResourcesQuietConversion{true};
+		constexpr auto ResourcesLoadingQueueCapacityKey{"Core/Resources/LoadingQueueCapacity"};
+		constexpr auto DefaultResourcesLoadingQueueCapacity{256U};
+		constexpr auto ResourcesReadConcurrencyKey{"Core/Resources/ReadConcurrency"};
+		constexpr auto DefaultResourcesReadConcurrency{2U};
+		constexpr auto ResourcesDecodeConcurrencyKey{"Core/Resources/DecodeConcurrency"}; // 0 = job system worker count
+		constexpr auto DefaultResourcesDecodeConcurrency{0U};
+		constexpr auto ResourcesUploadConcurrencyKey{"Core/Resources/UploadConcurrency"};
+		constexpr auto DefaultResourcesUploadConcurrency{2U};
 
 		/* Audio layer */
 		constexpr auto AudioEnableKey{"Core/Audio/Enable"};
@@ -112,6 +134,8 @@ namespace EmEn
 		constexpr auto DefaultAudioMusicVolume{0.5F};
 		constexpr auto AudioMusicChunkSizeKey{"Core/Audio/MusicChunkSize"};
 		constexpr auto DefaultAudioMusicChunkSize{8192};
+		constexpr auto AudioCacheMaximumSizeKey{"Core/Audio/CacheMaximumSize"};
+		constexpr auto DefaultAudioCacheMaximumSize{256};
 
 			/* Recorder */
 			constexpr auto RecorderFrequencyKey{"Core/Audio/Recorder/Frequency"};
@@ -201,6 +225,10 @@ namespace EmEn
 			constexpr auto DefaultGraphicsTextureMipMappingLevels{1};
 			constexpr auto GraphicsTextureAnisotropyLevelsKey{"Core/Graphics/Texture/AnisotropyLevels"};
 			constexpr auto DefaultGraphicsTextureAnisotropy{0};
+			constexpr auto GraphicsTextureCompressionEnabledKey{"Core/Graphics/Texture/CompressionEnabled"};
+			constexpr auto DefaultGraphicsTextureCompressionEnabled{true};
+			constexpr auto GraphicsTextureCompressionHighQualityKey{"Core/Graphics/Texture/CompressionHighQuality"};
+			constexpr auto DefaultGraphicsTextureCompressionHighQuality{true};
 
 			/* Shadow Mapping */
 			constexpr auto GraphicsShadowMappingEnabledKey{"Core/Graphics/ShadowMapping/Enabled"};
@@ -228,6 +256,12 @@ namespace EmEn
 			constexpr auto HighQualityReflectionEnabledKey{"Core/Graphics/Shader/EnableHighQualityReflection"};
 			constexpr auto DefaultHighQualityReflectionEnabled{false};
 
+			/* Pipeline */
+			constexpr auto PipelineCacheEnabledKey{"Core/Graphics/Pipeline/EnableCache"};
+			constexpr auto DefaultPipelineCacheEnabled{true};
+			constexpr auto PipelinePrewarmEnabledKey{"Core/Graphics/Pipeline/EnablePrewarm"};
+			constexpr auto DefaultPipelinePrewarmEnabled{true};
+
 		/* Physics */
 		constexpr auto EnablePhysicsAccelerationKey{"Core/Physics/EnableAcceleration"};
 		constexpr auto DefaultEnablePhysicsAcceleration{false};
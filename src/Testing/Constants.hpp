@@ -28,6 +28,7 @@
 
 /* STL inclusions. */
 #include <filesystem>
+#include <system_error>
 
 /* NOTE: Source images. */
 static const std::filesystem::path FixedFont{"./test-assets/fixed-font.tga"};
@@ -44,3 +45,25 @@ static const std::filesystem::path SmallPatternRBG_2{"./test-assets/126x126-RGB_
 static const std::filesystem::path SmallPatternRBG_3{"./test-assets/126x126-RGB_pattern003.png"};
 static const std::filesystem::path MediumPatternRBG_1{"./test-assets/256x256-RGB_pattern001.png"};
 static const std::filesystem::path SmallRGBA{"./test-assets/64x64-RGBA.png"};
+
+/**
+ * @brief Returns a path in the directory of the files written by tests, removing what a previous run left there.
+ * @param name The file or directory name.
+ * @return std::filesystem::path
+ */
+inline
+std::filesystem::path
+testOutputPath (const char * name) noexcept
+{
+	std::error_code errorCode;
+
+	auto path = std::filesystem::temp_directory_path(errorCode) / "emeraude-tests";
+
+	std::filesystem::create_directories(path, errorCode);
+
+	path /= name;
+
+	std::filesystem::remove_all(path, errorCode);
+
+	return path;
+}
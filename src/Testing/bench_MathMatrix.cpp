@@ -0,0 +1,214 @@
+/*
+ * src/Testing/bench_MathMatrix.cpp
+ * This file is part of Emeraude-Engine
+ *
+ * Copyright (C) 2010-2025 - Sébastien Léon Claude Christian Bémelmans "LondNoir" <londnoir@gmail.com>
+ *
+ * Emeraude-Engine is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * Emeraude-Engine is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with Emeraude-Engine; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * Complete project and additional information can be found at :
+ * https://github.com/londnoir/emeraude-engine
+ *
+ * --- THIS IS AUTOMATICALLY GENERATED, DO NOT CHANGE ---
+ */
+
+#include <gtest/gtest.h>
+
+/* STL inclusions. */
+#include <cstddef>
+#include <iostream>
+#include <string>
+#include <vector>
+
+/* Local inclusions. */
+#include "Libs/Randomizer.hpp"
+#include "Libs/Time/Elapsed/PrintScopeRealTime.hpp"
+#include "Libs/Math/Matrix.hpp"
+#include "Libs/Math/Space3D/AACuboid.hpp"
+
+using namespace EmEn::Libs;
+using namespace EmEn::Libs::Math;
+using namespace EmEn::Libs::Time::Elapsed;
+
+constexpr auto OperationCount{1000000UL};
+constexpr auto BatchSize{100000UL};
+constexpr auto BatchPassCount{20UL};
+
+/**
+ * @brief Creates a list of random matrices.
+ * @tparam precision_t The data precision.
+ * @param count The number of matrices.
+ * @return std::vector< Matrix< 4, precision_t > >
+ */
+template< typename precision_t >
+std::vector< Matrix< 4, precision_t > >
+createMatrices (size_t count) noexcept
+{
+	Randomizer< precision_t > randomizer{1337};
+
+	std::vector< Matrix< 4, precision_t > > matrices;
+	matrices.reserve(count);
+
+	for ( size_t index = 0; index < count; index++ )
+	{
+		std::array< precision_t, 16 > data{};
+
+		for ( auto & value : data )
+		{
+			value = randomizer.value(-8, 8);
+		}
+
+		matrices.emplace_back(data);
+	}
+
+	return matrices;
+}
+
+/**
+ * @brief Runs the matrix operations on a precision. The float version uses the SIMD kernels, the double one the generic code.
+ * @tparam precision_t The data precision.
+ * @param label The name for the output.
+ * @return void
+ */
+template< typename precision_t >
+void
+runMatrixBenchmark (const std::string & label) noexcept
+{
+	const auto matrices = createMatrices< precision_t >(1024);
+	const auto mask = matrices.size() - 1;
+
+	precision_t checksum = 0;
+
+	{
+		PrintScopeRealTime stat{label + " multiply x" + std::to_string(OperationCount)};
+
+		Matrix< 4, precision_t > accumulator;
+
+		for ( size_t index = 0; index < OperationCount; index++ )
+		{
+			accumulator = matrices[index & mask] * matrices[(index + 1) & mask];
+			checksum += accumulator[M4x4Col3Row3];
+		}
+	}
+
+	{
+		PrintScopeRealTime stat{label + " vector x" + std::to_string(OperationCount)};
+
+		Vector< 4, precision_t > vector{1, 2, 3, 1};
+
+		for ( size_t index = 0; index < OperationCount; index++ )
+		{
+			const auto result = matrices[index & mask] * vector;
+			checksum += result[W];
+		}
+	}
+
+	{
+		PrintScopeRealTime stat{label + " transpose x" + std::to_string(OperationCount)};
+
+		for ( size_t index = 0; index < OperationCount; index++ )
+		{
+			auto matrix = matrices[index & mask];
+			matrix.transpose();
+			checksum += matrix[M4x4Col0Row3];
+		}
+	}
+
+	{
+		PrintScopeRealTime stat{label + " inverse x" + std::to_string(OperationCount)};
+
+		for ( size_t index = 0; index < OperationCount; index++ )
+		{
+			const auto matrix = matrices[index & mask].inverse();
+			checksum += matrix[M4x4Col0Row0];
+		}
+	}
+
+	std::cout << label << " checksum: " << checksum << "\n\n";
+}
+
+/**
+ * @brief Runs the batch transformations on a precision.
+ * @tparam precision_t The data precision.
+ * @param label The name for the output.
+ * @return void
+ */
+template< typename precision_t >
+void
+runBatchBenchmark (const std::string & label) noexcept
+{
+	Randomizer< precision_t > randomizer{42};
+
+	const auto matrix = createMatrices< precision_t >(1).front();
+
+	std::vector< Vector< 3, precision_t > > input(BatchSize);
+	std::vector< Vector< 3, precision_t > > output(BatchSize);
+	std::vector< Space3D::AACuboid< precision_t > > boxes(BatchSize);
+
+	for ( size_t index = 0; index < BatchSize; index++ )
+	{
+		input[index] = {randomizer.value(-100, 100), randomizer.value(-100, 100), randomizer.value(-100, 100)};
+		boxes[index] = {input[index] + Vector< 3, precision_t >{1, 1, 1}, input[index] - Vector< 3, precision_t >{1, 1, 1}};
+	}
+
+	const auto suffix = " x" + std::to_string(BatchSize * BatchPassCount);
+
+	{
+		PrintScopeRealTime stat{label + " points" + suffix};
+
+		for ( size_t pass = 0; pass < BatchPassCount; pass++ )
+		{
+			matrix.transformPoints(input, output);
+		}
+	}
+
+	{
+		PrintScopeRealTime stat{label + " normals" + suffix};
+
+		for ( size_t pass = 0; pass < BatchPassCount; pass++ )
+		{
+			matrix.transformNormals(input, output);
+		}
+	}
+
+	std::vector< Space3D::AACuboid< precision_t > > transformedBoxes(BatchSize);
+
+	{
+		PrintScopeRealTime stat{label + " boxes" + suffix};
+
+		for ( size_t pass = 0; pass < BatchPassCount; pass++ )
+		{
+			Space3D::AACuboid< precision_t >::transform(matrix, boxes, transformedBoxes);
+		}
+	}
+
+	ASSERT_TRUE(transformedBoxes.back().isValid());
+
+	std::cout << label << " last point: " << output.back() << "\n\n";
+}
+
+TEST(MathMatrixBenchmark, operations)
+{
+	std::cout << "SIMD instruction set: " << SIMD::InstructionSet << "\n\n";
+
+	runMatrixBenchmark< float >("Matrix<4,float>");
+	runMatrixBenchmark< double >("Matrix<4,double>");
+}
+
+TEST(MathMatrixBenchmark, batches)
+{
+	runBatchBenchmark< float >("Matrix<4,float>");
+	runBatchBenchmark< double >("Matrix<4,double>");
+}
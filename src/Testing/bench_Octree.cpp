@@ -0,0 +1,244 @@
+/*
+ * src/Testing/bench_Octree.cpp
+ * This file is part of Emeraude-Engine
+ *
+ * Copyright (C) 2010-2025 - Sébastien Léon Claude Christian Bémelmans "LondNoir" <londnoir@gmail.com>
+ *
+ * Emeraude-Engine is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * Emeraude-Engine is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with Emeraude-Engine; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * Complete project and additional information can be found at :
+ * https://github.com/londnoir/emeraude-engine
+ *
+ * --- THIS IS AUTOMATICALLY GENERATED, DO NOT CHANGE ---
+ */
+
+#include <gtest/gtest.h>
+
+/* STL inclusions. */
+#include <cstddef>
+#include <string>
+#include <vector>
+#include <memory>
+
+/* Local inclusions. */
+#include "Libs/NameableTrait.hpp"
+#include "Libs/Randomizer.hpp"
+#include "Libs/Time/Elapsed/PrintScopeRealTime.hpp"
+#include "Scenes/LocatableInterface.hpp"
+#include "Scenes/OctreeSector.hpp"
+#include "Scenes/FlatOctree.hpp"
+
+using namespace EmEn::Libs;
+using namespace EmEn::Libs::Math;
+using namespace EmEn::Libs::Time::Elapsed;
+using namespace EmEn::Scenes;
+
+/**
+ * @brief Minimal locatable element, only holding a world position and a bounding radius.
+ */
+class BenchElement final : public NameableTrait, public LocatableInterface
+{
+	public:
+
+		BenchElement (const Vector< 3, float > & position, float radius) noexcept
+			: NameableTrait("BenchElement"), m_coordinates(position), m_localBoundingBox(radius), m_localBoundingSphere(radius)
+		{
+
+		}
+
+		void setPosition (const Vector< 3, float > & position, TransformSpace) noexcept override { m_coordinates.setPosition(position); }
+		void setXPosition (float position, TransformSpace) noexcept override { m_coordinates.setXPosition(position); }
+		void setYPosition (float position, TransformSpace) noexcept override { m_coordinates.setYPosition(position); }
+		void setZPosition (float position, TransformSpace) noexcept override { m_coordinates.setZPosition(position); }
+		void move (const Vector< 3, float > & distance, TransformSpace) noexcept override { m_coordinates.translate(distance, false); }
+		void moveX (float distance, TransformSpace) noexcept override { m_coordinates.translateX(distance, false); }
+		void moveY (float distance, TransformSpace) noexcept override { m_coordinates.translateY(distance, false); }
+		void moveZ (float distance, TransformSpace) noexcept override { m_coordinates.translateZ(distance, false); }
+		void rotate (float, const Vector< 3, float > &, TransformSpace) noexcept override { }
+		void pitch (float, TransformSpace) noexcept override { }
+		void yaw (float, TransformSpace) noexcept override { }
+		void roll (float, TransformSpace) noexcept override { }
+		void scale (const Vector< 3, float > &, TransformSpace) noexcept override { }
+		void scale (float, TransformSpace) noexcept override { }
+		void scaleX (float, TransformSpace) noexcept override { }
+		void scaleY (float, TransformSpace) noexcept override { }
+		void scaleZ (float, TransformSpace) noexcept override { }
+		void lookAt (const Vector< 3, float > &, bool) noexcept override { }
+		void setLocalCoordinates (const CartesianFrame< float > & coordinates) noexcept override { m_coordinates = coordinates; }
+		[[nodiscard]] const CartesianFrame< float > & localCoordinates () const noexcept override { return m_coordinates; }
+		[[nodiscard]] CartesianFrame< float > & localCoordinates () noexcept override { return m_coordinates; }
+		[[nodiscard]] CartesianFrame< float > getWorldCoordinates () const noexcept override { return m_coordinates; }
+		[[nodiscard]] const Space3D::AACuboid< float > & localBoundingBox () const noexcept override { return m_localBoundingBox; }
+
+		[[nodiscard]]
+		Space3D::AACuboid< float >
+		getWorldBoundingBox () const noexcept override
+		{
+			const auto & position = m_coordinates.position();
+
+			return {m_localBoundingBox.maximum() + position, m_localBoundingBox.minimum() + position};
+		}
+
+		[[nodiscard]] const Space3D::Sphere< float > & localBoundingSphere () const noexcept override { return m_localBoundingSphere; }
+
+		[[nodiscard]]
+		Space3D::Sphere< float >
+		getWorldBoundingSphere () const noexcept override
+		{
+			return {m_localBoundingSphere.radius(), m_coordinates.position()};
+		}
+
+		void enableSphereCollision (bool state) noexcept override { m_sphereCollision = state; }
+		[[nodiscard]] bool sphereCollisionIsEnabled () const noexcept override { return m_sphereCollision; }
+
+	private:
+
+		CartesianFrame< float > m_coordinates;
+		Space3D::AACuboid< float > m_localBoundingBox;
+		Space3D::Sphere< float > m_localBoundingSphere;
+		bool m_sphereCollision{true};
+};
+
+constexpr auto Boundary{2048.0F};
+constexpr auto ElementRadius{1.0F};
+constexpr auto MaxStep{4.0F};
+constexpr auto QueryCount{1000UL};
+constexpr auto QueryRadius{32.0F};
+
+/**
+ * @brief Creates the element list with a deterministic distribution.
+ * @param count The number of elements.
+ * @return std::vector< std::shared_ptr< BenchElement > >
+ */
+std::vector< std::shared_ptr< BenchElement > >
+createElements (size_t count) noexcept
+{
+	Randomizer< float > randomizer{1337};
+
+	std::vector< std::shared_ptr< BenchElement > > elements;
+	elements.reserve(count);
+
+	for ( size_t index = 0; index < count; index++ )
+	{
+		elements.emplace_back(std::make_shared< BenchElement >(Vector< 3, float >{
+			randomizer.value(-Boundary + MaxStep, Boundary - MaxStep),
+			randomizer.value(-Boundary + MaxStep, Boundary - MaxStep),
+			randomizer.value(-Boundary + MaxStep, Boundary - MaxStep)
+		}, ElementRadius));
+	}
+
+	return elements;
+}
+
+/**
+ * @brief Runs the insert, update and query passes on an octree backend.
+ * @tparam octree_t The octree type.
+ * @param label The backend name for the output.
+ * @param elementCount The number of moving elements.
+ * @return void
+ */
+template< typename octree_t >
+void
+runOctreeBenchmark (const std::string & label, size_t elementCount) noexcept
+{
+	const auto elements = createElements(elementCount);
+	const auto octree = std::make_shared< octree_t >(Vector< 3, float >{Boundary, Boundary, Boundary}, Vector< 3, float >{-Boundary, -Boundary, -Boundary}, 32);
+
+	const auto prefix = label + " x" + std::to_string(elementCount);
+
+	{
+		PrintScopeRealTime stat{prefix + " insert"};
+
+		for ( const auto & element : elements )
+		{
+			octree->insert(element);
+		}
+	}
+
+	ASSERT_EQ(octree->elementCount(), elementCount);
+
+	Randomizer< float > randomizer{42};
+
+	for ( auto & element : elements )
+	{
+		element->move({randomizer.value(-MaxStep, MaxStep), randomizer.value(-MaxStep, MaxStep), randomizer.value(-MaxStep, MaxStep)}, TransformSpace::World);
+	}
+
+	{
+		PrintScopeRealTime stat{prefix + " update"};
+
+		for ( const auto & element : elements )
+		{
+			octree->update(element);
+		}
+	}
+
+	ASSERT_EQ(octree->elementCount(), elementCount);
+
+	size_t touchedElements = 0;
+
+	{
+		PrintScopeRealTime stat{prefix + " query"};
+
+		for ( size_t query = 0; query < QueryCount; query++ )
+		{
+			const Space3D::Sphere< float > area{QueryRadius, elements[query % elementCount]->getWorldCoordinates().position()};
+
+			octree->forTouchedSector(area, [&touchedElements] (const auto & sector) {
+				touchedElements += sector.elementCount();
+			});
+		}
+	}
+
+	ASSERT_GT(touchedElements, 0);
+
+	std::cout << prefix << " depth: " << octree->getDepth() << ", sectors: " << octree->getSectorCount() << "\n\n";
+}
+
+TEST(OctreeBenchmark, positions10k)
+{
+	runOctreeBenchmark< OctreeSector< BenchElement, false > >("OctreeSector<point>", 10000);
+	runOctreeBenchmark< FlatOctree< BenchElement, false > >("FlatOctree<point>", 10000);
+}
+
+TEST(OctreeBenchmark, positions100k)
+{
+	runOctreeBenchmark< OctreeSector< BenchElement, false > >("OctreeSector<point>", 100000);
+	runOctreeBenchmark< FlatOctree< BenchElement, false > >("FlatOctree<point>", 100000);
+}
+
+TEST(OctreeBenchmark, positions1M)
+{
+	runOctreeBenchmark< OctreeSector< BenchElement, false > >("OctreeSector<point>", 1000000);
+	runOctreeBenchmark< FlatOctree< BenchElement, false > >("FlatOctree<point>", 1000000);
+}
+
+TEST(OctreeBenchmark, volumes10k)
+{
+	runOctreeBenchmark< OctreeSector< BenchElement, true > >("OctreeSector<volume>", 10000);
+	runOctreeBenchmark< FlatOctree< BenchElement, true > >("FlatOctree<volume>", 10000);
+}
+
+TEST(OctreeBenchmark, volumes100k)
+{
+	runOctreeBenchmark< OctreeSector< BenchElement, true > >("OctreeSector<volume>", 100000);
+	runOctreeBenchmark< FlatOctree< BenchElement, true > >("FlatOctree<volume>", 100000);
+}
+
+TEST(OctreeBenchmark, volumes1M)
+{
+	runOctreeBenchmark< OctreeSector< BenchElement, true > >("OctreeSector<volume>", 1000000);
+	runOctreeBenchmark< FlatOctree< BenchElement, true > >("FlatOctree<volume>", 1000000);
+}
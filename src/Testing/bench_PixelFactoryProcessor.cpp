@@ -0,0 +1,377 @@
+/*
+ * src/Testing/bench_PixelFactoryProcessor.cpp
+ * This file is part of Emeraude-Engine
+ *
+ * Copyright (C) 2010-2025 - Sébastien Léon Claude Christian Bémelmans "LondNoir" <londnoir@gmail.com>
+ *
+ * Emeraude-Engine is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * Emeraude-Engine is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with Emeraude-Engine; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * Complete project and additional information can be found at :
+ * https://github.com/londnoir/emeraude-engine
+ *
+ * --- THIS IS AUTOMATICALLY GENERATED, DO NOT CHANGE ---
+ */
+
+#include <gtest/gtest.h>
+
+/* STL inclusions. */
+#include <cstddef>
+#include <cstdint>
+#include <cmath>
+#include <iostream>
+#include <string>
+
+/* Local inclusions. */
+#include "Libs/Math/SIMD.hpp"
+#include "Libs/PixelFactory/Pixmap.hpp"
+#include "Libs/PixelFactory/Processor.hpp"
+#include "Libs/Time/Elapsed/PrintScopeRealTime.hpp"
+
+using namespace EmEn::Libs;
+using namespace EmEn::Libs::PixelFactory;
+using namespace EmEn::Libs::Time::Elapsed;
+
+/* NOTE: The reference versions below are the former per-pixel loops, branching on the channel count for each pixel.
+ * The target allocation is timed on both sides, as Processor methods initialize their output. */
+
+/**
+ * @brief Reference nearest resize.
+ * @param source A reference to a pixmap.
+ * @param width The new width.
+ * @param height The new height.
+ * @param target A writable reference to an initialized pixmap.
+ * @return void
+ */
+void
+referenceResizeNearest (const Pixmap< uint8_t > & source, uint32_t width, uint32_t height, Pixmap< uint8_t > & target) noexcept
+{
+	const auto colorCount = source.colorCount();
+	const auto xRatio = static_cast< float >(source.width() - 1) / static_cast< float >(width);
+	const auto yRatio = static_cast< float >(source.height() - 1) / static_cast< float >(height);
+
+	const auto & sourceData = source.data();
+	auto & targetData = target.data();
+
+	size_t dstIndex = 0;
+
+	for ( size_t destinationY = 0; destinationY < height; destinationY++ )
+	{
+		const auto sourceRowIndex = static_cast< size_t >(std::round(yRatio * static_cast< float >(destinationY))) * source.width() * colorCount;
+
+		for ( size_t destinationX = 0; destinationX < width; destinationX++ )
+		{
+			const auto sourceIndex = sourceRowIndex + static_cast< size_t >(std::round(xRatio * static_cast< float >(destinationX))) * colorCount;
+
+			for ( size_t channel = 0; channel < colorCount; channel++ )
+			{
+				targetData[dstIndex++] = sourceData[sourceIndex + channel];
+			}
+		}
+	}
+}
+
+/**
+ * @brief Reference linear resize.
+ * @param source A reference to a pixmap.
+ * @param width The new width.
+ * @param height The new height.
+ * @param target A writable reference to an initialized pixmap.
+ * @return void
+ */
+void
+referenceResizeLinear (const Pixmap< uint8_t > & source, uint32_t width, uint32_t height, Pixmap< uint8_t > & target) noexcept
+{
+	const auto colorCount = source.colorCount();
+	const auto xRatio = static_cast< float >(source.width() - 1) / static_cast< float >(width);
+	const auto yRatio = static_cast< float >(source.height() - 1) / static_cast< float >(height);
+
+	const auto & sourceData = source.data();
+	auto & targetData = target.data();
+
+	size_t dstIndex = 0;
+
+	for ( size_t y = 0; y < height; y++ )
+	{
+		const auto realY = yRatio * static_cast< float >(y);
+		const auto yFloor = static_cast< size_t >(std::floor(realY));
+		const auto yCeil = static_cast< size_t >(std::ceil(realY));
+		const auto yFactor = realY - static_cast< float >(yFloor);
+
+		for ( size_t x = 0; x < width; x++ )
+		{
+			const auto realX = static_cast< float >(x) * xRatio;
+			const auto xFloor = static_cast< size_t >(std::floor(realX));
+			const auto xCeil = static_cast< size_t >(std::ceil(realX));
+			const auto xFactor = realX - static_cast< float >(xFloor);
+
+			for ( size_t channel = 0; channel < colorCount; channel++ )
+			{
+				const auto a = static_cast< float >(sourceData[(yFloor * source.width() + xFloor) * colorCount + channel]);
+				const auto b = static_cast< float >(sourceData[(yFloor * source.width() + xCeil) * colorCount + channel]);
+				const auto c = static_cast< float >(sourceData[(yCeil * source.width() + xFloor) * colorCount + channel]);
+				const auto d = static_cast< float >(sourceData[(yCeil * source.width() + xCeil) * colorCount + channel]);
+
+				const auto bottom = a + (b - a) * xFactor;
+				const auto top = c + (d - c) * xFactor;
+
+				targetData[dstIndex++] = static_cast< uint8_t >(bottom + (top - bottom) * yFactor);
+			}
+		}
+	}
+}
+
+/**
+ * @brief Reference quarter turn.
+ * @param source A reference to a pixmap.
+ * @param target A writable reference to an initialized pixmap.
+ * @return void
+ */
+void
+referenceRotateQuarterTurn (const Pixmap< uint8_t > & source, Pixmap< uint8_t > & target) noexcept
+{
+	const auto colorCount = source.colorCount();
+
+	size_t coordX = target.width() - 1;
+	size_t coordY = 0;
+
+	for ( size_t pixelIndex = 0; pixelIndex < source.pixelCount(); pixelIndex++ )
+	{
+		const auto targetIndex = (coordY * target.width() + coordX) * colorCount;
+
+		for ( size_t channel = 0; channel < colorCount; channel++ )
+		{
+			target.data()[targetIndex + channel] = source.data()[pixelIndex * colorCount + channel];
+		}
+
+		if ( coordY >= target.height() - 1 )
+		{
+			--coordX;
+			coordY = 0;
+		}
+		else
+		{
+			++coordY;
+		}
+	}
+}
+
+/**
+ * @brief Reference Y-Axis mirror.
+ * @param source A reference to a pixmap.
+ * @param target A writable reference to an initialized pixmap.
+ * @return void
+ */
+void
+referenceMirrorY (const Pixmap< uint8_t > & source, Pixmap< uint8_t > & target) noexcept
+{
+	const auto width = source.width();
+	const auto stride = source.colorCount();
+
+	for ( size_t row = 0; row < source.height(); row++ )
+	{
+		const auto rowOffset = row * width * stride;
+
+		for ( size_t rowPixel = 0; rowPixel < width; rowPixel++ )
+		{
+			for ( size_t channel = 0; channel < stride; channel++ )
+			{
+				target.data()[rowOffset + rowPixel * stride + channel] = source.data()[rowOffset + (width - (rowPixel + 1)) * stride + channel];
+			}
+		}
+	}
+}
+
+/**
+ * @brief Reference alpha channel addition.
+ * @param source A reference to a RGB pixmap.
+ * @param target A writable reference to an initialized RGBA pixmap.
+ * @return void
+ */
+void
+referenceAddAlphaChannel (const Pixmap< uint8_t > & source, Pixmap< uint8_t > & target) noexcept
+{
+	for ( size_t index = 0; index < source.pixelCount(); index++ )
+	{
+		const auto * srcData = source.pixelPointer(index);
+		auto * dstData = target.pixelPointer(index);
+
+		dstData[0] = srcData[0];
+		dstData[1] = srcData[1];
+		dstData[2] = srcData[2];
+		dstData[3] = 255;
+	}
+}
+
+/**
+ * @brief Creates a pixmap filled with a deterministic pattern.
+ * @param width The width.
+ * @param height The height.
+ * @param mode The channel mode.
+ * @return Pixmap< uint8_t >
+ */
+Pixmap< uint8_t >
+createBenchPixmap (uint32_t width, uint32_t height, ChannelMode mode) noexcept
+{
+	Pixmap< uint8_t > pixmap{width, height, mode};
+
+	uint32_t state = 0x9E3779B9;
+
+	for ( auto & value : pixmap.data() )
+	{
+		state = state * 1664525U + 1013904223U;
+		value = static_cast< uint8_t >(state >> 24);
+	}
+
+	return pixmap;
+}
+
+/**
+ * @brief Times the reference and the current version of each operation and checks they match.
+ * @param label The image size name for the output.
+ * @param width The image width.
+ * @param height The image height.
+ * @param mode The channel mode.
+ * @return void
+ */
+void
+runProcessorBenchmark (const std::string & label, uint32_t width, uint32_t height, ChannelMode mode) noexcept
+{
+	const auto source = createBenchPixmap(width, height, mode);
+	const auto prefix = label + " " + std::to_string(source.colorCount()) + "ch ";
+
+	Pixmap< uint8_t > reference;
+	Pixmap< uint8_t > output;
+
+	{
+		PrintScopeRealTime stat{prefix + "resize(50%,Nearest) [reference]"};
+
+		ASSERT_TRUE(reference.initialize(width / 2, height / 2, mode));
+
+		referenceResizeNearest(source, width / 2, height / 2, reference);
+	}
+
+	{
+		PrintScopeRealTime stat{prefix + "resize(50%,Nearest)"};
+
+		ASSERT_TRUE(Processor< uint8_t >::resize(source, width / 2, height / 2, output, FilteringMode::Nearest));
+	}
+
+	ASSERT_EQ(output.data(), reference.data());
+
+	{
+		PrintScopeRealTime stat{prefix + "resize(50%,Linear) [reference]"};
+
+		ASSERT_TRUE(reference.initialize(width / 2, height / 2, mode));
+
+		referenceResizeLinear(source, width / 2, height / 2, reference);
+	}
+
+	{
+		PrintScopeRealTime stat{prefix + "resize(50%,Linear)"};
+
+		ASSERT_TRUE(Processor< uint8_t >::resize(source, width / 2, height / 2, output, FilteringMode::Linear));
+	}
+
+	ASSERT_EQ(output.data(), reference.data());
+
+	{
+		PrintScopeRealTime stat{prefix + "resize(50%,Cubic)"};
+
+		ASSERT_TRUE(Processor< uint8_t >::resize(source, width / 2, height / 2, output, FilteringMode::Cubic));
+	}
+
+	{
+		PrintScopeRealTime stat{prefix + "downscale(50%,Box)"};
+
+		ASSERT_TRUE(Processor< uint8_t >::downscale(source, width / 2, height / 2, output, ResamplingFilter::Box));
+	}
+
+	{
+		PrintScopeRealTime stat{prefix + "downscale(50%,Lanczos)"};
+
+		ASSERT_TRUE(Processor< uint8_t >::downscale(source, width / 2, height / 2, output, ResamplingFilter::Lanczos));
+	}
+
+	{
+		PrintScopeRealTime stat{prefix + "downscale(25%,Lanczos)"};
+
+		ASSERT_TRUE(Processor< uint8_t >::downscale(source, width / 4, height / 4, output, ResamplingFilter::Lanczos));
+	}
+
+	{
+		PrintScopeRealTime stat{prefix + "mirror(Y) [reference]"};
+
+		ASSERT_TRUE(reference.initialize(width, height, mode));
+
+		referenceMirrorY(source, reference);
+	}
+
+	{
+		PrintScopeRealTime stat{prefix + "mirror(Y)"};
+
+		ASSERT_TRUE(Processor< uint8_t >::mirror(source, output, MirrorMode::Y));
+	}
+
+	ASSERT_EQ(output.data(), reference.data());
+
+	{
+		PrintScopeRealTime stat{prefix + "rotateQuarterTurn() [reference]"};
+
+		ASSERT_TRUE(reference.initialize(height, width, mode));
+
+		referenceRotateQuarterTurn(source, reference);
+	}
+
+	{
+		PrintScopeRealTime stat{prefix + "rotateQuarterTurn()"};
+
+		ASSERT_TRUE(Processor< uint8_t >::rotateQuarterTurn(source, output));
+	}
+
+	ASSERT_EQ(output.data(), reference.data());
+
+	if ( mode == ChannelMode::RGB )
+	{
+		{
+			PrintScopeRealTime stat{prefix + "addAlphaChannel() [reference]"};
+
+			ASSERT_TRUE(reference.initialize(width, height, ChannelMode::RGBA));
+
+			referenceAddAlphaChannel(source, reference);
+		}
+
+		{
+			PrintScopeRealTime stat{prefix + "addAlphaChannel()"};
+
+			ASSERT_TRUE(Processor< uint8_t >::addAlphaChannel(source, output));
+		}
+
+		ASSERT_EQ(output.data(), reference.data());
+	}
+
+	std::cout << prefix << "instruction set: " << Math::SIMD::InstructionSet << "\n\n";
+}
+
+TEST(PixelFactoryProcessorBenchmark, image4K)
+{
+	runProcessorBenchmark("3840x2160", 3840, 2160, ChannelMode::RGB);
+	runProcessorBenchmark("3840x2160", 3840, 2160, ChannelMode::RGBA);
+}
+
+TEST(PixelFactoryProcessorBenchmark, image8K)
+{
+	runProcessorBenchmark("7680x4320", 7680, 4320, ChannelMode::RGB);
+	runProcessorBenchmark("7680x4320", 7680, 4320, ChannelMode::RGBA);
+}
@@ -0,0 +1,254 @@
+/*
+ * src/Testing/bench_VertexFactoryFileFormatOBJ.cpp
+ * This file is part of Emeraude-Engine
+ *
+ * Copyright (C) 2010-2025 - Sébastien Léon Claude Christian Bémelmans "LondNoir" <londnoir@gmail.com>
+ *
+ * Emeraude-Engine is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * Emeraude-Engine is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with Emeraude-Engine; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * Complete project and additional information can be found at :
+ * https://github.com/londnoir/emeraude-engine
+ *
+ * --- THIS IS AUTOMATICALLY GENERATED, DO NOT CHANGE ---
+ */
+
+#include <gtest/gtest.h>
+
+/* STL inclusions. */
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
+
+/* Local inclusions. */
+#include "Libs/IO/IO.hpp"
+#include "Libs/IO/MappedFile.hpp"
+#include "Libs/ThreadPool.hpp"
+#include "Libs/Time/Elapsed/PrintScopeRealTime.hpp"
+#include "Libs/VertexFactory/FileFormatOBJ.hpp"
+
+using namespace EmEn::Libs;
+using namespace EmEn::Libs::Math;
+using namespace EmEn::Libs::Time::Elapsed;
+using namespace EmEn::Libs::VertexFactory;
+
+/* NOTE: 1024 x 1024 quads, 2 097 152 triangles. */
+constexpr auto GridSize{1024U};
+
+/**
+ * @brief Writes a grid OBJ file with positions, texture coordinates and normals.
+ * @param filepath A reference to a filesystem path.
+ * @return void
+ */
+void
+writeGridOBJ (const std::filesystem::path & filepath) noexcept
+{
+	std::ofstream file{filepath, std::ios::binary};
+
+	file << "g Grid" "\n";
+
+	for ( uint32_t y = 0; y <= GridSize; ++y )
+	{
+		for ( uint32_t x = 0; x <= GridSize; ++x )
+		{
+			file << "v " << static_cast< float >(x) * 0.125F << ' ' << static_cast< float >(y) * 0.125F << " 0.0" "\n";
+			file << "vt " << static_cast< float >(x) / GridSize << ' ' << static_cast< float >(y) / GridSize << "\n";
+		}
+	}
+
+	file << "vn 0.0 0.0 1.0" "\n";
+
+	for ( uint32_t y = 0; y < GridSize; ++y )
+	{
+		for ( uint32_t x = 0; x < GridSize; ++x )
+		{
+			const auto a = y * (GridSize + 1) + x + 1;
+			const auto b = a + 1;
+			const auto c = a + GridSize + 2;
+			const auto d = a + GridSize + 1;
+
+			file << "f " << a << '/' << a << "/1 " << b << '/' << b << "/1 " << c << '/' << c << "/1" "\n";
+			file << "f " << a << '/' << a << "/1 " << c << '/' << c << "/1 " << d << '/' << d << "/1" "\n";
+		}
+	}
+}
+
+/**
+ * @brief Reads an OBJ file the way the stream reader did: a counting pass, then std::getline() and sscanf() for every line.
+ * @note Only the "v/vt/vn" triangle faces are handled, as in the grid file.
+ * @param filepath A reference to a filesystem path.
+ * @param shape A reference to the shape.
+ * @return bool
+ */
+bool
+readOBJWithStream (const std::filesystem::path & filepath, Shape< float, uint32_t > & shape) noexcept
+{
+	std::ifstream file{filepath};
+
+	if ( !file.is_open() )
+	{
+		return false;
+	}
+
+	std::string line;
+	size_t positionCount = 0;
+	size_t faceCount = 0;
+
+	while ( std::getline(file, line) )
+	{
+		if ( line.starts_with("v ") )
+		{
+			++positionCount;
+		}
+		else if ( line.starts_with("f ") )
+		{
+			++faceCount;
+		}
+	}
+
+	file.clear();
+	file.seekg(0);
+
+	std::vector< Vector< 3, float > > positions;
+	std::vector< Vector< 3, float > > textureCoordinates;
+	std::vector< Vector< 3, float > > normals;
+	positions.reserve(positionCount);
+
+	return shape.build([&] (std::vector< std::pair< uint32_t, uint32_t > > & groups, std::vector< ShapeVertex< float > > & vertices, std::vector< ShapeTriangle< float, uint32_t > > & triangles) {
+		vertices.resize(positionCount);
+		triangles.reserve(faceCount);
+
+		std::set< uint32_t > writtenIndexes;
+
+		while ( std::getline(file, line) )
+		{
+			float x = 0.0F;
+			float y = 0.0F;
+			float z = 0.0F;
+
+			if ( line.starts_with("v ") )
+			{
+				sscanf(line.c_str(), "v %f %f %f", &x, &y, &z);
+
+				positions.emplace_back(x, y, z);
+			}
+			else if ( line.starts_with("vt ") )
+			{
+				sscanf(line.c_str(), "vt %f %f", &x, &y);
+
+				textureCoordinates.emplace_back(x, y, 0.0F);
+			}
+			else if ( line.starts_with("vn ") )
+			{
+				sscanf(line.c_str(), "vn %f %f %f", &x, &y, &z);
+
+				normals.emplace_back(x, y, z);
+			}
+			else if ( line.starts_with("f ") )
+			{
+				std::array< uint32_t, 9 > indices{};
+
+				sscanf(line.c_str(), "f %u/%u/%u %u/%u/%u %u/%u/%u",
+					&indices[0], &indices[1], &indices[2],
+					&indices[3], &indices[4], &indices[5],
+					&indices[6], &indices[7], &indices[8]
+				);
+
+				ShapeTriangle< float, uint32_t > triangle;
+
+				for ( uint32_t corner = 0; corner < 3; ++corner )
+				{
+					const auto vIndex = indices[corner * 3] - 1;
+
+					if ( !writtenIndexes.contains(vIndex) )
+					{
+						auto & vertex = vertices.at(vIndex);
+						vertex.setPosition(positions.at(vIndex));
+						vertex.setTextureCoordinates(textureCoordinates.at(indices[corner * 3 + 1] - 1));
+						vertex.setNormal(normals.at(indices[corner * 3 + 2] - 1));
+
+						writtenIndexes.emplace(vIndex);
+					}
+
+					triangle.setVertexIndex(corner, vIndex);
+				}
+
+				triangles.emplace_back(triangle);
+
+				++groups.back().second;
+			}
+		}
+
+		return true;
+	}, true, false);
+}
+
+TEST(VertexFactoryFileFormatOBJBenchmark, gridReading2M)
+{
+	const auto filepath = std::filesystem::temp_directory_path() / "emeraude_bench_grid.obj";
+
+	writeGridOBJ(filepath);
+
+	const auto megabytes = static_cast< double >(IO::filesize(filepath)) / (1024.0 * 1024.0);
+
+	std::cout << "OBJ file size: " << megabytes << " MiB" "\n";
+
+	Shape< float, uint32_t > streamShape;
+	Shape< float, uint32_t > mappedShape;
+	Shape< float, uint32_t > sequentialShape;
+
+	{
+		PrintScopeRealTime stat{"Stream reader (getline + sscanf)"};
+
+		ASSERT_TRUE(readOBJWithStream(filepath, streamShape));
+	}
+
+	{
+		PrintScopeRealTime stat{"FileFormatOBJ (mapped, 1 thread)"};
+
+		IO::MappedFile file;
+		FileFormatOBJ< float, uint32_t > fileFormat;
+
+		ASSERT_TRUE(file.open(filepath));
+		ASSERT_TRUE(fileFormat.readContent(file.view(), sequentialShape, {}));
+	}
+
+	{
+		ThreadPool threadPool{std::max< size_t >(1, std::thread::hardware_concurrency()) - 1};
+
+		ThreadPool::setShared(&threadPool);
+
+		PrintScopeRealTime stat{"FileFormatOBJ (mapped, all threads)"};
+
+		FileFormatOBJ< float, uint32_t > fileFormat;
+
+		ASSERT_TRUE(fileFormat.readFile(filepath, mappedShape, {}));
+
+		ThreadPool::setShared(nullptr);
+	}
+
+	EXPECT_EQ(mappedShape.triangles().size(), streamShape.triangles().size());
+	EXPECT_EQ(mappedShape.vertices().size(), streamShape.vertices().size());
+	EXPECT_EQ(sequentialShape.triangles().size(), mappedShape.triangles().size());
+
+	std::filesystem::remove(filepath);
+}
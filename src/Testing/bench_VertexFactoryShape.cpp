@@ -0,0 +1,189 @@
+/*
+ * src/Testing/bench_VertexFactoryShape.cpp
+ * This file is part of Emeraude-Engine
+ *
+ * Copyright (C) 2010-2025 - Sébastien Léon Claude Christian Bémelmans "LondNoir" <londnoir@gmail.com>
+ *
+ * Emeraude-Engine is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * Emeraude-Engine is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with Emeraude-Engine; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * Complete project and additional information can be found at :
+ * https://github.com/londnoir/emeraude-engine
+ *
+ * --- THIS IS AUTOMATICALLY GENERATED, DO NOT CHANGE ---
+ */
+
+#include <gtest/gtest.h>
+
+/* STL inclusions. */
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <vector>
+
+/* Local inclusions. */
+#include "Libs/Randomizer.hpp"
+#include "Libs/Time/Elapsed/PrintScopeRealTime.hpp"
+#include "Libs/VertexFactory/Shape.hpp"
+
+using namespace EmEn::Libs;
+using namespace EmEn::Libs::Math;
+using namespace EmEn::Libs::Time::Elapsed;
+using namespace EmEn::Libs::VertexFactory;
+
+/* NOTE: 1024 x 512 quads, 1 048 576 triangles. */
+constexpr auto GridWidth{1024U};
+constexpr auto GridHeight{512U};
+
+/**
+ * @brief Builds a grid as a triangle soup (scanner-like output), with or without data economy.
+ * @param dataEconomy Uses Shape::addVertex() to share vertices while building.
+ * @param jitter A random offset applied to every vertex position.
+ * @return Shape< float, uint32_t >
+ */
+Shape< float, uint32_t >
+createGrid (bool dataEconomy, float jitter) noexcept
+{
+	Randomizer< float > randomizer{1337};
+
+	Shape< float, uint32_t > shape{GridWidth * GridHeight * 2};
+
+	const auto addVertex = [&] (uint32_t x, uint32_t y) {
+		const Vector< 3, float > position{
+			static_cast< float >(x) + randomizer.value(-jitter, jitter),
+			static_cast< float >(y) + randomizer.value(-jitter, jitter),
+			0.0F
+		};
+		const Vector< 3, float > textureCoordinates{static_cast< float >(x) / GridWidth, static_cast< float >(y) / GridHeight, 0.0F};
+
+		if ( dataEconomy )
+		{
+			return shape.addVertex(position, Vector< 3, float >::positiveZ(), textureCoordinates);
+		}
+
+		return shape.saveVertex(position, Vector< 3, float >::positiveZ(), textureCoordinates);
+	};
+
+	for ( uint32_t y = 0; y < GridHeight; ++y )
+	{
+		for ( uint32_t x = 0; x < GridWidth; ++x )
+		{
+			ShapeTriangle< float > triangleA{addVertex(x, y), addVertex(x + 1, y), addVertex(x + 1, y + 1)};
+			ShapeTriangle< float > triangleB{addVertex(x, y), addVertex(x + 1, y + 1), addVertex(x, y + 1)};
+
+			shape.addTriangle(triangleA);
+			shape.addTriangle(triangleB);
+		}
+	}
+
+	return shape;
+}
+
+TEST(VertexFactoryShapeBenchmark, dataEconomy1M)
+{
+	Shape< float, uint32_t > shape;
+
+	{
+		PrintScopeRealTime stat{"Shape build with addVertex() x" + std::to_string(GridWidth * GridHeight * 2)};
+
+		shape = createGrid(true, 0.0F);
+	}
+
+	ASSERT_EQ(shape.vertexCount(), (GridWidth + 1) * (GridHeight + 1));
+}
+
+TEST(VertexFactoryShapeBenchmark, removeDuplicateVertices1M)
+{
+	auto shape = createGrid(false, 0.0F);
+
+	{
+		PrintScopeRealTime stat{"Shape::removeDuplicateVertices() x" + std::to_string(shape.triangles().size())};
+
+		shape.removeDuplicateVertices();
+	}
+
+	ASSERT_EQ(shape.vertexCount(), (GridWidth + 1) * (GridHeight + 1));
+}
+
+TEST(VertexFactoryShapeBenchmark, removeDoubleVertices1M)
+{
+	auto shape = createGrid(false, 0.0001F);
+
+	{
+		PrintScopeRealTime stat{"Shape::removeDoubleVertices() x" + std::to_string(shape.triangles().size())};
+
+		shape.removeDoubleVertices(0.001F);
+	}
+
+	std::cout << "Welded vertices : " << shape.vertexCount() << " / " << (GridWidth + 1) * (GridHeight + 1) << "\n";
+
+	ASSERT_GE(shape.vertexCount(), (GridWidth + 1) * (GridHeight + 1));
+	ASSERT_EQ(shape.triangles().size(), GridWidth * GridHeight * 2);
+}
+
+TEST(VertexFactoryShapeBenchmark, createIndexedVertexBuffer1M)
+{
+	auto shape = createGrid(false, 0.0F);
+
+	shape.removeDuplicateVertices();
+
+	std::vector< float > vertexBuffer;
+	std::vector< uint32_t > indexBuffer;
+
+	{
+		PrintScopeRealTime stat{"Shape::createIndexedVertexBuffer() x" + std::to_string(shape.triangles().size())};
+
+		shape.createIndexedVertexBuffer(vertexBuffer, indexBuffer, NormalType::Normal, TextureCoordinatesType::UV);
+	}
+
+	ASSERT_EQ(indexBuffer.size(), GridWidth * GridHeight * 6);
+}
+
+TEST(VertexFactoryShapeBenchmark, optimizeForRendering1M)
+{
+	auto shape = createGrid(false, 0.0F);
+
+	shape.removeDuplicateVertices();
+
+	const auto before = shape.vertexCacheStatistics();
+
+	{
+		PrintScopeRealTime stat{"Shape::optimizeVertexCache() x" + std::to_string(shape.triangles().size())};
+
+		shape.optimizeVertexCache();
+	}
+
+	const auto optimized = shape.vertexCacheStatistics();
+
+	{
+		PrintScopeRealTime stat{"Shape::optimizeOverdraw() x" + std::to_string(shape.triangles().size())};
+
+		shape.optimizeOverdraw();
+	}
+
+	const auto sorted = shape.vertexCacheStatistics();
+
+	{
+		PrintScopeRealTime stat{"Shape::optimizeVertexFetch() x" + std::to_string(shape.triangles().size())};
+
+		shape.optimizeVertexFetch();
+	}
+
+	std::cout <<
+		"ACMR : " << before.ACMR << " -> " << optimized.ACMR << " (overdraw sorted " << sorted.ACMR << ")\n"
+		"ATVR : " << before.ATVR << " -> " << optimized.ATVR << " (overdraw sorted " << sorted.ATVR << ")\n";
+
+	ASSERT_LT(optimized.ACMR, before.ACMR);
+	ASSERT_EQ(shape.triangles().size(), GridWidth * GridHeight * 2);
+}
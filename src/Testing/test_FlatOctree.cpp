@@ -0,0 +1,424 @@
+/*
+ * src/Testing/test_FlatOctree.cpp
+ * This file is part of Emeraude-Engine
+ *
+ * Copyright (C) 2010-2025 - Sébastien Léon Claude Christian Bémelmans "LondNoir" <londnoir@gmail.com>
+ *
+ * Emeraude-Engine is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * Emeraude-Engine is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with Emeraude-Engine; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * Complete project and additional information can be found at :
+ * https://github.com/londnoir/emeraude-engine
+ *
+ * --- THIS IS AUTOMATICALLY GENERATED, DO NOT CHANGE ---
+ */
+
+
+#include <gtest/gtest.h>
+
+/* STL inclusions. */
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+
+/* Local inclusions. */
+#include "Libs/NameableTrait.hpp"
+#include "Libs/Randomizer.hpp"
+#include "Scenes/LocatableInterface.hpp"
+#include "Scenes/OctreeSector.hpp"
+#include "Scenes/FlatOctree.hpp"
+
+using namespace EmEn::Libs;
+using namespace EmEn::Libs::Math;
+using namespace EmEn::Scenes;
+
+/**
+ * @brief Minimal locatable element, only holding a world position and a bounding radius.
+ */
+class OctreeElement final : public NameableTrait, public LocatableInterface
+{
+	public:
+
+		OctreeElement (std::string name, const Vector< 3, float > & position, float radius) noexcept
+			: NameableTrait(std::move(name)), m_coordinates(position), m_localBoundingBox(radius), m_localBoundingSphere(radius)
+		{
+
+		}
+
+		void setPosition (const Vector< 3, float > & position, TransformSpace) noexcept override { m_coordinates.setPosition(position); }
+		void setXPosition (float position, TransformSpace) noexcept override { m_coordinates.setXPosition(position); }
+		void setYPosition (float position, TransformSpace) noexcept override { m_coordinates.setYPosition(position); }
+		void setZPosition (float position, TransformSpace) noexcept override { m_coordinates.setZPosition(position); }
+		void move (const Vector< 3, float > & distance, TransformSpace) noexcept override { m_coordinates.translate(distance, false); }
+		void moveX (float distance, TransformSpace) noexcept override { m_coordinates.translateX(distance, false); }
+		void moveY (float distance, TransformSpace) noexcept override { m_coordinates.translateY(distance, false); }
+		void moveZ (float distance, TransformSpace) noexcept override { m_coordinates.translateZ(distance, false); }
+		void rotate (float, const Vector< 3, float > &, TransformSpace) noexcept override { }
+		void pitch (float, TransformSpace) noexcept override { }
+		void yaw (float, TransformSpace) noexcept override { }
+		void roll (float, TransformSpace) noexcept override { }
+		void scale (const Vector< 3, float > &, TransformSpace) noexcept override { }
+		void scale (float, TransformSpace) noexcept override { }
+		void scaleX (float, TransformSpace) noexcept override { }
+		void scaleY (float, TransformSpace) noexcept override { }
+		void scaleZ (float, TransformSpace) noexcept override { }
+		void lookAt (const Vector< 3, float > &, bool) noexcept override { }
+		void setLocalCoordinates (const CartesianFrame< float > & coordinates) noexcept override { m_coordinates = coordinates; }
+		[[nodiscard]] const CartesianFrame< float > & localCoordinates () const noexcept override { return m_coordinates; }
+		[[nodiscard]] CartesianFrame< float > & localCoordinates () noexcept override { return m_coordinates; }
+		[[nodiscard]] CartesianFrame< float > getWorldCoordinates () const noexcept override { return m_coordinates; }
+		[[nodiscard]] const Space3D::AACuboid< float > & localBoundingBox () const noexcept override { return m_localBoundingBox; }
+
+		[[nodiscard]]
+		Space3D::AACuboid< float >
+		getWorldBoundingBox () const noexcept override
+		{
+			const auto & position = m_coordinates.position();
+
+			return {m_localBoundingBox.maximum() + position, m_localBoundingBox.minimum() + position};
+		}
+
+		[[nodiscard]] const Space3D::Sphere< float > & localBoundingSphere () const noexcept override { return m_localBoundingSphere; }
+
+		[[nodiscard]]
+		Space3D::Sphere< float >
+		getWorldBoundingSphere () const noexcept override
+		{
+			return {m_localBoundingSphere.radius(), m_coordinates.position()};
+		}
+
+		void enableSphereCollision (bool state) noexcept override { m_sphereCollision = state; }
+		[[nodiscard]] bool sphereCollisionIsEnabled () const noexcept override { return m_sphereCollision; }
+
+	private:
+
+		CartesianFrame< float > m_coordinates;
+		Space3D::AACuboid< float > m_localBoundingBox;
+		Space3D::Sphere< float > m_localBoundingSphere;
+		bool m_sphereCollision{true};
+};
+
+/* NOTE: A leaf is identified by its bounds, the content by the element names. */
+using SectorBounds = std::array< float, 6 >;
+using LeafContents = std::map< SectorBounds, std::set< std::string > >;
+
+constexpr auto Boundary{256.0F};
+constexpr auto MaxRadius{6.0F};
+constexpr auto MaxStep{24.0F};
+constexpr auto ElementCount{600UL};
+constexpr auto RoundCount{12UL};
+constexpr auto QueryCount{64UL};
+constexpr auto MaxDepth{4UL};
+
+/**
+ * @brief Adds a sector and its element names to the leaf contents.
+ * @tparam sector_t The type of sector.
+ * @param sector A reference to the sector.
+ * @param contents A reference to the leaf contents.
+ * @return void
+ */
+template< typename sector_t >
+void
+addSector (const sector_t & sector, LeafContents & contents) noexcept
+{
+	const SectorBounds bounds{
+		sector.minimum(X), sector.minimum(Y), sector.minimum(Z),
+		sector.maximum(X), sector.maximum(Y), sector.maximum(Z)
+	};
+
+	/* NOTE: A sector must be visited only once. */
+	ASSERT_FALSE(contents.contains(bounds));
+
+	auto & names = contents[bounds];
+
+	for ( const auto & element : sector.elements() )
+	{
+		names.emplace(element->name());
+	}
+}
+
+/**
+ * @brief Returns the content of every non-empty leaf of an octree.
+ * @tparam octree_t The type of octree.
+ * @param octree A reference to the octree.
+ * @return LeafContents
+ */
+template< typename octree_t >
+LeafContents
+getLeafContents (const octree_t & octree) noexcept
+{
+	LeafContents contents;
+
+	octree.forEachLeafSector([&contents] (const auto & sector) {
+		addSector(sector, contents);
+	});
+
+	return contents;
+}
+
+/**
+ * @brief Returns the content of every leaf touched by a primitive.
+ * @tparam octree_t The type of octree.
+ * @tparam primitive_t The type of primitive.
+ * @param octree A reference to the octree.
+ * @param primitive A reference to the primitive.
+ * @return LeafContents
+ */
+template< typename octree_t, typename primitive_t >
+LeafContents
+getTouchedContents (const octree_t & octree, const primitive_t & primitive) noexcept
+{
+	LeafContents contents;
+
+	octree.forTouchedSector(primitive, [&contents] (const auto & sector) {
+		addSector(sector, contents);
+	});
+
+	return contents;
+}
+
+/**
+ * @brief Returns a random position keeping a margin to the root sector limits.
+ * @param randomizer A reference to the randomizer.
+ * @return Vector< 3, float >
+ */
+Vector< 3, float >
+getRandomPosition (Randomizer< float > & randomizer) noexcept
+{
+	constexpr auto Limit{Boundary - MaxRadius - MaxStep};
+
+	return {randomizer.value(-Limit, Limit), randomizer.value(-Limit, Limit), randomizer.value(-Limit, Limit)};
+}
+
+/**
+ * @brief Checks both octrees hold the same leaves and give the same answers to queries.
+ * @tparam enable_volume Enable the use of the element volume instead of their position.
+ * @param reference A reference to the pointer based octree.
+ * @param flat A reference to the flat octree.
+ * @param randomizer A reference to the randomizer.
+ * @return void
+ */
+template< bool enable_volume >
+void
+compareOctrees (const OctreeSector< OctreeElement, enable_volume > & reference, const FlatOctree< OctreeElement, enable_volume > & flat, Randomizer< float > & randomizer) noexcept
+{
+	ASSERT_EQ(flat.elementCount(), reference.elementCount());
+	ASSERT_EQ(flat.getDepth(), reference.getDepth());
+	ASSERT_EQ(getLeafContents(flat), getLeafContents(reference));
+
+	for ( size_t query = 0; query < QueryCount; query++ )
+	{
+		const auto position = getRandomPosition(randomizer);
+		const auto size = randomizer.value(1.0F, Boundary * 0.25F);
+
+		const Space3D::Sphere< float > sphere{size, position};
+		const Space3D::AACuboid< float > box{position + size, position - size};
+
+		ASSERT_EQ(getTouchedContents(flat, position), getTouchedContents(reference, position));
+		ASSERT_EQ(getTouchedContents(flat, sphere), getTouchedContents(reference, sphere));
+		ASSERT_EQ(getTouchedContents(flat, box), getTouchedContents(reference, box));
+	}
+}
+
+/**
+ * @brief Runs the same random insert, update and erase sequence on both octrees.
+ * @tparam enable_volume Enable the use of the element volume instead of their position.
+ * @param enableAutoCollapse Enable the automatic sector collapse.
+ * @param seed The randomizer seed.
+ * @return void
+ */
+template< bool enable_volume >
+void
+runSideBySide (bool enableAutoCollapse, uint32_t seed) noexcept
+{
+	const Vector< 3, float > maximum{Boundary, Boundary, Boundary};
+	const Vector< 3, float > minimum{-Boundary, -Boundary, -Boundary};
+
+	const auto reference = std::make_shared< OctreeSector< OctreeElement, enable_volume > >(maximum, minimum, 8, enableAutoCollapse);
+	FlatOctree< OctreeElement, enable_volume > flat{maximum, minimum, 8, enableAutoCollapse};
+
+	Randomizer< float > randomizer{seed};
+
+	std::vector< std::shared_ptr< OctreeElement > > elements;
+	elements.reserve(ElementCount);
+
+	for ( size_t index = 0; index < ElementCount; index++ )
+	{
+		auto element = std::make_shared< OctreeElement >("element" + std::to_string(index), getRandomPosition(randomizer), randomizer.value(0.5F, MaxRadius));
+		element->enableSphereCollision(index % 2 == 0);
+
+		ASSERT_TRUE(reference->insert(element));
+		ASSERT_TRUE(flat.insert(element));
+
+		elements.emplace_back(std::move(element));
+	}
+
+	compareOctrees(*reference, flat, randomizer);
+
+	std::vector< std::shared_ptr< OctreeElement > > erased;
+
+	for ( size_t round = 0; round < RoundCount; round++ )
+	{
+		/* NOTE: Small steps keep most elements in their sector, teleports cross the whole tree. */
+		for ( const auto & element : elements )
+		{
+			if ( randomizer.value(0.0F, 1.0F) < 0.1F )
+			{
+				element->setPosition(getRandomPosition(randomizer), TransformSpace::World);
+			}
+			else
+			{
+				element->move({randomizer.value(-MaxStep, MaxStep), randomizer.value(-MaxStep, MaxStep), randomizer.value(-MaxStep, MaxStep)}, TransformSpace::World);
+
+				/* NOTE: Keeps the element inside the root sector. */
+				if ( !Space3D::isColliding(Space3D::AACuboid< float >{maximum - (MaxRadius + MaxStep), minimum + (MaxRadius + MaxStep)}, element->getWorldCoordinates().position()) )
+				{
+					element->setPosition(getRandomPosition(randomizer), TransformSpace::World);
+				}
+			}
+
+			ASSERT_TRUE(reference->update(element));
+			ASSERT_TRUE(flat.update(element));
+		}
+
+		compareOctrees(*reference, flat, randomizer);
+
+		/* NOTE: Alternates heavy removal rounds, to collapse sectors, and reinsertion rounds. */
+		if ( round % 2 == 0 )
+		{
+			std::erase_if(elements, [&] (const auto & element) {
+				if ( randomizer.value(0.0F, 1.0F) < 0.75F )
+				{
+					return false;
+				}
+
+				EXPECT_TRUE(reference->erase(element));
+				EXPECT_TRUE(flat.erase(element));
+
+				erased.emplace_back(element);
+
+				return true;
+			});
+		}
+		else
+		{
+			for ( auto & element : erased )
+			{
+				element->setPosition(getRandomPosition(randomizer), TransformSpace::World);
+
+				ASSERT_TRUE(reference->insert(element));
+				ASSERT_TRUE(flat.insert(element));
+
+				elements.emplace_back(std::move(element));
+			}
+
+			erased.clear();
+		}
+
+		compareOctrees(*reference, flat, randomizer);
+	}
+
+	for ( const auto & element : elements )
+	{
+		ASSERT_TRUE(reference->erase(element));
+		ASSERT_TRUE(flat.erase(element));
+	}
+
+	ASSERT_EQ(flat.elementCount(), 0);
+	ASSERT_TRUE(getLeafContents(flat).empty());
+
+	if ( enableAutoCollapse )
+	{
+		ASSERT_EQ(flat.getDepth(), 0);
+		ASSERT_EQ(flat.getSectorCount(), 1);
+	}
+}
+
+TEST(FlatOctree, positionsMatchOctreeSector)
+{
+	runSideBySide< false >(false, 1337);
+	runSideBySide< false >(false, 42);
+}
+
+TEST(FlatOctree, positionsMatchOctreeSectorWithAutoCollapse)
+{
+	runSideBySide< false >(true, 1337);
+	runSideBySide< false >(true, 42);
+}
+
+TEST(FlatOctree, volumesMatchOctreeSector)
+{
+	runSideBySide< true >(false, 1337);
+	runSideBySide< true >(false, 42);
+}
+
+TEST(FlatOctree, maxDepth)
+{
+	FlatOctree< OctreeElement, false > flat{{Boundary, Boundary, Boundary}, {-Boundary, -Boundary, -Boundary}, 8, true, MaxDepth};
+
+	/* NOTE: Elements at the same place can't be separated, the split must stop at the depth limit. */
+	std::vector< std::shared_ptr< OctreeElement > > elements;
+
+	for ( size_t index = 0; index < 32; index++ )
+	{
+		elements.emplace_back(std::make_shared< OctreeElement >("element" + std::to_string(index), Vector< 3, float >{10.0F, 20.0F, 30.0F}, 1.0F));
+
+		ASSERT_TRUE(flat.insert(elements.back()));
+	}
+
+	ASSERT_EQ(flat.getDepth(), MaxDepth);
+
+	const auto contents = getLeafContents(flat);
+
+	ASSERT_EQ(contents.size(), 1);
+	ASSERT_EQ(contents.begin()->second.size(), elements.size());
+
+	size_t touched = 0;
+
+	flat.forTouchedSector(Vector< 3, float >{10.0F, 20.0F, 30.0F}, [&touched] (const auto & sector) {
+		ASSERT_EQ(sector.getDistance(), MaxDepth);
+
+		touched += sector.elementCount();
+	});
+
+	ASSERT_EQ(touched, elements.size());
+
+	/* NOTE: Moving half of them away splits the tree elsewhere without going deeper. */
+	Randomizer< float > randomizer{7};
+
+	for ( size_t index = 0; index < elements.size(); index += 2 )
+	{
+		elements[index]->setPosition(getRandomPosition(randomizer), TransformSpace::World);
+
+		ASSERT_TRUE(flat.update(elements[index]));
+	}
+
+	ASSERT_LE(flat.getDepth(), MaxDepth);
+	ASSERT_EQ(flat.elementCount(), elements.size());
+
+	/* NOTE: The auto-collapse brings the tree back to the root sector. */
+	for ( const auto & element : elements )
+	{
+		ASSERT_TRUE(flat.erase(element));
+	}
+
+	ASSERT_EQ(flat.getDepth(), 0);
+	ASSERT_EQ(flat.getSectorCount(), 1);
+}
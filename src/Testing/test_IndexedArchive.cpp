@@ -0,0 +1,196 @@
+/*
+ * src/Testing/test_IndexedArchive.cpp
+ * This file is part of Emeraude-Engine
+ *
+ * Copyright (C) 2010-2025 - Sébastien Léon Claude Christian Bémelmans "LondNoir" <londnoir@gmail.com>
+ *
+ * Emeraude-Engine is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * Emeraude-Engine is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with Emeraude-Engine; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * Complete project and additional information can be found at :
+ * https://github.com/londnoir/emeraude-engine
+ *
+ * --- THIS IS AUTOMATICALLY GENERATED, DO NOT CHANGE ---
+ */
+
+#include <gtest/gtest.h>
+
+/* STL inclusions. */
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <vector>
+
+/* Local inclusions. */
+#include "Libs/IO/IndexedArchive.hpp"
+#include "Constants.hpp"
+
+using namespace EmEn::Libs;
+
+/**
+ * @brief Creates a deterministic entry.
+ * @param count The number of words.
+ * @param seed A value changing the content.
+ * @return std::vector< uint32_t >
+ */
+std::vector< uint32_t >
+createArchiveEntry (size_t count, uint32_t seed) noexcept
+{
+	std::vector< uint32_t > data(count);
+
+	for ( size_t index = 0; index < count; index++ )
+	{
+		data[index] = static_cast< uint32_t >(index) * 2654435761U + seed;
+	}
+
+	return data;
+}
+
+TEST(IndexedArchive, writeAndReopen)
+{
+	const auto filepath = testOutputPath("archive_reopen.emarc");
+
+	{
+		IO::IndexedArchive archive;
+
+		ASSERT_FALSE(archive.open(filepath));
+
+		for ( uint32_t key = 0; key < 50; key++ )
+		{
+			archive.put(key * 7919, createArchiveEntry(key + 1, key));
+		}
+
+		ASSERT_TRUE(archive.hasPendingEntries());
+		ASSERT_TRUE(archive.write());
+		ASSERT_FALSE(archive.hasPendingEntries());
+		ASSERT_EQ(archive.entryCount(), 50);
+	}
+
+	IO::IndexedArchive archive;
+
+	ASSERT_TRUE(archive.open(filepath));
+	ASSERT_EQ(archive.entryCount(), 50);
+	ASSERT_FALSE(archive.contains(1));
+
+	for ( uint32_t key = 0; key < 50; key++ )
+	{
+		std::vector< uint32_t > data;
+
+		ASSERT_TRUE(archive.get(key * 7919, data));
+		ASSERT_EQ(data, createArchiveEntry(key + 1, key));
+	}
+
+	std::filesystem::remove(filepath);
+}
+
+TEST(IndexedArchive, pendingEntriesReplaceWrittenOnes)
+{
+	const auto filepath = testOutputPath("archive_replace.emarc");
+
+	IO::IndexedArchive archive;
+	archive.open(filepath);
+	archive.put(1, createArchiveEntry(10, 1));
+	archive.put(2, createArchiveEntry(20, 2));
+
+	ASSERT_TRUE(archive.write());
+
+	archive.put(2, createArchiveEntry(5, 99));
+	archive.put(3, createArchiveEntry(30, 3));
+
+	ASSERT_EQ(archive.entryCount(), 3);
+
+	std::vector< uint32_t > data;
+
+	ASSERT_TRUE(archive.get(2, data));
+	ASSERT_EQ(data, createArchiveEntry(5, 99));
+
+	ASSERT_TRUE(archive.write());
+	ASSERT_TRUE(archive.open(filepath));
+	ASSERT_EQ(archive.entryCount(), 3);
+
+	ASSERT_TRUE(archive.get(1, data));
+	ASSERT_EQ(data, createArchiveEntry(10, 1));
+	ASSERT_TRUE(archive.get(2, data));
+	ASSERT_EQ(data, createArchiveEntry(5, 99));
+	ASSERT_TRUE(archive.get(3, data));
+	ASSERT_EQ(data, createArchiveEntry(30, 3));
+
+	archive.clear();
+
+	ASSERT_EQ(archive.entryCount(), 0);
+	ASSERT_FALSE(std::filesystem::exists(filepath));
+}
+
+TEST(IndexedArchive, corruptedEntryIsMissing)
+{
+	const auto filepath = testOutputPath("archive_corrupted.emarc");
+
+	{
+		IO::IndexedArchive archive;
+		archive.open(filepath);
+		archive.put(42, createArchiveEntry(64, 42));
+
+		ASSERT_TRUE(archive.write());
+	}
+
+	/* NOTE: Flip the last data byte, the index stays valid. */
+	const auto size = std::filesystem::file_size(filepath);
+
+	{
+		std::fstream file{filepath, std::ios::binary | std::ios::in | std::ios::out};
+		file.seekg(static_cast< std::streamoff >(size - 1));
+
+		char byte = 0;
+		file.read(&byte, 1);
+		byte = static_cast< char >(byte ^ 0x5A);
+
+		file.seekp(static_cast< std::streamoff >(size - 1));
+		file.write(&byte, 1);
+	}
+
+	IO::IndexedArchive archive;
+
+	ASSERT_TRUE(archive.open(filepath));
+	ASSERT_TRUE(archive.contains(42));
+
+	std::vector< uint32_t > data;
+
+	ASSERT_FALSE(archive.get(42, data));
+
+	std::filesystem::remove(filepath);
+}
+
+TEST(IndexedArchive, invalidFileIsIgnored)
+{
+	const auto filepath = testOutputPath("archive_invalid.emarc");
+
+	{
+		std::ofstream file{filepath, std::ios::binary};
+		file << "This is not an archive, but it is long enough to hold a header.";
+	}
+
+	IO::IndexedArchive archive;
+
+	ASSERT_FALSE(archive.open(filepath));
+	ASSERT_EQ(archive.entryCount(), 0);
+
+	/* NOTE: The archive is rebuilt over the invalid file. */
+	archive.put(7, createArchiveEntry(3, 7));
+
+	ASSERT_TRUE(archive.write());
+	ASSERT_TRUE(archive.open(filepath));
+	ASSERT_TRUE(archive.contains(7));
+
+	std::filesystem::remove(filepath);
+}
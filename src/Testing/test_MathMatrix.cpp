@@ -28,9 +28,11 @@
 
 /* STL inclusions. */
 #include <array>
+#include <vector>
 
 /* Local inclusions. */
 #include "Libs/Math/Matrix.hpp"
+#include "Libs/Math/Space3D/AACuboid.hpp"
 
 using namespace EmEn::Libs::Math;
 
@@ -360,3 +362,183 @@ TYPED_TEST(MathMatrix, DeterminantInverse4)
 		}
 	}
 }
+
+/**
+ * @brief Returns a non-trivial affine transformation for the 4x4 kernel tests.
+ * @tparam precision_t The data precision.
+ * @return Matrix< 4, precision_t >
+ */
+template< typename precision_t >
+Matrix< 4, precision_t >
+kernelMatrix () noexcept
+{
+	return Matrix< 4, precision_t >{
+		0.8, -0.36, 0.48, 12.5,
+		0.6, 0.48, -0.64, -3.25,
+		0.0, 0.8, 0.6, 7.0,
+		0.0, 0.0, 0.0, 1.0
+	} * Matrix< 4, precision_t >{
+		2.0, 0.0, 0.0, 0.0,
+		0.0, 0.5, 0.0, 0.0,
+		0.0, 0.0, 3.0, 0.0,
+		0.0, 0.0, 0.0, 1.0
+	};
+}
+
+TEST(MathMatrixSIMD, MultiplyTransposeInverse)
+{
+	const Matrix< 4, float > matrixA{std::array< float, 16 >{
+		-56.0F, 4.1F, 13.5F, 1.645F,
+		7.0F, 1.2F, 3.1F, -6.54F,
+		9.1F, 0.0F, -2.5F, 0.0F,
+		-4.0F, 7.58F, -52.2F, 3.54F
+	}};
+	const Matrix< 4, double > matrixB{std::array< double, 16 >{
+		-56.0F, 4.1F, 13.5F, 1.645F,
+		7.0F, 1.2F, 3.1F, -6.54F,
+		9.1F, 0.0F, -2.5F, 0.0F,
+		-4.0F, 7.58F, -52.2F, 3.54F
+	}};
+
+	const auto productA = matrixA * kernelMatrix< float >();
+	const auto productB = matrixB * kernelMatrix< double >();
+
+	auto transposedA = matrixA;
+	transposedA.transpose();
+	auto transposedB = matrixB;
+	transposedB.transpose();
+
+	const auto inverseA = matrixA.inverse();
+	const auto inverseB = matrixB.inverse();
+	const auto identityA = matrixA * inverseA;
+
+	for ( size_t i = 0; i < 16; ++i )
+	{
+		ASSERT_NEAR(productA[i], productB[i], 0.001);
+		ASSERT_EQ(transposedA[i], static_cast< float >(transposedB[i]));
+		ASSERT_NEAR(inverseA[i], inverseB[i], 0.0001);
+		ASSERT_NEAR(identityA[i], (i % 5 == 0) ? 1.0F : 0.0F, 0.0001F);
+	}
+
+	const Vector< 4, float > vectorA{1.5F, -2.0F, 0.25F, 1.0F};
+	const Vector< 4, double > vectorB{1.5, -2.0, 0.25, 1.0};
+
+	const auto resultA = matrixA * vectorA;
+	const auto resultB = matrixB * vectorB;
+
+	for ( size_t i = 0; i < 4; ++i )
+	{
+		ASSERT_NEAR(resultA[i], resultB[i], 0.001);
+	}
+
+	/* A singular matrix is returned unchanged. */
+	const Matrix< 4, float > singular{std::array< float, 16 >{
+		1.0F, 2.0F, 3.0F, 4.0F,
+		2.0F, 4.0F, 6.0F, 8.0F,
+		0.0F, 1.0F, 0.0F, 1.0F,
+		5.0F, 0.0F, 5.0F, 0.0F
+	}};
+
+	ASSERT_EQ(singular.inverse(), singular);
+}
+
+TEST(MathMatrixSIMD, TransformBatches)
+{
+	const auto matrixA = kernelMatrix< float >();
+	const auto matrixB = kernelMatrix< double >();
+
+	std::vector< Vector< 3, float > > pointsA;
+	std::vector< Vector< 3, double > > pointsB;
+
+	for ( size_t i = 0; i < 17; ++i )
+	{
+		const auto value = static_cast< float >(i) - 8.0F;
+
+		pointsA.emplace_back(value, value * 0.5F + 1.0F, -value * 2.0F);
+		pointsB.emplace_back(value, value * 0.5 + 1.0, -value * 2.0);
+	}
+
+	auto normalsA = pointsA;
+	auto normalsB = pointsB;
+
+	/* NOTE: Points are transformed in place, normals into a separate list. */
+	matrixA.transformPoints(pointsA, pointsA);
+	matrixB.transformPoints(pointsB, pointsB);
+
+	std::vector< Vector< 3, float > > transformedNormalsA(normalsA.size());
+	std::vector< Vector< 3, double > > transformedNormalsB(normalsB.size());
+
+	matrixA.transformNormals(normalsA, transformedNormalsA);
+	matrixB.transformNormals(normalsB, transformedNormalsB);
+
+	for ( size_t i = 0; i < pointsA.size(); ++i )
+	{
+		for ( size_t axis = 0; axis < 3; ++axis )
+		{
+			ASSERT_NEAR(pointsA[i][axis], pointsB[i][axis], 0.0001);
+			ASSERT_NEAR(transformedNormalsA[i][axis], transformedNormalsB[i][axis], 0.0001);
+		}
+	}
+
+	/* A transformed normal stays perpendicular to a transformed tangent. */
+	const Vector< 3, float > normal{0.0F, 0.0F, 1.0F};
+	const Vector< 3, float > tangent{1.0F, 1.0F, 0.0F};
+
+	Vector< 3, float > transformedNormal;
+	matrixA.transformNormals({&normal, 1}, {&transformedNormal, 1});
+
+	const auto transformedTangent = Vector< 3, float >{matrixA * Vector< 4, float >{tangent, 0.0F}};
+
+	const auto dotProduct = Vector< 3, float >::dotProduct(transformedNormal, transformedTangent);
+
+	ASSERT_NEAR(dotProduct, 0.0F, 0.0001F);
+	ASSERT_NEAR(transformedNormal.length(), 1.0F, 0.0001F);
+
+	std::vector< Space3D::AACuboid< float > > boxesA{
+		{{1.0F, 2.0F, 3.0F}, {-1.0F, -2.0F, -3.0F}},
+		{{10.0F, 0.5F, 4.0F}, {8.0F, -0.5F, 2.0F}},
+		{}
+	};
+	std::vector< Space3D::AACuboid< double > > boxesB{
+		{{1.0, 2.0, 3.0}, {-1.0, -2.0, -3.0}},
+		{{10.0, 0.5, 4.0}, {8.0, -0.5, 2.0}},
+		{}
+	};
+
+	Space3D::AACuboid< float >::transform(matrixA, boxesA, boxesA);
+	Space3D::AACuboid< double >::transform(matrixB, boxesB, boxesB);
+
+	for ( size_t i = 0; i < 2; ++i )
+	{
+		ASSERT_TRUE(boxesA[i].isValid());
+
+		for ( size_t axis = 0; axis < 3; ++axis )
+		{
+			ASSERT_NEAR(boxesA[i].minimum()[axis], boxesB[i].minimum()[axis], 0.0001);
+			ASSERT_NEAR(boxesA[i].maximum()[axis], boxesB[i].maximum()[axis], 0.0001);
+		}
+	}
+
+	ASSERT_FALSE(boxesA[2].isValid());
+
+	/* Every transformed corner lies inside the transformed box. */
+	const Space3D::AACuboid< float > box{{1.0F, 2.0F, 3.0F}, {-1.0F, -2.0F, -3.0F}};
+
+	for ( size_t corner = 0; corner < 8; ++corner )
+	{
+		const Vector< 4, float > point{
+			(corner & 1) != 0 ? 1.0F : -1.0F,
+			(corner & 2) != 0 ? 2.0F : -2.0F,
+			(corner & 4) != 0 ? 3.0F : -3.0F,
+			1.0F
+		};
+
+		const auto transformed = matrixA * point;
+
+		for ( size_t axis = 0; axis < 3; ++axis )
+		{
+			ASSERT_GE(transformed[axis], boxesA[0].minimum()[axis] - 0.0001F);
+			ASSERT_LE(transformed[axis], boxesA[0].maximum()[axis] + 0.0001F);
+		}
+	}
+}
@@ -0,0 +1,312 @@
+/*
+ * src/Testing/test_PixelFactoryBlockCompression.cpp
+ * This file is part of Emeraude-Engine
+ *
+ * Copyright (C) 2010-2025 - Sébastien Léon Claude Christian Bémelmans "LondNoir" <londnoir@gmail.com>
+ *
+ * Emeraude-Engine is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * Emeraude-Engine is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with Emeraude-Engine; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * Complete project and additional information can be found at :
+ * https://github.com/londnoir/emeraude-engine
+ *
+ * --- THIS IS AUTOMATICALLY GENERATED, DO NOT CHANGE ---
+ */
+
+#include <gtest/gtest.h>
+
+/* STL inclusions. */
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+/* Local inclusions. */
+#include "Libs/PixelFactory/BlockCompression.hpp"
+#include "Libs/ThreadPool.hpp"
+
+using namespace EmEn::Libs;
+using namespace EmEn::Libs::PixelFactory;
+
+/**
+ * @brief Creates a pixmap with smooth gradients and a few sharp edges.
+ * @param width The pixmap width.
+ * @param height The pixmap height.
+ * @param channelMode The channel mode.
+ * @return Pixmap< uint8_t >
+ */
+Pixmap< uint8_t >
+createPattern (uint32_t width, uint32_t height, ChannelMode channelMode) noexcept
+{
+	Pixmap< uint8_t > pixmap{width, height, channelMode};
+
+	for ( uint32_t coordY = 0; coordY < height; coordY++ )
+	{
+		for ( uint32_t coordX = 0; coordX < width; coordX++ )
+		{
+			auto * pixel = pixmap.pixelPointer(coordX, coordY);
+
+			for ( size_t channel = 0; channel < pixmap.colorCount(); channel++ )
+			{
+				const auto wave = std::sin(static_cast< float >(coordX) * 0.11F * static_cast< float >(channel + 1)) * std::cos(static_cast< float >(coordY) * 0.07F);
+				const auto edge = (coordX / 16 + coordY / 16) % 2 == 0 ? 40.0F : 0.0F;
+
+				pixel[channel] = static_cast< uint8_t >(std::lround(100.0F + 80.0F * wave + edge));
+			}
+		}
+	}
+
+	return pixmap;
+}
+
+/**
+ * @brief Returns the peak signal-to-noise ratio of some channels between two pixmaps.
+ * @param reference A reference to the original pixmap.
+ * @param decoded A reference to the decoded pixmap.
+ * @param channels The list of channel pairs, from the reference to the decoded pixmap.
+ * @return double
+ */
+double
+getPSNR (const Pixmap< uint8_t > & reference, const Pixmap< uint8_t > & decoded, const std::vector< std::pair< size_t, size_t > > & channels) noexcept
+{
+	double squaredError = 0.0;
+
+	for ( uint32_t coordY = 0; coordY < reference.height(); coordY++ )
+	{
+		for ( uint32_t coordX = 0; coordX < reference.width(); coordX++ )
+		{
+			for ( const auto & [referenceChannel, decodedChannel] : channels )
+			{
+				const auto difference = static_cast< double >(reference.pixelPointer(coordX, coordY)[referenceChannel]) - static_cast< double >(decoded.pixelPointer(coordX, coordY)[decodedChannel]);
+
+				squaredError += difference * difference;
+			}
+		}
+	}
+
+	const auto meanSquaredError = squaredError / static_cast< double >(reference.pixelCount() * channels.size());
+
+	if ( meanSquaredError <= 0.0 )
+	{
+		return 100.0;
+	}
+
+	return 10.0 * std::log10(255.0 * 255.0 / meanSquaredError);
+}
+
+TEST(PixelFactoryBlockCompression, sizes)
+{
+	ASSERT_EQ(getCompressedBytes(BlockFormat::BC1, 4, 4), 8);
+	ASSERT_EQ(getCompressedBytes(BlockFormat::BC3, 4, 4), 16);
+	ASSERT_EQ(getCompressedBytes(BlockFormat::BC1, 1, 1), 8);
+	ASSERT_EQ(getCompressedBytes(BlockFormat::BC7, 13, 7), 4 * 2 * 16);
+	ASSERT_EQ(getCompressedBytes(BlockFormat::BC4, 1024, 512), 256 * 128 * 8);
+}
+
+TEST(PixelFactoryBlockCompression, BC1)
+{
+	const auto source = createPattern(128, 64, ChannelMode::RGB);
+
+	std::vector< uint8_t > compressed;
+
+	ASSERT_TRUE(compress(source, BlockFormat::BC1, compressed));
+	ASSERT_EQ(compressed.size(), getCompressedBytes(BlockFormat::BC1, 128, 64));
+
+	Pixmap< uint8_t > decoded;
+
+	ASSERT_TRUE(decompress(BlockFormat::BC1, 128, 64, compressed, decoded));
+	ASSERT_EQ(decoded.channelMode(), ChannelMode::RGBA);
+	ASSERT_GT(getPSNR(source, decoded, {{0, 0}, {1, 1}, {2, 2}}), 32.0);
+}
+
+TEST(PixelFactoryBlockCompression, BC1PunchThroughAlpha)
+{
+	auto source = createPattern(8, 8, ChannelMode::RGBA);
+
+	for ( uint32_t coordY = 0; coordY < 8; coordY++ )
+	{
+		for ( uint32_t coordX = 0; coordX < 8; coordX++ )
+		{
+			source.pixelPointer(coordX, coordY)[3] = coordX < 3 ? 0 : 255;
+		}
+	}
+
+	std::vector< uint8_t > compressed;
+	Pixmap< uint8_t > decoded;
+
+	ASSERT_TRUE(compress(source, BlockFormat::BC1, compressed));
+	ASSERT_TRUE(decompress(BlockFormat::BC1, 8, 8, compressed, decoded));
+
+	for ( uint32_t coordY = 0; coordY < 8; coordY++ )
+	{
+		for ( uint32_t coordX = 0; coordX < 8; coordX++ )
+		{
+			ASSERT_EQ(decoded.pixelPointer(coordX, coordY)[3], coordX < 3 ? 0 : 255);
+		}
+	}
+}
+
+TEST(PixelFactoryBlockCompression, BC3)
+{
+	const auto source = createPattern(64, 64, ChannelMode::RGBA);
+
+	std::vector< uint8_t > compressed;
+	Pixmap< uint8_t > decoded;
+
+	ASSERT_TRUE(compress(source, BlockFormat::BC3, compressed));
+	ASSERT_TRUE(decompress(BlockFormat::BC3, 64, 64, compressed, decoded));
+	ASSERT_GT(getPSNR(source, decoded, {{0, 0}, {1, 1}, {2, 2}}), 32.0);
+	ASSERT_GT(getPSNR(source, decoded, {{3, 3}}), 40.0);
+}
+
+TEST(PixelFactoryBlockCompression, BC4AndBC5)
+{
+	const auto source = createPattern(64, 32, ChannelMode::GrayscaleAlpha);
+
+	std::vector< uint8_t > compressed;
+	Pixmap< uint8_t > decoded;
+
+	ASSERT_TRUE(compress(source, BlockFormat::BC4, compressed));
+	ASSERT_TRUE(decompress(BlockFormat::BC4, 64, 32, compressed, decoded));
+	ASSERT_EQ(decoded.channelMode(), ChannelMode::Grayscale);
+	ASSERT_GT(getPSNR(source, decoded, {{0, 0}}), 40.0);
+
+	ASSERT_TRUE(compress(source, BlockFormat::BC5, compressed));
+	ASSERT_TRUE(decompress(BlockFormat::BC5, 64, 32, compressed, decoded));
+	ASSERT_EQ(decoded.channelMode(), ChannelMode::GrayscaleAlpha);
+	ASSERT_GT(getPSNR(source, decoded, {{0, 0}, {1, 1}}), 40.0);
+}
+
+TEST(PixelFactoryBlockCompression, BC4ExtremeValues)
+{
+	/* NOTE: Exact black and white next to mid tones selects the six values mode. */
+	Pixmap< uint8_t > source{4, 4, ChannelMode::Grayscale};
+
+	const std::vector< uint8_t > values{0, 255, 100, 110, 120, 130, 0, 255, 100, 110, 120, 130, 0, 255, 100, 110};
+
+	for ( size_t index = 0; index < values.size(); index++ )
+	{
+		source.data()[index] = values[index];
+	}
+
+	std::vector< uint8_t > compressed;
+	Pixmap< uint8_t > decoded;
+
+	ASSERT_TRUE(compress(source, BlockFormat::BC4, compressed));
+	ASSERT_TRUE(decompress(BlockFormat::BC4, 4, 4, compressed, decoded));
+
+	for ( size_t index = 0; index < values.size(); index++ )
+	{
+		ASSERT_NEAR(decoded.data()[index], values[index], 2);
+	}
+}
+
+TEST(PixelFactoryBlockCompression, BC7)
+{
+	const auto source = createPattern(128, 64, ChannelMode::RGBA);
+
+	std::vector< uint8_t > compressed;
+	Pixmap< uint8_t > decoded;
+
+	ASSERT_TRUE(compress(source, BlockFormat::BC7, compressed));
+	ASSERT_TRUE(decompress(BlockFormat::BC7, 128, 64, compressed, decoded));
+	ASSERT_GT(getPSNR(source, decoded, {{0, 0}, {1, 1}, {2, 2}, {3, 3}}), 36.0);
+
+	/* NOTE: Only the mode 6 is decoded. */
+	compressed[0] = 0x01;
+
+	ASSERT_FALSE(decompress(BlockFormat::BC7, 128, 64, compressed, decoded));
+}
+
+TEST(PixelFactoryBlockCompression, BC7SolidColor)
+{
+	Pixmap< uint8_t > source{4, 4, ChannelMode::RGBA};
+
+	for ( size_t index = 0; index < source.pixelCount(); index++ )
+	{
+		auto * pixel = source.pixelPointer(index);
+		pixel[0] = 17;
+		pixel[1] = 200;
+		pixel[2] = 93;
+		pixel[3] = 255;
+	}
+
+	std::vector< uint8_t > compressed;
+	Pixmap< uint8_t > decoded;
+
+	ASSERT_TRUE(compress(source, BlockFormat::BC7, compressed));
+	ASSERT_TRUE(decompress(BlockFormat::BC7, 4, 4, compressed, decoded));
+
+	for ( size_t index = 0; index < decoded.pixelCount(); index++ )
+	{
+		for ( size_t channel = 0; channel < 4; channel++ )
+		{
+			ASSERT_NEAR(decoded.pixelPointer(index)[channel], source.pixelPointer(index)[channel], 1);
+		}
+	}
+}
+
+TEST(PixelFactoryBlockCompression, borderBlocks)
+{
+	const auto source = createPattern(13, 7, ChannelMode::RGB);
+
+	std::vector< uint8_t > compressed;
+	Pixmap< uint8_t > decoded;
+
+	ASSERT_TRUE(compress(source, BlockFormat::BC7, compressed));
+	ASSERT_EQ(compressed.size(), 4 * 2 * 16);
+	ASSERT_TRUE(decompress(BlockFormat::BC7, 13, 7, compressed, decoded));
+	ASSERT_EQ(decoded.width(), 13);
+	ASSERT_EQ(decoded.height(), 7);
+	ASSERT_GT(getPSNR(source, decoded, {{0, 0}, {1, 1}, {2, 2}}), 36.0);
+}
+
+TEST(PixelFactoryBlockCompression, multithreaded)
+{
+	const auto source = createPattern(256, 96, ChannelMode::RGBA);
+
+	ThreadPool threadPool{5};
+
+	for ( const auto format : {BlockFormat::BC1, BlockFormat::BC3, BlockFormat::BC5, BlockFormat::BC7} )
+	{
+		std::vector< uint8_t > singleThreaded;
+		std::vector< uint8_t > multiThreaded;
+
+		ASSERT_TRUE(compress(source, format, singleThreaded));
+
+		ThreadPool::setShared(&threadPool);
+
+		ASSERT_TRUE(compress(source, format, multiThreaded));
+
+		ThreadPool::setShared(nullptr);
+
+		ASSERT_EQ(singleThreaded, multiThreaded) << to_string(format);
+	}
+}
+
+TEST(PixelFactoryBlockCompression, invalidArguments)
+{
+	const Pixmap< uint8_t > empty;
+	std::vector< uint8_t > compressed;
+
+	ASSERT_FALSE(compress(empty, BlockFormat::BC1, compressed));
+
+	const auto source = createPattern(8, 8, ChannelMode::RGB);
+	std::vector< uint8_t > tooSmall(8);
+
+	ASSERT_FALSE(compress(source, BlockFormat::BC1, std::span< uint8_t >{tooSmall}));
+
+	Pixmap< uint8_t > decoded;
+
+	ASSERT_FALSE(decompress(BlockFormat::BC1, 8, 8, tooSmall, decoded));
+}
@@ -0,0 +1,144 @@
+/*
+ * src/Testing/test_PixelFactoryMipChain.cpp
+ * This file is part of Emeraude-Engine
+ *
+ * Copyright (C) 2010-2025 - Sébastien Léon Claude Christian Bémelmans "LondNoir" <londnoir@gmail.com>
+ *
+ * Emeraude-Engine is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * Emeraude-Engine is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with Emeraude-Engine; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * Complete project and additional information can be found at :
+ * https://github.com/londnoir/emeraude-engine
+ *
+ * --- THIS IS AUTOMATICALLY GENERATED, DO NOT CHANGE ---
+ */
+
+#include <gtest/gtest.h>
+
+/* STL inclusions. */
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+/* Local inclusions. */
+#include "Libs/PixelFactory/MipChain.hpp"
+
+using namespace EmEn::Libs;
+using namespace EmEn::Libs::PixelFactory;
+
+TEST(PixelFactoryMipChain, transferFunctions)
+{
+	ASSERT_EQ(sRGBToLinear(0), 0.0F);
+	ASSERT_EQ(sRGBToLinear(255), 1.0F);
+	ASSERT_NEAR(sRGBToLinear(188), 0.5F, 0.005F);
+
+	for ( uint32_t value = 0; value < 256; value++ )
+	{
+		ASSERT_EQ(linearToSRGB(sRGBToLinear(static_cast< uint8_t >(value))), value);
+	}
+}
+
+TEST(PixelFactoryMipChain, levelCount)
+{
+	ASSERT_EQ(getMipLevelCount(1, 1), 1);
+	ASSERT_EQ(getMipLevelCount(256, 256), 9);
+	ASSERT_EQ(getMipLevelCount(300, 17), 9);
+	ASSERT_EQ(getMipLevelCount(1, 1024), 11);
+}
+
+TEST(PixelFactoryMipChain, gammaCorrectAverage)
+{
+	/* NOTE: A black and white checkerboard reduces to the sRGB encoding of the half intensity, not to 128. */
+	Pixmap< uint8_t > checkerboard{2, 2, ChannelMode::RGB};
+
+	for ( uint32_t coordY = 0; coordY < 2; coordY++ )
+	{
+		for ( uint32_t coordX = 0; coordX < 2; coordX++ )
+		{
+			checkerboard.setPixel(coordX, coordY, (coordX + coordY) % 2 == 0 ? White : Black);
+		}
+	}
+
+	Pixmap< uint8_t > reduced;
+
+	ASSERT_TRUE(reduceMipLevel(checkerboard, reduced, true));
+	ASSERT_EQ(reduced.width(), 1);
+	ASSERT_EQ(reduced.height(), 1);
+	ASSERT_NEAR(reduced.pixelPointer(0U, 0U)[0], 188, 1);
+
+	ASSERT_TRUE(reduceMipLevel(checkerboard, reduced, false));
+	ASSERT_NEAR(reduced.pixelPointer(0U, 0U)[0], 128, 1);
+}
+
+TEST(PixelFactoryMipChain, alphaWeightedAverage)
+{
+	/* NOTE: The color of a transparent pixel must not bleed into the reduced level. */
+	Pixmap< uint8_t > source{2, 1, ChannelMode::RGBA};
+
+	auto * opaque = source.pixelPointer(0U, 0U);
+	opaque[0] = 255;
+	opaque[1] = 0;
+	opaque[2] = 0;
+	opaque[3] = 255;
+
+	auto * transparent = source.pixelPointer(1U, 0U);
+	transparent[0] = 0;
+	transparent[1] = 0;
+	transparent[2] = 0;
+	transparent[3] = 0;
+
+	Pixmap< uint8_t > reduced;
+
+	ASSERT_TRUE(reduceMipLevel(source, reduced, true));
+
+	const auto * pixel = reduced.pixelPointer(0U, 0U);
+
+	ASSERT_EQ(pixel[0], 255);
+	ASSERT_EQ(pixel[1], 0);
+	ASSERT_EQ(pixel[2], 0);
+	ASSERT_NEAR(pixel[3], 128, 1);
+}
+
+TEST(PixelFactoryMipChain, completeChain)
+{
+	Pixmap< uint8_t > base{37, 12, ChannelMode::GrayscaleAlpha};
+
+	std::fill(base.data().begin(), base.data().end(), static_cast< uint8_t >(200));
+
+	std::vector< Pixmap< uint8_t > > levels;
+
+	ASSERT_TRUE(generateMipChain(base, 64, true, levels));
+	ASSERT_EQ(levels.size(), 5);
+
+	const std::vector< std::pair< uint32_t, uint32_t > > expectedSizes{{18, 6}, {9, 3}, {4, 1}, {2, 1}, {1, 1}};
+
+	for ( size_t levelIndex = 0; levelIndex < levels.size(); levelIndex++ )
+	{
+		ASSERT_EQ(levels[levelIndex].width(), expectedSizes[levelIndex].first);
+		ASSERT_EQ(levels[levelIndex].height(), expectedSizes[levelIndex].second);
+		ASSERT_EQ(levels[levelIndex].channelMode(), ChannelMode::GrayscaleAlpha);
+
+		/* NOTE: A uniform image stays uniform on every level. */
+		for ( const auto value : levels[levelIndex].data() )
+		{
+			ASSERT_EQ(value, 200);
+		}
+	}
+
+	ASSERT_TRUE(generateMipChain(base, 2, true, levels));
+	ASSERT_EQ(levels.size(), 1);
+
+	ASSERT_TRUE(generateMipChain(base, 1, true, levels));
+	ASSERT_TRUE(levels.empty());
+}
@@ -26,10 +26,17 @@
 
 #include <gtest/gtest.h>
 
+/* STL inclusions. */
+#include <algorithm>
+#include <utility>
+#include <vector>
+
 /* Local inclusions. */
 #include "Libs/Time/Elapsed/PrintScopeRealTime.hpp"
 #include "Libs/PixelFactory/FileIO.hpp"
 #include "Libs/PixelFactory/Pixmap.hpp"
+#include "Libs/PixelFactory/Processor.hpp"
+#include "Libs/ThreadPool.hpp"
 #include "Constants.hpp"
 
 using namespace EmEn::Libs;
@@ -380,6 +387,56 @@ TEST(PixelFactoryProcessor, resizeCubicUp)
 	ASSERT_TRUE(FileIO::write(output, {"./test-assets/tmp_2400x1600resizeCubic.png"}, true));
 }
 
+TEST(PixelFactoryProcessor, downscaleBox)
+{
+	PrintScopeRealTime globalStat{"Processor::downscale(50%,Box) [OVERALL]"};
+
+	Pixmap< uint8_t > source, output;
+
+	ASSERT_TRUE(FileIO::read(ExtraLargeRGB, source));
+
+	ASSERT_EQ(source.width(), 8160);
+	ASSERT_EQ(source.height(), 6144);
+	ASSERT_EQ(source.colorCount(), 3);
+
+	{
+		PrintScopeRealTime localStat{"Processor::downscale(50%,Box)"};
+
+		ASSERT_TRUE(Processor< uint8_t >::downscale(source, 4080, 3072, output, ResamplingFilter::Box));
+	}
+
+	ASSERT_EQ(output.width(), 4080);
+	ASSERT_EQ(output.height(), 3072);
+	ASSERT_EQ(output.colorCount(), 3);
+
+	ASSERT_TRUE(FileIO::write(output, {"./test-assets/tmp_4080x3072downscaleBox.png"}, true));
+}
+
+TEST(PixelFactoryProcessor, downscaleLanczos)
+{
+	PrintScopeRealTime globalStat{"Processor::downscale(50%,Lanczos) [OVERALL]"};
+
+	Pixmap< uint8_t > source, output;
+
+	ASSERT_TRUE(FileIO::read(ExtraLargeRGB, source));
+
+	ASSERT_EQ(source.width(), 8160);
+	ASSERT_EQ(source.height(), 6144);
+	ASSERT_EQ(source.colorCount(), 3);
+
+	{
+		PrintScopeRealTime localStat{"Processor::downscale(50%,Lanczos)"};
+
+		ASSERT_TRUE(Processor< uint8_t >::downscale(source, 4080, 3072, output, ResamplingFilter::Lanczos));
+	}
+
+	ASSERT_EQ(output.width(), 4080);
+	ASSERT_EQ(output.height(), 3072);
+	ASSERT_EQ(output.colorCount(), 3);
+
+	ASSERT_TRUE(FileIO::write(output, {"./test-assets/tmp_4080x3072downscaleLanczos.png"}, true));
+}
+
 TEST(PixelFactoryProcessor, crop)
 {
 	PrintScopeRealTime globalStat{"Processor::crop(64, 128, 1600, 1200) [OVERALL]"};
@@ -903,3 +960,227 @@ TEST(PixelFactoryProcessor, removeAlphaChannel)
 
 	ASSERT_TRUE(FileIO::write(output, {"./test-assets/tmp_removeAlphaChannel.png"}, true));
 }
+
+/**
+ * @brief Creates a small pixmap where every component holds a distinct value.
+ * @param width The width.
+ * @param height The height.
+ * @param mode The channel mode.
+ * @return Pixmap< uint8_t >
+ */
+Pixmap< uint8_t >
+createIndexedPixmap (uint32_t width, uint32_t height, ChannelMode mode) noexcept
+{
+	Pixmap< uint8_t > pixmap{width, height, mode};
+
+	auto & data = pixmap.data();
+
+	for ( size_t index = 0; index < data.size(); index++ )
+	{
+		data[index] = static_cast< uint8_t >((index * 7) % 251);
+	}
+
+	return pixmap;
+}
+
+TEST(PixelFactoryProcessor, rotationMapping)
+{
+	const auto source = createIndexedPixmap(5, 3, ChannelMode::RGB);
+
+	const auto quarter = Processor< uint8_t >::rotateQuarterTurn(source);
+	const auto threeQuarter = Processor< uint8_t >::rotateThreeQuarterTurn(source);
+
+	ASSERT_EQ(quarter.width(), 3);
+	ASSERT_EQ(quarter.height(), 5);
+	ASSERT_EQ(threeQuarter.width(), 3);
+	ASSERT_EQ(threeQuarter.height(), 5);
+
+	/* NOTE: The first source row becomes the last column of a quarter turn, read from top to bottom. */
+	for ( uint32_t x = 0; x < source.width(); x++ )
+	{
+		for ( uint32_t channel = 0; channel < 3; channel++ )
+		{
+			EXPECT_EQ(quarter.pixelPointer(2, x)[channel], source.pixelPointer(x, 0)[channel]);
+			EXPECT_EQ(threeQuarter.pixelPointer(0, 4 - x)[channel], source.pixelPointer(x, 0)[channel]);
+		}
+	}
+
+	EXPECT_EQ(Processor< uint8_t >::rotateThreeQuarterTurn(quarter).data(), source.data());
+	EXPECT_EQ(Processor< uint8_t >::rotateQuarterTurn(Processor< uint8_t >::rotateQuarterTurn(source)).data(), Processor< uint8_t >::rotateHalfTurn(source).data());
+}
+
+TEST(PixelFactoryProcessor, mirrorMapping)
+{
+	for ( const auto mode : {ChannelMode::Grayscale, ChannelMode::GrayscaleAlpha, ChannelMode::RGB, ChannelMode::RGBA} )
+	{
+		const auto source = createIndexedPixmap(7, 4, mode);
+		const auto colorCount = source.colorCount();
+
+		const auto mirrorX = Processor< uint8_t >::mirror(source, MirrorMode::X);
+		const auto mirrorY = Processor< uint8_t >::mirror(source, MirrorMode::Y);
+		const auto mirrorBoth = Processor< uint8_t >::mirror(source, MirrorMode::Both);
+
+		for ( uint32_t y = 0; y < source.height(); y++ )
+		{
+			for ( uint32_t x = 0; x < source.width(); x++ )
+			{
+				for ( uint32_t channel = 0; channel < colorCount; channel++ )
+				{
+					EXPECT_EQ(mirrorX.pixelPointer(x, 3 - y)[channel], source.pixelPointer(x, y)[channel]);
+					EXPECT_EQ(mirrorY.pixelPointer(6 - x, y)[channel], source.pixelPointer(x, y)[channel]);
+					EXPECT_EQ(mirrorBoth.pixelPointer(6 - x, 3 - y)[channel], source.pixelPointer(x, y)[channel]);
+				}
+			}
+		}
+	}
+}
+
+TEST(PixelFactoryProcessor, alphaChannelRoundTrip)
+{
+	const auto source = createIndexedPixmap(9, 5, ChannelMode::RGB);
+
+	const auto withAlpha = Processor< uint8_t >::addAlphaChannel(source);
+
+	ASSERT_EQ(withAlpha.colorCount(), 4);
+
+	for ( size_t index = 0; index < withAlpha.pixelCount(); index++ )
+	{
+		EXPECT_EQ(withAlpha.pixelPointer(index)[3], 255);
+	}
+
+	EXPECT_EQ(Processor< uint8_t >::removeAlphaChannel(withAlpha).data(), source.data());
+
+	const auto gray = createIndexedPixmap(9, 5, ChannelMode::Grayscale);
+
+	EXPECT_EQ(Processor< uint8_t >::removeAlphaChannel(Processor< uint8_t >::addAlphaChannel(gray)).data(), gray.data());
+}
+
+TEST(PixelFactoryProcessor, resizeCubicKeepsFlatColor)
+{
+	Pixmap< uint8_t > source{16, 16, ChannelMode::RGBA};
+	std::fill(source.data().begin(), source.data().end(), 200);
+
+	for ( const auto & [width, height] : std::vector< std::pair< uint32_t, uint32_t > >{{5, 7}, {40, 33}} )
+	{
+		const auto output = Processor< uint8_t >::resize(source, width, height, FilteringMode::Cubic);
+
+		ASSERT_EQ(output.width(), width);
+		ASSERT_EQ(output.height(), height);
+
+		for ( const auto value : output.data() )
+		{
+			ASSERT_EQ(value, 200);
+		}
+	}
+}
+
+TEST(PixelFactoryProcessor, downscaleBoxAverages)
+{
+	Pixmap< uint8_t > source{4, 2, ChannelMode::Grayscale};
+	source.data() = {10, 20, 30, 40, 50, 60, 70, 80};
+
+	Pixmap< uint8_t > output;
+
+	ASSERT_TRUE(Processor< uint8_t >::downscale(source, 2, 1, output, ResamplingFilter::Box));
+
+	ASSERT_EQ(output.width(), 2);
+	ASSERT_EQ(output.height(), 1);
+	EXPECT_EQ(output.data()[0], 35);
+	EXPECT_EQ(output.data()[1], 55);
+
+	/* NOTE: Upscaling is not a reduction. */
+	EXPECT_FALSE(Processor< uint8_t >::downscale(source, 8, 2, output, ResamplingFilter::Box));
+}
+
+TEST(PixelFactoryProcessor, downscaleKeepsFlatColor)
+{
+	for ( const auto mode : {ChannelMode::Grayscale, ChannelMode::GrayscaleAlpha, ChannelMode::RGB, ChannelMode::RGBA} )
+	{
+		for ( const auto filter : {ResamplingFilter::Box, ResamplingFilter::Lanczos} )
+		{
+			Pixmap< uint8_t > source{97, 61, mode};
+			std::fill(source.data().begin(), source.data().end(), 123);
+
+			const auto output = Processor< uint8_t >::downscale(source, 13, 29, filter);
+
+			ASSERT_EQ(output.width(), 13);
+			ASSERT_EQ(output.height(), 29);
+			ASSERT_EQ(output.colorCount(), source.colorCount());
+
+			for ( const auto value : output.data() )
+			{
+				ASSERT_EQ(value, 123);
+			}
+		}
+	}
+}
+
+TEST(PixelFactoryProcessor, downscaleFloat)
+{
+	Pixmap< float > source{64, 64, ChannelMode::RGBA};
+
+	for ( uint32_t y = 0; y < source.height(); y++ )
+	{
+		for ( uint32_t x = 0; x < source.width(); x++ )
+		{
+			auto * pixel = source.pixelPointer(x, y);
+			pixel[0] = static_cast< float >(x) / 63.0F;
+			pixel[1] = static_cast< float >(y) / 63.0F;
+			pixel[2] = 0.5F;
+			pixel[3] = 1.0F;
+		}
+	}
+
+	const auto output = Processor< float >::downscale(source, 32, 32, ResamplingFilter::Box);
+
+	ASSERT_EQ(output.width(), 32);
+
+	/* NOTE: A box reduction of a ramp averages two neighbor values. */
+	EXPECT_NEAR(output.pixelPointer(5, 9)[0], 10.5F / 63.0F, 1.0e-5F);
+	EXPECT_NEAR(output.pixelPointer(5, 9)[1], 18.5F / 63.0F, 1.0e-5F);
+	EXPECT_NEAR(output.pixelPointer(5, 9)[2], 0.5F, 1.0e-5F);
+	EXPECT_NEAR(output.pixelPointer(5, 9)[3], 1.0F, 1.0e-5F);
+}
+
+TEST(PixelFactoryProcessor, sharedThreadPool)
+{
+	Pixmap< uint8_t > source{1024, 768, ChannelMode::RGBA};
+
+	for ( uint32_t y = 0; y < source.height(); y++ )
+	{
+		for ( uint32_t x = 0; x < source.width(); x++ )
+		{
+			auto * pixel = source.pixelPointer(x, y);
+			pixel[0] = static_cast< uint8_t >(x);
+			pixel[1] = static_cast< uint8_t >(y);
+			pixel[2] = static_cast< uint8_t >(x ^ y);
+			pixel[3] = 255;
+		}
+	}
+
+	const auto serialResize = Processor< uint8_t >::resize(source, 700, 900, FilteringMode::Cubic);
+	const auto serialRotation = Processor< uint8_t >::rotateQuarterTurn(source);
+
+	ThreadPool threadPool{4};
+
+	ThreadPool::setShared(&threadPool);
+
+	const auto parallelResize = Processor< uint8_t >::resize(source, 700, 900, FilteringMode::Cubic);
+	const auto parallelRotation = Processor< uint8_t >::rotateQuarterTurn(source);
+
+	/* NOTE: A kernel called from a worker of the shared pool splits its rows on the same pool. */
+	Pixmap< uint8_t > workerResize;
+	JobGroup group;
+
+	threadPool.submit([&source, &workerResize] () {
+		workerResize = Processor< uint8_t >::resize(source, 700, 900, FilteringMode::Cubic);
+	}, group);
+
+	threadPool.wait(group);
+
+	ThreadPool::setShared(nullptr);
+
+	ASSERT_EQ(parallelResize.data(), serialResize.data());
+	ASSERT_EQ(parallelRotation.data(), serialRotation.data());
+	ASSERT_EQ(workerResize.data(), serialResize.data());
+}
@@ -0,0 +1,158 @@
+/*
+ * src/Testing/test_PixelFactoryTextureCache.cpp
+ * This file is part of Emeraude-Engine
+ *
+ * Copyright (C) 2010-2025 - Sébastien Léon Claude Christian Bémelmans "LondNoir" <londnoir@gmail.com>
+ *
+ * Emeraude-Engine is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * Emeraude-Engine is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with Emeraude-Engine; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * Complete project and additional information can be found at :
+ * https://github.com/londnoir/emeraude-engine
+ *
+ * --- THIS IS AUTOMATICALLY GENERATED, DO NOT CHANGE ---
+ */
+
+#include <gtest/gtest.h>
+
+/* STL inclusions. */
+#include <algorithm>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <vector>
+
+/* Local inclusions. */
+#include "Libs/PixelFactory/CompressedTexture.hpp"
+#include "Libs/PixelFactory/FileIO.hpp"
+#include "Libs/PixelFactory/Processor.hpp"
+#include "Libs/PixelFactory/TextureCache.hpp"
+#include "Constants.hpp"
+
+using namespace EmEn::Libs;
+using namespace EmEn::Libs::PixelFactory;
+
+TEST(PixelFactoryTextureCache, build)
+{
+	Pixmap< uint8_t > asset;
+
+	ASSERT_TRUE(FileIO::read(SmallRGBA, asset));
+
+	/* NOTE: Neither dimension is a multiple of the block size. */
+	const auto source = Processor< uint8_t >::resize(asset, 100, 30);
+
+	CompressedTexture texture;
+
+	ASSERT_TRUE(texture.build(source, BlockFormat::BC3, 32, true));
+	ASSERT_TRUE(texture.isValid());
+	ASSERT_EQ(texture.levelCount(), 7);
+	ASSERT_EQ(texture.width(), 100);
+	ASSERT_EQ(texture.height(), 30);
+	ASSERT_EQ(texture.sourceHash(), CompressedTexture::computeSourceHash(source));
+
+	for ( uint32_t level = 0; level < texture.levelCount(); level++ )
+	{
+		const auto & description = texture.levels()[level];
+
+		ASSERT_EQ(description.offset % CompressedTexture::LevelAlignment, 0);
+		ASSERT_EQ(description.bytes, getCompressedBytes(BlockFormat::BC3, description.width, description.height));
+		ASSERT_EQ(texture.levelData(level).size(), description.bytes);
+	}
+
+	ASSERT_EQ(texture.levels().back().width, 1);
+	ASSERT_EQ(texture.levels().back().height, 1);
+	ASSERT_TRUE(texture.levelData(7).empty());
+}
+
+TEST(PixelFactoryTextureCache, fileRoundTrip)
+{
+	const auto directory = testOutputPath("texture_roundtrip");
+	const auto filepath = directory / "texture.emtex";
+
+	std::filesystem::create_directories(directory);
+
+	Pixmap< uint8_t > source;
+
+	ASSERT_TRUE(FileIO::read(SmallRGBA, source));
+
+	CompressedTexture texture;
+
+	ASSERT_TRUE(texture.build(source, BlockFormat::BC7, 4, false));
+	ASSERT_TRUE(texture.writeFile(filepath));
+
+	CompressedTexture loaded;
+
+	ASSERT_TRUE(loaded.readFile(filepath));
+	ASSERT_EQ(loaded.format(), BlockFormat::BC7);
+	ASSERT_FALSE(loaded.isGammaCorrected());
+	ASSERT_EQ(loaded.sourceHash(), texture.sourceHash());
+	ASSERT_EQ(loaded.levelCount(), 4);
+	ASSERT_TRUE(std::equal(loaded.data().begin(), loaded.data().end(), texture.data().begin(), texture.data().end()));
+
+	/* NOTE: A truncated file is rejected. */
+	std::filesystem::resize_file(filepath, std::filesystem::file_size(filepath) - 1);
+
+	ASSERT_FALSE(loaded.readFile(filepath));
+	ASSERT_FALSE(loaded.isValid());
+
+	/* NOTE: A file from another version is rejected. */
+	ASSERT_TRUE(texture.writeFile(filepath));
+
+	{
+		std::fstream file{filepath, std::ios::binary | std::ios::in | std::ios::out};
+		const uint32_t oldVersion = CompressedTexture::Version + 1;
+
+		file.seekp(8);
+		file.write(reinterpret_cast< const char * >(&oldVersion), sizeof(oldVersion));
+	}
+
+	ASSERT_FALSE(loaded.readFile(filepath));
+
+	std::filesystem::remove_all(directory);
+}
+
+TEST(PixelFactoryTextureCache, hitAndMiss)
+{
+	const auto directory = testOutputPath("texture_cache");
+
+	TextureCache cache{directory};
+
+	Pixmap< uint8_t > source;
+	Pixmap< uint8_t > otherSource;
+
+	ASSERT_TRUE(FileIO::read(SmallRGBA, source));
+	ASSERT_TRUE(FileIO::read(MediumRGBA, otherSource));
+
+	CompressedTexture first;
+
+	ASSERT_TRUE(cache.get(source, BlockFormat::BC1, 16, true, first));
+	ASSERT_EQ(cache.misses(), 1);
+	ASSERT_EQ(cache.hits(), 0);
+	ASSERT_TRUE(std::filesystem::exists(cache.getFilepath(first.sourceHash(), BlockFormat::BC1, first.levelCount(), true)));
+
+	CompressedTexture second;
+
+	ASSERT_TRUE(cache.get(source, BlockFormat::BC1, 16, true, second));
+	ASSERT_EQ(cache.misses(), 1);
+	ASSERT_EQ(cache.hits(), 1);
+	ASSERT_TRUE(std::equal(first.data().begin(), first.data().end(), second.data().begin(), second.data().end()));
+
+	/* NOTE: Another format or other pixels are other entries. */
+	ASSERT_TRUE(cache.get(source, BlockFormat::BC7, 16, true, second));
+	ASSERT_TRUE(cache.get(otherSource, BlockFormat::BC1, 16, true, second));
+	ASSERT_EQ(cache.misses(), 3);
+	ASSERT_NE(second.sourceHash(), first.sourceHash());
+
+	std::filesystem::remove_all(directory);
+}
@@ -0,0 +1,327 @@
+/*
+ * src/Testing/test_RenderQueue.cpp
+ * This file is part of Emeraude-Engine
+ *
+ * Copyright (C) 2010-2025 - Sébastien Léon Claude Christian Bémelmans "LondNoir" <londnoir@gmail.com>
+ *
+ * Emeraude-Engine is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * Emeraude-Engine is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with Emeraude-Engine; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * Complete project and additional information can be found at :
+ * https://github.com/londnoir/emeraude-engine
+ *
+ * --- THIS IS AUTOMATICALLY GENERATED, DO NOT CHANGE ---
+ */
+
+
+#include <gtest/gtest.h>
+
+/* STL inclusions. */
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+/* Local inclusions. */
+#include "Libs/Randomizer.hpp"
+#include "Scenes/RenderQueue.hpp"
+
+using namespace EmEn::Libs;
+using namespace EmEn::Graphics;
+using namespace EmEn::Scenes;
+
+/**
+ * @brief Render batch description, the position in the input is used as identifier.
+ */
+struct BatchDescription
+{
+	RenderPassType renderPassType;
+	const void * pipeline;
+	const void * material;
+	const void * geometry;
+	float distance;
+	size_t identifier;
+};
+
+/* NOTE: Only the addresses are used by the keys. */
+static const std::array< int, 4 > Pipelines{};
+static const std::array< int, 4 > Materials{};
+static const std::array< int, 8 > Geometries{};
+
+/* NOTE: Distances with a distinct exponent stay distinct in the 16 bits of depth of the opaque key. */
+static constexpr std::array< float, 10 > Distances{
+	-1.0F, 0.0F, 0.5F, 1.0F, 4.0F, 32.0F, 1000.0F, 65536.0F, 1.0e30F, std::numeric_limits< float >::max()
+};
+
+/**
+ * @brief Returns the order of a pipeline, material or geometry pointer in the keys.
+ * @note The pointers are hashed to spread them in the key, so their order is only known through the key.
+ * @param translucent Use the translucent key layout.
+ * @param pipeline A pointer to the graphics pipeline. Can be null.
+ * @param material A pointer to the material. Can be null.
+ * @param geometry A pointer to the geometry. Can be null.
+ * @return uint64_t
+ */
+[[nodiscard]]
+static
+uint64_t
+pointerOrder (bool translucent, const void * pipeline, const void * material, const void * geometry) noexcept
+{
+	return translucent ?
+		RenderQueue::translucentKey(RenderPassType::SimplePass, pipeline, material, geometry, 0.0F) :
+		RenderQueue::opaqueKey(RenderPassType::SimplePass, pipeline, material, geometry, 0.0F);
+}
+
+/**
+ * @brief Returns the batches sorted by std::stable_sort with the expected order.
+ * @note Opaque : pass, pipeline, material, geometry, then front-to-back. Translucent : pass, back-to-front, then pipeline, material, geometry.
+ * @param descriptions A copy of the batch descriptions.
+ * @param translucent Use the translucent order.
+ * @return std::vector< size_t >
+ */
+[[nodiscard]]
+static
+std::vector< size_t >
+getReferenceOrder (std::vector< BatchDescription > descriptions, bool translucent) noexcept
+{
+	std::ranges::stable_sort(descriptions, [translucent] (const BatchDescription & batchA, const BatchDescription & batchB) {
+		const auto distanceA = std::max(batchA.distance, 0.0F);
+		const auto distanceB = std::max(batchB.distance, 0.0F);
+
+		const auto fieldsA = std::make_tuple(
+			pointerOrder(translucent, batchA.pipeline, nullptr, nullptr),
+			pointerOrder(translucent, nullptr, batchA.material, nullptr),
+			pointerOrder(translucent, nullptr, nullptr, batchA.geometry)
+		);
+
+		const auto fieldsB = std::make_tuple(
+			pointerOrder(translucent, batchB.pipeline, nullptr, nullptr),
+			pointerOrder(translucent, nullptr, batchB.material, nullptr),
+			pointerOrder(translucent, nullptr, nullptr, batchB.geometry)
+		);
+
+		if ( batchA.renderPassType != batchB.renderPassType )
+		{
+			return batchA.renderPassType < batchB.renderPassType;
+		}
+
+		if ( translucent )
+		{
+			if ( distanceA != distanceB )
+			{
+				return distanceA > distanceB;
+			}
+
+			return fieldsA < fieldsB;
+		}
+
+		if ( fieldsA != fieldsB )
+		{
+			return fieldsA < fieldsB;
+		}
+
+		return distanceA < distanceB;
+	});
+
+	std::vector< size_t > order;
+	order.reserve(descriptions.size());
+
+	for ( const auto & description : descriptions )
+	{
+		order.emplace_back(description.identifier);
+	}
+
+	return order;
+}
+
+/**
+ * @brief Fills a queue with the batches, sorts it and returns the batch order.
+ * @param queue A reference to the render queue.
+ * @param descriptions A reference to the batch descriptions.
+ * @param translucent Use the translucent keys.
+ * @return std::vector< size_t >
+ */
+[[nodiscard]]
+static
+std::vector< size_t >
+getQueueOrder (RenderQueue & queue, const std::vector< BatchDescription > & descriptions, bool translucent) noexcept
+{
+	queue.clear();
+
+	for ( const auto & description : descriptions )
+	{
+		const auto key = translucent ?
+			RenderQueue::translucentKey(description.renderPassType, description.pipeline, description.material, description.geometry, description.distance) :
+			RenderQueue::opaqueKey(description.renderPassType, description.pipeline, description.material, description.geometry, description.distance);
+
+		/* NOTE: The layer index carries the identifier through the sort. */
+		queue.push(key, nullptr, description.identifier);
+	}
+
+	queue.sort();
+
+	std::vector< size_t > order;
+	order.reserve(queue.size());
+
+	for ( const auto & batch : queue )
+	{
+		order.emplace_back(batch.subGeometryIndex());
+	}
+
+	return order;
+}
+
+/**
+ * @brief Creates random batch descriptions, with duplicates to get equal keys.
+ * @param count The number of batches.
+ * @param seed The randomizer seed.
+ * @return std::vector< BatchDescription >
+ */
+[[nodiscard]]
+static
+std::vector< BatchDescription >
+createDescriptions (size_t count, uint32_t seed) noexcept
+{
+	constexpr std::array< RenderPassType, 4 > Passes{
+		RenderPassType::SimplePass,
+		RenderPassType::AmbientPass,
+		RenderPassType::PointLightPass,
+		RenderPassType::SpotLightPassNoShadow
+	};
+
+	Randomizer< size_t > randomizer{seed};
+
+	std::vector< BatchDescription > descriptions;
+	descriptions.reserve(count);
+
+	for ( size_t index = 0; index < count; index++ )
+	{
+		/* NOTE: One batch out of four is a copy of a previous one. */
+		if ( index > 0 && randomizer.value(0, 3) == 0 )
+		{
+			auto copy = descriptions[randomizer.value(0, index - 1)];
+			copy.identifier = index;
+
+			descriptions.emplace_back(copy);
+
+			continue;
+		}
+
+		descriptions.emplace_back(BatchDescription{
+			Passes[randomizer.value(0, Passes.size() - 1)],
+			&Pipelines[randomizer.value(0, Pipelines.size() - 1)],
+			&Materials[randomizer.value(0, Materials.size() - 1)],
+			&Geometries[randomizer.value(0, Geometries.size() - 1)],
+			Distances[randomizer.value(0, Distances.size() - 1)],
+			index
+		});
+	}
+
+	return descriptions;
+}
+
+TEST(RenderQueue, opaqueOrder)
+{
+	RenderQueue queue;
+
+	for ( const auto seed : {1U, 42U, 1337U} )
+	{
+		const auto descriptions = createDescriptions(2000, seed);
+
+		ASSERT_EQ(getQueueOrder(queue, descriptions, false), getReferenceOrder(descriptions, false));
+	}
+}
+
+TEST(RenderQueue, translucentOrder)
+{
+	RenderQueue queue;
+
+	for ( const auto seed : {1U, 42U, 1337U} )
+	{
+		const auto descriptions = createDescriptions(2000, seed);
+
+		ASSERT_EQ(getQueueOrder(queue, descriptions, true), getReferenceOrder(descriptions, true));
+	}
+}
+
+TEST(RenderQueue, depthKeys)
+{
+	/* NOTE: The depth is the last opaque criterion, and the first translucent one after the pass. */
+	for ( size_t index = 1; index < Distances.size(); index++ )
+	{
+		const auto nearer = Distances[index - 1];
+		const auto farther = Distances[index];
+
+		ASSERT_LE(RenderQueue::opaqueKey(RenderPassType::SimplePass, nullptr, nullptr, nullptr, nearer), RenderQueue::opaqueKey(RenderPassType::SimplePass, nullptr, nullptr, nullptr, farther));
+		ASSERT_GE(RenderQueue::translucentKey(RenderPassType::SimplePass, nullptr, nullptr, nullptr, nearer), RenderQueue::translucentKey(RenderPassType::SimplePass, nullptr, nullptr, nullptr, farther));
+	}
+
+	/* NOTE: A negative distance is the same as zero. */
+	ASSERT_EQ(RenderQueue::opaqueKey(RenderPassType::SimplePass, nullptr, nullptr, nullptr, -1.0F), RenderQueue::opaqueKey(RenderPassType::SimplePass, nullptr, nullptr, nullptr, 0.0F));
+
+	/* NOTE: The maximum depth does not overflow on the other fields. */
+	const auto maxDepth = std::numeric_limits< float >::max();
+
+	ASSERT_EQ(RenderQueue::opaqueKey(RenderPassType::SimplePass, nullptr, nullptr, nullptr, maxDepth) >> 16, RenderQueue::opaqueKey(RenderPassType::SimplePass, nullptr, nullptr, nullptr, 0.0F) >> 16);
+	ASSERT_EQ(RenderQueue::translucentKey(RenderPassType::SimplePass, nullptr, nullptr, nullptr, maxDepth) >> 60, RenderQueue::translucentKey(RenderPassType::SimplePass, nullptr, nullptr, nullptr, 0.0F) >> 60);
+	ASSERT_EQ(RenderQueue::translucentKey(RenderPassType::SimplePass, nullptr, nullptr, nullptr, maxDepth) & 0xFFFFFFFFULL, RenderQueue::translucentKey(RenderPassType::SimplePass, nullptr, nullptr, nullptr, 0.0F) & 0xFFFFFFFFULL);
+}
+
+TEST(RenderQueue, radixSortMatchesStableSort)
+{
+	RenderQueue queue;
+	Randomizer< uint64_t > randomizer{7};
+
+	/* NOTE: Narrow keys to get equal ones, and keys sharing bytes to skip radix passes. */
+	for ( const auto mask : {0xFFFFFFFFFFFFFFFFULL, 0xFF000000000000FFULL, 0x000000000000000FULL, 0ULL} )
+	{
+		std::vector< std::pair< uint64_t, size_t > > reference;
+
+		queue.clear();
+
+		for ( size_t index = 0; index < 5000; index++ )
+		{
+			const auto key = randomizer.value(0, std::numeric_limits< uint64_t >::max()) & mask;
+
+			reference.emplace_back(key, index);
+
+			queue.push(key, nullptr, index);
+		}
+
+		queue.sort();
+
+		std::ranges::stable_sort(reference, {}, &std::pair< uint64_t, size_t >::first);
+
+		ASSERT_EQ(queue.size(), reference.size());
+		ASSERT_EQ(queue.keys().size(), reference.size());
+
+		for ( size_t index = 0; index < reference.size(); index++ )
+		{
+			ASSERT_EQ(queue.keys()[index], reference[index].first);
+			ASSERT_EQ(queue.batches()[index].subGeometryIndex(), reference[index].second);
+		}
+
+		/* NOTE: Sorting again keeps the order. */
+		queue.sort();
+
+		for ( size_t index = 0; index < reference.size(); index++ )
+		{
+			ASSERT_EQ(queue.batches()[index].subGeometryIndex(), reference[index].second);
+		}
+	}
+}
@@ -0,0 +1,130 @@
+/*
+ * src/Testing/test_SPSCRingBuffer.cpp
+ * This file is part of Emeraude-Engine
+ *
+ * Copyright (C) 2010-2025 - Sébastien Léon Claude Christian Bémelmans "LondNoir" <londnoir@gmail.com>
+ *
+ * Emeraude-Engine is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * Emeraude-Engine is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with Emeraude-Engine; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * Complete project and additional information can be found at :
+ * https://github.com/londnoir/emeraude-engine
+ *
+ * --- THIS IS AUTOMATICALLY GENERATED, DO NOT CHANGE ---
+ */
+
+#include <gtest/gtest.h>
+
+/* STL inclusions. */
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+/* Local inclusions. */
+#include "Libs/SPSCRingBuffer.hpp"
+
+using namespace EmEn::Libs;
+
+TEST(SPSCRingBuffer, PushPop)
+{
+	SPSCRingBuffer< int, 4 > buffer;
+
+	ASSERT_TRUE(buffer.empty());
+	ASSERT_EQ(buffer.capacity(), 4);
+
+	for ( int value = 0; value < 4; value++ )
+	{
+		ASSERT_TRUE(buffer.push(value));
+	}
+
+	/* NOTE: The buffer is full, the push must be refused without touching the content. */
+	ASSERT_FALSE(buffer.push(99));
+	ASSERT_EQ(buffer.size(), 4);
+
+	int value = -1;
+
+	for ( int expected = 0; expected < 4; expected++ )
+	{
+		ASSERT_TRUE(buffer.pop(value));
+		ASSERT_EQ(value, expected);
+	}
+
+	ASSERT_FALSE(buffer.pop(value));
+	ASSERT_TRUE(buffer.empty());
+}
+
+TEST(SPSCRingBuffer, BatchIsAtomic)
+{
+	SPSCRingBuffer< int, 8 > buffer;
+
+	ASSERT_TRUE(buffer.push(-1));
+
+	/* NOTE: Only 7 slots left, a batch of 8 must be refused as a whole. */
+	ASSERT_FALSE(buffer.emplace(8, [] (int & slot, size_t index) {
+		slot = static_cast< int >(index);
+	}));
+	ASSERT_EQ(buffer.size(), 1);
+
+	ASSERT_TRUE(buffer.emplace(7, [] (int & slot, size_t index) {
+		slot = static_cast< int >(index);
+	}));
+
+	std::vector< int > values;
+
+	ASSERT_EQ(buffer.consume([&values] (const int & slot) {
+		values.emplace_back(slot);
+	}), 8);
+
+	ASSERT_EQ(values, (std::vector< int >{-1, 0, 1, 2, 3, 4, 5, 6}));
+}
+
+TEST(SPSCRingBuffer, ConcurrentProducerConsumer)
+{
+	constexpr uint64_t itemCount{1000000};
+
+	SPSCRingBuffer< uint64_t, 1024 > buffer;
+
+	std::thread producer{[&buffer] () {
+		for ( uint64_t value = 0; value < itemCount; value++ )
+		{
+			while ( !buffer.push(value) )
+			{
+				std::this_thread::yield();
+			}
+		}
+	}};
+
+	uint64_t expected = 0;
+	bool ordered = true;
+
+	while ( expected < itemCount )
+	{
+		const auto count = buffer.consume([&expected, &ordered] (const uint64_t & value) {
+			ordered = ordered && value == expected;
+
+			expected++;
+		});
+
+		if ( count == 0 )
+		{
+			std::this_thread::yield();
+		}
+	}
+
+	producer.join();
+
+	ASSERT_TRUE(ordered);
+	ASSERT_TRUE(buffer.empty());
+}
@@ -0,0 +1,232 @@
+/*
+ * src/Testing/test_TLSFAllocator.cpp
+ * This file is part of Emeraude-Engine
+ *
+ * Copyright (C) 2010-2025 - Sébastien Léon Claude Christian Bémelmans "LondNoir" <londnoir@gmail.com>
+ *
+ * Emeraude-Engine is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * Emeraude-Engine is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with Emeraude-Engine; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * Complete project and additional information can be found at :
+ * https://github.com/londnoir/emeraude-engine
+ *
+ * --- THIS IS AUTOMATICALLY GENERATED, DO NOT CHANGE ---
+ */
+
+
+#include <gtest/gtest.h>
+
+/* STL inclusions. */
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+/* Local inclusions. */
+#include "Libs/Randomizer.hpp"
+#include "Libs/TLSFAllocator.hpp"
+
+using namespace EmEn::Libs;
+
+/**
+ * @brief Checks that allocations do not overlap and stay in the range.
+ * @param allocator A reference to the allocator.
+ * @param allocations A reference to the live allocations.
+ * @return bool
+ */
+bool
+isLayoutValid (const TLSFAllocator & allocator, std::vector< TLSFAllocator::Allocation > allocations) noexcept
+{
+	std::sort(allocations.begin(), allocations.end(), [] (const auto & allocationA, const auto & allocationB) {
+		return allocationA.offset < allocationB.offset;
+	});
+
+	uint64_t end = 0;
+	uint64_t usedBytes = 0;
+
+	for ( const auto & allocation : allocations )
+	{
+		if ( allocation.offset < end || allocation.offset + allocation.size > allocator.capacity() )
+		{
+			return false;
+		}
+
+		end = allocation.offset + allocation.size;
+		usedBytes += allocation.size;
+	}
+
+	return usedBytes == allocator.usedBytes() && allocations.size() == allocator.allocationCount();
+}
+
+TEST(TLSFAllocator, allocateAndMerge)
+{
+	TLSFAllocator allocator{1024};
+
+	ASSERT_EQ(allocator.freeBlockCount(), 1);
+	ASSERT_EQ(allocator.largestFreeBlock(), 1024);
+
+	TLSFAllocator::Allocation first;
+	TLSFAllocator::Allocation second;
+	TLSFAllocator::Allocation third;
+
+	ASSERT_TRUE(allocator.allocate(100, 1, first));
+	ASSERT_TRUE(allocator.allocate(256, 1, second));
+	ASSERT_TRUE(allocator.allocate(200, 1, third));
+
+	/* NOTE: The sizes are rounded to the granularity. */
+	ASSERT_EQ(first.size, 112);
+	ASSERT_EQ(allocator.usedBytes(), 112 + 256 + 208);
+	ASSERT_TRUE(isLayoutValid(allocator, {first, second, third}));
+
+	allocator.free(second);
+
+	ASSERT_EQ(allocator.freeBlockCount(), 2);
+	ASSERT_GT(allocator.fragmentation(), 0.0F);
+
+	allocator.free(first);
+	allocator.free(third);
+
+	ASSERT_TRUE(allocator.isEmpty());
+	ASSERT_EQ(allocator.freeBlockCount(), 1);
+	ASSERT_EQ(allocator.largestFreeBlock(), 1024);
+	ASSERT_EQ(allocator.fragmentation(), 0.0F);
+}
+
+TEST(TLSFAllocator, alignmentAndExhaustion)
+{
+	TLSFAllocator allocator{65536};
+
+	TLSFAllocator::Allocation small;
+	TLSFAllocator::Allocation aligned;
+
+	ASSERT_TRUE(allocator.allocate(16, 1, small));
+	ASSERT_TRUE(allocator.allocate(1000, 4096, aligned));
+	ASSERT_EQ(aligned.offset % 4096, 0);
+	ASSERT_TRUE(isLayoutValid(allocator, {small, aligned}));
+
+	TLSFAllocator::Allocation failed;
+
+	ASSERT_FALSE(allocator.allocate(0, 1, failed));
+	ASSERT_FALSE(allocator.allocate(16, 3, failed));
+	ASSERT_FALSE(allocator.allocate(65536, 1, failed));
+
+	allocator.free(small);
+	allocator.free(aligned);
+
+	TLSFAllocator::Allocation whole;
+
+	ASSERT_TRUE(allocator.allocate(65536, 1, whole));
+	ASSERT_EQ(allocator.freeBytes(), 0);
+	ASSERT_FALSE(allocator.allocate(16, 1, failed));
+}
+
+TEST(TLSFAllocator, randomWorkload)
+{
+	constexpr uint64_t Capacity{64ULL * 1024 * 1024};
+
+	TLSFAllocator allocator{Capacity};
+	Randomizer< uint64_t > randomizer{1234};
+	std::vector< TLSFAllocator::Allocation > allocations;
+
+	for ( size_t step = 0; step < 20000; step++ )
+	{
+		if ( allocations.empty() || randomizer.value(0, 99) < 60 )
+		{
+			TLSFAllocator::Allocation allocation;
+
+			const auto size = randomizer.value(1, 256 * 1024);
+			const auto alignment = 1ULL << randomizer.value(0, 12);
+
+			if ( allocator.allocate(size, alignment, allocation) )
+			{
+				ASSERT_EQ(allocation.offset % alignment, 0);
+				ASSERT_GE(allocation.size, size);
+
+				allocations.push_back(allocation);
+			}
+		}
+		else
+		{
+			const auto index = randomizer.value(0, allocations.size() - 1);
+
+			allocator.free(allocations[index]);
+
+			allocations[index] = allocations.back();
+			allocations.pop_back();
+		}
+	}
+
+	ASSERT_TRUE(isLayoutValid(allocator, allocations));
+
+	for ( const auto & allocation : allocations )
+	{
+		allocator.free(allocation);
+	}
+
+	ASSERT_TRUE(allocator.isEmpty());
+	ASSERT_EQ(allocator.freeBlockCount(), 1);
+	ASSERT_EQ(allocator.largestFreeBlock(), Capacity);
+}
+
+TEST(TLSFAllocator, compact)
+{
+	TLSFAllocator allocator{4096};
+	std::vector< TLSFAllocator::Allocation > allocations(8);
+
+	for ( auto & allocation : allocations )
+	{
+		ASSERT_TRUE(allocator.allocate(256, 64, allocation));
+	}
+
+	/* NOTE: Every other allocation is released to fragment the range. */
+	for ( size_t index = 0; index < allocations.size(); index += 2 )
+	{
+		allocator.free(allocations[index]);
+	}
+
+	ASSERT_EQ(allocator.freeBlockCount(), 5);
+
+	std::vector< TLSFAllocator::Allocation > moved;
+
+	const auto movedCount = allocator.compact([&moved] (const TLSFAllocator::Allocation & allocation, uint64_t newOffset) {
+		/* NOTE: A refused move leaves the allocation in place. */
+		if ( allocation.offset == 1792 )
+		{
+			return false;
+		}
+
+		moved.push_back({newOffset, allocation.size, allocation.node});
+
+		return true;
+	});
+
+	ASSERT_EQ(movedCount, 3);
+	ASSERT_EQ(moved[0].offset, 0);
+	ASSERT_EQ(moved[1].offset, 256);
+	ASSERT_EQ(moved[2].offset, 512);
+	ASSERT_EQ(allocator.freeBlockCount(), 2);
+	ASSERT_EQ(allocator.largestFreeBlock(), 2048);
+
+	moved.push_back(allocations[7]);
+
+	ASSERT_TRUE(isLayoutValid(allocator, moved));
+
+	/* NOTE: The nodes are kept through the moves. */
+	for ( const auto & allocation : moved )
+	{
+		allocator.free(allocation);
+	}
+
+	ASSERT_TRUE(allocator.isEmpty());
+	ASSERT_EQ(allocator.largestFreeBlock(), 4096);
+}
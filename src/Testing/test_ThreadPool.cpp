@@ -0,0 +1,335 @@
+/*
+ * src/Testing/test_ThreadPool.cpp
+ * This file is part of Emeraude-Engine
+ *
+ * Copyright (C) 2010-2025 - Sébastien Léon Claude Christian Bémelmans "LondNoir" <londnoir@gmail.com>
+ *
+ * Emeraude-Engine is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * Emeraude-Engine is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with Emeraude-Engine; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * Complete project and additional information can be found at :
+ * https://github.com/londnoir/emeraude-engine
+ *
+ * --- THIS IS AUTOMATICALLY GENERATED, DO NOT CHANGE ---
+ */
+
+#include <gtest/gtest.h>
+
+/* STL inclusions. */
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <mutex>
+#include <numeric>
+#include <thread>
+#include <vector>
+
+/* Local inclusions. */
+#include "Libs/ThreadPool.hpp"
+#include "Libs/Randomizer.hpp"
+#include "Libs/Time/Elapsed/PrintScopeRealTime.hpp"
+
+using namespace EmEn::Libs;
+using namespace EmEn::Libs::Time::Elapsed;
+
+[[nodiscard]]
+static
+size_t
+fibonacci (size_t valueX) noexcept
+{
+	if ( valueX == 1 || valueX == 0 )
+	{
+		return valueX;
+	}
+
+	return fibonacci(valueX - 1) + fibonacci(valueX - 2);
+}
+
+TEST(ThreadPool, FibonacciWorkload)
+{
+	constexpr size_t jobCount{96};
+
+	ThreadPool threadPool{std::thread::hardware_concurrency()};
+
+	Randomizer< size_t > randomizer;
+
+	std::mutex resultsLock;
+	std::vector< size_t > results;
+
+	{
+		PrintScopeRealTime stat{"ThreadPool fibonacci x96"};
+
+		JobGroup group;
+
+		for ( size_t job = 0; job < jobCount; job++ )
+		{
+			const auto value = randomizer.value(1, 32);
+
+			threadPool.submit([value, &resultsLock, &results] () {
+				const auto result = fibonacci(value);
+
+				const std::lock_guard< std::mutex > lock{resultsLock};
+
+				results.emplace_back(result);
+			}, group);
+		}
+
+		threadPool.wait(group);
+
+		ASSERT_TRUE(group.finished());
+	}
+
+	ASSERT_EQ(results.size(), jobCount);
+}
+
+TEST(ThreadPool, DestructorWaitForJobDone)
+{
+	constexpr size_t jobCount{256};
+
+	std::atomic< size_t > doneCount{0};
+
+	{
+		ThreadPool threadPool{4};
+
+		for ( size_t job = 0; job < jobCount; job++ )
+		{
+			threadPool.submit([&doneCount] () {
+				doneCount.fetch_add(1);
+			}, ThreadPool::Priority::Low);
+		}
+	}
+
+	ASSERT_EQ(doneCount.load(), jobCount);
+}
+
+TEST(ThreadPool, StopFinishesNestedJobs)
+{
+	constexpr size_t jobCount{64};
+
+	ThreadPool threadPool{4};
+
+	std::atomic< size_t > doneCount{0};
+
+	/* NOTE: Each job queues another one, which must run even if the pool is stopping. */
+	for ( size_t job = 0; job < jobCount; job++ )
+	{
+		threadPool.submit([&threadPool, &doneCount] () {
+			std::this_thread::sleep_for(std::chrono::microseconds{100});
+
+			threadPool.submit([&doneCount] () {
+				doneCount.fetch_add(1);
+			});
+
+			doneCount.fetch_add(1);
+		});
+	}
+
+	threadPool.stop();
+
+	ASSERT_EQ(doneCount.load(), jobCount * 2);
+	ASSERT_EQ(threadPool.workerCount(), 0);
+
+	/* NOTE: A stopped pool executes the jobs on the calling thread. */
+	const auto callerId = std::this_thread::get_id();
+
+	bool sameThread = false;
+
+	JobGroup group;
+
+	threadPool.submit([&sameThread, callerId] () {
+		sameThread = std::this_thread::get_id() == callerId;
+	}, group);
+
+	ASSERT_TRUE(group.finished());
+	ASSERT_TRUE(sameThread);
+
+	threadPool.stop();
+}
+
+TEST(ThreadPool, NoWorkerRunsInline)
+{
+	ThreadPool threadPool{0};
+
+	const auto callerId = std::this_thread::get_id();
+
+	bool sameThread = false;
+
+	JobGroup group;
+
+	threadPool.submit([&sameThread, callerId] () {
+		sameThread = std::this_thread::get_id() == callerId;
+	}, group);
+
+	ASSERT_TRUE(group.finished());
+	ASSERT_TRUE(sameThread);
+}
+
+TEST(ThreadPool, ParallelFor)
+{
+	constexpr size_t count{1000000};
+
+	ThreadPool threadPool{std::thread::hardware_concurrency()};
+
+	std::vector< size_t > values(count, 0);
+
+	threadPool.parallelFor(0, count, [&values] (size_t first, size_t last) {
+		for ( auto index = first; index < last; index++ )
+		{
+			values[index] = index;
+		}
+	});
+
+	ASSERT_EQ(std::accumulate(values.cbegin(), values.cend(), 0UL), count * (count - 1) / 2);
+
+	/* Empty and single element ranges. */
+	size_t calls = 0;
+
+	threadPool.parallelFor(10, 10, [&calls] (size_t, size_t) {
+		calls++;
+	});
+
+	ASSERT_EQ(calls, 0);
+
+	threadPool.parallelFor(10, 11, [&calls] (size_t first, size_t last) {
+		calls += last - first;
+	});
+
+	ASSERT_EQ(calls, 1);
+}
+
+TEST(ThreadPool, NestedParallelFor)
+{
+	constexpr size_t outerCount{64};
+	constexpr size_t innerCount{1000};
+
+	/* NOTE: Two workers only, nested waits must help instead of blocking the pool. */
+	ThreadPool threadPool{2};
+
+	std::atomic< size_t > total{0};
+
+	threadPool.parallelFor(0, outerCount, [&threadPool, &total] (size_t first, size_t last) {
+		for ( auto outer = first; outer < last; outer++ )
+		{
+			threadPool.parallelFor(0, innerCount, [&total] (size_t innerFirst, size_t innerLast) {
+				total.fetch_add(innerLast - innerFirst);
+			}, 10);
+		}
+	}, 1);
+
+	ASSERT_EQ(total.load(), outerCount * innerCount);
+}
+
+TEST(ThreadPool, Priorities)
+{
+	ThreadPool threadPool{1};
+
+	std::mutex orderLock;
+	std::vector< int > order;
+
+	JobGroup group;
+
+	/* NOTE: Block the only worker while queuing the other jobs. */
+	std::atomic< bool > release{false};
+
+	threadPool.submit([&release] () {
+		while ( !release.load() )
+		{
+			std::this_thread::yield();
+		}
+	}, group);
+
+	while ( threadPool.queuedJobs() > 0 )
+	{
+		std::this_thread::yield();
+	}
+
+	for ( const auto priority : {ThreadPool::Priority::Low, ThreadPool::Priority::Normal, ThreadPool::Priority::High} )
+	{
+		threadPool.submit([priority, &orderLock, &order] () {
+			const std::lock_guard< std::mutex > lock{orderLock};
+
+			order.emplace_back(static_cast< int >(priority));
+		}, group, priority);
+	}
+
+	release.store(true);
+
+	/* NOTE: Wait from the worker side only, the calling thread would steal jobs otherwise. */
+	while ( !group.finished() )
+	{
+		std::this_thread::yield();
+	}
+
+	threadPool.wait(group);
+
+	ASSERT_EQ(order, (std::vector< int >{0, 1, 2}));
+}
+
+TEST(TaskGraph, Dependencies)
+{
+	ThreadPool threadPool{std::thread::hardware_concurrency()};
+
+	std::mutex orderLock;
+	std::vector< TaskGraph::TaskId > order;
+
+	TaskGraph graph;
+
+	const auto record = [&orderLock, &order] (TaskGraph::TaskId taskId) {
+		const std::lock_guard< std::mutex > lock{orderLock};
+
+		order.emplace_back(taskId);
+	};
+
+	/* Diamond : A -> (B, C) -> D */
+	const auto taskA = graph.addTask([&record] () { record(0); });
+	const auto taskB = graph.addTask([&record] () { record(1); });
+	const auto taskC = graph.addTask([&record] () { record(2); });
+	const auto taskD = graph.addTask([&record] () { record(3); });
+
+	ASSERT_TRUE(graph.addDependency(taskB, taskA));
+	ASSERT_TRUE(graph.addDependency(taskC, taskA));
+	ASSERT_TRUE(graph.addDependency(taskD, taskB));
+	ASSERT_TRUE(graph.addDependency(taskD, taskC));
+	ASSERT_FALSE(graph.addDependency(taskD, taskD));
+	ASSERT_FALSE(graph.addDependency(taskD, 42));
+
+	/* NOTE: A graph can be executed several times. */
+	for ( size_t run = 0; run < 2; run++ )
+	{
+		order.clear();
+
+		ASSERT_TRUE(graph.execute(threadPool));
+		ASSERT_EQ(order.size(), 4);
+		ASSERT_EQ(order.front(), taskA);
+		ASSERT_EQ(order.back(), taskD);
+	}
+}
+
+TEST(TaskGraph, Cycle)
+{
+	ThreadPool threadPool{2};
+
+	size_t calls = 0;
+
+	TaskGraph graph;
+
+	const auto taskA = graph.addTask([&calls] () { calls++; });
+	const auto taskB = graph.addTask([&calls] () { calls++; });
+
+	ASSERT_TRUE(graph.addDependency(taskA, taskB));
+	ASSERT_TRUE(graph.addDependency(taskB, taskA));
+
+	ASSERT_FALSE(graph.execute(threadPool));
+	ASSERT_EQ(calls, 0);
+}
@@ -0,0 +1,81 @@
+/*
+ * src/Testing/test_TimeStatisticsHistogram.cpp
+ * This file is part of Emeraude-Engine
+ *
+ * Copyright (C) 2010-2025 - Sébastien Léon Claude Christian Bémelmans "LondNoir" <londnoir@gmail.com>
+ *
+ * Emeraude-Engine is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * Emeraude-Engine is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with Emeraude-Engine; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * Complete project and additional information can be found at :
+ * https://github.com/londnoir/emeraude-engine
+ *
+ * --- THIS IS AUTOMATICALLY GENERATED, DO NOT CHANGE ---
+ */
+
+#include <gtest/gtest.h>
+
+/* Local inclusions. */
+#include "Libs/Time/Statistics/Histogram.hpp"
+
+using namespace EmEn::Libs::Time::Statistics;
+
+TEST(TimeStatisticsHistogram, Distribution)
+{
+	Histogram histogram{100};
+
+	ASSERT_EQ(histogram.count(), 0);
+	ASSERT_EQ(histogram.percentile(99.0), 0.0);
+
+	/* NOTE: Insert 1 to 100 in a shuffled order. */
+	for ( int value = 0; value < 100; value++ )
+	{
+		histogram.insert(static_cast< double >((value * 37) % 100 + 1));
+	}
+
+	ASSERT_EQ(histogram.count(), 100);
+	ASSERT_EQ(histogram.minimum(), 1.0);
+	ASSERT_EQ(histogram.maximum(), 100.0);
+	ASSERT_DOUBLE_EQ(histogram.average(), 50.5);
+	ASSERT_EQ(histogram.percentile(50.0), 50.0);
+	ASSERT_EQ(histogram.percentile(99.0), 99.0);
+	ASSERT_EQ(histogram.percentile(100.0), 100.0);
+}
+
+TEST(TimeStatisticsHistogram, SlidingWindow)
+{
+	Histogram histogram{4};
+
+	histogram.insert(1000.0);
+
+	ASSERT_EQ(histogram.count(), 1);
+	ASSERT_EQ(histogram.minimum(), 1000.0);
+
+	for ( int value = 1; value <= 4; value++ )
+	{
+		histogram.insert(static_cast< double >(value));
+	}
+
+	/* NOTE: The first sample must be forgotten. */
+	ASSERT_EQ(histogram.count(), 4);
+	ASSERT_EQ(histogram.topCount(), 5);
+	ASSERT_EQ(histogram.last(), 4.0);
+	ASSERT_EQ(histogram.maximum(), 4.0);
+	ASSERT_DOUBLE_EQ(histogram.average(), 2.5);
+
+	histogram.reset();
+
+	ASSERT_EQ(histogram.count(), 0);
+	ASSERT_EQ(histogram.last(), 0.0);
+}
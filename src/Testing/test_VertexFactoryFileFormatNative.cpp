@@ -0,0 +1,217 @@
+/*
+ * src/Testing/test_VertexFactoryFileFormatNative.cpp
+ * This file is part of Emeraude-Engine
+ *
+ * Copyright (C) 2010-2025 - Sébastien Léon Claude Christian Bémelmans "LondNoir" <londnoir@gmail.com>
+ *
+ * Emeraude-Engine is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * Emeraude-Engine is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with Emeraude-Engine; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * Complete project and additional information can be found at :
+ * https://github.com/londnoir/emeraude-engine
+ *
+ * --- THIS IS AUTOMATICALLY GENERATED, DO NOT CHANGE ---
+ */
+
+#include <gtest/gtest.h>
+
+/* STL inclusions. */
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <vector>
+
+/* Local inclusions. */
+#include "Libs/VertexFactory/FileFormatNative.hpp"
+#include "Libs/VertexFactory/ShapeGenerator.hpp"
+#include "Libs/VertexFactory/ShapeSimplifier.hpp"
+#include "Constants.hpp"
+
+using namespace EmEn::Libs;
+using namespace EmEn::Libs::Math;
+using namespace EmEn::Libs::VertexFactory;
+
+/**
+ * @brief Creates a colored sphere with two groups.
+ * @return Shape< float, uint32_t >
+ */
+Shape< float, uint32_t >
+createColoredSphere () noexcept
+{
+	ShapeBuilderOptions< float > options{};
+	options.enableGlobalVertexColor(PixelFactory::Red);
+
+	auto sphere = ShapeGenerator::generateSphere(2.0F, 24U, 12U, options);
+	sphere.computeTriangleTBNSpace();
+	sphere.computeVertexTBNSpace();
+
+	return sphere;
+}
+
+TEST(VertexFactoryFileFormatNative, roundTrip)
+{
+	const auto filepath = testOutputPath("roundtrip.emgeo");
+	const auto source = createColoredSphere();
+
+	ASSERT_TRUE(source.isVertexColorAvailable());
+
+	FileFormatNative< float, uint32_t > fileFormat;
+
+	ASSERT_TRUE(fileFormat.writeFile(filepath, source));
+
+	Shape< float, uint32_t > shape;
+
+	ASSERT_TRUE(fileFormat.readFile(filepath, shape, {}));
+	ASSERT_TRUE(shape.isValid());
+	ASSERT_TRUE(shape.isTextureCoordinatesAvailable());
+	ASSERT_TRUE(shape.isVertexColorAvailable());
+	ASSERT_EQ(shape.vertices().size(), source.vertices().size());
+	ASSERT_EQ(shape.triangles().size(), source.triangles().size());
+	ASSERT_EQ(shape.groups(), source.groups());
+
+	for ( size_t vertexIndex = 0; vertexIndex < source.vertices().size(); ++vertexIndex )
+	{
+		const auto & expected = source.vertices()[vertexIndex];
+		const auto & vertex = shape.vertices()[vertexIndex];
+
+		ASSERT_EQ(vertex.position(), expected.position());
+		ASSERT_EQ(vertex.normal(), expected.normal());
+		ASSERT_EQ(vertex.tangent(), expected.tangent());
+		ASSERT_EQ(vertex.textureCoordinates()[X], expected.textureCoordinates()[X]);
+		ASSERT_EQ(vertex.textureCoordinates()[Y], expected.textureCoordinates()[Y]);
+	}
+
+	for ( size_t triangleIndex = 0; triangleIndex < source.triangles().size(); ++triangleIndex )
+	{
+		for ( uint32_t corner = 0; corner < 3; ++corner )
+		{
+			const auto vertexIndex = source.triangles()[triangleIndex].vertexIndex(corner);
+
+			ASSERT_EQ(shape.triangles()[triangleIndex].vertexIndex(corner), vertexIndex);
+			ASSERT_EQ(shape.vertexColors()[shape.triangles()[triangleIndex].vertexColorIndex(corner)], source.vertexColors()[source.triangles()[triangleIndex].vertexColorIndex(corner)]);
+		}
+	}
+
+	EXPECT_EQ(shape.boundingBox().maximum(), source.boundingBox().maximum());
+	EXPECT_EQ(shape.boundingBox().minimum(), source.boundingBox().minimum());
+
+	std::filesystem::remove(filepath);
+}
+
+TEST(VertexFactoryFileFormatNative, mappedStreams)
+{
+	const auto filepath = testOutputPath("streams.emgeo");
+	const auto source = createColoredSphere();
+
+	ShapeSimplifier simplifier{source};
+
+	const auto levelsOfDetail = simplifier.generateLODChain(2, 0.5F);
+
+	ASSERT_FALSE(levelsOfDetail.empty());
+
+	FileFormatNative< float, uint32_t > fileFormat;
+
+	const NativeVertexLayout layout{NormalType::TBNSpace, TextureCoordinatesType::UV, VertexColorType::RGBA, SkeletalAnimationType::None};
+
+	ASSERT_TRUE(fileFormat.writeLevels(filepath, source, levelsOfDetail, {0.25F, 0.125F}, layout));
+
+	ASSERT_TRUE(fileFormat.open(filepath));
+	ASSERT_EQ(fileFormat.layout(), layout);
+	ASSERT_EQ(fileFormat.levelCount(), 1 + levelsOfDetail.size());
+	EXPECT_EQ(fileFormat.screenSize(0), 0.0F);
+	EXPECT_EQ(fileFormat.screenSize(1), 0.25F);
+	EXPECT_EQ(fileFormat.boundingSphere().radius(), source.boundingSphere().radius());
+
+	/* NOTE: The streams must be the buffers a geometry resource would upload. */
+	std::vector< float > vertices;
+	std::vector< uint32_t > indices;
+
+	const auto vertexElementCount = source.createIndexedVertexBuffer(vertices, indices, layout.normalType, layout.textureCoordinatesType, layout.vertexColorType);
+
+	ASSERT_EQ(fileFormat.vertexElementCount(), vertexElementCount);
+	ASSERT_EQ(fileFormat.vertexCount(0), source.vertexCount());
+
+	const auto vertexStream = fileFormat.vertexStream(0);
+	const auto indexStream = fileFormat.indexStream(0);
+
+	ASSERT_EQ(reinterpret_cast< uintptr_t >(vertexStream.data()) % (FileFormatNative< float, uint32_t >::StreamAlignment), 0);
+	ASSERT_TRUE(std::equal(vertexStream.begin(), vertexStream.end(), vertices.begin(), vertices.end()));
+	ASSERT_TRUE(std::equal(indexStream.begin(), indexStream.end(), indices.begin(), indices.end()));
+
+	for ( uint32_t level = 1; level < fileFormat.levelCount(); ++level )
+	{
+		Shape< float, uint32_t > shape;
+
+		ASSERT_TRUE(fileFormat.extractLevel(level, shape));
+		ASSERT_EQ(shape.triangles().size(), levelsOfDetail[level - 1].triangles().size());
+	}
+
+	fileFormat.close();
+
+	std::filesystem::remove(filepath);
+}
+
+TEST(VertexFactoryFileFormatNative, corruptedFiles)
+{
+	const auto filepath = testOutputPath("corrupted.emgeo");
+	const auto source = ShapeGenerator::generateCuboid(1.0F);
+
+	FileFormatNative< float, uint32_t > fileFormat;
+
+	ASSERT_TRUE(fileFormat.writeFile(filepath, source));
+
+	std::vector< char > content(std::filesystem::file_size(filepath));
+
+	{
+		std::ifstream file{filepath, std::ios::binary};
+		file.read(content.data(), static_cast< std::streamsize >(content.size()));
+	}
+
+	const auto rewrite = [&filepath] (const std::vector< char > & data, size_t size) {
+		std::ofstream file{filepath, std::ios::binary | std::ios::trunc};
+		file.write(data.data(), static_cast< std::streamsize >(size));
+	};
+
+	Shape< float, uint32_t > shape;
+
+	/* Truncated file. */
+	rewrite(content, content.size() - 32);
+	EXPECT_FALSE(fileFormat.readFile(filepath, shape, {}));
+
+	/* Bad signature. */
+	auto badMagic = content;
+	badMagic[0] = 'X';
+	rewrite(badMagic, badMagic.size());
+	EXPECT_FALSE(fileFormat.readFile(filepath, shape, {}));
+
+	/* Out of range index, in the first index of the level 0. The first stream follows the headers at 128 bytes. */
+	rewrite(content, content.size());
+	ASSERT_TRUE(fileFormat.open(filepath));
+	const auto indexOffset = 128 + static_cast< size_t >(reinterpret_cast< const char * >(fileFormat.indexStream(0).data()) - reinterpret_cast< const char * >(fileFormat.vertexStream(0).data()));
+	fileFormat.close();
+
+	auto badIndex = content;
+	const uint32_t outOfRange = source.vertexCount();
+	std::memcpy(badIndex.data() + indexOffset, &outOfRange, sizeof(outOfRange));
+	rewrite(badIndex, badIndex.size());
+	EXPECT_FALSE(fileFormat.readFile(filepath, shape, {}));
+
+	/* The intact content is read again. */
+	rewrite(content, content.size());
+	EXPECT_TRUE(fileFormat.readFile(filepath, shape, {}));
+
+	std::filesystem::remove(filepath);
+}
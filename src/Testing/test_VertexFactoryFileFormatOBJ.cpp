@@ -0,0 +1,290 @@
+/*
+ * src/Testing/test_VertexFactoryFileFormatOBJ.cpp
+ * This file is part of Emeraude-Engine
+ *
+ * Copyright (C) 2010-2025 - Sébastien Léon Claude Christian Bémelmans "LondNoir" <londnoir@gmail.com>
+ *
+ * Emeraude-Engine is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * Emeraude-Engine is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with Emeraude-Engine; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * Complete project and additional information can be found at :
+ * https://github.com/londnoir/emeraude-engine
+ *
+ * --- THIS IS AUTOMATICALLY GENERATED, DO NOT CHANGE ---
+ */
+
+#include <gtest/gtest.h>
+
+/* STL inclusions. */
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+/* Local inclusions. */
+#include "Libs/ThreadPool.hpp"
+#include "Libs/VertexFactory/FileFormatOBJ.hpp"
+
+using namespace EmEn::Libs;
+using namespace EmEn::Libs::Math;
+using namespace EmEn::Libs::VertexFactory;
+
+/**
+ * @brief Reads an OBJ text into a shape.
+ * @param content A reference to the OBJ text.
+ * @param shape A reference to the shape.
+ * @param threadPool A pointer to the thread pool shared during the read. Default none.
+ * @return bool
+ */
+bool
+readOBJ (const std::string & content, Shape< float, uint32_t > & shape, ThreadPool * threadPool = nullptr) noexcept
+{
+	FileFormatOBJ< float, uint32_t > fileFormat;
+
+	ThreadPool::setShared(threadPool);
+
+	const auto result = fileFormat.readContent(content, shape, {});
+
+	ThreadPool::setShared(nullptr);
+
+	return result;
+}
+
+/**
+ * @brief Creates a large OBJ text of a grid with normals, texture coordinates and relative indices.
+ * @param size The number of quads on each side.
+ * @return std::string
+ */
+std::string
+createGridOBJ (uint32_t size) noexcept
+{
+	std::stringstream output;
+
+	output << "# Grid" "\n" "g Grid" "\n";
+
+	for ( uint32_t y = 0; y <= size; ++y )
+	{
+		for ( uint32_t x = 0; x <= size; ++x )
+		{
+			output << "v " << x << ".5 " << y << ".25 -0.125" "\n";
+			output << "vt " << static_cast< float >(x) / static_cast< float >(size) << ' ' << static_cast< float >(y) / static_cast< float >(size) << "\n";
+		}
+	}
+
+	output << "vn 0 0 1" "\n";
+
+	for ( uint32_t y = 0; y < size; ++y )
+	{
+		for ( uint32_t x = 0; x < size; ++x )
+		{
+			const auto a = y * (size + 1) + x + 1;
+			const auto b = a + 1;
+			const auto c = a + size + 2;
+			const auto d = a + size + 1;
+
+			if ( (x + y) % 2 == 0 )
+			{
+				output << "f " << a << '/' << a << "/1 " << b << '/' << b << "/1 " << c << '/' << c << "/1 " << d << '/' << d << "/1" "\n";
+			}
+			else
+			{
+				/* NOTE: Relative indices against the last declared normal. */
+				output << "f " << a << '/' << a << "/-1 " << b << '/' << b << "/-1 " << c << '/' << c << "/-1" "\r\n";
+				output << "f " << a << '/' << a << "/-1 " << c << '/' << c << "/-1 " << d << '/' << d << "/-1" "\n";
+			}
+		}
+	}
+
+	return output.str();
+}
+
+TEST(VertexFactoryFileFormatOBJ, triangleAndQuad)
+{
+	Shape< float, uint32_t > shape;
+
+	ASSERT_TRUE(readOBJ(
+		"v 0 0 0" "\n"
+		"v 1 0 0" "\n"
+		"v 1 1 0" "\n"
+		"v 0 1 0" "\n"
+		"f 1 2 3" "\n"
+		"f 1 2 3 4" "\n",
+		shape
+	));
+
+	ASSERT_EQ(shape.vertices().size(), 4);
+	ASSERT_EQ(shape.triangles().size(), 3);
+	EXPECT_EQ(shape.vertices()[2].position(), (Vector< 3, float >{1.0F, 1.0F, 0.0F}));
+	EXPECT_EQ(shape.triangles()[2].vertexIndex(0), 0);
+	EXPECT_EQ(shape.triangles()[2].vertexIndex(1), 2);
+	EXPECT_EQ(shape.triangles()[2].vertexIndex(2), 3);
+}
+
+TEST(VertexFactoryFileFormatOBJ, polygonFan)
+{
+	Shape< float, uint32_t > shape;
+
+	ASSERT_TRUE(readOBJ(
+		"v 0 0 0" "\n" "v 2 0 0" "\n" "v 3 1 0" "\n" "v 1 2 0" "\n" "v -1 1 0" "\n" "v 0 3 0" "\n"
+		"f 1 2 3 4 5 6" "\n",
+		shape
+	));
+
+	ASSERT_EQ(shape.triangles().size(), 4);
+
+	for ( uint32_t triangleIndex = 0; triangleIndex < 4; ++triangleIndex )
+	{
+		EXPECT_EQ(shape.triangles()[triangleIndex].vertexIndex(0), 0);
+		EXPECT_EQ(shape.triangles()[triangleIndex].vertexIndex(1), triangleIndex + 1);
+		EXPECT_EQ(shape.triangles()[triangleIndex].vertexIndex(2), triangleIndex + 2);
+	}
+}
+
+TEST(VertexFactoryFileFormatOBJ, negativeIndices)
+{
+	Shape< float, uint32_t > shape;
+
+	ASSERT_TRUE(readOBJ(
+		"v 0 0 0" "\n" "v 1 0 0" "\n" "v 1 1 0" "\n"
+		"f -3 -2 -1" "\n"
+		"v 0 1 0" "\n"
+		"f -4 -2 -1" "\n",
+		shape
+	));
+
+	ASSERT_EQ(shape.triangles().size(), 2);
+	EXPECT_EQ(shape.triangles()[0].vertexIndex(0), 0);
+	EXPECT_EQ(shape.triangles()[0].vertexIndex(2), 2);
+	EXPECT_EQ(shape.triangles()[1].vertexIndex(0), 0);
+	EXPECT_EQ(shape.triangles()[1].vertexIndex(1), 2);
+	EXPECT_EQ(shape.triangles()[1].vertexIndex(2), 3);
+}
+
+TEST(VertexFactoryFileFormatOBJ, attributeCombinations)
+{
+	Shape< float, uint32_t > shape;
+
+	/* NOTE: The position 1 is used with two texture coordinates, so it becomes two shape vertices. */
+	ASSERT_TRUE(readOBJ(
+		"v 0 0 0" "\n" "v 1 0 0" "\n" "v 1 1 0" "\n" "v 0 1 0" "\n"
+		"vt 0 0" "\n" "vt 1 0" "\n" "vt 1 1" "\n" "vt 0.5 0.5" "\n"
+		"vn 0 0 1" "\n"
+		"f 1/1/1 2/2/1 3/3/1" "\n"
+		"f 1/4/1 3/3/1 4/4/1" "\n",
+		shape
+	));
+
+	ASSERT_EQ(shape.vertices().size(), 5);
+	ASSERT_EQ(shape.triangles().size(), 2);
+	EXPECT_TRUE(shape.isTextureCoordinatesAvailable());
+
+	const auto & vertexA = shape.vertices()[shape.triangles()[0].vertexIndex(0)];
+	const auto & vertexB = shape.vertices()[shape.triangles()[1].vertexIndex(0)];
+
+	EXPECT_EQ(vertexA.position(), vertexB.position());
+	EXPECT_NE(vertexA.textureCoordinates(), vertexB.textureCoordinates());
+	EXPECT_EQ(vertexA.normal(), (Vector< 3, float >{0.0F, 0.0F, 1.0F}));
+	EXPECT_EQ(shape.triangles()[0].vertexIndex(2), shape.triangles()[1].vertexIndex(1));
+}
+
+TEST(VertexFactoryFileFormatOBJ, groups)
+{
+	Shape< float, uint32_t > shape;
+
+	ASSERT_TRUE(readOBJ(
+		"v 0 0 0" "\n" "v 1 0 0" "\n" "v 1 1 0" "\n" "v 0 1 0" "\n"
+		"g First" "\n"
+		"f 1 2 3 4" "\n"
+		"g Empty" "\n"
+		"g Second" "\n"
+		"f 1 3 4" "\n",
+		shape
+	));
+
+	ASSERT_EQ(shape.groups().size(), 2);
+	EXPECT_EQ(shape.groups()[0], (std::pair< uint32_t, uint32_t >{0, 2}));
+	EXPECT_EQ(shape.groups()[1], (std::pair< uint32_t, uint32_t >{2, 1}));
+}
+
+TEST(VertexFactoryFileFormatOBJ, malformedContent)
+{
+	Shape< float, uint32_t > shape;
+
+	EXPECT_FALSE(readOBJ("v 0 0 0" "\n" "v 1 0 0" "\n" "v 1 1 0" "\n" "f 1 2" "\n", shape));
+	EXPECT_FALSE(readOBJ("v 0 0 0" "\n" "v 1 0 0" "\n" "v 1 1 0" "\n" "f 1 2 4" "\n", shape));
+	EXPECT_FALSE(readOBJ("v 0 0 0" "\n" "v 1 0 0" "\n" "v 1 1 0" "\n" "f 1 2 0" "\n", shape));
+	EXPECT_FALSE(readOBJ("v 0 zero 0" "\n" "f 1 1 1" "\n", shape));
+	EXPECT_FALSE(readOBJ("# No geometry" "\n", shape));
+}
+
+TEST(VertexFactoryFileFormatOBJ, parallelMatchesSequential)
+{
+	const auto content = createGridOBJ(400);
+
+	ASSERT_GT(content.size(), (4 * FileFormatOBJ< float, uint32_t >::MinimumChunkSize));
+
+	Shape< float, uint32_t > sequential;
+	Shape< float, uint32_t > parallel;
+
+	ThreadPool threadPool{3};
+
+	ASSERT_TRUE(readOBJ(content, sequential));
+	ASSERT_TRUE(readOBJ(content, parallel, &threadPool));
+
+	ASSERT_EQ(sequential.vertices().size(), 401 * 401);
+	ASSERT_EQ(sequential.triangles().size(), 400 * 400 * 2);
+	ASSERT_EQ(parallel.vertices().size(), sequential.vertices().size());
+	ASSERT_EQ(parallel.triangles().size(), sequential.triangles().size());
+
+	for ( size_t vertexIndex = 0; vertexIndex < sequential.vertices().size(); ++vertexIndex )
+	{
+		ASSERT_EQ(parallel.vertices()[vertexIndex].position(), sequential.vertices()[vertexIndex].position());
+		ASSERT_EQ(parallel.vertices()[vertexIndex].textureCoordinates(), sequential.vertices()[vertexIndex].textureCoordinates());
+	}
+
+	for ( size_t triangleIndex = 0; triangleIndex < sequential.triangles().size(); ++triangleIndex )
+	{
+		for ( uint32_t corner = 0; corner < 3; ++corner )
+		{
+			ASSERT_EQ(parallel.triangles()[triangleIndex].vertexIndex(corner), sequential.triangles()[triangleIndex].vertexIndex(corner));
+		}
+	}
+}
+
+TEST(VertexFactoryFileFormatOBJ, readMappedFile)
+{
+	const auto filepath = std::filesystem::temp_directory_path() / "emeraude_test_grid.obj";
+
+	{
+		std::ofstream file{filepath, std::ios::binary};
+
+		file << createGridOBJ(16);
+	}
+
+	FileFormatOBJ< float, uint32_t > fileFormat;
+	Shape< float, uint32_t > shape;
+
+	ReadOptions readOptions{};
+	readOptions.flipYAxis = true;
+
+	ASSERT_TRUE(fileFormat.readFile(filepath, shape, readOptions));
+	EXPECT_EQ(shape.vertices().size(), 17 * 17);
+	EXPECT_EQ(shape.triangles().size(), 16 * 16 * 2);
+	EXPECT_EQ(shape.vertices()[0].position(), (Vector< 3, float >{0.5F, -0.25F, -0.125F}));
+
+	std::filesystem::remove(filepath);
+
+	EXPECT_FALSE(fileFormat.readFile(filepath, shape, readOptions));
+}
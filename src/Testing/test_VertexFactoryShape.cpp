@@ -0,0 +1,359 @@
+/*
+ * src/Testing/test_VertexFactoryShape.cpp
+ * This file is part of Emeraude-Engine
+ *
+ * Copyright (C) 2010-2025 - Sébastien Léon Claude Christian Bémelmans "LondNoir" <londnoir@gmail.com>
+ *
+ * Emeraude-Engine is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * Emeraude-Engine is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with Emeraude-Engine; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * Complete project and additional information can be found at :
+ * https://github.com/londnoir/emeraude-engine
+ *
+ * --- THIS IS AUTOMATICALLY GENERATED, DO NOT CHANGE ---
+ */
+
+#include <gtest/gtest.h>
+
+/* STL inclusions. */
+#include <cstdint>
+#include <vector>
+
+/* Local inclusions. */
+#include "Libs/VertexFactory/Shape.hpp"
+
+using namespace EmEn::Libs;
+using namespace EmEn::Libs::Math;
+using namespace EmEn::Libs::VertexFactory;
+
+/**
+ * @brief Creates a grid of quads as a triangle soup, every triangle owning its three vertices.
+ * @param size The number of quads on each side.
+ * @param jitter A position offset applied to odd vertices.
+ * @return Shape< float, uint32_t >
+ */
+Shape< float, uint32_t >
+createGridSoup (uint32_t size, float jitter = 0.0F) noexcept
+{
+	Shape< float, uint32_t > shape;
+
+	uint32_t counter = 0;
+
+	const auto addVertex = [&] (uint32_t x, uint32_t y) {
+		const auto offset = (counter++ % 2 == 1) ? jitter : 0.0F;
+		const Vector< 3, float > position{static_cast< float >(x) + offset, static_cast< float >(y) - offset, 0.0F};
+		const Vector< 3, float > textureCoordinates{static_cast< float >(x) / static_cast< float >(size), static_cast< float >(y) / static_cast< float >(size), 0.0F};
+
+		return shape.saveVertex(position, Vector< 3, float >::positiveZ(), textureCoordinates);
+	};
+
+	for ( uint32_t y = 0; y < size; ++y )
+	{
+		for ( uint32_t x = 0; x < size; ++x )
+		{
+			ShapeTriangle< float > triangleA{addVertex(x, y), addVertex(x + 1, y), addVertex(x + 1, y + 1)};
+			ShapeTriangle< float > triangleB{addVertex(x, y), addVertex(x + 1, y + 1), addVertex(x, y + 1)};
+
+			shape.addTriangle(triangleA);
+			shape.addTriangle(triangleB);
+		}
+	}
+
+	return shape;
+}
+
+TEST(VertexFactoryShape, removeDuplicateVertices)
+{
+	auto shape = createGridSoup(8);
+
+	ASSERT_EQ(shape.vertexCount(), 8 * 8 * 6);
+	ASSERT_EQ(shape.triangles().size(), 8 * 8 * 2);
+
+	const auto removed = shape.removeDuplicateVertices();
+
+	ASSERT_EQ(shape.vertexCount(), 9 * 9);
+	ASSERT_EQ(removed, (8 * 8 * 6) - (9 * 9));
+	ASSERT_EQ(shape.triangles().size(), 8 * 8 * 2);
+	ASSERT_EQ(shape.groups().front().second, 8 * 8 * 2);
+
+	/* Every triangle keeps its geometry. */
+	const auto soup = createGridSoup(8);
+
+	for ( size_t triangleIndex = 0; triangleIndex < soup.triangles().size(); ++triangleIndex )
+	{
+		for ( uint32_t vertexIndex = 0; vertexIndex < 3; ++vertexIndex )
+		{
+			const auto & original = soup.vertex(soup.triangles()[triangleIndex].vertexIndex(vertexIndex));
+			const auto & welded = shape.vertex(shape.triangles()[triangleIndex].vertexIndex(vertexIndex));
+
+			ASSERT_EQ(original.position(), welded.position());
+			ASSERT_EQ(original.textureCoordinates(), welded.textureCoordinates());
+		}
+	}
+
+	/* A second pass has nothing to remove. */
+	ASSERT_EQ(shape.removeDuplicateVertices(), 0);
+}
+
+TEST(VertexFactoryShape, removeDoubleVerticesWithTolerance)
+{
+	auto shape = createGridSoup(8, 0.001F);
+
+	/* NOTE: The jitter breaks exact matching. */
+	auto exactShape = shape;
+	exactShape.removeDuplicateVertices();
+
+	ASSERT_GT(exactShape.vertexCount(), 9 * 9);
+
+	shape.removeDoubleVertices(0.01F);
+
+	ASSERT_EQ(shape.vertexCount(), 9 * 9);
+	ASSERT_EQ(shape.triangles().size(), 8 * 8 * 2);
+}
+
+TEST(VertexFactoryShape, removeDoubleVerticesKeepsAttributeSeams)
+{
+	Shape< float, uint32_t > shape;
+
+	/* Two triangles sharing an edge by position, with different normals (hard edge). */
+	const auto a0 = shape.saveVertex({0.0F, 0.0F, 0.0F}, {0.0F, 0.0F, 1.0F});
+	const auto b0 = shape.saveVertex({1.0F, 0.0F, 0.0F}, {0.0F, 0.0F, 1.0F});
+	const auto c0 = shape.saveVertex({0.0F, 1.0F, 0.0F}, {0.0F, 0.0F, 1.0F});
+	const auto a1 = shape.saveVertex({1.0F, 0.0F, 0.0F}, {1.0F, 0.0F, 0.0F});
+	const auto b1 = shape.saveVertex({0.0F, 1.0F, 0.0F}, {1.0F, 0.0F, 0.0F});
+	const auto c1 = shape.saveVertex({1.0F, 1.0F, -1.0F}, {1.0F, 0.0F, 0.0F});
+
+	/* Same positions and normals, but a texture coordinates seam. */
+	const auto a2 = shape.saveVertex({0.0F, 0.0F, 0.0F}, {0.0F, 0.0F, 1.0F}, {0.5F, 0.0F, 0.0F});
+	const auto b2 = shape.saveVertex({1.0F, 0.0F, 0.0F}, {0.0F, 0.0F, 1.0F});
+	const auto c2 = shape.saveVertex({0.0F, 0.0F, 0.0005F}, {0.0F, 0.0F, 1.0F});
+
+	ShapeTriangle< float > triangle0{a0, b0, c0};
+	ShapeTriangle< float > triangle1{a1, b1, c1};
+	ShapeTriangle< float > triangle2{a2, b2, c2};
+
+	shape.addTriangle(triangle0);
+	shape.addTriangle(triangle1);
+	shape.addTriangle(triangle2);
+
+	shape.removeDoubleVertices(0.001F);
+
+	/* NOTE: b2 joins b0, c2 joins a0 which is the first vertex at this place. The normals and the seam keep the rest apart. */
+	ASSERT_EQ(shape.vertexCount(), 7);
+	ASSERT_EQ(shape.triangles().size(), 3);
+
+	/* With a large tolerance, the third triangle collapses and is removed. */
+	shape.removeDoubleVertices(0.001F, 0.001F, 1.0F);
+
+	ASSERT_EQ(shape.vertexCount(), 6);
+	ASSERT_EQ(shape.triangles().size(), 2);
+	ASSERT_EQ(shape.groups().front().first, 0);
+	ASSERT_EQ(shape.groups().front().second, 2);
+}
+
+TEST(VertexFactoryShape, addVertexDataEconomy)
+{
+	Shape< float, uint32_t > shape;
+
+	const auto indexA = shape.addVertex({1.0F, 2.0F, 3.0F}, {0.0F, 1.0F, 0.0F}, {0.5F, 0.5F, 0.0F});
+	const auto indexB = shape.addVertex({1.0F, 2.0F, 3.0F}, {0.0F, 1.0F, 0.0F}, {0.25F, 0.5F, 0.0F});
+	const auto indexC = shape.addVertex({1.0F, 2.0F, 3.0F}, {0.0F, 1.0F, 0.0F}, {0.5F, 0.5F, 0.0F});
+	const auto indexD = shape.addVertex({1.0F, 2.0F, 3.0F}, {0.0F, 1.0F, 0.0F});
+
+	ASSERT_NE(indexA, indexB);
+	ASSERT_EQ(indexA, indexC);
+	ASSERT_EQ(indexD, indexA);
+	ASSERT_EQ(shape.vertexCount(), 2);
+
+	/* NOTE: The lookup follows the vertices moved in place. */
+	shape.transform(Matrix< 4, float >::translation(1.0F, 0.0F, 0.0F), false);
+
+	ASSERT_EQ(shape.addVertex({2.0F, 2.0F, 3.0F}), indexA);
+	ASSERT_EQ(shape.addVertex({1.0F, 2.0F, 3.0F}), 2);
+
+	ASSERT_EQ(shape.addVertexColor({1.0F, 0.0F, 0.0F, 1.0F}), 0);
+	ASSERT_EQ(shape.addVertexColor({0.0F, 1.0F, 0.0F, 1.0F}), 1);
+	ASSERT_EQ(shape.addVertexColor({1.0F, 0.0F, 0.0F, 1.0F}), 0);
+}
+
+TEST(VertexFactoryShape, createIndexedVertexBuffer)
+{
+	auto shape = createGridSoup(4);
+
+	shape.removeDuplicateVertices();
+
+	std::vector< float > vertexBuffer;
+	std::vector< uint32_t > indexBuffer;
+
+	const auto elementCount = shape.createIndexedVertexBuffer(vertexBuffer, indexBuffer, NormalType::Normal, TextureCoordinatesType::UV);
+
+	ASSERT_EQ(elementCount, 8);
+	ASSERT_EQ(vertexBuffer.size(), shape.vertexCount() * elementCount);
+	ASSERT_EQ(indexBuffer.size(), shape.triangles().size() * 3);
+
+	for ( size_t index = 0; index < indexBuffer.size(); ++index )
+	{
+		const auto vertexIndex = indexBuffer[index];
+		const auto & vertex = shape.vertex(vertexIndex);
+
+		ASSERT_EQ(vertexIndex, shape.triangles()[index / 3].vertexIndex(index % 3));
+		ASSERT_EQ(vertexBuffer[vertexIndex * elementCount], vertex.position()[X]);
+		ASSERT_EQ(vertexBuffer[(vertexIndex * elementCount) + 1], vertex.position()[Y]);
+		ASSERT_EQ(vertexBuffer[(vertexIndex * elementCount) + 5], vertex.normal()[Z]);
+		ASSERT_EQ(vertexBuffer[(vertexIndex * elementCount) + 6], vertex.textureCoordinates()[X]);
+	}
+}
+
+TEST(VertexFactoryShape, vertexCacheStatistics)
+{
+	/* NOTE: A soup transforms every vertex, three per triangle. */
+	const auto soup = createGridSoup(8);
+	const auto soupStatistics = soup.vertexCacheStatistics();
+
+	ASSERT_FLOAT_EQ(soupStatistics.ACMR, 3.0F);
+	ASSERT_FLOAT_EQ(soupStatistics.ATVR, 1.0F);
+
+	/* NOTE: A cache big enough to hold the whole grid transforms every vertex once. */
+	auto shape = createGridSoup(8);
+	shape.removeDuplicateVertices();
+
+	const auto statistics = shape.vertexCacheStatistics(1024);
+
+	ASSERT_FLOAT_EQ(statistics.ACMR, static_cast< float >(9 * 9) / static_cast< float >(8 * 8 * 2));
+	ASSERT_FLOAT_EQ(statistics.ATVR, 1.0F);
+}
+
+TEST(VertexFactoryShape, optimizeVertexCache)
+{
+	auto shape = createGridSoup(64);
+	shape.removeDuplicateVertices();
+
+	const auto triangleCount = shape.triangles().size();
+	const auto before = shape.vertexCacheStatistics();
+
+	shape.optimizeVertexCache();
+
+	const auto after = shape.vertexCacheStatistics();
+
+	ASSERT_EQ(shape.triangles().size(), triangleCount);
+	ASSERT_EQ(shape.groups().front().second, triangleCount);
+	ASSERT_LT(after.ACMR, before.ACMR);
+	ASSERT_LT(after.ACMR, 0.8F);
+
+	/* Every triangle is still emitted once. */
+	std::vector< bool > found(triangleCount, false);
+
+	for ( const auto & triangle : shape.triangles() )
+	{
+		const auto & position = shape.vertex(triangle.vertexIndex(0)).position();
+		const auto & positionB = shape.vertex(triangle.vertexIndex(1)).position();
+		const auto & positionC = shape.vertex(triangle.vertexIndex(2)).position();
+
+		/* NOTE: Triangles A start at the quad lower left, triangles B at the quad upper right from its second vertex. */
+		const auto isTriangleA = positionB[Y] == position[Y];
+		const auto x = static_cast< size_t >(position[X]);
+		const auto y = static_cast< size_t >(position[Y]);
+		const auto triangleIndex = ((y * 64) + x) * 2 + (isTriangleA ? 0 : 1);
+
+		ASSERT_EQ(positionC[Y], position[Y] + 1.0F);
+		ASSERT_FALSE(found[triangleIndex]);
+
+		found[triangleIndex] = true;
+	}
+}
+
+TEST(VertexFactoryShape, optimizeVertexCacheKeepsGroups)
+{
+	auto shape = createGridSoup(16);
+	shape.newGroup();
+
+	const auto secondGroup = createGridSoup(16);
+
+	for ( auto triangle : secondGroup.triangles() )
+	{
+		for ( uint32_t vertexIndex = 0; vertexIndex < 3; ++vertexIndex )
+		{
+			const auto & vertex = secondGroup.vertex(triangle.vertexIndex(vertexIndex));
+
+			triangle.setVertexIndex(vertexIndex, shape.saveVertex(vertex.position() + Vector< 3, float >{0.0F, 0.0F, 1.0F}, vertex.normal(), vertex.textureCoordinates()));
+		}
+
+		shape.addTriangle(triangle);
+	}
+
+	shape.removeDuplicateVertices();
+	shape.optimizeForRendering(true);
+
+	ASSERT_EQ(shape.groupCount(), 2);
+
+	for ( const auto & group : shape.groups() )
+	{
+		ASSERT_EQ(group.second, 16 * 16 * 2);
+
+		for ( auto triangleIndex = group.first; triangleIndex < group.first + group.second; ++triangleIndex )
+		{
+			const auto expectedZ = group.first == 0 ? 0.0F : 1.0F;
+
+			ASSERT_EQ(shape.vertex(shape.triangles()[triangleIndex].vertexIndex(0)).position()[Z], expectedZ);
+		}
+	}
+}
+
+TEST(VertexFactoryShape, optimizeVertexFetch)
+{
+	auto shape = createGridSoup(16);
+	shape.removeDuplicateVertices();
+	shape.optimizeVertexCache();
+
+	const auto vertexCount = shape.vertexCount();
+
+	ASSERT_EQ(shape.optimizeVertexFetch(), 0);
+	ASSERT_EQ(shape.vertexCount(), vertexCount);
+
+	/* NOTE: Vertices are now numbered in the order of their first use. */
+	uint32_t nextVertexIndex = 0;
+
+	for ( const auto & triangle : shape.triangles() )
+	{
+		for ( uint32_t vertexIndex = 0; vertexIndex < 3; ++vertexIndex )
+		{
+			ASSERT_LE(triangle.vertexIndex(vertexIndex), nextVertexIndex);
+
+			if ( triangle.vertexIndex(vertexIndex) == nextVertexIndex )
+			{
+				nextVertexIndex++;
+			}
+		}
+	}
+
+	ASSERT_EQ(nextVertexIndex, vertexCount);
+}
+
+TEST(VertexFactoryShape, optimizeOverdraw)
+{
+	auto shape = createGridSoup(64);
+	shape.removeDuplicateVertices();
+	shape.optimizeVertexCache();
+
+	const auto triangleCount = shape.triangles().size();
+	const auto optimized = shape.vertexCacheStatistics();
+
+	shape.optimizeOverdraw();
+
+	const auto sorted = shape.vertexCacheStatistics();
+
+	ASSERT_EQ(shape.triangles().size(), triangleCount);
+	/* NOTE: The clusters restart the cache, the gain should mostly be kept. */
+	ASSERT_LT(sorted.ACMR, optimized.ACMR * 1.25F);
+}
@@ -0,0 +1,234 @@
+/*
+ * src/Testing/test_VertexFactoryShapeSimplifier.cpp
+ * This file is part of Emeraude-Engine
+ *
+ * Copyright (C) 2010-2025 - Sébastien Léon Claude Christian Bémelmans "LondNoir" <londnoir@gmail.com>
+ *
+ * Emeraude-Engine is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * Emeraude-Engine is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with Emeraude-Engine; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * Complete project and additional information can be found at :
+ * https://github.com/londnoir/emeraude-engine
+ *
+ * --- THIS IS AUTOMATICALLY GENERATED, DO NOT CHANGE ---
+ */
+
+#include <gtest/gtest.h>
+
+/* STL inclusions. */
+#include <cstdint>
+#include <map>
+#include <vector>
+
+/* Local inclusions. */
+#include "Libs/VertexFactory/ShapeGenerator.hpp"
+#include "Libs/VertexFactory/ShapeSimplifier.hpp"
+
+using namespace EmEn::Libs;
+using namespace EmEn::Libs::Math;
+using namespace EmEn::Libs::VertexFactory;
+
+/**
+ * @brief Creates a flat welded grid on the XY plane.
+ * @param size The number of quads on each side.
+ * @return Shape< float, uint32_t >
+ */
+Shape< float, uint32_t >
+createFlatGrid (uint32_t size) noexcept
+{
+	Shape< float, uint32_t > shape;
+
+	const auto vertexIndex = [size] (uint32_t x, uint32_t y) {
+		return y * (size + 1) + x;
+	};
+
+	for ( uint32_t y = 0; y <= size; ++y )
+	{
+		for ( uint32_t x = 0; x <= size; ++x )
+		{
+			shape.saveVertex({static_cast< float >(x), static_cast< float >(y), 0.0F}, Vector< 3, float >::positiveZ(), {static_cast< float >(x) / static_cast< float >(size), static_cast< float >(y) / static_cast< float >(size), 0.0F});
+		}
+	}
+
+	for ( uint32_t y = 0; y < size; ++y )
+	{
+		for ( uint32_t x = 0; x < size; ++x )
+		{
+			ShapeTriangle< float > triangleA{vertexIndex(x, y), vertexIndex(x + 1, y), vertexIndex(x + 1, y + 1)};
+			ShapeTriangle< float > triangleB{vertexIndex(x, y), vertexIndex(x + 1, y + 1), vertexIndex(x, y + 1)};
+
+			shape.addTriangle(triangleA);
+			shape.addTriangle(triangleB);
+		}
+	}
+
+	return shape;
+}
+
+/**
+ * @brief Counts the vertices sharing each position.
+ * @param shape A reference to a shape.
+ * @return std::map< std::vector< float >, size_t >
+ */
+std::map< std::vector< float >, size_t >
+countVerticesByPosition (const Shape< float, uint32_t > & shape) noexcept
+{
+	std::map< std::vector< float >, size_t > counts;
+
+	for ( const auto & vertex : shape.vertices() )
+	{
+		counts[{vertex.position()[X], vertex.position()[Y], vertex.position()[Z]}]++;
+	}
+
+	return counts;
+}
+
+TEST(VertexFactoryShapeSimplifier, flatGridKeepsBorders)
+{
+	const auto grid = createFlatGrid(16);
+
+	ShapeSimplifier simplifier{grid};
+
+	const auto simplified = simplifier.simplify(0.1F);
+
+	ASSERT_TRUE(simplified.isValid());
+	ASSERT_LE(simplified.triangles().size(), grid.triangles().size() / 4);
+
+	/* Every border position is still there. */
+	const auto positions = countVerticesByPosition(simplified);
+
+	for ( uint32_t index = 0; index <= 16; ++index )
+	{
+		const auto coordinate = static_cast< float >(index);
+
+		ASSERT_TRUE(positions.contains({coordinate, 0.0F, 0.0F}));
+		ASSERT_TRUE(positions.contains({coordinate, 16.0F, 0.0F}));
+		ASSERT_TRUE(positions.contains({0.0F, coordinate, 0.0F}));
+		ASSERT_TRUE(positions.contains({16.0F, coordinate, 0.0F}));
+	}
+
+	/* NOTE: A planar surface is simplified without error, and no triangle is flipped. */
+	for ( const auto & triangle : simplified.triangles() )
+	{
+		const auto & positionA = simplified.vertex(triangle.vertexIndex(0)).position();
+		const auto normal = Vector< 3, float >::crossProduct(simplified.vertex(triangle.vertexIndex(1)).position() - positionA, simplified.vertex(triangle.vertexIndex(2)).position() - positionA);
+
+		ASSERT_GT(normal[Z], 0.0F);
+	}
+}
+
+TEST(VertexFactoryShapeSimplifier, sphereKeepsSeams)
+{
+	auto sphere = ShapeGenerator::generateSphere(1.0F, 48U, 24U);
+	sphere.removeDuplicateVertices();
+
+	const auto originalPositions = countVerticesByPosition(sphere);
+
+	ShapeSimplifier simplifier{sphere};
+
+	const auto simplified = simplifier.simplify(0.5F);
+	const auto simplifiedPositions = countVerticesByPosition(simplified);
+
+	ASSERT_TRUE(simplified.isValid());
+	ASSERT_LT(simplified.triangles().size(), sphere.triangles().size());
+
+	/* NOTE: A position owned by several vertices is an attribute seam, it must be kept with every vertex. */
+	for ( const auto & [position, count] : originalPositions )
+	{
+		if ( count > 1 )
+		{
+			ASSERT_TRUE(simplifiedPositions.contains(position));
+			ASSERT_EQ(simplifiedPositions.at(position), count);
+		}
+	}
+
+	/* The surface stays close to the sphere. */
+	for ( const auto & vertex : simplified.vertices() )
+	{
+		ASSERT_NEAR(vertex.position().length(), 1.0F, 0.001F);
+	}
+}
+
+TEST(VertexFactoryShapeSimplifier, maxErrorStopsSimplification)
+{
+	auto sphere = ShapeGenerator::generateSphere(1.0F, 48U, 24U);
+	sphere.removeDuplicateVertices();
+
+	ShapeSimplifier simplifier{sphere};
+
+	const auto exact = simplifier.simplify(0.1F, 0.0F);
+
+	ASSERT_EQ(exact.triangles().size(), sphere.triangles().size());
+
+	const auto loose = simplifier.simplify(0.1F, 0.05F);
+
+	ASSERT_LT(loose.triangles().size(), sphere.triangles().size());
+}
+
+TEST(VertexFactoryShapeSimplifier, generateLODChain)
+{
+	const auto grid = createFlatGrid(32);
+
+	ShapeSimplifier simplifier{grid};
+
+	const auto levels = simplifier.generateLODChain(3, 0.5F);
+
+	ASSERT_EQ(levels.size(), 3);
+
+	auto previousTriangleCount = grid.triangles().size();
+
+	for ( const auto & level : levels )
+	{
+		ASSERT_TRUE(level.isValid());
+		ASSERT_LT(level.triangles().size(), previousTriangleCount);
+		ASSERT_LE(level.triangles().size(), (previousTriangleCount + 1) / 2);
+
+		previousTriangleCount = level.triangles().size();
+	}
+}
+
+TEST(VertexFactoryShapeSimplifier, keepsGroups)
+{
+	auto shape = createFlatGrid(16);
+	shape.newGroup();
+
+	const auto secondGroup = createFlatGrid(16);
+
+	for ( auto triangle : secondGroup.triangles() )
+	{
+		for ( uint32_t vertexIndex = 0; vertexIndex < 3; ++vertexIndex )
+		{
+			const auto & vertex = secondGroup.vertex(triangle.vertexIndex(vertexIndex));
+
+			triangle.setVertexIndex(vertexIndex, shape.saveVertex(vertex.position() + Vector< 3, float >{16.0F, 0.0F, 0.0F}, vertex.normal(), vertex.textureCoordinates()));
+		}
+
+		shape.addTriangle(triangle);
+	}
+
+	shape.removeDuplicateVertices();
+
+	ShapeSimplifier simplifier{shape};
+
+	const auto simplified = simplifier.simplify(0.01F);
+
+	ASSERT_EQ(simplified.groupCount(), 2);
+
+	for ( const auto & group : simplified.groups() )
+	{
+		ASSERT_GT(group.second, 0);
+	}
+
+	ASSERT_LT(simplified.triangles().size(), shape.triangles().size() / 4);
+}
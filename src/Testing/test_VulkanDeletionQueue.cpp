@@ -0,0 +1,214 @@
+/*
+ * src/Testing/test_VulkanDeletionQueue.cpp
+ * This file is part of Emeraude-Engine
+ *
+ * Copyright (C) 2010-2025 - Sébastien Léon Claude Christian Bémelmans "LondNoir" <londnoir@gmail.com>
+ *
+ * Emeraude-Engine is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * Emeraude-Engine is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with Emeraude-Engine; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * Complete project and additional information can be found at :
+ * https://github.com/londnoir/emeraude-engine
+ *
+ * --- THIS IS AUTOMATICALLY GENERATED, DO NOT CHANGE ---
+ */
+
+
+#include <gtest/gtest.h>
+
+/* STL inclusions. */
+#include <atomic>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+/* Local inclusions. */
+#include "Vulkan/DeletionQueue.hpp"
+
+using namespace EmEn::Vulkan;
+
+/**
+ * @brief Timeline driven by the test instead of fences.
+ */
+class FakeTimeline final : public TimelineInterface
+{
+	public:
+
+		[[nodiscard]] uint64_t pendingValue () const noexcept override { return m_pendingValue; }
+		[[nodiscard]] uint64_t completedValue () const noexcept override { return m_completedValue; }
+
+		uint64_t m_pendingValue{1};
+		uint64_t m_completedValue{0};
+};
+
+TEST(VulkanDeletionQueue, waitsCompletedValue)
+{
+	FakeTimeline timeline;
+	DeletionQueue queue{timeline};
+	std::vector< int > destroyed;
+
+	queue.enqueue([&destroyed] { destroyed.push_back(1); });
+
+	timeline.m_pendingValue = 2;
+
+	queue.enqueue([&destroyed] { destroyed.push_back(2); });
+	queue.enqueue([&destroyed] { destroyed.push_back(3); });
+
+	ASSERT_EQ(queue.pendingCount(), 3);
+	ASSERT_EQ(queue.collect(), 0);
+	ASSERT_TRUE(destroyed.empty());
+
+	timeline.m_completedValue = 1;
+
+	ASSERT_EQ(queue.collect(), 1);
+	ASSERT_EQ(destroyed, std::vector< int >({1}));
+
+	timeline.m_completedValue = 5;
+
+	ASSERT_EQ(queue.collect(), 2);
+	ASSERT_EQ(destroyed, std::vector< int >({1, 2, 3}));
+	ASSERT_EQ(queue.pendingCount(), 0);
+}
+
+TEST(VulkanDeletionQueue, flush)
+{
+	FakeTimeline timeline;
+	std::vector< int > destroyed;
+
+	{
+		DeletionQueue queue{timeline};
+
+		queue.enqueue([&destroyed] { destroyed.push_back(1); });
+		queue.enqueue(nullptr);
+
+		/* NOTE: A deleter releasing another object, as a buffer releasing its memory. */
+		queue.enqueue([&destroyed, &queue] {
+			destroyed.push_back(2);
+
+			queue.enqueue([&destroyed] { destroyed.push_back(3); });
+		});
+
+		ASSERT_EQ(queue.flush(), 3);
+		ASSERT_EQ(destroyed, std::vector< int >({1, 2, 3}));
+
+		queue.enqueue([&destroyed] { destroyed.push_back(4); });
+	}
+
+	/* NOTE: The destructor destroys what is left. */
+	ASSERT_EQ(destroyed, std::vector< int >({1, 2, 3, 4}));
+}
+
+TEST(VulkanDeletionQueue, frameTimeline)
+{
+	FrameTimeline timeline;
+	DeletionQueue queue{timeline};
+	size_t destroyed = 0;
+
+	queue.enqueue([&destroyed] { destroyed++; });
+
+	/* NOTE: Two frames in flight, the first one carries the release. */
+	const auto firstFrame = timeline.submit();
+
+	queue.enqueue([&destroyed] { destroyed++; });
+
+	const auto secondFrame = timeline.submit();
+
+	ASSERT_EQ(queue.collect(), 0);
+
+	timeline.complete(firstFrame);
+
+	ASSERT_EQ(queue.collect(), 1);
+
+	/* NOTE: A completion never goes back. */
+	timeline.complete(secondFrame);
+	timeline.complete(firstFrame);
+
+	ASSERT_EQ(timeline.completedValue(), secondFrame);
+	ASSERT_EQ(queue.collect(), 1);
+	ASSERT_EQ(destroyed, 2);
+}
+
+TEST(VulkanDeletionQueue, concurrentReleases)
+{
+	FrameTimeline timeline;
+	DeletionQueue queue{timeline};
+	std::atomic< size_t > destroyed{0};
+
+	std::vector< std::thread > threads;
+
+	for ( size_t threadIndex = 0; threadIndex < 4; threadIndex++ )
+	{
+		threads.emplace_back([&queue, &destroyed] {
+			for ( size_t index = 0; index < 1000; index++ )
+			{
+				queue.enqueue([&destroyed] { destroyed++; });
+			}
+		});
+	}
+
+	for ( size_t frame = 0; frame < 100; frame++ )
+	{
+		timeline.complete(timeline.submit());
+
+		queue.collect();
+	}
+
+	for ( auto & thread : threads )
+	{
+		thread.join();
+	}
+
+	timeline.complete(timeline.submit());
+
+	queue.collect();
+
+	ASSERT_EQ(destroyed.load(), 4000);
+	ASSERT_EQ(queue.pendingCount(), 0);
+}
+
+TEST(VulkanDeletionQueue, secondaryTimeline)
+{
+	FakeTimeline frames;
+	FakeTimeline transfers;
+	DeletionQueue queue{frames};
+	std::vector< int > destroyed;
+
+	queue.setSecondaryTimeline(&transfers);
+
+	/* NOTE: A transfer recorded into the object is not executed yet. */
+	transfers.m_pendingValue = 3;
+
+	queue.enqueue([&destroyed] { destroyed.push_back(1); });
+
+	frames.m_completedValue = 1;
+
+	ASSERT_EQ(queue.collect(), 0);
+
+	transfers.m_completedValue = 3;
+
+	ASSERT_EQ(queue.collect(), 1);
+
+	/* NOTE: Without the second timeline, only the frames are waited. */
+	queue.setSecondaryTimeline(nullptr);
+
+	transfers.m_pendingValue = 10;
+	frames.m_pendingValue = 2;
+
+	queue.enqueue([&destroyed] { destroyed.push_back(2); });
+
+	frames.m_completedValue = 2;
+
+	ASSERT_EQ(queue.collect(), 1);
+	ASSERT_EQ(destroyed, std::vector< int >({1, 2}));
+}
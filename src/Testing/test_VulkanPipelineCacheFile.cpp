@@ -0,0 +1,204 @@
+/*
+ * src/Testing/test_VulkanPipelineCacheFile.cpp
+ * This file is part of Emeraude-Engine
+ *
+ * Copyright (C) 2010-2025 - Sébastien Léon Claude Christian Bémelmans "LondNoir" <londnoir@gmail.com>
+ *
+ * Emeraude-Engine is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * Emeraude-Engine is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with Emeraude-Engine; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * Complete project and additional information can be found at :
+ * https://github.com/londnoir/emeraude-engine
+ *
+ * --- THIS IS AUTOMATICALLY GENERATED, DO NOT CHANGE ---
+ */
+
+#include <gtest/gtest.h>
+
+/* STL inclusions. */
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <vector>
+
+/* Local inclusions. */
+#include "Vulkan/PipelineCacheFile.hpp"
+#include "Constants.hpp"
+
+using namespace EmEn::Vulkan;
+
+namespace
+{
+	PipelineCacheFile::DeviceIdentity
+	testIdentity () noexcept
+	{
+		PipelineCacheFile::DeviceIdentity identity{
+			.vendorID = 0x10DE,
+			.deviceID = 0x2684,
+			.driverVersion = 0x87654321,
+			.pipelineCacheUUID = {}
+		};
+
+		for ( size_t index = 0; index < identity.pipelineCacheUUID.size(); index++ )
+		{
+			identity.pipelineCacheUUID[index] = static_cast< uint8_t >(index * 7 + 1);
+		}
+
+		return identity;
+	}
+
+	std::vector< uint8_t >
+	testData (size_t bytes) noexcept
+	{
+		std::vector< uint8_t > data(bytes);
+
+		for ( size_t index = 0; index < bytes; index++ )
+		{
+			data[index] = static_cast< uint8_t >(index * 31 + 5);
+		}
+
+		return data;
+	}
+
+	void
+	patchFile (const std::filesystem::path & filepath, std::streamoff offset, uint8_t value) noexcept
+	{
+		std::fstream file{filepath, std::ios::binary | std::ios::in | std::ios::out};
+		file.seekp(offset);
+		file.put(static_cast< char >(value));
+	}
+}
+
+TEST(VulkanPipelineCacheFile, writeAndRead)
+{
+	const auto filepath = testOutputPath("pipeline_roundtrip.empc");
+	const auto data = testData(1237);
+
+	const PipelineCacheFile file{filepath, testIdentity()};
+
+	ASSERT_FALSE(std::filesystem::exists(filepath));
+
+	std::vector< uint8_t > readData;
+
+	ASSERT_FALSE(file.read(readData));
+	ASSERT_TRUE(file.write(data));
+	ASSERT_EQ(std::filesystem::file_size(filepath), 64 + data.size());
+	ASSERT_TRUE(file.read(readData));
+	ASSERT_EQ(readData, data);
+
+	/* NOTE: The file is replaced as a whole. */
+	const auto smallerData = testData(3);
+
+	ASSERT_TRUE(file.write(smallerData));
+	ASSERT_TRUE(file.read(readData));
+	ASSERT_EQ(readData, smallerData);
+
+	std::filesystem::remove(filepath);
+}
+
+TEST(VulkanPipelineCacheFile, emptyData)
+{
+	const auto filepath = testOutputPath("pipeline_empty.empc");
+
+	const PipelineCacheFile file{filepath, testIdentity()};
+
+	std::vector< uint8_t > readData{1, 2, 3};
+
+	ASSERT_TRUE(file.write({}));
+	ASSERT_TRUE(file.read(readData));
+	ASSERT_TRUE(readData.empty());
+
+	std::filesystem::remove(filepath);
+}
+
+TEST(VulkanPipelineCacheFile, otherDeviceIsRejected)
+{
+	const auto filepath = testOutputPath("pipeline_device.empc");
+
+	ASSERT_TRUE((PipelineCacheFile{filepath, testIdentity()}.write(testData(100))));
+
+	std::vector< uint8_t > readData;
+
+	{
+		auto identity = testIdentity();
+		identity.vendorID++;
+
+		ASSERT_FALSE((PipelineCacheFile{filepath, identity}.read(readData)));
+	}
+
+	{
+		auto identity = testIdentity();
+		identity.deviceID++;
+
+		ASSERT_FALSE((PipelineCacheFile{filepath, identity}.read(readData)));
+	}
+
+	{
+		auto identity = testIdentity();
+		identity.driverVersion++;
+
+		ASSERT_FALSE((PipelineCacheFile{filepath, identity}.read(readData)));
+	}
+
+	{
+		auto identity = testIdentity();
+		identity.pipelineCacheUUID[15] ^= 0xFF;
+
+		ASSERT_FALSE((PipelineCacheFile{filepath, identity}.read(readData)));
+	}
+
+	ASSERT_TRUE((PipelineCacheFile{filepath, testIdentity()}.read(readData)));
+
+	std::filesystem::remove(filepath);
+}
+
+TEST(VulkanPipelineCacheFile, damagedFileIsRejected)
+{
+	const auto filepath = testOutputPath("pipeline_damaged.empc");
+	const PipelineCacheFile file{filepath, testIdentity()};
+
+	std::vector< uint8_t > readData;
+
+	/* NOTE: Magic. */
+	ASSERT_TRUE(file.write(testData(100)));
+	patchFile(filepath, 0, 'X');
+	ASSERT_FALSE(file.read(readData));
+
+	/* NOTE: Byte order mark. */
+	ASSERT_TRUE(file.write(testData(100)));
+	patchFile(filepath, 12, 0xFF);
+	ASSERT_FALSE(file.read(readData));
+
+	/* NOTE: Version. */
+	ASSERT_TRUE(file.write(testData(100)));
+	patchFile(filepath, 8, 0x7F);
+	ASSERT_FALSE(file.read(readData));
+
+	/* NOTE: Data. */
+	ASSERT_TRUE(file.write(testData(100)));
+	patchFile(filepath, 64 + 50, 0x00);
+	ASSERT_FALSE(file.read(readData));
+	ASSERT_TRUE(readData.empty());
+
+	/* NOTE: Truncated data. */
+	ASSERT_TRUE(file.write(testData(100)));
+	std::filesystem::resize_file(filepath, 64 + 99);
+	ASSERT_FALSE(file.read(readData));
+
+	/* NOTE: Truncated header. */
+	std::filesystem::resize_file(filepath, 40);
+	ASSERT_FALSE(file.read(readData));
+
+	std::filesystem::remove(filepath);
+}
@@ -0,0 +1,164 @@
+/*
+ * src/Testing/test_VulkanStagingRing.cpp
+ * This file is part of Emeraude-Engine
+ *
+ * Copyright (C) 2010-2025 - Sébastien Léon Claude Christian Bémelmans "LondNoir" <londnoir@gmail.com>
+ *
+ * Emeraude-Engine is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * Emeraude-Engine is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with Emeraude-Engine; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * Complete project and additional information can be found at :
+ * https://github.com/londnoir/emeraude-engine
+ *
+ * --- THIS IS AUTOMATICALLY GENERATED, DO NOT CHANGE ---
+ */
+
+
+#include <gtest/gtest.h>
+
+/* STL inclusions. */
+#include <algorithm>
+#include <cstdint>
+#include <thread>
+#include <utility>
+#include <vector>
+
+/* Local inclusions. */
+#include "Vulkan/StagingRing.hpp"
+
+using namespace EmEn::Vulkan;
+
+TEST(VulkanStagingRing, reserveAndReclaim)
+{
+	StagingRing ring{1024};
+	StagingRing::Region first;
+	StagingRing::Region second;
+
+	ASSERT_TRUE(ring.reserve(100, 16, first));
+	ASSERT_TRUE(ring.reserve(100, 16, second));
+
+	ASSERT_EQ(first.offset, 0);
+	ASSERT_EQ(second.offset, 112);
+	ASSERT_EQ(ring.usedBytes(), 212);
+
+	/* NOTE: Not retired yet, nothing goes back. */
+	ASSERT_EQ(ring.reclaim(10), 0);
+
+	ring.retire(second, 1);
+
+	/* NOTE: The first range is still held, the second one waits for it. */
+	ASSERT_EQ(ring.reclaim(10), 0);
+
+	ring.retire(first, 2);
+
+	ASSERT_EQ(ring.reclaim(1), 0);
+	ASSERT_EQ(ring.reclaim(2), 2);
+	ASSERT_EQ(ring.usedBytes(), 0);
+	ASSERT_EQ(ring.regionCount(), 0);
+}
+
+TEST(VulkanStagingRing, wrapsAround)
+{
+	StagingRing ring{1024};
+	StagingRing::Region first;
+	StagingRing::Region second;
+	StagingRing::Region third;
+
+	ASSERT_TRUE(ring.reserve(600, 16, first));
+	ASSERT_TRUE(ring.reserve(300, 16, second));
+
+	/* NOTE: 124 bytes remain at the end, the beginning is still used. */
+	ASSERT_FALSE(ring.reserve(200, 16, third));
+
+	ring.retire(first, 1);
+
+	ASSERT_EQ(ring.reclaim(1), 1);
+
+	/* NOTE: The range does not fit at the end and starts over at the beginning. */
+	ASSERT_TRUE(ring.reserve(200, 16, third));
+	ASSERT_EQ(third.offset, 0);
+	ASSERT_EQ(ring.usedBytes(), 1024 - 600 + 200);
+
+	ring.retire(second, 2);
+	ring.retire(third, 2);
+
+	ASSERT_EQ(ring.reclaim(2), 2);
+	ASSERT_EQ(ring.usedBytes(), 0);
+}
+
+TEST(VulkanStagingRing, rejectsOversizedRange)
+{
+	StagingRing ring{1024};
+	StagingRing::Region region;
+
+	ASSERT_FALSE(ring.reserve(2048, 16, region));
+	ASSERT_FALSE(ring.reserve(0, 16, region));
+	ASSERT_TRUE(ring.reserve(1024, 16, region));
+	ASSERT_FALSE(ring.reserve(1, 1, region));
+}
+
+TEST(VulkanStagingRing, concurrentReservations)
+{
+	constexpr auto ThreadCount{4UL};
+	constexpr auto ReservationCount{1000UL};
+
+	StagingRing ring{1024 * 1024};
+	std::vector< std::thread > threads;
+	std::vector< std::vector< StagingRing::Region > > regions(ThreadCount);
+
+	for ( size_t threadIndex = 0; threadIndex < ThreadCount; threadIndex++ )
+	{
+		threads.emplace_back([&ring, &regions, threadIndex] {
+			for ( size_t index = 0; index < ReservationCount; index++ )
+			{
+				StagingRing::Region region;
+
+				if ( ring.reserve(64 + index % 64, 16, region) )
+				{
+					regions[threadIndex].emplace_back(region);
+				}
+			}
+		});
+	}
+
+	for ( auto & thread : threads )
+	{
+		thread.join();
+	}
+
+	/* NOTE: Every range must be disjoint from the others. */
+	std::vector< std::pair< uint64_t, uint64_t > > ranges;
+
+	for ( const auto & threadRegions : regions )
+	{
+		for ( const auto & region : threadRegions )
+		{
+			ASSERT_EQ(region.offset % 16, 0);
+
+			ranges.emplace_back(region.offset, region.offset + region.size);
+
+			ring.retire(region, 1);
+		}
+	}
+
+	std::ranges::sort(ranges);
+
+	for ( size_t index = 1; index < ranges.size(); index++ )
+	{
+		ASSERT_LE(ranges[index - 1].second, ranges[index].first);
+	}
+
+	ASSERT_EQ(ring.reclaim(1), ranges.size());
+	ASSERT_EQ(ring.usedBytes(), 0);
+}
@@ -0,0 +1,191 @@
+/*
+ * src/Testing/test_WaveFactoryWaveCache.cpp
+ * This file is part of Emeraude-Engine
+ *
+ * Copyright (C) 2010-2025 - Sébastien Léon Claude Christian Bémelmans "LondNoir" <londnoir@gmail.com>
+ *
+ * Emeraude-Engine is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * Emeraude-Engine is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with Emeraude-Engine; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * Complete project and additional information can be found at :
+ * https://github.com/londnoir/emeraude-engine
+ *
+ * --- THIS IS AUTOMATICALLY GENERATED, DO NOT CHANGE ---
+ */
+
+
+#include <gtest/gtest.h>
+
+/* STL inclusions. */
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+
+/* Local inclusions. */
+#include "Libs/WaveFactory/WaveCache.hpp"
+#include "Constants.hpp"
+
+using namespace EmEn::Libs;
+using namespace EmEn::Libs::WaveFactory;
+
+/**
+ * @brief Creates a wave with a deterministic content.
+ * @param frameCount The number of frames.
+ * @param channels The number of channels.
+ * @param seed A value changing the content.
+ * @return Wave< int16_t >
+ */
+Wave< int16_t >
+createCachedWave (size_t frameCount, Channels channels, int seed) noexcept
+{
+	Wave< int16_t > wave;
+	wave.initialize(frameCount, channels, Frequency::PCM48000Hz);
+
+	for ( size_t index = 0; index < wave.elementsCount(); index++ )
+	{
+		wave.data()[index] = static_cast< int16_t >((static_cast< int >(index) * 37 + seed * 101) % 65536 - 32768);
+	}
+
+	return wave;
+}
+
+TEST(WaveFactoryWaveCache, storeAndRead)
+{
+	const auto directory = testOutputPath("wave_cache");
+
+	WaveCache cache{directory, 0};
+
+	const auto source = createCachedWave(1000, Channels::Stereo, 1);
+
+	ASSERT_TRUE(cache.store(42, source));
+	ASSERT_TRUE(std::filesystem::exists(cache.getFilepath(42, Channels::Stereo, Frequency::PCM48000Hz)));
+
+	Wave< int16_t > loaded;
+
+	ASSERT_TRUE(cache.read(42, Channels::Stereo, Frequency::PCM48000Hz, loaded));
+	ASSERT_EQ(loaded.samplesCount(), source.samplesCount());
+	ASSERT_EQ(loaded.channels(), Channels::Stereo);
+	ASSERT_EQ(loaded.frequency(), Frequency::PCM48000Hz);
+	ASSERT_TRUE(std::equal(source.data(), source.data() + source.elementsCount(), loaded.data()));
+
+	/* NOTE: Another source or another target format are other entries. */
+	ASSERT_FALSE(cache.read(43, Channels::Stereo, Frequency::PCM48000Hz, loaded));
+	ASSERT_FALSE(cache.read(42, Channels::Mono, Frequency::PCM48000Hz, loaded));
+	ASSERT_FALSE(cache.read(42, Channels::Stereo, Frequency::PCM44100Hz, loaded));
+
+	std::filesystem::remove_all(directory);
+}
+
+TEST(WaveFactoryWaveCache, rejectsInvalidFiles)
+{
+	const auto directory = testOutputPath("wave_cache_invalid");
+
+	WaveCache cache{directory, 0};
+
+	ASSERT_TRUE(cache.store(7, createCachedWave(500, Channels::Mono, 2)));
+
+	const auto filepath = cache.getFilepath(7, Channels::Mono, Frequency::PCM48000Hz);
+	const auto fileSize = std::filesystem::file_size(filepath);
+
+	Wave< int16_t > loaded;
+
+	/* NOTE: A truncated file is refused. */
+	std::filesystem::resize_file(filepath, fileSize - 2);
+
+	ASSERT_FALSE(cache.read(7, Channels::Mono, Frequency::PCM48000Hz, loaded));
+
+	/* NOTE: A file named after another source is refused. */
+	ASSERT_TRUE(cache.store(7, createCachedWave(500, Channels::Mono, 2)));
+	std::filesystem::copy_file(filepath, cache.getFilepath(9, Channels::Mono, Frequency::PCM48000Hz));
+
+	ASSERT_FALSE(cache.read(9, Channels::Mono, Frequency::PCM48000Hz, loaded));
+	ASSERT_TRUE(cache.read(7, Channels::Mono, Frequency::PCM48000Hz, loaded));
+
+	/* NOTE: Without directory, nothing is stored. */
+	WaveCache disabled;
+
+	ASSERT_FALSE(disabled.store(7, loaded));
+	ASSERT_FALSE(disabled.read(7, Channels::Mono, Frequency::PCM48000Hz, loaded));
+
+	std::filesystem::remove_all(directory);
+}
+
+TEST(WaveFactoryWaveCache, evictsLeastRecentlyUsed)
+{
+	const auto directory = testOutputPath("wave_cache_eviction");
+
+	/* NOTE: One wave is 40 bytes of header and 20000 bytes of samples, the limit holds two of them. */
+	WaveCache cache{directory, 45000};
+
+	const auto now = std::filesystem::file_time_type::clock::now();
+
+	ASSERT_TRUE(cache.store(1, createCachedWave(10000, Channels::Mono, 1)));
+	std::filesystem::last_write_time(cache.getFilepath(1, Channels::Mono, Frequency::PCM48000Hz), now - std::chrono::hours{2});
+
+	ASSERT_TRUE(cache.store(2, createCachedWave(10000, Channels::Mono, 2)));
+	std::filesystem::last_write_time(cache.getFilepath(2, Channels::Mono, Frequency::PCM48000Hz), now - std::chrono::hours{1});
+
+	/* NOTE: Reading the first entry makes it the most recent one. */
+	Wave< int16_t > loaded;
+
+	ASSERT_TRUE(cache.read(1, Channels::Mono, Frequency::PCM48000Hz, loaded));
+
+	ASSERT_TRUE(cache.store(3, createCachedWave(10000, Channels::Mono, 3)));
+
+	ASSERT_TRUE(std::filesystem::exists(cache.getFilepath(1, Channels::Mono, Frequency::PCM48000Hz)));
+	ASSERT_FALSE(std::filesystem::exists(cache.getFilepath(2, Channels::Mono, Frequency::PCM48000Hz)));
+	ASSERT_TRUE(std::filesystem::exists(cache.getFilepath(3, Channels::Mono, Frequency::PCM48000Hz)));
+
+	/* NOTE: The entry just stored is kept, even alone over the limit. */
+	cache.setMaximumBytes(1000);
+
+	ASSERT_TRUE(cache.store(4, createCachedWave(10000, Channels::Mono, 4)));
+	ASSERT_TRUE(std::filesystem::exists(cache.getFilepath(4, Channels::Mono, Frequency::PCM48000Hz)));
+	ASSERT_FALSE(std::filesystem::exists(cache.getFilepath(1, Channels::Mono, Frequency::PCM48000Hz)));
+	ASSERT_FALSE(std::filesystem::exists(cache.getFilepath(3, Channels::Mono, Frequency::PCM48000Hz)));
+
+	std::filesystem::remove_all(directory);
+}
+
+TEST(WaveFactoryWaveCache, fileHash)
+{
+	const auto directory = testOutputPath("wave_cache_hash");
+
+	std::filesystem::create_directories(directory);
+
+	const auto writeFile = [&directory] (const char * name, const char * content) {
+		std::ofstream file{directory / name, std::ios::binary};
+		file << content;
+	};
+
+	writeFile("a.bin", "a sound file content, long enough to use words");
+	writeFile("b.bin", "a sound file content, long enough to use words");
+	writeFile("c.bin", "a sound file content, long enough to use wordz");
+
+	uint64_t hashA = 0;
+	uint64_t hashB = 0;
+	uint64_t hashC = 0;
+
+	ASSERT_TRUE(WaveCache::computeFileHash(directory / "a.bin", hashA));
+	ASSERT_TRUE(WaveCache::computeFileHash(directory / "b.bin", hashB));
+	ASSERT_TRUE(WaveCache::computeFileHash(directory / "c.bin", hashC));
+	ASSERT_FALSE(WaveCache::computeFileHash(directory / "missing.bin", hashC));
+
+	ASSERT_EQ(hashA, hashB);
+	ASSERT_NE(hashA, hashC);
+
+	std::filesystem::remove_all(directory);
+}
@@ -0,0 +1,284 @@
+/*
+ * src/Tool/GeometryConverter.cpp
+ * This file is part of Emeraude-Engine
+ *
+ * Copyright (C) 2010-2025 - Sébastien Léon Claude Christian Bémelmans "LondNoir" <londnoir@gmail.com>
+ *
+ * Emeraude-Engine is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * Emeraude-Engine is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with Emeraude-Engine; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * Complete project and additional information can be found at :
+ * https://github.com/londnoir/emeraude-engine
+ *
+ * --- THIS IS AUTOMATICALLY GENERATED, DO NOT CHANGE ---
+ */
+
+#include "GeometryConverter.hpp"
+
+/* STL inclusions. */
+#include <algorithm>
+#include <system_error>
+
+/* Local inclusions. */
+#include "Libs/VertexFactory/FileFormatNative.hpp"
+#include "Libs/VertexFactory/FileIO.hpp"
+#include "Libs/VertexFactory/ShapeSimplifier.hpp"
+#include "Libs/IO/IO.hpp"
+#include "Libs/String.hpp"
+#include "Arguments.hpp"
+#include "Tracer.hpp"
+
+namespace EmEn::Tool
+{
+	using namespace EmEn::Libs;
+	using namespace EmEn::Libs::VertexFactory;
+
+	GeometryConverter::GeometryConverter (const Arguments & arguments) noexcept
+	{
+		{
+			const auto arg = arguments.get("--input", "-i");
+
+			if ( arg.isPresent() )
+			{
+				m_inputPath = arg.value();
+			}
+		}
+
+		{
+			const auto arg = arguments.get("--output-directory", "-o");
+
+			if ( arg.isPresent() )
+			{
+				m_outputDirectory = arg.value();
+			}
+		}
+
+		{
+			const auto arg = arguments.get("--lod-count");
+
+			if ( arg.isPresent() )
+			{
+				m_levelOfDetailCount = String::toNumber< uint32_t >(arg.value());
+			}
+		}
+
+		{
+			const auto arg = arguments.get("--reduction-ratio");
+
+			if ( arg.isPresent() )
+			{
+				m_reductionRatio = std::clamp(String::toNumber< float >(arg.value()), 0.01F, 1.0F);
+			}
+		}
+
+		{
+			const auto arg = arguments.get("--screen-size");
+
+			if ( arg.isPresent() )
+			{
+				m_screenSize = String::toNumber< float >(arg.value());
+			}
+		}
+
+		m_overwrite = arguments.get("--overwrite").isPresent();
+		m_optimize = arguments.get("--optimize").isPresent();
+		m_enable3DTexCoords = arguments.get("--enable-3d-tex-coords").isPresent();
+		m_enableVertexColor = arguments.get("--enable-vertex-color").isPresent();
+	}
+
+	bool
+	GeometryConverter::execute () noexcept
+	{
+		if ( m_inputPath.empty() )
+		{
+			Tracer::error(ClassId, "No input ! Use '--input' with a geometry file or a directory.");
+
+			return false;
+		}
+
+		if ( !m_outputDirectory.empty() && !IO::directoryExists(m_outputDirectory) && !IO::createDirectory(m_outputDirectory) )
+		{
+			TraceError{ClassId} << "Unable to create the output directory " << m_outputDirectory << " !";
+
+			return false;
+		}
+
+		const auto sourceFiles = this->getSourceFiles();
+
+		if ( sourceFiles.empty() )
+		{
+			TraceWarning{ClassId} << "No geometry file to convert from " << m_inputPath << " !";
+
+			return false;
+		}
+
+		size_t convertedCount = 0;
+		size_t skippedCount = 0;
+
+		for ( const auto & sourceFilepath : sourceFiles )
+		{
+			const auto outputFilepath = this->getOutputFilepath(sourceFilepath);
+
+			if ( !m_overwrite && IO::fileExists(outputFilepath) )
+			{
+				TraceInfo{ClassId} << "The file " << outputFilepath << " already exists, skipping " << sourceFilepath << " ...";
+
+				skippedCount++;
+
+				continue;
+			}
+
+			if ( this->convert(sourceFilepath, outputFilepath) )
+			{
+				convertedCount++;
+			}
+		}
+
+		const auto failedCount = sourceFiles.size() - convertedCount - skippedCount;
+
+		TraceInfo{ClassId} << convertedCount << " geometry file(s) converted, " << skippedCount << " skipped, " << failedCount << " failed.";
+
+		return failedCount == 0;
+	}
+
+	bool
+	GeometryConverter::isConvertible (const std::filesystem::path & filepath) noexcept
+	{
+		const auto extension = IO::getFileExtension(filepath, true);
+
+		return extension == "obj" || extension == "fbx" || extension == "mdl" || extension == "md2" || extension == "md3" || extension == "md5mesh";
+	}
+
+	std::vector< std::filesystem::path >
+	GeometryConverter::getSourceFiles () const noexcept
+	{
+		std::vector< std::filesystem::path > sourceFiles;
+
+		if ( !IO::directoryExists(m_inputPath) )
+		{
+			if ( GeometryConverter::isConvertible(m_inputPath) && IO::fileExists(m_inputPath) )
+			{
+				sourceFiles.emplace_back(m_inputPath);
+			}
+
+			return sourceFiles;
+		}
+
+		std::error_code errorCode;
+
+		for ( std::filesystem::recursive_directory_iterator iterator{m_inputPath, errorCode}, end; !errorCode && iterator != end; iterator.increment(errorCode) )
+		{
+			if ( iterator->is_regular_file(errorCode) && GeometryConverter::isConvertible(iterator->path()) )
+			{
+				sourceFiles.emplace_back(iterator->path());
+			}
+		}
+
+		if ( errorCode )
+		{
+			TraceWarning{ClassId} << "Unable to list every file of " << m_inputPath << " : " << errorCode.message();
+		}
+
+		/* NOTE: Keep the conversion order stable between runs. */
+		std::ranges::sort(sourceFiles);
+
+		return sourceFiles;
+	}
+
+	std::filesystem::path
+	GeometryConverter::getOutputFilepath (const std::filesystem::path & sourceFilepath) const noexcept
+	{
+		auto outputFilepath = sourceFilepath;
+		outputFilepath.replace_extension(NativeExtension);
+
+		if ( m_outputDirectory.empty() )
+		{
+			return outputFilepath;
+		}
+
+		/* NOTE: Keep the sub-directories of the input directory. */
+		if ( IO::directoryExists(m_inputPath) )
+		{
+			auto relativePath = outputFilepath.lexically_relative(m_inputPath);
+			auto destination = m_outputDirectory / relativePath;
+
+			std::error_code errorCode;
+			std::filesystem::create_directories(destination.parent_path(), errorCode);
+
+			return destination;
+		}
+
+		return m_outputDirectory / outputFilepath.filename();
+	}
+
+	bool
+	GeometryConverter::convert (const std::filesystem::path & sourceFilepath, const std::filesystem::path & outputFilepath) const noexcept
+	{
+		/* NOTE: Same options as an indexed geometry resource reading the source file. */
+		ReadOptions readOptions{};
+		readOptions.flipYAxis = true;
+		readOptions.requestTangentSpace = true;
+		readOptions.requestTextureCoordinates = true;
+		readOptions.requestVertexColor = m_enableVertexColor;
+		readOptions.optimizeVertexCache = m_optimize;
+
+		Shape< float, uint32_t > shape;
+
+		if ( !FileIO::read(sourceFilepath, shape, readOptions) )
+		{
+			TraceError{ClassId} << "Unable to read the geometry " << sourceFilepath << " !";
+
+			return false;
+		}
+
+		NativeVertexLayout layout{};
+		layout.textureCoordinatesType = m_enable3DTexCoords ? TextureCoordinatesType::UVW : TextureCoordinatesType::UV;
+		layout.vertexColorType = m_enableVertexColor && shape.isVertexColorAvailable() ? VertexColorType::RGBA : VertexColorType::None;
+
+		std::vector< Shape< float, uint32_t > > levelsOfDetail;
+		std::vector< float > screenSizes;
+
+		if ( m_levelOfDetailCount > 0 )
+		{
+			const ShapeSimplifier< float, uint32_t > simplifier{shape};
+
+			levelsOfDetail = simplifier.generateLODChain(m_levelOfDetailCount, m_reductionRatio);
+
+			for ( size_t level = 0; level < levelsOfDetail.size(); ++level )
+			{
+				screenSizes.emplace_back(screenSizes.empty() ? m_screenSize : screenSizes.back() * 0.5F);
+
+				if ( m_optimize )
+				{
+					levelsOfDetail[level].optimizeForRendering(false);
+				}
+			}
+		}
+
+		const FileFormatNative< float, uint32_t > fileFormat{};
+
+		if ( !fileFormat.writeLevels(outputFilepath, shape, levelsOfDetail, screenSizes, layout) )
+		{
+			TraceError{ClassId} << "Unable to write the geometry " << outputFilepath << " !";
+
+			return false;
+		}
+
+		TraceSuccess{ClassId} <<
+			"Geometry " << sourceFilepath << " converted to " << outputFilepath << " "
+			"(" << shape.triangles().size() << " triangles, " << levelsOfDetail.size() << " levels of detail).";
+
+		return true;
+	}
+}
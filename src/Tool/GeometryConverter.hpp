@@ -0,0 +1,109 @@
+/*
+ * src/Tool/GeometryConverter.hpp
+ * This file is part of Emeraude-Engine
+ *
+ * Copyright (C) 2010-2025 - Sébastien Léon Claude Christian Bémelmans "LondNoir" <londnoir@gmail.com>
+ *
+ * Emeraude-Engine is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * Emeraude-Engine is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with Emeraude-Engine; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * Complete project and additional information can be found at :
+ * https://github.com/londnoir/emeraude-engine
+ *
+ * --- THIS IS AUTOMATICALLY GENERATED, DO NOT CHANGE ---
+ */
+
+#pragma once
+
+/* STL inclusions. */
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+/* Local inclusions for inheritances. */
+#include "ToolInterface.hpp"
+
+namespace EmEn::Tool
+{
+	/**
+	 * @brief The geometry converter tool. It converts geometry files (OBJ, FBX, MDL, MD2, MD3, MD5) to the native format (.emgeo).
+	 * @note The geometries are read like an indexed geometry resource does, then stored in the engine space with optional levels of detail.
+	 * @extends EmEn::Tool::ToolInterface This is a tool interface.
+	 */
+	class GeometryConverter final : public ToolInterface
+	{
+		public:
+
+			/** @brief Class identifier. */
+			static constexpr auto ClassId{"GeometryConverter"};
+
+			/** @brief The extension of the native geometry files. */
+			static constexpr auto NativeExtension{"emgeo"};
+
+			/**
+			 * @brief Constructs the geometry converter.
+			 * @param arguments A reference to the arguments.
+			 */
+			explicit GeometryConverter (const Arguments & arguments) noexcept;
+
+			/** @copydoc EmEn::Tool::ToolInterface::execute() */
+			[[nodiscard]]
+			bool execute () noexcept override;
+
+		private:
+
+			/**
+			 * @brief Returns whether a file can be converted, from its extension.
+			 * @param filepath A reference to a filesystem path.
+			 * @return bool
+			 */
+			[[nodiscard]]
+			static bool isConvertible (const std::filesystem::path & filepath) noexcept;
+
+			/**
+			 * @brief Lists the files to convert from the input path.
+			 * @return std::vector< std::filesystem::path >
+			 */
+			[[nodiscard]]
+			std::vector< std::filesystem::path > getSourceFiles () const noexcept;
+
+			/**
+			 * @brief Returns the path of the native file for a source file.
+			 * @param sourceFilepath A reference to a filesystem path.
+			 * @return std::filesystem::path
+			 */
+			[[nodiscard]]
+			std::filesystem::path getOutputFilepath (const std::filesystem::path & sourceFilepath) const noexcept;
+
+			/**
+			 * @brief Converts one file.
+			 * @param sourceFilepath A reference to the source filesystem path.
+			 * @param outputFilepath A reference to the native filesystem path.
+			 * @return bool
+			 */
+			[[nodiscard]]
+			bool convert (const std::filesystem::path & sourceFilepath, const std::filesystem::path & outputFilepath) const noexcept;
+
+			std::filesystem::path m_inputPath;
+			std::filesystem::path m_outputDirectory;
+			uint32_t m_levelOfDetailCount{0};
+			float m_reductionRatio{0.5F};
+			float m_screenSize{0.25F};
+			bool m_overwrite{false};
+			bool m_optimize{false};
+			bool m_enable3DTexCoords{false};
+			bool m_enableVertexColor{false};
+	};
+}
@@ -0,0 +1,177 @@
+/*
+ * src/Tool/ShaderPrecompiler.cpp
+ * This file is part of Emeraude-Engine
+ *
+ * Copyright (C) 2010-2025 - Sébastien Léon Claude Christian Bémelmans "LondNoir" <londnoir@gmail.com>
+ *
+ * Emeraude-Engine is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * Emeraude-Engine is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with Emeraude-Engine; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * Complete project and additional information can be found at :
+ * https://github.com/londnoir/emeraude-engine
+ *
+ * --- THIS IS AUTOMATICALLY GENERATED, DO NOT CHANGE ---
+ */
+
+#include "ShaderPrecompiler.hpp"
+
+/* STL inclusions. */
+#include <functional>
+#include <string>
+
+/* Local inclusions. */
+#include "Libs/IO/IO.hpp"
+#include "Arguments.hpp"
+#include "SettingKeys.hpp"
+#include "Tracer.hpp"
+
+namespace EmEn::Tool
+{
+	using namespace EmEn::Libs;
+
+	ShaderPrecompiler::ShaderPrecompiler (const Arguments & arguments, Saphir::ShaderManager & shaderManager) noexcept
+		: m_shaderManager(shaderManager)
+	{
+		const auto arg = arguments.get("--input", "-i");
+
+		if ( arg.isPresent() )
+		{
+			m_inputPath = arg.value();
+		}
+	}
+
+	bool
+	ShaderPrecompiler::execute () noexcept
+	{
+		std::vector< ServiceInterface * > services;
+
+		if ( !m_shaderManager.initialize(services) )
+		{
+			Tracer::error(ClassId, "Unable to initialize the shader manager !");
+
+			return false;
+		}
+
+		const auto success = [&] () {
+			if ( !m_shaderManager.isBinaryCacheEnabled() )
+			{
+				TraceError{ClassId} << "The shader binary cache is disabled ! Enable '" << BinaryCacheEnabledKey << "' in settings.";
+
+				return false;
+			}
+
+			std::vector< Saphir::ShaderManager::ShaderSource > sources;
+
+			if ( !this->readSources(sources) )
+			{
+				return false;
+			}
+
+			const auto cachedCount = m_shaderManager.cachedShaderBinaryCount();
+			const auto compiled = m_shaderManager.compileShaders(sources);
+
+			if ( !m_shaderManager.saveBinaryCache() )
+			{
+				Tracer::error(ClassId, "Unable to write the shader binary cache !");
+
+				return false;
+			}
+
+			TraceInfo{ClassId} << sources.size() << " shader source(s) read, " << m_shaderManager.cachedShaderBinaryCount() - cachedCount << " binary(ies) added to the cache.";
+
+			return compiled;
+		}();
+
+		for ( auto * service : services )
+		{
+			service->terminate();
+		}
+
+		return success;
+	}
+
+	bool
+	ShaderPrecompiler::readSources (std::vector< Saphir::ShaderManager::ShaderSource > & sources) const noexcept
+	{
+		const auto inputPath = m_inputPath.empty() ? m_shaderManager.shaderSourcesDirectory() : m_inputPath;
+
+		if ( !IO::directoryExists(inputPath) )
+		{
+			return ShaderPrecompiler::readSource(inputPath, sources);
+		}
+
+		for ( const auto & filepath : IO::directoryEntries(inputPath) )
+		{
+			if ( Saphir::getShaderTypeFromFileExtension(IO::getFileExtension(filepath)) == Saphir::ShaderType::Undefined )
+			{
+				continue;
+			}
+
+			if ( !ShaderPrecompiler::readSource(filepath, sources) )
+			{
+				TraceWarning{ClassId} << "Skipping the shader source file " << filepath << " !";
+			}
+		}
+
+		if ( sources.empty() )
+		{
+			TraceWarning{ClassId} << "No shader source file in " << inputPath << " ! Run the application with '" << SourceCodeCacheEnabledKey << "' enabled first or use '--input'.";
+
+			return false;
+		}
+
+		return true;
+	}
+
+	bool
+	ShaderPrecompiler::readSource (const std::filesystem::path & filepath, std::vector< Saphir::ShaderManager::ShaderSource > & sources) noexcept
+	{
+		const auto type = Saphir::getShaderTypeFromFileExtension(IO::getFileExtension(filepath));
+
+		if ( type == Saphir::ShaderType::Undefined )
+		{
+			TraceError{ClassId} << "The file " << filepath << " is not a shader source file !";
+
+			return false;
+		}
+
+		std::string sourceCode;
+
+		if ( !IO::fileGetContents(filepath, sourceCode) || sourceCode.empty() )
+		{
+			TraceError{ClassId} << "Unable to read the shader source file " << filepath << " !";
+
+			return false;
+		}
+
+		/* NOTE: The source cache files are named '<name>_<hash>.<extension>', the hash is recomputed from the content. */
+		auto name = filepath.stem().string();
+
+		if ( const auto position = name.rfind('_'); position != std::string::npos && position > 0 )
+		{
+			name.resize(position);
+		}
+
+		const auto hash = std::hash< std::string >{}(sourceCode);
+
+		sources.emplace_back(Saphir::ShaderManager::ShaderSource{
+			.name = std::move(name),
+			.type = type,
+			.sourceCode = std::move(sourceCode),
+			.hash = hash
+		});
+
+		return true;
+	}
+}
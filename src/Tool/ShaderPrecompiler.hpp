@@ -0,0 +1,86 @@
+/*
+ * src/Tool/ShaderPrecompiler.hpp
+ * This file is part of Emeraude-Engine
+ *
+ * Copyright (C) 2010-2025 - Sébastien Léon Claude Christian Bémelmans "LondNoir" <londnoir@gmail.com>
+ *
+ * Emeraude-Engine is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * Emeraude-Engine is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with Emeraude-Engine; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * Complete project and additional information can be found at :
+ * https://github.com/londnoir/emeraude-engine
+ *
+ * --- THIS IS AUTOMATICALLY GENERATED, DO NOT CHANGE ---
+ */
+
+#pragma once
+
+/* STL inclusions. */
+#include <filesystem>
+#include <vector>
+
+/* Local inclusions for inheritances. */
+#include "ToolInterface.hpp"
+
+/* Local inclusions for usages. */
+#include "Saphir/ShaderManager.hpp"
+
+namespace EmEn::Tool
+{
+	/**
+	 * @brief The shader precompiler tool. It compiles shader source files into the shader binary cache archive.
+	 * @note The default input is the shader source cache, filled by running the application with the source code cache enabled.
+	 * @extends EmEn::Tool::ToolInterface This is a tool interface.
+	 */
+	class ShaderPrecompiler final : public ToolInterface
+	{
+		public:
+
+			/** @brief Class identifier. */
+			static constexpr auto ClassId{"ShaderPrecompiler"};
+
+			/**
+			 * @brief Constructs the shader precompiler.
+			 * @param arguments A reference to the arguments.
+			 * @param shaderManager A reference to the shader manager.
+			 */
+			ShaderPrecompiler (const Arguments & arguments, Saphir::ShaderManager & shaderManager) noexcept;
+
+			/** @copydoc EmEn::Tool::ToolInterface::execute() */
+			[[nodiscard]]
+			bool execute () noexcept override;
+
+		private:
+
+			/**
+			 * @brief Reads the shader source files from the input path.
+			 * @param sources A reference to the list of shader sources to complete.
+			 * @return bool
+			 */
+			[[nodiscard]]
+			bool readSources (std::vector< Saphir::ShaderManager::ShaderSource > & sources) const noexcept;
+
+			/**
+			 * @brief Reads one shader source file.
+			 * @param filepath A reference to a filesystem path.
+			 * @param sources A reference to the list of shader sources to complete.
+			 * @return bool
+			 */
+			[[nodiscard]]
+			static bool readSource (const std::filesystem::path & filepath, std::vector< Saphir::ShaderManager::ShaderSource > & sources) noexcept;
+
+			Saphir::ShaderManager & m_shaderManager;
+			std::filesystem::path m_inputPath;
+	};
+}
@@ -59,6 +59,7 @@ namespace EmEn
 	const size_t Tracer::ClassUID{getClassUID(ClassId)};
 
 	Tracer * Tracer::s_instance{nullptr};
+	std::atomic< size_t > Tracer::s_nextInstanceId{0};
 
 	Tracer::Tracer (const Arguments & arguments, std::string processName, bool childProcess) noexcept
 		: ServiceInterface(ClassId),
@@ -79,6 +80,8 @@ namespace EmEn
 
 	Tracer::~Tracer ()
 	{
+		this->stopWritingThread();
+
 		s_instance = nullptr;
 	}
 
@@ -115,6 +118,8 @@ namespace EmEn
 			m_flags[IsTracerDisabled] = true;
 		}
 
+		this->startWritingThread();
+
 		m_flags[ServiceInitialized] = true;
 
 		return true;
@@ -125,6 +130,8 @@ namespace EmEn
 	{
 		m_flags[ServiceInitialized] = false;
 
+		this->stopWritingThread();
+
 		this->disableLogger();
 
 		return true;
@@ -149,6 +156,10 @@ namespace EmEn
 			case LogFormat::HTML :
 				filename << ".html";
 				break;
+
+			case LogFormat::Binary :
+				filename << ".trace";
+				break;
 		}
 
 		auto cacheDirectory = m_cacheDirectory;
@@ -164,15 +175,17 @@ namespace EmEn
 			return true;
 		}
 
-		m_logger = std::make_unique< TracerLogger >(filepath, m_logFormat);
+		auto logger = std::make_unique< TracerLogger >(filepath, m_logFormat);
 
-		if ( m_logger->start() )
+		if ( logger->isUsable() )
 		{
+			const std::lock_guard< std::mutex > lock{m_outputAccess};
+
+			m_logger = std::move(logger);
+
 			return true;
 		}
 
-		m_logger.reset();
-
 		this->trace(Severity::Error, ClassId, "Unable to enable the tracer logger!");
 
 		return false;
@@ -181,6 +194,11 @@ namespace EmEn
 	void
 	Tracer::disableLogger () noexcept
 	{
+		/* NOTE: Write what is still pending into the file before closing it. */
+		this->flush();
+
+		const std::lock_guard< std::mutex > lock{m_outputAccess};
+
 		m_logger.reset();
 	}
 
@@ -232,97 +250,332 @@ namespace EmEn
 			return;
 		}
 
-		std::stringstream trace;
+		/* NOTE: The trace would be neither printed nor logged. */
+		if ( m_flags[PrintOnlyErrors] && severity < Severity::Warning && m_logger == nullptr )
+		{
+			return;
+		}
 
-		trace << '[' << to_string(severity) << "][" << tag << ']';
+		this->record(severity, tag, message, location, false);
+
+		/* NOTE: The application is about to die, do not lose the last words. */
+		if ( severity == Severity::Fatal )
+		{
+			this->flush();
+		}
+	}
 
-		Tracer::colorizeMessage(trace, severity, message);
+	void
+	Tracer::traceAPI (const char * tag, const char * functionName, std::string_view message, const std::source_location & location) const noexcept
+	{
+		std::string apiMessage{functionName};
 
-		if ( this->isSourceLocationEnabled() )
+		if ( message.empty() )
 		{
-			trace << "\n\t" "[" << location.file_name() << ':' << location.line() << ':' << location.column() << " `" << location.function_name() << "`]";
+			apiMessage.append("() called !");
+		}
+		else
+		{
+			apiMessage.append("(), ");
+			apiMessage.append(message);
 		}
 
-		if ( this->isThreadInfosEnabled() )
+		this->record(Severity::Info, tag, apiMessage, location, true);
+	}
+
+	void
+	Tracer::flush () const noexcept
+	{
+		if ( !m_isWritingThreadRunning )
 		{
-			this->injectProcessInfo(trace);
+			return;
 		}
 
-		switch ( severity )
+		std::unique_lock< std::mutex > lock{m_writingAccess};
+
+		/* NOTE: The current pass may have already visited the buffer of this thread, so wait for the next one to complete. */
+		const auto targetPass = m_writingPass + 2;
+
+		m_wakeUpRequested = true;
+		m_writingCondition.notify_one();
+
+		m_flushCondition.wait_for(lock, FlushTimeout, [this, targetPass] {
+			return m_writingPass >= targetPass || !m_isWritingThreadRunning;
+		});
+	}
+
+	/**
+	 * @brief Returns the system ID of the calling thread.
+	 * @return int32_t
+	 */
+	[[nodiscard]]
+	static
+	int32_t
+	currentSystemThreadId () noexcept
+	{
+#if IS_LINUX
+		return static_cast< int32_t >(gettid());
+#elif IS_WINDOWS
+		return static_cast< int32_t >(GetCurrentThreadId());
+#else
+		return -1;
+#endif
+	}
+
+	Tracer::ThreadBuffer &
+	Tracer::threadBuffer () const noexcept
+	{
+		/* NOTE: The registry shares the buffer ownership, so traces survive the thread until they are written. */
+		thread_local size_t ownerId{0};
+		thread_local std::shared_ptr< ThreadBuffer > buffer;
+
+		if ( ownerId != m_instanceId || buffer == nullptr )
 		{
-			case Severity::Debug :
-			case Severity::Info :
-			case Severity::Success :
-				if ( !m_flags[PrintOnlyErrors] )
+			buffer = std::make_shared< ThreadBuffer >();
+			buffer->systemThreadId = currentSystemThreadId();
+
+			ownerId = m_instanceId;
+
+			const std::lock_guard< std::mutex > lock{m_outputAccess};
+
+			m_threadBuffers.emplace_back(buffer);
+		}
+
+		return *buffer;
+	}
+
+	void
+	Tracer::record (Severity severity, const char * tag, std::string_view message, const std::source_location & location, bool isAPICall) const noexcept
+	{
+		/* NOTE: Before the service initialization or after its termination, traces are written directly. */
+		if ( !m_isWritingThreadRunning.load(std::memory_order_acquire) )
+		{
+			TracerEntry entry;
+			entry.setHeader(severity, tag, location, currentSystemThreadId(), 1, isAPICall);
+
+			const std::lock_guard< std::mutex > lock{m_outputAccess};
+
+			this->write(entry, message);
+
+			if ( m_logger != nullptr )
+			{
+				m_logger->flush();
+			}
+
+			return;
+		}
+
+		auto & buffer = this->threadBuffer();
+
+		const auto chunkCount = TracerEntry::chunkCount(message.size());
+
+		const auto recorded = buffer.entries.emplace(chunkCount, [&] (TracerEntry & slot, size_t index) {
+			if ( index == 0 )
+			{
+				slot.setHeader(severity, tag, location, buffer.systemThreadId, chunkCount, isAPICall);
+			}
+
+			slot.setPayload(message.substr(std::min(index * TracerEntry::PayloadSize, message.size()), TracerEntry::PayloadSize));
+		});
+
+		if ( !recorded )
+		{
+			buffer.droppedEntries.fetch_add(1, std::memory_order_relaxed);
+
+			m_droppedEntries.fetch_add(1, std::memory_order_relaxed);
+		}
+
+		/* NOTE: Only wake up the writing thread for important traces or a filling buffer, otherwise it polls at WritingInterval. */
+		if ( !recorded || severity >= Severity::Warning || buffer.entries.size() >= ThreadBufferCapacity / 2 )
+		{
+			m_wakeUpRequested = true;
+			m_writingCondition.notify_one();
+		}
+	}
+
+	void
+	Tracer::startWritingThread () noexcept
+	{
+		if ( m_isWritingThreadRunning )
+		{
+			return;
+		}
+
+		m_isWritingThreadRunning = true;
+
+		m_writingThread = std::thread{&Tracer::writingTask, this};
+	}
+
+	void
+	Tracer::stopWritingThread () noexcept
+	{
+		{
+			const std::lock_guard< std::mutex > lock{m_writingAccess};
+
+			m_isWritingThreadRunning = false;
+		}
+
+		m_writingCondition.notify_one();
+		m_flushCondition.notify_all();
+
+		if ( m_writingThread.joinable() )
+		{
+			m_writingThread.join();
+		}
+
+		/* NOTE: Write traces recorded while the thread was stopping. */
+		const std::lock_guard< std::mutex > lock{m_outputAccess};
+
+		this->drainBuffers();
+	}
+
+	void
+	Tracer::writingTask () noexcept
+	{
+		while ( m_isWritingThreadRunning )
+		{
+			{
+				std::unique_lock< std::mutex > lock{m_writingAccess};
+
+				m_writingCondition.wait_for(lock, WritingInterval, [this] {
+					return m_wakeUpRequested || !m_isWritingThreadRunning;
+				});
+
+				m_wakeUpRequested = false;
+			}
+
+			{
+				const std::lock_guard< std::mutex > lock{m_outputAccess};
+
+				this->drainBuffers();
+			}
+
+			{
+				const std::lock_guard< std::mutex > lock{m_writingAccess};
+
+				m_writingPass++;
+			}
+
+			m_flushCondition.notify_all();
+		}
+	}
+
+	void
+	Tracer::drainBuffers () const noexcept
+	{
+		for ( auto bufferIt = m_threadBuffers.begin(); bufferIt != m_threadBuffers.end(); )
+		{
+			auto & buffer = **bufferIt;
+
+			buffer.entries.consume([this, &buffer] (const TracerEntry & record) {
+				/* NOTE: Most messages fit in one record, write them in place. */
+				if ( buffer.pendingChunks == 0 && record.chunkCount() <= 1 )
 				{
-					std::cout << trace.str() << '\n';
+					this->write(record, record.payload());
+
+					return;
 				}
-				break;
 
-			case Severity::Warning :
-			case Severity::Error :
-			case Severity::Fatal :
-				std::cerr << trace.str() << '\n';
-				break;
+				if ( buffer.pendingChunks == 0 )
+				{
+					buffer.pendingHeader = record;
+					buffer.pendingMessage.assign(record.payload());
+					buffer.pendingChunks = record.chunkCount();
+				}
+				else
+				{
+					buffer.pendingMessage.append(record.payload());
+				}
+
+				if ( --buffer.pendingChunks == 0 )
+				{
+					this->write(buffer.pendingHeader, buffer.pendingMessage);
+				}
+			});
+
+			if ( const auto droppedEntries = buffer.droppedEntries.exchange(0, std::memory_order_relaxed); droppedEntries > 0 )
+			{
+				TracerEntry entry;
+				entry.setHeader(Severity::Warning, ClassId, std::source_location::current(), buffer.systemThreadId, 1, false);
+
+				this->write(entry, (std::stringstream{} << droppedEntries << " trace(s) dropped, the thread ring buffer was full !").str());
+			}
+
+			/* NOTE: The thread is gone and everything it traced has been written. */
+			if ( bufferIt->use_count() == 1 && buffer.entries.empty() && buffer.pendingChunks == 0 )
+			{
+				bufferIt = m_threadBuffers.erase(bufferIt);
+			}
+			else
+			{
+				++bufferIt;
+			}
 		}
 
 		if ( m_logger != nullptr )
 		{
-			m_logger->push(severity, tag, std::string{message}, location);
+			m_logger->flush();
 		}
 	}
 
 	void
-	Tracer::traceAPI (const char * tag, const char * functionName, std::string_view message, const std::source_location & location) const noexcept
+	Tracer::write (const TracerEntry & entry, std::string_view message) const noexcept
 	{
-		std::stringstream trace;
+		const auto severity = entry.severity();
 
-		trace << "[" << tag << "] ";
+		std::stringstream trace;
 
-		if ( message.empty() )
+		if ( entry.isAPICall() )
 		{
-			trace << "\033[1;93m" << functionName << "() called !" << "\033[0m ";
+			trace << "[" << entry.tag() << "] " "\033[1;93m" << message << "\033[0m ";
 		}
 		else
 		{
-			trace << "\033[1;93m" << functionName << "(), " << message << "\033[0m ";
+			trace << '[' << to_string(severity) << "][" << entry.tag() << ']';
+
+			Tracer::colorizeMessage(trace, severity, message);
 		}
 
 		if ( this->isSourceLocationEnabled() )
 		{
+			const auto & location = entry.location();
+
 			trace << "\n\t" "[" << location.file_name() << ':' << location.line() << ':' << location.column() << " `" << location.function_name() << "`]";
 		}
 
 		if ( this->isThreadInfosEnabled() )
 		{
-			this->injectProcessInfo(trace);
+			this->injectProcessInfo(trace, entry.systemThreadId());
 		}
 
-		std::cout << trace.str() << "\n";
+		switch ( severity )
+		{
+			case Severity::Debug :
+			case Severity::Info :
+			case Severity::Success :
+				if ( !m_flags[PrintOnlyErrors] || entry.isAPICall() )
+				{
+					std::cout << trace.str() << '\n';
+				}
+				break;
+
+			case Severity::Warning :
+			case Severity::Error :
+			case Severity::Fatal :
+				std::cerr << trace.str() << '\n';
+				break;
+		}
 
 		if ( m_logger != nullptr )
 		{
-			std::stringstream logMessage{};
-			logMessage << functionName << "() : " << message;
-
-			m_logger->push(Severity::Info, tag, logMessage.str(), location);
+			m_logger->write(entry, message);
 		}
 	}
 
 	void
-	Tracer::injectProcessInfo (std::stringstream & stream) const noexcept
+	Tracer::injectProcessInfo (std::stringstream & stream, int32_t systemThreadId) const noexcept
 	{
-#if IS_LINUX
-		const auto tid = gettid();
-#elif IS_MACOS
-		const auto tid = -1;
-#elif IS_WINDOWS
-		const auto tid = GetCurrentThreadId();
-#else
-		const auto tid = -1;
-#endif
-
-		stream << "[PPID:" << m_parentProcessID << "][PID:" << m_processID << "][TID:" << tid << ']';
+		stream << "[PPID:" << m_parentProcessID << "][PID:" << m_processID << "][TID:" << systemThreadId << ']';
 	}
 
 	void
@@ -29,7 +29,11 @@
 /* STL inclusions. */
 #include <cstddef>
 #include <cstdint>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
 #include <memory>
+#include <mutex>
 #include <sstream>
 #include <string>
 #include <thread>
@@ -42,6 +46,8 @@
 
 /* Local inclusions for usages. */
 #include "Libs/BlobTrait.hpp"
+#include "Libs/SPSCRingBuffer.hpp"
+#include "TracerEntry.hpp"
 #include "TracerLogger.hpp"
 #include "Types.hpp"
 
@@ -57,6 +63,9 @@ namespace EmEn
 {
 	/**
 	 * @brief The tracer service class responsible for logging messages, errors, warnings, etc. to the terminal or in a log file.
+	 * @note Once initialized, a trace only copies a binary record into a lock-free ring buffer owned by the calling thread.
+	 * A writing thread drains these buffers and does the formatting for the terminal and the log file. When a buffer is full,
+	 * the trace is dropped and counted instead of blocking the calling thread.
 	 * @extends EmEn::ServiceInterface This is a service.
 	 */
 	class Tracer final : public ServiceInterface
@@ -69,6 +78,15 @@ namespace EmEn
 			/** @brief Observable class unique identifier. */
 			static const size_t ClassUID;
 
+			/** @brief The number of records in the ring buffer of each tracing thread. */
+			static constexpr size_t ThreadBufferCapacity{1024};
+
+			/** @brief The maximum delay between two passes of the writing thread. */
+			static constexpr std::chrono::milliseconds WritingInterval{10};
+
+			/** @brief The maximum time to wait for a flush. */
+			static constexpr std::chrono::milliseconds FlushTimeout{1000};
+
 			/* ANSI Escape Codes */
 			static constexpr auto CSI{"\033["};
 
@@ -343,6 +361,24 @@ namespace EmEn
 			 */
 			void traceAPI (const char * tag, const char * functionName, std::string_view message = {}, const std::source_location & location = std::source_location::current()) const noexcept;
 
+			/**
+			 * @brief Waits for the writing thread to output every trace already recorded.
+			 * @note This is automatically done after a fatal trace. Returns immediately if the writing thread is not running.
+			 * @return void
+			 */
+			void flush () const noexcept;
+
+			/**
+			 * @brief Returns the number of traces dropped because a thread ring buffer was full.
+			 * @return uint64_t
+			 */
+			[[nodiscard]]
+			uint64_t
+			droppedEntries () const noexcept
+			{
+				return m_droppedEntries.load(std::memory_order_relaxed);
+			}
+
 			/**
 			 * @brief Generates the name of a log file based on a name.
 			 * @param name A reference to a string.
@@ -475,12 +511,78 @@ namespace EmEn
 
 		private:
 
+			/**
+			 * @brief The ring buffer of a tracing thread.
+			 * @note The producer side belongs to the thread, the consumer side to the writing thread.
+			 */
+			struct ThreadBuffer
+			{
+				Libs::SPSCRingBuffer< TracerEntry, ThreadBufferCapacity > entries;
+				std::atomic< uint64_t > droppedEntries{0};
+				int32_t systemThreadId{-1};
+				/* NOTE: Consumer side, the message being reassembled from records. */
+				TracerEntry pendingHeader;
+				std::string pendingMessage;
+				size_t pendingChunks{0};
+			};
+
 			/** @copydoc EmEn::ServiceInterface::onInitialize() */
 			bool onInitialize () noexcept override;
 
 			/** @copydoc EmEn::ServiceInterface::onTerminate() */
 			bool onTerminate () noexcept override;
 
+			/**
+			 * @brief Returns the ring buffer of the calling thread, registers it on the first call.
+			 * @return ThreadBuffer &
+			 */
+			[[nodiscard]]
+			ThreadBuffer & threadBuffer () const noexcept;
+
+			/**
+			 * @brief Records a trace in the ring buffer of the calling thread, or writes it directly when the writing thread is not running.
+			 * @param severity The type of log.
+			 * @param tag A pointer on a c-string to identify and sort logs.
+			 * @param message A string view.
+			 * @param location A reference to a source_location.
+			 * @param isAPICall Declares a trace from traceAPI().
+			 * @return void
+			 */
+			void record (Severity severity, const char * tag, std::string_view message, const std::source_location & location, bool isAPICall) const noexcept;
+
+			/**
+			 * @brief Starts the writing thread.
+			 * @return void
+			 */
+			void startWritingThread () noexcept;
+
+			/**
+			 * @brief Stops the writing thread after a last pass over the buffers.
+			 * @return void
+			 */
+			void stopWritingThread () noexcept;
+
+			/**
+			 * @brief Runs the writing thread.
+			 * @return void
+			 */
+			void writingTask () noexcept;
+
+			/**
+			 * @brief Drains every registered ring buffer and writes the traces.
+			 * @note Must be called with the output lock.
+			 * @return void
+			 */
+			void drainBuffers () const noexcept;
+
+			/**
+			 * @brief Formats a complete trace to the terminal and the log file.
+			 * @param entry A reference to the header record.
+			 * @param message The complete message.
+			 * @return void
+			 */
+			void write (const TracerEntry & entry, std::string_view message) const noexcept;
+
 			/**
 			 * @brief Colorizes a message from the severity type.
 			 * @param stream A reference to a stream.
@@ -524,9 +626,10 @@ namespace EmEn
 			/**
 			 * @brief Injects process and thread info.
 			 * @param stream A reference to a stream.
+			 * @param systemThreadId The system thread ID.
 			 * @return void
 			 */
-			void injectProcessInfo (std::stringstream & stream) const noexcept;
+			void injectProcessInfo (std::stringstream & stream, int32_t systemThreadId) const noexcept;
 
 			/**
 			 * @brief Filters the current tag. If the method returns true, the message with the tag is allowed to be displayed.
@@ -545,12 +648,24 @@ namespace EmEn
 			static constexpr auto LoggerRequestedAtStartup{6UL};
 
 			static Tracer * s_instance;
+			static std::atomic< size_t > s_nextInstanceId;
 
 			const Arguments & m_arguments;
 			std::filesystem::path m_cacheDirectory;
 			std::string m_processName;
 			std::vector< std::string > m_filters;
 			std::unique_ptr< TracerLogger > m_logger;
+			size_t m_instanceId{s_nextInstanceId.fetch_add(1) + 1};
+			mutable std::vector< std::shared_ptr< ThreadBuffer > > m_threadBuffers;
+			mutable std::mutex m_outputAccess;
+			mutable std::mutex m_writingAccess;
+			mutable std::condition_variable m_writingCondition;
+			mutable std::condition_variable m_flushCondition;
+			mutable uint64_t m_writingPass{0};
+			mutable std::atomic< uint64_t > m_droppedEntries{0};
+			mutable std::atomic_bool m_wakeUpRequested{false};
+			std::atomic_bool m_isWritingThreadRunning{false};
+			std::thread m_writingThread;
 			LogFormat m_logFormat{LogFormat::Text};
 			int m_parentProcessID{-1};
 			int m_processID{-1};
@@ -27,8 +27,12 @@
 #pragma once
 
 /* STL inclusions. */
+#include <cstddef>
+#include <cstdint>
+#include <algorithm>
+#include <array>
 #include <chrono>
-#include <string>
+#include <string_view>
 #include <thread>
 #include "Libs/std_source_location.hpp"
 
@@ -38,28 +42,80 @@
 namespace EmEn
 {
 	/**
-	 * @brief A single entry for the tracer.
+	 * @brief A single fixed-size binary record of the tracer. This is what travels through the per-thread ring buffers.
+	 * @note A message longer than the payload is split over consecutive records. Only the first one holds the header (severity, tag, location, time, thread),
+	 * the following ones only carry the rest of the payload. Formatting is deferred to the tracer writing thread.
 	 */
 	class TracerEntry final
 	{
 		public:
 
+			/** @brief The maximum tag length kept, including the null character. */
+			static constexpr size_t TagSize{32};
+			/** @brief The message bytes carried by a single record. */
+			static constexpr size_t PayloadSize{176};
+			/** @brief The maximum records for one message, beyond that the message is truncated. */
+			static constexpr size_t MaxChunkCount{64};
+
+			/**
+			 * @brief Constructs an empty tracer entry.
+			 */
+			TracerEntry () noexcept = default;
+
+			/**
+			 * @brief Returns the number of records needed to store a message.
+			 * @param messageSize The size of the message in bytes.
+			 * @return size_t
+			 */
+			[[nodiscard]]
+			static
+			constexpr
+			size_t
+			chunkCount (size_t messageSize) noexcept
+			{
+				return std::clamp< size_t >((messageSize + PayloadSize - 1) / PayloadSize, 1, MaxChunkCount);
+			}
+
 			/**
-			 * @brief Constructs a tracer entry.
+			 * @brief Fills the header of the first record of a message.
 			 * @param severity The severity of the message.
-			 * @param tag The tag to sort and/or filter entries.
-			 * @param message The content of the entry [std::move].
-			 * @param location The location of the message in the code source.
-			 * @param threadId The thread ID.
+			 * @param tag A pointer to a C-string to sort and/or filter entries. The string is copied and truncated to TagSize.
+			 * @param location A reference to the location of the message in the code source.
+			 * @param systemThreadId The system thread ID.
+			 * @param chunkCount The number of records used by the message.
+			 * @param isAPICall Declares a call trace from Tracer::traceAPI().
+			 * @return void
 			 */
-			TracerEntry (Severity severity, const char * tag, std::string message, const std::source_location & location, const std::thread::id & threadId) noexcept
-				: m_severity(severity),
-				m_tag(tag),
-				m_message(std::move(message)),
-				m_location(location),
-				m_threadId(threadId)
+			void
+			setHeader (Severity severity, const char * tag, const std::source_location & location, int32_t systemThreadId, size_t chunkCount, bool isAPICall) noexcept
 			{
+				m_time = std::chrono::steady_clock::now();
+				m_location = location;
+				m_threadId = std::this_thread::get_id();
+				m_systemThreadId = systemThreadId;
+				m_chunkCount = static_cast< uint16_t >(chunkCount);
+				m_severity = severity;
+				m_isAPICall = isAPICall;
 
+				const std::string_view tagView{tag != nullptr ? tag : ""};
+				const auto tagLength = std::min(tagView.size(), TagSize - 1);
+
+				std::copy_n(tagView.data(), tagLength, m_tag.data());
+
+				m_tag[tagLength] = '\0';
+			}
+
+			/**
+			 * @brief Copies a part of the message in the record.
+			 * @param part A string view of at most PayloadSize bytes.
+			 * @return void
+			 */
+			void
+			setPayload (std::string_view part) noexcept
+			{
+				m_payloadSize = static_cast< uint8_t >(std::min(part.size(), PayloadSize));
+
+				std::copy_n(part.data(), m_payloadSize, m_payload.data());
 			}
 
 			/**
@@ -92,18 +148,18 @@ namespace EmEn
 			const char *
 			tag () const noexcept
 			{
-				return m_tag;
+				return m_tag.data();
 			}
 
 			/**
-			 * @brief Returns the message.
-			 * @return const std::string &
+			 * @brief Returns the part of the message held by this record.
+			 * @return std::string_view
 			 */
 			[[nodiscard]]
-			const std::string &
-			message () const noexcept
+			std::string_view
+			payload () const noexcept
 			{
-				return m_message;
+				return {m_payload.data(), m_payloadSize};
 			}
 
 			/**
@@ -128,13 +184,50 @@ namespace EmEn
 				return m_threadId;
 			}
 
+			/**
+			 * @brief Returns the system thread ID where the entry was generated.
+			 * @return int32_t
+			 */
+			[[nodiscard]]
+			int32_t
+			systemThreadId () const noexcept
+			{
+				return m_systemThreadId;
+			}
+
+			/**
+			 * @brief Returns the number of records used by the message.
+			 * @return size_t
+			 */
+			[[nodiscard]]
+			size_t
+			chunkCount () const noexcept
+			{
+				return m_chunkCount;
+			}
+
+			/**
+			 * @brief Returns whether the entry comes from Tracer::traceAPI().
+			 * @return bool
+			 */
+			[[nodiscard]]
+			bool
+			isAPICall () const noexcept
+			{
+				return m_isAPICall;
+			}
+
 		private:
 
-			std::chrono::time_point< std::chrono::steady_clock > m_time{std::chrono::steady_clock::now()};
-			Severity m_severity{Severity::Info};
-			const char * m_tag{nullptr};
-			std::string m_message;
+			std::chrono::time_point< std::chrono::steady_clock > m_time;
 			std::source_location m_location;
 			std::thread::id m_threadId;
+			int32_t m_systemThreadId{-1};
+			uint16_t m_chunkCount{1};
+			uint8_t m_payloadSize{0};
+			Severity m_severity{Severity::Info};
+			bool m_isAPICall{false};
+			std::array< char, TagSize > m_tag{};
+			std::array< char, PayloadSize > m_payload{};
 	};
 }
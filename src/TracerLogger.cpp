@@ -27,25 +27,40 @@
 #include "TracerLogger.hpp"
 
 /* STL inclusions. */
-#include <fstream>
-#include <thread>
+#include <chrono>
 #include <utility>
 
 namespace EmEn
 {
+	/**
+	 * @brief Returns a steady clock time point in nanoseconds.
+	 * @param time A reference to a time point.
+	 * @return uint64_t
+	 */
+	[[nodiscard]]
+	static
+	uint64_t
+	toNanoseconds (const std::chrono::time_point< std::chrono::steady_clock > & time) noexcept
+	{
+		return static_cast< uint64_t >(std::chrono::duration_cast< std::chrono::nanoseconds >(time.time_since_epoch()).count());
+	}
+
 	TracerLogger::TracerLogger (std::filesystem::path filepath, LogFormat logFormat) noexcept
 		: m_filepath(std::move(filepath)),
 		m_logFormat(logFormat)
 	{
-		std::fstream file{m_filepath, std::ios::out | std::ios::trunc};
+		auto mode = std::ios::out | std::ios::trunc;
 
-		m_isUsable = file.is_open();
+		if ( m_logFormat == LogFormat::Binary )
+		{
+			mode |= std::ios::binary;
+		}
 
-		file.close();
+		m_file.open(m_filepath, mode);
 
 		if constexpr ( IsDebug )
 		{
-			if ( m_isUsable )
+			if ( m_file.is_open() )
 			{
 				std::cout << "TracerLogger::TracerLogger() : Log file " << m_filepath << " opened !" "\n";
 			}
@@ -54,36 +69,38 @@ namespace EmEn
 				std::cerr << "TracerLogger::TracerLogger() : Unable to open the log file " << m_filepath << " !" "\n";
 			}
 		}
+
+		if ( m_file.is_open() )
+		{
+			this->writeHeader();
+		}
 	}
 
 	TracerLogger::~TracerLogger ()
 	{
-		this->stop();
-
-		if ( m_thread.joinable() )
+		if ( m_file.is_open() )
 		{
-			m_thread.join();
+			this->writeFooter();
+
+			m_file.close();
 		}
 	}
 
 	void
-	TracerLogger::task () noexcept
+	TracerLogger::writeHeader () noexcept
 	{
-		std::fstream file{m_filepath, std::ios::out | std::ios::app};
-
-		/* NOTE: Write the file start. */
 		switch ( m_logFormat )
 		{
 			case LogFormat::Text :
-				file << "====== " << EngineName << " " << VersionString << " execution. Beginning at " << std::chrono::steady_clock::now().time_since_epoch().count() << " ======" "\n";
+				m_file << "====== " << EngineName << " " << VersionString << " execution. Beginning at " << std::chrono::steady_clock::now().time_since_epoch().count() << " ======" "\n";
 				break;
 
 			case LogFormat::JSON :
-				file << "{" "\n";
+				m_file << "{" "\n";
 				break;
 
 			case LogFormat::HTML :
-				file <<
+				m_file <<
 					"<!DOCTYPE html>" "\n"
 					"<html>" "\n"
 					"\t" "<head>" "\n"
@@ -94,96 +111,131 @@ namespace EmEn
 					"\t\t" "<h1>" << EngineName << " " << VersionString << " execution</h1>" "\n"
 					"\t\t" "<p>Beginning at " << std::chrono::steady_clock::now().time_since_epoch().count() << "</p>" "\n";
 				break;
-		}
 
-		while ( m_isRunning )
-		{
-			std::queue< TracerEntry > localQueue;
+			case LogFormat::Binary :
+				m_file.write("EMTRACE", 8);
+				this->writeValue(BinaryVersion);
+				this->writeValue(toNanoseconds(std::chrono::steady_clock::now()));
+				break;
+		}
 
-			{
-				std::unique_lock< std::mutex > lock{m_entriesAccess};
+		m_file.flush();
+	}
 
-				/* NOTE: Wait for the thread to be wake up. */
-				m_condition.wait(lock, [&] {
-					return !m_entries.empty() || !m_isRunning;
-				});
+	void
+	TracerLogger::writeFooter () noexcept
+	{
+		switch ( m_logFormat )
+		{
+			case LogFormat::Text :
+				m_file << "====== Log file closed properly ======" "\n";
+				break;
 
-				if ( !m_entries.empty() )
-				{
-					m_entries.swap(localQueue);
-				}
-			}
+			case LogFormat::JSON :
+				m_file << "}" "\n";
+				break;
 
-			while ( !localQueue.empty() )
-			{
-				const auto & entry = localQueue.front();
-
-				switch ( m_logFormat )
-				{
-					case LogFormat::Text :
-						file <<
-							"[" << entry.time().time_since_epoch().count() << "]"
-							"[" << entry.tag() << "]"
-							"[" << to_string(entry.severity()) << "]"
-							"[" << entry.location().file_name() << ':' << entry.location().line() << ':' << entry.location().column() << " `" << entry.location().function_name() << "`]" "\n"
-							<< entry.message() << '\n';
-						break;
-
-					case LogFormat::JSON :
-						file <<
-							"\t" "{" "\n"
-							"\t\t" "\"tag\" : " << entry.tag() << " @ <small><i>" << entry.location().file_name() << ':' << entry.location().line() << ':' << entry.location().column() << " `" << entry.location().function_name() << '`' << "</i></small></h2>" "\n"
-							"\t\t" "\"filename\" : " << entry.location().file_name() << ':' << entry.location().line() << ':' << entry.location().column() << " `" << entry.location().function_name() << '`' << "</i></small></h2>" "\n"
-							"\t\t" "\"line\" : " <<  entry.location().line() << ':' << entry.location().column() << " `" << entry.location().function_name() << '`' << "</i></small></h2>" "\n"
-							"\t\t" "\"column\" :" << entry.location().column() << " `" << entry.location().function_name() << '`' << "</i></small></h2>" "\n"
-							"\t\t" "\"function\" : " << entry.location().function_name() << '`' << "</i></small></h2>" "\n"
-							"\t\t" "<p class=\"entry-time\">Time: " << entry.time().time_since_epoch().count() << "</p>" "\n"
-							"\t\t" "<p class=\"entry-thread\">Thread: " << entry.threadId() << "</p>" "\n"
-							"\t\t" "<p class=\"entry-severity\">Severity: " << to_string(entry.severity()) << "<p/>" "\n"
-							"\t\t" "<pre class=\"entry-message\">" "\n"
-							<< entry.message() << "\n"
-							"\t\t" "</pre>" "\n"
-							"\t" "}" "\n";
-						break;
-
-					case LogFormat::HTML :
-						file <<
-							"\t\t" "<div>" "\n"
-							"\t\t\t" "<h2 class=\"entry-tag\">" << entry.tag() << " @ <small><i>" << entry.location().file_name() << ':' << entry.location().line() << ':' << entry.location().column() << " `" << entry.location().function_name() << '`' << "</i></small></h2>" "\n"
-							"\t\t\t" "<p class=\"entry-time\">Time: " << entry.time().time_since_epoch().count() << "</p>" "\n"
-							"\t\t\t" "<p class=\"entry-thread\">Thread: " << entry.threadId() << "</p>" "\n"
-							"\t\t\t" "<p class=\"entry-severity\">Severity: " << to_string(entry.severity()) << "<p/>" "\n"
-							"\t\t\t" "<pre class=\"entry-message\">" "\n"
-							<< entry.message() << "\n"
-							"\t\t\t" "</pre>" "\n"
-							"\t\t" "</div>" "\n";
-						break;
-				}
-
-				localQueue.pop();
-			}
+			case LogFormat::HTML :
+				m_file <<
+				   "\t\t" "<p>Ending at " << std::chrono::steady_clock::now().time_since_epoch().count() << "</p>" "\n"
+				   "\t" "</body>" "\n"
+				   "</html>" "\n";
+				break;
 
-			/* NOTE: Force to write into the file. */
-			file.flush();
+			case LogFormat::Binary :
+				this->writeValue('Z');
+				this->writeValue(toNanoseconds(std::chrono::steady_clock::now()));
+				break;
 		}
+	}
 
-		/* NOTE: Write the file end. */
+	void
+	TracerLogger::write (const TracerEntry & entry, std::string_view message) noexcept
+	{
 		switch ( m_logFormat )
 		{
 			case LogFormat::Text :
-				file << "====== Log file closed properly ======" "\n";
+				m_file <<
+					"[" << entry.time().time_since_epoch().count() << "]"
+					"[" << entry.tag() << "]"
+					"[" << to_string(entry.severity()) << "]"
+					"[" << entry.location().file_name() << ':' << entry.location().line() << ':' << entry.location().column() << " `" << entry.location().function_name() << "`]" "\n"
+					<< message << '\n';
 				break;
 
 			case LogFormat::JSON :
-				file << "}" "\n";
+				m_file <<
+					"\t" "{" "\n"
+					"\t\t" "\"tag\" : " << entry.tag() << " @ <small><i>" << entry.location().file_name() << ':' << entry.location().line() << ':' << entry.location().column() << " `" << entry.location().function_name() << '`' << "</i></small></h2>" "\n"
+					"\t\t" "\"filename\" : " << entry.location().file_name() << ':' << entry.location().line() << ':' << entry.location().column() << " `" << entry.location().function_name() << '`' << "</i></small></h2>" "\n"
+					"\t\t" "\"line\" : " <<  entry.location().line() << ':' << entry.location().column() << " `" << entry.location().function_name() << '`' << "</i></small></h2>" "\n"
+					"\t\t" "\"column\" :" << entry.location().column() << " `" << entry.location().function_name() << '`' << "</i></small></h2>" "\n"
+					"\t\t" "\"function\" : " << entry.location().function_name() << '`' << "</i></small></h2>" "\n"
+					"\t\t" "<p class=\"entry-time\">Time: " << entry.time().time_since_epoch().count() << "</p>" "\n"
+					"\t\t" "<p class=\"entry-thread\">Thread: " << entry.threadId() << "</p>" "\n"
+					"\t\t" "<p class=\"entry-severity\">Severity: " << to_string(entry.severity()) << "<p/>" "\n"
+					"\t\t" "<pre class=\"entry-message\">" "\n"
+					<< message << "\n"
+					"\t\t" "</pre>" "\n"
+					"\t" "}" "\n";
 				break;
 
 			case LogFormat::HTML :
-				file <<
-				   "\t\t" "<p>Ending at " << std::chrono::steady_clock::now().time_since_epoch().count() << "</p>" "\n"
-				   "\t" "</body>" "\n"
-				   "</html>" "\n";
+				m_file <<
+					"\t\t" "<div>" "\n"
+					"\t\t\t" "<h2 class=\"entry-tag\">" << entry.tag() << " @ <small><i>" << entry.location().file_name() << ':' << entry.location().line() << ':' << entry.location().column() << " `" << entry.location().function_name() << '`' << "</i></small></h2>" "\n"
+					"\t\t\t" "<p class=\"entry-time\">Time: " << entry.time().time_since_epoch().count() << "</p>" "\n"
+					"\t\t\t" "<p class=\"entry-thread\">Thread: " << entry.threadId() << "</p>" "\n"
+					"\t\t\t" "<p class=\"entry-severity\">Severity: " << to_string(entry.severity()) << "<p/>" "\n"
+					"\t\t\t" "<pre class=\"entry-message\">" "\n"
+					<< message << "\n"
+					"\t\t\t" "</pre>" "\n"
+					"\t\t" "</div>" "\n";
+				break;
+
+			case LogFormat::Binary :
+				this->writeBinary(entry, message);
 				break;
 		}
 	}
+
+	void
+	TracerLogger::writeBinary (const TracerEntry & entry, std::string_view message) noexcept
+	{
+		/* NOTE: Strings definitions must be written before the entry record. */
+		const auto tagId = this->stringId(entry.tag());
+		const auto fileId = this->stringId(entry.location().file_name());
+		const auto functionId = this->stringId(entry.location().function_name());
+
+		this->writeValue('E');
+		this->writeValue(toNanoseconds(entry.time()));
+		this->writeValue(static_cast< uint8_t >(entry.severity()));
+		this->writeValue(static_cast< uint8_t >(entry.isAPICall() ? 1 : 0));
+		this->writeValue(entry.systemThreadId());
+		this->writeValue(tagId);
+		this->writeValue(fileId);
+		this->writeValue(functionId);
+		this->writeValue(static_cast< uint32_t >(entry.location().line()));
+		this->writeValue(static_cast< uint32_t >(entry.location().column()));
+		this->writeValue(static_cast< uint32_t >(message.size()));
+
+		m_file.write(message.data(), static_cast< std::streamsize >(message.size()));
+	}
+
+	uint32_t
+	TracerLogger::stringId (std::string_view string) noexcept
+	{
+		const auto [stringIt, inserted] = m_strings.try_emplace(std::string{string}, static_cast< uint32_t >(m_strings.size()));
+
+		if ( inserted )
+		{
+			this->writeValue('S');
+			this->writeValue(stringIt->second);
+			this->writeValue(static_cast< uint32_t >(string.size()));
+
+			m_file.write(string.data(), static_cast< std::streamsize >(string.size()));
+		}
+
+		return stringIt->second;
+	}
 }
@@ -30,12 +30,13 @@
 #include "emeraude_config.hpp"
 
 /* STL inclusions. */
-#include <iostream>
+#include <cstdint>
 #include <filesystem>
-#include <condition_variable>
-#include <mutex>
-#include <queue>
+#include <fstream>
+#include <iostream>
 #include <string>
+#include <string_view>
+#include <unordered_map>
 
 /* Local inclusions for usages. */
 #include "TracerEntry.hpp"
@@ -44,12 +45,23 @@
 namespace EmEn
 {
 	/**
-	 * @brief The tracer logger class.
+	 * @brief The tracer logger class. This writes formatted entries into a log file.
+	 * @note The logger has no thread of its own, it is fed by the tracer writing thread.
+	 *
+	 * The binary format is a stream of records in host byte order, following a header made of the magic "EMTRACE" (8 bytes with the null character),
+	 * a version (uint16) and the starting time in nanoseconds (uint64). Records start with a type (uint8):
+	 *  - 'S' : string definition, id (uint32), size (uint32) and bytes. Tags, file and function names are only written once, then referred by id.
+	 *  - 'E' : entry, time in nanoseconds (uint64), severity (uint8), API call (uint8), system thread ID (int32), tag id (uint32), file id (uint32),
+	 *          function id (uint32), line (uint32), column (uint32), message size (uint32) and bytes.
+	 *  - 'Z' : end of log, time in nanoseconds (uint64).
 	 */
 	class TracerLogger final
 	{
 		public:
 
+			/** @brief The binary log format version. */
+			static constexpr uint16_t BinaryVersion{1};
+
 			/**
 			 * @brief Constructs the trace logger.
 			 * @param filepath A reference to a path to the log file [std::move].
@@ -58,93 +70,122 @@ namespace EmEn
 			explicit TracerLogger (std::filesystem::path filepath, LogFormat logFormat = LogFormat::Text) noexcept;
 
 			/**
-			 * @brief Destructs the trace logger.
+			 * @brief Copy constructor.
+			 * @param copy A reference to the copied instance.
 			 */
-			~TracerLogger ();
+			TracerLogger (const TracerLogger & copy) noexcept = delete;
 
 			/**
-			 * @brief Creates a log.
-			 * @param severity The type of log.
-			 * @param tag A pointer to a C-string to describe a tag. This helps for sorting logs.
-			 * @param message A reference to a string for the log content.
-			 * @param location A reference to a source_location.
-			 * @return void
+			 * @brief Move constructor.
+			 * @param copy A reference to the copied instance.
 			 */
-			void
-			push (Severity severity, const char * tag, std::string message, const std::source_location & location) noexcept
-			{
-				{
-					/* NOTE: Lock between the writing logs task in a file and the push/pop method. */
-					const std::lock_guard< std::mutex > lock{m_entriesAccess};
+			TracerLogger (TracerLogger && copy) noexcept = delete;
 
-					m_entries.emplace(severity, tag, std::move(message), location, std::this_thread::get_id());
-				}
+			/**
+			 * @brief Copy assignment.
+			 * @param copy A reference to the copied instance.
+			 * @return TracerLogger &
+			 */
+			TracerLogger & operator= (const TracerLogger & copy) noexcept = delete;
 
-				/* NOTE: wake up the thread. */
-				m_condition.notify_one();
-			}
+			/**
+			 * @brief Move assignment.
+			 * @param copy A reference to the copied instance.
+			 * @return TracerLogger &
+			 */
+			TracerLogger & operator= (TracerLogger && copy) noexcept = delete;
 
+			/**
+			 * @brief Destructs the trace logger and closes the log file properly.
+			 */
+			~TracerLogger ();
+
+			/**
+			 * @brief Returns whether the log file is opened.
+			 * @return bool
+			 */
+			[[nodiscard]]
 			bool
-			start () noexcept
+			isUsable () const noexcept
 			{
-				if ( !m_isUsable || m_isRunning )
-				{
-					if constexpr ( IsDebug )
-					{
-						std::cerr << "TraceLogger::start() : Unable to enable the tracer logger !" "\n";
-					}
-
-					return false;
-				}
-
-				m_isRunning = true;
-
-				m_thread = std::thread{&TracerLogger::task, this};
-
-				return true;
+				return m_file.is_open();
 			}
 
 			/**
-			 * @brief Stops the writing task for shutting down the tracer service.
-			 * @return void
+			 * @brief Returns the log file path.
+			 * @return const std::filesystem::path &
 			 */
-			void
-			stop () noexcept
+			[[nodiscard]]
+			const std::filesystem::path &
+			filepath () const noexcept
 			{
-				m_isRunning = false;
-
-				m_condition.notify_one();
+				return m_filepath;
 			}
 
 			/**
-			 * @brief Clears pending entries.
+			 * @brief Writes an entry.
+			 * @param entry A reference to the header record of the entry.
+			 * @param message The complete message.
+			 * @return void
+			 */
+			void write (const TracerEntry & entry, std::string_view message) noexcept;
+
+			/**
+			 * @brief Forces to write into the file.
 			 * @return void
 			 */
 			void
-			clear () noexcept
+			flush () noexcept
 			{
-				const std::lock_guard< std::mutex > lock{m_entriesAccess};
-
-				std::queue< TracerEntry > emptyQueue;
-
-				m_entries.swap(emptyQueue);
+				m_file.flush();
 			}
 
 		private:
 
 			/**
-			 * @brief Runs the task of writing entries to the log file.
+			 * @brief Writes the beginning of the file.
+			 * @return void
+			 */
+			void writeHeader () noexcept;
+
+			/**
+			 * @brief Writes the end of the file.
+			 * @return void
+			 */
+			void writeFooter () noexcept;
+
+			/**
+			 * @brief Writes an entry in the binary format.
+			 * @param entry A reference to the header record of the entry.
+			 * @param message The complete message.
+			 * @return void
+			 */
+			void writeBinary (const TracerEntry & entry, std::string_view message) noexcept;
+
+			/**
+			 * @brief Writes a trivial value in the binary format.
+			 * @tparam data_t The type of value.
+			 * @param value The value.
 			 * @return void
 			 */
-			void task () noexcept;
+			template< typename data_t >
+			void
+			writeValue (data_t value) noexcept
+			{
+				m_file.write(reinterpret_cast< const char * >(&value), sizeof(data_t));
+			}
+
+			/**
+			 * @brief Returns the id of a string for the binary format, writes the string definition the first time.
+			 * @param string A string view.
+			 * @return uint32_t
+			 */
+			[[nodiscard]]
+			uint32_t stringId (std::string_view string) noexcept;
 
 			std::filesystem::path m_filepath;
-			std::queue< TracerEntry > m_entries;
+			std::fstream m_file;
+			std::unordered_map< std::string, uint32_t > m_strings;
 			LogFormat m_logFormat;
-			std::thread m_thread;
-			std::mutex m_entriesAccess;
-			std::condition_variable m_condition;
-			std::atomic_bool m_isUsable{false};
-			std::atomic_bool m_isRunning{false};
 	};
 }
@@ -70,6 +70,9 @@ namespace EmEn
 			case LogFormat::HTML :
 				return HTMLString;
 
+			case LogFormat::Binary :
+				return BinaryString;
+
 			default:
 				return "Text";
 		}
@@ -93,6 +96,11 @@ namespace EmEn
 			return LogFormat::HTML;
 		}
 
+		if ( value == BinaryString )
+		{
+			return LogFormat::Binary;
+		}
+
 		return LogFormat::Text;
 	}
 }
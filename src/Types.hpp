@@ -91,12 +91,14 @@ namespace EmEn
 	{
 		Text,
 		JSON,
-		HTML
+		HTML,
+		Binary
 	};
 
 	static constexpr auto TextString{"Text"};
 	static constexpr auto JSONString{"JSON"};
 	static constexpr auto HTMLString{"HTML"};
+	static constexpr auto BinaryString{"Binary"};
 
 	/**
 	 * @brief Returns a C-String version of the enum value.
@@ -29,7 +29,7 @@
 /* Local inclusions. */
 #include "TransferManager.hpp"
 #include "MemoryRegion.hpp"
-#include "StagingBuffer.hpp"
+#include "StagingRegion.hpp"
 #include "Tracer.hpp"
 
 namespace EmEn::Vulkan
@@ -52,18 +52,15 @@ namespace EmEn::Vulkan
 			return false;
 		}
 
-		/* Get an available staging buffer to prepare the transfer */
-		const auto stagingBuffer = transferManager.getStagingBuffer(memoryRegion.bytes());
+		/* Reserve a staging range to prepare the transfer. */
+		const auto stagingRegion = transferManager.getStagingRegion(memoryRegion.bytes());
 
-		if ( stagingBuffer == nullptr )
+		if ( stagingRegion == nullptr )
 		{
 			return false;
 		}
 
-		/* NOTE: Already locked, but gives the ability to unlock the staging buffer automatically at function exit. */
-		const std::lock_guard< StagingBuffer > lock{*stagingBuffer};
-
-		if ( !stagingBuffer->writeData(memoryRegion) )
+		if ( !stagingRegion->writeData(memoryRegion) )
 		{
 			TraceError{ClassId} << "Unable to write " << memoryRegion.bytes() << " bytes of data in the staging buffer !";
 
@@ -71,6 +68,6 @@ namespace EmEn::Vulkan
 		}
 
 		/* Transfer the buffer data from host memory to device memory. */
-		return transferManager.transfer(*stagingBuffer, *this);
+		return transferManager.transfer(*stagingRegion, *this);
 	}
 }
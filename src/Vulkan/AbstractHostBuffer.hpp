@@ -33,7 +33,7 @@
 
 /* Local inclusions for inheritances. */
 #include "Buffer.hpp"
-#include "DeviceMemory.hpp"
+#include "MemoryAllocator.hpp"
 
 /* Forward declarations. */
 namespace EmEn::Vulkan
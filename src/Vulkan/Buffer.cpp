@@ -28,7 +28,7 @@
 
 /* Local inclusions. */
 #include "Device.hpp"
-#include "DeviceMemory.hpp"
+#include "MemoryAllocator.hpp"
 #include "Utility.hpp"
 #include "Tracer.hpp"
 
@@ -93,10 +93,9 @@ namespace EmEn::Vulkan
 			&memoryRequirement
 		);
 
-		m_deviceMemory = std::make_unique< DeviceMemory >(this->device(), memoryRequirement, m_memoryPropertyFlag);
-		m_deviceMemory->setIdentifier(ClassId, this->identifier(), "DeviceMemory");
+		m_deviceMemory = this->device()->memoryAllocator().allocate(memoryRequirement, m_memoryPropertyFlag, true);
 
-		if ( !m_deviceMemory->createOnHardware() )
+		if ( m_deviceMemory == nullptr )
 		{
 			TraceError{ClassId} << "Unable to create a device memory for the buffer " << m_handle << " !";
 
@@ -110,7 +109,7 @@ namespace EmEn::Vulkan
 			this->device()->handle(),
 			m_handle,
 			m_deviceMemory->handle(),
-			0// offset
+			m_deviceMemory->offset()
 		);
 
 		if ( result != VK_SUCCESS )
@@ -139,25 +138,18 @@ namespace EmEn::Vulkan
 			return false;
 		}
 
-		if ( m_deviceMemory != nullptr )
-		{
-			m_deviceMemory->destroyFromHardware();
-			m_deviceMemory.reset();
-		}
-
 		if ( m_handle != VK_NULL_HANDLE )
 		{
-			this->device()->waitIdle("Destroying a buffer");
-
-			vkDestroyBuffer(
-				this->device()->handle(),
-				m_handle,
-				VK_NULL_HANDLE
-			);
+			this->device()->deferDestruction([deviceHandle = this->device()->handle(), handle = m_handle] {
+				vkDestroyBuffer(deviceHandle, handle, nullptr);
+			});
 
 			m_handle = VK_NULL_HANDLE;
 		}
 
+		/* NOTE: The range goes back to the allocator after the handle destruction. */
+		m_deviceMemory.reset();
+
 		this->setDestroyed();
 
 		return true;
@@ -36,7 +36,7 @@
 /* Forward declarations. */
 namespace EmEn::Vulkan
 {
-	class DeviceMemory;
+	class MemoryAllocation;
 }
 
 namespace EmEn::Vulkan
@@ -198,11 +198,11 @@ namespace EmEn::Vulkan
 		protected:
 
 			/**
-			 * @brief Returns the device memory pointer.
-			 * @return const DeviceMemory *
+			 * @brief Returns the device memory range pointer.
+			 * @return const MemoryAllocation *
 			 */
 			[[nodiscard]]
-			const DeviceMemory *
+			const MemoryAllocation *
 			deviceMemory () const noexcept
 			{
 				return m_deviceMemory.get();
@@ -213,6 +213,6 @@ namespace EmEn::Vulkan
 			VkBuffer m_handle{VK_NULL_HANDLE};
 			VkBufferCreateInfo m_createInfo{};
 			VkMemoryPropertyFlags m_memoryPropertyFlag;
-			std::unique_ptr< DeviceMemory > m_deviceMemory;
+			std::unique_ptr< MemoryAllocation > m_deviceMemory;
 	};
 }
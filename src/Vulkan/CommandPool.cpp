@@ -106,9 +106,9 @@ namespace EmEn::Vulkan
 
 		if ( m_handle != VK_NULL_HANDLE )
 		{
-			this->device()->waitIdle("Destroying a command pool");
-
-			vkDestroyCommandPool(this->device()->handle(), m_handle, nullptr);
+			this->device()->deferDestruction([deviceHandle = this->device()->handle(), handle = m_handle] {
+				vkDestroyCommandPool(deviceHandle, handle, nullptr);
+			});
 
 			m_handle = VK_NULL_HANDLE;
 		}
@@ -105,9 +105,9 @@ namespace EmEn::Vulkan
 
 		if ( m_handle != VK_NULL_HANDLE )
 		{
-			this->device()->waitIdle("Destroying a compute pipeline");
-
-			vkDestroyPipeline(this->device()->handle(), m_handle, nullptr);
+			this->device()->deferDestruction([deviceHandle = this->device()->handle(), handle = m_handle] {
+				vkDestroyPipeline(deviceHandle, handle, nullptr);
+			});
 
 			m_handle = VK_NULL_HANDLE;
 		}
@@ -0,0 +1,140 @@
+/*
+ * src/Vulkan/DeletionQueue.cpp
+ * This file is part of Emeraude-Engine
+ *
+ * Copyright (C) 2010-2025 - Sébastien Léon Claude Christian Bémelmans "LondNoir" <londnoir@gmail.com>
+ *
+ * Emeraude-Engine is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * Emeraude-Engine is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with Emeraude-Engine; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * Complete project and additional information can be found at :
+ * https://github.com/londnoir/emeraude-engine
+ *
+ * --- THIS IS AUTOMATICALLY GENERATED, DO NOT CHANGE ---
+ */
+
+
+#include "DeletionQueue.hpp"
+
+/* STL inclusions. */
+#include <limits>
+#include <utility>
+#include <vector>
+
+namespace EmEn::Vulkan
+{
+	DeletionQueue::DeletionQueue (const TimelineInterface & timeline) noexcept
+		: m_timeline(timeline)
+	{
+
+	}
+
+	DeletionQueue::~DeletionQueue ()
+	{
+		this->flush();
+	}
+
+	void
+	DeletionQueue::enqueue (Deleter deleter) noexcept
+	{
+		if ( deleter == nullptr )
+		{
+			return;
+		}
+
+		const std::lock_guard< std::mutex > lock{m_entriesAccess};
+
+		m_entries.push_back({
+			m_timeline.pendingValue(),
+			m_secondaryTimeline != nullptr ? m_secondaryTimeline->pendingValue() : 0,
+			std::move(deleter)
+		});
+	}
+
+	size_t
+	DeletionQueue::collect () noexcept
+	{
+		uint64_t secondaryValue = std::numeric_limits< uint64_t >::max();
+
+		{
+			const std::lock_guard< std::mutex > lock{m_entriesAccess};
+
+			if ( m_secondaryTimeline != nullptr )
+			{
+				secondaryValue = m_secondaryTimeline->completedValue();
+			}
+		}
+
+		return this->destroyUpTo(m_timeline.completedValue(), secondaryValue);
+	}
+
+	void
+	DeletionQueue::setSecondaryTimeline (const TimelineInterface * timeline) noexcept
+	{
+		const std::lock_guard< std::mutex > lock{m_entriesAccess};
+
+		m_secondaryTimeline = timeline;
+	}
+
+	size_t
+	DeletionQueue::flush () noexcept
+	{
+		return this->destroyUpTo(std::numeric_limits< uint64_t >::max(), std::numeric_limits< uint64_t >::max());
+	}
+
+	size_t
+	DeletionQueue::pendingCount () const noexcept
+	{
+		const std::lock_guard< std::mutex > lock{m_entriesAccess};
+
+		return m_entries.size();
+	}
+
+	size_t
+	DeletionQueue::destroyUpTo (uint64_t value, uint64_t secondaryValue) noexcept
+	{
+		size_t destroyed = 0;
+
+		/* NOTE: A deleter may release another object, so the deleters run outside the lock
+		 * and the queue is checked again until nothing is ready. */
+		while ( true )
+		{
+			std::vector< Deleter > readyDeleters;
+
+			{
+				const std::lock_guard< std::mutex > lock{m_entriesAccess};
+
+				/* NOTE: Both values grow with the release order, the first object not ready stops the destructions. */
+				while ( !m_entries.empty() && m_entries.front().value <= value && m_entries.front().secondaryValue <= secondaryValue )
+				{
+					readyDeleters.emplace_back(std::move(m_entries.front().deleter));
+
+					m_entries.pop_front();
+				}
+			}
+
+			if ( readyDeleters.empty() )
+			{
+				return destroyed;
+			}
+
+			for ( auto & deleter : readyDeleters )
+			{
+				deleter();
+			}
+
+			destroyed += readyDeleters.size();
+		}
+	}
+}
@@ -0,0 +1,250 @@
+/*
+ * src/Vulkan/DeletionQueue.hpp
+ * This file is part of Emeraude-Engine
+ *
+ * Copyright (C) 2010-2025 - Sébastien Léon Claude Christian Bémelmans "LondNoir" <londnoir@gmail.com>
+ *
+ * Emeraude-Engine is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * Emeraude-Engine is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with Emeraude-Engine; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * Complete project and additional information can be found at :
+ * https://github.com/londnoir/emeraude-engine
+ *
+ * --- THIS IS AUTOMATICALLY GENERATED, DO NOT CHANGE ---
+ */
+
+
+#pragma once
+
+/* STL inclusions. */
+#include <cstddef>
+#include <cstdint>
+#include <atomic>
+#include <deque>
+#include <functional>
+#include <mutex>
+
+namespace EmEn::Vulkan
+{
+	/**
+	 * @brief Interface of a monotonic GPU progress counter.
+	 * @note The pending value tags the work being recorded. Once this work has been executed by the device, the
+	 * completed value reaches it.
+	 */
+	class TimelineInterface
+	{
+		public:
+
+			/**
+			 * @brief Destructs the timeline.
+			 */
+			virtual ~TimelineInterface () = default;
+
+			/**
+			 * @brief Returns the value of the work being recorded.
+			 * @return uint64_t
+			 */
+			[[nodiscard]]
+			virtual uint64_t pendingValue () const noexcept = 0;
+
+			/**
+			 * @brief Returns the value of the last work executed by the device.
+			 * @return uint64_t
+			 */
+			[[nodiscard]]
+			virtual uint64_t completedValue () const noexcept = 0;
+
+		protected:
+
+			/**
+			 * @brief Constructs a timeline.
+			 */
+			TimelineInterface () noexcept = default;
+	};
+
+	/**
+	 * @brief Timeline advanced by the frames submitted and then waited through their fence.
+	 * @extends EmEn::Vulkan::TimelineInterface This is a timeline.
+	 */
+	class FrameTimeline final : public TimelineInterface
+	{
+		public:
+
+			/**
+			 * @brief Constructs a frame timeline.
+			 */
+			FrameTimeline () noexcept = default;
+
+			/** @copydoc EmEn::Vulkan::TimelineInterface::pendingValue() const */
+			[[nodiscard]]
+			uint64_t
+			pendingValue () const noexcept override
+			{
+				return m_pendingValue.load(std::memory_order_acquire);
+			}
+
+			/** @copydoc EmEn::Vulkan::TimelineInterface::completedValue() const */
+			[[nodiscard]]
+			uint64_t
+			completedValue () const noexcept override
+			{
+				return m_completedValue.load(std::memory_order_acquire);
+			}
+
+			/**
+			 * @brief Declares the frame being recorded as submitted.
+			 * @return uint64_t The value to complete once the frame fence is signaled.
+			 */
+			uint64_t
+			submit () noexcept
+			{
+				return m_pendingValue.fetch_add(1, std::memory_order_acq_rel);
+			}
+
+			/**
+			 * @brief Declares a submitted frame as executed.
+			 * @note Frames are executed in submission order, so every lower value is completed too.
+			 * @param value The value returned at the frame submission.
+			 * @return void
+			 */
+			void
+			complete (uint64_t value) noexcept
+			{
+				auto completedValue = m_completedValue.load(std::memory_order_relaxed);
+
+				while ( value > completedValue && !m_completedValue.compare_exchange_weak(completedValue, value, std::memory_order_acq_rel) )
+				{
+					/* NOTE: Another thread moved the value, retry with it. */
+				}
+			}
+
+		private:
+
+			std::atomic< uint64_t > m_pendingValue{1};
+			std::atomic< uint64_t > m_completedValue{0};
+	};
+
+	/**
+	 * @brief Holds the destruction of device objects until the device does not use them anymore.
+	 * @note A released object is tagged with the timeline pending value, since the work being recorded may still
+	 * reference it, and is destroyed once the timeline completed this value. Destructions run in release order.
+	 */
+	class DeletionQueue final
+	{
+		public:
+
+			/** @brief Class identifier. */
+			static constexpr auto ClassId{"VulkanDeletionQueue"};
+
+			/** @brief The destruction function of a released object. */
+			using Deleter = std::function< void () >;
+
+			/**
+			 * @brief Constructs a deletion queue.
+			 * @param timeline A reference to the timeline of the device work.
+			 */
+			explicit DeletionQueue (const TimelineInterface & timeline) noexcept;
+
+			/**
+			 * @brief Copy constructor.
+			 * @param copy A reference to the copied instance.
+			 */
+			DeletionQueue (const DeletionQueue & copy) noexcept = delete;
+
+			/**
+			 * @brief Move constructor.
+			 * @param copy A reference to the copied instance.
+			 */
+			DeletionQueue (DeletionQueue && copy) noexcept = delete;
+
+			/**
+			 * @brief Copy assignment.
+			 * @param copy A reference to the copied instance.
+			 * @return DeletionQueue &
+			 */
+			DeletionQueue & operator= (const DeletionQueue & copy) noexcept = delete;
+
+			/**
+			 * @brief Move assignment.
+			 * @param copy A reference to the copied instance.
+			 * @return DeletionQueue &
+			 */
+			DeletionQueue & operator= (DeletionQueue && copy) noexcept = delete;
+
+			/**
+			 * @brief Destructs the deletion queue, destroying every pending object.
+			 */
+			~DeletionQueue ();
+
+			/**
+			 * @brief Releases an object to be destroyed once the work being recorded is executed.
+			 * @note This method is thread-safe.
+			 * @param deleter The destruction function.
+			 * @return void
+			 */
+			void enqueue (Deleter deleter) noexcept;
+
+			/**
+			 * @brief Destroys the objects whose tagged value is completed by the timeline.
+			 * @note This method is thread-safe.
+			 * @return size_t The number of destroyed objects.
+			 */
+			size_t collect () noexcept;
+
+			/**
+			 * @brief Sets a second timeline the destructions must wait for, like the transfers writing into device objects.
+			 * @note The objects released before this call do not wait for it.
+			 * @param timeline A pointer to the timeline. Null to stop waiting for it.
+			 * @return void
+			 */
+			void setSecondaryTimeline (const TimelineInterface * timeline) noexcept;
+
+			/**
+			 * @brief Destroys every pending object, whatever the timeline state.
+			 * @warning The device must be idle.
+			 * @return size_t The number of destroyed objects.
+			 */
+			size_t flush () noexcept;
+
+			/**
+			 * @brief Returns the number of objects waiting for their destruction.
+			 * @return size_t
+			 */
+			[[nodiscard]]
+			size_t pendingCount () const noexcept;
+
+		private:
+
+			/** @brief A released object. */
+			struct Entry
+			{
+				uint64_t value;
+				uint64_t secondaryValue;
+				Deleter deleter;
+			};
+
+			/**
+			 * @brief Destroys the objects at the front of the queue up to a value of each timeline.
+			 * @param value The highest value to destroy.
+			 * @param secondaryValue The highest value of the second timeline to destroy.
+			 * @return size_t
+			 */
+			size_t destroyUpTo (uint64_t value, uint64_t secondaryValue) noexcept;
+
+			const TimelineInterface & m_timeline;
+			const TimelineInterface * m_secondaryTimeline{nullptr};
+			std::deque< Entry > m_entries;
+			mutable std::mutex m_entriesAccess;
+	};
+}
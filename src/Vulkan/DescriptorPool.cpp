@@ -103,13 +103,9 @@ namespace EmEn::Vulkan
 
 		if ( m_handle != VK_NULL_HANDLE )
 		{
-			this->device()->waitIdle("Destroying descriptor pool");
-
-			vkDestroyDescriptorPool(
-				this->device()->handle(),
-				m_handle,
-				VK_NULL_HANDLE
-			);
+			this->device()->deferDestruction([deviceHandle = this->device()->handle(), handle = m_handle] {
+				vkDestroyDescriptorPool(deviceHandle, handle, nullptr);
+			});
 
 			m_handle = VK_NULL_HANDLE;
 		}
@@ -153,10 +149,34 @@ namespace EmEn::Vulkan
 
 	bool
 	DescriptorPool::freeDescriptorSet (VkDescriptorSet descriptorSetHandle) noexcept
+	{
+		if ( !this->hasDevice() )
+		{
+			Tracer::error(ClassId, "No device to free a descriptor set !");
+
+			return false;
+		}
+
+		/* NOTE: When the pool is gone first, its own destruction, queued later, frees every set. */
+		this->device()->deferDestruction([descriptorPool = this->weak_from_this(), descriptorSetHandle] {
+			if ( const auto pool = descriptorPool.lock(); pool != nullptr )
+			{
+				pool->releaseDescriptorSet(descriptorSetHandle);
+			}
+		});
+
+		return true;
+	}
+
+	bool
+	DescriptorPool::releaseDescriptorSet (VkDescriptorSet descriptorSetHandle) noexcept
 	{
 		const std::lock_guard< std::mutex > lock{m_allocationMutex};
 
-		this->device()->waitIdle("Freeing descriptor set");
+		if ( m_handle == VK_NULL_HANDLE )
+		{
+			return false;
+		}
 
 		const auto result = vkFreeDescriptorSets(
 			this->device()->handle(),
@@ -166,7 +186,7 @@ namespace EmEn::Vulkan
 
 		if ( result != VK_SUCCESS )
 		{
-			TraceError{ClassId} << "Unable to allocate a descriptor set : " << vkResultToCString(result) << " !";
+			TraceError{ClassId} << "Unable to free a descriptor set : " << vkResultToCString(result) << " !";
 
 			return false;
 		}
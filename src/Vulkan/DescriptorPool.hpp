@@ -45,9 +45,10 @@ namespace EmEn::Vulkan
 {
 	/**
 	 * @brief The DescriptorPool class
+	 * @extends std::enable_shared_from_this A descriptor set freed later needs the pool.
 	 * @extends EmEn::Vulkan::AbstractDeviceDependentObject This vulkan object needs a device.
 	 */
-	class DescriptorPool final : public AbstractDeviceDependentObject
+	class DescriptorPool final : public std::enable_shared_from_this< DescriptorPool >, public AbstractDeviceDependentObject
 	{
 		public:
 
@@ -160,7 +161,7 @@ namespace EmEn::Vulkan
 			VkDescriptorSet allocateDescriptorSet (const DescriptorSetLayout & descriptorSetLayout) noexcept;
 
 			/**
-			 * @brief Frees one descriptor set.
+			 * @brief Frees one descriptor set once the frames in flight using it are executed.
 			 * @param descriptorSetHandle A Vulkan handle to the descriptor set.
 			 * @return bool
 			 */
@@ -168,6 +169,13 @@ namespace EmEn::Vulkan
 
 		private:
 
+			/**
+			 * @brief Gives back one descriptor set to the pool immediately.
+			 * @param descriptorSetHandle A Vulkan handle to the descriptor set.
+			 * @return bool
+			 */
+			bool releaseDescriptorSet (VkDescriptorSet descriptorSetHandle) noexcept;
+
 			VkDescriptorPool m_handle{VK_NULL_HANDLE};
 			VkDescriptorPoolCreateInfo m_createInfo{};
 			std::vector< VkDescriptorPoolSize > m_descriptorPoolSizes;
@@ -106,9 +106,9 @@ namespace EmEn::Vulkan
 
 		if ( m_handle != VK_NULL_HANDLE )
 		{
-			this->device()->waitIdle("Destroying a descriptor set layout");
-
-			vkDestroyDescriptorSetLayout(this->device()->handle(), m_handle, nullptr);
+			this->device()->deferDestruction([deviceHandle = this->device()->handle(), handle = m_handle] {
+				vkDestroyDescriptorSetLayout(deviceHandle, handle, nullptr);
+			});
 
 			m_handle = VK_NULL_HANDLE;
 		}
@@ -129,6 +129,11 @@ namespace EmEn::Vulkan
 
 		this->waitIdle("Destroying the device !");
 
+		/* NOTE: The device is idle, every released object can be destroyed now. */
+		m_deletionQueue.flush();
+
+		m_memoryAllocator.clear();
+
 		m_queueFamilyPerJob.clear();
 		m_queueFamilies.clear();
 
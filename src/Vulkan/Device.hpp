@@ -33,12 +33,15 @@
 #include <mutex>
 #include <vector>
 #include <memory>
+#include <utility>
 
 /* Local inclusions for inheritances. */
 #include "AbstractObject.hpp"
 #include "Libs/NameableTrait.hpp"
 
 /* Local inclusions for usage. */
+#include "DeletionQueue.hpp"
+#include "MemoryAllocator.hpp"
 #include "Settings.hpp"
 #include "Types.hpp"
 
@@ -225,6 +228,84 @@ namespace EmEn::Vulkan
 			 */
 			void waitIdle (const char * location) const noexcept;
 
+			/**
+			 * @brief Returns the timeline of the frames executed by the device.
+			 * @return FrameTimeline &
+			 */
+			[[nodiscard]]
+			FrameTimeline &
+			frameTimeline () noexcept
+			{
+				return m_frameTimeline;
+			}
+
+			/**
+			 * @brief Releases a device object to destroy it once the frames in flight are executed.
+			 * @note Use this instead of waiting the device to be idle before destroying a handle.
+			 * @param deleter The function destroying the handle.
+			 * @return void
+			 */
+			void
+			deferDestruction (DeletionQueue::Deleter deleter) noexcept
+			{
+				m_deletionQueue.enqueue(std::move(deleter));
+			}
+
+			/**
+			 * @brief Sets the timeline of the transfers, the released objects also wait for the transfers recorded before.
+			 * @param timeline A pointer to the timeline. Null to stop waiting for the transfers.
+			 * @return void
+			 */
+			void
+			setTransferTimeline (const TimelineInterface * timeline) noexcept
+			{
+				m_deletionQueue.setSecondaryTimeline(timeline);
+			}
+
+			/**
+			 * @brief Destroys the released device objects no longer used by a frame in flight.
+			 * @note This should be called once per frame.
+			 * @return size_t The number of destroyed objects.
+			 */
+			size_t
+			destroyReleasedObjects () noexcept
+			{
+				return m_deletionQueue.collect();
+			}
+
+			/**
+			 * @brief Returns the number of released device objects waiting for their destruction.
+			 * @return size_t
+			 */
+			[[nodiscard]]
+			size_t
+			releasedObjectCount () const noexcept
+			{
+				return m_deletionQueue.pendingCount();
+			}
+
+			/**
+			 * @brief Returns the device memory allocator.
+			 * @return MemoryAllocator &
+			 */
+			[[nodiscard]]
+			MemoryAllocator &
+			memoryAllocator () noexcept
+			{
+				return m_memoryAllocator;
+			}
+
+			/**
+			 * @brief Returns the device memory allocator.
+			 * @return const MemoryAllocator &
+			 */
+			[[nodiscard]]
+			const MemoryAllocator &
+			memoryAllocator () const noexcept
+			{
+				return m_memoryAllocator;
+			}
+
 			/**
 			 * @brief Finds the suitable memory type.
 			 * @param memoryTypeFilter The memory type.
@@ -311,6 +392,9 @@ namespace EmEn::Vulkan
 			std::vector< std::shared_ptr< QueueFamilyInterface > > m_queueFamilies;
 			std::map< QueueJob, std::shared_ptr< QueueFamilyInterface > > m_queueFamilyPerJob;
 			mutable std::mutex m_mutex;
+			FrameTimeline m_frameTimeline;
+			MemoryAllocator m_memoryAllocator{*this};
+			DeletionQueue m_deletionQueue{m_frameTimeline};
 			std::array< bool, 8 > m_flags{
 				false/*ShowInformation*/,
 				false/*HasBasicSupport*/,
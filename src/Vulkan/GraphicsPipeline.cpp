@@ -28,6 +28,7 @@
 
 /* STL inclusions. */
 #include <algorithm>
+#include <chrono>
 
 /* Local inclusions. */
 #include "Graphics/VertexBufferFormat.hpp"
@@ -36,6 +37,7 @@
 #include "Graphics/RenderableInstance/Abstract.hpp"
 #include "Graphics/Material/Interface.hpp"
 #include "Device.hpp"
+#include "PipelineCache.hpp"
 #include "PipelineLayout.hpp"
 #include "ShaderModule.hpp"
 #include "RenderPass.hpp"
@@ -90,6 +92,8 @@ namespace EmEn::Vulkan
 	bool
 	GraphicsPipeline::configureShaderStages (const std::vector< std::shared_ptr< Vulkan::ShaderModule > > & shaderModules) noexcept
 	{
+		m_shaderModules.insert(m_shaderModules.end(), shaderModules.cbegin(), shaderModules.cend());
+
 		for ( const auto & shaderModule : shaderModules )
 		{
 			m_shaderStages.emplace_back(shaderModule->pipelineShaderStageCreateInfo());
@@ -703,7 +707,7 @@ namespace EmEn::Vulkan
 	}
 
 	bool
-	GraphicsPipeline::finalize (const std::shared_ptr< const RenderPass > & renderPass, const std::shared_ptr< PipelineLayout > & pipelineLayout, bool useTesselation) noexcept
+	GraphicsPipeline::finalize (const std::shared_ptr< const RenderPass > & renderPass, const std::shared_ptr< PipelineLayout > & pipelineLayout, bool useTesselation, const std::shared_ptr< PipelineCache > & pipelineCache, bool deferCreation) noexcept
 	{
 		if ( renderPass == nullptr )
 		{
@@ -849,6 +853,13 @@ namespace EmEn::Vulkan
 		m_createInfo.layout = pipelineLayout->handle();
 		m_createInfo.renderPass = renderPass->handle();
 
+		m_pipelineCache = pipelineCache;
+
+		if ( deferCreation )
+		{
+			return true;
+		}
+
 		return this->createOnHardware();
 	}
 
@@ -922,10 +933,46 @@ namespace EmEn::Vulkan
 	bool
 	GraphicsPipeline::createOnHardware () noexcept
 	{
+		return this->createOnHardware(m_pipelineCache.get());
+	}
+
+	bool
+	GraphicsPipeline::createOnHardware (const PipelineCache * pipelineCache) noexcept
+	{
+		/* NOTE: The shader modules of a deferred pipeline are compiled after the pipeline configuration. */
+		for ( size_t stageIndex = 0; stageIndex < m_shaderModules.size(); stageIndex++ )
+		{
+			const auto & shaderModule = m_shaderModules[stageIndex];
+
+			if ( !shaderModule->isCreated() )
+			{
+				TraceError{ClassId} << "The shader module '" << shaderModule->identifier() << "' is not created !";
+
+				return false;
+			}
+
+			m_shaderStages[stageIndex] = shaderModule->pipelineShaderStageCreateInfo();
+		}
+
+		VkPipelineCreationFeedback pipelineFeedback{};
+
+		VkPipelineCreationFeedbackCreateInfo feedbackCreateInfo{};
+		feedbackCreateInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_CREATION_FEEDBACK_CREATE_INFO;
+		feedbackCreateInfo.pNext = m_createInfo.pNext;
+		feedbackCreateInfo.pPipelineCreationFeedback = &pipelineFeedback;
+		feedbackCreateInfo.pipelineStageCreationFeedbackCount = 0;
+		feedbackCreateInfo.pPipelineStageCreationFeedbacks = nullptr;
+
+		/* NOTE: The feedback is chained on a copy, the configuration stays untouched. */
+		auto createInfo = m_createInfo;
+		createInfo.pNext = &feedbackCreateInfo;
+
+		const auto start = std::chrono::steady_clock::now();
+
 		const auto result = vkCreateGraphicsPipelines(
 			this->device()->handle(),
-			VK_NULL_HANDLE,
-			1, &m_createInfo,
+			pipelineCache != nullptr ? pipelineCache->handle() : VK_NULL_HANDLE,
+			1, &createInfo,
 			nullptr,
 			&m_handle
 		);
@@ -937,6 +984,18 @@ namespace EmEn::Vulkan
 			return false;
 		}
 
+		/* NOTE: The driver may not fill the feedback, the host time is used instead. */
+		if ( (pipelineFeedback.flags & VK_PIPELINE_CREATION_FEEDBACK_VALID_BIT) != 0 )
+		{
+			m_cacheHit = (pipelineFeedback.flags & VK_PIPELINE_CREATION_FEEDBACK_APPLICATION_PIPELINE_CACHE_HIT_BIT) != 0;
+			m_creationDuration = pipelineFeedback.duration;
+		}
+		else
+		{
+			m_cacheHit = false;
+			m_creationDuration = static_cast< uint64_t >(std::chrono::duration_cast< std::chrono::nanoseconds >(std::chrono::steady_clock::now() - start).count());
+		}
+
 		this->setCreated();
 
 		return true;
@@ -954,9 +1013,9 @@ namespace EmEn::Vulkan
 
 		if ( m_handle != nullptr )
 		{
-			this->device()->waitIdle("Destroying a graphics pipeline");
-
-			vkDestroyPipeline(this->device()->handle(), m_handle, nullptr);
+			this->device()->deferDestruction([deviceHandle = this->device()->handle(), handle = m_handle] {
+				vkDestroyPipeline(deviceHandle, handle, nullptr);
+			});
 
 			m_handle = VK_NULL_HANDLE;
 		}
@@ -64,6 +64,11 @@ namespace EmEn::Graphics
 	class VertexBufferFormat;
 }
 
+namespace EmEn::Vulkan
+{
+	class PipelineCache;
+}
+
 namespace EmEn::Vulkan
 {
 	/**
@@ -122,14 +127,26 @@ namespace EmEn::Vulkan
 			 */
 			~GraphicsPipeline () override;
 
-			/** @copydoc EmEn::Vulkan::AbstractDeviceDependentObject::createOnHardware() */
+			/**
+			 * @copydoc EmEn::Vulkan::AbstractDeviceDependentObject::createOnHardware()
+			 * @note The pipeline cache given to finalize() is used.
+			 */
 			bool createOnHardware () noexcept override;
 
+			/**
+			 * @brief Creates the graphics pipeline with a specific pipeline cache.
+			 * @note This can be called from a worker thread once the pipeline is finalized with a deferred creation.
+			 * @param pipelineCache A pointer to a pipeline cache. Can be nullptr.
+			 * @return bool
+			 */
+			bool createOnHardware (const PipelineCache * pipelineCache) noexcept;
+
 			/** @copydoc EmEn::Vulkan::AbstractDeviceDependentObject::destroyFromHardware() */
 			bool destroyFromHardware () noexcept override;
 
 			/**
 			 * @brief Configures the shader stages of the pipeline.
+			 * @note The shader modules can be created on the hardware later, until the pipeline creation.
 			 * @param shaderModules A reference to a shader module smart pointer list.
 			 * @return bool
 			 */
@@ -260,10 +277,12 @@ namespace EmEn::Vulkan
 			 * @param renderPass A reference to a render pass smart pointer.
 			 * @param pipelineLayout A reference to a pipeline layout smart pointer.
 			 * @param useTesselation Declares tesselation was enabled.
+			 * @param pipelineCache A reference to a pipeline cache smart pointer. Can be nullptr.
+			 * @param deferCreation Only checks the configuration, the pipeline will be created later with createOnHardware(). Default false.
 			 * @return bool
 			 */
 			[[nodiscard]]
-			bool finalize (const std::shared_ptr< const RenderPass > & renderPass, const std::shared_ptr< PipelineLayout > & pipelineLayout, bool useTesselation) noexcept;
+			bool finalize (const std::shared_ptr< const RenderPass > & renderPass, const std::shared_ptr< PipelineLayout > & pipelineLayout, bool useTesselation, const std::shared_ptr< PipelineCache > & pipelineCache, bool deferCreation = false) noexcept;
 
 			/**
 			 * @brief Recreates the graphics pipeline.
@@ -297,6 +316,28 @@ namespace EmEn::Vulkan
 				return m_handle;
 			}
 
+			/**
+			 * @brief Returns whether the last creation was found in the pipeline cache.
+			 * @return bool
+			 */
+			[[nodiscard]]
+			bool
+			isCacheHit () const noexcept
+			{
+				return m_cacheHit;
+			}
+
+			/**
+			 * @brief Returns the duration of the last creation in nanoseconds.
+			 * @return uint64_t
+			 */
+			[[nodiscard]]
+			uint64_t
+			creationDuration () const noexcept
+			{
+				return m_creationDuration;
+			}
+
 			/**
 			 * @brief Returns the list of color blend attachments.
 			 * @return const std::vector< VkPipelineColorBlendAttachmentState > &
@@ -336,6 +377,7 @@ namespace EmEn::Vulkan
 
 			VkPipeline m_handle{VK_NULL_HANDLE};
 			VkGraphicsPipelineCreateInfo m_createInfo{};
+			std::vector< std::shared_ptr< ShaderModule > > m_shaderModules;
 			std::vector< VkPipelineShaderStageCreateInfo > m_shaderStages;
 			VkPipelineVertexInputStateCreateInfo m_vertexInputState{};
 			VkPipelineInputAssemblyStateCreateInfo m_inputAssemblyState{};
@@ -350,5 +392,8 @@ namespace EmEn::Vulkan
 			VkPipelineColorBlendStateCreateInfo m_colorBlendState{};
 			std::vector< VkDynamicState > m_dynamicStates;
 			VkPipelineDynamicStateCreateInfo m_dynamicState{};
+			std::shared_ptr< PipelineCache > m_pipelineCache;
+			uint64_t m_creationDuration{0};
+			bool m_cacheHit{false};
 	};
 }
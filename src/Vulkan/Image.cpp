@@ -31,16 +31,18 @@
 #include <mutex>
 #include <numeric>
 #include <ranges>
+#include <vector>
 
 /* Local inclusions. */
 #include "Graphics/CubemapResource.hpp"
 #include "Graphics/ImageResource.hpp"
 #include "Graphics/MovieResource.hpp"
+#include "Libs/PixelFactory/CompressedTexture.hpp"
 #include "Device.hpp"
-#include "DeviceMemory.hpp"
+#include "MemoryAllocator.hpp"
 #include "MemoryRegion.hpp"
 #include "TransferManager.hpp"
-#include "StagingBuffer.hpp"
+#include "StagingRegion.hpp"
 #include "Utility.hpp"
 #include "Tracer.hpp"
 
@@ -147,10 +149,9 @@ namespace EmEn::Vulkan
 			&memoryRequirement
 		);
 
-		m_deviceMemory = std::make_unique< DeviceMemory >(this->device(), memoryRequirement, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
-		m_deviceMemory->setIdentifier(ClassId, this->identifier(), "DeviceMemory");
+		m_deviceMemory = this->device()->memoryAllocator().allocate(memoryRequirement, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, m_createInfo.tiling == VK_IMAGE_TILING_LINEAR);
 
-		if ( !m_deviceMemory->createOnHardware() )
+		if ( m_deviceMemory == nullptr )
 		{
 			TraceError{ClassId} << "Unable to create a device memory for the image " << m_handle << " !";
 
@@ -164,7 +165,7 @@ namespace EmEn::Vulkan
 			this->device()->handle(),
 			m_handle,
 			m_deviceMemory->handle(),
-			0// offset
+			m_deviceMemory->offset()
 		);
 
 		if ( result != VK_SUCCESS )
@@ -191,18 +192,15 @@ namespace EmEn::Vulkan
 			return false;
 		}
 
-		/* Get an available staging buffer to prepare the transfer */
-		const auto stagingBuffer = transferManager.getStagingBuffer(pixmap.bytes());
+		/* Reserve a staging range to prepare the transfer. */
+		const auto stagingRegion = transferManager.getStagingRegion(pixmap.bytes());
 
-		if ( stagingBuffer == nullptr )
+		if ( stagingRegion == nullptr )
 		{
 			return false;
 		}
 
-		/* NOTE: Already locked, but gives the ability to unlock the staging buffer automatically at function exit. */
-		const std::lock_guard< StagingBuffer > lock{*stagingBuffer};
-
-		if ( !stagingBuffer->writeData({pixmap.data().data(), pixmap.bytes()}) )
+		if ( !stagingRegion->writeData({pixmap.data().data(), pixmap.bytes()}) )
 		{
 			TraceError{ClassId} << "Unable to write " << pixmap.bytes() << " bytes of data in the staging buffer !";
 
@@ -210,7 +208,7 @@ namespace EmEn::Vulkan
 		}
 
 		/* Transfer the image data from host memory to device memory. */
-		return transferManager.transfer(*stagingBuffer, *this);
+		return transferManager.transfer(*stagingRegion, *this);
 	}
 
 	bool
@@ -219,6 +217,64 @@ namespace EmEn::Vulkan
 		return this->create(transferManager, imageResource->data());
 	}
 
+	bool
+	Image::create (TransferManager & transferManager, const PixelFactory::CompressedTexture & compressedTexture) noexcept
+	{
+		if ( !compressedTexture.isValid() || compressedTexture.levelCount() != m_createInfo.mipLevels )
+		{
+			TraceError{ClassId} << "The compressed texture has " << compressedTexture.levelCount() << " levels, the image expects " << m_createInfo.mipLevels << " !";
+
+			return false;
+		}
+
+		if ( !this->createOnHardware() )
+		{
+			return false;
+		}
+
+		const auto data = compressedTexture.data();
+
+		/* Reserve a staging range to prepare the transfer. */
+		const auto stagingRegion = transferManager.getStagingRegion(data.size());
+
+		if ( stagingRegion == nullptr )
+		{
+			return false;
+		}
+
+		if ( !stagingRegion->writeData({data.data(), data.size()}) )
+		{
+			TraceError{ClassId} << "Unable to write " << data.size() << " bytes of data in the staging buffer !";
+
+			return false;
+		}
+
+		std::vector< VkBufferImageCopy > regions;
+		regions.reserve(compressedTexture.levelCount());
+
+		for ( uint32_t levelIndex = 0; levelIndex < compressedTexture.levelCount(); levelIndex++ )
+		{
+			const auto & level = compressedTexture.levels()[levelIndex];
+
+			VkBufferImageCopy bufferImageCopy{};
+			bufferImageCopy.bufferOffset = level.offset;
+			bufferImageCopy.bufferRowLength = 0;
+			bufferImageCopy.bufferImageHeight = 0;
+			bufferImageCopy.imageSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+			bufferImageCopy.imageSubresource.mipLevel = levelIndex;
+			bufferImageCopy.imageSubresource.baseArrayLayer = 0;
+			bufferImageCopy.imageSubresource.layerCount = 1;
+			bufferImageCopy.imageExtent.width = level.width;
+			bufferImageCopy.imageExtent.height = level.height;
+			bufferImageCopy.imageExtent.depth = 1;
+
+			regions.emplace_back(bufferImageCopy);
+		}
+
+		/* Transfer every level from host memory to device memory. */
+		return transferManager.transfer(*stagingRegion, *this, regions);
+	}
+
 	bool
 	Image::create (TransferManager & transferManager, const std::shared_ptr< Graphics::CubemapResource > & cubemapResource) noexcept
 	{
@@ -234,23 +290,20 @@ namespace EmEn::Vulkan
 			return sum + pixmap.bytes();
 		});
 
-		/* Get an available staging buffer to prepare the transfer */
-		const auto stagingBuffer = transferManager.getStagingBuffer(totalBytes);
+		/* Reserve a staging range to prepare the transfer. */
+		const auto stagingRegion = transferManager.getStagingRegion(totalBytes);
 
-		if ( stagingBuffer == nullptr )
+		if ( stagingRegion == nullptr )
 		{
 			return false;
 		}
 
-		/* NOTE: Already locked, but gives the ability to unlock the staging buffer automatically at function exit. */
-		const std::lock_guard< StagingBuffer > lock{*stagingBuffer};
-
 		/* NOTE: We will write all 6 pixmaps next to each others in the staging buffer. */
 		size_t offset = 0;
 
 		for ( const auto & pixmap : pixmaps )
 		{
-			if ( !stagingBuffer->writeData({pixmap.data().data(), pixmap.bytes(), offset}) )
+			if ( !stagingRegion->writeData({pixmap.data().data(), pixmap.bytes(), offset}) )
 			{
 				TraceError{ClassId} << "Unable to write " << pixmap.bytes() << " bytes of data in the staging buffer !";
 
@@ -261,7 +314,7 @@ namespace EmEn::Vulkan
 		}
 
 		/* Transfer the image data from host memory to device memory. */
-		return transferManager.transfer(*stagingBuffer, *this);
+		return transferManager.transfer(*stagingRegion, *this);
 	}
 
 	bool
@@ -278,22 +331,19 @@ namespace EmEn::Vulkan
 			return sum + frame.first.bytes();
 		});
 
-		/* Get an available staging buffer to prepare the transfer */
-		const auto stagingBuffer = transferManager.getStagingBuffer(totalBytes);
+		/* Reserve a staging range to prepare the transfer. */
+		const auto stagingRegion = transferManager.getStagingRegion(totalBytes);
 
-		if ( stagingBuffer == nullptr )
+		if ( stagingRegion == nullptr )
 		{
 			return false;
 		}
 
-		/* NOTE: Already locked, but gives the ability to unlock the staging buffer automatically at function exit. */
-		const std::lock_guard< StagingBuffer > lock{*stagingBuffer};
-
 		size_t offset = 0;
 
 		for ( const auto & pixmap : std::ranges::views::keys(frames) )
 		{
-			if ( !stagingBuffer->writeData({pixmap.data().data(), pixmap.bytes(), offset}) )
+			if ( !stagingRegion->writeData({pixmap.data().data(), pixmap.bytes(), offset}) )
 			{
 				TraceError{ClassId} << "Unable to write " << pixmap.bytes() << " bytes of data in the staging buffer !";
 
@@ -304,7 +354,7 @@ namespace EmEn::Vulkan
 		}
 
 		/* Transfer the image data from host memory to device memory. */
-		return transferManager.transfer(*stagingBuffer, *this);
+		return transferManager.transfer(*stagingRegion, *this);
 	}
 
 	bool
@@ -317,18 +367,15 @@ namespace EmEn::Vulkan
 			return false;
 		}
 
-		/* Get an available staging buffer to prepare the transfer */
-		const auto stagingBuffer = transferManager.getStagingBuffer(memoryRegion.bytes());
+		/* Reserve a staging range to prepare the transfer. */
+		const auto stagingRegion = transferManager.getStagingRegion(memoryRegion.bytes());
 
-		if ( stagingBuffer == nullptr )
+		if ( stagingRegion == nullptr )
 		{
 			return false;
 		}
 
-		/* NOTE: Already locked, but gives the ability to unlock the staging buffer automatically at function exit. */
-		const std::lock_guard< StagingBuffer > lock{*stagingBuffer};
-
-		if ( !stagingBuffer->writeData(memoryRegion) )
+		if ( !stagingRegion->writeData(memoryRegion) )
 		{
 			TraceError{ClassId} << "Unable to write " << memoryRegion.bytes() << " bytes of data in the staging buffer !";
 
@@ -336,7 +383,7 @@ namespace EmEn::Vulkan
 		}
 
 		/* Transfer the image data from host memory to device memory. */
-		return transferManager.transfer(*stagingBuffer, *this);
+		return transferManager.transfer(*stagingRegion, *this);
 	}
 
 	bool
@@ -359,25 +406,18 @@ namespace EmEn::Vulkan
 			return false;
 		}
 
-		if ( m_deviceMemory != nullptr )
-		{
-			m_deviceMemory->destroyFromHardware();
-			m_deviceMemory.reset();
-		}
-
 		if ( m_handle != VK_NULL_HANDLE )
 		{
-			this->device()->waitIdle("Destroying an image");
-
-			vkDestroyImage(
-				this->device()->handle(),
-				m_handle,
-				VK_NULL_HANDLE
-			);
+			this->device()->deferDestruction([deviceHandle = this->device()->handle(), handle = m_handle] {
+				vkDestroyImage(deviceHandle, handle, nullptr);
+			});
 
 			m_handle = VK_NULL_HANDLE;
 		}
 
+		/* NOTE: The range goes back to the allocator after the handle destruction. */
+		m_deviceMemory.reset();
+
 		this->setDestroyed();
 
 		return true;
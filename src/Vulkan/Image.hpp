@@ -36,6 +36,7 @@
 #include "AbstractDeviceDependentObject.hpp"
 
 /* Local inclusions for usages. */
+#include "Libs/PixelFactory/BlockCompression.hpp"
 #include "Libs/PixelFactory/Pixmap.hpp"
 
 #if IS_WINDOWS
@@ -45,6 +46,11 @@
 
 namespace EmEn
 {
+	namespace Libs::PixelFactory
+	{
+		class CompressedTexture;
+	}
+
 	namespace Graphics
 	{
 		class ImageResource;
@@ -54,7 +60,7 @@ namespace EmEn
 
 	namespace Vulkan
 	{
-		class DeviceMemory;
+		class MemoryAllocation;
 		class MemoryRegion;
 	}
 }
@@ -347,6 +353,16 @@ namespace EmEn::Vulkan
 			[[nodiscard]]
 			bool create (TransferManager & transferManager, const std::shared_ptr< Graphics::ImageResource > & imageResource) noexcept;
 
+			/**
+			 * @brief Creates, allocates and returns a usable image from block compressed data.
+			 * @note Every level is copied as is, the image must be created with the compressed format and the same level count.
+			 * @param transferManager A reference to a transfer manager.
+			 * @param compressedTexture A reference to a compressed texture.
+			 * @return bool
+			 */
+			[[nodiscard]]
+			bool create (TransferManager & transferManager, const Libs::PixelFactory::CompressedTexture & compressedTexture) noexcept;
+
 			/**
 			 * @brief Creates, allocates and returns a usable image.
 			 * @param transferManager A reference to a transfer manager.
@@ -509,6 +525,39 @@ namespace EmEn::Vulkan
 				return VK_FORMAT_UNDEFINED;
 			}
 
+			/**
+			 * @brief Returns the Vulkan format of a block compressed format.
+			 * @note The formats are UNORM, as the uncompressed textures, so the shaders see the same values.
+			 * @param format The block format.
+			 * @param hasAlpha Whether the BC1 format has to keep its 1-bit alpha.
+			 * @return VkFormat
+			 */
+			[[nodiscard]]
+			static
+			VkFormat
+			getCompressedFormat (Libs::PixelFactory::BlockFormat format, bool hasAlpha) noexcept
+			{
+				switch ( format )
+				{
+					case Libs::PixelFactory::BlockFormat::BC1 :
+						return hasAlpha ? VK_FORMAT_BC1_RGBA_UNORM_BLOCK : VK_FORMAT_BC1_RGB_UNORM_BLOCK;
+
+					case Libs::PixelFactory::BlockFormat::BC3 :
+						return VK_FORMAT_BC3_UNORM_BLOCK;
+
+					case Libs::PixelFactory::BlockFormat::BC4 :
+						return VK_FORMAT_BC4_UNORM_BLOCK;
+
+					case Libs::PixelFactory::BlockFormat::BC5 :
+						return VK_FORMAT_BC5_UNORM_BLOCK;
+
+					case Libs::PixelFactory::BlockFormat::BC7 :
+						return VK_FORMAT_BC7_UNORM_BLOCK;
+				}
+
+				return VK_FORMAT_UNDEFINED;
+			}
+
 			/**
 			 * @brief Returns the number of mip levels possible for a given dimension.
 			 * @param width The width of the picture.
@@ -530,7 +579,7 @@ namespace EmEn::Vulkan
 
 			VkImage m_handle{VK_NULL_HANDLE};
 			VkImageCreateInfo m_createInfo{};
-			std::unique_ptr< DeviceMemory > m_deviceMemory;
+			std::unique_ptr< MemoryAllocation > m_deviceMemory;
 			VkImageLayout m_currentImageLayout{VK_IMAGE_LAYOUT_UNDEFINED};
 			std::array< bool, 8 > m_flags{
 				false/*IsSwapChainImage*/,
@@ -116,13 +116,9 @@ namespace EmEn::Vulkan
 
 		if ( m_handle != VK_NULL_HANDLE )
 		{
-			this->device()->waitIdle("Destroying an image view");
-
-			vkDestroyImageView(
-				this->device()->handle(),
-				m_handle,
-				VK_NULL_HANDLE
-			);
+			this->device()->deferDestruction([deviceHandle = this->device()->handle(), handle = m_handle] {
+				vkDestroyImageView(deviceHandle, handle, nullptr);
+			});
 
 			m_handle = VK_NULL_HANDLE;
 
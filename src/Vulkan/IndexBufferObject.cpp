@@ -40,7 +40,7 @@ namespace EmEn::Vulkan
 	}
 
 	bool
-	IndexBufferObject::create (TransferManager & transferManager, const std::vector< uint32_t > & data) noexcept
+	IndexBufferObject::create (TransferManager & transferManager, std::span< const uint32_t > data) noexcept
 	{
 		const auto bytes = data.size() * sizeof(uint32_t);
 
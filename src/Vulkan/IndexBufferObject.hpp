@@ -28,6 +28,7 @@
 
 /* STL inclusions. */
 #include <cstdint>
+#include <span>
 #include <vector>
 #include <memory>
 
@@ -65,11 +66,11 @@ namespace EmEn::Vulkan
 			/**
 			 * @brief Creates an index buffer object with initial data.
 			 * @param transferManager A reference to a transfer manager.
-			 * @param data A reference to a vector.
+			 * @param data A view on the indices, from a vector or a mapped file.
 			 * @return bool
 			 */
 			[[nodiscard]]
-			bool create (TransferManager & transferManager, const std::vector< uint32_t > & data) noexcept;
+			bool create (TransferManager & transferManager, std::span< const uint32_t > data) noexcept;
 
 		private:
 
@@ -667,6 +667,8 @@ namespace EmEn::Vulkan
 			requirements.features().geometryShader = VK_TRUE; // Required for TBN space display
 		}
 		requirements.features().samplerAnisotropy = VK_TRUE;
+		/* NOTE: Block compressed textures are used when available, otherwise textures stay uncompressed. */
+		requirements.features().textureCompressionBC = selectedPhysicalDevice->features().textureCompressionBC;
 		requirements.requireGraphicsQueues({1.0F}, {0.5F});
 		requirements.requireTransferQueues({1.0F});
 
@@ -0,0 +1,459 @@
+/*
+ * src/Vulkan/MemoryAllocator.cpp
+ * This file is part of Emeraude-Engine
+ *
+ * Copyright (C) 2010-2025 - Sébastien Léon Claude Christian Bémelmans "LondNoir" <londnoir@gmail.com>
+ *
+ * Emeraude-Engine is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * Emeraude-Engine is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with Emeraude-Engine; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * Complete project and additional information can be found at :
+ * https://github.com/londnoir/emeraude-engine
+ *
+ * --- THIS IS AUTOMATICALLY GENERATED, DO NOT CHANGE ---
+ */
+
+
+#include "MemoryAllocator.hpp"
+
+/* STL inclusions. */
+#include <algorithm>
+#include <ranges>
+
+/* Local inclusions. */
+#include "Device.hpp"
+#include "PhysicalDevice.hpp"
+#include "Utility.hpp"
+#include "Tracer.hpp"
+
+namespace EmEn::Vulkan
+{
+	using namespace EmEn::Libs;
+
+	/** @brief The heap size under which blocks are an eighth of the heap. */
+	constexpr VkDeviceSize SmallHeapSize{1024ULL * 1024 * 1024};
+
+	/**
+	 * @brief Returns the key of a pool.
+	 * @param memoryTypeIndex The memory type index.
+	 * @param linear Whether the resources are linear.
+	 * @return uint32_t
+	 */
+	[[nodiscard]]
+	constexpr
+	uint32_t
+	getPoolKey (uint32_t memoryTypeIndex, bool linear) noexcept
+	{
+		return memoryTypeIndex * 2 + (linear ? 1 : 0);
+	}
+
+	MemoryAllocation::MemoryAllocation (MemoryAllocator & allocator, uint32_t poolKey, Block * block, const TLSFAllocator::Allocation & range, VkDeviceMemory handle, void * mappedPointer) noexcept
+		: m_allocator(allocator),
+		m_poolKey(poolKey),
+		m_block(block),
+		m_range(range),
+		m_handle(handle),
+		m_offset(range.offset),
+		m_size(range.size),
+		m_mappedPointer(mappedPointer)
+	{
+
+	}
+
+	MemoryAllocation::~MemoryAllocation ()
+	{
+		m_allocator.release(*this);
+	}
+
+	void *
+	MemoryAllocation::mapMemory (VkDeviceSize offset, VkDeviceSize size) const noexcept
+	{
+		if ( m_mappedPointer == nullptr )
+		{
+			Tracer::error(MemoryAllocator::ClassId, "The device memory is not host visible !");
+
+			return nullptr;
+		}
+
+		if ( size != VK_WHOLE_SIZE && offset + size > m_size )
+		{
+			TraceError{MemoryAllocator::ClassId} << "The mapped range [" << offset << ", " << offset + size << "] is out of the allocation (" << m_size << " bytes) !";
+
+			return nullptr;
+		}
+
+		return static_cast< std::byte * >(m_mappedPointer) + m_offset + offset;
+	}
+
+	MemoryAllocator::MemoryAllocator (Device & device) noexcept
+		: m_device(device)
+	{
+
+	}
+
+	MemoryAllocator::~MemoryAllocator ()
+	{
+		this->clear();
+	}
+
+	std::unique_ptr< MemoryAllocation >
+	MemoryAllocator::allocate (const VkMemoryRequirements & requirements, VkMemoryPropertyFlags propertyFlags, bool linear) noexcept
+	{
+		const auto & memoryProperties = m_device.physicalDevice()->memoryProperties();
+		const auto memoryTypeIndex = m_device.findMemoryType(requirements.memoryTypeBits, propertyFlags);
+
+		if ( (requirements.memoryTypeBits & (1U << memoryTypeIndex)) == 0 || (memoryProperties.memoryTypes[memoryTypeIndex].propertyFlags & propertyFlags) != propertyFlags )
+		{
+			Tracer::error(ClassId, "There is no memory type matching the requirements !");
+
+			return nullptr;
+		}
+
+		const auto memoryTypeFlags = memoryProperties.memoryTypes[memoryTypeIndex].propertyFlags;
+
+		/* NOTE: Host visible ranges of a non-coherent memory are flushed by atoms, they must not share one. */
+		auto alignment = std::max< VkDeviceSize >(requirements.alignment, 1);
+		auto size = requirements.size;
+
+		if ( (memoryTypeFlags & VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT) != 0 && (memoryTypeFlags & VK_MEMORY_PROPERTY_HOST_COHERENT_BIT) == 0 )
+		{
+			const auto atomSize = m_device.physicalDevice()->properties().limits.nonCoherentAtomSize;
+
+			alignment = std::max(alignment, atomSize);
+			size = (size + atomSize - 1) / atomSize * atomSize;
+		}
+
+		const std::lock_guard< std::mutex > lock{m_poolsAccess};
+
+		auto & pool = this->getPool(memoryTypeIndex, linear);
+		const auto poolKey = getPoolKey(memoryTypeIndex, linear);
+
+		/* NOTE: Large resources would waste most of a block, they get their own device memory. */
+		if ( size > pool.blockSize / 2 )
+		{
+			VkDeviceMemory handle{VK_NULL_HANDLE};
+			void * mappedPointer = nullptr;
+
+			if ( !this->allocateDeviceMemory(memoryTypeIndex, size, handle, mappedPointer) )
+			{
+				return nullptr;
+			}
+
+			pool.dedicatedAllocations.emplace_back(handle);
+			pool.dedicatedBytes += size;
+
+			return std::unique_ptr< MemoryAllocation >{new MemoryAllocation{*this, poolKey, nullptr, {0, size, TLSFAllocator::InvalidNode}, handle, mappedPointer}};
+		}
+
+		TLSFAllocator::Allocation range{};
+		MemoryAllocation::Block * selectedBlock = nullptr;
+
+		for ( const auto & block : pool.blocks )
+		{
+			if ( block->ranges.allocate(size, alignment, range) )
+			{
+				selectedBlock = block.get();
+
+				break;
+			}
+		}
+
+		if ( selectedBlock == nullptr )
+		{
+			VkDeviceMemory handle{VK_NULL_HANDLE};
+			void * mappedPointer = nullptr;
+
+			if ( !this->allocateDeviceMemory(memoryTypeIndex, pool.blockSize, handle, mappedPointer) )
+			{
+				return nullptr;
+			}
+
+			auto block = std::unique_ptr< MemoryAllocation::Block >{new MemoryAllocation::Block{handle, mappedPointer, TLSFAllocator{pool.blockSize}, {}}};
+
+			if ( !block->ranges.allocate(size, alignment, range) )
+			{
+				TraceError{ClassId} << "Unable to allocate " << size << " bytes in a new block of " << pool.blockSize << " bytes !";
+
+				vkFreeMemory(m_device.handle(), handle, nullptr);
+
+				return nullptr;
+			}
+
+			selectedBlock = pool.blocks.emplace_back(std::move(block)).get();
+		}
+
+		auto allocation = std::unique_ptr< MemoryAllocation >{new MemoryAllocation{*this, poolKey, selectedBlock, range, selectedBlock->handle, selectedBlock->mappedPointer}};
+
+		selectedBlock->allocations[range.node] = allocation.get();
+
+		return allocation;
+	}
+
+	size_t
+	MemoryAllocator::defragment (const std::function< bool (const MemoryAllocation & allocation, VkDeviceSize newOffset) > & mover) noexcept
+	{
+		const std::lock_guard< std::mutex > lock{m_poolsAccess};
+
+		size_t movedCount = 0;
+
+		for ( auto & pool : m_pools | std::views::values )
+		{
+			for ( const auto & block : pool.blocks )
+			{
+				movedCount += block->ranges.compact([&block, &mover] (const TLSFAllocator::Allocation & range, uint64_t newOffset) {
+					const auto allocationIt = block->allocations.find(range.node);
+
+					/* NOTE: A range waiting for its deferred release has no owner anymore, it stays in place. */
+					if ( allocationIt == block->allocations.end() || !mover(*allocationIt->second, newOffset) )
+					{
+						return false;
+					}
+
+					allocationIt->second->m_offset = newOffset;
+					allocationIt->second->m_range.offset = newOffset;
+
+					return true;
+				});
+			}
+		}
+
+		return movedCount;
+	}
+
+	size_t
+	MemoryAllocator::releaseEmptyBlocks () noexcept
+	{
+		const std::lock_guard< std::mutex > lock{m_poolsAccess};
+
+		size_t releasedCount = 0;
+
+		for ( auto & pool : m_pools | std::views::values )
+		{
+			releasedCount += std::erase_if(pool.blocks, [this] (const auto & block) {
+				if ( !block->ranges.isEmpty() )
+				{
+					return false;
+				}
+
+				vkFreeMemory(m_device.handle(), block->handle, nullptr);
+
+				return true;
+			});
+		}
+
+		return releasedCount;
+	}
+
+	std::vector< MemoryAllocator::Statistics >
+	MemoryAllocator::getStatistics () const noexcept
+	{
+		const std::lock_guard< std::mutex > lock{m_poolsAccess};
+
+		std::vector< Statistics > statistics;
+		statistics.reserve(m_pools.size());
+
+		for ( const auto & pool : m_pools | std::views::values )
+		{
+			auto & poolStatistics = statistics.emplace_back();
+			poolStatistics.memoryTypeIndex = pool.memoryTypeIndex;
+			poolStatistics.linear = pool.linear;
+			poolStatistics.blockCount = pool.blocks.size();
+			poolStatistics.dedicatedCount = pool.dedicatedAllocations.size();
+			poolStatistics.allocationCount = pool.dedicatedAllocations.size();
+			poolStatistics.reservedBytes = pool.dedicatedBytes;
+			poolStatistics.usedBytes = pool.dedicatedBytes;
+
+			VkDeviceSize freeBytes = 0;
+
+			for ( const auto & block : pool.blocks )
+			{
+				poolStatistics.allocationCount += block->ranges.allocationCount();
+				poolStatistics.reservedBytes += block->ranges.capacity();
+				poolStatistics.usedBytes += block->ranges.usedBytes();
+				poolStatistics.largestFreeBlock = std::max(poolStatistics.largestFreeBlock, block->ranges.largestFreeBlock());
+
+				freeBytes += block->ranges.freeBytes();
+			}
+
+			if ( freeBytes > 0 )
+			{
+				poolStatistics.fragmentation = 1.0F - static_cast< float >(poolStatistics.largestFreeBlock) / static_cast< float >(freeBytes);
+			}
+		}
+
+		return statistics;
+	}
+
+	size_t
+	MemoryAllocator::deviceAllocationCount () const noexcept
+	{
+		const std::lock_guard< std::mutex > lock{m_poolsAccess};
+
+		size_t count = 0;
+
+		for ( const auto & pool : m_pools | std::views::values )
+		{
+			count += pool.blocks.size() + pool.dedicatedAllocations.size();
+		}
+
+		return count;
+	}
+
+	void
+	MemoryAllocator::clear () noexcept
+	{
+		const std::lock_guard< std::mutex > lock{m_poolsAccess};
+
+		for ( auto & pool : m_pools | std::views::values )
+		{
+			for ( const auto & block : pool.blocks )
+			{
+				if ( !block->allocations.empty() )
+				{
+					TraceWarning{ClassId} << block->allocations.size() << " allocations are still alive in the memory type #" << pool.memoryTypeIndex << " block !";
+				}
+
+				vkFreeMemory(m_device.handle(), block->handle, nullptr);
+			}
+
+			for ( const auto & handle : pool.dedicatedAllocations )
+			{
+				vkFreeMemory(m_device.handle(), handle, nullptr);
+			}
+		}
+
+		m_pools.clear();
+	}
+
+	MemoryAllocator::Pool &
+	MemoryAllocator::getPool (uint32_t memoryTypeIndex, bool linear) noexcept
+	{
+		const auto [poolIt, inserted] = m_pools.try_emplace(getPoolKey(memoryTypeIndex, linear));
+
+		if ( inserted )
+		{
+			const auto & memoryProperties = m_device.physicalDevice()->memoryProperties();
+			const auto heapSize = memoryProperties.memoryHeaps[memoryProperties.memoryTypes[memoryTypeIndex].heapIndex].size;
+
+			poolIt->second.memoryTypeIndex = memoryTypeIndex;
+			poolIt->second.linear = linear;
+			poolIt->second.blockSize = heapSize <= SmallHeapSize ? heapSize / 8 : DefaultBlockSize;
+		}
+
+		return poolIt->second;
+	}
+
+	bool
+	MemoryAllocator::allocateDeviceMemory (uint32_t memoryTypeIndex, VkDeviceSize size, VkDeviceMemory & handle, void * & mappedPointer) const noexcept
+	{
+		VkMemoryAllocateInfo allocateInfo{};
+		allocateInfo.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+		allocateInfo.pNext = nullptr;
+		allocateInfo.allocationSize = size;
+		allocateInfo.memoryTypeIndex = memoryTypeIndex;
+
+		auto result = vkAllocateMemory(m_device.handle(), &allocateInfo, nullptr, &handle);
+
+		if ( result != VK_SUCCESS )
+		{
+			TraceError{ClassId} << "Unable to allocate " << size << " bytes in the memory type #" << memoryTypeIndex << " : " << vkResultToCString(result) << " !";
+
+			return false;
+		}
+
+		mappedPointer = nullptr;
+
+		/* NOTE: Host visible memory is mapped once for its whole life. */
+		if ( (m_device.physicalDevice()->memoryProperties().memoryTypes[memoryTypeIndex].propertyFlags & VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT) != 0 )
+		{
+			result = vkMapMemory(m_device.handle(), handle, 0, VK_WHOLE_SIZE, 0, &mappedPointer);
+
+			if ( result != VK_SUCCESS )
+			{
+				TraceError{ClassId} << "Unable to map the device memory : " << vkResultToCString(result) << " !";
+
+				vkFreeMemory(m_device.handle(), handle, nullptr);
+
+				handle = VK_NULL_HANDLE;
+
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+	void
+	MemoryAllocator::release (const MemoryAllocation & allocation) noexcept
+	{
+		if ( allocation.m_block != nullptr )
+		{
+			const std::lock_guard< std::mutex > lock{m_poolsAccess};
+
+			allocation.m_block->allocations.erase(allocation.m_range.node);
+		}
+
+		m_device.deferDestruction([this, poolKey = allocation.m_poolKey, block = allocation.m_block, range = allocation.m_range, handle = allocation.m_handle, size = allocation.m_size] {
+			this->free(poolKey, block, range, handle, size);
+		});
+	}
+
+	void
+	MemoryAllocator::free (uint32_t poolKey, MemoryAllocation::Block * block, const TLSFAllocator::Allocation & range, VkDeviceMemory handle, VkDeviceSize size) noexcept
+	{
+		const std::lock_guard< std::mutex > lock{m_poolsAccess};
+
+		const auto poolIt = m_pools.find(poolKey);
+
+		if ( poolIt == m_pools.end() )
+		{
+			return;
+		}
+
+		auto & pool = poolIt->second;
+
+		if ( block == nullptr )
+		{
+			if ( std::erase(pool.dedicatedAllocations, handle) > 0 )
+			{
+				pool.dedicatedBytes -= size;
+
+				vkFreeMemory(m_device.handle(), handle, nullptr);
+			}
+
+			return;
+		}
+
+		block->ranges.free(range);
+
+		if ( !block->ranges.isEmpty() )
+		{
+			return;
+		}
+
+		/* NOTE: One empty block is kept per pool to absorb allocation spikes without a round trip to the driver. */
+		const auto emptyBlockCount = std::ranges::count_if(pool.blocks, [] (const auto & poolBlock) {
+			return poolBlock->ranges.isEmpty();
+		});
+
+		if ( emptyBlockCount > 1 )
+		{
+			vkFreeMemory(m_device.handle(), block->handle, nullptr);
+
+			std::erase_if(pool.blocks, [block] (const auto & poolBlock) {
+				return poolBlock.get() == block;
+			});
+		}
+	}
+}
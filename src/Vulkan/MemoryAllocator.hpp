@@ -0,0 +1,365 @@
+/*
+ * src/Vulkan/MemoryAllocator.hpp
+ * This file is part of Emeraude-Engine
+ *
+ * Copyright (C) 2010-2025 - Sébastien Léon Claude Christian Bémelmans "LondNoir" <londnoir@gmail.com>
+ *
+ * Emeraude-Engine is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * Emeraude-Engine is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with Emeraude-Engine; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * Complete project and additional information can be found at :
+ * https://github.com/londnoir/emeraude-engine
+ *
+ * --- THIS IS AUTOMATICALLY GENERATED, DO NOT CHANGE ---
+ */
+
+
+#pragma once
+
+/* STL inclusions. */
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+/* Third-party inclusions. */
+#include <vulkan/vulkan.h>
+
+/* Local inclusions for usages. */
+#include "Libs/TLSFAllocator.hpp"
+
+/* Forward declarations. */
+namespace EmEn::Vulkan
+{
+	class Device;
+	class MemoryAllocator;
+}
+
+namespace EmEn::Vulkan
+{
+	/**
+	 * @brief A range of device memory given to a buffer or an image.
+	 * @note The range is a part of a larger memory block, or a whole dedicated allocation for large resources.
+	 * Host visible memory stays mapped for its whole life, so several ranges of a block can be accessed at once.
+	 */
+	class MemoryAllocation final
+	{
+		friend class MemoryAllocator;
+
+		public:
+
+			/**
+			 * @brief Copy constructor.
+			 * @param copy A reference to the copied instance.
+			 */
+			MemoryAllocation (const MemoryAllocation & copy) noexcept = delete;
+
+			/**
+			 * @brief Move constructor.
+			 * @param copy A reference to the copied instance.
+			 */
+			MemoryAllocation (MemoryAllocation && copy) noexcept = delete;
+
+			/**
+			 * @brief Copy assignment.
+			 * @param copy A reference to the copied instance.
+			 * @return MemoryAllocation &
+			 */
+			MemoryAllocation & operator= (const MemoryAllocation & copy) noexcept = delete;
+
+			/**
+			 * @brief Move assignment.
+			 * @param copy A reference to the copied instance.
+			 * @return MemoryAllocation &
+			 */
+			MemoryAllocation & operator= (MemoryAllocation && copy) noexcept = delete;
+
+			/**
+			 * @brief Destructs the allocation, giving back the range once the frames in flight are executed.
+			 */
+			~MemoryAllocation ();
+
+			/**
+			 * @brief Returns the device memory handle to bind.
+			 * @return VkDeviceMemory
+			 */
+			[[nodiscard]]
+			VkDeviceMemory
+			handle () const noexcept
+			{
+				return m_handle;
+			}
+
+			/**
+			 * @brief Returns the offset of the range in the device memory.
+			 * @return VkDeviceSize
+			 */
+			[[nodiscard]]
+			VkDeviceSize
+			offset () const noexcept
+			{
+				return m_offset;
+			}
+
+			/**
+			 * @brief Returns the size of the range.
+			 * @return VkDeviceSize
+			 */
+			[[nodiscard]]
+			VkDeviceSize
+			size () const noexcept
+			{
+				return m_size;
+			}
+
+			/**
+			 * @brief Returns whether the range owns a whole device memory allocation.
+			 * @return bool
+			 */
+			[[nodiscard]]
+			bool
+			isDedicated () const noexcept
+			{
+				return m_block == nullptr;
+			}
+
+			/**
+			 * @brief Returns a host pointer to a part of the range.
+			 * @param offset The offset from the beginning of the range.
+			 * @param size The size of the part.
+			 * @return void *
+			 */
+			[[nodiscard]]
+			void * mapMemory (VkDeviceSize offset, VkDeviceSize size) const noexcept;
+
+			/**
+			 * @brief Ends a host access. The memory stays mapped, this does nothing.
+			 * @return void
+			 */
+			void
+			unmapMemory () const noexcept
+			{
+
+			}
+
+		private:
+
+			/** @brief A device memory block shared by several ranges. */
+			struct Block;
+
+			/**
+			 * @brief Constructs an allocation.
+			 * @param allocator A reference to the allocator.
+			 * @param poolKey The key of the pool owning the memory.
+			 * @param block A pointer to the block. Null for a dedicated allocation.
+			 * @param range The range in the block.
+			 * @param handle The device memory handle.
+			 * @param mappedPointer The host pointer of the device memory, or null.
+			 */
+			MemoryAllocation (MemoryAllocator & allocator, uint32_t poolKey, Block * block, const Libs::TLSFAllocator::Allocation & range, VkDeviceMemory handle, void * mappedPointer) noexcept;
+
+			MemoryAllocator & m_allocator;
+			uint32_t m_poolKey;
+			Block * m_block;
+			Libs::TLSFAllocator::Allocation m_range;
+			VkDeviceMemory m_handle;
+			VkDeviceSize m_offset;
+			VkDeviceSize m_size;
+			void * m_mappedPointer;
+	};
+
+	/**
+	 * @brief Sub-allocates device memory in large blocks per memory type.
+	 * @note This replaces one vkAllocateMemory() per buffer and image, keeping far below the device
+	 * maxMemoryAllocationCount. Resources larger than half a block get a dedicated allocation. Linear (buffers,
+	 * linear images) and optimal resources never share a block, so the bufferImageGranularity is always respected.
+	 * The device owns the allocator.
+	 */
+	class MemoryAllocator final
+	{
+		friend class MemoryAllocation;
+
+		public:
+
+			/** @brief Class identifier. */
+			static constexpr auto ClassId{"VulkanMemoryAllocator"};
+
+			/** @brief The block size of the memory types on a large heap. */
+			static constexpr VkDeviceSize DefaultBlockSize{64ULL * 1024 * 1024};
+
+			/** @brief The usage of a memory pool. */
+			struct Statistics
+			{
+				uint32_t memoryTypeIndex{0};
+				bool linear{false};
+				size_t blockCount{0};
+				size_t dedicatedCount{0};
+				size_t allocationCount{0};
+				VkDeviceSize reservedBytes{0};
+				VkDeviceSize usedBytes{0};
+				VkDeviceSize largestFreeBlock{0};
+				float fragmentation{0.0F};
+			};
+
+			/**
+			 * @brief Constructs a memory allocator.
+			 * @param device A reference to the owner device.
+			 */
+			explicit MemoryAllocator (Device & device) noexcept;
+
+			/**
+			 * @brief Copy constructor.
+			 * @param copy A reference to the copied instance.
+			 */
+			MemoryAllocator (const MemoryAllocator & copy) noexcept = delete;
+
+			/**
+			 * @brief Move constructor.
+			 * @param copy A reference to the copied instance.
+			 */
+			MemoryAllocator (MemoryAllocator && copy) noexcept = delete;
+
+			/**
+			 * @brief Copy assignment.
+			 * @param copy A reference to the copied instance.
+			 * @return MemoryAllocator &
+			 */
+			MemoryAllocator & operator= (const MemoryAllocator & copy) noexcept = delete;
+
+			/**
+			 * @brief Move assignment.
+			 * @param copy A reference to the copied instance.
+			 * @return MemoryAllocator &
+			 */
+			MemoryAllocator & operator= (MemoryAllocator && copy) noexcept = delete;
+
+			/**
+			 * @brief Destructs the memory allocator, releasing every block.
+			 */
+			~MemoryAllocator ();
+
+			/**
+			 * @brief Allocates a range of device memory.
+			 * @param requirements A reference to the resource memory requirements.
+			 * @param propertyFlags The memory properties requested.
+			 * @param linear Whether the resource is a buffer or a linear image.
+			 * @return std::unique_ptr< MemoryAllocation >
+			 */
+			[[nodiscard]]
+			std::unique_ptr< MemoryAllocation > allocate (const VkMemoryRequirements & requirements, VkMemoryPropertyFlags propertyFlags, bool linear) noexcept;
+
+			/**
+			 * @brief Moves the ranges toward the beginning of their block to merge the free space.
+			 * @note This is the defragmentation hook. The mover must copy the content to the new offset of the same
+			 * device memory and rebind its resource, returning false leaves the range in place. The device must be idle.
+			 * @param mover The function called for each move with the allocation and its new offset.
+			 * @return size_t The number of moved ranges.
+			 */
+			size_t defragment (const std::function< bool (const MemoryAllocation & allocation, VkDeviceSize newOffset) > & mover) noexcept;
+
+			/**
+			 * @brief Releases the blocks holding no range.
+			 * @return size_t The number of released blocks.
+			 */
+			size_t releaseEmptyBlocks () noexcept;
+
+			/**
+			 * @brief Returns the usage of every memory pool.
+			 * @return std::vector< Statistics >
+			 */
+			[[nodiscard]]
+			std::vector< Statistics > getStatistics () const noexcept;
+
+			/**
+			 * @brief Returns the number of vkAllocateMemory() allocations alive.
+			 * @return size_t
+			 */
+			[[nodiscard]]
+			size_t deviceAllocationCount () const noexcept;
+
+			/**
+			 * @brief Releases every block and dedicated allocation.
+			 * @warning The device must be idle and the deferred destructions flushed.
+			 * @return void
+			 */
+			void clear () noexcept;
+
+		private:
+
+			/** @brief A memory pool for one memory type and one resource kind. */
+			struct Pool
+			{
+				uint32_t memoryTypeIndex{0};
+				bool linear{false};
+				VkDeviceSize blockSize{DefaultBlockSize};
+				std::vector< std::unique_ptr< MemoryAllocation::Block > > blocks;
+				std::vector< VkDeviceMemory > dedicatedAllocations;
+				VkDeviceSize dedicatedBytes{0};
+			};
+
+			/**
+			 * @brief Returns the pool for a memory type and a resource kind, creating it if needed.
+			 * @param memoryTypeIndex The memory type index.
+			 * @param linear Whether the resources are linear.
+			 * @return Pool &
+			 */
+			[[nodiscard]]
+			Pool & getPool (uint32_t memoryTypeIndex, bool linear) noexcept;
+
+			/**
+			 * @brief Allocates device memory and maps it when possible.
+			 * @param memoryTypeIndex The memory type index.
+			 * @param size The size in bytes.
+			 * @param handle A reference to the device memory handle.
+			 * @param mappedPointer A reference to the host pointer.
+			 * @return bool
+			 */
+			bool allocateDeviceMemory (uint32_t memoryTypeIndex, VkDeviceSize size, VkDeviceMemory & handle, void * & mappedPointer) const noexcept;
+
+			/**
+			 * @brief Releases an allocation once the frames in flight are executed.
+			 * @param allocation A reference to the allocation.
+			 * @return void
+			 */
+			void release (const MemoryAllocation & allocation) noexcept;
+
+			/**
+			 * @brief Gives back a range immediately.
+			 * @param poolKey The key of the pool owning the memory.
+			 * @param block A pointer to the block. Null for a dedicated allocation.
+			 * @param range The range in the block.
+			 * @param handle The device memory handle.
+			 * @param size The size of the range.
+			 * @return void
+			 */
+			void free (uint32_t poolKey, MemoryAllocation::Block * block, const Libs::TLSFAllocator::Allocation & range, VkDeviceMemory handle, VkDeviceSize size) noexcept;
+
+			Device & m_device;
+			std::map< uint32_t, Pool > m_pools;
+			mutable std::mutex m_poolsAccess;
+	};
+
+	/** @brief A device memory block shared by several ranges. */
+	struct MemoryAllocation::Block
+	{
+		VkDeviceMemory handle{VK_NULL_HANDLE};
+		void * mappedPointer{nullptr};
+		Libs::TLSFAllocator ranges;
+		std::unordered_map< uint32_t, MemoryAllocation * > allocations;
+	};
+}
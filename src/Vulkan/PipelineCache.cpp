@@ -0,0 +1,292 @@
+/*
+ * src/Vulkan/PipelineCache.cpp
+ * This file is part of Emeraude-Engine
+ *
+ * Copyright (C) 2010-2025 - Sébastien Léon Claude Christian Bémelmans "LondNoir" <londnoir@gmail.com>
+ *
+ * Emeraude-Engine is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * Emeraude-Engine is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with Emeraude-Engine; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * Complete project and additional information can be found at :
+ * https://github.com/londnoir/emeraude-engine
+ *
+ * --- THIS IS AUTOMATICALLY GENERATED, DO NOT CHANGE ---
+ */
+
+#include "PipelineCache.hpp"
+
+/* STL inclusions. */
+#include <algorithm>
+#include <iterator>
+#include <sstream>
+#include <tuple>
+
+/* Local inclusions. */
+#include "Device.hpp"
+#include "PhysicalDevice.hpp"
+#include "Utility.hpp"
+#include "Tracer.hpp"
+
+namespace EmEn::Vulkan
+{
+	PipelineCache::PipelineCache (const std::shared_ptr< Device > & device, const std::filesystem::path & directory) noexcept
+		: AbstractDeviceDependentObject(device)
+	{
+		if ( !directory.empty() )
+		{
+			const auto & properties = device->physicalDevice()->properties();
+
+			/* NOTE: One file per device, so a system with several GPUs does not invalidate the cache at every run. */
+			std::stringstream filename;
+			filename << std::hex << properties.vendorID << '-' << properties.deviceID << FileExtension;
+
+			m_filepath = directory / filename.str();
+		}
+	}
+
+	PipelineCache::~PipelineCache ()
+	{
+		this->destroyFromHardware();
+	}
+
+	bool
+	PipelineCache::createOnHardware () noexcept
+	{
+		if ( !this->hasDevice() )
+		{
+			Tracer::error(ClassId, "No device to create this pipeline cache !");
+
+			return false;
+		}
+
+		std::vector< uint8_t > initialData;
+
+		m_loadedFromFile = !m_filepath.empty() && PipelineCacheFile{m_filepath, this->getDeviceIdentity()}.read(initialData);
+
+		if ( m_loadedFromFile )
+		{
+			if ( this->create(initialData) )
+			{
+				TraceInfo{ClassId} << "Pipeline cache loaded from " << m_filepath << " (" << initialData.size() << " bytes).";
+
+				return true;
+			}
+
+			/* NOTE: The driver is the last judge of its data, a refused file only costs an empty cache. */
+			TraceWarning{ClassId} << "The driver refused the content of " << m_filepath << ", starting with an empty pipeline cache.";
+
+			m_loadedFromFile = false;
+			initialData.clear();
+		}
+
+		return this->create(initialData);
+	}
+
+	bool
+	PipelineCache::createOnHardware (const PipelineCache & source) noexcept
+	{
+		if ( !this->hasDevice() )
+		{
+			Tracer::error(ClassId, "No device to create this pipeline cache !");
+
+			return false;
+		}
+
+		std::vector< uint8_t > initialData;
+
+		if ( !source.getData(initialData) )
+		{
+			initialData.clear();
+		}
+
+		return this->create(initialData);
+	}
+
+	bool
+	PipelineCache::destroyFromHardware () noexcept
+	{
+		if ( !this->hasDevice() )
+		{
+			TraceError{ClassId} << "No device to destroy the pipeline cache " << m_handle << " (" << this->identifier() << ") !";
+
+			return false;
+		}
+
+		/* NOTE: A pipeline cache is never used by a command buffer, it can be destroyed right away. */
+		if ( m_handle != VK_NULL_HANDLE )
+		{
+			vkDestroyPipelineCache(this->device()->handle(), m_handle, nullptr);
+
+			m_handle = VK_NULL_HANDLE;
+		}
+
+		this->setDestroyed();
+
+		return true;
+	}
+
+	bool
+	PipelineCache::getData (std::vector< uint8_t > & data) const noexcept
+	{
+		if ( m_handle == VK_NULL_HANDLE )
+		{
+			Tracer::error(ClassId, "The pipeline cache is not created !");
+
+			return false;
+		}
+
+		/* NOTE: The size can grow between the two calls when another thread creates a pipeline with this cache. */
+		VkResult result;
+
+		do
+		{
+			size_t dataSize = 0;
+
+			result = vkGetPipelineCacheData(this->device()->handle(), m_handle, &dataSize, nullptr);
+
+			if ( result != VK_SUCCESS )
+			{
+				break;
+			}
+
+			data.resize(dataSize);
+
+			result = vkGetPipelineCacheData(this->device()->handle(), m_handle, &dataSize, data.data());
+
+			data.resize(dataSize);
+		}
+		while ( result == VK_INCOMPLETE );
+
+		if ( result != VK_SUCCESS )
+		{
+			TraceError{ClassId} << "Unable to get the pipeline cache data : " << vkResultToCString(result) << " !";
+
+			data.clear();
+
+			return false;
+		}
+
+		return true;
+	}
+
+	bool
+	PipelineCache::merge (const std::vector< std::shared_ptr< PipelineCache > > & sources) noexcept
+	{
+		if ( m_handle == VK_NULL_HANDLE )
+		{
+			Tracer::error(ClassId, "The pipeline cache is not created !");
+
+			return false;
+		}
+
+		std::vector< VkPipelineCache > handles;
+		handles.reserve(sources.size());
+
+		for ( const auto & source : sources )
+		{
+			if ( source != nullptr && source->handle() != VK_NULL_HANDLE && source->handle() != m_handle )
+			{
+				handles.emplace_back(source->handle());
+			}
+		}
+
+		if ( handles.empty() )
+		{
+			return true;
+		}
+
+		const auto result = vkMergePipelineCaches(this->device()->handle(), m_handle, static_cast< uint32_t >(handles.size()), handles.data());
+
+		if ( result != VK_SUCCESS )
+		{
+			TraceError{ClassId} << "Unable to merge " << handles.size() << " pipeline caches : " << vkResultToCString(result) << " !";
+
+			return false;
+		}
+
+		return true;
+	}
+
+	bool
+	PipelineCache::save () const noexcept
+	{
+		if ( m_filepath.empty() )
+		{
+			return true;
+		}
+
+		std::vector< uint8_t > data;
+
+		if ( !this->getData(data) )
+		{
+			return false;
+		}
+
+		if ( !PipelineCacheFile{m_filepath, this->getDeviceIdentity()}.write(data) )
+		{
+			TraceError{ClassId} << "Unable to write the pipeline cache file " << m_filepath << " !";
+
+			return false;
+		}
+
+		TraceInfo{ClassId} << "Pipeline cache saved to " << m_filepath << " (" << data.size() << " bytes).";
+
+		return true;
+	}
+
+	PipelineCacheFile::DeviceIdentity
+	PipelineCache::getDeviceIdentity () const noexcept
+	{
+		static_assert(VK_UUID_SIZE == std::tuple_size_v< decltype(PipelineCacheFile::DeviceIdentity::pipelineCacheUUID) >);
+
+		const auto & properties = this->device()->physicalDevice()->properties();
+
+		PipelineCacheFile::DeviceIdentity identity{
+			.vendorID = properties.vendorID,
+			.deviceID = properties.deviceID,
+			.driverVersion = properties.driverVersion,
+			.pipelineCacheUUID = {}
+		};
+
+		std::copy_n(std::begin(properties.pipelineCacheUUID), VK_UUID_SIZE, identity.pipelineCacheUUID.begin());
+
+		return identity;
+	}
+
+	bool
+	PipelineCache::create (const std::vector< uint8_t > & initialData) noexcept
+	{
+		VkPipelineCacheCreateInfo createInfo{};
+		createInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO;
+		createInfo.pNext = nullptr;
+		createInfo.flags = 0;
+		createInfo.initialDataSize = initialData.size();
+		createInfo.pInitialData = initialData.empty() ? nullptr : initialData.data();
+
+		const auto result = vkCreatePipelineCache(this->device()->handle(), &createInfo, nullptr, &m_handle);
+
+		if ( result != VK_SUCCESS )
+		{
+			TraceError{ClassId} << "Unable to create a pipeline cache : " << vkResultToCString(result) << " !";
+
+			m_handle = VK_NULL_HANDLE;
+
+			return false;
+		}
+
+		this->setCreated();
+
+		return true;
+	}
+}
@@ -0,0 +1,188 @@
+/*
+ * src/Vulkan/PipelineCache.hpp
+ * This file is part of Emeraude-Engine
+ *
+ * Copyright (C) 2010-2025 - Sébastien Léon Claude Christian Bémelmans "LondNoir" <londnoir@gmail.com>
+ *
+ * Emeraude-Engine is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * Emeraude-Engine is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with Emeraude-Engine; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * Complete project and additional information can be found at :
+ * https://github.com/londnoir/emeraude-engine
+ *
+ * --- THIS IS AUTOMATICALLY GENERATED, DO NOT CHANGE ---
+ */
+
+#pragma once
+
+/* STL inclusions. */
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <vector>
+
+/* Local inclusions for inheritances. */
+#include "AbstractDeviceDependentObject.hpp"
+
+/* Local inclusions for usages. */
+#include "PipelineCacheFile.hpp"
+
+namespace EmEn::Vulkan
+{
+	/**
+	 * @brief The pipeline cache class. This keeps the driver pipeline compilations between pipeline creations and between runs.
+	 * @note The file is only reused when the vendor, the device, the driver version and the pipeline cache UUID are the same.
+	 * @extends EmEn::Vulkan::AbstractDeviceDependentObject This object needs a device.
+	 */
+	class PipelineCache final : public AbstractDeviceDependentObject
+	{
+		public:
+
+			/** @brief Class identifier. */
+			static constexpr auto ClassId{"VulkanPipelineCache"};
+
+			/** @brief The cached file extension. */
+			static constexpr auto FileExtension{".empc"};
+
+			/**
+			 * @brief Constructs a pipeline cache.
+			 * @param device A reference to a smart pointer of the device.
+			 * @param directory The directory where the cache is stored. An empty path keeps the cache in memory only. Default none.
+			 */
+			explicit PipelineCache (const std::shared_ptr< Device > & device, const std::filesystem::path & directory = {}) noexcept;
+
+			/**
+			 * @brief Copy constructor.
+			 * @param copy A reference to the copied instance.
+			 */
+			PipelineCache (const PipelineCache & copy) noexcept = delete;
+
+			/**
+			 * @brief Move constructor.
+			 * @param copy A reference to the copied instance.
+			 */
+			PipelineCache (PipelineCache && copy) noexcept = delete;
+
+			/**
+			 * @brief Copy assignment.
+			 * @param copy A reference to the copied instance.
+			 */
+			PipelineCache & operator= (const PipelineCache & copy) noexcept = delete;
+
+			/**
+			 * @brief Move assignment.
+			 * @param copy A reference to the copied instance.
+			 */
+			PipelineCache & operator= (PipelineCache && copy) noexcept = delete;
+
+			/**
+			 * @brief Destructs the pipeline cache.
+			 */
+			~PipelineCache () override;
+
+			/**
+			 * @copydoc EmEn::Vulkan::AbstractDeviceDependentObject::createOnHardware()
+			 * @note The content of the cache file is loaded when it is valid for the device.
+			 */
+			bool createOnHardware () noexcept override;
+
+			/**
+			 * @brief Creates the pipeline cache from the content of another one.
+			 * @note This is used to give a private copy of a cache to a thread.
+			 * @param source A reference to a created pipeline cache.
+			 * @return bool
+			 */
+			[[nodiscard]]
+			bool createOnHardware (const PipelineCache & source) noexcept;
+
+			/** @copydoc EmEn::Vulkan::AbstractDeviceDependentObject::destroyFromHardware() */
+			bool destroyFromHardware () noexcept override;
+
+			/**
+			 * @brief Returns the pipeline cache vulkan handle.
+			 * @return VkPipelineCache
+			 */
+			[[nodiscard]]
+			VkPipelineCache
+			handle () const noexcept
+			{
+				return m_handle;
+			}
+
+			/**
+			 * @brief Returns the file where the cache is stored.
+			 * @return const std::filesystem::path &
+			 */
+			[[nodiscard]]
+			const std::filesystem::path &
+			filepath () const noexcept
+			{
+				return m_filepath;
+			}
+
+			/**
+			 * @brief Returns whether the cache content has been read from the file.
+			 * @return bool
+			 */
+			[[nodiscard]]
+			bool
+			isLoadedFromFile () const noexcept
+			{
+				return m_loadedFromFile;
+			}
+
+			/**
+			 * @brief Gets the driver data of the cache.
+			 * @param data A reference to a byte vector.
+			 * @return bool
+			 */
+			[[nodiscard]]
+			bool getData (std::vector< uint8_t > & data) const noexcept;
+
+			/**
+			 * @brief Merges other caches, for instance those filled by worker threads, into this one.
+			 * @param sources A reference to a list of pipeline caches.
+			 * @return bool
+			 */
+			bool merge (const std::vector< std::shared_ptr< PipelineCache > > & sources) noexcept;
+
+			/**
+			 * @brief Writes the cache into its file.
+			 * @return bool
+			 */
+			bool save () const noexcept;
+
+		private:
+
+			/**
+			 * @brief Returns the identity of the device to validate the cache file.
+			 * @return PipelineCacheFile::DeviceIdentity
+			 */
+			[[nodiscard]]
+			PipelineCacheFile::DeviceIdentity getDeviceIdentity () const noexcept;
+
+			/**
+			 * @brief Creates the vulkan pipeline cache.
+			 * @param initialData A reference to the initial driver data. Can be empty.
+			 * @return bool
+			 */
+			[[nodiscard]]
+			bool create (const std::vector< uint8_t > & initialData) noexcept;
+
+			VkPipelineCache m_handle{VK_NULL_HANDLE};
+			std::filesystem::path m_filepath;
+			bool m_loadedFromFile{false};
+	};
+}
@@ -0,0 +1,149 @@
+/*
+ * src/Vulkan/PipelineCacheFile.cpp
+ * This file is part of Emeraude-Engine
+ *
+ * Copyright (C) 2010-2025 - Sébastien Léon Claude Christian Bémelmans "LondNoir" <londnoir@gmail.com>
+ *
+ * Emeraude-Engine is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * Emeraude-Engine is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with Emeraude-Engine; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * Complete project and additional information can be found at :
+ * https://github.com/londnoir/emeraude-engine
+ *
+ * --- THIS IS AUTOMATICALLY GENERATED, DO NOT CHANGE ---
+ */
+
+#include "PipelineCacheFile.hpp"
+
+/* STL inclusions. */
+#include <cstring>
+#include <fstream>
+#include <system_error>
+
+/* Local inclusions. */
+#include "Libs/Hash/FNV1a.hpp"
+#include "Libs/IO/IO.hpp"
+#include "Libs/IO/MappedFile.hpp"
+#include "Tracer.hpp"
+
+namespace EmEn::Vulkan
+{
+	using namespace EmEn::Libs;
+
+	PipelineCacheFile::PipelineCacheFile (const std::filesystem::path & filepath, const DeviceIdentity & identity) noexcept
+		: m_filepath(filepath),
+		m_identity(identity)
+	{
+
+	}
+
+	bool
+	PipelineCacheFile::read (std::vector< uint8_t > & data) const noexcept
+	{
+		std::error_code errorCode;
+
+		if ( !std::filesystem::exists(m_filepath, errorCode) )
+		{
+			return false;
+		}
+
+		IO::MappedFile file;
+
+		if ( !file.open(m_filepath) )
+		{
+			return false;
+		}
+
+		if ( file.size() < sizeof(FileHeader) )
+		{
+			TraceWarning{ClassId} << "The file " << m_filepath << " is too small !";
+
+			return false;
+		}
+
+		FileHeader header{};
+		std::memcpy(&header, file.data(), sizeof(FileHeader));
+
+		if ( header.magic != Magic || !IO::isNativeByteOrder(header.byteOrderMark) )
+		{
+			TraceWarning{ClassId} << "The file " << m_filepath << " is not a pipeline cache !";
+
+			return false;
+		}
+
+		/* NOTE: A driver update or another GPU is not an error, the cache will be filled again. */
+		if ( header.version != Version ||
+			header.vendorID != m_identity.vendorID ||
+			header.deviceID != m_identity.deviceID ||
+			header.driverVersion != m_identity.driverVersion ||
+			header.pipelineCacheUUID != m_identity.pipelineCacheUUID )
+		{
+			TraceInfo{ClassId} << "The file " << m_filepath << " was written for another device or driver, it will be replaced.";
+
+			return false;
+		}
+
+		if ( header.dataBytes != file.size() - sizeof(FileHeader) )
+		{
+			TraceWarning{ClassId} << "The file " << m_filepath << " is truncated !";
+
+			return false;
+		}
+
+		data.resize(header.dataBytes);
+		std::memcpy(data.data(), file.data() + sizeof(FileHeader), data.size());
+
+		if ( Hash::fnv1a(data.data(), data.size()) != header.checksum )
+		{
+			TraceWarning{ClassId} << "The file " << m_filepath << " is corrupted !";
+
+			data.clear();
+
+			return false;
+		}
+
+		return true;
+	}
+
+	bool
+	PipelineCacheFile::write (const std::vector< uint8_t > & data) const noexcept
+	{
+		const FileHeader header{
+			.magic = Magic,
+			.version = Version,
+			.byteOrderMark = IO::ByteOrderMark,
+			.vendorID = m_identity.vendorID,
+			.deviceID = m_identity.deviceID,
+			.driverVersion = m_identity.driverVersion,
+			.reserved = 0,
+			.pipelineCacheUUID = m_identity.pipelineCacheUUID,
+			.dataBytes = data.size(),
+			.checksum = Hash::fnv1a(data.data(), data.size())
+		};
+
+		std::error_code errorCode;
+
+		if ( m_filepath.has_parent_path() )
+		{
+			std::filesystem::create_directories(m_filepath.parent_path(), errorCode);
+		}
+
+		return IO::writeFileAtomically(m_filepath, [&] (std::ofstream & file) {
+			file.write(reinterpret_cast< const char * >(&header), sizeof(FileHeader));
+			file.write(reinterpret_cast< const char * >(data.data()), static_cast< std::streamsize >(data.size()));
+
+			return true;
+		});
+	}
+}
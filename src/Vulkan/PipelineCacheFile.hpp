@@ -0,0 +1,121 @@
+/*
+ * src/Vulkan/PipelineCacheFile.hpp
+ * This file is part of Emeraude-Engine
+ *
+ * Copyright (C) 2010-2025 - Sébastien Léon Claude Christian Bémelmans "LondNoir" <londnoir@gmail.com>
+ *
+ * Emeraude-Engine is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * Emeraude-Engine is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with Emeraude-Engine; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * Complete project and additional information can be found at :
+ * https://github.com/londnoir/emeraude-engine
+ *
+ * --- THIS IS AUTOMATICALLY GENERATED, DO NOT CHANGE ---
+ */
+
+#pragma once
+
+/* STL inclusions. */
+#include <array>
+#include <cstdint>
+#include <filesystem>
+#include <vector>
+
+namespace EmEn::Vulkan
+{
+	/**
+	 * @brief The pipeline cache file. This stores the driver data of a pipeline cache with the device it was made for.
+	 * @note This does not use the Vulkan API, the pipeline cache gives the device identity and the driver data.
+	 */
+	class PipelineCacheFile final
+	{
+		public:
+
+			/** @brief Class identifier. */
+			static constexpr auto ClassId{"VulkanPipelineCacheFile"};
+
+			/**
+			 * @brief The properties of the device the driver data is valid for.
+			 */
+			struct DeviceIdentity
+			{
+				uint32_t vendorID{0};
+				uint32_t deviceID{0};
+				uint32_t driverVersion{0};
+				std::array< uint8_t, 16 > pipelineCacheUUID{};
+			};
+
+			/**
+			 * @brief Constructs a pipeline cache file.
+			 * @param filepath A reference to a filesystem path.
+			 * @param identity A reference to the device identity.
+			 */
+			PipelineCacheFile (const std::filesystem::path & filepath, const DeviceIdentity & identity) noexcept;
+
+			/**
+			 * @brief Returns the path of the file.
+			 * @return const std::filesystem::path &
+			 */
+			[[nodiscard]]
+			const std::filesystem::path &
+			filepath () const noexcept
+			{
+				return m_filepath;
+			}
+
+			/**
+			 * @brief Reads the driver data from the file.
+			 * @note This fails when the file does not exist, is damaged or was written for another device or driver.
+			 * @param data A reference to a byte vector.
+			 * @return bool
+			 */
+			[[nodiscard]]
+			bool read (std::vector< uint8_t > & data) const noexcept;
+
+			/**
+			 * @brief Writes the driver data into the file.
+			 * @param data A reference to a byte vector.
+			 * @return bool
+			 */
+			[[nodiscard]]
+			bool write (const std::vector< uint8_t > & data) const noexcept;
+
+		private:
+
+			/**
+			 * @brief The pipeline cache file header.
+			 */
+			struct FileHeader
+			{
+				std::array< char, 8 > magic;
+				uint32_t version;
+				uint32_t byteOrderMark;
+				uint32_t vendorID;
+				uint32_t deviceID;
+				uint32_t driverVersion;
+				uint32_t reserved;
+				std::array< uint8_t, 16 > pipelineCacheUUID;
+				uint64_t dataBytes;
+				uint64_t checksum;
+			};
+
+			static_assert(sizeof(FileHeader) == 64);
+
+			static constexpr std::array< char, 8 > Magic{'E', 'M', 'P', 'S', 'O', '\0', '\r', '\n'};
+			static constexpr uint32_t Version{1};
+
+			std::filesystem::path m_filepath;
+			DeviceIdentity m_identity;
+	};
+}
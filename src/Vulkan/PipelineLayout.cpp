@@ -170,13 +170,9 @@ namespace EmEn::Vulkan
 
 		if ( m_handle != VK_NULL_HANDLE )
 		{
-			this->device()->waitIdle("Destroying a pipeline layout");
-
-			vkDestroyPipelineLayout(
-				this->device()->handle(),
-				m_handle,
-				VK_NULL_HANDLE
-			);
+			this->device()->deferDestruction([deviceHandle = this->device()->handle(), handle = m_handle] {
+				vkDestroyPipelineLayout(deviceHandle, handle, nullptr);
+			});
 
 			m_handle = VK_NULL_HANDLE;
 		}
@@ -313,6 +313,33 @@ namespace EmEn::Vulkan
 		return this->submit(submitInfo, fence);
 	}
 
+	bool
+	Queue::submitWait (VkSemaphore waitSemaphore, VkPipelineStageFlags waitStageFlags, VkSemaphore signalSemaphore, VkFence fence) const noexcept
+	{
+		if ( waitSemaphore == VK_NULL_HANDLE )
+		{
+			Tracer::warning(ClassId, "The semaphore to wait is a null pointer ! (8)");
+
+			return false;
+		}
+
+		VkSubmitInfo submitInfo{};
+		submitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+		//submitInfo.pNext = nullptr;
+		submitInfo.waitSemaphoreCount = 1;
+		submitInfo.pWaitSemaphores = &waitSemaphore;
+		submitInfo.pWaitDstStageMask = &waitStageFlags;
+		//submitInfo.commandBufferCount = 0;
+		//submitInfo.pCommandBuffers = nullptr;
+		if ( signalSemaphore != VK_NULL_HANDLE )
+		{
+			submitInfo.signalSemaphoreCount = 1;
+			submitInfo.pSignalSemaphores = &signalSemaphore;
+		}
+
+		return this->submit(submitInfo, fence);
+	}
+
 	bool
 	Queue::present (const VkPresentInfoKHR * presentInfo, bool & swapChainRecreationNeeded) const noexcept
 	{
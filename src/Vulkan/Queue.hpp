@@ -226,6 +226,17 @@ namespace EmEn::Vulkan
 			[[nodiscard]]
 			bool submit (const std::shared_ptr< CommandBuffer > & buffer, VkFence fence = VK_NULL_HANDLE) const noexcept;
 
+			/**
+			 * @brief Submits a batch without command buffer, the later submissions to the queue wait for a semaphore.
+			 * @param waitSemaphore The semaphore handle to wait.
+			 * @param waitStageFlags A mask for wait stage.
+			 * @param signalSemaphore A semaphore handle to signal once the wait is over. Can be null.
+			 * @param fence A fence handle. Default None.
+			 * @return bool
+			 */
+			[[nodiscard]]
+			bool submitWait (VkSemaphore waitSemaphore, VkPipelineStageFlags waitStageFlags, VkSemaphore signalSemaphore, VkFence fence = VK_NULL_HANDLE) const noexcept;
+
 			/**
 			 * @brief Submits a present info.
 			 * @FIXME Bad design.
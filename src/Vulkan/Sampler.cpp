@@ -113,9 +113,9 @@ namespace EmEn::Vulkan
 
 		if (  m_handle != VK_NULL_HANDLE )
 		{
-			this->device()->waitIdle("Destroying a sampler");
-
-			vkDestroySampler(this->device()->handle(), m_handle, nullptr);
+			this->device()->deferDestruction([deviceHandle = this->device()->handle(), handle = m_handle] {
+				vkDestroySampler(deviceHandle, handle, nullptr);
+			});
 
 			m_handle = VK_NULL_HANDLE;
 		}
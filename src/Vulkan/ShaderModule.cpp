@@ -26,6 +26,9 @@
 
 #include "ShaderModule.hpp"
 
+/* STL inclusions. */
+#include <utility>
+
 /* Local inclusions. */
 #include "Device.hpp"
 #include "Utility.hpp"
@@ -102,6 +105,21 @@ namespace EmEn::Vulkan
 		return true;
 	}
 
+	bool
+	ShaderModule::setBinaryCode (std::vector< uint32_t > && binaryCode) noexcept
+	{
+		if ( m_handle != VK_NULL_HANDLE )
+		{
+			Tracer::error(ClassId, "The shader module is already created !");
+
+			return false;
+		}
+
+		m_binaryCode = std::move(binaryCode);
+
+		return true;
+	}
+
 	bool
 	ShaderModule::destroyFromHardware () noexcept
 	{
@@ -114,9 +132,9 @@ namespace EmEn::Vulkan
 
 		if ( m_handle != VK_NULL_HANDLE )
 		{
-			this->device()->waitIdle("Destroying a shader module");
-
-			vkDestroyShaderModule(this->device()->handle(), m_handle, nullptr);
+			this->device()->deferDestruction([deviceHandle = this->device()->handle(), handle = m_handle] {
+				vkDestroyShaderModule(deviceHandle, handle, nullptr);
+			});
 
 			m_handle = VK_NULL_HANDLE;
 		}
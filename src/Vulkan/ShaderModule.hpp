@@ -100,6 +100,14 @@ namespace EmEn::Vulkan
 			/** @copydoc EmEn::Vulkan::AbstractDeviceDependentObject::destroyFromHardware() */
 			bool destroyFromHardware () noexcept override;
 
+			/**
+			 * @brief Sets the binary code when it was not available at construction.
+			 * @note This must be done before the creation on the hardware.
+			 * @param binaryCode A reference to the binary code.
+			 * @return bool
+			 */
+			bool setBinaryCode (std::vector< uint32_t > && binaryCode) noexcept;
+
 			/**
 			 * @brief Returns the shader module handle.
 			 * @return VkShaderModule
@@ -30,7 +30,6 @@
 #include <memory>
 
 /* Local inclusions for inheritances. */
-#include "Libs/LockableTrait.hpp"
 #include "AbstractHostBuffer.hpp"
 
 namespace EmEn::Vulkan
@@ -39,7 +38,7 @@ namespace EmEn::Vulkan
 	 * @brief This buffer is intended to push data all-purposes buffer from CPU to GPU specific buffer.
 	 * @extends EmEn::Vulkan::AbstractHostBuffer This is a host-side buffer.
 	 */
-	class StagingBuffer final : public Libs::LockableTrait, public AbstractHostBuffer
+	class StagingBuffer final : public AbstractHostBuffer
 	{
 		public:
 
@@ -1,5 +1,5 @@
 /*
- * src/MemoryAllocator.cpp
+ * src/Vulkan/StagingRegion.cpp
  * This file is part of Emeraude-Engine
  *
  * Copyright (C) 2010-2025 - Sébastien Léon Claude Christian Bémelmans "LondNoir" <londnoir@gmail.com>
@@ -24,51 +24,52 @@
  * --- THIS IS AUTOMATICALLY GENERATED, DO NOT CHANGE ---
  */
 
-#include "MemoryAllocator.hpp"
+
+#include "StagingRegion.hpp"
+
+/* STL inclusions. */
+#include <cstring>
 
 /* Local inclusions. */
+#include "MemoryRegion.hpp"
+#include "TransferManager.hpp"
 #include "Tracer.hpp"
 
-namespace EmEn
+namespace EmEn::Vulkan
 {
-	const size_t MemoryAllocator::ClassUID{getClassUID(ClassId)};
+	using namespace EmEn::Libs;
 
-	MemoryAllocator::MemoryAllocator () noexcept
-		: ServiceInterface(ClassId)
+	StagingRegion::StagingRegion (TransferManager & transferManager, const std::shared_ptr< StagingBuffer > & buffer, const StagingRing::Region & region, std::byte * pointer) noexcept
+		: m_transferManager(transferManager),
+		m_buffer(buffer),
+		m_region(region),
+		m_pointer(pointer)
 	{
 
 	}
 
-	size_t
-	MemoryAllocator::classUID () const noexcept
-	{
-		return ClassUID;
-	}
-
-	bool
-	MemoryAllocator::is (size_t classUID) const noexcept
-	{
-		return classUID == ClassUID;
-	}
-
-	bool
-	MemoryAllocator::usable () const noexcept
+	StagingRegion::~StagingRegion ()
 	{
-		return m_flags[ServiceInitialized];
+		if ( !m_recorded )
+		{
+			m_transferManager.releaseStagingRegion(*this);
+		}
 	}
 
 	bool
-	MemoryAllocator::onInitialize () noexcept
+	StagingRegion::writeData (const MemoryRegion & memoryRegion) const noexcept
 	{
-		m_flags[ServiceInitialized] = true;
+		if ( memoryRegion.offset() + memoryRegion.bytes() > m_region.size )
+		{
+			TraceError{ClassId} <<
+				"Staging region overflow !" "\n"
+				"(offset:" << memoryRegion.offset() << " + length:" << memoryRegion.bytes() << ") > region:" << m_region.size;
 
-		return true;
-	}
+			return false;
+		}
 
-	bool
-	MemoryAllocator::onTerminate () noexcept
-	{
-		m_flags[ServiceInitialized] = false;
+		/* NOTE: The range belongs to this region only, no lock is needed to write it. */
+		std::memcpy(m_pointer + memoryRegion.offset(), memoryRegion.source(), memoryRegion.bytes());
 
 		return true;
 	}
@@ -0,0 +1,153 @@
+/*
+ * src/Vulkan/StagingRegion.hpp
+ * This file is part of Emeraude-Engine
+ *
+ * Copyright (C) 2010-2025 - Sébastien Léon Claude Christian Bémelmans "LondNoir" <londnoir@gmail.com>
+ *
+ * Emeraude-Engine is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * Emeraude-Engine is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with Emeraude-Engine; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * Complete project and additional information can be found at :
+ * https://github.com/londnoir/emeraude-engine
+ *
+ * --- THIS IS AUTOMATICALLY GENERATED, DO NOT CHANGE ---
+ */
+
+
+#pragma once
+
+/* STL inclusions. */
+#include <cstddef>
+#include <memory>
+
+/* Third-party inclusions. */
+#include <vulkan/vulkan.h>
+
+/* Local inclusions for usages. */
+#include "StagingRing.hpp"
+
+/* Forward declarations. */
+namespace EmEn::Vulkan
+{
+	class TransferManager;
+	class StagingBuffer;
+	class MemoryRegion;
+}
+
+namespace EmEn::Vulkan
+{
+	/**
+	 * @brief A range of staging memory reserved for one transfer.
+	 * @note The range is a part of the transfer manager staging ring, or a dedicated staging buffer for large
+	 * uploads. The memory is persistently mapped, so several threads can write their range at once. Once used by a
+	 * transfer, the range goes back to the ring when the transfer batch is executed.
+	 */
+	class StagingRegion final
+	{
+		friend class TransferManager;
+
+		public:
+
+			/** @brief Class identifier. */
+			static constexpr auto ClassId{"VulkanStagingRegion"};
+
+			/**
+			 * @brief Copy constructor.
+			 * @param copy A reference to the copied instance.
+			 */
+			StagingRegion (const StagingRegion & copy) noexcept = delete;
+
+			/**
+			 * @brief Move constructor.
+			 * @param copy A reference to the copied instance.
+			 */
+			StagingRegion (StagingRegion && copy) noexcept = delete;
+
+			/**
+			 * @brief Copy assignment.
+			 * @param copy A reference to the copied instance.
+			 * @return StagingRegion &
+			 */
+			StagingRegion & operator= (const StagingRegion & copy) noexcept = delete;
+
+			/**
+			 * @brief Move assignment.
+			 * @param copy A reference to the copied instance.
+			 * @return StagingRegion &
+			 */
+			StagingRegion & operator= (StagingRegion && copy) noexcept = delete;
+
+			/**
+			 * @brief Destructs the staging region, giving it back if no transfer used it.
+			 */
+			~StagingRegion ();
+
+			/**
+			 * @brief Returns the staging buffer holding the range.
+			 * @return const StagingBuffer &
+			 */
+			[[nodiscard]]
+			const StagingBuffer &
+			buffer () const noexcept
+			{
+				return *m_buffer;
+			}
+
+			/**
+			 * @brief Returns the offset of the range in the staging buffer.
+			 * @return VkDeviceSize
+			 */
+			[[nodiscard]]
+			VkDeviceSize
+			offset () const noexcept
+			{
+				return m_region.offset;
+			}
+
+			/**
+			 * @brief Returns the size of the range in bytes.
+			 * @return VkDeviceSize
+			 */
+			[[nodiscard]]
+			VkDeviceSize
+			bytes () const noexcept
+			{
+				return m_region.size;
+			}
+
+			/**
+			 * @brief Writes data into the range.
+			 * @param memoryRegion A reference to a memory region. The offset is relative to the range.
+			 * @return bool
+			 */
+			bool writeData (const MemoryRegion & memoryRegion) const noexcept;
+
+		private:
+
+			/**
+			 * @brief Constructs a staging region.
+			 * @param transferManager A reference to the transfer manager.
+			 * @param buffer A reference to the staging buffer smart pointer.
+			 * @param region A reference to the range in the staging buffer.
+			 * @param pointer The host address of the range.
+			 */
+			StagingRegion (TransferManager & transferManager, const std::shared_ptr< StagingBuffer > & buffer, const StagingRing::Region & region, std::byte * pointer) noexcept;
+
+			TransferManager & m_transferManager;
+			std::shared_ptr< StagingBuffer > m_buffer;
+			StagingRing::Region m_region;
+			std::byte * m_pointer;
+			bool m_recorded{false};
+	};
+}
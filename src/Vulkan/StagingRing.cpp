@@ -0,0 +1,129 @@
+/*
+ * src/Vulkan/StagingRing.cpp
+ * This file is part of Emeraude-Engine
+ *
+ * Copyright (C) 2010-2025 - Sébastien Léon Claude Christian Bémelmans "LondNoir" <londnoir@gmail.com>
+ *
+ * Emeraude-Engine is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * Emeraude-Engine is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with Emeraude-Engine; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * Complete project and additional information can be found at :
+ * https://github.com/londnoir/emeraude-engine
+ *
+ * --- THIS IS AUTOMATICALLY GENERATED, DO NOT CHANGE ---
+ */
+
+
+#include "StagingRing.hpp"
+
+/* STL inclusions. */
+#include <algorithm>
+
+namespace EmEn::Vulkan
+{
+	StagingRing::StagingRing (uint64_t capacity) noexcept
+		: m_capacity(capacity)
+	{
+
+	}
+
+	bool
+	StagingRing::reserve (uint64_t bytes, uint64_t alignment, Region & region) noexcept
+	{
+		if ( bytes == 0 || bytes > m_capacity )
+		{
+			return false;
+		}
+
+		const std::lock_guard< std::mutex > lock{m_access};
+
+		const auto headOffset = m_head % m_capacity;
+		auto offset = (headOffset + alignment - 1) & ~(alignment - 1);
+		auto startPosition = m_head + (offset - headOffset);
+
+		/* NOTE: The range would cross the end of the memory, it starts over at the beginning. */
+		if ( offset + bytes > m_capacity )
+		{
+			offset = 0;
+			startPosition = m_head + (m_capacity - headOffset);
+		}
+
+		const auto endPosition = startPosition + bytes;
+
+		if ( endPosition - m_tail > m_capacity )
+		{
+			return false;
+		}
+
+		m_entries.push_back({endPosition, 0, false});
+		m_head = endPosition;
+
+		region.offset = offset;
+		region.size = bytes;
+		region.position = endPosition;
+
+		return true;
+	}
+
+	void
+	StagingRing::retire (const Region & region, uint64_t timelineValue) noexcept
+	{
+		const std::lock_guard< std::mutex > lock{m_access};
+
+		const auto entryIt = std::ranges::lower_bound(m_entries, region.position, {}, &Entry::endPosition);
+
+		if ( entryIt == m_entries.end() || entryIt->endPosition != region.position )
+		{
+			return;
+		}
+
+		entryIt->timelineValue = timelineValue;
+		entryIt->retired = true;
+	}
+
+	size_t
+	StagingRing::reclaim (uint64_t completedValue) noexcept
+	{
+		const std::lock_guard< std::mutex > lock{m_access};
+
+		size_t count = 0;
+
+		/* NOTE: A range still written or recorded holds the next ones, the memory is given back in order. */
+		while ( !m_entries.empty() && m_entries.front().retired && m_entries.front().timelineValue <= completedValue )
+		{
+			m_tail = m_entries.front().endPosition;
+			m_entries.pop_front();
+
+			count++;
+		}
+
+		return count;
+	}
+
+	uint64_t
+	StagingRing::usedBytes () const noexcept
+	{
+		const std::lock_guard< std::mutex > lock{m_access};
+
+		return m_head - m_tail;
+	}
+
+	size_t
+	StagingRing::regionCount () const noexcept
+	{
+		const std::lock_guard< std::mutex > lock{m_access};
+
+		return m_entries.size();
+	}
+}
@@ -0,0 +1,168 @@
+/*
+ * src/Vulkan/StagingRing.hpp
+ * This file is part of Emeraude-Engine
+ *
+ * Copyright (C) 2010-2025 - Sébastien Léon Claude Christian Bémelmans "LondNoir" <londnoir@gmail.com>
+ *
+ * Emeraude-Engine is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * Emeraude-Engine is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with Emeraude-Engine; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * Complete project and additional information can be found at :
+ * https://github.com/londnoir/emeraude-engine
+ *
+ * --- THIS IS AUTOMATICALLY GENERATED, DO NOT CHANGE ---
+ */
+
+
+#pragma once
+
+/* STL inclusions. */
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+
+namespace EmEn::Vulkan
+{
+	/**
+	 * @brief Hands out ranges of a fixed size staging memory in a circular way.
+	 * @note Ranges are given back in reservation order, once the transfer batch reading them is executed. A range
+	 * never crosses the end of the memory, the remaining space is skipped instead. This class only does the
+	 * bookkeeping, the memory itself is a persistently mapped staging buffer owned by the transfer manager.
+	 */
+	class StagingRing final
+	{
+		public:
+
+			/** @brief Class identifier. */
+			static constexpr auto ClassId{"VulkanStagingRing"};
+
+			/** @brief A reserved range. */
+			struct Region
+			{
+				/** @brief The offset in the staging memory. */
+				uint64_t offset{0};
+				/** @brief The size in bytes. */
+				uint64_t size{0};
+				/** @brief The end of the range in the ring history, zero for a range out of the ring. */
+				uint64_t position{0};
+			};
+
+			/**
+			 * @brief Constructs a staging ring.
+			 * @param capacity The size of the staging memory in bytes.
+			 */
+			explicit StagingRing (uint64_t capacity) noexcept;
+
+			/**
+			 * @brief Copy constructor.
+			 * @param copy A reference to the copied instance.
+			 */
+			StagingRing (const StagingRing & copy) noexcept = delete;
+
+			/**
+			 * @brief Move constructor.
+			 * @param copy A reference to the copied instance.
+			 */
+			StagingRing (StagingRing && copy) noexcept = delete;
+
+			/**
+			 * @brief Copy assignment.
+			 * @param copy A reference to the copied instance.
+			 * @return StagingRing &
+			 */
+			StagingRing & operator= (const StagingRing & copy) noexcept = delete;
+
+			/**
+			 * @brief Move assignment.
+			 * @param copy A reference to the copied instance.
+			 * @return StagingRing &
+			 */
+			StagingRing & operator= (StagingRing && copy) noexcept = delete;
+
+			/**
+			 * @brief Destructs the staging ring.
+			 */
+			~StagingRing () = default;
+
+			/**
+			 * @brief Reserves a range.
+			 * @note This method is thread-safe.
+			 * @param bytes The size of the range in bytes.
+			 * @param alignment The alignment of the range offset. Must be a power of two.
+			 * @param region A reference to the reserved range.
+			 * @return bool False if there is not enough free space for now.
+			 */
+			[[nodiscard]]
+			bool reserve (uint64_t bytes, uint64_t alignment, Region & region) noexcept;
+
+			/**
+			 * @brief Declares the timeline value after which a range is not read anymore.
+			 * @note This method is thread-safe.
+			 * @param region A reference to the reserved range.
+			 * @param timelineValue The timeline value of the transfer batch using the range.
+			 * @return void
+			 */
+			void retire (const Region & region, uint64_t timelineValue) noexcept;
+
+			/**
+			 * @brief Gives back the retired ranges whose timeline value is completed.
+			 * @note This method is thread-safe.
+			 * @param completedValue The timeline completed value.
+			 * @return size_t The number of ranges given back.
+			 */
+			size_t reclaim (uint64_t completedValue) noexcept;
+
+			/**
+			 * @brief Returns the size of the staging memory in bytes.
+			 * @return uint64_t
+			 */
+			[[nodiscard]]
+			uint64_t
+			capacity () const noexcept
+			{
+				return m_capacity;
+			}
+
+			/**
+			 * @brief Returns the number of bytes not given back yet, alignment and skipped space included.
+			 * @return uint64_t
+			 */
+			[[nodiscard]]
+			uint64_t usedBytes () const noexcept;
+
+			/**
+			 * @brief Returns the number of ranges not given back yet.
+			 * @return size_t
+			 */
+			[[nodiscard]]
+			size_t regionCount () const noexcept;
+
+		private:
+
+			/** @brief A range in reservation order. */
+			struct Entry
+			{
+				uint64_t endPosition{0};
+				uint64_t timelineValue{0};
+				bool retired{false};
+			};
+
+			const uint64_t m_capacity;
+			uint64_t m_head{0};
+			uint64_t m_tail{0};
+			std::deque< Entry > m_entries;
+			mutable std::mutex m_access;
+	};
+}
@@ -731,6 +731,8 @@ namespace EmEn::Vulkan
 			return false;
 		}
 
+		this->device()->frameTimeline().complete(currentFrame.timelineValue);
+
 		const auto result = vkAcquireNextImageKHR(
 			this->device()->handle(),
 			m_handle,
@@ -782,7 +784,9 @@ namespace EmEn::Vulkan
 			return false;
 		}
 
-		const auto & currentFrame = m_frames.at(m_currentFrame);
+		this->device()->frameTimeline().complete(m_frames.at(imageIndex).timelineValue);
+
+		auto & currentFrame = m_frames.at(m_currentFrame);
 
 		if ( !currentFrame.inFlightFence->reset() )
 		{
@@ -802,6 +806,9 @@ namespace EmEn::Vulkan
 			return false;
 		}
 
+		/* NOTE: The fence covers every earlier submission to the queue, the offscreen render targets of the frame included. */
+		currentFrame.timelineValue = this->device()->frameTimeline().submit();
+
 		const auto * presentationQueue = this->device()->getQueue(QueueJob::Presentation, QueuePriority::High);
 
 		bool swapChainRecreationNeeded = false;
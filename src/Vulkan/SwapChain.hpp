@@ -79,6 +79,8 @@ namespace EmEn::Vulkan
 		std::unique_ptr< Sync::Semaphore > imageAvailableSemaphore;
 		std::unique_ptr< Sync::Semaphore > renderFinishedSemaphore;
 		std::unique_ptr< Sync::Fence > inFlightFence;
+		/* Device frame timeline value completed once the in-flight fence is signaled. */
+		uint64_t timelineValue{0};
 	};
 
 	/**
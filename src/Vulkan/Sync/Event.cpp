@@ -107,9 +107,9 @@ namespace EmEn::Vulkan::Sync
 
 		if (  m_handle != VK_NULL_HANDLE )
 		{
-			this->device()->waitIdle("Destroying an event");
-
-			vkDestroyEvent(this->device()->handle(), m_handle, nullptr);
+			this->device()->deferDestruction([deviceHandle = this->device()->handle(), handle = m_handle] {
+				vkDestroyEvent(deviceHandle, handle, nullptr);
+			});
 
 			m_handle = VK_NULL_HANDLE;
 		}
@@ -107,9 +107,9 @@ namespace EmEn::Vulkan::Sync
 
 		if (  m_handle != VK_NULL_HANDLE )
 		{
-			this->device()->waitIdle("Destroying a fence");
-
-			vkDestroyFence(this->device()->handle(), m_handle, nullptr);
+			this->device()->deferDestruction([deviceHandle = this->device()->handle(), handle = m_handle] {
+				vkDestroyFence(deviceHandle, handle, nullptr);
+			});
 
 			m_handle = VK_NULL_HANDLE;
 		}
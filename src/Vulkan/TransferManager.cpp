@@ -27,13 +27,17 @@
 #include "TransferManager.hpp"
 
 /* STL inclusions. */
+#include <algorithm>
 #include <exception>
 #include <iostream>
 #include <sstream>
 #include <memory>
+#include <utility>
 
 /* Local inclusions. */
 #include "Sync/ImageMemoryBarrier.hpp"
+#include "Sync/Fence.hpp"
+#include "Sync/Semaphore.hpp"
 #include "Device.hpp"
 #include "Queue.hpp"
 #include "CommandPool.hpp"
@@ -123,6 +127,29 @@ namespace EmEn::Vulkan
 			m_specificCommandPool = m_transferCommandPool;
 		}
 
+		/* NOTE: The staging ring stays mapped for the whole service life. */
+		m_stagingRingBuffer = this->createStagingBuffer(StagingRingSize);
+
+		if ( m_stagingRingBuffer == nullptr )
+		{
+			Tracer::error(ClassId, "Unable to create the staging ring !");
+
+			return false;
+		}
+
+		m_stagingRingPointer = m_stagingRingBuffer->mapMemory< std::byte >();
+
+		if ( m_stagingRingPointer == nullptr )
+		{
+			Tracer::error(ClassId, "Unable to map the staging ring !");
+
+			m_stagingRingBuffer.reset();
+
+			return false;
+		}
+
+		m_device->setTransferTimeline(&m_destinationTimeline);
+
 		m_flags[ServiceInitialized] = true;
 
 		return true;
@@ -131,19 +158,32 @@ namespace EmEn::Vulkan
 	bool
 	TransferManager::onTerminate () noexcept
 	{
-		const std::lock_guard< std::mutex > lockA{m_stagingBufferMutex};
-		const std::lock_guard< std::mutex > lockB{m_transferMutex};
+		const std::lock_guard< std::mutex > lock{m_batchAccess};
 
 		m_flags[ServiceInitialized] = false;
 
-		/* FIXME: Seems unnecessary */
+		this->submitBatch();
+
 		m_device->waitIdle("Destroying a transfert manager");
 
+		for ( const auto & batch : m_submittedBatches )
+		{
+			m_timeline.complete(batch.timelineValue);
+		}
+
+		m_submittedBatches.clear();
+		m_recordingBatch = {};
+
+		m_device->setTransferTimeline(nullptr);
+
+		m_stagingRing.reclaim(m_timeline.completedValue());
+
+		m_stagingRingPointer = nullptr;
+		m_stagingRingBuffer.reset();
+
 		m_specificCommandPool.reset();
 		m_transferCommandPool.reset();
 
-		m_stagingBuffers.clear();
-
 		m_device.reset();
 
 		return true;
@@ -152,50 +192,108 @@ namespace EmEn::Vulkan
 	std::string
 	TransferManager::getStagingBuffersStatistics () const noexcept
 	{
+		const std::lock_guard< std::mutex > lock{m_batchAccess};
+
 		std::stringstream output;
 
-		output << "Allocated staging buffers :" "\n";
+		output <<
+			"Staging ring : " << m_stagingRing.usedBytes() << " / " << m_stagingRing.capacity() << " bytes used by " << m_stagingRing.regionCount() << " ranges" "\n"
+			"Transfer batches in flight : " << m_submittedBatches.size() << " (timeline " << m_timeline.completedValue() << " / " << m_timeline.pendingValue() << ")" "\n"
+			"Transfers recorded : " << m_recordingBatch.transferCount << "\n";
 
-		for ( const auto & stagingBuffer : m_stagingBuffers )
+		for ( const auto & batch : m_submittedBatches )
 		{
-			output << " - Buffer @" << stagingBuffer.get() << " size " << stagingBuffer->bytes() << " bytes" "\n";
+			for ( const auto & stagingBuffer : batch.stagingBuffers )
+			{
+				output << " - Dedicated buffer @" << stagingBuffer.get() << " size " << stagingBuffer->bytes() << " bytes" "\n";
+			}
 		}
 
 		return output.str();
 	}
 
-	std::shared_ptr< StagingBuffer >
-	TransferManager::getStagingBuffer (size_t bytes) noexcept
+	std::unique_ptr< StagingRegion >
+	TransferManager::getStagingRegion (size_t bytes) noexcept
 	{
-		const std::lock_guard< std::mutex > lock{m_stagingBufferMutex};
+		if ( bytes == 0 )
+		{
+			Tracer::error(ClassId, "Unable to reserve an empty staging region !");
 
-		/* Try to get an existing one... */
-		auto buffer = this->searchFreeStagingBuffer(bytes);
+			return nullptr;
+		}
 
-		if ( buffer == nullptr )
+		/* NOTE: Large uploads would hold most of the ring, they get their own buffer. */
+		if ( bytes <= StagingRingSize / 2 )
 		{
-			/* ... Or create a new one. */
-			buffer = this->createStagingBuffer(bytes);
+			StagingRing::Region region;
 
-			if ( buffer == nullptr )
+			while ( true )
 			{
-				return nullptr;
+				if ( m_stagingRing.reserve(bytes, StagingAlignment, region) )
+				{
+					return std::unique_ptr< StagingRegion >{new StagingRegion{*this, m_stagingRingBuffer, region, m_stagingRingPointer + region.offset}};
+				}
+
+				std::shared_ptr< Sync::Fence > oldestFence;
+
+				{
+					const std::lock_guard< std::mutex > lock{m_batchAccess};
+
+					this->collectCompletedBatches();
+
+					if ( m_stagingRing.reserve(bytes, StagingAlignment, region) )
+					{
+						return std::unique_ptr< StagingRegion >{new StagingRegion{*this, m_stagingRingBuffer, region, m_stagingRingPointer + region.offset}};
+					}
+
+					/* NOTE: The ring is full, the recorded transfers are submitted to free it as soon as possible. */
+					this->submitBatch();
+
+					if ( m_submittedBatches.empty() )
+					{
+						break;
+					}
+
+					oldestFence = m_submittedBatches.front().fence;
+				}
+
+				if ( m_flags[Debug] )
+				{
+					TraceInfo{ClassId} << "The staging ring is full, waiting for a transfer batch." "\n" << this->getStagingBuffersStatistics();
+				}
+
+				if ( !oldestFence->wait() )
+				{
+					break;
+				}
 			}
+		}
 
-			m_stagingBuffers.emplace_back(buffer);
+		/* NOTE: The ring is held by ranges still written by other threads, or the upload is too large. */
+		auto buffer = this->createStagingBuffer(bytes);
+
+		if ( buffer == nullptr )
+		{
+			return nullptr;
 		}
 
-		/* Lock the buffer for the outside world. */
-		buffer->lock();
+		auto * pointer = buffer->mapMemory< std::byte >();
 
-		return buffer;
+		if ( pointer == nullptr )
+		{
+			TraceError{ClassId} << "Unable to map a staging buffer of " << bytes << " bytes !";
+
+			return nullptr;
+		}
+
+		return std::unique_ptr< StagingRegion >{new StagingRegion{*this, buffer, {0, bytes, 0}, pointer}};
 	}
 
 	std::shared_ptr< StagingBuffer >
 	TransferManager::createStagingBuffer (size_t bytes) const noexcept
 	{
 		auto buffer = std::make_shared< StagingBuffer >(m_device, bytes);
-		buffer->setIdentifier((std::stringstream{} << "TransferManager-Buffer" << m_stagingBuffers.size() << "-StagingBuffer").str());
+		buffer->setIdentifier(ClassId, bytes == StagingRingSize ? "Ring" : "Dedicated", "StagingBuffer");
 
 		if ( !buffer->createOnHardware() )
 		{
@@ -207,110 +305,114 @@ namespace EmEn::Vulkan
 		return buffer;
 	}
 
-	std::shared_ptr< StagingBuffer >
-	TransferManager::searchFreeStagingBuffer (size_t bytes) const noexcept
+	CommandBuffer *
+	TransferManager::getTransferCommandBuffer () noexcept
 	{
-		if ( m_stagingBuffers.empty() )
+		if ( m_recordingBatch.transferCommandBuffer == nullptr )
 		{
-			return nullptr;
-		}
+			auto commandBuffer = std::make_shared< CommandBuffer >(m_transferCommandPool, true);
+			commandBuffer->setIdentifier(ClassId, "TransferBatch", "CommandBuffer");
 
-		/* Get the first free buffer with sufficient space ... */
-		for ( const auto & stagingBuffer : m_stagingBuffers )
-		{
-			if ( stagingBuffer->isLocked() )
+			if ( !commandBuffer->isCreated() || !commandBuffer->begin(VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT) )
 			{
-				continue;
-			}
+				Tracer::error(ClassId, "Unable to create a transfer command buffer !");
 
-			if ( bytes > stagingBuffer->bytes() )
-			{
-				continue;
+				return nullptr;
 			}
 
-			return stagingBuffer;
+			m_recordingBatch.transferCommandBuffer = std::move(commandBuffer);
 		}
 
-		/* ... Or get the first free buffer and reallocate it ... */
-		for ( const auto & stagingBuffer : m_stagingBuffers )
+		return m_recordingBatch.transferCommandBuffer.get();
+	}
+
+	CommandBuffer *
+	TransferManager::getGraphicsCommandBuffer () noexcept
+	{
+		if ( m_recordingBatch.graphicsCommandBuffer == nullptr )
 		{
-			if ( stagingBuffer->isLocked() )
-			{
-				continue;
-			}
+			auto commandBuffer = std::make_shared< CommandBuffer >(m_specificCommandPool, true);
+			commandBuffer->setIdentifier(ClassId, "PrepareImageBatch", "CommandBuffer");
 
-			if ( bytes > stagingBuffer->bytes() )
+			if ( !commandBuffer->isCreated() || !commandBuffer->begin(VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT) )
 			{
-				if ( !stagingBuffer->recreateOnHardware(bytes) )
-				{
-					continue;
-				}
+				Tracer::error(ClassId, "Unable to create a graphics command buffer !");
+
+				return nullptr;
 			}
 
-			return stagingBuffer;
+			m_recordingBatch.graphicsCommandBuffer = std::move(commandBuffer);
 		}
 
-		if ( m_flags[Debug] )
+		return m_recordingBatch.graphicsCommandBuffer.get();
+	}
+
+	void
+	TransferManager::recordStagingRegion (StagingRegion & stagingRegion) noexcept
+	{
+		/* NOTE: The batch value is known before its submission, it is the timeline pending value. */
+		if ( stagingRegion.m_region.position > 0 )
 		{
-			TraceInfo{ClassId} << "No existing staging buffer available for now." "\n" << this->getStagingBuffersStatistics();
+			m_stagingRing.retire(stagingRegion.m_region, m_timeline.pendingValue());
 		}
+		else
+		{
+			m_recordingBatch.stagingBuffers.emplace_back(stagingRegion.m_buffer);
+		}
+
+		m_destinationTimeline.record(m_timeline.pendingValue());
 
-		return nullptr;
+		m_recordingBatch.transferCount++;
+
+		stagingRegion.m_recorded = true;
 	}
 
-	bool
-	TransferManager::transfer (const StagingBuffer & stagingBuffer, AbstractDeviceBuffer & dstBuffer, VkDeviceSize offset) noexcept
+	void
+	TransferManager::releaseStagingRegion (const StagingRegion & stagingRegion) noexcept
 	{
-		const std::lock_guard< std::mutex > lock{m_transferMutex};
+		/* NOTE: The device never read this range, it can be given back with the next reclaim. */
+		if ( stagingRegion.m_region.position > 0 )
+		{
+			m_stagingRing.retire(stagingRegion.m_region, 0);
+		}
+	}
 
+	bool
+	TransferManager::transfer (StagingRegion & stagingRegion, AbstractDeviceBuffer & dstBuffer) noexcept
+	{
 		if constexpr ( IsDebug )
 		{
-			const auto endCopyOffset = offset + dstBuffer.bytes();
-
-			if ( endCopyOffset > stagingBuffer.bytes() )
+			if ( dstBuffer.bytes() > stagingRegion.bytes() )
 			{
-				const auto overflow = endCopyOffset - stagingBuffer.bytes();
+				const auto overflow = dstBuffer.bytes() - stagingRegion.bytes();
 
 				TraceError{ClassId} <<
 					"Source buffer overflow with " << overflow << " bytes !" "\n"
-					"(offset:" << offset << " + length:" << dstBuffer.bytes() << ") > srcBuffer:" << stagingBuffer.bytes();
+					"(length:" << dstBuffer.bytes() << ") > srcRegion:" << stagingRegion.bytes();
 
 				return false;
 			}
 		}
 
-		auto commandBuffer = std::make_shared< CommandBuffer >(m_transferCommandPool, true);
-		commandBuffer->setIdentifier(ClassId, "ToBuffer", "CommandBuffer");
+		const std::lock_guard< std::mutex > lock{m_batchAccess};
 
-		if ( !commandBuffer->isCreated() )
-		{
-			Tracer::error(ClassId, "Unable to create a transfer command buffer !");
-
-			return false;
-		}
+		const auto * commandBuffer = this->getTransferCommandBuffer();
 
-		if ( !commandBuffer->begin(VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT) )
+		if ( commandBuffer == nullptr )
 		{
 			return false;
 		}
 
-		commandBuffer->copy(stagingBuffer, dstBuffer, offset, 0, dstBuffer.bytes());
+		commandBuffer->copy(stagingRegion.buffer(), dstBuffer, stagingRegion.offset(), 0, dstBuffer.bytes());
 
-		if ( !commandBuffer->end() )
-		{
-			return false;
-		}
-
-		const std::lock_guard< std::mutex > deviceAccessLockGuard{m_device->deviceAccessLock()};
+		this->recordStagingRegion(stagingRegion);
 
-		return m_device->getQueue(QueueJob::Transfer, QueuePriority::Medium)->submit(commandBuffer);
+		return true;
 	}
 
 	bool
-	TransferManager::transfer (const StagingBuffer & stagingBuffer, Image & dstImage, VkDeviceSize /*offset*/) noexcept
+	TransferManager::transfer (StagingRegion & stagingRegion, Image & dstImage) noexcept
 	{
-		const std::lock_guard< std::mutex > lock{m_transferMutex};
-
 		constexpr VkImageAspectFlags aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
 		const auto baseWidth = dstImage.createInfo().extent.width;
 		const auto baseHeight = dstImage.createInfo().extent.height;
@@ -318,12 +420,13 @@ namespace EmEn::Vulkan
 		const auto layerCount = dstImage.createInfo().arrayLayers;
 		const auto mipLevelCount = dstImage.createInfo().mipLevels;
 
+		const std::lock_guard< std::mutex > lock{m_batchAccess};
+
 		/* NOTE: Work on transfer queue. */
 		{
-			const auto commandBuffer = std::make_shared< CommandBuffer >(m_transferCommandPool, true);
-			commandBuffer->setIdentifier(ClassId, "StagingBufferToImage", "CommandBuffer");
+			const auto * commandBuffer = this->getTransferCommandBuffer();
 
-			if ( !commandBuffer->begin(VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT) )
+			if ( commandBuffer == nullptr )
 			{
 				return false;
 			}
@@ -345,7 +448,7 @@ namespace EmEn::Vulkan
 				const uint32_t layerOffset = layerIndex * (baseWidth * baseHeight * pixelBytes);
 
 				VkBufferImageCopy bufferImageCopy{};
-				bufferImageCopy.bufferOffset = layerOffset;
+				bufferImageCopy.bufferOffset = stagingRegion.offset() + layerOffset;
 				bufferImageCopy.bufferRowLength = 0;
 				bufferImageCopy.bufferImageHeight = 0;
 				bufferImageCopy.imageSubresource.aspectMask = aspectMask;
@@ -361,7 +464,7 @@ namespace EmEn::Vulkan
 
 				vkCmdCopyBufferToImage(
 					commandBuffer->handle(),
-					stagingBuffer.handle(),
+					stagingRegion.buffer().handle(),
 					dstImage.handle(), VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
 					1, &bufferImageCopy
 				);
@@ -381,33 +484,16 @@ namespace EmEn::Vulkan
 				commandBuffer->pipelineBarrier(barrier, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT);
 			}
 
-			if ( commandBuffer->end() )
-			{
-				const std::lock_guard< std::mutex > deviceAccessLockGuard{m_device->deviceAccessLock()};
-
-				if ( !m_device->getQueue(QueueJob::Transfer, QueuePriority::Medium)->submit(commandBuffer) )
-				{
-					return false;
-				}
-
-				dstImage.setCurrentImageLayout(mipLevelCount > 1 ? VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL : VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL);
-			}
-			else
-			{
-				Tracer::error(ClassId, "Unable to finish the command buffer to transfer an image !");
-
-				return false;
-			}
+			this->recordStagingRegion(stagingRegion);
 
-			/* FIXME: This causes a VK_ERROR_DEVICE_LOST (smart-pointer gone) */
+			dstImage.setCurrentImageLayout(mipLevelCount > 1 ? VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL : VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL);
 		}
 
-		/* NOTE: Work on graphics queue. */
+		/* NOTE: Work on graphics queue, executed after the transfer queue part of the batch. */
 		{
-			const auto commandBuffer = std::make_shared< CommandBuffer >(m_specificCommandPool, true);
-			commandBuffer->setIdentifier(ClassId, "PrepareImage", "CommandBuffer");
+			const auto * commandBuffer = this->getGraphicsCommandBuffer();
 
-			if ( !commandBuffer->begin(VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT) )
+			if ( commandBuffer == nullptr )
 			{
 				return false;
 			}
@@ -504,25 +590,266 @@ namespace EmEn::Vulkan
 				commandBuffer->pipelineBarrier(barrier, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT);
 			}
 
-			if ( commandBuffer->end() )
+			dstImage.setCurrentImageLayout(VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
+		}
+
+		return true;
+	}
+
+	bool
+	TransferManager::transfer (StagingRegion & stagingRegion, Image & dstImage, const std::vector< VkBufferImageCopy > & regions) noexcept
+	{
+		constexpr VkImageAspectFlags aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+
+		/* NOTE: The regions offsets are relative to the staging range. */
+		auto bufferImageCopies = regions;
+
+		for ( auto & bufferImageCopy : bufferImageCopies )
+		{
+			bufferImageCopy.bufferOffset += stagingRegion.offset();
+		}
+
+		const std::lock_guard< std::mutex > lock{m_batchAccess};
+
+		/* NOTE: Work on transfer queue. */
+		{
+			const auto * commandBuffer = this->getTransferCommandBuffer();
+
+			if ( commandBuffer == nullptr )
+			{
+				return false;
+			}
+
+			/* Prepare every level layout to receive data. */
+			{
+				Sync::ImageMemoryBarrier barrier{
+					dstImage,
+					VK_ACCESS_NONE, VK_ACCESS_TRANSFER_WRITE_BIT,
+					VK_IMAGE_LAYOUT_UNDEFINED, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+					aspectMask
+				};
+				barrier.setIdentifier(ClassId, "ImageLevels", "ImageMemoryBarrier");
+
+				commandBuffer->pipelineBarrier(barrier, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT);
+			}
+
+			vkCmdCopyBufferToImage(
+				commandBuffer->handle(),
+				stagingRegion.buffer().handle(),
+				dstImage.handle(), VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+				static_cast< uint32_t >(bufferImageCopies.size()), bufferImageCopies.data()
+			);
+
+			this->recordStagingRegion(stagingRegion);
+
+			dstImage.setCurrentImageLayout(VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL);
+		}
+
+		/* NOTE: Work on graphics queue, executed after the transfer queue part of the batch. */
+		{
+			const auto * commandBuffer = this->getGraphicsCommandBuffer();
+
+			if ( commandBuffer == nullptr )
+			{
+				return false;
+			}
+
+			/* Prepare the image layout to be used by a fragment shader. */
+			{
+				Sync::ImageMemoryBarrier barrier{
+					dstImage,
+					VK_ACCESS_TRANSFER_WRITE_BIT, VK_ACCESS_SHADER_READ_BIT,
+					VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL,
+					aspectMask
+				};
+				barrier.setIdentifier(ClassId, "FinalImageLevels", "ImageMemoryBarrier");
+
+				commandBuffer->pipelineBarrier(barrier, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT);
+			}
+
+			dstImage.setCurrentImageLayout(VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
+		}
+
+		return true;
+	}
+
+	bool
+	TransferManager::submitTransfers () noexcept
+	{
+		const std::lock_guard< std::mutex > lock{m_batchAccess};
+
+		this->collectCompletedBatches();
+
+		return this->submitBatch();
+	}
+
+	bool
+	TransferManager::waitTransfers (uint64_t timelineValue) noexcept
+	{
+		std::vector< std::shared_ptr< Sync::Fence > > fences;
+
+		{
+			const std::lock_guard< std::mutex > lock{m_batchAccess};
+
+			/* NOTE: The value belongs to the batch being recorded, it must be submitted first. */
+			if ( timelineValue >= m_timeline.pendingValue() && !this->submitBatch() )
 			{
-				const std::lock_guard< std::mutex > deviceAccessLockGuard{m_device->deviceAccessLock()};
+				return false;
+			}
 
-				if ( !m_device->getQueue(QueueJob::GraphicsTransfer, QueuePriority::Medium)->submit(commandBuffer) )
+			for ( const auto & batch : m_submittedBatches )
+			{
+				if ( batch.timelineValue <= timelineValue )
 				{
-					return false;
+					fences.emplace_back(batch.fence);
 				}
+			}
+		}
 
-				dstImage.setCurrentImageLayout(VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
+		for ( const auto & fence : fences )
+		{
+			if ( !fence->wait() )
+			{
+				return false;
 			}
-			else
+		}
+
+		const std::lock_guard< std::mutex > lock{m_batchAccess};
+
+		this->collectCompletedBatches();
+
+		return true;
+	}
+
+	bool
+	TransferManager::submitBatch () noexcept
+	{
+		if ( m_recordingBatch.transferCount == 0 )
+		{
+			return true;
+		}
+
+		auto batch = std::move(m_recordingBatch);
+
+		m_recordingBatch = {};
+
+		const auto failure = [this] (const char * message) {
+			Tracer::error(ClassId, message);
+
+			/* NOTE: Part of the batch may be queued, the staging memory is given back once the device is idle. */
+			m_device->waitIdle("Transfer batch failure");
+
+			m_timeline.complete(m_timeline.submit());
+			m_stagingRing.reclaim(m_timeline.completedValue());
+
+			return false;
+		};
+
+		if ( batch.transferCommandBuffer == nullptr || !batch.transferCommandBuffer->end() )
+		{
+			return failure("Unable to finish the transfer command buffer of the batch !");
+		}
+
+		if ( batch.graphicsCommandBuffer != nullptr && !batch.graphicsCommandBuffer->end() )
+		{
+			return failure("Unable to finish the graphics command buffer of the batch !");
+		}
+
+		/* NOTE: The batch is submitted in steps chained by semaphores : the copies on the transfer queue, the image
+		 * layouts on the graphics queue, then a wait on each render queue so every later work submitted to them reads
+		 * the uploaded data. The last step signals the fence. */
+		std::vector< std::pair< const Queue *, std::shared_ptr< CommandBuffer > > > steps;
+		steps.emplace_back(m_device->getQueue(QueueJob::Transfer, QueuePriority::Medium), batch.transferCommandBuffer);
+
+		if ( batch.graphicsCommandBuffer != nullptr )
+		{
+			steps.emplace_back(m_device->getQueue(QueueJob::GraphicsTransfer, QueuePriority::Medium), batch.graphicsCommandBuffer);
+		}
+
+		for ( const auto queueJob : {QueueJob::Graphics, QueueJob::Presentation} )
+		{
+			const auto * queue = m_device->getQueue(queueJob, QueuePriority::High);
+
+			if ( queue != nullptr && std::ranges::none_of(steps, [queue] (const auto & step) { return step.first == queue && step.second == nullptr; }) )
 			{
-				Tracer::error(ClassId, "Unable to finish the command buffer to finalize the image !");
+				steps.emplace_back(queue, nullptr);
+			}
+		}
 
-				return false;
+		for ( size_t stepIndex = 1; stepIndex < steps.size(); stepIndex++ )
+		{
+			auto semaphore = std::make_shared< Sync::Semaphore >(m_device);
+			semaphore->setIdentifier(ClassId, "TransferBatch", "Semaphore");
+
+			if ( !semaphore->createOnHardware() )
+			{
+				return failure("Unable to create a semaphore of the batch !");
+			}
+
+			batch.semaphores.emplace_back(std::move(semaphore));
+		}
+
+		batch.fence = std::make_shared< Sync::Fence >(m_device, 0);
+		batch.fence->setIdentifier(ClassId, "TransferBatch", "Fence");
+
+		if ( !batch.fence->createOnHardware() )
+		{
+			return failure("Unable to create the fence of the batch !");
+		}
+
+		{
+			const std::lock_guard< std::mutex > deviceAccessLockGuard{m_device->deviceAccessLock()};
+
+			for ( size_t stepIndex = 0; stepIndex < steps.size(); stepIndex++ )
+			{
+				const auto & [queue, commandBuffer] = steps[stepIndex];
+				const auto isLastStep = stepIndex + 1 == steps.size();
+				const auto waitSemaphore = stepIndex > 0 ? batch.semaphores[stepIndex - 1]->handle() : VK_NULL_HANDLE;
+				const auto signalSemaphore = isLastStep ? VK_NULL_HANDLE : batch.semaphores[stepIndex]->handle();
+				const auto fence = isLastStep ? batch.fence->handle() : VK_NULL_HANDLE;
+
+				bool submitted = false;
+
+				if ( commandBuffer == nullptr )
+				{
+					submitted = queue->submitWait(waitSemaphore, VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, signalSemaphore, fence);
+				}
+				else if ( waitSemaphore == VK_NULL_HANDLE )
+				{
+					submitted = isLastStep ? queue->submit(commandBuffer, fence) : queue->submit(commandBuffer, signalSemaphore, fence);
+				}
+				else
+				{
+					submitted = isLastStep ?
+						queue->submit(commandBuffer, waitSemaphore, VK_PIPELINE_STAGE_TRANSFER_BIT, fence) :
+						queue->submit(commandBuffer, waitSemaphore, VK_PIPELINE_STAGE_TRANSFER_BIT, signalSemaphore, fence);
+				}
+
+				if ( !submitted )
+				{
+					return failure("Unable to submit a step of the batch !");
+				}
 			}
 		}
 
+		batch.timelineValue = m_timeline.submit();
+
+		m_submittedBatches.emplace_back(std::move(batch));
+
 		return true;
 	}
+
+	void
+	TransferManager::collectCompletedBatches () noexcept
+	{
+		/* NOTE: Batches are executed in submission order, the first busy one ends the collect. */
+		while ( !m_submittedBatches.empty() && m_submittedBatches.front().fence->getStatus() == Sync::FenceStatus::Ready )
+		{
+			m_timeline.complete(m_submittedBatches.front().timelineValue);
+
+			m_submittedBatches.pop_front();
+		}
+
+		m_stagingRing.reclaim(m_timeline.completedValue());
+	}
 }
@@ -28,7 +28,10 @@
 
 /* STL inclusions. */
 #include <cstddef>
+#include <cstdint>
 #include <array>
+#include <atomic>
+#include <deque>
 #include <memory>
 #include <mutex>
 #include <string>
@@ -41,6 +44,9 @@
 #include "ServiceInterface.hpp"
 
 /* Local inclusions for usages. */
+#include "DeletionQueue.hpp"
+#include "StagingRegion.hpp"
+#include "StagingRing.hpp"
 #include "Types.hpp"
 
 /* Forward declarations. */
@@ -48,8 +54,15 @@ namespace EmEn
 {
 	namespace Vulkan
 	{
+		namespace Sync
+		{
+			class Fence;
+			class Semaphore;
+		}
+
 		class Device;
 		class CommandPool;
+		class CommandBuffer;
 		class StagingBuffer;
 		class AbstractDeviceBuffer;
 		class Image;
@@ -64,10 +77,17 @@ namespace EmEn::Vulkan
 {
 	/**
 	 * @brief The transfer manager service class.
+	 * @note Uploads are written into a persistently mapped staging ring and recorded into the current batch. The
+	 * batch is submitted at once, usually by the renderer every frame, and its staging ranges are given back once its
+	 * fence is signaled. The loading threads only share a lock to record the copy commands. The render queues wait for
+	 * each batch, so the work submitted to them after the batch reads the uploaded data, and the device objects
+	 * released while a transfer into them is pending are destroyed once the transfer is executed.
 	 * @extends EmEn::ServiceInterface This class is a service.
 	 */
 	class TransferManager final : public ServiceInterface
 	{
+		friend class StagingRegion;
+
 		public:
 
 			/** @brief Class identifier. */
@@ -76,6 +96,12 @@ namespace EmEn::Vulkan
 			/** @brief Observable class unique identifier. */
 			static const size_t ClassUID;
 
+			/** @brief The size of the staging ring. Larger uploads than half of it get their own staging buffer. */
+			static constexpr VkDeviceSize StagingRingSize{64ULL * 1024 * 1024};
+
+			/** @brief The alignment of the staging ranges, enough for every texel block size and the copy offsets. */
+			static constexpr VkDeviceSize StagingAlignment{16};
+
 			/**
 			 * @brief Constructs the transfer manager.
 			 * @param type The GPU work type.
@@ -169,40 +195,76 @@ namespace EmEn::Vulkan
 			}
 
 			/**
-			 * @brief Returns a string with the allocated staging buffers.
+			 * @brief Returns the timeline of the transfer batches.
+			 * @note A transfer is executed once the completed value reaches the pending value read after the transfer call.
+			 * @return const TimelineInterface &
+			 */
+			[[nodiscard]]
+			const TimelineInterface &
+			timeline () const noexcept
+			{
+				return m_timeline;
+			}
+
+			/**
+			 * @brief Returns a string with the staging memory usage.
 			 * @return std::string
 			 */
 			[[nodiscard]]
 			std::string getStagingBuffersStatistics () const noexcept;
 
 			/**
-			 * @brief Returns a locked staging buffer.
-			 * @param bytes The size in bytes of the buffer.
-			 * @return std::shared_ptr< StagingBuffer >
+			 * @brief Reserves a range of staging memory.
+			 * @note When the staging ring is full, this waits for the oldest transfer batch to be executed.
+			 * @param bytes The size in bytes of the range.
+			 * @return std::unique_ptr< StagingRegion >
 			 */
 			[[nodiscard]]
-			std::shared_ptr< StagingBuffer > getStagingBuffer (size_t bytes) noexcept;
+			std::unique_ptr< StagingRegion > getStagingRegion (size_t bytes) noexcept;
 
 			/**
-			 * @brief Transfer a buffer from the CPU to the GPU.
-			 * @param stagingBuffer A reference to the staging buffer (CPU side).
+			 * @brief Records a transfer from a staging range to a buffer into the current batch.
+			 * @param stagingRegion A reference to the staging range (CPU side).
 			 * @param dstBuffer A reference to the destination buffer (GPU side).
-			 * @param offset The offset in the staging buffer where the date to copy starts. Default 0.
 			 * @return bool
 			 */
 			[[nodiscard]]
-			bool transfer (const StagingBuffer & stagingBuffer, AbstractDeviceBuffer & dstBuffer, VkDeviceSize offset = 0) noexcept;
+			bool transfer (StagingRegion & stagingRegion, AbstractDeviceBuffer & dstBuffer) noexcept;
 
 			/**
-			 * @brief Transfer a buffer from the CPU to the GPU.
+			 * @brief Records a transfer from a staging range to an image into the current batch.
 			 * @note This version will generate mip-mapping on the GPU and is using two command buffer (transfer and graphics).
-			 * @param stagingBuffer A reference to the staging buffer (CPU side).
+			 * @param stagingRegion A reference to the staging range (CPU side).
+			 * @param dstImage A reference to the destination image (GPU side).
+			 * @return bool
+			 */
+			[[nodiscard]]
+			bool transfer (StagingRegion & stagingRegion, Image & dstImage) noexcept;
+
+			/**
+			 * @brief Records a transfer from a staging range holding every level of an image into the current batch.
+			 * @note No mip-mapping is generated, the levels are copied as they are. This is the only way for block compressed images.
+			 * @param stagingRegion A reference to the staging range (CPU side).
 			 * @param dstImage A reference to the destination image (GPU side).
-			 * @param offset The offset in the staging buffer where the date to copy starts. Default 0.
+			 * @param regions A reference to the list of copies from the staging range to the image subresources.
 			 * @return bool
 			 */
 			[[nodiscard]]
-			bool transfer (const StagingBuffer & stagingBuffer, Image & dstImage, VkDeviceSize offset = 0) noexcept;
+			bool transfer (StagingRegion & stagingRegion, Image & dstImage, const std::vector< VkBufferImageCopy > & regions) noexcept;
+
+			/**
+			 * @brief Submits the transfers recorded since the last call in one batch.
+			 * @note This must be called regularly, the renderer does it every frame before submitting its work.
+			 * @return bool
+			 */
+			bool submitTransfers () noexcept;
+
+			/**
+			 * @brief Waits for the transfers up to a timeline value to be executed.
+			 * @param timelineValue The timeline value to wait for.
+			 * @return bool
+			 */
+			bool waitTransfers (uint64_t timelineValue) noexcept;
 
 			/**
 			 * @brief Returns the instance of the transfer manager.
@@ -219,6 +281,71 @@ namespace EmEn::Vulkan
 
 		private:
 
+			/**
+			 * @brief The timeline of the batches holding a transfer, used to defer the destruction of the transfer destinations.
+			 * @note The pending value is the one of the last batch a transfer was recorded in, so an object released when
+			 * the batch being recorded is still empty only waits for the batches already submitted.
+			 */
+			class DestinationTimeline final : public TimelineInterface
+			{
+				public:
+
+					/**
+					 * @brief Constructs a destination timeline.
+					 * @param timeline A reference to the timeline of the batches.
+					 */
+					explicit
+					DestinationTimeline (const FrameTimeline & timeline) noexcept
+						: m_timeline(timeline)
+					{
+
+					}
+
+					/** @copydoc EmEn::Vulkan::TimelineInterface::pendingValue() */
+					[[nodiscard]]
+					uint64_t
+					pendingValue () const noexcept override
+					{
+						return m_recordedValue.load(std::memory_order_acquire);
+					}
+
+					/** @copydoc EmEn::Vulkan::TimelineInterface::completedValue() */
+					[[nodiscard]]
+					uint64_t
+					completedValue () const noexcept override
+					{
+						return m_timeline.completedValue();
+					}
+
+					/**
+					 * @brief Declares a transfer recorded in a batch.
+					 * @param value The timeline value of the batch.
+					 * @return void
+					 */
+					void
+					record (uint64_t value) noexcept
+					{
+						m_recordedValue.store(value, std::memory_order_release);
+					}
+
+				private:
+
+					const FrameTimeline & m_timeline;
+					std::atomic< uint64_t > m_recordedValue{0};
+			};
+
+			/** @brief The transfers recorded together and submitted at once. */
+			struct Batch
+			{
+				uint64_t timelineValue{0};
+				size_t transferCount{0};
+				std::shared_ptr< CommandBuffer > transferCommandBuffer;
+				std::shared_ptr< CommandBuffer > graphicsCommandBuffer;
+				std::vector< std::shared_ptr< Sync::Semaphore > > semaphores;
+				std::shared_ptr< Sync::Fence > fence;
+				std::vector< std::shared_ptr< StagingBuffer > > stagingBuffers;
+			};
+
 			/** @copydoc EmEn::ServiceInterface::onInitialize() */
 			bool onInitialize () noexcept override;
 
@@ -234,12 +361,49 @@ namespace EmEn::Vulkan
 			std::shared_ptr< StagingBuffer > createStagingBuffer (size_t bytes) const noexcept;
 
 			/**
-			 * @brief Returns a free staging buffer from previous one or nullptr if no buffer is available.
-			 * @param bytes The size in bytes of the buffer.
-			 * @return std::shared_ptr< StagingBuffer >
+			 * @brief Returns the transfer queue command buffer of the current batch, beginning it if needed.
+			 * @warning The batch mutex must be locked.
+			 * @return CommandBuffer *
 			 */
 			[[nodiscard]]
-			std::shared_ptr< StagingBuffer > searchFreeStagingBuffer (size_t bytes) const noexcept;
+			CommandBuffer * getTransferCommandBuffer () noexcept;
+
+			/**
+			 * @brief Returns the graphics queue command buffer of the current batch, beginning it if needed.
+			 * @warning The batch mutex must be locked.
+			 * @return CommandBuffer *
+			 */
+			[[nodiscard]]
+			CommandBuffer * getGraphicsCommandBuffer () noexcept;
+
+			/**
+			 * @brief Attaches a staging range to the current batch.
+			 * @warning The batch mutex must be locked.
+			 * @param stagingRegion A reference to the staging range.
+			 * @return void
+			 */
+			void recordStagingRegion (StagingRegion & stagingRegion) noexcept;
+
+			/**
+			 * @brief Gives back a staging range no transfer used.
+			 * @param stagingRegion A reference to the staging range.
+			 * @return void
+			 */
+			void releaseStagingRegion (const StagingRegion & stagingRegion) noexcept;
+
+			/**
+			 * @brief Submits the current batch.
+			 * @warning The batch mutex must be locked.
+			 * @return bool
+			 */
+			bool submitBatch () noexcept;
+
+			/**
+			 * @brief Releases the executed batches and their staging memory.
+			 * @warning The batch mutex must be locked.
+			 * @return void
+			 */
+			void collectCompletedBatches () noexcept;
 
 			/* Flag names. */
 			static constexpr auto Debug{0UL};
@@ -249,12 +413,16 @@ namespace EmEn::Vulkan
 			static std::array< TransferManager *, 2 > s_instances;
 
 			std::shared_ptr< Device > m_device;
-			std::vector< std::shared_ptr< StagingBuffer > > m_stagingBuffers;
 			std::shared_ptr< CommandPool > m_transferCommandPool;
 			std::shared_ptr< CommandPool > m_specificCommandPool;
-			/* FIXME: Check the usefulness of these mutexes since we use a device mutex to access queues. */
-			std::mutex m_stagingBufferMutex;
-			std::mutex m_transferMutex;
+			StagingRing m_stagingRing{StagingRingSize};
+			std::shared_ptr< StagingBuffer > m_stagingRingBuffer;
+			std::byte * m_stagingRingPointer{nullptr};
+			FrameTimeline m_timeline;
+			DestinationTimeline m_destinationTimeline{m_timeline};
+			Batch m_recordingBatch;
+			std::deque< Batch > m_submittedBatches;
+			mutable std::mutex m_batchAccess;
 			std::array< bool, 8 > m_flags{
 				false/*Debug*/,
 				false/*ServiceInitialized*/,
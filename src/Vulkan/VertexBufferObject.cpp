@@ -42,7 +42,7 @@ namespace EmEn::Vulkan
 	}
 
 	bool
-	VertexBufferObject::create (TransferManager & transferManager, const std::vector< float > & data) noexcept
+	VertexBufferObject::create (TransferManager & transferManager, std::span< const float > data) noexcept
 	{
 		const auto bytes = data.size() * sizeof(float);
 
@@ -29,6 +29,7 @@
 /* STL inclusions. */
 #include <cstdint>
 #include <memory>
+#include <span>
 #include <vector>
 
 /* Local inclusions for inheritances. */
@@ -93,11 +94,11 @@ namespace EmEn::Vulkan
 			/**
 			 * @brief Creates a vertex buffer object with initial data.
 			 * @param transferManager A reference to a transfer manager.
-			 * @param data A reference to a vector.
+			 * @param data A view on the vertex attributes, from a vector or a mapped file.
 			 * @return bool
 			 */
 			[[nodiscard]]
-			bool create (TransferManager & transferManager, const std::vector< float > & data) noexcept;
+			bool create (TransferManager & transferManager, std::span< const float > data) noexcept;
 
 			[[nodiscard]]
 			bool writeData (TransferManager & transferManager, const std::vector< float > & data) noexcept;